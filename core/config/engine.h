@@ -57,6 +57,7 @@ private:
 	int ips = 60;
 	double physics_jitter_fix = 0.5;
 	double _fps = 1;
+	double _frame_time_jitter = 0;
 	int _target_fps = 0;
 	double _time_scale = 1.0;
 	uint64_t _physics_frames = 0;
@@ -91,6 +92,7 @@ public:
 	virtual int get_target_fps() const;
 
 	virtual double get_frames_per_second() const { return _fps; }
+	double get_frame_time_jitter() const { return _frame_time_jitter; }
 
 	uint64_t get_frames_drawn();
 
@@ -120,6 +120,17 @@ ResourceUID::ID ResourceLoader::get_resource_uid(const String &p_path) {
 	return ::ResourceLoader::get_resource_uid(p_path);
 }
 
+Dictionary ResourceLoader::get_deduplication_stats() {
+	uint64_t shared_count = 0;
+	uint64_t bytes_saved = 0;
+	::ResourceLoader::get_deduplication_stats(shared_count, bytes_saved);
+
+	Dictionary stats;
+	stats["shared_count"] = shared_count;
+	stats["bytes_saved"] = bytes_saved;
+	return stats;
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
@@ -134,6 +145,7 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_cached", "path"), &ResourceLoader::has_cached);
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &ResourceLoader::exists, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("get_resource_uid", "path"), &ResourceLoader::get_resource_uid);
+	ClassDB::bind_method(D_METHOD("get_deduplication_stats"), &ResourceLoader::get_deduplication_stats);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
@@ -1831,6 +1843,47 @@ void Mutex::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("unlock"), &Mutex::unlock);
 }
 
+////// StringBuilder //////
+
+Ref<StringBuilder> StringBuilder::append(const String &p_string) {
+	builder.append(p_string);
+	return this;
+}
+
+void StringBuilder::reserve(int p_length) {
+	ERR_FAIL_COND(p_length < 0);
+	builder.reserve(p_length);
+}
+
+void StringBuilder::clear() {
+	builder.clear();
+}
+
+int StringBuilder::get_length() const {
+	return builder.get_string_length();
+}
+
+bool StringBuilder::is_empty() const {
+	return builder.get_string_length() == 0;
+}
+
+String StringBuilder::get_string() const {
+	return builder.as_string();
+}
+
+String StringBuilder::to_string() {
+	return builder.as_string();
+}
+
+void StringBuilder::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("append", "string"), &StringBuilder::append);
+	ClassDB::bind_method(D_METHOD("reserve", "length"), &StringBuilder::reserve);
+	ClassDB::bind_method(D_METHOD("clear"), &StringBuilder::clear);
+	ClassDB::bind_method(D_METHOD("get_length"), &StringBuilder::get_length);
+	ClassDB::bind_method(D_METHOD("is_empty"), &StringBuilder::is_empty);
+	ClassDB::bind_method(D_METHOD("get_string"), &StringBuilder::get_string);
+}
+
 ////// Thread //////
 
 void Thread::_start_func(void *ud) {
@@ -2182,6 +2235,10 @@ double Engine::get_frames_per_second() const {
 	return ::Engine::get_singleton()->get_frames_per_second();
 }
 
+double Engine::get_frame_time_jitter() const {
+	return ::Engine::get_singleton()->get_frame_time_jitter();
+}
+
 uint64_t Engine::get_physics_frames() const {
 	return ::Engine::get_singleton()->get_physics_frames();
 }
@@ -2312,6 +2369,7 @@ void Engine::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_frames_drawn"), &Engine::get_frames_drawn);
 	ClassDB::bind_method(D_METHOD("get_frames_per_second"), &Engine::get_frames_per_second);
+	ClassDB::bind_method(D_METHOD("get_frame_time_jitter"), &Engine::get_frame_time_jitter);
 	ClassDB::bind_method(D_METHOD("get_physics_frames"), &Engine::get_physics_frames);
 	ClassDB::bind_method(D_METHOD("get_process_frames"), &Engine::get_process_frames);
 
@@ -42,6 +42,7 @@
 #include "core/os/os.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/string/string_builder.h"
 #include "core/templates/safe_refcount.h"
 
 class MainLoop;
@@ -84,6 +85,7 @@ public:
 	bool has_cached(const String &p_path);
 	bool exists(const String &p_path, const String &p_type_hint = "");
 	ResourceUID::ID get_resource_uid(const String &p_path);
+	Dictionary get_deduplication_stats();
 
 	ResourceLoader() { singleton = this; }
 };
@@ -552,6 +554,23 @@ public:
 	void post();
 };
 
+class StringBuilder : public RefCounted {
+	GDCLASS(StringBuilder, RefCounted);
+	::StringBuilder builder;
+
+	static void _bind_methods();
+
+public:
+	Ref<StringBuilder> append(const String &p_string);
+	void reserve(int p_length);
+	void clear();
+	int get_length() const;
+	bool is_empty() const;
+	String get_string() const;
+
+	virtual String to_string() override;
+};
+
 class Thread : public RefCounted {
 	GDCLASS(Thread, RefCounted);
 
@@ -644,6 +663,7 @@ public:
 	int get_target_fps() const;
 
 	double get_frames_per_second() const;
+	double get_frame_time_jitter() const;
 	uint64_t get_physics_frames() const;
 	uint64_t get_process_frames() const;
 
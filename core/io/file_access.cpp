@@ -34,6 +34,7 @@
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = { nullptr, nullptr };
@@ -377,6 +378,66 @@ uint64_t FileAccess::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return i;
 }
 
+uint64_t FileAccess::get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	// Generic version, implementations with positional reads don't need the lock.
+	// The position is restored afterwards, but the file shouldn't be used from other threads meanwhile.
+	MutexLock lock(buffer_at_mutex);
+	FileAccess *self = const_cast<FileAccess *>(this);
+	uint64_t prev_pos = get_position();
+	self->seek(p_offset);
+	uint64_t read = get_buffer(p_dst, p_length);
+	self->seek(prev_pos);
+
+	return read;
+}
+
+struct FileAccessAsyncRead {
+	Ref<FileAccess> file;
+	uint64_t offset = 0;
+	uint64_t length = 0;
+	uint8_t *dst = nullptr;
+	FileAccess::AsyncReadCallback callback = nullptr;
+	void *userdata = nullptr;
+};
+
+static void _file_access_async_read(void *p_userdata) {
+	FileAccessAsyncRead *read = (FileAccessAsyncRead *)p_userdata;
+	uint64_t bytes_read = read->file->get_buffer_at(read->offset, read->dst, read->length);
+	if (read->callback) {
+		read->callback(read->userdata, bytes_read);
+	}
+	memdelete(read);
+}
+
+int64_t FileAccess::read_async(uint64_t p_offset, uint64_t p_length, uint8_t *p_dst, AsyncReadCallback p_callback, void *p_userdata) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	FileAccessAsyncRead *read = memnew(FileAccessAsyncRead);
+	read->file = Ref<FileAccess>(this); // Keeps the file open until the read is done.
+	read->offset = p_offset;
+	read->length = p_length;
+	read->dst = p_dst;
+	read->callback = p_callback;
+	read->userdata = p_userdata;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (!pool || pool->get_thread_count() == 0) {
+		_file_access_async_read(read);
+		return -1;
+	}
+	// Low priority, as these mostly block on the disk.
+	return pool->add_native_task(&_file_access_async_read, read, false, "FileAccessAsyncRead");
+}
+
+void FileAccess::wait_for_async_read(int64_t p_id) {
+	if (p_id < 0) {
+		return; // Was done right away.
+	}
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(p_id);
+}
+
 String FileAccess::get_as_utf8_string() const {
 	Vector<uint8_t> sourcef;
 	uint64_t len = get_length();
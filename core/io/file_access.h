@@ -34,6 +34,7 @@
 #include "core/math/math_defs.h"
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
 #include "core/string/ustring.h"
 #include "core/typedefs.h"
 
@@ -53,6 +54,7 @@ public:
 	typedef void (*FileCloseFailNotify)(const String &);
 
 	typedef Ref<FileAccess> (*CreateFunc)();
+	typedef void (*AsyncReadCallback)(void *p_userdata, uint64_t p_bytes_read);
 	bool big_endian = false;
 	bool real_is_double = false;
 
@@ -69,6 +71,8 @@ protected:
 private:
 	static bool backup_save;
 
+	mutable Mutex buffer_at_mutex;
+
 	AccessType _access_type = ACCESS_FILESYSTEM;
 	static CreateFunc create_func[ACCESS_MAX]; /** default file access creation function for a platform */
 	template <class T>
@@ -110,6 +114,12 @@ public:
 	virtual real_t get_real() const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; } ///< get the next bytes in place, without copying, and advance past them; nullptr if the file isn't memory mapped or is too short
+	virtual const uint8_t *map_contents(uint64_t &r_length) { return nullptr; } ///< map the whole file in memory for reading, valid until the file is closed; nullptr if not supported
+	virtual uint64_t get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes at a given position without moving the current one; safe to call from several threads at once
+
+	int64_t read_async(uint64_t p_offset, uint64_t p_length, uint8_t *p_dst, AsyncReadCallback p_callback = nullptr, void *p_userdata = nullptr); ///< read an array of bytes at a given position on the WorkerThreadPool, calling p_callback from there once done; returns an ID for wait_for_async_read()
+	void wait_for_async_read(int64_t p_id); ///< wait until an async read completes; must be called once for every ID returned by read_async()
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -30,7 +30,54 @@
 
 #include "file_access_compressed.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
+#include "core/templates/safe_refcount.h"
+
+// Sequential reads decompress this much at once, spread over the worker threads when there's enough of it.
+static const uint32_t READ_AHEAD_SIZE = 256 * 1024;
+static const uint32_t MAX_BATCH_BLOCKS = 64;
+static const uint64_t MIN_PARALLEL_SIZE = 64 * 1024;
+
+static bool _use_worker_threads(uint32_t p_block_count, uint64_t p_size) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Not from pool threads (such as the ones loading resources), waiting there for a nested group can deadlock the pool.
+	return p_block_count > 1 && p_size >= MIN_PARALLEL_SIZE && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1;
+}
+
+struct FileAccessCompressed::DecompressBatch {
+	const FileAccessCompressed *file = nullptr;
+	uint32_t first_block = 0;
+	const uint8_t *src = nullptr; // The compressed blocks, back to back.
+	uint8_t *dst = nullptr;
+	SafeFlag failed;
+
+	void decompress_task(uint32_t p_index, void *p_userdata) {
+		const uint32_t block = first_block + p_index;
+		const ReadBlock &rb = file->read_blocks[block];
+		const uint8_t *block_src = src + (rb.offset - file->read_blocks[first_block].offset);
+		int ret = Compression::decompress(dst + (uint64_t)p_index * file->block_size, file->_get_block_size(block), block_src, rb.csize, file->cmode);
+		if (ret == -1) {
+			failed.set();
+		}
+	}
+};
+
+struct FileAccessCompressed::CompressBatch {
+	const FileAccessCompressed *file = nullptr;
+	uint32_t block_count = 0;
+	Vector<uint8_t> *blocks = nullptr;
+
+	void compress_task(uint32_t p_index, void *p_userdata) {
+		uint32_t bl = p_index == (block_count - 1) ? file->write_max % file->block_size : file->block_size;
+		const uint8_t *bp = &file->write_ptr[(uint64_t)p_index * file->block_size];
+
+		Vector<uint8_t> &cblock = blocks[p_index];
+		cblock.resize(Compression::get_max_compressed_buffer_size(bl, file->cmode));
+		int s = Compression::compress(cblock.ptrw(), bp, bl, file->cmode);
+		cblock.resize(s);
+	}
+};
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
@@ -82,17 +129,117 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
 	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
-	at_end = false;
+	at_end = read_total == 0;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
+	read_ahead_blocks = CLAMP(READ_AHEAD_SIZE / block_size, 1u, MAX_BATCH_BLOCKS);
+	read_ahead = true;
+	buffer_first_block = 0;
+	buffer_block_count = 0;
 
-	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
+	// Blocks are decompressed when first read, so whole blocks can go straight to the reader's buffer.
 	read_block = 0;
+	read_block_size = _get_block_size(0);
+	read_block_pending = true;
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	return OK;
+}
+
+Error FileAccessCompressed::open_for_writing(Ref<FileAccess> p_base) {
+	ERR_FAIL_COND_V(p_base.is_null(), ERR_INVALID_PARAMETER);
+	_close();
+
+	f = p_base;
+	_start_writing();
+
+	return OK;
+}
+
+void FileAccessCompressed::_start_writing() {
+	buffer.clear();
+	writing = true;
+	write_pos = 0;
+	write_buffer_size = 256;
+	buffer.resize(256);
+	write_max = 0;
+	write_ptr = buffer.ptrw();
+
+	//don't store anything else unless it's done saving!
+}
+
+Error FileAccessCompressed::_read_blocks(uint32_t p_first, uint32_t p_count, uint8_t *p_dst) const {
+	// Consecutive blocks are stored back to back, read them all at once.
+	const ReadBlock &first = read_blocks[p_first];
+	const ReadBlock &last = read_blocks[p_first + p_count - 1];
+	uint64_t csize = last.offset + last.csize - first.offset;
+	if ((uint64_t)comp_buffer.size() < csize) {
+		comp_buffer.resize(csize);
+	}
+	if (f->get_position() != first.offset) {
+		const_cast<FileAccess *>(f.ptr())->seek(first.offset);
+	}
+	f->get_buffer(comp_buffer.ptrw(), csize);
+
+	DecompressBatch batch;
+	batch.file = this;
+	batch.first_block = p_first;
+	batch.src = comp_buffer.ptr();
+	batch.dst = p_dst;
+
+	if (_use_worker_threads(p_count, (uint64_t)p_count * block_size)) {
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(&batch, &DecompressBatch::decompress_task, (void *)nullptr, p_count, -1, true, SNAME("FileAccessCompressedRead"));
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < p_count; i++) {
+			batch.decompress_task(i, nullptr);
+		}
+	}
+
+	ERR_FAIL_COND_V_MSG(batch.failed.is_set(), ERR_FILE_CORRUPT, "Compressed file is corrupt.");
+	return OK;
+}
+
+Error FileAccessCompressed::_fill_buffer() const {
+	uint32_t count = read_ahead ? MIN(read_ahead_blocks, read_block_count - read_block) : 1;
+	if ((uint64_t)buffer.size() < (uint64_t)count * block_size) {
+		buffer.resize(count * block_size);
+	}
+
+	buffer_first_block = read_block;
+	buffer_block_count = 0;
+	Error err = _read_blocks(read_block, count, buffer.ptrw());
+	if (err != OK) {
+		return err;
+	}
+	buffer_block_count = count;
+
+	read_ptr = buffer.ptrw();
+	read_block_pending = false;
+	return OK;
+}
+
+void FileAccessCompressed::_set_read_block(uint32_t p_block) const {
+	read_block = p_block;
+	read_block_size = _get_block_size(p_block);
+	read_block_pending = p_block < buffer_first_block || p_block >= buffer_first_block + buffer_block_count;
+	if (!read_block_pending) {
+		read_ptr = buffer.ptrw() + (uint64_t)(p_block - buffer_first_block) * block_size;
+	}
+}
+
+void FileAccessCompressed::_advance_block() const {
+	if (read_pos < read_block_size) {
+		return;
+	}
+
+	if (read_block + 1 < read_block_count) {
+		_set_read_block(read_block + 1);
+		read_pos = 0;
+		read_ahead = true;
+	}
+	at_end = (uint64_t)read_block * block_size + read_pos >= read_total;
 }
 
 Error FileAccessCompressed::_open(const String &p_path, int p_mode_flags) {
@@ -108,15 +255,7 @@ Error FileAccessCompressed::_open(const String &p_path, int p_mode_flags) {
 	}
 
 	if (p_mode_flags & WRITE) {
-		buffer.clear();
-		writing = true;
-		write_pos = 0;
-		write_buffer_size = 256;
-		buffer.resize(256);
-		write_max = 0;
-		write_ptr = buffer.ptrw();
-
-		//don't store anything else unless it's done saving!
+		_start_writing();
 	} else {
 		char rmagic[5];
 		f->get_buffer((uint8_t *)rmagic, 4);
@@ -146,28 +285,32 @@ void FileAccessCompressed::_close() {
 		f->store_32(write_max); //max amount of data written 4
 		uint32_t bc = (write_max / block_size) + 1;
 
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
+		// Blocks are independent, compress them all first so they can be spread over the worker threads.
+		Vector<Vector<uint8_t>> blocks;
+		blocks.resize(bc);
 
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+		CompressBatch batch;
+		batch.file = this;
+		batch.block_count = bc;
+		batch.blocks = blocks.ptrw();
 
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+		if (_use_worker_threads(bc, write_max)) {
+			WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+			WorkerThreadPool::GroupID group = pool->add_template_group_task(&batch, &CompressBatch::compress_task, (void *)nullptr, bc, -1, true, SNAME("FileAccessCompressedWrite"));
+			pool->wait_for_group_task_completion(group);
+		} else {
+			for (uint32_t i = 0; i < bc; i++) {
+				batch.compress_task(i, nullptr);
+			}
 		}
 
-		f->seek(16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
+			f->store_32(blocks[i].size()); //compressed sizes
 		}
-		f->seek_end();
+		for (uint32_t i = 0; i < bc; i++) {
+			f->store_buffer(blocks[i].ptr(), blocks[i].size());
+		}
+
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
 
 		buffer.clear();
@@ -176,6 +319,7 @@ void FileAccessCompressed::_close() {
 		comp_buffer.clear();
 		buffer.clear();
 		read_blocks.clear();
+		buffer_block_count = 0;
 	}
 	f.unref();
 }
@@ -199,18 +343,15 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 		} else {
 			at_end = false;
 			read_eof = false;
-			uint32_t block_idx = p_position / block_size;
-			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-			}
+		}
 
-			read_pos = p_position % block_size;
+		uint32_t block_idx = p_position / block_size;
+		if (block_idx != read_block) {
+			read_ahead = false;
+			_set_read_block(block_idx);
 		}
+
+		read_pos = p_position % block_size;
 	}
 }
 
@@ -259,25 +400,14 @@ uint8_t FileAccessCompressed::get_8() const {
 		return 0;
 	}
 
+	if (read_block_pending) {
+		ERR_FAIL_COND_V(_fill_buffer() != OK, 0);
+	}
+
 	uint8_t ret = read_ptr[read_pos];
 
 	read_pos++;
-	if (read_pos >= read_block_size) {
-		read_block++;
-
-		if (read_block < read_block_count) {
-			//read another block of compressed data
-			f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-			int total = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-			ERR_FAIL_COND_V_MSG(total == -1, 0, "Compressed file is corrupt.");
-			read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-			read_pos = 0;
-
-		} else {
-			read_block--;
-			at_end = true;
-		}
-	}
+	_advance_block();
 
 	return ret;
 }
@@ -292,32 +422,43 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
-
-			if (read_block < read_block_count) {
-				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-				read_pos = 0;
-
-			} else {
-				read_block--;
-				at_end = true;
-				if (i + 1 < p_length) {
-					read_eof = true;
-				}
-				return i + 1;
+	uint64_t dst_pos = 0;
+	while (dst_pos < p_length) {
+		if (at_end) {
+			read_eof = true;
+			break;
+		}
+
+		uint64_t left = p_length - dst_pos;
+		if (read_block_pending && read_pos == 0 && left >= read_block_size) {
+			// Whole blocks are wanted, decompress them straight into the destination.
+			uint32_t count = 1;
+			uint64_t whole = read_block_size;
+			while (count < MAX_BATCH_BLOCKS && read_block + count < read_block_count && whole + _get_block_size(read_block + count) <= left) {
+				whole += _get_block_size(read_block + count);
+				count++;
 			}
+
+			ERR_FAIL_COND_V(_read_blocks(read_block, count, p_dst + dst_pos) != OK, -1);
+			dst_pos += whole;
+			_set_read_block(read_block + count - 1);
+			read_pos = read_block_size;
+			_advance_block();
+			continue;
 		}
+
+		if (read_block_pending) {
+			ERR_FAIL_COND_V(_fill_buffer() != OK, -1);
+		}
+
+		uint64_t to_copy = MIN(left, read_block_size - read_pos);
+		memcpy(p_dst + dst_pos, read_ptr + read_pos, to_copy);
+		dst_pos += to_copy;
+		read_pos += to_copy;
+		_advance_block();
 	}
 
-	return p_length;
+	return dst_pos;
 }
 
 Error FileAccessCompressed::get_error() const {
@@ -339,6 +480,16 @@ void FileAccessCompressed::store_8(uint8_t p_dest) {
 	write_ptr[write_pos++] = p_dest;
 }
 
+void FileAccessCompressed::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!writing, "File has not been opened in write mode.");
+	ERR_FAIL_COND(!p_src && p_length > 0);
+
+	WRITE_FIT(p_length);
+	memcpy(write_ptr + write_pos, p_src, p_length);
+	write_pos += p_length;
+}
+
 bool FileAccessCompressed::file_exists(const String &p_name) {
 	Ref<FileAccess> fa = FileAccess::open(p_name, FileAccess::READ);
 	if (fa.is_null()) {
@@ -51,11 +51,16 @@ class FileAccessCompressed : public FileAccess {
 	};
 
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
 	mutable uint64_t read_pos = 0;
+	mutable bool read_block_pending = false; // The current block isn't decompressed in the buffer yet.
+	mutable bool read_ahead = false; // Set while reading sequentially, the following blocks are decompressed along with the current one.
+	uint32_t read_ahead_blocks = 1;
+	mutable uint32_t buffer_first_block = 0;
+	mutable uint32_t buffer_block_count = 0;
 	Vector<ReadBlock> read_blocks;
 	uint64_t read_total = 0;
 
@@ -63,12 +68,23 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	struct DecompressBatch;
+	struct CompressBatch;
+
 	void _close();
+	void _start_writing();
+
+	_FORCE_INLINE_ uint32_t _get_block_size(uint32_t p_block) const { return p_block == read_block_count - 1 ? read_total % block_size : block_size; }
+	Error _read_blocks(uint32_t p_first, uint32_t p_count, uint8_t *p_dst) const;
+	Error _fill_buffer() const;
+	void _set_read_block(uint32_t p_block) const;
+	void _advance_block() const;
 
 public:
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
+	Error open_for_writing(Ref<FileAccess> p_base); ///< write the compressed file into p_base, from its current position
 
 	virtual Error _open(const String &p_path, int p_mode_flags); ///< open a file
 	virtual bool is_open() const; ///< true when file is open
@@ -87,6 +103,7 @@ public:
 
 	virtual void flush();
 	virtual void store_8(uint8_t p_dest); ///< store a byte
+	virtual void store_buffer(const uint8_t *p_src, uint64_t p_length); ///< store an array of bytes
 
 	virtual bool file_exists(const String &p_name); ///< return true if a file exists
 
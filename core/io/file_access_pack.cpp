@@ -30,6 +30,7 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
@@ -47,13 +48,14 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	PathMD5 pmd5(p_path.md5_buffer());
 
 	bool exists = files.has(pmd5);
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -195,6 +197,17 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		return false;
 	}
 
+	// On 64-bit systems, map the whole pack in memory so its files can be read without going through the file API.
+	mapped_packs.erase(p_path);
+	if (sizeof(void *) >= 8) {
+		MappedPack mapped;
+		mapped.data = f->map_contents(mapped.length);
+		if (mapped.data) {
+			mapped.file = f;
+			mapped_packs.insert(p_path, mapped);
+		}
+	}
+
 	uint32_t version = f->get_32();
 	uint32_t ver_major = f->get_32();
 	uint32_t ver_minor = f->get_32();
@@ -247,14 +260,39 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	return true;
 }
 
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	return memnew(FileAccessPack(p_path, *p_file));
+	Ref<FileAccess> file;
+	if (!p_file->encrypted) {
+		HashMap<String, MappedPack>::ConstIterator E = mapped_packs.find(p_file->pack);
+		if (E && p_file->offset + p_file->size <= E->value.length) {
+			file = Ref<FileAccess>(memnew(FileAccessPack(p_path, *p_file, E->value.file, E->value.data)));
+		}
+	}
+	if (file.is_null()) {
+		file = Ref<FileAccess>(memnew(FileAccessPack(p_path, *p_file)));
+	}
+
+	if (p_file->compressed) {
+		// Compressed in blocks, so seeking only needs to decompress the block it lands in.
+		char magic[5];
+		file->get_buffer((uint8_t *)magic, 4);
+		magic[4] = 0;
+		ERR_FAIL_COND_V_MSG(String(magic) != PACK_FILE_COMPRESSED_MAGIC, Ref<FileAccess>(), "Compressed pack-referenced file '" + p_path + "' is corrupt.");
+
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		Error err = fac->open_after_magic(file);
+		ERR_FAIL_COND_V_MSG(err != OK, Ref<FileAccess>(), "Can't open compressed pack-referenced file '" + p_path + "'.");
+		file = fac;
+	}
+
+	return file;
 }
 
 //////////////////////////////////////////////////////////////////
@@ -281,7 +319,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!data) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -308,6 +348,10 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (data) {
+		return data[pos++];
+	}
+
 	pos++;
 	return f->get_8();
 }
@@ -326,21 +370,58 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	const uint64_t read_pos = pos;
 	pos += p_length;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (data) {
+		memcpy(p_dst, data + read_pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+uint64_t FileAccessPack::get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	if (pf.encrypted) {
+		return FileAccess::get_buffer_at(p_offset, p_dst, p_length);
+	}
+
+	if (p_offset >= pf.size) {
+		return 0;
+	}
+	uint64_t to_read = MIN(p_length, pf.size - p_offset);
+	if (data) {
+		memcpy(p_dst, data + p_offset, to_read);
+		return to_read;
+	}
+	return f->get_buffer_at(off + p_offset, p_dst, to_read);
+}
+
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!data || eof || pos + p_length > pf.size) {
+		return nullptr;
+	}
+
+	const uint8_t *view = data + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (!data) {
+		// The mapped pack file is shared, and isn't read from directly.
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -366,9 +447,20 @@ bool FileAccessPack::file_exists(const String &p_name) {
 	return false;
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_pack, const uint8_t *p_mapped_data) :
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+
+	if (p_mapped_data) {
+		// Keeping a reference to the pack file keeps it mapped.
+		f = p_mapped_pack;
+		data = p_mapped_data + pf.offset;
+		off = pf.offset;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
@@ -390,8 +482,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -48,9 +48,13 @@ enum PackFlags {
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1
 };
 
+// Compressed files are stored in the FileAccessCompressed format, with this magic.
+#define PACK_FILE_COMPRESSED_MAGIC "GCPK"
+
 class PackSource;
 
 class PackedData {
@@ -66,6 +70,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false; // size is then the compressed size.
 	};
 
 private:
@@ -109,7 +114,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -135,6 +140,14 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	// Packs mapped in memory, by path. Their files are read straight from the mapping.
+	struct MappedPack {
+		Ref<FileAccess> file;
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+	};
+	HashMap<String, MappedPack> mapped_packs;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
@@ -148,6 +161,7 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	const uint8_t *data = nullptr; // The file contents, if the pack is mapped in memory.
 	virtual Error _open(const String &p_path, int p_mode_flags);
 	virtual uint64_t _get_modified_time(const String &p_file) { return 0; }
 	virtual uint32_t _get_unix_permissions(const String &p_file) { return 0; }
@@ -166,6 +180,8 @@ public:
 	virtual uint8_t get_8() const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const;
+	virtual uint64_t get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const;
 
 	virtual void set_big_endian(bool p_big_endian);
 
@@ -178,7 +194,7 @@ public:
 
 	virtual bool file_exists(const String &p_name);
 
-	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_pack = Ref<FileAccess>(), const uint8_t *p_mapped_data = nullptr);
 };
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
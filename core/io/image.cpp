@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -632,8 +633,47 @@ static double _bicubic_interp_kernel(double x) {
 	return bc;
 }
 
+// Below this many destination pixels, splitting the work across threads costs more than it saves.
+static const uint64_t IMAGE_PARALLEL_MIN_PIXELS = 256 * 256;
+static const uint32_t IMAGE_PARALLEL_BAND_PIXELS = 32 * 1024;
+
+template <class F>
+struct ImageRowBands {
+	const F *func = nullptr;
+	uint32_t rows = 0;
+	uint32_t rows_per_band = 0;
+
+	void process_band(uint32_t p_index, void *p_userdata) {
+		uint32_t from = p_index * rows_per_band;
+		(*func)(from, MIN(from + rows_per_band, rows));
+	}
+};
+
+// Calls p_func(from_row, to_row) until all p_rows rows (p_row_pixels wide each) have been processed.
+// Large images are split in bands of rows that run on the WorkerThreadPool, so p_func must only write to its own rows.
+template <class F>
+static void _process_rows(uint32_t p_rows, uint32_t p_row_pixels, const F &p_func) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	uint32_t rows_per_band = MAX(IMAGE_PARALLEL_BAND_PIXELS / MAX(p_row_pixels, 1u), 1u);
+	uint32_t band_count = (p_rows + rows_per_band - 1) / rows_per_band;
+
+	// Pool threads process their rows serially, waiting for a nested group there can deadlock the pool.
+	if (band_count < 2 || (uint64_t)p_rows * p_row_pixels < IMAGE_PARALLEL_MIN_PIXELS || !pool || pool->get_thread_count() < 2 || pool->get_thread_index() != -1) {
+		p_func(0, p_rows);
+		return;
+	}
+
+	ImageRowBands<F> bands;
+	bands.func = &p_func;
+	bands.rows = p_rows;
+	bands.rows_per_band = rows_per_band;
+
+	WorkerThreadPool::GroupID group = pool->add_template_group_task(&bands, &ImageRowBands<F>::process_band, (void *)nullptr, band_count, -1, true, SNAME("ImageProcessRows"));
+	pool->wait_for_group_task_completion(group);
+}
+
 template <int CC, class T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -648,7 +688,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_from_row; y < p_to_row; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -720,7 +760,14 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, class T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_process_rows(p_dst_height, p_dst_width, [&](uint32_t p_from_row, uint32_t p_to_row) {
+		_scale_cubic_rows<CC, T>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, p_from_row, p_to_row);
+	});
+}
+
+template <int CC, class T>
+static void _scale_bilinear_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -728,7 +775,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -810,8 +857,15 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, class T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_process_rows(p_dst_height, p_dst_width, [&](uint32_t p_from_row, uint32_t p_to_row) {
+		_scale_bilinear_rows<CC, T>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, p_from_row, p_to_row);
+	});
+}
+
+template <int CC, class T>
+static void _scale_nearest_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -830,6 +884,13 @@ static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict
 	}
 }
 
+template <int CC, class T>
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_process_rows(p_dst_height, p_dst_width, [&](uint32_t p_from_row, uint32_t p_to_row) {
+		_scale_nearest_rows<CC, T>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, p_from_row, p_to_row);
+	});
+}
+
 #define LANCZOS_TYPE 3
 
 static float _lanczos(float p_x) {
@@ -852,48 +913,65 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+		int32_t kernel_size = half_kernel * 2;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// The kernels only depend on the column, so they are computed once and shared by all rows.
+		float *kernels = memnew_arr(float, dst_width * kernel_size);
+		int32_t *start_xs = memnew_arr(int32_t, dst_width);
+		int32_t *end_xs = memnew_arr(int32_t, dst_width);
 
 		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
 			// The corresponding point on the source image
 			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
 			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
 			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			start_xs[buffer_x] = start_x;
+			end_xs[buffer_x] = end_x;
 
 			// Create the kernel used by all the pixels of the column
+			float *kernel = &kernels[buffer_x * kernel_size];
 			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
 				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
 			}
+		}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+		_process_rows(src_height, dst_width, [&](uint32_t p_from_row, uint32_t p_to_row) {
+			for (int32_t buffer_y = p_from_row; buffer_y < int32_t(p_to_row); buffer_y++) {
+				for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
+					const float *kernel = &kernels[buffer_x * kernel_size];
+					int32_t start_x = start_xs[buffer_x];
+					int32_t end_x = end_xs[buffer_x];
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+
+						for (uint32_t i = 0; i < CC; i++) {
+							if (sizeof(T) == 2) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
+		});
 
-		memdelete_arr(kernel);
+		memdelete_arr(kernels);
+		memdelete_arr(start_xs);
+		memdelete_arr(end_xs);
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -902,50 +980,53 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+		int32_t kernel_size = half_kernel * 2;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_process_rows(dst_height, dst_width, [&](uint32_t p_from_row, uint32_t p_to_row) {
+			float *kernel = memnew_arr(float, kernel_size);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from_row; dst_y < int32_t(p_to_row); dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
-
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-					if (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if (sizeof(T) == 2) { //half float
+							dst_data[i] = Math::make_half_float(pixel[i]);
+						} else { // float
+							dst_data[i] = pixel[i];
+						}
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -1571,15 +1652,14 @@ bool Image::_can_modify(Format p_format) const {
 template <class Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+static void _generate_po2_mipmap_rows(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_from_row, uint32_t p_to_row) {
 	//fast power of 2 mipmap generation
 	uint32_t dst_w = MAX(p_width >> 1, 1u);
-	uint32_t dst_h = MAX(p_height >> 1, 1u);
 
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		const Component *rup_ptr = &p_src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
 		Component *dst_ptr = &p_dst[i * dst_w * CC];
@@ -1602,6 +1682,18 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	}
 }
 
+template <class Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	uint32_t dst_w = MAX(p_width >> 1, 1u);
+	uint32_t dst_h = MAX(p_height >> 1, 1u);
+
+	_process_rows(dst_h, dst_w, [&](uint32_t p_from_row, uint32_t p_to_row) {
+		_generate_po2_mipmap_rows<Component, CC, renormalize, average_func, renormalize_func>(p_src, p_dst, p_width, p_height, p_from_row, p_to_row);
+	});
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.size() == 0);
 
@@ -2401,6 +2493,25 @@ Ref<Image> Image::load_from_file(const String &p_path) {
 	return image;
 }
 
+TypedArray<Image> Image::load_from_files(const PackedStringArray &p_paths) {
+#ifdef DEBUG_ENABLED
+	for (int i = 0; i < p_paths.size(); i++) {
+		if (p_paths[i].begins_with("res://") && ResourceLoader::exists(p_paths[i])) {
+			WARN_PRINT("Loaded resource as image file, this will not work on export: '" + p_paths[i] + "'. Instead, import the image file as an Image resource and load it normally as a resource.");
+		}
+	}
+#endif
+	Vector<Ref<Image>> images;
+	ImageLoader::load_images(p_paths, images);
+
+	TypedArray<Image> ret;
+	ret.resize(images.size());
+	for (int i = 0; i < images.size(); i++) {
+		ret[i] = images[i];
+	}
+	return ret;
+}
+
 Error Image::save_png(const String &p_path) const {
 	if (save_png_func == nullptr) {
 		return ERR_UNAVAILABLE;
@@ -2891,6 +3002,8 @@ ImageMemLoadFunc Image::_webp_mem_loader_func = nullptr;
 ImageMemLoadFunc Image::_tga_mem_loader_func = nullptr;
 ImageMemLoadFunc Image::_bmp_mem_loader_func = nullptr;
 
+int Image::compress_max_threads = 0;
+
 void (*Image::_image_compress_bc_func)(Image *, float, Image::UsedChannels) = nullptr;
 void (*Image::_image_compress_bptc_func)(Image *, float, Image::UsedChannels) = nullptr;
 void (*Image::_image_compress_etc1_func)(Image *, float) = nullptr;
@@ -3301,6 +3414,7 @@ void Image::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("load", "path"), &Image::load);
 	ClassDB::bind_static_method("Image", D_METHOD("load_from_file", "path"), &Image::load_from_file);
+	ClassDB::bind_static_method("Image", D_METHOD("load_from_files", "paths"), &Image::load_from_files);
 	ClassDB::bind_method(D_METHOD("save_png", "path"), &Image::save_png);
 	ClassDB::bind_method(D_METHOD("save_png_to_buffer"), &Image::save_png_to_buffer);
 	ClassDB::bind_method(D_METHOD("save_jpg", "path", "quality"), &Image::save_jpg, DEFVAL(0.75));
@@ -3436,6 +3550,30 @@ void Image::set_compress_bptc_func(void (*p_compress_func)(Image *, float, UsedC
 	_image_compress_bptc_func = p_compress_func;
 }
 
+void Image::set_compress_max_threads(int p_threads) {
+	ERR_FAIL_COND(p_threads < 0);
+	compress_max_threads = p_threads;
+}
+
+int Image::get_compress_max_threads() {
+	return compress_max_threads;
+}
+
+void Image::run_compression_tasks(void (*p_func)(void *, uint32_t), void *p_userdata, uint32_t p_count) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Compressing from a pool thread (as imports do) runs serially, as waiting there for a nested group can deadlock the pool.
+	if (p_count < 2 || compress_max_threads == 1 || !pool || pool->get_thread_count() < 2 || pool->get_thread_index() != -1) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_func(p_userdata, i);
+		}
+		return;
+	}
+
+	int tasks = compress_max_threads > 0 ? MIN(compress_max_threads, pool->get_thread_count()) : -1;
+	WorkerThreadPool::GroupID group = pool->add_native_group_task(p_func, p_userdata, p_count, tasks, true, SNAME("ImageCompress"));
+	pool->wait_for_group_task_completion(group);
+}
+
 void Image::normal_map_to_xy() {
 	convert(Image::FORMAT_RGBA8);
 
@@ -34,6 +34,7 @@
 #include "core/io/resource.h"
 #include "core/math/color.h"
 #include "core/math/rect2.h"
+#include "core/variant/typed_array.h"
 
 /**
  * Image storage class. This is used to store an image in user memory, as well as
@@ -166,6 +167,8 @@ protected:
 	static void _bind_methods();
 
 private:
+	static int compress_max_threads;
+
 	Format format = FORMAT_L8;
 	Vector<uint8_t> data;
 	int width = 0;
@@ -294,6 +297,7 @@ public:
 
 	Error load(const String &p_path);
 	static Ref<Image> load_from_file(const String &p_path);
+	static TypedArray<Image> load_from_files(const PackedStringArray &p_paths);
 	Error save_png(const String &p_path) const;
 	Error save_jpg(const String &p_path, float p_quality = 0.75) const;
 	Vector<uint8_t> save_png_to_buffer() const;
@@ -385,6 +389,12 @@ public:
 
 	static void set_compress_bc_func(void (*p_compress_func)(Image *, float, UsedChannels));
 	static void set_compress_bptc_func(void (*p_compress_func)(Image *, float, UsedChannels));
+
+	// Limits how many WorkerThreadPool threads the texture compressors may use. 0 uses all of them, 1 compresses on the calling thread.
+	static void set_compress_max_threads(int p_threads);
+	static int get_compress_max_threads();
+	// Runs p_func(p_userdata, i) for every i in [0, p_count), within the limit set by set_compress_max_threads(). Each call should compress one row of blocks.
+	static void run_compression_tasks(void (*p_func)(void *, uint32_t), void *p_userdata, uint32_t p_count);
 	static String get_format_name(Format p_format);
 
 	Error load_png_from_buffer(const Vector<uint8_t> &p_array);
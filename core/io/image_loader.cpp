@@ -30,6 +30,7 @@
 
 #include "image_loader.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 
 bool ImageFormatLoader::recognize(const String &p_extension) const {
@@ -73,6 +74,54 @@ Error ImageLoader::load_image(String p_file, Ref<Image> p_image, Ref<FileAccess>
 	return ERR_FILE_UNRECOGNIZED;
 }
 
+struct ImageLoader::LoadBatch {
+	const String *files = nullptr;
+	Ref<Image> *images = nullptr;
+	Error *errors = nullptr;
+	bool force_linear = false;
+	float scale = 1.0;
+
+	void load_task(uint32_t p_index, void *p_userdata) {
+		// Each file gets its own FileAccess and decoder state, so the format loaders don't share anything between threads.
+		Ref<Image> image;
+		image.instantiate();
+		errors[p_index] = ImageLoader::load_image(files[p_index], image, Ref<FileAccess>(), force_linear, scale);
+		if (errors[p_index] == OK) {
+			images[p_index] = image;
+		}
+	}
+};
+
+void ImageLoader::load_images(const Vector<String> &p_files, Vector<Ref<Image>> &r_images, Vector<Error> *r_errors, bool p_force_linear, float p_scale) {
+	r_images.clear();
+	r_images.resize(p_files.size());
+
+	Vector<Error> errors;
+	errors.resize(p_files.size());
+
+	LoadBatch batch;
+	batch.files = p_files.ptr();
+	batch.images = r_images.ptrw();
+	batch.errors = errors.ptrw();
+	batch.force_linear = p_force_linear;
+	batch.scale = p_scale;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Loaded serially from pool threads (such as threaded resource loads), waiting there for a nested group can deadlock the pool.
+	if (p_files.size() > 1 && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(&batch, &LoadBatch::load_task, (void *)nullptr, p_files.size(), -1, true, SNAME("ImageLoaderBatch"));
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (int i = 0; i < p_files.size(); i++) {
+			batch.load_task(i, nullptr);
+		}
+	}
+
+	if (r_errors) {
+		*r_errors = errors;
+	}
+}
+
 void ImageLoader::get_recognized_extensions(List<String> *p_extensions) {
 	for (int i = 0; i < loader.size(); i++) {
 		loader[i]->get_recognized_extensions(p_extensions);
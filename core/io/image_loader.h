@@ -56,9 +56,13 @@ class ImageLoader {
 	static Vector<ImageFormatLoader *> loader;
 	friend class ResourceFormatLoaderImage;
 
+	struct LoadBatch;
+
 protected:
 public:
 	static Error load_image(String p_file, Ref<Image> p_image, Ref<FileAccess> p_custom = Ref<FileAccess>(), bool p_force_linear = false, float p_scale = 1.0);
+	// Loads every file in p_files, decoding them in parallel on the WorkerThreadPool. r_images gets one image per file, null if it failed.
+	static void load_images(const Vector<String> &p_files, Vector<Ref<Image>> &r_images, Vector<Error> *r_errors = nullptr, bool p_force_linear = false, float p_scale = 1.0);
 	static void get_recognized_extensions(List<String> *p_extensions);
 	static ImageFormatLoader *recognize(const String &p_extension);
 
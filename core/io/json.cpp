@@ -32,6 +32,76 @@
 
 #include "core/string/print_string.h"
 
+// Parses a number without going through String. Exact when the digits fit in 53 bits and the exponent is small,
+// which covers nearly everything found in practice, the rest goes through String::to_float().
+template <class C>
+static double _parse_number(const C *p_str, const C **r_end) {
+	static const double pow10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	const C *c = p_str;
+	bool negative = false;
+	if (*c == '-') {
+		negative = true;
+		c++;
+	}
+
+	uint64_t mantissa = 0;
+	int digits = 0;
+	int exponent = 0;
+	bool exact = true;
+	while (is_digit(*c)) {
+		if (digits < 19) {
+			mantissa = mantissa * 10 + (*c - '0');
+			digits += mantissa != 0;
+		} else {
+			exponent++;
+			exact = false;
+		}
+		c++;
+	}
+	if (*c == '.') {
+		c++;
+		while (is_digit(*c)) {
+			if (digits < 19) {
+				mantissa = mantissa * 10 + (*c - '0');
+				digits += mantissa != 0;
+				exponent--;
+			} else {
+				exact = false;
+			}
+			c++;
+		}
+	}
+	if (*c == 'e' || *c == 'E') {
+		c++;
+		bool exp_negative = false;
+		if (*c == '+' || *c == '-') {
+			exp_negative = *c == '-';
+			c++;
+		}
+		int exp = 0;
+		while (is_digit(*c)) {
+			if (exp < 100000) {
+				exp = exp * 10 + (*c - '0');
+			}
+			c++;
+		}
+		exponent += exp_negative ? -exp : exp;
+	}
+	*r_end = c;
+
+	// Both the mantissa and the power of ten are exact doubles, so a single operation rounds correctly.
+	if (exact && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+		double value = (double)mantissa;
+		value = exponent < 0 ? value / pow10[-exponent] : value * pow10[exponent];
+		return negative ? -value : value;
+	}
+	return String::to_float(p_str);
+}
+
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
 	"'}'",
@@ -45,42 +115,39 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	String indent_text = "";
+void JSON::_make_indent(StringBuilder &r_builder, const String &p_indent, int p_size) {
 	if (!p_indent.is_empty()) {
 		for (int i = 0; i < p_size; i++) {
-			indent_text += p_indent;
+			r_builder.append(p_indent);
 		}
 	}
-	return indent_text;
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	String colon = ":";
-	String end_statement = "";
-
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
-	}
+void JSON::_stringify(StringBuilder &r_builder, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	const char *colon = p_indent.is_empty() ? ":" : ": ";
+	const bool new_lines = !p_indent.is_empty();
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_builder.append("null");
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_builder.append(p_var.operator bool() ? "true" : "false");
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_builder.append(itos(p_var));
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 			if (p_full_precision) {
 				// Store unreliable digits (17) instead of just reliable
 				// digits (14) so that the value can be decoded exactly.
-				return String::num(num, 17 - (int)floor(log10(num)));
+				r_builder.append(String::num(num, 17 - (int)floor(log10(num))));
 			} else {
 				// Store only reliable digits (14) by default.
-				return String::num(num, 14 - (int)floor(log10(num)));
+				r_builder.append(String::num(num, 14 - (int)floor(log10(num))));
 			}
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -88,30 +155,49 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::PACKED_FLOAT64_ARRAY:
 		case Variant::PACKED_STRING_ARRAY:
 		case Variant::ARRAY: {
-			String s = "[";
-			s += end_statement;
 			Array a = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
+			if (p_markers.has(a.id())) {
+				r_builder.append("\"[...]\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
+
+			r_builder.append(U'[');
+			if (new_lines) {
+				r_builder.append(U'\n');
+			}
 			p_markers.insert(a.id());
 
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					r_builder.append(U',');
+					if (new_lines) {
+						r_builder.append(U'\n');
+					}
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_make_indent(r_builder, p_indent, p_cur_indent + 1);
+				_stringify(r_builder, a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+			}
+			if (new_lines) {
+				r_builder.append(U'\n');
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			_make_indent(r_builder, p_indent, p_cur_indent);
+			r_builder.append(U']');
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (p_markers.has(d.id())) {
+				r_builder.append("\"{...}\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
+
+			r_builder.append(U'{');
+			if (new_lines) {
+				r_builder.append(U'\n');
+			}
 			p_markers.insert(d.id());
 
 			List<Variant> keys;
@@ -126,20 +212,29 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_builder.append(U',');
+					if (new_lines) {
+						r_builder.append(U'\n');
+					}
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_make_indent(r_builder, p_indent, p_cur_indent + 1);
+				_stringify(r_builder, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_builder.append(colon);
+				_stringify(r_builder, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			if (new_lines) {
+				r_builder.append(U'\n');
+			}
+			_make_indent(r_builder, p_indent, p_cur_indent);
+			r_builder.append(U'}');
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_builder.append(U'"');
+			r_builder.append(String(p_var).json_escape());
+			r_builder.append(U'"');
 	}
 }
 
@@ -329,7 +424,7 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
 					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
+					double number = _parse_number(&p_str[index], &rptr);
 					index += (rptr - &p_str[index]);
 					r_token.type = TK_NUMBER;
 					r_token.value = number;
@@ -530,7 +625,9 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
 	HashSet<const void *> markers;
-	return _stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	StringBuilder builder;
+	_stringify(builder, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return builder.as_string();
 }
 
 Error JSON::parse(const String &p_json_string) {
@@ -549,3 +646,416 @@ void JSON::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_error_line"), &JSON::get_error_line);
 	ClassDB::bind_method(D_METHOD("get_error_message"), &JSON::get_error_message);
 }
+
+////////////
+
+bool JSONReader::_fill() {
+	if (file.is_null()) {
+		return false;
+	}
+	buffer_len = file->get_buffer(buffer.ptr(), buffer.size());
+	buffer_pos = 0;
+	return buffer_len > 0;
+}
+
+void JSONReader::_reset() {
+	buffer_pos = 0;
+	buffer_len = 0;
+	state = STATE_VALUE;
+	containers.clear();
+	err_str = String();
+	err_line = 0;
+	line = 1;
+}
+
+void JSONReader::open_file(Ref<FileAccess> p_file) {
+	_reset();
+	file = p_file;
+	buffer.resize(65536);
+
+	// Skip the UTF-8 byte order mark, if any.
+	if (_peek() == 0xEF && buffer_len >= 3 && buffer[1] == 0xBB && buffer[2] == 0xBF) {
+		buffer_pos = 3;
+	}
+}
+
+void JSONReader::open_string(const String &p_json) {
+	_reset();
+	file.unref();
+	CharString utf8 = p_json.utf8();
+	buffer.resize(utf8.length());
+	if (utf8.length()) {
+		memcpy(buffer.ptr(), utf8.get_data(), utf8.length());
+	}
+	buffer_len = buffer.size();
+}
+
+Error JSONReader::_error(const String &p_message) {
+	if (err_str.is_empty()) {
+		err_str = p_message;
+		err_line = line;
+	}
+	return ERR_PARSE_ERROR;
+}
+
+void JSONReader::_skip_whitespace() {
+	while (true) {
+		int c = _peek();
+		if (c == '\n') {
+			line++;
+		} else if (c < 0 || c > 32) {
+			return;
+		}
+		buffer_pos++;
+	}
+}
+
+static void _append_utf8(LocalVector<char> &r_str, char32_t p_char) {
+	if (p_char < 0x80) {
+		r_str.push_back(p_char);
+	} else if (p_char < 0x800) {
+		r_str.push_back(0xC0 | (p_char >> 6));
+		r_str.push_back(0x80 | (p_char & 0x3F));
+	} else if (p_char < 0x10000) {
+		r_str.push_back(0xE0 | (p_char >> 12));
+		r_str.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_str.push_back(0x80 | (p_char & 0x3F));
+	} else {
+		r_str.push_back(0xF0 | (p_char >> 18));
+		r_str.push_back(0x80 | ((p_char >> 12) & 0x3F));
+		r_str.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_str.push_back(0x80 | (p_char & 0x3F));
+	}
+}
+
+Error JSONReader::_read_string(String &r_string) {
+	buffer_pos++; // Opening quote.
+	scratch.clear();
+
+	while (true) {
+		int c = _peek();
+		if (c < 0) {
+			return _error("Unterminated String");
+		}
+		buffer_pos++;
+
+		if (c == '"') {
+			break;
+		} else if (c != '\\') {
+			if (c == '\n') {
+				line++;
+			}
+			scratch.push_back(c);
+			continue;
+		}
+
+		//escaped characters...
+		c = _peek();
+		if (c < 0) {
+			return _error("Unterminated String");
+		}
+		buffer_pos++;
+
+		switch (c) {
+			case 'b':
+				scratch.push_back(8);
+				break;
+			case 't':
+				scratch.push_back(9);
+				break;
+			case 'n':
+				scratch.push_back(10);
+				break;
+			case 'f':
+				scratch.push_back(12);
+				break;
+			case 'r':
+				scratch.push_back(13);
+				break;
+			case 'u': {
+				char32_t res = 0;
+				for (int pair = 0; pair < 2; pair++) {
+					char32_t v = 0;
+					for (int j = 0; j < 4; j++) {
+						int h = _peek();
+						if (h < 0) {
+							return _error("Unterminated String");
+						}
+						if (!is_hex_digit(h)) {
+							return _error("Malformed hex constant in string");
+						}
+						buffer_pos++;
+						v = (v << 4) | (is_digit(h) ? h - '0' : (h | 0x20) - 'a' + 10);
+					}
+
+					if (pair == 1) {
+						if ((v & 0xfffffc00) != 0xdc00) {
+							return _error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+						}
+						res = (res << 10UL) + v - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+						break;
+					}
+
+					res = v;
+					if ((res & 0xfffffc00) == 0xdc00) {
+						return _error("Invalid UTF-16 sequence in string, unpaired trail surrogate");
+					} else if ((res & 0xfffffc00) != 0xd800) {
+						break;
+					}
+
+					// A lead surrogate, the trail one must follow.
+					if (_peek() != '\\') {
+						return _error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+					}
+					buffer_pos++;
+					if (_peek() != 'u') {
+						return _error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+					}
+					buffer_pos++;
+				}
+				_append_utf8(scratch, res);
+			} break;
+			default: {
+				scratch.push_back(c);
+			} break;
+		}
+	}
+
+	r_string = String();
+	if (scratch.size()) {
+		r_string.parse_utf8(scratch.ptr(), scratch.size());
+	}
+	return OK;
+}
+
+Error JSONReader::_read_number(double &r_number) {
+	scratch.clear();
+	while (true) {
+		int c = _peek();
+		if (!is_digit(c) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+			break;
+		}
+		scratch.push_back(c);
+		buffer_pos++;
+	}
+	scratch.push_back(0);
+
+	const char *end = nullptr;
+	r_number = _parse_number(scratch.ptr(), &end);
+	if (end != scratch.ptr() + scratch.size() - 1 || !is_digit(scratch[scratch[0] == '-' ? 1 : 0])) {
+		return _error("Malformed number");
+	}
+	return OK;
+}
+
+Error JSONReader::_read_identifier(Variant &r_value) {
+	scratch.clear();
+	while (is_ascii_char(_peek())) {
+		scratch.push_back(_peek());
+		buffer_pos++;
+	}
+	scratch.push_back(0);
+
+	String id = scratch.ptr();
+	if (id == "true") {
+		r_value = true;
+	} else if (id == "false") {
+		r_value = false;
+	} else if (id == "null") {
+		r_value = Variant();
+	} else {
+		return _error("Expected 'true','false' or 'null', got '" + id + "'.");
+	}
+	return OK;
+}
+
+Error JSONReader::read_next(Event &r_event) {
+	if (!err_str.is_empty()) {
+		return ERR_PARSE_ERROR;
+	}
+	r_event.value = Variant();
+
+	while (true) {
+		_skip_whitespace();
+		int c = _peek();
+
+		switch (state) {
+			case STATE_DONE: {
+				r_event.type = EVENT_EOF;
+				return OK;
+			}
+			case STATE_AFTER_VALUE: {
+				if (containers.is_empty()) {
+					if (c >= 0) {
+						return _error("Expected 'EOF'");
+					}
+					state = STATE_DONE;
+					continue;
+				}
+
+				bool in_object = containers[containers.size() - 1];
+				if (c == ',') {
+					buffer_pos++;
+					state = in_object ? STATE_KEY : STATE_VALUE;
+					continue;
+				}
+				if (c == (in_object ? '}' : ']')) {
+					buffer_pos++;
+					containers.resize(containers.size() - 1);
+					r_event.type = in_object ? EVENT_OBJECT_END : EVENT_ARRAY_END;
+					return OK;
+				}
+				return _error(in_object ? "Expected '}' or ','" : "Expected ']' or ','");
+			}
+			case STATE_FIRST_KEY:
+			case STATE_KEY: {
+				if (state == STATE_FIRST_KEY && c == '}') {
+					buffer_pos++;
+					containers.resize(containers.size() - 1);
+					state = STATE_AFTER_VALUE;
+					r_event.type = EVENT_OBJECT_END;
+					return OK;
+				}
+				if (c != '"') {
+					return _error("Expected key");
+				}
+
+				String key;
+				Error err = _read_string(key);
+				if (err != OK) {
+					return err;
+				}
+				_skip_whitespace();
+				if (_peek() != ':') {
+					return _error("Expected ':'");
+				}
+				buffer_pos++;
+
+				state = STATE_VALUE;
+				r_event.type = EVENT_KEY;
+				r_event.value = key;
+				return OK;
+			}
+			case STATE_FIRST_VALUE:
+			case STATE_VALUE: {
+				if (state == STATE_FIRST_VALUE && c == ']') {
+					buffer_pos++;
+					containers.resize(containers.size() - 1);
+					state = STATE_AFTER_VALUE;
+					r_event.type = EVENT_ARRAY_END;
+					return OK;
+				}
+
+				if (c == '{' || c == '[') {
+					buffer_pos++;
+					containers.push_back(c == '{');
+					state = c == '{' ? STATE_FIRST_KEY : STATE_FIRST_VALUE;
+					r_event.type = c == '{' ? EVENT_OBJECT_BEGIN : EVENT_ARRAY_BEGIN;
+					return OK;
+				}
+
+				Error err;
+				if (c == '"') {
+					String str;
+					err = _read_string(str);
+					r_event.value = str;
+				} else if (c == '-' || is_digit(c)) {
+					double number = 0;
+					err = _read_number(number);
+					r_event.value = number;
+				} else if (is_ascii_char(c)) {
+					err = _read_identifier(r_event.value);
+				} else if (c < 0) {
+					return _error("Expected value, got EOF.");
+				} else {
+					return _error("Unexpected character.");
+				}
+				if (err != OK) {
+					return err;
+				}
+
+				state = STATE_AFTER_VALUE;
+				r_event.type = EVENT_VALUE;
+				return OK;
+			}
+		}
+	}
+}
+
+Error JSONReader::skip() {
+	uint32_t depth = containers.size();
+	ERR_FAIL_COND_V_MSG(depth == 0, ERR_INVALID_PARAMETER, "Not inside an object or array.");
+
+	Event event;
+	while (containers.size() >= depth) {
+		Error err = read_next(event);
+		if (err != OK) {
+			return err;
+		}
+	}
+	return OK;
+}
+
+Error JSONReader::read_value(Variant &r_value) {
+	// Containers being filled, with the key their current value goes in.
+	struct Pending {
+		Variant container;
+		String key;
+	};
+	LocalVector<Pending> stack;
+
+	Event event;
+	while (true) {
+		Error err = read_next(event);
+		if (err != OK) {
+			return err;
+		}
+
+		Variant value;
+		switch (event.type) {
+			case EVENT_OBJECT_BEGIN:
+			case EVENT_ARRAY_BEGIN: {
+				Pending pending;
+				if (event.type == EVENT_OBJECT_BEGIN) {
+					pending.container = Dictionary();
+				} else {
+					pending.container = Array();
+				}
+				stack.push_back(pending);
+				continue;
+			}
+			case EVENT_KEY: {
+				ERR_FAIL_COND_V(stack.is_empty(), ERR_BUG);
+				stack[stack.size() - 1].key = event.value;
+				continue;
+			}
+			case EVENT_OBJECT_END:
+			case EVENT_ARRAY_END: {
+				if (stack.is_empty()) {
+					return _error("Expected value");
+				}
+				value = stack[stack.size() - 1].container;
+				stack.resize(stack.size() - 1);
+			} break;
+			case EVENT_VALUE: {
+				value = event.value;
+			} break;
+			case EVENT_EOF: {
+				return _error("Expected value, got EOF.");
+			}
+		}
+
+		if (stack.is_empty()) {
+			r_value = value;
+			return OK;
+		}
+		Pending &parent = stack[stack.size() - 1];
+		if (parent.container.get_type() == Variant::DICTIONARY) {
+			Dictionary d = parent.container;
+			d[parent.key] = value;
+		} else {
+			Array a = parent.container;
+			a.push_back(value);
+		}
+	}
+}
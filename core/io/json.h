@@ -31,7 +31,10 @@
 #ifndef JSON_H
 #define JSON_H
 
+#include "core/io/file_access.h"
 #include "core/object/ref_counted.h"
+#include "core/string/string_builder.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class JSON : public RefCounted {
@@ -69,8 +72,8 @@ class JSON : public RefCounted {
 
 	static const char *tk_name[];
 
-	static String _make_indent(const String &p_indent, int p_size);
-	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+	static void _make_indent(StringBuilder &r_builder, const String &p_indent, int p_size);
+	static void _stringify(StringBuilder &r_builder, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
 	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
 	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
 	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
@@ -89,4 +92,74 @@ public:
 	inline String get_error_message() const { return err_str; }
 };
 
+// Reads JSON as a sequence of events, without building the whole Variant tree, from a file read in chunks or a string.
+// Numbers are returned as floats, like JSON::parse() does.
+class JSONReader {
+public:
+	enum EventType {
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_KEY, // The key is in value, the event for its value comes next.
+		EVENT_VALUE, // A string, number, boolean or null.
+		EVENT_EOF,
+	};
+
+	struct Event {
+		EventType type = EVENT_EOF;
+		Variant value;
+	};
+
+private:
+	enum State {
+		STATE_FIRST_VALUE, // A value, or the end of an empty array.
+		STATE_VALUE,
+		STATE_FIRST_KEY, // A key, or the end of an empty object.
+		STATE_KEY,
+		STATE_AFTER_VALUE,
+		STATE_DONE,
+	};
+
+	Ref<FileAccess> file;
+	LocalVector<uint8_t> buffer;
+	uint32_t buffer_pos = 0;
+	uint32_t buffer_len = 0;
+
+	State state = STATE_VALUE;
+	LocalVector<bool> containers; // true for objects.
+	LocalVector<char> scratch;
+
+	String err_str;
+	int err_line = 0;
+	int line = 1;
+
+	bool _fill();
+	_FORCE_INLINE_ int _peek() {
+		if (buffer_pos == buffer_len && !_fill()) {
+			return -1;
+		}
+		return buffer[buffer_pos];
+	}
+
+	void _reset();
+	void _skip_whitespace();
+	Error _error(const String &p_message);
+	Error _read_string(String &r_string);
+	Error _read_number(double &r_number);
+	Error _read_identifier(Variant &r_value);
+
+public:
+	void open_file(Ref<FileAccess> p_file);
+	void open_string(const String &p_json);
+
+	Error read_next(Event &r_event);
+	Error skip(); // Skips to the end of the object or array the last event began.
+	Error read_value(Variant &r_value); // Reads the next value whole, as JSON::parse() would.
+
+	int get_depth() const { return containers.size(); }
+	int get_error_line() const { return err_line; }
+	String get_error_message() const { return err_str; }
+};
+
 #endif // JSON_H
@@ -1095,9 +1095,63 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 	return OK;
 }
 
-static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
+Error decode_packed_array_view(PackedArrayView &r_view, const uint8_t *p_buffer, int p_len, int *r_len) {
+	ERR_FAIL_COND_V(p_len < 8, ERR_INVALID_DATA);
+
+	uint32_t type = decode_uint32(p_buffer);
+	int element_size = 0;
+	switch (type & ENCODE_MASK) {
+		case Variant::PACKED_BYTE_ARRAY: {
+			element_size = 1;
+		} break;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			element_size = 4;
+		} break;
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			element_size = 8;
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			element_size = (type & ENCODE_FLAG_64) ? sizeof(double) * 2 : sizeof(float) * 2;
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			element_size = (type & ENCODE_FLAG_64) ? sizeof(double) * 3 : sizeof(float) * 3;
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			element_size = 4 * 4; // Colors are always in single-precision.
+		} break;
+		default: {
+			// Other types don't store their elements contiguously.
+			return ERR_INVALID_DATA;
+		}
+	}
+
+	int32_t count = decode_uint32(p_buffer + 4);
+	ERR_FAIL_COND_V(count < 0 || (int64_t)count * element_size > p_len - 8, ERR_INVALID_DATA);
+
+	r_view.type = Variant::Type(type & ENCODE_MASK);
+	r_view.data = p_buffer + 8;
+	r_view.count = count;
+	r_view.element_size = element_size;
+
+	if (r_len) {
+		*r_len = 8 + ((count * element_size + 3) & ~3);
+	}
+
+	return OK;
+}
+
+// Once the encoded data doesn't fit in p_capacity anymore, writing stops but the length keeps being computed.
+#define ENCODE_RESERVE(m_size)                                       \
+	if (buf && (int64_t)r_len + (int64_t)(m_size) > p_capacity) { \
+		buf = nullptr;                                            \
+	}
+
+static void _encode_string(const String &p_string, uint8_t *&buf, int p_capacity, int &r_len) {
 	CharString utf8 = p_string.utf8();
 
+	ENCODE_RESERVE(4 + ((utf8.length() + 3) & ~3));
 	if (buf) {
 		encode_uint32(utf8.length(), buf);
 		buf += 4;
@@ -1114,7 +1168,7 @@ static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
 	}
 }
 
-Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+static Error _encode_variant(const Variant &p_variant, uint8_t *r_buffer, int p_capacity, int &r_len, bool p_full_objects, int p_depth) {
 	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
 	uint8_t *buf = r_buffer;
 
@@ -1141,6 +1195,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Object *obj = p_variant.get_validated_object();
 			if (!obj) {
 				// Object is invalid, send a nullptr instead.
+				ENCODE_RESERVE(4);
 				if (buf) {
 					encode_uint32(Variant::NIL, buf);
 				}
@@ -1171,6 +1226,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} // nothing to do at this stage
 	}
 
+	ENCODE_RESERVE(4);
 	if (buf) {
 		encode_uint32(p_variant.get_type() | flags, buf);
 		buf += 4;
@@ -1182,6 +1238,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			//nothing to do
 		} break;
 		case Variant::BOOL: {
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(p_variant.operator bool(), buf);
 			}
@@ -1192,12 +1249,14 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::INT: {
 			if (flags & ENCODE_FLAG_64) {
 				//64 bits
+				ENCODE_RESERVE(8);
 				if (buf) {
 					encode_uint64(p_variant.operator int64_t(), buf);
 				}
 
 				r_len += 8;
 			} else {
+				ENCODE_RESERVE(4);
 				if (buf) {
 					encode_uint32(p_variant.operator int32_t(), buf);
 				}
@@ -1207,6 +1266,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 		case Variant::FLOAT: {
 			if (flags & ENCODE_FLAG_64) {
+				ENCODE_RESERVE(8);
 				if (buf) {
 					encode_double(p_variant.operator double(), buf);
 				}
@@ -1214,6 +1274,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				r_len += 8;
 
 			} else {
+				ENCODE_RESERVE(4);
 				if (buf) {
 					encode_float(p_variant.operator float(), buf);
 				}
@@ -1224,6 +1285,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 		case Variant::NODE_PATH: {
 			NodePath np = p_variant;
+			ENCODE_RESERVE(12);
 			if (buf) {
 				encode_uint32(uint32_t(np.get_name_count()) | 0x80000000, buf); //for compatibility with the old format
 				encode_uint32(np.get_subname_count(), buf + 4);
@@ -1258,6 +1320,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					pad = 4 - utf8.length() % 4;
 				}
 
+				ENCODE_RESERVE(4 + utf8.length() + pad);
 				if (buf) {
 					encode_uint32(utf8.length(), buf);
 					buf += 4;
@@ -1271,12 +1334,13 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 		case Variant::STRING:
 		case Variant::STRING_NAME: {
-			_encode_string(p_variant, buf, r_len);
+			_encode_string(p_variant, buf, p_capacity, r_len);
 
 		} break;
 
 		// math types
 		case Variant::VECTOR2: {
+			ENCODE_RESERVE(2 * sizeof(real_t));
 			if (buf) {
 				Vector2 v2 = p_variant;
 				encode_real(v2.x, &buf[0]);
@@ -1287,6 +1351,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR2I: {
+			ENCODE_RESERVE(2 * 4);
 			if (buf) {
 				Vector2i v2 = p_variant;
 				encode_uint32(v2.x, &buf[0]);
@@ -1297,6 +1362,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::RECT2: {
+			ENCODE_RESERVE(4 * sizeof(real_t));
 			if (buf) {
 				Rect2 r2 = p_variant;
 				encode_real(r2.position.x, &buf[0]);
@@ -1308,6 +1374,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::RECT2I: {
+			ENCODE_RESERVE(4 * 4);
 			if (buf) {
 				Rect2i r2 = p_variant;
 				encode_uint32(r2.position.x, &buf[0]);
@@ -1319,6 +1386,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR3: {
+			ENCODE_RESERVE(3 * sizeof(real_t));
 			if (buf) {
 				Vector3 v3 = p_variant;
 				encode_real(v3.x, &buf[0]);
@@ -1330,6 +1398,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR3I: {
+			ENCODE_RESERVE(3 * 4);
 			if (buf) {
 				Vector3i v3 = p_variant;
 				encode_uint32(v3.x, &buf[0]);
@@ -1341,6 +1410,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::TRANSFORM2D: {
+			ENCODE_RESERVE(6 * sizeof(real_t));
 			if (buf) {
 				Transform2D val = p_variant;
 				for (int i = 0; i < 3; i++) {
@@ -1354,6 +1424,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR4: {
+			ENCODE_RESERVE(4 * sizeof(real_t));
 			if (buf) {
 				Vector4 v4 = p_variant;
 				encode_real(v4.x, &buf[0]);
@@ -1366,6 +1437,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::VECTOR4I: {
+			ENCODE_RESERVE(4 * 4);
 			if (buf) {
 				Vector4i v4 = p_variant;
 				encode_uint32(v4.x, &buf[0]);
@@ -1378,6 +1450,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::PLANE: {
+			ENCODE_RESERVE(4 * sizeof(real_t));
 			if (buf) {
 				Plane p = p_variant;
 				encode_real(p.normal.x, &buf[0]);
@@ -1390,6 +1463,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::QUATERNION: {
+			ENCODE_RESERVE(4 * sizeof(real_t));
 			if (buf) {
 				Quaternion q = p_variant;
 				encode_real(q.x, &buf[0]);
@@ -1402,6 +1476,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::AABB: {
+			ENCODE_RESERVE(6 * sizeof(real_t));
 			if (buf) {
 				AABB aabb = p_variant;
 				encode_real(aabb.position.x, &buf[0]);
@@ -1416,6 +1491,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::BASIS: {
+			ENCODE_RESERVE(9 * sizeof(real_t));
 			if (buf) {
 				Basis val = p_variant;
 				for (int i = 0; i < 3; i++) {
@@ -1429,6 +1505,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::TRANSFORM3D: {
+			ENCODE_RESERVE(12 * sizeof(real_t));
 			if (buf) {
 				Transform3D val = p_variant;
 				for (int i = 0; i < 3; i++) {
@@ -1446,6 +1523,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::PROJECTION: {
+			ENCODE_RESERVE(16 * sizeof(real_t));
 			if (buf) {
 				Projection val = p_variant;
 				for (int i = 0; i < 4; i++) {
@@ -1461,6 +1539,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		// misc types
 		case Variant::COLOR: {
+			ENCODE_RESERVE(4 * 4);
 			if (buf) {
 				Color c = p_variant;
 				encode_float(c.r, &buf[0]);
@@ -1475,6 +1554,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::RID: {
 			RID rid = p_variant;
 
+			ENCODE_RESERVE(8);
 			if (buf) {
 				encode_uint64(rid.get_id(), buf);
 			}
@@ -1484,13 +1564,14 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (p_full_objects) {
 				Object *obj = p_variant;
 				if (!obj) {
+					ENCODE_RESERVE(4);
 					if (buf) {
 						encode_uint32(0, buf);
 					}
 					r_len += 4;
 
 				} else {
-					_encode_string(obj->get_class(), buf, r_len);
+					_encode_string(obj->get_class(), buf, p_capacity, r_len);
 
 					List<PropertyInfo> props;
 					obj->get_property_list(&props);
@@ -1503,6 +1584,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 						pc++;
 					}
 
+					ENCODE_RESERVE(4);
 					if (buf) {
 						encode_uint32(pc, buf);
 						buf += 4;
@@ -1515,12 +1597,13 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 							continue;
 						}
 
-						_encode_string(E.name, buf, r_len);
+						_encode_string(E.name, buf, p_capacity, r_len);
 
 						int len;
-						Error err = encode_variant(obj->get(E.name), buf, len, p_full_objects, p_depth + 1);
+						Error err = _encode_variant(obj->get(E.name), buf, buf ? p_capacity - r_len : 0, len, p_full_objects, p_depth + 1);
 						ERR_FAIL_COND_V(err, err);
 						ERR_FAIL_COND_V(len % 4, ERR_BUG);
+						ENCODE_RESERVE(len);
 						r_len += len;
 						if (buf) {
 							buf += len;
@@ -1528,6 +1611,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					}
 				}
 			} else {
+				ENCODE_RESERVE(8);
 				if (buf) {
 					Object *obj = p_variant.get_validated_object();
 					ObjectID id;
@@ -1547,8 +1631,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::SIGNAL: {
 			Signal signal = p_variant;
 
-			_encode_string(signal.get_name(), buf, r_len);
+			_encode_string(signal.get_name(), buf, p_capacity, r_len);
 
+			ENCODE_RESERVE(8);
 			if (buf) {
 				encode_uint64(signal.get_object_id(), buf);
 			}
@@ -1557,6 +1642,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::DICTIONARY: {
 			Dictionary d = p_variant;
 
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(uint32_t(d.size()), buf);
 				buf += 4;
@@ -1568,18 +1654,20 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			for (const Variant &E : keys) {
 				int len;
-				Error err = encode_variant(E, buf, len, p_full_objects, p_depth + 1);
+				Error err = _encode_variant(E, buf, buf ? p_capacity - r_len : 0, len, p_full_objects, p_depth + 1);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
+				ENCODE_RESERVE(len);
 				r_len += len;
 				if (buf) {
 					buf += len;
 				}
 				Variant *v = d.getptr(E);
 				ERR_FAIL_COND_V(!v, ERR_BUG);
-				err = encode_variant(*v, buf, len, p_full_objects, p_depth + 1);
+				err = _encode_variant(*v, buf, buf ? p_capacity - r_len : 0, len, p_full_objects, p_depth + 1);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
+				ENCODE_RESERVE(len);
 				r_len += len;
 				if (buf) {
 					buf += len;
@@ -1590,6 +1678,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		case Variant::ARRAY: {
 			Array v = p_variant;
 
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(uint32_t(v.size()), buf);
 				buf += 4;
@@ -1599,9 +1688,10 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			for (int i = 0; i < v.size(); i++) {
 				int len;
-				Error err = encode_variant(v.get(i), buf, len, p_full_objects, p_depth + 1);
+				Error err = _encode_variant(v.get(i), buf, buf ? p_capacity - r_len : 0, len, p_full_objects, p_depth + 1);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
+				ENCODE_RESERVE(len);
 				r_len += len;
 				if (buf) {
 					buf += len;
@@ -1615,6 +1705,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(uint8_t);
 
+			ENCODE_RESERVE(4 + ((datalen * datasize + 3) & ~3));
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
@@ -1637,6 +1728,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(int32_t);
 
+			ENCODE_RESERVE(4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
@@ -1654,6 +1746,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(int64_t);
 
+			ENCODE_RESERVE(4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
@@ -1671,6 +1764,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(float);
 
+			ENCODE_RESERVE(4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
@@ -1688,6 +1782,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datalen = data.size();
 			int datasize = sizeof(double);
 
+			ENCODE_RESERVE(4 + datalen * datasize);
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
@@ -1704,6 +1799,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<String> data = p_variant;
 			int len = data.size();
 
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1714,6 +1810,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			for (int i = 0; i < len; i++) {
 				CharString utf8 = data.get(i).utf8();
 
+				ENCODE_RESERVE(4 + ((utf8.length() + 1 + 3) & ~3));
 				if (buf) {
 					encode_uint32(utf8.length() + 1, buf);
 					buf += 4;
@@ -1735,6 +1832,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Vector2> data = p_variant;
 			int len = data.size();
 
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1742,6 +1840,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			ENCODE_RESERVE(sizeof(real_t) * 2 * len);
 			if (buf) {
 				for (int i = 0; i < len; i++) {
 					Vector2 v = data.get(i);
@@ -1759,6 +1858,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Vector3> data = p_variant;
 			int len = data.size();
 
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1766,6 +1866,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			ENCODE_RESERVE(sizeof(real_t) * 3 * len);
 			if (buf) {
 				for (int i = 0; i < len; i++) {
 					Vector3 v = data.get(i);
@@ -1784,6 +1885,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			Vector<Color> data = p_variant;
 			int len = data.size();
 
+			ENCODE_RESERVE(4);
 			if (buf) {
 				encode_uint32(len, buf);
 				buf += 4;
@@ -1791,6 +1893,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 			r_len += 4;
 
+			ENCODE_RESERVE(4 * 4 * len);
 			if (buf) {
 				for (int i = 0; i < len; i++) {
 					Color c = data.get(i);
@@ -1813,3 +1916,25 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 	return OK;
 }
+
+#undef ENCODE_RESERVE
+
+Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+	return _encode_variant(p_variant, r_buffer, INT_MAX, r_len, p_full_objects, p_depth);
+}
+
+Error encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int &r_len, bool p_full_objects, int p_max_size) {
+	// Encode straight into the buffer, it only has to be done again if it turns out to be too small.
+	Error err = _encode_variant(p_variant, r_buffer.ptrw(), r_buffer.size(), r_len, p_full_objects, 0);
+	if (err != OK || r_len <= r_buffer.size()) {
+		return err;
+	}
+
+	if (r_len > p_max_size) {
+		return ERR_OUT_OF_MEMORY;
+	}
+
+	r_buffer.resize(0); // Avoid copying the data that will be overwritten anyway.
+	r_buffer.resize(r_len > (1 << 30) ? r_len : next_power_of_2(r_len));
+	return _encode_variant(p_variant, r_buffer.ptrw(), r_buffer.size(), r_len, p_full_objects, 0);
+}
@@ -212,7 +212,19 @@ public:
 	EncodedObjectAsID() {}
 };
 
+// Elements of an encoded packed array, still in the source buffer. They are stored in little-endian order and may not be aligned.
+struct PackedArrayView {
+	Variant::Type type = Variant::NIL;
+	const uint8_t *data = nullptr;
+	int count = 0;
+	int element_size = 0;
+};
+
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
+// Decodes the header of a packed array of fixed-size elements without copying them. Fails on any other type.
+Error decode_packed_array_view(PackedArrayView &r_view, const uint8_t *p_buffer, int p_len, int *r_len = nullptr);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
+// Encodes in a single pass when r_buffer is large enough, and grows it otherwise. It is never shrunk so it can be reused for the next call; r_len is the encoded size.
+Error encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int &r_len, bool p_full_objects = false, int p_max_size = INT_MAX);
 
 #endif // MARSHALLS_H
@@ -53,6 +53,10 @@ public:
 		TYPE_UDP,
 	};
 
+	enum {
+		MAX_SEND_BUFFERS = 16, // Maximum number of buffers gathered by a single sendv() call.
+	};
+
 	virtual Error open(Type p_type, IP::Type &ip_type) = 0;
 	virtual void close() = 0;
 	virtual Error bind(IPAddress p_addr, uint16_t p_port) = 0;
@@ -62,6 +66,7 @@ public:
 	virtual Error recv(uint8_t *p_buffer, int p_len, int &r_read) = 0;
 	virtual Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port, bool p_peek = false) = 0;
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent) = 0;
+	virtual Error sendv(const uint8_t *const *p_buffers, const int *p_lens, int p_count, int &r_sent) = 0;
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) = 0;
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port) = 0;
 
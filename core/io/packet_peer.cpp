@@ -89,8 +89,9 @@ Error PacketPeer::get_var(Variant &r_variant, bool p_allow_objects) {
 }
 
 Error PacketPeer::put_var(const Variant &p_packet, bool p_full_objects) {
-	int len;
-	Error err = encode_variant(p_packet, nullptr, len, p_full_objects); // compute len first
+	int len = 0;
+	Error err = encode_variant_to_buffer(p_packet, encode_buffer, len, p_full_objects, encode_buffer_max_size);
+	ERR_FAIL_COND_V_MSG(len > encode_buffer_max_size, ERR_OUT_OF_MEMORY, "Failed to encode variant, encode size is bigger then encode_buffer_max_size. Consider raising it via 'set_encode_buffer_max_size'.");
 	if (err) {
 		return err;
 	}
@@ -99,18 +100,7 @@ Error PacketPeer::put_var(const Variant &p_packet, bool p_full_objects) {
 		return OK;
 	}
 
-	ERR_FAIL_COND_V_MSG(len > encode_buffer_max_size, ERR_OUT_OF_MEMORY, "Failed to encode variant, encode size is bigger then encode_buffer_max_size. Consider raising it via 'set_encode_buffer_max_size'.");
-
-	if (unlikely(encode_buffer.size() < len)) {
-		encode_buffer.resize(0); // Avoid realloc
-		encode_buffer.resize(next_power_of_2(len));
-	}
-
-	uint8_t *w = encode_buffer.ptrw();
-	err = encode_variant(p_packet, w, len, p_full_objects);
-	ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to encode Variant.");
-
-	return put_packet(w, len);
+	return put_packet(encode_buffer.ptr(), len);
 }
 
 Variant PacketPeer::_bnd_get_var(bool p_allow_objects) {
@@ -291,10 +281,7 @@ Error PacketPeerStream::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
 	ERR_FAIL_COND_V(p_buffer_size + 4 > output_buffer.size(), ERR_INVALID_PARAMETER);
 
 	encode_uint32(p_buffer_size, output_buffer.ptrw());
-	uint8_t *dst = &output_buffer.write[4];
-	for (int i = 0; i < p_buffer_size; i++) {
-		dst[i] = p_buffer[i];
-	}
+	memcpy(&output_buffer.write[4], p_buffer, p_buffer_size);
 
 	return peer->put_data(&output_buffer[0], p_buffer_size + 4);
 }
@@ -32,10 +32,14 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/version.h"
 
+// Files are compressed in blocks of this size, reading anywhere in a file only needs to decompress one.
+static const uint32_t PACK_COMPRESSION_BLOCK_SIZE = 64 * 1024;
+
 static int _get_pad(int p_alignment, int p_n) {
 	int rest = p_n % p_alignment;
 	int pad = 0;
@@ -48,7 +52,7 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -106,7 +110,7 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress) {
 	Ref<FileAccess> f = FileAccess::open(p_src, FileAccess::READ);
 	if (f.is_null()) {
 		return ERR_FILE_CANT_OPEN;
@@ -128,8 +132,10 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 		}
 	}
 	pf.encrypted = p_encrypt;
+	// The compressed format stores the file size in 32 bits and keeps the whole file in memory while writing it.
+	pf.compressed = p_compress && pf.size < 0x80000000;
 
-	uint64_t _size = pf.size;
+	uint64_t _size = pf.size; // Offsets of compressed files are only known when writing them in flush().
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
 			_size += 16 - (_size % 16);
@@ -147,19 +153,7 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	return OK;
 }
 
-Error PCKPacker::flush(bool p_verbose) {
-	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
-
-	int64_t file_base_ofs = file->get_position();
-	file->store_64(0); // files base
-
-	for (int i = 0; i < 16; i++) {
-		file->store_32(0); // reserved
-	}
-
-	// write the index
-	file->store_32(files.size());
-
+Error PCKPacker::_store_directory() {
 	Ref<FileAccessEncrypted> fae;
 	Ref<FileAccess> fhead = file;
 
@@ -191,6 +185,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -199,6 +196,26 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.unref();
 	}
 
+	return OK;
+}
+
+Error PCKPacker::flush(bool p_verbose) {
+	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
+
+	int64_t file_base_ofs = file->get_position();
+	file->store_64(0); // files base
+
+	for (int i = 0; i < 16; i++) {
+		file->store_32(0); // reserved
+	}
+
+	// write the index
+	file->store_32(files.size());
+
+	int64_t dir_ofs = file->get_position();
+	Error err = _store_directory();
+	ERR_FAIL_COND_V(err != OK, err);
+
 	int header_padding = _get_pad(alignment, file->get_position());
 	for (int i = 0; i < header_padding; i++) {
 		file->store_8(Math::rand() % 256);
@@ -212,27 +229,50 @@ Error PCKPacker::flush(bool p_verbose) {
 	const uint32_t buf_max = 65536;
 	uint8_t *buf = memnew_arr(uint8_t, buf_max);
 
+	Ref<FileAccessEncrypted> fae;
+	bool has_compressed = false;
+
 	int count = 0;
 	for (int i = 0; i < files.size(); i++) {
 		Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
 		uint64_t to_write = files[i].size;
+		files.write[i].ofs = file->get_position() - file_base;
 
 		Ref<FileAccess> ftmp = file;
 		if (files[i].encrypted) {
 			fae.instantiate();
 			ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
 
-			Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+			err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
 			ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
 			ftmp = fae;
 		}
 
+		// Compressed before being encrypted, encrypted data doesn't compress.
+		Ref<FileAccessCompressed> fac;
+		Ref<FileAccess> fdst = ftmp;
+		uint64_t compressed_start = ftmp->get_position();
+		if (files[i].compressed) {
+			fac.instantiate();
+			fac->configure(PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSION_BLOCK_SIZE);
+			err = fac->open_for_writing(ftmp);
+			ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
+			fdst = fac;
+			has_compressed = true;
+		}
+
 		while (to_write > 0) {
 			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
+			fdst->store_buffer(buf, read);
 			to_write -= read;
 		}
 
+		if (fac.is_valid()) {
+			fdst.unref();
+			fac.unref(); // Writes the compressed blocks.
+			files.write[i].size = ftmp->get_position() - compressed_start;
+		}
+
 		if (fae.is_valid()) {
 			ftmp.unref();
 			fae.unref();
@@ -250,6 +290,15 @@ Error PCKPacker::flush(bool p_verbose) {
 		}
 	}
 
+	if (has_compressed) {
+		// Now that compressed sizes are known, write the directory again, it takes exactly the same space.
+		int64_t end = file->get_position();
+		file->seek(dir_ofs);
+		err = _store_directory();
+		ERR_FAIL_COND_V(err != OK, err);
+		file->seek(end);
+	}
+
 	if (p_verbose) {
 		printf("\n");
 	}
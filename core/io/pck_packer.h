@@ -53,13 +53,16 @@ class PCKPacker : public RefCounted {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
 
+	Error _store_directory();
+
 public:
 	Error pck_start(const String &p_file, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
-	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
+	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false, bool p_compress = false);
 	Error flush(bool p_verbose = false);
 
 	PCKPacker() {}
@@ -464,12 +464,18 @@ HashMap<String, Resource *> ResourceCache::resources;
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
 
+LRUCache<String, ResourceCache::RetainedResource> ResourceCache::retained(INT32_MAX); // Bounded by retain_budget instead.
+uint64_t ResourceCache::retain_budget = 0;
+uint64_t ResourceCache::retained_cost = 0;
+
 Mutex ResourceCache::lock;
 #ifdef TOOLS_ENABLED
 RWLock ResourceCache::path_cache_lock;
 #endif
 
 void ResourceCache::clear() {
+	clear_retained();
+
 	if (resources.size()) {
 		ERR_PRINT("Resources still in use at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
@@ -544,6 +550,92 @@ int ResourceCache::get_cached_resource_count() {
 	return rc;
 }
 
+void ResourceCache::_evict_retained(List<Ref<Resource>> *r_evicted) {
+	RetainedResource evicted;
+	while (retained_cost > retain_budget && retained.evict_least_recent(nullptr, &evicted)) {
+		retained_cost -= evicted.cost;
+		r_evicted->push_back(evicted.resource);
+	}
+}
+
+void ResourceCache::set_retain_budget(uint64_t p_bytes) {
+	List<Ref<Resource>> evicted;
+
+	lock.lock();
+	retain_budget = p_bytes;
+	_evict_retained(&evicted);
+	lock.unlock();
+
+	// Resources freed here lock the cache to remove themselves, let them go only after unlocking.
+	evicted.clear();
+}
+
+uint64_t ResourceCache::get_retain_budget() {
+	return retain_budget;
+}
+
+void ResourceCache::retain(const Ref<Resource> &p_resource, uint64_t p_cost) {
+	ERR_FAIL_COND(p_resource.is_null());
+	const String &path = p_resource->get_path();
+	if (retain_budget == 0 || path.is_empty() || p_cost > retain_budget) {
+		return;
+	}
+
+	List<Ref<Resource>> evicted;
+
+	lock.lock();
+	const RetainedResource *existing = retained.getptr(path);
+	if (existing) {
+		retained_cost -= existing->cost;
+		evicted.push_back(existing->resource);
+	}
+	RetainedResource entry;
+	entry.resource = p_resource;
+	entry.cost = p_cost;
+	retained.insert(path, entry);
+	retained_cost += p_cost;
+	_evict_retained(&evicted);
+	lock.unlock();
+
+	evicted.clear();
+}
+
+void ResourceCache::touch_retained(const String &p_path) {
+	if (retain_budget == 0) {
+		return;
+	}
+
+	lock.lock();
+	retained.getptr(p_path);
+	lock.unlock();
+}
+
+void ResourceCache::clear_retained() {
+	List<Ref<Resource>> evicted;
+
+	lock.lock();
+	RetainedResource entry;
+	while (retained.evict_least_recent(nullptr, &entry)) {
+		evicted.push_back(entry.resource);
+	}
+	retained_cost = 0;
+	lock.unlock();
+
+	evicted.clear();
+}
+
+int ResourceCache::get_retained_count() {
+	lock.lock();
+	int rc = retained.get_size();
+	lock.unlock();
+
+	return rc;
+}
+
+uint64_t ResourceCache::get_retained_cost() {
+	return retained_cost;
+}
+
 void ResourceCache::dump(const char *p_file, bool p_short) {
 #ifdef DEBUG_ENABLED
 	lock.lock();
@@ -34,6 +34,7 @@
 #include "core/io/resource_uid.h"
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/lru.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
@@ -155,6 +156,16 @@ class ResourceCache {
 	friend class ResourceLoader; //need the lock
 	static Mutex lock;
 	static HashMap<String, Resource *> resources;
+
+	// Recently loaded resources, kept alive after their last user lets them go until they fall out of the budget.
+	struct RetainedResource {
+		Ref<Resource> resource;
+		uint64_t cost = 0;
+	};
+	static LRUCache<String, RetainedResource> retained;
+	static uint64_t retain_budget;
+	static uint64_t retained_cost;
+	static void _evict_retained(List<Ref<Resource>> *r_evicted);
 #ifdef TOOLS_ENABLED
 	static HashMap<String, HashMap<String, String>> resource_path_cache; // Each tscn has a set of resource paths and IDs.
 	static RWLock path_cache_lock;
@@ -170,6 +181,14 @@ public:
 	static void dump(const char *p_file = nullptr, bool p_short = false);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static void set_retain_budget(uint64_t p_bytes);
+	static uint64_t get_retain_budget();
+	static void retain(const Ref<Resource> &p_resource, uint64_t p_cost);
+	static void touch_retained(const String &p_path);
+	static void clear_retained();
+	static int get_retained_count();
+	static uint64_t get_retained_cost();
 };
 
 #endif // RESOURCE_H
@@ -99,8 +99,49 @@ enum {
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
-		for (uint32_t i = 0; i < extra; i++) {
-			f->get_8(); //pad to 32
+		uint8_t padding[3];
+		f->get_buffer(padding, extra); //pad to 32
+	}
+}
+
+// The format is little endian, so arrays are read in bulk and only swapped on big endian systems.
+
+static void read_words_32(uint32_t *p_dst, Ref<FileAccess> &f, size_t p_count) {
+	f->get_buffer((uint8_t *)p_dst, p_count * sizeof(uint32_t));
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		p_dst[i] = BSWAP32(p_dst[i]);
+	}
+#endif
+}
+
+static void read_words_64(uint64_t *p_dst, Ref<FileAccess> &f, size_t p_count) {
+	f->get_buffer((uint8_t *)p_dst, p_count * sizeof(uint64_t));
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		p_dst[i] = BSWAP64(p_dst[i]);
+	}
+#endif
+}
+
+// Reals stored with a different precision than real_t are converted from a bulk read, or in place when the file is memory mapped.
+template <class T, T (*DECODE)(const uint8_t *)>
+static void read_converted_reals(real_t *p_dst, Ref<FileAccess> &f, size_t p_count) {
+	const uint8_t *view = f->get_buffer_view(p_count * sizeof(T));
+	if (view) {
+		for (size_t i = 0; i < p_count; i++) {
+			p_dst[i] = DECODE(view + i * sizeof(T));
+		}
+		return;
+	}
+
+	const size_t chunk_size = 1024;
+	uint8_t buffer[chunk_size * sizeof(T)];
+	for (size_t i = 0; i < p_count; i += chunk_size) {
+		const size_t count = MIN(chunk_size, p_count - i);
+		f->get_buffer(buffer, count * sizeof(T));
+		for (size_t j = 0; j < count; j++) {
+			p_dst[i + j] = DECODE(buffer + j * sizeof(T));
 		}
 	}
 }
@@ -109,39 +150,19 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *dst = (uint64_t *)dst;
-				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP64(dst[i]);
-				}
-			}
-#endif
+			read_words_64((uint64_t *)dst, f, count);
 		} else if (sizeof(real_t) == 4) {
 			// May be slower, but this is for compatibility. Eventually the data should be converted.
-			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_double();
-			}
+			read_converted_reals<double, decode_double>(dst, f, count);
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
 		}
 	} else {
 		if (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *dst = (uint32_t *)dst;
-				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP32(dst[i]);
-				}
-			}
-#endif
+			read_words_32((uint32_t *)dst, f, count);
 		} else if (sizeof(real_t) == 8) {
-			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_float();
-			}
+			read_converted_reals<float, decode_float>(dst, f, count);
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
 		}
@@ -159,9 +180,14 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
-		s.parse_utf8(&str_buf[0]);
+		const uint8_t *view = f->get_buffer_view(len);
+		if (view) {
+			s.parse_utf8((const char *)view, len);
+		} else {
+			f->get_buffer((uint8_t *)&str_buf[0], len);
+			s.parse_utf8(&str_buf[0]);
+		}
 		return s;
 	}
 
@@ -524,16 +550,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			read_words_32((uint32_t *)w, f, len);
 
 			r_v = array;
 		} break;
@@ -543,16 +560,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			read_words_64((uint64_t *)w, f, len);
 
 			r_v = array;
 		} break;
@@ -562,16 +570,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			read_words_32((uint32_t *)w, f, len);
 
 			r_v = array;
 		} break;
@@ -581,16 +580,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			read_words_64((uint64_t *)w, f, len);
 
 			r_v = array;
 		} break;
@@ -640,16 +630,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len * 4; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			read_words_32((uint32_t *)w, f, len * 4);
 
 			r_v = array;
 		} break;
@@ -852,6 +833,12 @@ Error ResourceLoaderBinary::load() {
 		res->set_edited(false);
 #endif
 
+		if (!main && cache_mode != ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceLoader::is_deduplicating_sub_resources()) {
+			// Share it if an identical one was already loaded from another file, the one just loaded is freed with the loader.
+			res = ResourceLoader::deduplicate_sub_resource(res);
+			internal_index_cache[path] = res;
+		}
+
 		if (progress) {
 			*progress = (i + 1) / float(internal_resources.size());
 		}
@@ -898,9 +885,15 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
-	s.parse_utf8(&str_buf[0]);
+	const uint8_t *view = f->get_buffer_view(len);
+	if (view) {
+		// Read in place from memory mapped packs.
+		s.parse_utf8((const char *)view, len);
+	} else {
+		f->get_buffer((uint8_t *)&str_buf[0], len);
+		s.parse_utf8(&str_buf[0]);
+	}
 	return s;
 }
 
@@ -32,8 +32,11 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/io/missing_resource.h"
 #include "core/io/resource_importer.h"
 #include "core/os/os.h"
+#include "core/os/profiling.h"
 #include "core/string/print_string.h"
 #include "core/string/translation.h"
 #include "core/variant/variant_parser.h"
@@ -202,6 +205,8 @@ void ResourceFormatLoader::_bind_methods() {
 ///////////////////////////////////
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	PROFILE_ZONE_TEXT("ResourceLoader::_load", p_path);
+	MemoryTagScope memory_tag(Memory::TAG_RESOURCES);
 	bool found = false;
 
 	// Try all loaders and pick the first match for the type hint
@@ -233,7 +238,7 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
 	load_task.loader_id = Thread::get_caller_id();
 
-	if (load_task.semaphore) {
+	if (load_task.semaphore && !load_task.pooled) {
 		//this is an actual thread, so wait for Ok from semaphore
 		thread_load_semaphore->wait(); //wait until its ok to start loading
 	}
@@ -241,6 +246,15 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 
 	load_task.progress = 1.0; //it was fully loaded at this point, so force progress to 1.0
 
+	uint64_t retain_cost = 0;
+	if (load_task.resource.is_valid() && load_task.cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && ResourceCache::get_retain_budget() > 0) {
+		// The size on disk is a cheap stand-in for what the resource takes in memory.
+		Ref<FileAccess> f = FileAccess::open(load_task.remapped_path, FileAccess::READ);
+		if (f.is_valid()) {
+			retain_cost = f->get_length();
+		}
+	}
+
 	thread_load_mutex->lock();
 	if (load_task.error != OK) {
 		load_task.status = THREAD_LOAD_FAILED;
@@ -248,7 +262,9 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		load_task.status = THREAD_LOAD_LOADED;
 	}
 	if (load_task.semaphore) {
-		if (load_task.start_next && thread_waiting_count > 0) {
+		if (load_task.pooled) {
+			// Doesn't count towards the thread limit, the pool has its own.
+		} else if (load_task.start_next && thread_waiting_count > 0) {
 			thread_waiting_count--;
 			//thread loading count remains constant, this ends but another one begins
 			thread_load_semaphore->post();
@@ -285,6 +301,10 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		if (_loaded_callback) {
 			_loaded_callback(load_task.resource, load_task.local_path);
 		}
+
+		if (retain_cost > 0) {
+			ResourceCache::retain(load_task.resource, retain_cost);
+		}
 	}
 
 	thread_load_mutex->unlock();
@@ -356,6 +376,7 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 
 			if (existing.is_valid()) {
 				//referencing is fine
+				ResourceCache::touch_retained(local_path);
 				load_task.resource = existing;
 				load_task.status = THREAD_LOAD_LOADED;
 				load_task.progress = 1.0;
@@ -371,7 +392,15 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 
 	ThreadLoadTask &load_task = thread_load_tasks[local_path];
 
-	if (load_task.resource.is_null()) { //needs to be loaded in thread
+	if (load_task.resource.is_null() && !p_source_resource.is_empty() && WorkerThreadPool::get_singleton()->get_thread_count() > 0) {
+		// Dependencies requested by a resource being loaded go to the WorkerThreadPool, so all the ones found
+		// in a scene load in parallel without starting a thread for each of them.
+		// They are high priority because a pool thread waiting for one keeps processing the queue, which
+		// low priority tasks can be held out of while all the low priority slots are waiting.
+		load_task.semaphore = memnew(Semaphore);
+		load_task.pooled = true;
+		load_task.task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, &load_task, true, "ResourceLoad: " + local_path);
+	} else if (load_task.resource.is_null()) { //needs to be loaded in thread
 
 		load_task.semaphore = memnew(Semaphore);
 		if (thread_loading_count < thread_load_max) {
@@ -451,7 +480,24 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 
 	//semaphore still exists, meaning it's still loading, request poll
 	Semaphore *semaphore = load_task.semaphore;
-	if (semaphore) {
+	if (semaphore && load_task.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		// Wait on the pool task itself, so a pool thread keeps running other tasks (possibly the one waited on)
+		// meanwhile. Only one thread can do this, others wait on the semaphore below.
+		WorkerThreadPool::TaskID task_id = load_task.task_id;
+		load_task.task_id = WorkerThreadPool::INVALID_TASK_ID;
+
+		thread_load_mutex->unlock();
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		thread_load_mutex->lock();
+
+		if (!thread_load_tasks.has(local_path)) { //may have been erased during unlock and this was always an invalid call
+			thread_load_mutex->unlock();
+			if (r_error) {
+				*r_error = ERR_INVALID_PARAMETER;
+			}
+			return Ref<Resource>();
+		}
+	} else if (semaphore) {
 		load_task.poll_requests++;
 
 		{
@@ -499,16 +545,23 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 
 	load_task.requests--;
 
+	WorkerThreadPool::TaskID task_to_free = WorkerThreadPool::INVALID_TASK_ID;
 	if (load_task.requests == 0) {
 		if (load_task.thread) { //thread may not have been used
 			load_task.thread->wait_to_finish();
 			memdelete(load_task.thread);
 		}
+		task_to_free = load_task.task_id;
 		thread_load_tasks.erase(local_path);
 	}
 
 	thread_load_mutex->unlock();
 
+	if (task_to_free != WorkerThreadPool::INVALID_TASK_ID) {
+		// Loading is done at this point, but nobody waited on the pool task, which needs to be freed.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_to_free);
+	}
+
 	return resource;
 }
 
@@ -544,6 +597,8 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 		if (existing.is_valid()) {
 			thread_load_mutex->unlock();
 
+			ResourceCache::touch_retained(local_path);
+
 			if (r_error) {
 				*r_error = OK;
 			}
@@ -994,6 +1049,94 @@ void ResourceLoader::set_create_missing_resources_if_class_unavailable(bool p_en
 	create_missing_resources_if_class_unavailable = p_enable;
 }
 
+static bool _get_deduplication_properties(const Ref<Resource> &p_resource, List<Pair<StringName, Variant>> &r_properties, uint32_t &r_hash) {
+	// Resources with a script or meant to be duplicated per scene instance have state of their own, never share them.
+	if (p_resource->is_local_to_scene() || p_resource->get_script().get_type() != Variant::NIL || Object::cast_to<MissingResource>(p_resource.ptr())) {
+		return false;
+	}
+
+	r_hash = hash_murmur3_one_32(p_resource->get_class_name().hash());
+
+	List<PropertyInfo> plist;
+	p_resource->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE)) {
+			continue;
+		}
+
+		// Sub-resources hash by identity, so a resource only matches another once its own sub-resources were shared.
+		Variant value = p_resource->get(E.name);
+		r_hash = hash_murmur3_one_32(E.name.hash(), r_hash);
+		r_hash = hash_murmur3_one_32(value.hash(), r_hash);
+		r_properties.push_back(Pair<StringName, Variant>(E.name, value));
+	}
+
+	r_hash = hash_fmix32(r_hash);
+	return true;
+}
+
+Ref<Resource> ResourceLoader::deduplicate_sub_resource(const Ref<Resource> &p_resource) {
+	ERR_FAIL_COND_V(p_resource.is_null(), p_resource);
+
+	List<Pair<StringName, Variant>> properties;
+	uint32_t hash = 0;
+	if (!_get_deduplication_properties(p_resource, properties, hash)) {
+		return p_resource;
+	}
+
+	MutexLock lock(deduplicate_mutex);
+
+	LocalVector<ObjectID> &candidates = deduplicate_map[hash];
+	for (uint32_t i = 0; i < candidates.size(); i++) {
+		Ref<Resource> candidate = Ref<Resource>(Object::cast_to<Resource>(ObjectDB::get_instance(candidates[i])));
+		if (candidate.is_null()) {
+			// Freed since, forget about it.
+			candidates.remove_at_unordered(i);
+			i--;
+			continue;
+		}
+
+		if (candidate == p_resource || candidate->get_class_name() != p_resource->get_class_name()) {
+			continue;
+		}
+
+		bool equal = true;
+		for (const Pair<StringName, Variant> &E : properties) {
+			bool valid = false;
+			Variant value = candidate->get(E.first, &valid);
+			if (!valid || !value.hash_compare(E.second)) {
+				equal = false;
+				break;
+			}
+		}
+
+		if (!equal) {
+			continue;
+		}
+
+		uint64_t bytes = 0;
+		for (const Pair<StringName, Variant> &E : properties) {
+			int len = 0;
+			if (encode_variant(E.second, nullptr, len, false) == OK) {
+				bytes += len;
+			}
+		}
+
+		deduplicate_shared_count++;
+		deduplicate_bytes_saved += bytes;
+		return candidate;
+	}
+
+	candidates.push_back(p_resource->get_instance_id());
+	return p_resource;
+}
+
+void ResourceLoader::get_deduplication_stats(uint64_t &r_shared_count, uint64_t &r_bytes_saved) {
+	MutexLock lock(deduplicate_mutex);
+	r_shared_count = deduplicate_shared_count;
+	r_bytes_saved = deduplicate_bytes_saved;
+}
+
 void ResourceLoader::add_custom_loaders() {
 	// Custom loaders registration exploits global class names
 
@@ -1035,6 +1178,7 @@ void ResourceLoader::initialize() {
 }
 
 void ResourceLoader::finalize() {
+	deduplicate_map.clear();
 	memdelete(thread_load_mutex);
 	memdelete(thread_load_semaphore);
 }
@@ -1048,6 +1192,13 @@ void *ResourceLoader::dep_err_notify_ud = nullptr;
 bool ResourceLoader::create_missing_resources_if_class_unavailable = false;
 bool ResourceLoader::abort_on_missing_resource = true;
 bool ResourceLoader::timestamp_on_load = false;
+bool ResourceLoader::strip_payloads = false;
+
+bool ResourceLoader::deduplicate_sub_resources = false;
+Mutex ResourceLoader::deduplicate_mutex;
+HashMap<uint32_t, LocalVector<ObjectID>> ResourceLoader::deduplicate_map;
+uint64_t ResourceLoader::deduplicate_shared_count = 0;
+uint64_t ResourceLoader::deduplicate_bytes_saved = 0;
 
 Mutex *ResourceLoader::thread_load_mutex = nullptr;
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
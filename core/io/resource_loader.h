@@ -34,6 +34,7 @@
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
 
@@ -113,6 +114,14 @@ private:
 	static DependencyErrorNotify dep_err_notify;
 	static bool abort_on_missing_resource;
 	static bool create_missing_resources_if_class_unavailable;
+	static bool strip_payloads;
+
+	static bool deduplicate_sub_resources;
+	static Mutex deduplicate_mutex;
+	static HashMap<uint32_t, LocalVector<ObjectID>> deduplicate_map; // By content hash, see deduplicate_sub_resource().
+	static uint64_t deduplicate_shared_count;
+	static uint64_t deduplicate_bytes_saved;
+
 	static HashMap<String, Vector<String>> translation_remaps;
 	static HashMap<String, String> path_remaps;
 
@@ -132,6 +141,8 @@ private:
 
 	struct ThreadLoadTask {
 		Thread *thread = nullptr;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID; // Sub-resources are loaded on the pool instead of their own thread.
+		bool pooled = false;
 		Thread::ID loader_id = 0;
 		Semaphore *semaphore = nullptr;
 		String local_path;
@@ -208,6 +219,15 @@ public:
 	static void set_abort_on_missing_resources(bool p_abort) { abort_on_missing_resource = p_abort; }
 	static bool get_abort_on_missing_resources() { return abort_on_missing_resource; }
 
+	// When nothing is drawn or played (dedicated servers), textures and audio samples only keep their metadata.
+	static void set_strip_payloads(bool p_strip) { strip_payloads = p_strip; }
+	_FORCE_INLINE_ static bool is_stripping_payloads() { return strip_payloads; }
+
+	static void set_deduplicate_sub_resources(bool p_enable) { deduplicate_sub_resources = p_enable; }
+	_FORCE_INLINE_ static bool is_deduplicating_sub_resources() { return deduplicate_sub_resources; }
+	static Ref<Resource> deduplicate_sub_resource(const Ref<Resource> &p_resource);
+	static void get_deduplication_stats(uint64_t &r_shared_count, uint64_t &r_bytes_saved);
+
 	static String path_remap(const String &p_path);
 	static String import_remap(const String &p_path);
 
@@ -183,6 +183,46 @@ Error StreamPeerTCP::write(const uint8_t *p_data, int p_bytes, int &r_sent, bool
 	return OK;
 }
 
+Error StreamPeerTCP::_send_buffered(const uint8_t *p_data, int p_bytes) {
+	// Send the buffered data followed by p_data, gathered in as few system calls as possible.
+	const uint8_t *buffers[2] = { write_buffer.ptr(), p_data };
+	int lens[2] = { int(write_buffer.size()), p_bytes };
+	int current = lens[0] ? 0 : 1;
+
+	while (current < 2 && lens[current]) {
+		int sent = 0;
+		Error err = _sock->sendv(&buffers[current], &lens[current], lens[1] ? 2 - current : 1, sent);
+
+		if (err != OK) {
+			if (err != ERR_BUSY) {
+				disconnect_from_host();
+				return FAILED;
+			}
+
+			// Block and wait for the socket to accept more data
+			err = _sock->poll(NetSocket::POLL_TYPE_OUT, -1);
+			if (err != OK) {
+				disconnect_from_host();
+				return FAILED;
+			}
+			continue;
+		}
+
+		while (sent > 0) {
+			int consumed = MIN(sent, lens[current]);
+			buffers[current] += consumed;
+			lens[current] -= consumed;
+			sent -= consumed;
+			if (lens[current] == 0) {
+				current++;
+			}
+		}
+	}
+
+	write_buffer.clear();
+	return OK;
+}
+
 Error StreamPeerTCP::read(uint8_t *p_buffer, int p_bytes, int &r_received, bool p_block) {
 	if (status != STATUS_CONNECTED) {
 		return FAILED;
@@ -252,6 +292,7 @@ void StreamPeerTCP::disconnect_from_host() {
 
 	timeout = 0;
 	status = STATUS_NONE;
+	write_buffer.clear();
 	peer_host = IPAddress();
 	peer_port = 0;
 }
@@ -261,12 +302,59 @@ Error StreamPeerTCP::wait(NetSocket::PollType p_type, int timeout) {
 	return _sock->poll(p_type, timeout);
 }
 
+void StreamPeerTCP::set_write_buffering_enabled(bool p_enabled) {
+	if (write_buffering && !p_enabled) {
+		flush();
+	}
+	write_buffering = p_enabled;
+}
+
+bool StreamPeerTCP::is_write_buffering_enabled() const {
+	return write_buffering;
+}
+
+Error StreamPeerTCP::flush() {
+	if (write_buffer.is_empty()) {
+		return OK;
+	}
+
+	ERR_FAIL_COND_V(!_sock.is_valid(), ERR_UNAVAILABLE);
+	if (status != STATUS_CONNECTED) {
+		return FAILED;
+	}
+
+	return _send_buffered(nullptr, 0);
+}
+
 Error StreamPeerTCP::put_data(const uint8_t *p_data, int p_bytes) {
+	if (write_buffering) {
+		ERR_FAIL_COND_V(!_sock.is_valid(), ERR_UNAVAILABLE);
+		if (status != STATUS_CONNECTED) {
+			return FAILED;
+		}
+
+		if (write_buffer.size() + p_bytes <= WRITE_BUFFER_SIZE) {
+			uint32_t ofs = write_buffer.size();
+			write_buffer.resize(ofs + p_bytes);
+			memcpy(write_buffer.ptr() + ofs, p_data, p_bytes);
+			return OK;
+		}
+
+		// Full, send what is buffered along with the new data.
+		return _send_buffered(p_data, p_bytes);
+	}
+
 	int total;
 	return write(p_data, p_bytes, total, true);
 }
 
 Error StreamPeerTCP::put_partial_data(const uint8_t *p_data, int p_bytes, int &r_sent) {
+	// Keep the order of the writes.
+	Error err = flush();
+	if (err != OK) {
+		return err;
+	}
+
 	return write(p_data, p_bytes, r_sent, false);
 }
 
@@ -322,6 +410,9 @@ void StreamPeerTCP::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_local_port"), &StreamPeerTCP::get_local_port);
 	ClassDB::bind_method(D_METHOD("disconnect_from_host"), &StreamPeerTCP::disconnect_from_host);
 	ClassDB::bind_method(D_METHOD("set_no_delay", "enabled"), &StreamPeerTCP::set_no_delay);
+	ClassDB::bind_method(D_METHOD("set_write_buffering_enabled", "enabled"), &StreamPeerTCP::set_write_buffering_enabled);
+	ClassDB::bind_method(D_METHOD("is_write_buffering_enabled"), &StreamPeerTCP::is_write_buffering_enabled);
+	ClassDB::bind_method(D_METHOD("flush"), &StreamPeerTCP::flush);
 
 	BIND_ENUM_CONSTANT(STATUS_NONE);
 	BIND_ENUM_CONSTANT(STATUS_CONNECTING);
@@ -35,6 +35,7 @@
 #include "core/io/ip_address.h"
 #include "core/io/net_socket.h"
 #include "core/io/stream_peer.h"
+#include "core/templates/local_vector.h"
 
 class StreamPeerTCP : public StreamPeer {
 	GDCLASS(StreamPeerTCP, StreamPeer);
@@ -48,13 +49,21 @@ public:
 	};
 
 protected:
+	enum {
+		WRITE_BUFFER_SIZE = 65536,
+	};
+
 	Ref<NetSocket> _sock;
 	uint64_t timeout = 0;
 	Status status = STATUS_NONE;
 	IPAddress peer_host;
 	uint16_t peer_port = 0;
 
+	bool write_buffering = false;
+	LocalVector<uint8_t> write_buffer;
+
 	Error _connect(const String &p_address, int p_port);
+	Error _send_buffered(const uint8_t *p_data, int p_bytes);
 	Error write(const uint8_t *p_data, int p_bytes, int &r_sent, bool p_block);
 	Error read(uint8_t *p_buffer, int p_bytes, int &r_received, bool p_block);
 
@@ -75,6 +84,11 @@ public:
 
 	void set_no_delay(bool p_enabled);
 
+	// Coalesce put_data() calls into a single send, until flush() is called or the buffer is full.
+	void set_write_buffering_enabled(bool p_enabled);
+	bool is_write_buffering_enabled() const;
+	Error flush();
+
 	// Poll socket updating its state.
 	Error poll();
 
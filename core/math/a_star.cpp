@@ -31,6 +31,7 @@
 #include "a_star.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 
 int64_t AStar3D::get_available_point_id() const {
@@ -48,6 +49,7 @@ int64_t AStar3D::get_available_point_id() const {
 void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(p_id < 0, vformat("Can't add a point with negative id: %d.", p_id));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't add a point with weight scale less than 0.0: %f.", p_weight_scale));
+	_wait_for_queries();
 
 	Point *found_pt;
 	bool p_exists = points.lookup(p_id, found_pt);
@@ -57,10 +59,13 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->id = p_id;
 		pt->pos = p_pos;
 		pt->weight_scale = p_weight_scale;
-		pt->prev_point = nullptr;
-		pt->open_pass = 0;
-		pt->closed_pass = 0;
 		pt->enabled = true;
+		if (free_point_indices.is_empty()) {
+			pt->index = point_index_count++;
+		} else {
+			pt->index = free_point_indices[free_point_indices.size() - 1];
+			free_point_indices.remove_at(free_point_indices.size() - 1);
+		}
 		points.set(p_id, pt);
 	} else {
 		found_pt->pos = p_pos;
@@ -80,6 +85,7 @@ void AStar3D::set_point_position(int64_t p_id, const Vector3 &p_pos) {
 	Point *p;
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set point's position. Point with id: %d doesn't exist.", p_id));
+	_wait_for_queries();
 
 	p->pos = p_pos;
 }
@@ -97,6 +103,7 @@ void AStar3D::set_point_weight_scale(int64_t p_id, real_t p_weight_scale) {
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set point's weight scale. Point with id: %d doesn't exist.", p_id));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
+	_wait_for_queries();
 
 	p->weight_scale = p_weight_scale;
 }
@@ -105,6 +112,7 @@ void AStar3D::remove_point(int64_t p_id) {
 	Point *p;
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't remove point. Point with id: %d doesn't exist.", p_id));
+	_wait_for_queries();
 
 	for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
 		Segment s(p_id, (*it.key));
@@ -122,6 +130,7 @@ void AStar3D::remove_point(int64_t p_id) {
 		(*it.value)->unlinked_neighbours.remove(p->id);
 	}
 
+	free_point_indices.push_back(p->index);
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
@@ -137,6 +146,7 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	Point *b;
 	bool to_exists = points.lookup(p_with_id, b);
 	ERR_FAIL_COND_MSG(!to_exists, vformat("Can't connect points. Point with id: %d doesn't exist.", p_with_id));
+	_wait_for_queries();
 
 	a->neighbours.set(b->id, b);
 
@@ -173,6 +183,7 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 	Point *b;
 	bool b_exists = points.lookup(p_with_id, b);
 	ERR_FAIL_COND_MSG(!b_exists, vformat("Can't disconnect points. Point with id: %d doesn't exist.", p_with_id));
+	_wait_for_queries();
 
 	Segment s(p_id, p_with_id);
 	int remove_direction = bidirectional ? (int)Segment::BIDIRECTIONAL : (int)s.direction;
@@ -242,12 +253,15 @@ bool AStar3D::are_points_connected(int64_t p_id, int64_t p_with_id, bool bidirec
 }
 
 void AStar3D::clear() {
+	_wait_for_queries();
 	last_free_id = 0;
 	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
 		memdelete(*(it.value));
 	}
 	segments.clear();
 	points.clear();
+	free_point_indices.clear();
+	point_index_count = 0;
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -261,6 +275,7 @@ int64_t AStar3D::get_point_capacity() const {
 void AStar3D::reserve_space(int64_t p_num_nodes) {
 	ERR_FAIL_COND_MSG(p_num_nodes <= 0, vformat("New capacity must be greater than 0, new was: %d.", p_num_nodes));
 	ERR_FAIL_COND_MSG((uint32_t)p_num_nodes < points.get_capacity(), vformat("New capacity must be greater than current capacity: %d, new was: %d.", points.get_capacity(), p_num_nodes));
+	_wait_for_queries();
 	points.reserve(p_num_nodes);
 }
 
@@ -318,8 +333,28 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar3D::_solve(Point *begin_point, Point *end_point) {
-	pass++;
+AStar3D::SearchState *AStar3D::_acquire_search_state() {
+	MutexLock lock(search_states_mutex);
+	if (search_states.is_empty()) {
+		return memnew(SearchState);
+	}
+	SearchState *state = search_states[search_states.size() - 1];
+	search_states.remove_at(search_states.size() - 1);
+	return state;
+}
+
+void AStar3D::_release_search_state(SearchState *p_state) {
+	MutexLock lock(search_states_mutex);
+	search_states.push_back(p_state);
+}
+
+bool AStar3D::_solve(Point *begin_point, Point *end_point, SearchState &r_state) {
+	if (r_state.nodes.size() < point_index_count) {
+		r_state.nodes.resize(point_index_count);
+	}
+	r_state.pass++;
+	const uint64_t pass = r_state.pass;
+	SearchNode *nodes = r_state.nodes.ptr();
 
 	if (!end_point->enabled) {
 		return false;
@@ -327,52 +362,55 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 
 	bool found_route = false;
 
-	Vector<Point *> open_list;
+	LocalVector<Point *> open_list;
 	SortArray<Point *, SortPoints> sorter;
+	sorter.compare.nodes = nodes;
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
+	nodes[begin_point->index].g_score = 0;
+	nodes[begin_point->index].f_score = _estimate_cost(begin_point->id, end_point->id);
 	open_list.push_back(begin_point);
 
 	while (!open_list.is_empty()) {
 		Point *p = open_list[0]; // The currently processed point
+		SearchNode &pn = nodes[p->index];
 
 		if (p == end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptrw()); // Remove the current point from the open list
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list
 		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed
+		pn.closed_pass = pass; // Mark the point as closed
 
 		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
 			Point *e = *(it.value); // The neighbour point
+			SearchNode &en = nodes[e->index];
 
-			if (!e->enabled || e->closed_pass == pass) {
+			if (!e->enabled || en.closed_pass == pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = pn.g_score + _compute_cost(p->id, e->id) * e->weight_scale;
 
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
+			if (en.open_pass != pass) { // The point wasn't inside the open list.
+				en.open_pass = pass;
 				open_list.push_back(e);
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= en.g_score) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
+			en.prev_point = p;
+			en.g_score = tentative_g_score;
+			en.f_score = en.g_score + _estimate_cost(e->id, end_point->id);
 
 			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptrw());
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptrw());
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
 			}
 		}
 	}
@@ -432,8 +470,10 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 	Point *begin_point = a;
 	Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point);
+	SearchState *state = _acquire_search_state();
+	bool found_route = _solve(begin_point, end_point, *state);
 	if (!found_route) {
+		_release_search_state(state);
 		return Vector<Vector3>();
 	}
 
@@ -441,7 +481,7 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = state->nodes[p->index].prev_point;
 	}
 
 	Vector<Vector3> path;
@@ -454,16 +494,17 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 		int64_t idx = pc - 1;
 		while (p2 != begin_point) {
 			w[idx--] = p2->pos;
-			p2 = p2->prev_point;
+			p2 = state->nodes[p2->index].prev_point;
 		}
 
 		w[0] = p2->pos; // Assign first
 	}
 
+	_release_search_state(state);
 	return path;
 }
 
-Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
+Vector<int64_t> AStar3D::_get_id_path(int64_t p_from_id, int64_t p_to_id, SearchState &r_state) {
 	Point *a;
 	bool from_exists = points.lookup(p_from_id, a);
 	ERR_FAIL_COND_V_MSG(!from_exists, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_from_id));
@@ -481,7 +522,7 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 	Point *begin_point = a;
 	Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point);
+	bool found_route = _solve(begin_point, end_point, r_state);
 	if (!found_route) {
 		return Vector<int64_t>();
 	}
@@ -490,7 +531,7 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = r_state.nodes[p->index].prev_point;
 	}
 
 	Vector<int64_t> path;
@@ -503,7 +544,7 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 		int64_t idx = pc - 1;
 		while (p != begin_point) {
 			w[idx--] = p->id;
-			p = p->prev_point;
+			p = r_state.nodes[p->index].prev_point;
 		}
 
 		w[0] = p->id; // Assign first
@@ -512,10 +553,110 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 	return path;
 }
 
+Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
+	SearchState *state = _acquire_search_state();
+	Vector<int64_t> path = _get_id_path(p_from_id, p_to_id, *state);
+	_release_search_state(state);
+	return path;
+}
+
+void AStar3D::_solve_batch_query(uint32_t p_index, PathQueryBatch *p_batch) {
+	SearchState *state = _acquire_search_state();
+	p_batch->paths[p_index] = _get_id_path(p_batch->from_ids[p_index], p_batch->to_ids[p_index], *state);
+	_release_search_state(state);
+}
+
+void AStar3D::_run_batch(PathQueryBatch *p_batch, bool p_high_priority) {
+	const int count = p_batch->from_ids.size();
+	p_batch->paths.resize(count);
+	if (count > 1 && _can_solve_in_parallel()) {
+		p_batch->group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStar3D::_solve_batch_query, p_batch, count, -1, p_high_priority, SNAME("AStar3DPathQueries"));
+	} else {
+		// Scripted costs can only be called from one thread at a time.
+		for (int i = 0; i < count; i++) {
+			_solve_batch_query(i, p_batch);
+		}
+	}
+}
+
+Array AStar3D::_get_batch_paths(PathQueryBatch *p_batch) const {
+	Array ret;
+	ret.resize(p_batch->paths.size());
+	for (uint32_t i = 0; i < p_batch->paths.size(); i++) {
+		ret[i] = p_batch->paths[i];
+	}
+	return ret;
+}
+
+void AStar3D::_finish_pending_batches() {
+	for (uint32_t i = 0; i < pending_batches.size(); i++) {
+		if (pending_batches[i]->group_id != -1) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(pending_batches[i]->group_id);
+			pending_batches[i]->group_id = -1;
+		}
+	}
+}
+
+void AStar3D::_deliver_id_paths(int64_t p_request_id) {
+	PathQueryBatch *batch = nullptr;
+	for (uint32_t i = 0; i < pending_batches.size(); i++) {
+		if (pending_batches[i]->request_id == p_request_id) {
+			batch = pending_batches[i];
+			pending_batches.remove_at(i);
+			break;
+		}
+	}
+	ERR_FAIL_NULL(batch);
+
+	if (batch->group_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_id);
+	}
+	Array paths = _get_batch_paths(batch);
+	memdelete(batch);
+
+	_id_paths_found(p_request_id, paths);
+}
+
+Array AStar3D::get_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids) {
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), Array(), vformat("Can't get id paths. There are %d start points but %d end points.", p_from_ids.size(), p_to_ids.size()));
+
+	PathQueryBatch batch;
+	batch.from_ids = p_from_ids;
+	batch.to_ids = p_to_ids;
+	_run_batch(&batch, true);
+	if (batch.group_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch.group_id);
+	}
+	return _get_batch_paths(&batch);
+}
+
+int64_t AStar3D::request_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids) {
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), -1, vformat("Can't request id paths. There are %d start points but %d end points.", p_from_ids.size(), p_to_ids.size()));
+
+	PathQueryBatch *batch = memnew(PathQueryBatch);
+	batch->request_id = ++last_request_id;
+	batch->from_ids = p_from_ids;
+	batch->to_ids = p_to_ids;
+	pending_batches.push_back(batch);
+	_run_batch(batch, false);
+
+	MessageQueue::get_singleton()->push_callable(callable_mp(this, &AStar3D::_deliver_id_paths), batch->request_id);
+	return batch->request_id;
+}
+
+bool AStar3D::_can_solve_in_parallel() const {
+	return !GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+}
+
+void AStar3D::_id_paths_found(int64_t p_request_id, const Array &p_paths) {
+	emit_signal(SNAME("id_paths_found"), p_request_id, p_paths);
+}
+
 void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
 	Point *p;
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set if point is disabled. Point with id: %d doesn't exist.", p_id));
+	_wait_for_queries();
 
 	p->enabled = !p_disabled;
 }
@@ -558,12 +699,23 @@ void AStar3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar3D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar3D::get_id_path);
 
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids"), &AStar3D::get_id_paths);
+	ClassDB::bind_method(D_METHOD("request_id_paths", "from_ids", "to_ids"), &AStar3D::request_id_paths);
+
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "to_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
+
+	ADD_SIGNAL(MethodInfo("id_paths_found", PropertyInfo(Variant::INT, "request_id"), PropertyInfo(Variant::ARRAY, "paths")));
 }
 
 AStar3D::~AStar3D() {
 	clear();
+	for (uint32_t i = 0; i < pending_batches.size(); i++) {
+		memdelete(pending_batches[i]);
+	}
+	for (uint32_t i = 0; i < search_states.size(); i++) {
+		memdelete(search_states[i]);
+	}
 }
 
 /////////////////////////////////////////////////////////////
@@ -689,162 +841,27 @@ real_t AStar2D::_compute_cost(int64_t p_from_id, int64_t p_to_id) {
 }
 
 Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
-	AStar3D::Point *a;
-	bool from_exists = astar.points.lookup(p_from_id, a);
-	ERR_FAIL_COND_V_MSG(!from_exists, Vector<Vector2>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_from_id));
-
-	AStar3D::Point *b;
-	bool to_exists = astar.points.lookup(p_to_id, b);
-	ERR_FAIL_COND_V_MSG(!to_exists, Vector<Vector2>(), vformat("Can't get point path. Point with id: %d doesn't exist.", p_to_id));
-
-	if (a == b) {
-		Vector<Vector2> ret = { Vector2(a->pos.x, a->pos.y) };
-		return ret;
-	}
-
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point);
-	if (!found_route) {
-		return Vector<Vector2>();
-	}
+	Vector<Vector3> path = astar.get_point_path(p_from_id, p_to_id);
 
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	Vector<Vector2> ret;
+	ret.resize(path.size());
+	Vector2 *w = ret.ptrw();
+	for (int i = 0; i < path.size(); i++) {
+		w[i] = Vector2(path[i].x, path[i].y);
 	}
-
-	Vector<Vector2> path;
-	path.resize(pc);
-
-	{
-		Vector2 *w = path.ptrw();
-
-		AStar3D::Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = Vector2(p2->pos.x, p2->pos.y);
-			p2 = p2->prev_point;
-		}
-
-		w[0] = Vector2(p2->pos.x, p2->pos.y); // Assign first
-	}
-
-	return path;
+	return ret;
 }
 
 Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
-	AStar3D::Point *a;
-	bool from_exists = astar.points.lookup(p_from_id, a);
-	ERR_FAIL_COND_V_MSG(!from_exists, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_from_id));
-
-	AStar3D::Point *b;
-	bool to_exists = astar.points.lookup(p_to_id, b);
-	ERR_FAIL_COND_V_MSG(!to_exists, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_id));
-
-	if (a == b) {
-		Vector<int64_t> ret;
-		ret.push_back(a->id);
-		return ret;
-	}
-
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point);
-	if (!found_route) {
-		return Vector<int64_t>();
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
-
-	Vector<int64_t> path;
-	path.resize(pc);
-
-	{
-		int64_t *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		w[0] = p->id; // Assign first
-	}
-
-	return path;
+	return astar.get_id_path(p_from_id, p_to_id);
 }
 
-bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
-	astar.pass++;
-
-	if (!end_point->enabled) {
-		return false;
-	}
-
-	bool found_route = false;
-
-	Vector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
-
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
-
-	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point
-
-		if (p == end_point) {
-			found_route = true;
-			break;
-		}
-
-		sorter.pop_heap(0, open_list.size(), open_list.ptrw()); // Remove the current point from the open list
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = astar.pass; // Mark the point as closed
-
-		for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
-			AStar3D::Point *e = *(it.value); // The neighbour point
-
-			if (!e->enabled || e->closed_pass == astar.pass) {
-				continue;
-			}
-
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
-
-			bool new_point = false;
-
-			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
-				e->open_pass = astar.pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
-				continue;
-			}
-
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptrw());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptrw());
-			}
-		}
-	}
+Array AStar2D::get_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids) {
+	return astar.get_id_paths(p_from_ids, p_to_ids);
+}
 
-	return found_route;
+int64_t AStar2D::request_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids) {
+	return astar.request_id_paths(p_from_ids, p_to_ids);
 }
 
 void AStar2D::_bind_methods() {
@@ -877,6 +894,16 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar2D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar2D::get_id_path);
 
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids"), &AStar2D::get_id_paths);
+	ClassDB::bind_method(D_METHOD("request_id_paths", "from_ids", "to_ids"), &AStar2D::request_id_paths);
+
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "to_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
+
+	ADD_SIGNAL(MethodInfo("id_paths_found", PropertyInfo(Variant::INT, "request_id"), PropertyInfo(Variant::ARRAY, "paths")));
+}
+
+AStar2D::~AStar2D() {
+	// Queries call back into this object for costs.
+	astar._wait_for_queries();
 }
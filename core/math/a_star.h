@@ -34,6 +34,9 @@
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 
 /**
@@ -48,14 +51,17 @@ class AStar3D : public RefCounted {
 		Point() {}
 
 		int64_t id = 0;
+		uint32_t index = 0; // Into SearchState::nodes.
 		Vector3 pos;
 		real_t weight_scale = 0;
 		bool enabled = false;
 
 		OAHashMap<int64_t, Point *> neighbours = 4u;
 		OAHashMap<int64_t, Point *> unlinked_neighbours = 4u;
+	};
 
-		// Used for pathfinding.
+	// Pathfinding data is kept per query rather than in the points, so queries can run at the same time.
+	struct SearchNode {
 		Point *prev_point = nullptr;
 		real_t g_score = 0;
 		real_t f_score = 0;
@@ -63,18 +69,35 @@ class AStar3D : public RefCounted {
 		uint64_t closed_pass = 0;
 	};
 
+	struct SearchState {
+		LocalVector<SearchNode> nodes;
+		uint64_t pass = 0;
+	};
+
 	struct SortPoints {
+		const SearchNode *nodes = nullptr;
+
 		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+			const SearchNode &a = nodes[A->index];
+			const SearchNode &b = nodes[B->index];
+			if (a.f_score > b.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (a.f_score < b.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return a.g_score < b.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
 
+	struct PathQueryBatch {
+		int64_t request_id = 0;
+		Vector<int64_t> from_ids;
+		Vector<int64_t> to_ids;
+		LocalVector<Vector<int64_t>> paths;
+		WorkerThreadPool::GroupID group_id = -1;
+	};
+
 	struct Segment {
 		Pair<int64_t, int64_t> key;
 
@@ -106,18 +129,46 @@ class AStar3D : public RefCounted {
 	};
 
 	int64_t last_free_id = 0;
-	uint64_t pass = 1;
 
 	OAHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
 
-	bool _solve(Point *begin_point, Point *end_point);
+	LocalVector<uint32_t> free_point_indices;
+	uint32_t point_index_count = 0;
+
+	Mutex search_states_mutex;
+	LocalVector<SearchState *> search_states; // Idle ones, reused by later queries.
+
+	int64_t last_request_id = 0;
+	LocalVector<PathQueryBatch *> pending_batches;
+
+	SearchState *_acquire_search_state();
+	void _release_search_state(SearchState *p_state);
+
+	bool _solve(Point *begin_point, Point *end_point, SearchState &r_state);
+	Vector<int64_t> _get_id_path(int64_t p_from_id, int64_t p_to_id, SearchState &r_state);
+
+	void _solve_batch_query(uint32_t p_index, PathQueryBatch *p_batch);
+	void _run_batch(PathQueryBatch *p_batch, bool p_high_priority);
+	Array _get_batch_paths(PathQueryBatch *p_batch) const;
+	void _deliver_id_paths(int64_t p_request_id);
+
+	// The graph can't change while queries from request_id_paths() are running.
+	_FORCE_INLINE_ void _wait_for_queries() {
+		if (!pending_batches.is_empty()) {
+			_finish_pending_batches();
+		}
+	}
+	void _finish_pending_batches();
 
 protected:
 	static void _bind_methods();
 
 	virtual real_t _estimate_cost(int64_t p_from_id, int64_t p_to_id);
 	virtual real_t _compute_cost(int64_t p_from_id, int64_t p_to_id);
+	// Whether the cost functions can be called from several threads at once.
+	virtual bool _can_solve_in_parallel() const;
+	virtual void _id_paths_found(int64_t p_request_id, const Array &p_paths);
 
 	GDVIRTUAL2RC(real_t, _estimate_cost, int64_t, int64_t)
 	GDVIRTUAL2RC(real_t, _compute_cost, int64_t, int64_t)
@@ -153,15 +204,29 @@ public:
 	Vector<Vector3> get_point_path(int64_t p_from_id, int64_t p_to_id);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id);
 
+	Array get_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids);
+	int64_t request_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids);
+
 	AStar3D() {}
 	~AStar3D();
 };
 
 class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
-	AStar3D astar;
 
-	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point);
+	// Forwards costs and results to the AStar2D, so they can be overridden from it.
+	class Graph : public AStar3D {
+	public:
+		AStar2D *owner = nullptr;
+
+	protected:
+		virtual real_t _estimate_cost(int64_t p_from_id, int64_t p_to_id) override { return owner->_estimate_cost(p_from_id, p_to_id); }
+		virtual real_t _compute_cost(int64_t p_from_id, int64_t p_to_id) override { return owner->_compute_cost(p_from_id, p_to_id); }
+		virtual bool _can_solve_in_parallel() const override { return !GDVIRTUAL_IS_OVERRIDDEN_PTR(owner, _estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN_PTR(owner, _compute_cost); }
+		virtual void _id_paths_found(int64_t p_request_id, const Array &p_paths) override { owner->emit_signal(SNAME("id_paths_found"), p_request_id, p_paths); }
+	};
+
+	Graph astar;
 
 protected:
 	static void _bind_methods();
@@ -203,8 +268,11 @@ public:
 	Vector<Vector2> get_point_path(int64_t p_from_id, int64_t p_to_id);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id);
 
-	AStar2D() {}
-	~AStar2D() {}
+	Array get_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids);
+	int64_t request_id_paths(const Vector<int64_t> &p_from_ids, const Vector<int64_t> &p_to_ids);
+
+	AStar2D() { astar.owner = this; }
+	~AStar2D();
 };
 
 #endif // A_STAR_H
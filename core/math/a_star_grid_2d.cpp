@@ -0,0 +1,785 @@
+/*************************************************************************/
+/*  a_star_grid_2d.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "a_star_grid_2d.h"
+
+static real_t heuristic_euclidian(const Vector2i &p_from, const Vector2i &p_to) {
+	real_t dx = (real_t)ABS(p_to.x - p_from.x);
+	real_t dy = (real_t)ABS(p_to.y - p_from.y);
+	return (real_t)Math::sqrt(dx * dx + dy * dy);
+}
+
+static real_t heuristic_manhattan(const Vector2i &p_from, const Vector2i &p_to) {
+	real_t dx = (real_t)ABS(p_to.x - p_from.x);
+	real_t dy = (real_t)ABS(p_to.y - p_from.y);
+	return dx + dy;
+}
+
+static real_t heuristic_octile(const Vector2i &p_from, const Vector2i &p_to) {
+	real_t dx = (real_t)ABS(p_to.x - p_from.x);
+	real_t dy = (real_t)ABS(p_to.y - p_from.y);
+	real_t F = Math_SQRT2 - 1;
+	return (dx < dy) ? F * dx + dy : F * dy + dx;
+}
+
+static real_t heuristic_chebyshev(const Vector2i &p_from, const Vector2i &p_to) {
+	real_t dx = (real_t)ABS(p_to.x - p_from.x);
+	real_t dy = (real_t)ABS(p_to.y - p_from.y);
+	return MAX(dx, dy);
+}
+
+static real_t (*heuristics[AStarGrid2D::HEURISTIC_MAX])(const Vector2i &, const Vector2i &) = { heuristic_euclidian, heuristic_manhattan, heuristic_octile, heuristic_chebyshev };
+
+void AStarGrid2D::set_size(const Vector2i &p_size) {
+	ERR_FAIL_COND(p_size.x < 0 || p_size.y < 0);
+	if (p_size != size) {
+		size = p_size;
+		dirty = true;
+	}
+}
+
+Vector2i AStarGrid2D::get_size() const {
+	return size;
+}
+
+void AStarGrid2D::set_offset(const Vector2 &p_offset) {
+	if (!offset.is_equal_approx(p_offset)) {
+		offset = p_offset;
+		dirty = true;
+	}
+}
+
+Vector2 AStarGrid2D::get_offset() const {
+	return offset;
+}
+
+void AStarGrid2D::set_cell_size(const Vector2 &p_cell_size) {
+	if (!cell_size.is_equal_approx(p_cell_size)) {
+		cell_size = p_cell_size;
+		dirty = true;
+	}
+}
+
+Vector2 AStarGrid2D::get_cell_size() const {
+	return cell_size;
+}
+
+void AStarGrid2D::update() {
+	points.clear();
+	points.resize(size.x * size.y);
+	for (int64_t y = 0; y < size.y; y++) {
+		for (int64_t x = 0; x < size.x; x++) {
+			points[y * size.x + x] = Point(Vector2i(x, y), offset + Vector2(x, y) * cell_size);
+		}
+	}
+	end = nullptr;
+	dirty = false;
+
+	clusters.clear();
+	if (hierarchy_cluster_size > 0) {
+		cluster_count = Vector2i((size.x + hierarchy_cluster_size - 1) / hierarchy_cluster_size, (size.y + hierarchy_cluster_size - 1) / hierarchy_cluster_size);
+		clusters.resize(cluster_count.x * cluster_count.y);
+	} else {
+		cluster_count = Vector2i();
+	}
+	hierarchy_dirty = true;
+}
+
+bool AStarGrid2D::is_in_bounds(int p_x, int p_y) const {
+	return p_x >= 0 && p_x < size.x && p_y >= 0 && p_y < size.y;
+}
+
+bool AStarGrid2D::is_in_boundsv(const Vector2i &p_id) const {
+	return p_id.x >= 0 && p_id.x < size.x && p_id.y >= 0 && p_id.y < size.y;
+}
+
+bool AStarGrid2D::is_dirty() const {
+	return dirty;
+}
+
+void AStarGrid2D::set_jumping_enabled(bool p_enabled) {
+	jumping_enabled = p_enabled;
+}
+
+bool AStarGrid2D::is_jumping_enabled() const {
+	return jumping_enabled;
+}
+
+void AStarGrid2D::set_diagonal_mode(DiagonalMode p_diagonal_mode) {
+	ERR_FAIL_INDEX((int)p_diagonal_mode, (int)DIAGONAL_MODE_MAX);
+	if (diagonal_mode == p_diagonal_mode) {
+		return;
+	}
+	diagonal_mode = p_diagonal_mode;
+	// Connectivity changes everywhere.
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		clusters[i].dirty = true;
+	}
+	hierarchy_dirty = true;
+}
+
+AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
+	return diagonal_mode;
+}
+
+void AStarGrid2D::set_default_heuristic(Heuristic p_heuristic) {
+	ERR_FAIL_INDEX((int)p_heuristic, (int)HEURISTIC_MAX);
+	default_heuristic = p_heuristic;
+}
+
+AStarGrid2D::Heuristic AStarGrid2D::get_default_heuristic() const {
+	return default_heuristic;
+}
+
+void AStarGrid2D::set_hierarchy_cluster_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 0 || p_size > 256, "Hierarchy cluster size must be between 0 (disabled) and 256.");
+	if (p_size == hierarchy_cluster_size) {
+		return;
+	}
+	hierarchy_cluster_size = p_size;
+	clusters.clear();
+	cluster_count = Vector2i();
+	if (!dirty && hierarchy_cluster_size > 0) {
+		cluster_count = Vector2i((size.x + hierarchy_cluster_size - 1) / hierarchy_cluster_size, (size.y + hierarchy_cluster_size - 1) / hierarchy_cluster_size);
+		clusters.resize(cluster_count.x * cluster_count.y);
+	}
+	hierarchy_dirty = true;
+}
+
+int AStarGrid2D::get_hierarchy_cluster_size() const {
+	return hierarchy_cluster_size;
+}
+
+void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
+	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point out of bounds (%s/%s, %s/%s).", p_id.x, size.x, p_id.y, size.y));
+	Point &p = points[p_id.y * size.x + p_id.x];
+	if (p.solid == p_solid) {
+		return;
+	}
+	p.solid = p_solid;
+
+	if (hierarchy_cluster_size > 0) {
+		// Diagonal moves depend on the cells around them, so the clusters of all
+		// the neighbors need to be rebuilt as well.
+		for (int64_t y = MAX(p_id.y - 1, 0); y <= MIN(p_id.y + 1, size.y - 1); y++) {
+			for (int64_t x = MAX(p_id.x - 1, 0); x <= MIN(p_id.x + 1, size.x - 1); x++) {
+				clusters[_get_cluster_index(x, y)].dirty = true;
+			}
+		}
+		hierarchy_dirty = true;
+	}
+}
+
+bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
+	ERR_FAIL_COND_V_MSG(dirty, false, "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), false, vformat("Can't get if point is disabled. Point out of bounds (%s/%s, %s/%s).", p_id.x, size.x, p_id.y, size.y));
+	return points[p_id.y * size.x + p_id.x].solid;
+}
+
+void AStarGrid2D::_build_cluster_regions(uint32_t p_cluster) {
+	Cluster &cluster = clusters[p_cluster];
+	cluster.regions.clear();
+	cluster.dirty = false;
+
+	const int64_t from_x = (p_cluster % cluster_count.x) * hierarchy_cluster_size;
+	const int64_t from_y = (p_cluster / cluster_count.x) * hierarchy_cluster_size;
+	const int64_t to_x = MIN(from_x + hierarchy_cluster_size, (int64_t)size.x);
+	const int64_t to_y = MIN(from_y + hierarchy_cluster_size, (int64_t)size.y);
+	const int64_t width = to_x - from_x;
+
+	LocalVector<bool> visited;
+	visited.resize(width * (to_y - from_y));
+	for (uint32_t i = 0; i < visited.size(); i++) {
+		visited[i] = false;
+	}
+
+	LocalVector<Point *> stack;
+	LocalVector<Point *> nbors;
+	for (int64_t y = from_y; y < to_y; y++) {
+		for (int64_t x = from_x; x < to_x; x++) {
+			if (visited[(y - from_y) * width + (x - from_x)] || !_is_open(x, y)) {
+				continue;
+			}
+
+			const uint16_t region = cluster.regions.size();
+			cluster.regions.push_back(Region());
+
+			Vector2 sum;
+			uint32_t count = 0;
+
+			visited[(y - from_y) * width + (x - from_x)] = true;
+			stack.push_back(_get_point(x, y));
+			while (!stack.is_empty()) {
+				Point *p = stack[stack.size() - 1];
+				stack.remove_at(stack.size() - 1);
+				p->region = region;
+				sum += Vector2(p->id);
+				count++;
+
+				nbors.clear();
+				_get_nbors(p, nbors);
+				for (uint32_t i = 0; i < nbors.size(); i++) {
+					const Vector2i &id = nbors[i]->id;
+					if (id.x < from_x || id.y < from_y || id.x >= to_x || id.y >= to_y) {
+						continue;
+					}
+					bool &v = visited[(id.y - from_y) * width + (id.x - from_x)];
+					if (!v) {
+						v = true;
+						stack.push_back(nbors[i]);
+					}
+				}
+			}
+
+			cluster.regions[region].centroid = sum / count;
+		}
+	}
+}
+
+void AStarGrid2D::_link_cluster(uint32_t p_cluster) {
+	const int64_t from_x = (p_cluster % cluster_count.x) * hierarchy_cluster_size;
+	const int64_t from_y = (p_cluster / cluster_count.x) * hierarchy_cluster_size;
+	const int64_t to_x = MIN(from_x + hierarchy_cluster_size, (int64_t)size.x);
+	const int64_t to_y = MIN(from_y + hierarchy_cluster_size, (int64_t)size.y);
+
+	LocalVector<Point *> nbors;
+	for (int64_t y = from_y; y < to_y; y++) {
+		for (int64_t x = from_x; x < to_x; x++) {
+			// Only the cells on the border can reach other clusters.
+			if (y != from_y && y != to_y - 1 && x != from_x && x != to_x - 1) {
+				x = to_x - 2;
+				continue;
+			}
+			if (!_is_open(x, y)) {
+				continue;
+			}
+
+			Point *p = &points[y * size.x + x];
+			const uint64_t key = _region_key(p_cluster, p->region);
+
+			nbors.clear();
+			_get_nbors(p, nbors);
+			for (uint32_t i = 0; i < nbors.size(); i++) {
+				const uint32_t other_cluster = _get_cluster_index(nbors[i]->id.x, nbors[i]->id.y);
+				if (other_cluster == p_cluster) {
+					continue;
+				}
+				const uint64_t other_key = _region_key(other_cluster, nbors[i]->region);
+
+				Region &region = _get_region(key);
+				if (region.links.find(other_key) == -1) {
+					region.links.push_back(other_key);
+				}
+				Region &other_region = _get_region(other_key);
+				if (other_region.links.find(key) == -1) {
+					other_region.links.push_back(key);
+				}
+			}
+		}
+	}
+}
+
+void AStarGrid2D::_update_hierarchy() {
+	if (!hierarchy_dirty || hierarchy_cluster_size == 0) {
+		return;
+	}
+	hierarchy_dirty = false;
+
+	LocalVector<uint32_t> rebuilt;
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		if (clusters[i].dirty) {
+			_build_cluster_regions(i);
+			rebuilt.push_back(i);
+		}
+	}
+
+	// Links from untouched clusters into rebuilt ones refer to regions that may no longer exist.
+	for (uint32_t i = 0; i < rebuilt.size(); i++) {
+		const int64_t cx = rebuilt[i] % cluster_count.x;
+		const int64_t cy = rebuilt[i] / cluster_count.x;
+		for (int64_t y = MAX(cy - 1, 0); y <= MIN(cy + 1, cluster_count.y - 1); y++) {
+			for (int64_t x = MAX(cx - 1, 0); x <= MIN(cx + 1, cluster_count.x - 1); x++) {
+				Cluster &cluster = clusters[y * cluster_count.x + x];
+				for (uint32_t j = 0; j < cluster.regions.size(); j++) {
+					LocalVector<uint64_t> &links = cluster.regions[j].links;
+					for (uint32_t k = 0; k < links.size();) {
+						if ((links[k] >> 32) == rebuilt[i]) {
+							links.remove_at_unordered(k);
+						} else {
+							k++;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < rebuilt.size(); i++) {
+		_link_cluster(rebuilt[i]);
+	}
+
+	// Connected components, so unreachable queries can be rejected right away.
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		for (uint32_t j = 0; j < clusters[i].regions.size(); j++) {
+			clusters[i].regions[j].component = 0;
+		}
+	}
+	uint32_t component = 0;
+	LocalVector<uint64_t> stack;
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		for (uint32_t j = 0; j < clusters[i].regions.size(); j++) {
+			if (clusters[i].regions[j].component != 0) {
+				continue;
+			}
+			component++;
+			clusters[i].regions[j].component = component;
+			stack.push_back(_region_key(i, j));
+			while (!stack.is_empty()) {
+				const Region &region = _get_region(stack[stack.size() - 1]);
+				stack.remove_at(stack.size() - 1);
+				for (uint32_t k = 0; k < region.links.size(); k++) {
+					Region &other = _get_region(region.links[k]);
+					if (other.component == 0) {
+						other.component = component;
+						stack.push_back(region.links[k]);
+					}
+				}
+			}
+		}
+	}
+}
+
+bool AStarGrid2D::_find_corridor(Point *p_begin_point, Point *p_end_point) {
+	hierarchy_pass++;
+
+	const uint64_t begin_key = _get_point_region_key(p_begin_point);
+	const uint64_t end_key = _get_point_region_key(p_end_point);
+	Region *begin_region = &_get_region(begin_key);
+	Region *end_region = &_get_region(end_key);
+	if (begin_region->component != end_region->component) {
+		return false;
+	}
+
+	LocalVector<uint64_t> open_list;
+	struct SortRegions {
+		AStarGrid2D *grid = nullptr;
+		_FORCE_INLINE_ bool operator()(uint64_t A, uint64_t B) const {
+			const Region &a = grid->_get_region(A);
+			const Region &b = grid->_get_region(B);
+			if (a.f_score > b.f_score) {
+				return true;
+			} else if (a.f_score < b.f_score) {
+				return false;
+			} else {
+				return a.g_score < b.g_score;
+			}
+		}
+	};
+	SortArray<uint64_t, SortRegions> sorter;
+	sorter.compare.grid = this;
+
+	begin_region->g_score = 0;
+	begin_region->f_score = begin_region->centroid.distance_to(end_region->centroid);
+	begin_region->open_pass = hierarchy_pass;
+	begin_region->prev_key = begin_key;
+	open_list.push_back(begin_key);
+
+	bool found_route = false;
+	while (!open_list.is_empty()) {
+		const uint64_t key = open_list[0];
+		if (key == end_key) {
+			found_route = true;
+			break;
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+		Region &region = _get_region(key);
+		region.closed_pass = hierarchy_pass;
+
+		for (uint32_t i = 0; i < region.links.size(); i++) {
+			Region &e = _get_region(region.links[i]);
+			if (e.closed_pass == hierarchy_pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = region.g_score + region.centroid.distance_to(e.centroid);
+
+			bool new_region = false;
+			if (e.open_pass != hierarchy_pass) {
+				e.open_pass = hierarchy_pass;
+				open_list.push_back(region.links[i]);
+				new_region = true;
+			} else if (tentative_g_score >= e.g_score) {
+				continue;
+			}
+
+			e.prev_key = key;
+			e.g_score = tentative_g_score;
+			e.f_score = e.g_score + e.centroid.distance_to(end_region->centroid);
+
+			if (new_region) {
+				sorter.push_heap(0, open_list.size() - 1, 0, region.links[i], open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(region.links[i]), 0, region.links[i], open_list.ptr());
+			}
+		}
+	}
+
+	if (!found_route) {
+		return false;
+	}
+
+	// Mark the regions along the abstract path, and the regions around them so the
+	// low level search has some room to smooth out the path.
+	corridor_pass = hierarchy_pass;
+	uint64_t key = end_key;
+	while (true) {
+		Region &region = _get_region(key);
+		region.corridor_pass = corridor_pass;
+		for (uint32_t i = 0; i < region.links.size(); i++) {
+			_get_region(region.links[i]).corridor_pass = corridor_pass;
+		}
+		if (key == begin_key) {
+			break;
+		}
+		key = region.prev_key;
+	}
+	return true;
+}
+
+void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
+	const int64_t x = p_point->id.x;
+	const int64_t y = p_point->id.y;
+
+	static const int64_t dirs[8][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 }, { 1, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 } };
+	const int dir_count = diagonal_mode == DIAGONAL_MODE_NEVER ? 4 : 8;
+	for (int i = 0; i < dir_count; i++) {
+		const int64_t dx = dirs[i][0];
+		const int64_t dy = dirs[i][1];
+		if (!_is_walkable(x + dx, y + dy)) {
+			continue;
+		}
+		if (dx != 0 && dy != 0 && !_can_move_diagonally(x, y, dx, dy)) {
+			continue;
+		}
+		r_nbors.push_back(&points[(y + dy) * size.x + (x + dx)]);
+	}
+}
+
+bool AStarGrid2D::_is_straight_jump_point(int64_t p_x, int64_t p_y, int64_t p_dx, int64_t p_dy) {
+	if (&points[p_y * size.x + p_x] == end) {
+		return true;
+	}
+	// Any change in the cells along the sides, or a dead end, opens up moves
+	// the neighboring cells on the line don't have, so the cell has to be expanded.
+	const int64_t sx = p_dy;
+	const int64_t sy = p_dx;
+	const int side_a = _get_cell_state(p_x + sx, p_y + sy);
+	const int side_b = _get_cell_state(p_x - sx, p_y - sy);
+	return side_a != _get_cell_state(p_x - p_dx + sx, p_y - p_dy + sy) || side_b != _get_cell_state(p_x - p_dx - sx, p_y - p_dy - sy) ||
+			side_a != _get_cell_state(p_x + p_dx + sx, p_y + p_dy + sy) || side_b != _get_cell_state(p_x + p_dx - sx, p_y + p_dy - sy) ||
+			!_is_walkable(p_x + p_dx, p_y + p_dy);
+}
+
+AStarGrid2D::Point *AStarGrid2D::_jump_straight(int64_t p_x, int64_t p_y, int64_t p_dx, int64_t p_dy) {
+	int64_t x = p_x + p_dx;
+	int64_t y = p_y + p_dy;
+	while (_is_walkable(x, y)) {
+		if (_is_straight_jump_point(x, y, p_dx, p_dy)) {
+			return &points[y * size.x + x];
+		}
+		x += p_dx;
+		y += p_dy;
+	}
+	return nullptr;
+}
+
+AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
+	const int64_t dx = p_to->id.x - p_from->id.x;
+	const int64_t dy = p_to->id.y - p_from->id.y;
+
+	if (dy == 0 || (dx == 0 && diagonal_mode != DIAGONAL_MODE_NEVER)) {
+		return _jump_straight(p_from->id.x, p_from->id.y, dx, dy);
+	}
+
+	// The first cell, and the move to it, have already been checked by the caller.
+	int64_t x = p_to->id.x;
+	int64_t y = p_to->id.y;
+
+	if (dx == 0) {
+		// Without diagonal moves, turns take the place of diagonals: vertical jumps have to
+		// look for jump points on both sides at each step.
+		while (_is_walkable(x, y)) {
+			if (_is_straight_jump_point(x, y, 0, dy) || _jump_straight(x, y, 1, 0) || _jump_straight(x, y, -1, 0)) {
+				return &points[y * size.x + x];
+			}
+			y += dy;
+		}
+		return nullptr;
+	}
+
+	while (true) {
+		Point *p = &points[y * size.x + x];
+		if (p == end) {
+			return p;
+		}
+		// Cells behind the diagonal that can't be reached through the previous cell.
+		if (!_is_walkable(x - dx, y) || !_is_walkable(x, y - dy)) {
+			return p;
+		}
+		if (_jump_straight(x, y, dx, 0) || _jump_straight(x, y, 0, dy)) {
+			return p;
+		}
+		if (!_is_walkable(x + dx, y + dy) || !_can_move_diagonally(x, y, dx, dy)) {
+			return nullptr;
+		}
+		x += dx;
+		y += dy;
+	}
+}
+
+bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
+	pass++;
+
+	if (p_end_point->solid) {
+		return false;
+	}
+
+	end = p_end_point;
+	bool found_route = false;
+
+	LocalVector<Point *> open_list;
+	LocalVector<Point *> nbors;
+	SortArray<Point *, SortPoints> sorter;
+
+	p_begin_point->g_score = 0;
+	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
+	open_list.push_back(p_begin_point);
+
+	while (!open_list.is_empty()) {
+		Point *p = open_list[0]; // The currently processed point.
+
+		if (p == p_end_point) {
+			found_route = true;
+			break;
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+		p->closed_pass = pass; // Mark the point as closed.
+
+		nbors.clear();
+		_get_nbors(p, nbors);
+		for (uint32_t i = 0; i < nbors.size(); i++) {
+			Point *e = nbors[i]; // The neighbour point.
+			if (jumping_enabled) {
+				e = _jump(p, e);
+				if (!e) {
+					continue;
+				}
+			}
+
+			if (e->closed_pass == pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id);
+
+			bool new_point = false;
+
+			if (e->open_pass != pass) { // The point wasn't inside the open list.
+				e->open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = e->g_score + _estimate_cost(e->id, p_end_point->id);
+
+			if (new_point) { // The position of the new points is already known.
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			}
+		}
+	}
+
+	end = nullptr;
+	return found_route;
+}
+
+real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_to_id) {
+	real_t scost;
+	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_to_id, scost)) {
+		return scost;
+	}
+	return heuristics[default_heuristic](p_from_id, p_to_id);
+}
+
+real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_to_id) {
+	real_t scost;
+	if (GDVIRTUAL_CALL(_compute_cost, p_from_id, p_to_id, scost)) {
+		return scost;
+	}
+	return heuristics[default_heuristic](p_from_id, p_to_id);
+}
+
+void AStarGrid2D::clear() {
+	points.clear();
+	clusters.clear();
+	size = Vector2i();
+	cluster_count = Vector2i();
+	hierarchy_dirty = true;
+}
+
+void AStarGrid2D::_get_path(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path) {
+	if (p_begin_point == p_end_point) {
+		r_path.push_back(p_begin_point);
+		return;
+	}
+
+	bool found_route = false;
+	if (hierarchy_cluster_size > 0 && !p_begin_point->solid && !p_end_point->solid) {
+		_update_hierarchy();
+		if (!_find_corridor(p_begin_point, p_end_point)) {
+			return; // Not connected.
+		}
+		found_route = _solve(p_begin_point, p_end_point);
+		corridor_pass = 0;
+	}
+	if (!found_route && !_solve(p_begin_point, p_end_point)) {
+		return;
+	}
+
+	// Jump points are joined by straight or diagonal lines, fill in the cells in between.
+	Point *p = p_end_point;
+	while (p != p_begin_point) {
+		Point *prev = p->prev_point;
+		const int64_t dx = SIGN(prev->id.x - p->id.x);
+		const int64_t dy = SIGN(prev->id.y - p->id.y);
+		Vector2i id = p->id;
+		while (id != prev->id) {
+			r_path.push_back(_get_point(id.x, id.y));
+			id.x += dx;
+			id.y += dy;
+		}
+		p = prev;
+	}
+	r_path.push_back(p_begin_point);
+	r_path.invert();
+}
+
+Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id) {
+	ERR_FAIL_COND_V_MSG(dirty, Vector<Vector2>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector<Vector2>(), vformat("Can't get point path. Point out of bounds (%s/%s, %s/%s)", p_from_id.x, size.x, p_from_id.y, size.y));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector<Vector2>(), vformat("Can't get point path. Point out of bounds (%s/%s, %s/%s)", p_to_id.x, size.x, p_to_id.y, size.y));
+
+	LocalVector<Point *> path;
+	_get_path(_get_point(p_from_id.x, p_from_id.y), _get_point(p_to_id.x, p_to_id.y), path);
+
+	Vector<Vector2> ret;
+	ret.resize(path.size());
+	Vector2 *w = ret.ptrw();
+	for (uint32_t i = 0; i < path.size(); i++) {
+		w[i] = path[i]->pos;
+	}
+	return ret;
+}
+
+TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const Vector2i &p_to_id) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<Vector2i>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point out of bounds (%s/%s, %s/%s)", p_from_id.x, size.x, p_from_id.y, size.y));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point out of bounds (%s/%s, %s/%s)", p_to_id.x, size.x, p_to_id.y, size.y));
+
+	LocalVector<Point *> path;
+	_get_path(_get_point(p_from_id.x, p_from_id.y), _get_point(p_to_id.x, p_to_id.y), path);
+
+	TypedArray<Vector2i> ret;
+	ret.resize(path.size());
+	for (uint32_t i = 0; i < path.size(); i++) {
+		ret[i] = path[i]->id;
+	}
+	return ret;
+}
+
+void AStarGrid2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_size", "size"), &AStarGrid2D::set_size);
+	ClassDB::bind_method(D_METHOD("get_size"), &AStarGrid2D::get_size);
+	ClassDB::bind_method(D_METHOD("set_offset", "offset"), &AStarGrid2D::set_offset);
+	ClassDB::bind_method(D_METHOD("get_offset"), &AStarGrid2D::get_offset);
+	ClassDB::bind_method(D_METHOD("set_cell_size", "cell_size"), &AStarGrid2D::set_cell_size);
+	ClassDB::bind_method(D_METHOD("get_cell_size"), &AStarGrid2D::get_cell_size);
+	ClassDB::bind_method(D_METHOD("is_in_bounds", "x", "y"), &AStarGrid2D::is_in_bounds);
+	ClassDB::bind_method(D_METHOD("is_in_boundsv", "id"), &AStarGrid2D::is_in_boundsv);
+	ClassDB::bind_method(D_METHOD("is_dirty"), &AStarGrid2D::is_dirty);
+	ClassDB::bind_method(D_METHOD("update"), &AStarGrid2D::update);
+	ClassDB::bind_method(D_METHOD("set_jumping_enabled", "enabled"), &AStarGrid2D::set_jumping_enabled);
+	ClassDB::bind_method(D_METHOD("is_jumping_enabled"), &AStarGrid2D::is_jumping_enabled);
+	ClassDB::bind_method(D_METHOD("set_diagonal_mode", "mode"), &AStarGrid2D::set_diagonal_mode);
+	ClassDB::bind_method(D_METHOD("get_diagonal_mode"), &AStarGrid2D::get_diagonal_mode);
+	ClassDB::bind_method(D_METHOD("set_default_heuristic", "heuristic"), &AStarGrid2D::set_default_heuristic);
+	ClassDB::bind_method(D_METHOD("get_default_heuristic"), &AStarGrid2D::get_default_heuristic);
+	ClassDB::bind_method(D_METHOD("set_hierarchy_cluster_size", "size"), &AStarGrid2D::set_hierarchy_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_hierarchy_cluster_size"), &AStarGrid2D::get_hierarchy_cluster_size);
+	ClassDB::bind_method(D_METHOD("set_point_solid", "id", "solid"), &AStarGrid2D::set_point_solid, DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("is_point_solid", "id"), &AStarGrid2D::is_point_solid);
+	ClassDB::bind_method(D_METHOD("clear"), &AStarGrid2D::clear);
+
+	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStarGrid2D::get_point_path);
+	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStarGrid2D::get_id_path);
+
+	GDVIRTUAL_BIND(_estimate_cost, "from_id", "to_id")
+	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
+
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2I, "size"), "set_size", "get_size");
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "offset"), "set_offset", "get_offset");
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "cell_size"), "set_cell_size", "get_cell_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "jumping_enabled"), "set_jumping_enabled", "is_jumping_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_heuristic", PROPERTY_HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_heuristic", "get_default_heuristic");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "diagonal_mode", PROPERTY_HINT_ENUM, "Always,Never,At Least One Walkable,Only If No Obstacles"), "set_diagonal_mode", "get_diagonal_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "hierarchy_cluster_size", PROPERTY_HINT_RANGE, "0,256,1"), "set_hierarchy_cluster_size", "get_hierarchy_cluster_size");
+
+	BIND_ENUM_CONSTANT(HEURISTIC_EUCLIDEAN);
+	BIND_ENUM_CONSTANT(HEURISTIC_MANHATTAN);
+	BIND_ENUM_CONSTANT(HEURISTIC_OCTILE);
+	BIND_ENUM_CONSTANT(HEURISTIC_CHEBYSHEV);
+	BIND_ENUM_CONSTANT(HEURISTIC_MAX);
+
+	BIND_ENUM_CONSTANT(DIAGONAL_MODE_ALWAYS);
+	BIND_ENUM_CONSTANT(DIAGONAL_MODE_NEVER);
+	BIND_ENUM_CONSTANT(DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE);
+	BIND_ENUM_CONSTANT(DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES);
+	BIND_ENUM_CONSTANT(DIAGONAL_MODE_MAX);
+}
@@ -0,0 +1,254 @@
+/*************************************************************************/
+/*  a_star_grid_2d.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef A_STAR_GRID_2D_H
+#define A_STAR_GRID_2D_H
+
+#include "core/object/gdvirtual.gen.inc"
+#include "core/object/ref_counted.h"
+#include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/typed_array.h"
+
+/**
+	A* pathfinding on a uniform 2D grid. Optionally uses jump point search,
+	and a cached graph of connected regions per cluster of cells to skip
+	unreachable queries and narrow down the search to a corridor.
+*/
+
+class AStarGrid2D : public RefCounted {
+	GDCLASS(AStarGrid2D, RefCounted);
+
+public:
+	enum DiagonalMode {
+		DIAGONAL_MODE_ALWAYS,
+		DIAGONAL_MODE_NEVER,
+		DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE,
+		DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES,
+		DIAGONAL_MODE_MAX,
+	};
+
+	enum Heuristic {
+		HEURISTIC_EUCLIDEAN,
+		HEURISTIC_MANHATTAN,
+		HEURISTIC_OCTILE,
+		HEURISTIC_CHEBYSHEV,
+		HEURISTIC_MAX,
+	};
+
+private:
+	Vector2i size;
+	Vector2 offset;
+	Vector2 cell_size = Vector2(1, 1);
+	bool dirty = false;
+
+	bool jumping_enabled = false;
+	DiagonalMode diagonal_mode = DIAGONAL_MODE_ALWAYS;
+	Heuristic default_heuristic = HEURISTIC_EUCLIDEAN;
+
+	struct Point {
+		Vector2i id;
+		Vector2 pos;
+		bool solid = false;
+		uint16_t region = 0; // Within its cluster, when the hierarchy is enabled.
+
+		// Used for pathfinding.
+		Point *prev_point = nullptr;
+		real_t g_score = 0;
+		real_t f_score = 0;
+		uint64_t open_pass = 0;
+		uint64_t closed_pass = 0;
+
+		Point() {}
+		Point(const Vector2i &p_id, const Vector2 &p_pos) :
+				id(p_id), pos(p_pos) {}
+	};
+
+	struct SortPoints {
+		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
+			if (A->f_score > B->f_score) {
+				return true;
+			} else if (A->f_score < B->f_score) {
+				return false;
+			} else {
+				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+			}
+		}
+	};
+
+	LocalVector<Point> points; // Row major, size.x * size.y.
+	Point *end = nullptr;
+	uint64_t pass = 1;
+
+	// Hierarchy: the grid is split into square clusters, and each cluster into regions of
+	// cells connected within it. Regions are linked to the regions they touch in neighboring
+	// clusters, which gives a small graph used to reject unreachable queries in constant time
+	// and to restrict searches to a corridor of regions. Clusters are rebuilt lazily when
+	// cells around them change.
+	struct Region {
+		Vector2 centroid;
+		uint32_t component = 0; // Connected component over the whole grid.
+		LocalVector<uint64_t> links; // Keys of linked regions, see _region_key().
+
+		// Used for pathfinding.
+		uint64_t prev_key = 0;
+		real_t g_score = 0;
+		real_t f_score = 0;
+		uint64_t open_pass = 0;
+		uint64_t closed_pass = 0;
+		uint64_t corridor_pass = 0;
+	};
+
+	struct Cluster {
+		bool dirty = true;
+		LocalVector<Region> regions;
+	};
+
+	int hierarchy_cluster_size = 0;
+	Vector2i cluster_count;
+	LocalVector<Cluster> clusters;
+	bool hierarchy_dirty = true;
+	uint64_t hierarchy_pass = 1;
+	uint64_t corridor_pass = 0; // Only regions marked with this pass are walkable, if not zero.
+
+	_FORCE_INLINE_ Point *_get_point(int64_t p_x, int64_t p_y) {
+		if (p_x < 0 || p_y < 0 || p_x >= size.x || p_y >= size.y) {
+			return nullptr;
+		}
+		return &points[p_y * size.x + p_x];
+	}
+	_FORCE_INLINE_ bool _is_open(int64_t p_x, int64_t p_y) const {
+		return p_x >= 0 && p_y >= 0 && p_x < size.x && p_y < size.y && !points[p_y * size.x + p_x].solid;
+	}
+	_FORCE_INLINE_ uint32_t _get_cluster_index(int64_t p_x, int64_t p_y) const {
+		return (p_y / hierarchy_cluster_size) * cluster_count.x + (p_x / hierarchy_cluster_size);
+	}
+	_FORCE_INLINE_ static uint64_t _region_key(uint32_t p_cluster, uint32_t p_region) {
+		return (uint64_t(p_cluster) << 32) | p_region;
+	}
+	_FORCE_INLINE_ Region &_get_region(uint64_t p_key) {
+		return clusters[p_key >> 32].regions[p_key & 0xFFFFFFFF];
+	}
+	_FORCE_INLINE_ uint64_t _get_point_region_key(const Point *p_point) const {
+		return _region_key(_get_cluster_index(p_point->id.x, p_point->id.y), p_point->region);
+	}
+
+	// Whether a search may step on the cell, taking the corridor into account.
+	_FORCE_INLINE_ bool _is_walkable(int64_t p_x, int64_t p_y) {
+		if (!_is_open(p_x, p_y)) {
+			return false;
+		}
+		if (corridor_pass) {
+			const Point &p = points[p_y * size.x + p_x];
+			return clusters[_get_cluster_index(p_x, p_y)].regions[p.region].corridor_pass == corridor_pass;
+		}
+		return true;
+	}
+	// 0 for solid or out of bounds, 1 for open but outside of the corridor, 2 for walkable.
+	_FORCE_INLINE_ int _get_cell_state(int64_t p_x, int64_t p_y) {
+		return _is_open(p_x, p_y) ? (_is_walkable(p_x, p_y) ? 2 : 1) : 0;
+	}
+	// Whether moving diagonally from the cell is allowed, assuming the target cell is walkable.
+	_FORCE_INLINE_ bool _can_move_diagonally(int64_t p_x, int64_t p_y, int64_t p_dx, int64_t p_dy) const {
+		switch (diagonal_mode) {
+			case DIAGONAL_MODE_ALWAYS:
+				return true;
+			case DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE:
+				return _is_open(p_x + p_dx, p_y) || _is_open(p_x, p_y + p_dy);
+			case DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES:
+				return _is_open(p_x + p_dx, p_y) && _is_open(p_x, p_y + p_dy);
+			default:
+				return false;
+		}
+	}
+
+	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
+	bool _is_straight_jump_point(int64_t p_x, int64_t p_y, int64_t p_dx, int64_t p_dy);
+	Point *_jump_straight(int64_t p_x, int64_t p_y, int64_t p_dx, int64_t p_dy);
+	Point *_jump(Point *p_from, Point *p_to);
+	bool _solve(Point *p_begin_point, Point *p_end_point);
+
+	void _build_cluster_regions(uint32_t p_cluster);
+	void _link_cluster(uint32_t p_cluster);
+	void _update_hierarchy();
+	bool _find_corridor(Point *p_begin_point, Point *p_end_point);
+
+	void _get_path(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path);
+
+protected:
+	static void _bind_methods();
+
+	virtual real_t _estimate_cost(const Vector2i &p_from_id, const Vector2i &p_to_id);
+	virtual real_t _compute_cost(const Vector2i &p_from_id, const Vector2i &p_to_id);
+
+	GDVIRTUAL2RC(real_t, _estimate_cost, Vector2i, Vector2i)
+	GDVIRTUAL2RC(real_t, _compute_cost, Vector2i, Vector2i)
+
+public:
+	void set_size(const Vector2i &p_size);
+	Vector2i get_size() const;
+
+	void set_offset(const Vector2 &p_offset);
+	Vector2 get_offset() const;
+
+	void set_cell_size(const Vector2 &p_cell_size);
+	Vector2 get_cell_size() const;
+
+	void update();
+
+	bool is_in_bounds(int p_x, int p_y) const;
+	bool is_in_boundsv(const Vector2i &p_id) const;
+	bool is_dirty() const;
+
+	void set_jumping_enabled(bool p_enabled);
+	bool is_jumping_enabled() const;
+
+	void set_diagonal_mode(DiagonalMode p_diagonal_mode);
+	DiagonalMode get_diagonal_mode() const;
+
+	void set_default_heuristic(Heuristic p_heuristic);
+	Heuristic get_default_heuristic() const;
+
+	void set_hierarchy_cluster_size(int p_size);
+	int get_hierarchy_cluster_size() const;
+
+	void set_point_solid(const Vector2i &p_id, bool p_solid = true);
+	bool is_point_solid(const Vector2i &p_id) const;
+
+	void clear();
+
+	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to);
+	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to);
+};
+
+VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
+VARIANT_ENUM_CAST(AStarGrid2D::Heuristic);
+
+#endif // A_STAR_GRID_2D_H
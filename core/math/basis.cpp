@@ -31,6 +31,7 @@
 #include "basis.h"
 
 #include "core/math/math_funcs.h"
+#include "core/math/transform_3d.h"
 #include "core/string/print_string.h"
 
 #define cofac(row1, col1, row2, col2) \
@@ -1109,3 +1110,7 @@ Basis Basis::looking_at(const Vector3 &p_target, const Vector3 &p_up) {
 	basis.set_columns(v_x, v_y, v_z);
 	return basis;
 }
+
+void Basis::xform_array(const Vector3 *p_in, Vector3 *p_out, int p_count) const {
+	Transform3D(*this).xform_array(p_in, p_out, p_count);
+}
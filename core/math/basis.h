@@ -140,6 +140,8 @@ struct _NO_DISCARD_ Basis {
 
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ Vector3 xform_inv(const Vector3 &p_vector) const;
+	// Batched version for large arrays, p_in and p_out may point to the same array.
+	void xform_array(const Vector3 *p_in, Vector3 *p_out, int p_count) const;
 	_FORCE_INLINE_ void operator*=(const Basis &p_matrix);
 	_FORCE_INLINE_ Basis operator*(const Basis &p_matrix) const;
 	_FORCE_INLINE_ void operator+=(const Basis &p_matrix);
@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -88,6 +89,13 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// When at least this many items have changed since the last update, the tree
+	// is searched for their new pairs on worker threads. 0 to always search serially.
+	void params_set_pair_thread_threshold(uint32_t p_threshold) {
+		BVH_LOCKED_FUNCTION
+		_pair_thread_threshold = p_threshold;
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -381,6 +389,44 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Same as cull_aabb and cull_segment, but the hits are gathered in r_hits instead of the shared list and the BVH isn't locked,
+	// so several threads can cull at once, as long as the tree isn't modified meanwhile.
+	int cull_aabb_concurrent(const BOUNDS &p_aabb, T **p_result_array, int p_result_max, const T *p_tester, LocalVector<uint32_t, uint32_t, true> &r_hits, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.abb.from(p_aabb);
+		params.tester = p_tester;
+		params.hits = &r_hits;
+
+		tree.cull_aabb(params);
+
+		return params.result_count_overall;
+	}
+
+	int cull_segment_concurrent(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, const T *p_tester, LocalVector<uint32_t, uint32_t, true> &r_hits, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.hits = &r_hits;
+
+		params.segment.from = p_from;
+		params.segment.to = p_to;
+
+		tree.cull_segment(params);
+
+		return params.result_count_overall;
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -444,6 +490,18 @@ private:
 		params.result_array = nullptr;
 		params.subindex_array = nullptr;
 
+		// The tree isn't modified while pairing, so the candidates of every changed item
+		// can be culled in parallel. The pair callbacks are still sent from this thread,
+		// in the same order as the serial path, so the results don't depend on threading.
+		bool threaded = USE_PAIRS && !p_full_check && _pair_thread_threshold && changed_items.size() >= _pair_thread_threshold;
+		if (threaded) {
+			if (_collision_candidates.size() < changed_items.size()) {
+				_collision_candidates.resize(changed_items.size());
+			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_gather_collision_candidates, (void *)nullptr, changed_items.size(), -1, true, SNAME("BVHPairCandidates"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+
 		for (unsigned int n = 0; n < changed_items.size(); n++) {
 			const BVHHandle &h = changed_items[n];
 
@@ -460,13 +518,18 @@ private:
 
 			uint32_t changed_item_ref_id = h.id();
 
-			params.abb = abb;
+			const LocalVector<uint32_t, uint32_t, true> *hits = &tree._cull_hits;
+			if (threaded) {
+				hits = &_collision_candidates[n];
+			} else {
+				params.abb = abb;
 
-			params.result_count_overall = 0; // might not be needed
-			tree.cull_aabb(params, false);
+				params.result_count_overall = 0; // might not be needed
+				tree.cull_aabb(params, false);
+			}
 
-			for (unsigned int i = 0; i < tree._cull_hits.size(); i++) {
-				uint32_t ref_id = tree._cull_hits[i];
+			for (unsigned int i = 0; i < hits->size(); i++) {
+				uint32_t ref_id = (*hits)[i];
 
 				// don't collide against ourself
 				if (ref_id == changed_item_ref_id) {
@@ -484,6 +547,22 @@ private:
 		_reset();
 	}
 
+	void _gather_collision_candidates(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &_collision_candidates[p_index];
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		tree.cull_aabb(params, false);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -777,6 +856,10 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// per changed item hits when pairing on worker threads, kept to avoid reallocating
+	LocalVector<LocalVector<uint32_t, uint32_t, true>> _collision_candidates;
+	uint32_t _pair_thread_threshold = 0;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
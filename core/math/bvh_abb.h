@@ -285,4 +285,81 @@ struct BVH_ABB {
 	}
 };
 
+// Four wide tests of leaf bounds, used by the leaf loops in the cull functions of 3D trees.
+// Leaves keep their bounds in an array, so groups of 4 consecutive BVH_ABB<AABB, Vector3> are
+// loaded and transposed to SoA on the fly, and each test then covers 4 items per instruction.
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define BVH_SIMD_CULL
+
+#include <xmmintrin.h>
+
+struct BVH_ABB_SIMD4 {
+	__m128 min_x, min_y, min_z;
+	__m128 neg_max_x, neg_max_y, neg_max_z;
+
+	// p_abbs points to 4 consecutive BVH_ABB<AABB, Vector3>, i.e. 4 x (min, neg_max).
+	_FORCE_INLINE_ void load(const BVH_ABB<AABB, Vector3> *p_abbs) {
+		static_assert(sizeof(BVH_ABB<AABB, Vector3>) == sizeof(float) * 6, "Unexpected BVH_ABB layout.");
+		const float *f = (const float *)p_abbs;
+
+		// min.x, min.y, min.z, neg_max.x
+		__m128 r0 = _mm_loadu_ps(f);
+		__m128 r1 = _mm_loadu_ps(f + 6);
+		__m128 r2 = _mm_loadu_ps(f + 12);
+		__m128 r3 = _mm_loadu_ps(f + 18);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		min_x = r0;
+		min_y = r1;
+		min_z = r2;
+		neg_max_x = r3;
+
+		// min.z, neg_max.x, neg_max.y, neg_max.z
+		r0 = _mm_loadu_ps(f + 2);
+		r1 = _mm_loadu_ps(f + 8);
+		r2 = _mm_loadu_ps(f + 14);
+		r3 = _mm_loadu_ps(f + 20);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		neg_max_y = r2;
+		neg_max_z = r3;
+	}
+
+	// Same as BVH_ABB::intersects_swizzled() with p_swizzled as the tester, one bit per box in the result.
+	_FORCE_INLINE_ int intersects_swizzled_mask(const BVH_ABB<AABB, Vector3> &p_swizzled) const {
+		__m128 in = _mm_and_ps(_mm_cmple_ps(min_x, _mm_set1_ps(p_swizzled.min.x)), _mm_cmple_ps(min_y, _mm_set1_ps(p_swizzled.min.y)));
+		in = _mm_and_ps(in, _mm_cmple_ps(min_z, _mm_set1_ps(p_swizzled.min.z)));
+		in = _mm_and_ps(in, _mm_cmple_ps(neg_max_x, _mm_set1_ps(p_swizzled.neg_max.x)));
+		in = _mm_and_ps(in, _mm_cmple_ps(neg_max_y, _mm_set1_ps(p_swizzled.neg_max.y)));
+		in = _mm_and_ps(in, _mm_cmple_ps(neg_max_z, _mm_set1_ps(p_swizzled.neg_max.z)));
+		return _mm_movemask_ps(in);
+	}
+
+	// Same as BVH_ABB::intersects_convex_optimized(), one bit per box in the result.
+	_FORCE_INLINE_ int intersects_convex_optimized_mask(const BVH_ABB<AABB, Vector3>::ConvexHull &p_hull, const uint32_t *p_plane_ids, uint32_t p_num_planes) const {
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 zero = _mm_setzero_ps();
+		__m128 half_x = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(zero, neg_max_x), min_x), half);
+		__m128 half_y = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(zero, neg_max_y), min_y), half);
+		__m128 half_z = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(zero, neg_max_z), min_z), half);
+		__m128 ofs_x = _mm_add_ps(min_x, half_x);
+		__m128 ofs_y = _mm_add_ps(min_y, half_y);
+		__m128 ofs_z = _mm_add_ps(min_z, half_z);
+
+		__m128 outside = zero;
+		for (uint32_t i = 0; i < p_num_planes; i++) {
+			const Plane &p = p_hull.planes[p_plane_ids[i]];
+			// The corner furthest along the inverse of the plane normal.
+			__m128 px = p.normal.x > 0 ? _mm_sub_ps(ofs_x, half_x) : _mm_add_ps(ofs_x, half_x);
+			__m128 py = p.normal.y > 0 ? _mm_sub_ps(ofs_y, half_y) : _mm_add_ps(ofs_y, half_y);
+			__m128 pz = p.normal.z > 0 ? _mm_sub_ps(ofs_z, half_z) : _mm_add_ps(ofs_z, half_z);
+			__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(p.normal.x)), _mm_mul_ps(py, _mm_set1_ps(p.normal.y))), _mm_mul_ps(pz, _mm_set1_ps(p.normal.z)));
+			outside = _mm_or_ps(outside, _mm_cmpgt_ps(dist, _mm_set1_ps(p.d)));
+			if (_mm_movemask_ps(outside) == 0xF) {
+				break;
+			}
+		}
+		return _mm_movemask_ps(outside) ^ 0xF;
+	}
+};
+#endif // BVH_SIMD_CULL
+
 #endif // BVH_ABB_H
@@ -61,6 +61,7 @@ subject to the following restrictions:
 #include "core/error/error_macros.h"
 #include "core/math/aabb.h"
 #include "core/math/math_defs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/memory.h"
 #include "core/templates/paged_allocator.h"
 
@@ -2300,3 +2301,47 @@ Error ConvexHullComputer::convex_hull(const Vector<Vector3> &p_points, Geometry3
 
 	return OK;
 }
+
+struct ConvexHullBatch {
+	const Vector<Vector3> *point_sets = nullptr;
+	Geometry3D::MeshData *meshes = nullptr;
+	Error *errors = nullptr;
+
+	void build_task(uint32_t p_index, void *p_userdata) {
+		errors[p_index] = ConvexHullComputer::convex_hull(point_sets[p_index], meshes[p_index]);
+	}
+};
+
+Error ConvexHullComputer::convex_hull_batch(const Vector<Vector<Vector3>> &p_point_sets, Vector<Geometry3D::MeshData> &r_meshes) {
+	r_meshes.clear();
+	r_meshes.resize(p_point_sets.size());
+	if (p_point_sets.is_empty()) {
+		return OK;
+	}
+
+	LocalVector<Error> errors;
+	errors.resize(p_point_sets.size());
+
+	ConvexHullBatch batch;
+	batch.point_sets = p_point_sets.ptr();
+	batch.meshes = r_meshes.ptrw();
+	batch.errors = errors.ptr();
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Serially from pool threads, waiting there for a nested group can deadlock the pool.
+	if (p_point_sets.size() > 1 && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(&batch, &ConvexHullBatch::build_task, (void *)nullptr, p_point_sets.size(), -1, true, SNAME("ConvexHullBatch"));
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (int i = 0; i < p_point_sets.size(); i++) {
+			batch.build_task(i, nullptr);
+		}
+	}
+
+	for (uint32_t i = 0; i < errors.size(); i++) {
+		if (errors[i] != OK) {
+			return errors[i];
+		}
+	}
+	return OK;
+}
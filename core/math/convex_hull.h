@@ -107,6 +107,8 @@ public:
 	real_t compute(const Vector3 *p_coords, int32_t p_count, real_t p_shrink, real_t p_shrink_clamp);
 
 	static Error convex_hull(const Vector<Vector3> &p_points, Geometry3D::MeshData &r_mesh);
+	// Computes one hull per point set, in parallel on the WorkerThreadPool. Returns the error of the first failed set, if any.
+	static Error convex_hull_batch(const Vector<Vector<Vector3>> &p_point_sets, Vector<Geometry3D::MeshData> &r_meshes);
 };
 
 #endif // CONVEX_HULL_H
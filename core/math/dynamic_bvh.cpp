@@ -30,6 +30,8 @@
 
 #include "dynamic_bvh.h"
 
+#include "core/object/worker_thread_pool.h"
+
 void DynamicBVH::_delete_node(Node *p_node) {
 	node_allocator.free(p_node);
 }
@@ -287,6 +289,7 @@ void DynamicBVH::clear() {
 	if (bvh_root) {
 		_recurse_delete_node(bvh_root);
 	}
+	refit_leaves.clear();
 	lkhd = -1;
 	opath = 0;
 }
@@ -386,9 +389,104 @@ bool DynamicBVH::update(const ID &p_id, const AABB &p_box) {
 	return true;
 }
 
+bool DynamicBVH::update_deferred(const ID &p_id, const AABB &p_box) {
+	ERR_FAIL_COND_V(!p_id.is_valid(), false);
+	Node *leaf = p_id.node;
+
+	Volume volume;
+	volume.min = p_box.position;
+	volume.max = p_box.position + p_box.size;
+
+	if (leaf->volume.min.is_equal_approx(volume.min) && leaf->volume.max.is_equal_approx(volume.max)) {
+		// noop
+		return false;
+	}
+
+	leaf->volume = volume;
+	refit_leaves.push_back(leaf);
+	return true;
+}
+
+void DynamicBVH::_refit_subtree(Node *p_node) {
+	if (p_node->is_internal()) {
+		_refit_subtree(p_node->childs[0]);
+		_refit_subtree(p_node->childs[1]);
+		p_node->volume = p_node->childs[0]->volume.merge(p_node->childs[1]->volume);
+	}
+}
+
+void DynamicBVH::_refit_subtree_task(uint32_t p_index, Node **p_subtrees) {
+	_refit_subtree(p_subtrees[p_index]);
+}
+
+void DynamicBVH::refit(int p_optimize_passes) {
+	if (!bvh_root) {
+		refit_leaves.clear();
+		return;
+	}
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Not from pool threads, waiting there for a nested group can deadlock the pool.
+	if (refit_leaves.size() >= PARALLEL_REFIT_THRESHOLD && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+		// With many moved leaves, refitting the whole tree is simpler and not much more work.
+		// Split it into independent subtrees, refit those in parallel, then the few nodes above them.
+		LocalVector<Node *> subtrees;
+		LocalVector<Node *> upper_nodes;
+		subtrees.push_back(bvh_root);
+		const uint32_t target_subtrees = pool->get_thread_count() * 4;
+		for (int depth = 0; depth < 16 && subtrees.size() < target_subtrees; depth++) {
+			LocalVector<Node *> next;
+			for (uint32_t i = 0; i < subtrees.size(); i++) {
+				Node *node = subtrees[i];
+				if (node->is_internal()) {
+					upper_nodes.push_back(node);
+					next.push_back(node->childs[0]);
+					next.push_back(node->childs[1]);
+				} else {
+					next.push_back(node);
+				}
+			}
+			if (next.size() == subtrees.size()) {
+				break; // Only leaves left.
+			}
+			subtrees = next;
+		}
+
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(this, &DynamicBVH::_refit_subtree_task, subtrees.ptr(), subtrees.size(), -1, true, SNAME("DynamicBVHRefit"));
+		pool->wait_for_group_task_completion(group);
+
+		// Parents were added after their ancestors, so go backwards.
+		for (int64_t i = int64_t(upper_nodes.size()) - 1; i >= 0; i--) {
+			Node *node = upper_nodes[i];
+			node->volume = node->childs[0]->volume.merge(node->childs[1]->volume);
+		}
+	} else {
+		for (uint32_t i = 0; i < refit_leaves.size(); i++) {
+			Node *node = refit_leaves[i]->parent;
+			while (node) {
+				const Volume pb = node->volume;
+				node->volume = node->childs[0]->volume.merge(node->childs[1]->volume);
+				if (!pb.is_not_equal_to(node->volume)) {
+					break;
+				}
+				node = node->parent;
+			}
+		}
+	}
+	refit_leaves.clear();
+
+	if (p_optimize_passes > 0) {
+		optimize_incremental(p_optimize_passes);
+	}
+}
+
 void DynamicBVH::remove(const ID &p_id) {
 	ERR_FAIL_COND(!p_id.is_valid());
 	Node *leaf = p_id.node;
+	// A pending deferred update must not outlive the leaf.
+	for (int64_t i = refit_leaves.find(leaf); i >= 0; i = refit_leaves.find(leaf, i)) {
+		refit_leaves.remove_at_unordered(i);
+	}
 	_remove_leaf(leaf);
 	_delete_node(leaf);
 	--total_leaves;
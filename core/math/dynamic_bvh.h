@@ -228,9 +228,13 @@ private:
 	int total_leaves = 0;
 	uint32_t opath = 0;
 	uint32_t index = 0;
+	// Leaves moved with update_deferred() whose ancestors still need to be refit.
+	LocalVector<Node *> refit_leaves;
 
 	enum {
-		ALLOCA_STACK_SIZE = 128
+		ALLOCA_STACK_SIZE = 128,
+		// Below this amount of moved leaves, refit() just walks up from each of them.
+		PARALLEL_REFIT_THRESHOLD = 1024,
 	};
 
 	_FORCE_INLINE_ void _delete_node(Node *p_node);
@@ -250,6 +254,9 @@ private:
 
 	void _extract_leaves(Node *p_node, List<ID> *r_elements);
 
+	static void _refit_subtree(Node *p_node);
+	void _refit_subtree_task(uint32_t p_index, Node **p_subtrees);
+
 	_FORCE_INLINE_ bool _ray_aabb(const Vector3 &rayFrom, const Vector3 &rayInvDirection, const unsigned int raySign[3], const Vector3 bounds[2], real_t &tmin, real_t lambda_min, real_t lambda_max) {
 		real_t tmax, tymin, tymax, tzmin, tzmax;
 		tmin = (bounds[raySign[0]].x - rayFrom.x) * rayInvDirection.x;
@@ -293,6 +300,12 @@ public:
 	void optimize_incremental(int passes);
 	ID insert(const AABB &p_box, void *p_userdata);
 	bool update(const ID &p_id, const AABB &p_box);
+	// Changes the bounds of a leaf without restructuring the tree, for when many leaves move at once.
+	// The tree must be refit() before it is queried again.
+	bool update_deferred(const ID &p_id, const AABB &p_box);
+	// Refits the nodes above deferred updates, in parallel if there are many, then runs
+	// optimize_incremental() so the tree can be rebalanced a bit each frame.
+	void refit(int p_optimize_passes = 0);
 	void remove(const ID &p_id);
 	void get_elements(List<ID> *r_elements);
 
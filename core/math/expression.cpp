@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -1240,231 +1241,451 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+// Only types with value semantics can be folded, so no execution gets to change the result of another.
+static _FORCE_INLINE_ bool _is_foldable_type(Variant::Type p_type) {
+	return p_type < Variant::OBJECT;
+}
+
+Expression::ENode *Expression::_fold_constants(ENode *p_node) {
 	switch (p_node->type) {
-		case Expression::ENode::TYPE_INPUT: {
-			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
-				return true;
+		case ENode::TYPE_OPERATOR: {
+			OperatorNode *op = static_cast<OperatorNode *>(p_node);
+			op->nodes[0] = _fold_constants(op->nodes[0]);
+			if (op->nodes[1]) {
+				op->nodes[1] = _fold_constants(op->nodes[1]);
+			}
+			if (op->nodes[0]->type != ENode::TYPE_CONSTANT || (op->nodes[1] && op->nodes[1]->type != ENode::TYPE_CONSTANT)) {
+				break;
 			}
-			r_ret = p_inputs[in->index];
-		} break;
-		case Expression::ENode::TYPE_CONSTANT: {
-			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
 
-		} break;
-		case Expression::ENode::TYPE_SELF: {
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
+			const Variant &a = static_cast<ConstantNode *>(op->nodes[0])->value;
+			const Variant &b = op->nodes[1] ? static_cast<ConstantNode *>(op->nodes[1])->value : Variant();
+			Variant value;
+			bool valid = true;
+			Variant::evaluate(op->op, a, b, value, valid);
+			// Leave invalid operations to be reported when executed.
+			if (valid && _is_foldable_type(value.get_type())) {
+				ConstantNode *constant = alloc_node<ConstantNode>();
+				constant->value = value;
+				return constant;
 			}
-			r_ret = p_instance;
 		} break;
-		case Expression::ENode::TYPE_OPERATOR: {
-			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
-
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+		case ENode::TYPE_INDEX: {
+			IndexNode *index = static_cast<IndexNode *>(p_node);
+			index->base = _fold_constants(index->base);
+			index->index = _fold_constants(index->index);
+			if (index->base->type != ENode::TYPE_CONSTANT || index->index->type != ENode::TYPE_CONSTANT) {
+				break;
 			}
 
-			Variant b;
-
-			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
+			const Variant &base = static_cast<ConstantNode *>(index->base)->value;
+			bool valid = false;
+			Variant value = base.get(static_cast<ConstantNode *>(index->index)->value, &valid);
+			if (valid && _is_foldable_type(base.get_type()) && _is_foldable_type(value.get_type())) {
+				ConstantNode *constant = alloc_node<ConstantNode>();
+				constant->value = value;
+				return constant;
 			}
-
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
+		} break;
+		case ENode::TYPE_NAMED_INDEX: {
+			NamedIndexNode *index = static_cast<NamedIndexNode *>(p_node);
+			index->base = _fold_constants(index->base);
+			if (index->base->type != ENode::TYPE_CONSTANT) {
+				break;
 			}
 
+			const Variant &base = static_cast<ConstantNode *>(index->base)->value;
+			bool valid = false;
+			Variant value = base.get_named(index->name, valid);
+			if (valid && _is_foldable_type(base.get_type()) && _is_foldable_type(value.get_type())) {
+				ConstantNode *constant = alloc_node<ConstantNode>();
+				constant->value = value;
+				return constant;
+			}
 		} break;
-		case Expression::ENode::TYPE_INDEX: {
-			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+		case ENode::TYPE_CONSTRUCTOR: {
+			ConstructorNode *constructor = static_cast<ConstructorNode *>(p_node);
+			bool all_constant = true;
+			for (int i = 0; i < constructor->arguments.size(); i++) {
+				constructor->arguments.write[i] = _fold_constants(constructor->arguments[i]);
+				all_constant = all_constant && constructor->arguments[i]->type == ENode::TYPE_CONSTANT;
 			}
-
-			Variant idx;
-
-			ret = _execute(p_inputs, p_instance, index->index, idx, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+			if (!all_constant || !_is_foldable_type(constructor->data_type)) {
+				break;
 			}
 
-			bool valid;
-			r_ret = base.get(idx, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
-				return true;
+			Vector<const Variant *> argp;
+			argp.resize(constructor->arguments.size());
+			for (int i = 0; i < constructor->arguments.size(); i++) {
+				argp.write[i] = &static_cast<ConstantNode *>(constructor->arguments[i])->value;
+			}
+			Variant value;
+			Callable::CallError ce;
+			Variant::construct(constructor->data_type, value, (const Variant **)argp.ptr(), argp.size(), ce);
+			if (ce.error == Callable::CallError::CALL_OK) {
+				ConstantNode *constant = alloc_node<ConstantNode>();
+				constant->value = value;
+				return constant;
 			}
-
 		} break;
-		case Expression::ENode::TYPE_NAMED_INDEX: {
-			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
+		case ENode::TYPE_ARRAY: {
+			ArrayNode *array = static_cast<ArrayNode *>(p_node);
+			for (int i = 0; i < array->array.size(); i++) {
+				array->array.write[i] = _fold_constants(array->array[i]);
 			}
-
-			bool valid;
-			r_ret = base.get_named(index->name, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
-				return true;
+		} break;
+		case ENode::TYPE_DICTIONARY: {
+			DictionaryNode *dictionary = static_cast<DictionaryNode *>(p_node);
+			for (int i = 0; i < dictionary->dict.size(); i++) {
+				dictionary->dict.write[i] = _fold_constants(dictionary->dict[i]);
 			}
-
 		} break;
-		case Expression::ENode::TYPE_ARRAY: {
-			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
-
-			Array arr;
-			arr.resize(array->array.size());
-			for (int i = 0; i < array->array.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, p_const_calls_only, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-				arr[i] = value;
+		case ENode::TYPE_BUILTIN_FUNC: {
+			// Not folded, some builtin functions aren't pure.
+			BuiltinFuncNode *bifunc = static_cast<BuiltinFuncNode *>(p_node);
+			for (int i = 0; i < bifunc->arguments.size(); i++) {
+				bifunc->arguments.write[i] = _fold_constants(bifunc->arguments[i]);
 			}
-
-			r_ret = arr;
-
 		} break;
-		case Expression::ENode::TYPE_DICTIONARY: {
-			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
-
-			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, p_const_calls_only, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-
-				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-
-				d[key] = value;
+		case ENode::TYPE_CALL: {
+			CallNode *call = static_cast<CallNode *>(p_node);
+			call->base = _fold_constants(call->base);
+			for (int i = 0; i < call->arguments.size(); i++) {
+				call->arguments.write[i] = _fold_constants(call->arguments[i]);
 			}
-
-			r_ret = d;
 		} break;
-		case Expression::ENode::TYPE_CONSTRUCTOR: {
-			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
-
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
-
-			for (int i = 0; i < constructor->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, p_const_calls_only, r_error_str);
+		default: {
+		}
+	}
+	return p_node;
+}
 
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+uint32_t Expression::_add_constant(const Variant &p_value) {
+	constants.push_back(p_value);
+	return (ADDRESS_TYPE_CONSTANT << ADDRESS_BITS) | (constants.size() - 1);
+}
 
-			Callable::CallError ce;
-			Variant::construct(constructor->data_type, r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
+uint32_t Expression::_emit(Instruction &p_instruction) {
+	p_instruction.dst = registers.size();
+	registers.push_back(Variant());
+	program.push_back(p_instruction);
+	return (ADDRESS_TYPE_REGISTER << ADDRESS_BITS) | p_instruction.dst;
+}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
-				return true;
-			}
+uint32_t Expression::_compile_arguments(const Vector<ENode *> &p_arguments) {
+	// Compile them all first, as nested calls add their own arguments.
+	LocalVector<uint32_t> addresses;
+	addresses.resize(p_arguments.size());
+	for (int i = 0; i < p_arguments.size(); i++) {
+		uint32_t address = _compile_node(p_arguments[i]);
+		const uint32_t address_type = address >> ADDRESS_BITS;
+		if (address_type == ADDRESS_TYPE_INPUT || address_type == ADDRESS_TYPE_SELF) {
+			// Arguments are passed as pointers resolved ahead of time, so they must be in a register.
+			Instruction load;
+			load.opcode = OPCODE_LOAD;
+			load.a = address;
+			address = _emit(load);
+		}
+		addresses[i] = address;
+	}
 
-		} break;
-		case Expression::ENode::TYPE_BUILTIN_FUNC: {
-			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
+	const uint32_t first = argument_addresses.size();
+	for (uint32_t i = 0; i < addresses.size(); i++) {
+		argument_addresses.push_back(addresses[i]);
+	}
+	return first;
+}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
+uint32_t Expression::_compile_node(ENode *p_node) {
+	switch (p_node->type) {
+		case ENode::TYPE_INPUT: {
+			const InputNode *in = static_cast<const InputNode *>(p_node);
+			min_input = MIN(min_input, in->index);
+			max_input = MAX(max_input, in->index);
+			return (ADDRESS_TYPE_INPUT << ADDRESS_BITS) | (in->index & ADDRESS_MASK);
+		}
+		case ENode::TYPE_CONSTANT: {
+			return _add_constant(static_cast<const ConstantNode *>(p_node)->value);
+		}
+		case ENode::TYPE_SELF: {
+			uses_self = true;
+			return ADDRESS_TYPE_SELF << ADDRESS_BITS;
+		}
+		case ENode::TYPE_OPERATOR: {
+			const OperatorNode *op = static_cast<const OperatorNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_OPERATOR;
+			instruction.op = op->op;
+			instruction.a = _compile_node(op->nodes[0]);
+			instruction.b = op->nodes[1] ? _compile_node(op->nodes[1]) : _add_constant(Variant());
+			return _emit(instruction);
+		}
+		case ENode::TYPE_INDEX: {
+			const IndexNode *index = static_cast<const IndexNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_INDEX;
+			instruction.a = _compile_node(index->base);
+			instruction.b = _compile_node(index->index);
+			return _emit(instruction);
+		}
+		case ENode::TYPE_NAMED_INDEX: {
+			const NamedIndexNode *index = static_cast<const NamedIndexNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_NAMED_INDEX;
+			instruction.a = _compile_node(index->base);
+			instruction.name = index->name;
+			return _emit(instruction);
+		}
+		case ENode::TYPE_ARRAY: {
+			const ArrayNode *array = static_cast<const ArrayNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_ARRAY;
+			instruction.arguments = _compile_arguments(array->array);
+			instruction.argument_count = array->array.size();
+			return _emit(instruction);
+		}
+		case ENode::TYPE_DICTIONARY: {
+			const DictionaryNode *dictionary = static_cast<const DictionaryNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_DICTIONARY;
+			instruction.arguments = _compile_arguments(dictionary->dict);
+			instruction.argument_count = dictionary->dict.size();
+			return _emit(instruction);
+		}
+		case ENode::TYPE_CONSTRUCTOR: {
+			const ConstructorNode *constructor = static_cast<const ConstructorNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_CONSTRUCT;
+			instruction.data_type = constructor->data_type;
+			instruction.arguments = _compile_arguments(constructor->arguments);
+			instruction.argument_count = constructor->arguments.size();
+			return _emit(instruction);
+		}
+		case ENode::TYPE_BUILTIN_FUNC: {
+			const BuiltinFuncNode *bifunc = static_cast<const BuiltinFuncNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_CALL_BUILTIN;
+			instruction.name = bifunc->func;
+			instruction.arguments = _compile_arguments(bifunc->arguments);
+			instruction.argument_count = bifunc->arguments.size();
+			return _emit(instruction);
+		}
+		case ENode::TYPE_CALL: {
+			const CallNode *call = static_cast<const CallNode *>(p_node);
+			Instruction instruction;
+			instruction.opcode = OPCODE_CALL;
+			instruction.name = call->method;
+			instruction.a = _compile_node(call->base);
+			instruction.arguments = _compile_arguments(call->arguments);
+			instruction.argument_count = call->arguments.size();
+			// Methods are called on a copy of the base, so they can't modify constants or inputs.
+			instruction.b = registers.size();
+			registers.push_back(Variant());
+			return _emit(instruction);
+		}
+	}
+	return _add_constant(Variant());
+}
 
-			for (int i = 0; i < bifunc->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+void Expression::_compile_program() {
+	program.clear();
+	constants.clear();
+	registers.clear();
+	argument_addresses.clear();
+	argument_ptrs.clear();
+	min_input = 0;
+	max_input = -1;
+	uses_self = false;
+
+	if (root) {
+		root = _fold_constants(root);
+		result_address = _compile_node(root);
+	} else {
+		result_address = _add_constant(Variant());
+	}
 
-			r_ret = Variant(); //may not return anything
-			Callable::CallError ce;
-			Variant::call_utility_function(bifunc->func, &r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = "Builtin Call Failed. " + Variant::get_call_error_text(bifunc->func, (const Variant **)argp.ptr(), argp.size(), ce);
-				return true;
-			}
+	// Registers and constants don't move anymore.
+	argument_ptrs.resize(argument_addresses.size());
+	for (uint32_t i = 0; i < argument_addresses.size(); i++) {
+		const uint32_t address = argument_addresses[i];
+		if ((address >> ADDRESS_BITS) == ADDRESS_TYPE_CONSTANT) {
+			argument_ptrs[i] = &constants[address & ADDRESS_MASK];
+		} else {
+			argument_ptrs[i] = &registers[address & ADDRESS_MASK];
+		}
+	}
+}
 
-		} break;
-		case Expression::ENode::TYPE_CALL: {
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
+static _FORCE_INLINE_ bool _can_validate_operator(Variant::Operator p_op, Variant::Type p_type_a, Variant::Type p_type_b) {
+	// Validated evaluators don't check for division by zero, invalid shifts or freed objects.
+	switch (p_op) {
+		case Variant::OP_DIVIDE:
+		case Variant::OP_MODULE:
+		case Variant::OP_SHIFT_LEFT:
+		case Variant::OP_SHIFT_RIGHT:
+			return false;
+		default:
+			return p_type_a != Variant::OBJECT && p_type_b != Variant::OBJECT;
+	}
+}
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, p_const_calls_only, r_error_str);
+bool Expression::_execute_program(const Array &p_inputs, Object *p_instance, bool p_const_calls_only, Variant &r_ret, String &r_error_str) {
+	if (min_input < 0 || max_input >= p_inputs.size()) {
+		r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), min_input < 0 ? min_input : max_input);
+		return true;
+	}
+	Variant self;
+	if (uses_self) {
+		if (!p_instance) {
+			r_error_str = RTR("self can't be used because instance is null (not passed)");
+			return true;
+		}
+		self = p_instance;
+	}
 
-			if (ret) {
-				return true;
-			}
+	Variant *regs = registers.ptr();
+	const Variant *consts = constants.ptr();
+	const Variant **args = argument_ptrs.ptr();
+	auto operand = [&](uint32_t p_address) -> const Variant * {
+		switch (p_address >> ADDRESS_BITS) {
+			case ADDRESS_TYPE_REGISTER:
+				return &regs[p_address & ADDRESS_MASK];
+			case ADDRESS_TYPE_CONSTANT:
+				return &consts[p_address & ADDRESS_MASK];
+			case ADDRESS_TYPE_INPUT:
+				return &p_inputs[p_address & ADDRESS_MASK];
+			default:
+				return &self;
+		}
+	};
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+	for (uint32_t ip = 0; ip < program.size(); ip++) {
+		Instruction &instruction = program[ip];
+		Variant *dst = &regs[instruction.dst];
 
-			for (int i = 0; i < call->arguments.size(); i++) {
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, p_const_calls_only, r_error_str);
+		switch (instruction.opcode) {
+			case OPCODE_LOAD: {
+				*dst = *operand(instruction.a);
+			} break;
+			case OPCODE_OPERATOR: {
+				const Variant *a = operand(instruction.a);
+				const Variant *b = operand(instruction.b);
+
+				if (a->get_type() != instruction.cached_type_a || b->get_type() != instruction.cached_type_b) {
+					instruction.cached_type_a = a->get_type();
+					instruction.cached_type_b = b->get_type();
+					instruction.cached_evaluator = nullptr;
+					if (_can_validate_operator(instruction.op, instruction.cached_type_a, instruction.cached_type_b)) {
+						instruction.cached_return_type = Variant::get_operator_return_type(instruction.op, instruction.cached_type_a, instruction.cached_type_b);
+						if (instruction.cached_return_type != Variant::NIL) {
+							instruction.cached_evaluator = Variant::get_validated_operator_evaluator(instruction.op, instruction.cached_type_a, instruction.cached_type_b);
+						}
+					}
+				}
 
-				if (ret) {
+				if (instruction.cached_evaluator) {
+					if (dst->get_type() != instruction.cached_return_type) {
+						VariantInternal::initialize(dst, instruction.cached_return_type);
+					}
+					instruction.cached_evaluator(a, b, dst);
+				} else {
+					bool valid = true;
+					Variant::evaluate(instruction.op, *a, *b, *dst, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(instruction.op), Variant::get_type_name(a->get_type()), Variant::get_type_name(b->get_type()));
+						return true;
+					}
+				}
+			} break;
+			case OPCODE_INDEX: {
+				const Variant *base = operand(instruction.a);
+				const Variant *idx = operand(instruction.b);
+
+				bool valid;
+				*dst = base->get(*idx, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx->get_type()), Variant::get_type_name(base->get_type()));
 					return true;
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+			} break;
+			case OPCODE_NAMED_INDEX: {
+				const Variant *base = operand(instruction.a);
+
+				if (base->get_type() != instruction.cached_type_a) {
+					instruction.cached_type_a = base->get_type();
+					instruction.cached_getter = nullptr;
+					if (instruction.cached_type_a != Variant::OBJECT && instruction.cached_type_a != Variant::DICTIONARY && Variant::has_member(instruction.cached_type_a, instruction.name)) {
+						instruction.cached_getter = Variant::get_member_validated_getter(instruction.cached_type_a, instruction.name);
+						instruction.cached_return_type = Variant::get_member_type(instruction.cached_type_a, instruction.name);
+					}
+				}
 
-			Callable::CallError ce;
-			if (p_const_calls_only) {
-				base.call_const(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			} else {
-				base.callp(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			}
+				if (instruction.cached_getter) {
+					if (dst->get_type() != instruction.cached_return_type) {
+						VariantInternal::initialize(dst, instruction.cached_return_type);
+					}
+					instruction.cached_getter(base, dst);
+				} else {
+					bool valid;
+					*dst = base->get_named(instruction.name, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(instruction.name), Variant::get_type_name(base->get_type()));
+						return true;
+					}
+				}
+			} break;
+			case OPCODE_ARRAY: {
+				Array arr;
+				arr.resize(instruction.argument_count);
+				for (uint32_t i = 0; i < instruction.argument_count; i++) {
+					arr[i] = *args[instruction.arguments + i];
+				}
+				*dst = arr;
+			} break;
+			case OPCODE_DICTIONARY: {
+				Dictionary d;
+				for (uint32_t i = 0; i < instruction.argument_count; i += 2) {
+					d[*args[instruction.arguments + i]] = *args[instruction.arguments + i + 1];
+				}
+				*dst = d;
+			} break;
+			case OPCODE_CONSTRUCT: {
+				Callable::CallError ce;
+				Variant::construct(instruction.data_type, *dst, args + instruction.arguments, instruction.argument_count, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(instruction.data_type));
+					return true;
+				}
+			} break;
+			case OPCODE_CALL_BUILTIN: {
+				*dst = Variant(); //may not return anything
+				Callable::CallError ce;
+				Variant::call_utility_function(instruction.name, dst, args + instruction.arguments, instruction.argument_count, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = "Builtin Call Failed. " + Variant::get_call_error_text(instruction.name, args + instruction.arguments, instruction.argument_count, ce);
+					return true;
+				}
+			} break;
+			case OPCODE_CALL: {
+				Variant &base = regs[instruction.b];
+				base = *operand(instruction.a);
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
-			}
+				Callable::CallError ce;
+				if (p_const_calls_only) {
+					base.call_const(instruction.name, args + instruction.arguments, instruction.argument_count, *dst, ce);
+				} else {
+					base.callp(instruction.name, args + instruction.arguments, instruction.argument_count, *dst, ce);
+				}
 
-		} break;
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(instruction.name));
+					return true;
+				}
+			} break;
+		}
 	}
+
+	r_ret = *operand(result_address);
 	return false;
 }
 
@@ -1492,16 +1713,35 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		return ERR_INVALID_PARAMETER;
 	}
 
+	// The tree is only needed to build the program.
+	_compile_program();
+	root = nullptr;
+	if (nodes) {
+		memdelete(nodes);
+	}
+	nodes = nullptr;
+
 	return OK;
 }
 
 Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error, bool p_const_calls_only) {
 	ERR_FAIL_COND_V_MSG(error_set, Variant(), "There was previously a parse error: " + error_str + ".");
 
+	ERR_FAIL_COND_V_MSG(executing, Variant(), "Can't execute an expression from within its own execution.");
+
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	executing = true;
+	bool err = _execute_program(p_inputs, p_base, p_const_calls_only, output, error_txt);
+	executing = false;
+
+	// Don't keep references alive until the next execution.
+	for (uint32_t i = 0; i < registers.size(); i++) {
+		if (registers[i].get_type() >= Variant::OBJECT && registers[i].get_type() <= Variant::ARRAY) {
+			registers[i] = Variant();
+		}
+	}
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
@@ -32,6 +32,7 @@
 #define EXPRESSION_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class Expression : public RefCounted {
 	GDCLASS(Expression, RefCounted);
@@ -257,7 +258,68 @@ private:
 	Vector<String> input_names;
 
 	bool execution_error = false;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+	bool executing = false;
+
+	// Once parsed, the tree is folded and compiled into a flat list of instructions,
+	// which write their results to registers that are reused by every execution.
+	enum Opcode {
+		OPCODE_LOAD,
+		OPCODE_OPERATOR,
+		OPCODE_INDEX,
+		OPCODE_NAMED_INDEX,
+		OPCODE_ARRAY,
+		OPCODE_DICTIONARY,
+		OPCODE_CONSTRUCT,
+		OPCODE_CALL_BUILTIN,
+		OPCODE_CALL,
+	};
+
+	// Operand addresses, the top bits tell where the value is stored.
+	enum {
+		ADDRESS_BITS = 29,
+		ADDRESS_MASK = (1 << ADDRESS_BITS) - 1,
+		ADDRESS_TYPE_REGISTER = 0,
+		ADDRESS_TYPE_CONSTANT = 1,
+		ADDRESS_TYPE_INPUT = 2,
+		ADDRESS_TYPE_SELF = 3,
+	};
+
+	struct Instruction {
+		Opcode opcode = OPCODE_LOAD;
+		uint32_t dst = 0; // Register.
+		uint32_t a = 0; // Operand address.
+		uint32_t b = 0; // Operand address.
+		uint32_t arguments = 0; // Into argument_ptrs, arguments are always in registers or constants.
+		uint32_t argument_count = 0;
+		Variant::Operator op = Variant::OP_ADD;
+		Variant::Type data_type = Variant::NIL;
+		StringName name;
+
+		// Validated functions for the last operand types seen.
+		Variant::Type cached_type_a = Variant::VARIANT_MAX;
+		Variant::Type cached_type_b = Variant::VARIANT_MAX;
+		Variant::Type cached_return_type = Variant::NIL;
+		Variant::ValidatedOperatorEvaluator cached_evaluator = nullptr;
+		Variant::ValidatedGetter cached_getter = nullptr;
+	};
+
+	LocalVector<Instruction> program;
+	LocalVector<Variant> constants;
+	LocalVector<Variant> registers;
+	LocalVector<uint32_t> argument_addresses;
+	LocalVector<const Variant *> argument_ptrs;
+	uint32_t result_address = 0;
+	int min_input = 0;
+	int max_input = -1;
+	bool uses_self = false;
+
+	ENode *_fold_constants(ENode *p_node);
+	uint32_t _add_constant(const Variant &p_value);
+	uint32_t _emit(Instruction &p_instruction);
+	uint32_t _compile_arguments(const Vector<ENode *> &p_arguments);
+	uint32_t _compile_node(ENode *p_node);
+	void _compile_program();
+	bool _execute_program(const Array &p_inputs, Object *p_instance, bool p_const_calls_only, Variant &r_ret, String &r_error_str);
 
 protected:
 	static void _bind_methods();
@@ -0,0 +1,631 @@
+/*************************************************************************/
+/*  packed_array_math.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "packed_array_math.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PACKED_ARRAY_MATH_USE_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PACKED_ARRAY_MATH_USE_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(PACKED_ARRAY_MATH_USE_SSE) || defined(PACKED_ARRAY_MATH_USE_NEON)
+#define PACKED_ARRAY_MATH_USE_SIMD
+
+// The few operations the kernels need, so they are written once for both instruction sets.
+#if defined(PACKED_ARRAY_MATH_USE_SSE)
+typedef __m128 Float4;
+static _FORCE_INLINE_ Float4 f4_load(const float *p_src) { return _mm_loadu_ps(p_src); }
+static _FORCE_INLINE_ void f4_store(float *p_dst, Float4 p_value) { _mm_storeu_ps(p_dst, p_value); }
+static _FORCE_INLINE_ Float4 f4_splat(float p_value) { return _mm_set1_ps(p_value); }
+static _FORCE_INLINE_ Float4 f4_add(Float4 p_a, Float4 p_b) { return _mm_add_ps(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_sub(Float4 p_a, Float4 p_b) { return _mm_sub_ps(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_mul(Float4 p_a, Float4 p_b) { return _mm_mul_ps(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_min(Float4 p_a, Float4 p_b) { return _mm_min_ps(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_max(Float4 p_a, Float4 p_b) { return _mm_max_ps(p_a, p_b); }
+#else
+typedef float32x4_t Float4;
+static _FORCE_INLINE_ Float4 f4_load(const float *p_src) { return vld1q_f32(p_src); }
+static _FORCE_INLINE_ void f4_store(float *p_dst, Float4 p_value) { vst1q_f32(p_dst, p_value); }
+static _FORCE_INLINE_ Float4 f4_splat(float p_value) { return vdupq_n_f32(p_value); }
+static _FORCE_INLINE_ Float4 f4_add(Float4 p_a, Float4 p_b) { return vaddq_f32(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_sub(Float4 p_a, Float4 p_b) { return vsubq_f32(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_mul(Float4 p_a, Float4 p_b) { return vmulq_f32(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_min(Float4 p_a, Float4 p_b) { return vminq_f32(p_a, p_b); }
+static _FORCE_INLINE_ Float4 f4_max(Float4 p_a, Float4 p_b) { return vmaxq_f32(p_a, p_b); }
+#endif
+
+static _FORCE_INLINE_ void f4_get(Float4 p_value, float *r_lanes) {
+	f4_store(r_lanes, p_value);
+}
+
+#endif // PACKED_ARRAY_MATH_USE_SIMD
+
+/* Chunk dispatch */
+
+static _FORCE_INLINE_ int64_t _chunk_count(int64_t p_count, int64_t p_chunk_size) {
+	return (p_count + p_chunk_size - 1) / p_chunk_size;
+}
+
+template <class F>
+struct PackedArrayMathChunks {
+	const F *func = nullptr;
+	int64_t count = 0;
+	int64_t chunk_size = 0;
+
+	static void run(void *p_userdata, uint32_t p_chunk) {
+		const PackedArrayMathChunks *chunks = (const PackedArrayMathChunks *)p_userdata;
+		int64_t from = int64_t(p_chunk) * chunks->chunk_size;
+		(*chunks->func)(from, MIN(from + chunks->chunk_size, chunks->count), p_chunk);
+	}
+};
+
+// Calls p_func(from, to, chunk) for every chunk of p_chunk_size elements, on the WorkerThreadPool when there is more than one.
+template <class F>
+static void _for_each_chunk(int64_t p_count, int64_t p_chunk_size, const F &p_func) {
+	int64_t chunk_count = _chunk_count(p_count, p_chunk_size);
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	// Pool threads run the chunks themselves, waiting there for a nested group can deadlock the pool.
+	if (chunk_count > 1 && pool && pool->get_thread_index() == -1) {
+		PackedArrayMathChunks<F> chunks;
+		chunks.func = &p_func;
+		chunks.count = p_count;
+		chunks.chunk_size = p_chunk_size;
+		WorkerThreadPool::GroupID group = pool->add_native_group_task(&PackedArrayMathChunks<F>::run, &chunks, chunk_count, -1, true, SNAME("PackedArrayMath"));
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (int64_t i = 0; i < chunk_count; i++) {
+			int64_t from = i * p_chunk_size;
+			p_func(from, MIN(from + p_chunk_size, p_count), uint32_t(i));
+		}
+	}
+}
+
+/* Kernels */
+
+// The templates handle doubles and the elements left after the last whole vector of floats.
+
+template <class T>
+static void _add(T *p_dst, const T *p_src, int64_t p_from, int64_t p_to) {
+	for (int64_t i = p_from; i < p_to; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+template <class T>
+static void _multiply(T *p_dst, const T *p_src, int64_t p_from, int64_t p_to) {
+	for (int64_t i = p_from; i < p_to; i++) {
+		p_dst[i] *= p_src[i];
+	}
+}
+
+template <class T>
+static void _add_scalar(T *p_dst, T p_value, int64_t p_from, int64_t p_to) {
+	for (int64_t i = p_from; i < p_to; i++) {
+		p_dst[i] += p_value;
+	}
+}
+
+template <class T>
+static void _multiply_scalar(T *p_dst, T p_value, int64_t p_from, int64_t p_to) {
+	for (int64_t i = p_from; i < p_to; i++) {
+		p_dst[i] *= p_value;
+	}
+}
+
+template <class T>
+static void _lerp(T *p_dst, const T *p_to, T p_weight, int64_t p_from, int64_t p_end) {
+	for (int64_t i = p_from; i < p_end; i++) {
+		p_dst[i] += (p_to[i] - p_dst[i]) * p_weight;
+	}
+}
+
+template <class T>
+static void _clamp(T *p_dst, T p_min, T p_max, int64_t p_from, int64_t p_to) {
+	for (int64_t i = p_from; i < p_to; i++) {
+		p_dst[i] = CLAMP(p_dst[i], p_min, p_max);
+	}
+}
+
+template <class T>
+static double _dot(const T *p_a, const T *p_b, int64_t p_from, int64_t p_to) {
+	double dot = 0.0;
+	for (int64_t i = p_from; i < p_to; i++) {
+		dot += double(p_a[i]) * double(p_b[i]);
+	}
+	return dot;
+}
+
+template <class T>
+static double _sum(const T *p_src, int64_t p_from, int64_t p_to) {
+	double sum = 0.0;
+	for (int64_t i = p_from; i < p_to; i++) {
+		sum += p_src[i];
+	}
+	return sum;
+}
+
+template <class T>
+static double _min(const T *p_src, int64_t p_from, int64_t p_to) {
+	T min = p_src[p_from];
+	for (int64_t i = p_from + 1; i < p_to; i++) {
+		min = MIN(min, p_src[i]);
+	}
+	return min;
+}
+
+template <class T>
+static double _max(const T *p_src, int64_t p_from, int64_t p_to) {
+	T max = p_src[p_from];
+	for (int64_t i = p_from + 1; i < p_to; i++) {
+		max = MAX(max, p_src[i]);
+	}
+	return max;
+}
+
+#ifdef PACKED_ARRAY_MATH_USE_SIMD
+
+static void _add(float *p_dst, const float *p_src, int64_t p_from, int64_t p_to) {
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		f4_store(p_dst + i, f4_add(f4_load(p_dst + i), f4_load(p_src + i)));
+	}
+	_add<float>(p_dst, p_src, i, p_to);
+}
+
+static void _multiply(float *p_dst, const float *p_src, int64_t p_from, int64_t p_to) {
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		f4_store(p_dst + i, f4_mul(f4_load(p_dst + i), f4_load(p_src + i)));
+	}
+	_multiply<float>(p_dst, p_src, i, p_to);
+}
+
+static void _add_scalar(float *p_dst, float p_value, int64_t p_from, int64_t p_to) {
+	const Float4 value = f4_splat(p_value);
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		f4_store(p_dst + i, f4_add(f4_load(p_dst + i), value));
+	}
+	_add_scalar<float>(p_dst, p_value, i, p_to);
+}
+
+static void _multiply_scalar(float *p_dst, float p_value, int64_t p_from, int64_t p_to) {
+	const Float4 value = f4_splat(p_value);
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		f4_store(p_dst + i, f4_mul(f4_load(p_dst + i), value));
+	}
+	_multiply_scalar<float>(p_dst, p_value, i, p_to);
+}
+
+static void _lerp(float *p_dst, const float *p_to, float p_weight, int64_t p_from, int64_t p_end) {
+	const Float4 weight = f4_splat(p_weight);
+	int64_t i = p_from;
+	for (; i + 4 <= p_end; i += 4) {
+		const Float4 from = f4_load(p_dst + i);
+		f4_store(p_dst + i, f4_add(from, f4_mul(f4_sub(f4_load(p_to + i), from), weight)));
+	}
+	_lerp<float>(p_dst, p_to, p_weight, i, p_end);
+}
+
+static void _clamp(float *p_dst, float p_min, float p_max, int64_t p_from, int64_t p_to) {
+	const Float4 min = f4_splat(p_min);
+	const Float4 max = f4_splat(p_max);
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		f4_store(p_dst + i, f4_min(f4_max(f4_load(p_dst + i), min), max));
+	}
+	_clamp<float>(p_dst, p_min, p_max, i, p_to);
+}
+
+// Float reductions accumulate in four float lanes within a chunk, the chunks are added up as doubles.
+
+static double _dot(const float *p_a, const float *p_b, int64_t p_from, int64_t p_to) {
+	Float4 dot = f4_splat(0.0f);
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		dot = f4_add(dot, f4_mul(f4_load(p_a + i), f4_load(p_b + i)));
+	}
+	float lanes[4];
+	f4_get(dot, lanes);
+	return double(lanes[0]) + double(lanes[1]) + double(lanes[2]) + double(lanes[3]) + _dot<float>(p_a, p_b, i, p_to);
+}
+
+static double _sum(const float *p_src, int64_t p_from, int64_t p_to) {
+	Float4 sum = f4_splat(0.0f);
+	int64_t i = p_from;
+	for (; i + 4 <= p_to; i += 4) {
+		sum = f4_add(sum, f4_load(p_src + i));
+	}
+	float lanes[4];
+	f4_get(sum, lanes);
+	return double(lanes[0]) + double(lanes[1]) + double(lanes[2]) + double(lanes[3]) + _sum<float>(p_src, i, p_to);
+}
+
+static double _min(const float *p_src, int64_t p_from, int64_t p_to) {
+	if (p_to - p_from < 4) {
+		return _min<float>(p_src, p_from, p_to);
+	}
+	Float4 min = f4_load(p_src + p_from);
+	int64_t i = p_from + 4;
+	for (; i + 4 <= p_to; i += 4) {
+		min = f4_min(min, f4_load(p_src + i));
+	}
+	float lanes[4];
+	f4_get(min, lanes);
+	float result = MIN(MIN(lanes[0], lanes[1]), MIN(lanes[2], lanes[3]));
+	for (; i < p_to; i++) {
+		result = MIN(result, p_src[i]);
+	}
+	return result;
+}
+
+static double _max(const float *p_src, int64_t p_from, int64_t p_to) {
+	if (p_to - p_from < 4) {
+		return _max<float>(p_src, p_from, p_to);
+	}
+	Float4 max = f4_load(p_src + p_from);
+	int64_t i = p_from + 4;
+	for (; i + 4 <= p_to; i += 4) {
+		max = f4_max(max, f4_load(p_src + i));
+	}
+	float lanes[4];
+	f4_get(max, lanes);
+	float result = MAX(MAX(lanes[0], lanes[1]), MAX(lanes[2], lanes[3]));
+	for (; i < p_to; i++) {
+		result = MAX(result, p_src[i]);
+	}
+	return result;
+}
+
+#endif // PACKED_ARRAY_MATH_USE_SIMD
+
+/* Element-wise operations */
+
+template <class T>
+static void _bulk_add(T *p_dst, const T *p_src, int64_t p_count) {
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		_add(p_dst, p_src, p_from, p_to);
+	});
+}
+
+template <class T>
+static void _bulk_multiply(T *p_dst, const T *p_src, int64_t p_count) {
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		_multiply(p_dst, p_src, p_from, p_to);
+	});
+}
+
+template <class T>
+static void _bulk_add_scalar(T *p_dst, T p_value, int64_t p_count) {
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		_add_scalar(p_dst, p_value, p_from, p_to);
+	});
+}
+
+template <class T>
+static void _bulk_multiply_scalar(T *p_dst, T p_value, int64_t p_count) {
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		_multiply_scalar(p_dst, p_value, p_from, p_to);
+	});
+}
+
+template <class T>
+static void _bulk_lerp(T *p_dst, const T *p_to, T p_weight, int64_t p_count) {
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_end, uint32_t p_chunk) {
+		_lerp(p_dst, p_to, p_weight, p_from, p_end);
+	});
+}
+
+template <class T>
+static void _bulk_clamp(T *p_dst, T p_min, T p_max, int64_t p_count) {
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		_clamp(p_dst, p_min, p_max, p_from, p_to);
+	});
+}
+
+void PackedArrayMath::add(float *p_dst, const float *p_src, int64_t p_count) {
+	_bulk_add(p_dst, p_src, p_count);
+}
+
+void PackedArrayMath::add(double *p_dst, const double *p_src, int64_t p_count) {
+	_bulk_add(p_dst, p_src, p_count);
+}
+
+void PackedArrayMath::multiply(float *p_dst, const float *p_src, int64_t p_count) {
+	_bulk_multiply(p_dst, p_src, p_count);
+}
+
+void PackedArrayMath::multiply(double *p_dst, const double *p_src, int64_t p_count) {
+	_bulk_multiply(p_dst, p_src, p_count);
+}
+
+void PackedArrayMath::add_scalar(float *p_dst, float p_value, int64_t p_count) {
+	_bulk_add_scalar(p_dst, p_value, p_count);
+}
+
+void PackedArrayMath::add_scalar(double *p_dst, double p_value, int64_t p_count) {
+	_bulk_add_scalar(p_dst, p_value, p_count);
+}
+
+void PackedArrayMath::multiply_scalar(float *p_dst, float p_value, int64_t p_count) {
+	_bulk_multiply_scalar(p_dst, p_value, p_count);
+}
+
+void PackedArrayMath::multiply_scalar(double *p_dst, double p_value, int64_t p_count) {
+	_bulk_multiply_scalar(p_dst, p_value, p_count);
+}
+
+void PackedArrayMath::lerp(float *p_dst, const float *p_to, float p_weight, int64_t p_count) {
+	_bulk_lerp(p_dst, p_to, p_weight, p_count);
+}
+
+void PackedArrayMath::lerp(double *p_dst, const double *p_to, double p_weight, int64_t p_count) {
+	_bulk_lerp(p_dst, p_to, p_weight, p_count);
+}
+
+void PackedArrayMath::clamp(float *p_dst, float p_min, float p_max, int64_t p_count) {
+	_bulk_clamp(p_dst, p_min, p_max, p_count);
+}
+
+void PackedArrayMath::clamp(double *p_dst, double p_min, double p_max, int64_t p_count) {
+	_bulk_clamp(p_dst, p_min, p_max, p_count);
+}
+
+/* Reductions */
+
+// Each chunk writes its own partial result, combined in chunk order so the result doesn't depend on the threads.
+
+template <class T>
+static double _bulk_dot(const T *p_a, const T *p_b, int64_t p_count) {
+	LocalVector<double> partials;
+	partials.resize(_chunk_count(p_count, PackedArrayMath::CHUNK_SIZE));
+	double *w = partials.ptr();
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		w[p_chunk] = _dot(p_a, p_b, p_from, p_to);
+	});
+
+	double dot = 0.0;
+	for (uint32_t i = 0; i < partials.size(); i++) {
+		dot += partials[i];
+	}
+	return dot;
+}
+
+template <class T>
+static double _bulk_sum(const T *p_src, int64_t p_count) {
+	LocalVector<double> partials;
+	partials.resize(_chunk_count(p_count, PackedArrayMath::CHUNK_SIZE));
+	double *w = partials.ptr();
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		w[p_chunk] = _sum(p_src, p_from, p_to);
+	});
+
+	double sum = 0.0;
+	for (uint32_t i = 0; i < partials.size(); i++) {
+		sum += partials[i];
+	}
+	return sum;
+}
+
+template <class T>
+static double _bulk_min(const T *p_src, int64_t p_count) {
+	if (p_count <= 0) {
+		return 0.0;
+	}
+	LocalVector<double> partials;
+	partials.resize(_chunk_count(p_count, PackedArrayMath::CHUNK_SIZE));
+	double *w = partials.ptr();
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		w[p_chunk] = _min(p_src, p_from, p_to);
+	});
+
+	double min = partials[0];
+	for (uint32_t i = 1; i < partials.size(); i++) {
+		min = MIN(min, partials[i]);
+	}
+	return min;
+}
+
+template <class T>
+static double _bulk_max(const T *p_src, int64_t p_count) {
+	if (p_count <= 0) {
+		return 0.0;
+	}
+	LocalVector<double> partials;
+	partials.resize(_chunk_count(p_count, PackedArrayMath::CHUNK_SIZE));
+	double *w = partials.ptr();
+	_for_each_chunk(p_count, PackedArrayMath::CHUNK_SIZE, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		w[p_chunk] = _max(p_src, p_from, p_to);
+	});
+
+	double max = partials[0];
+	for (uint32_t i = 1; i < partials.size(); i++) {
+		max = MAX(max, partials[i]);
+	}
+	return max;
+}
+
+double PackedArrayMath::dot(const float *p_a, const float *p_b, int64_t p_count) {
+	return _bulk_dot(p_a, p_b, p_count);
+}
+
+double PackedArrayMath::dot(const double *p_a, const double *p_b, int64_t p_count) {
+	return _bulk_dot(p_a, p_b, p_count);
+}
+
+double PackedArrayMath::sum(const float *p_src, int64_t p_count) {
+	return _bulk_sum(p_src, p_count);
+}
+
+double PackedArrayMath::sum(const double *p_src, int64_t p_count) {
+	return _bulk_sum(p_src, p_count);
+}
+
+double PackedArrayMath::min(const float *p_src, int64_t p_count) {
+	return _bulk_min(p_src, p_count);
+}
+
+double PackedArrayMath::min(const double *p_src, int64_t p_count) {
+	return _bulk_min(p_src, p_count);
+}
+
+double PackedArrayMath::max(const float *p_src, int64_t p_count) {
+	return _bulk_max(p_src, p_count);
+}
+
+double PackedArrayMath::max(const double *p_src, int64_t p_count) {
+	return _bulk_max(p_src, p_count);
+}
+
+/* Vectors */
+
+// Interleaved vectors don't map well to whole SIMD lanes, so apart from transforming Vector3 these are plain loops, still split across threads.
+
+void PackedArrayMath::dot_vector2(const Vector2 *p_a, const Vector2 *p_b, float *r_dots, int64_t p_count) {
+	_for_each_chunk(p_count, CHUNK_SIZE / 2, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		for (int64_t i = p_from; i < p_to; i++) {
+			r_dots[i] = p_a[i].dot(p_b[i]);
+		}
+	});
+}
+
+void PackedArrayMath::dot_vector3(const Vector3 *p_a, const Vector3 *p_b, float *r_dots, int64_t p_count) {
+	_for_each_chunk(p_count, CHUNK_SIZE / 3, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		for (int64_t i = p_from; i < p_to; i++) {
+			r_dots[i] = p_a[i].dot(p_b[i]);
+		}
+	});
+}
+
+Vector2 PackedArrayMath::sum_vector2(const Vector2 *p_src, int64_t p_count) {
+	const int64_t chunk_size = CHUNK_SIZE / 2;
+	LocalVector<double> partials;
+	partials.resize(_chunk_count(p_count, chunk_size) * 2);
+	double *w = partials.ptr();
+	_for_each_chunk(p_count, chunk_size, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		double x = 0.0;
+		double y = 0.0;
+		for (int64_t i = p_from; i < p_to; i++) {
+			x += p_src[i].x;
+			y += p_src[i].y;
+		}
+		w[p_chunk * 2 + 0] = x;
+		w[p_chunk * 2 + 1] = y;
+	});
+
+	double x = 0.0;
+	double y = 0.0;
+	for (uint32_t i = 0; i < partials.size(); i += 2) {
+		x += partials[i + 0];
+		y += partials[i + 1];
+	}
+	return Vector2(x, y);
+}
+
+Vector3 PackedArrayMath::sum_vector3(const Vector3 *p_src, int64_t p_count) {
+	const int64_t chunk_size = CHUNK_SIZE / 3;
+	LocalVector<double> partials;
+	partials.resize(_chunk_count(p_count, chunk_size) * 3);
+	double *w = partials.ptr();
+	_for_each_chunk(p_count, chunk_size, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		double x = 0.0;
+		double y = 0.0;
+		double z = 0.0;
+		for (int64_t i = p_from; i < p_to; i++) {
+			x += p_src[i].x;
+			y += p_src[i].y;
+			z += p_src[i].z;
+		}
+		w[p_chunk * 3 + 0] = x;
+		w[p_chunk * 3 + 1] = y;
+		w[p_chunk * 3 + 2] = z;
+	});
+
+	double x = 0.0;
+	double y = 0.0;
+	double z = 0.0;
+	for (uint32_t i = 0; i < partials.size(); i += 3) {
+		x += partials[i + 0];
+		y += partials[i + 1];
+		z += partials[i + 2];
+	}
+	return Vector3(x, y, z);
+}
+
+void PackedArrayMath::transform_vector2(Vector2 *p_dst, const Transform2D &p_transform, int64_t p_count) {
+	_for_each_chunk(p_count, CHUNK_SIZE / 2, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+		for (int64_t i = p_from; i < p_to; i++) {
+			p_dst[i] = p_transform.xform(p_dst[i]);
+		}
+	});
+}
+
+void PackedArrayMath::transform_vector3(Vector3 *p_dst, const Transform3D &p_transform, int64_t p_count) {
+	const Transform3D xform = p_transform;
+	_for_each_chunk(p_count, CHUNK_SIZE / 3, [=](int64_t p_from, int64_t p_to, uint32_t p_chunk) {
+#if defined(PACKED_ARRAY_MATH_USE_SIMD) && !defined(REAL_T_IS_DOUBLE)
+		// Basis columns and origin, with an unused fourth lane, so each vector is three multiply-adds.
+		const Basis &b = xform.basis;
+		float c0[4] = { b.rows[0][0], b.rows[1][0], b.rows[2][0], 0.0f };
+		float c1[4] = { b.rows[0][1], b.rows[1][1], b.rows[2][1], 0.0f };
+		float c2[4] = { b.rows[0][2], b.rows[1][2], b.rows[2][2], 0.0f };
+		float o[4] = { xform.origin.x, xform.origin.y, xform.origin.z, 0.0f };
+		const Float4 col0 = f4_load(c0);
+		const Float4 col1 = f4_load(c1);
+		const Float4 col2 = f4_load(c2);
+		const Float4 origin = f4_load(o);
+
+		float result[4];
+		for (int64_t i = p_from; i < p_to; i++) {
+			Vector3 &v = p_dst[i];
+			Float4 r = f4_add(origin, f4_mul(col0, f4_splat(v.x)));
+			r = f4_add(r, f4_mul(col1, f4_splat(v.y)));
+			r = f4_add(r, f4_mul(col2, f4_splat(v.z)));
+			// Vectors are tightly packed, storing all four lanes would overwrite the next one.
+			f4_get(r, result);
+			v.x = result[0];
+			v.y = result[1];
+			v.z = result[2];
+		}
+#else
+		for (int64_t i = p_from; i < p_to; i++) {
+			p_dst[i] = xform.xform(p_dst[i]);
+		}
+#endif
+	});
+}
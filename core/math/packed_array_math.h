@@ -0,0 +1,84 @@
+/*************************************************************************/
+/*  packed_array_math.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PACKED_ARRAY_MATH_H
+#define PACKED_ARRAY_MATH_H
+
+#include "core/math/transform_2d.h"
+#include "core/math/transform_3d.h"
+
+// Bulk math on arrays of scalars, used by the packed array methods exposed to scripts.
+// Float arrays go through SSE or NEON kernels where available. Arrays larger than a chunk
+// are split into chunks processed on the WorkerThreadPool; the chunks are the same whether
+// threads are used or not, so reductions give the same result either way.
+class PackedArrayMath {
+public:
+	enum {
+		CHUNK_SIZE = 32768, // In scalars.
+	};
+
+	// p_dst[i] += p_src[i]
+	static void add(float *p_dst, const float *p_src, int64_t p_count);
+	static void add(double *p_dst, const double *p_src, int64_t p_count);
+	// p_dst[i] *= p_src[i]
+	static void multiply(float *p_dst, const float *p_src, int64_t p_count);
+	static void multiply(double *p_dst, const double *p_src, int64_t p_count);
+	// p_dst[i] += p_value
+	static void add_scalar(float *p_dst, float p_value, int64_t p_count);
+	static void add_scalar(double *p_dst, double p_value, int64_t p_count);
+	// p_dst[i] *= p_value
+	static void multiply_scalar(float *p_dst, float p_value, int64_t p_count);
+	static void multiply_scalar(double *p_dst, double p_value, int64_t p_count);
+	// p_dst[i] += (p_to[i] - p_dst[i]) * p_weight
+	static void lerp(float *p_dst, const float *p_to, float p_weight, int64_t p_count);
+	static void lerp(double *p_dst, const double *p_to, double p_weight, int64_t p_count);
+	static void clamp(float *p_dst, float p_min, float p_max, int64_t p_count);
+	static void clamp(double *p_dst, double p_min, double p_max, int64_t p_count);
+
+	static double dot(const float *p_a, const float *p_b, int64_t p_count);
+	static double dot(const double *p_a, const double *p_b, int64_t p_count);
+	static double sum(const float *p_src, int64_t p_count);
+	static double sum(const double *p_src, int64_t p_count);
+	// Both return 0 for empty arrays.
+	static double min(const float *p_src, int64_t p_count);
+	static double min(const double *p_src, int64_t p_count);
+	static double max(const float *p_src, int64_t p_count);
+	static double max(const double *p_src, int64_t p_count);
+
+	// Interleaved vectors, p_count is the number of vectors.
+	static void dot_vector2(const Vector2 *p_a, const Vector2 *p_b, float *r_dots, int64_t p_count);
+	static void dot_vector3(const Vector3 *p_a, const Vector3 *p_b, float *r_dots, int64_t p_count);
+	static Vector2 sum_vector2(const Vector2 *p_src, int64_t p_count);
+	static Vector3 sum_vector3(const Vector3 *p_src, int64_t p_count);
+	static void transform_vector2(Vector2 *p_dst, const Transform2D &p_transform, int64_t p_count);
+	static void transform_vector3(Vector3 *p_dst, const Transform3D &p_transform, int64_t p_count);
+};
+
+#endif // PACKED_ARRAY_MATH_H
@@ -30,6 +30,7 @@
 
 #include "quick_hull.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 
 uint32_t QuickHull::debug_stop_after = 0xFFFFFFFF;
@@ -453,3 +454,47 @@ Error QuickHull::build(const Vector<Vector3> &p_points, Geometry3D::MeshData &r_
 
 	return OK;
 }
+
+struct QuickHullBatch {
+	const Vector<Vector3> *point_sets = nullptr;
+	Geometry3D::MeshData *meshes = nullptr;
+	Error *errors = nullptr;
+
+	void build_task(uint32_t p_index, void *p_userdata) {
+		errors[p_index] = QuickHull::build(point_sets[p_index], meshes[p_index]);
+	}
+};
+
+Error QuickHull::build_batch(const Vector<Vector<Vector3>> &p_point_sets, Vector<Geometry3D::MeshData> &r_meshes) {
+	r_meshes.clear();
+	r_meshes.resize(p_point_sets.size());
+	if (p_point_sets.is_empty()) {
+		return OK;
+	}
+
+	LocalVector<Error> errors;
+	errors.resize(p_point_sets.size());
+
+	QuickHullBatch batch;
+	batch.point_sets = p_point_sets.ptr();
+	batch.meshes = r_meshes.ptrw();
+	batch.errors = errors.ptr();
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Serially from pool threads, waiting there for a nested group can deadlock the pool.
+	if (p_point_sets.size() > 1 && pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(&batch, &QuickHullBatch::build_task, (void *)nullptr, p_point_sets.size(), -1, true, SNAME("QuickHullBatch"));
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (int i = 0; i < p_point_sets.size(); i++) {
+			batch.build_task(i, nullptr);
+		}
+	}
+
+	for (uint32_t i = 0; i < errors.size(); i++) {
+		if (errors[i] != OK) {
+			return errors[i];
+		}
+	}
+	return OK;
+}
@@ -90,6 +90,8 @@ private:
 public:
 	static uint32_t debug_stop_after;
 	static Error build(const Vector<Vector3> &p_points, Geometry3D::MeshData &r_mesh);
+	// Builds one hull per point set, in parallel on the WorkerThreadPool. Returns the error of the first failed set, if any.
+	static Error build_batch(const Vector<Vector<Vector3>> &p_point_sets, Vector<Geometry3D::MeshData> &r_meshes);
 };
 
 #endif // QUICK_HULL_H
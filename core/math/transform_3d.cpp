@@ -33,6 +33,11 @@
 #include "core/math/math_funcs.h"
 #include "core/string/print_string.h"
 
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define TRANSFORM_3D_USE_SSE
+#include <xmmintrin.h>
+#endif
+
 void Transform3D::affine_invert() {
 	basis.invert();
 	origin = basis.xform(-origin);
@@ -182,6 +187,62 @@ Transform3D Transform3D::operator*(const Transform3D &p_transform) const {
 	return t;
 }
 
+void Transform3D::xform_array(const Vector3 *p_in, Vector3 *p_out, int p_count) const {
+	int i = 0;
+
+#ifdef TRANSFORM_3D_USE_SSE
+	static_assert(sizeof(Vector3) == sizeof(float) * 3);
+
+	const __m128 m00 = _mm_set1_ps(basis.rows[0][0]), m01 = _mm_set1_ps(basis.rows[0][1]), m02 = _mm_set1_ps(basis.rows[0][2]);
+	const __m128 m10 = _mm_set1_ps(basis.rows[1][0]), m11 = _mm_set1_ps(basis.rows[1][1]), m12 = _mm_set1_ps(basis.rows[1][2]);
+	const __m128 m20 = _mm_set1_ps(basis.rows[2][0]), m21 = _mm_set1_ps(basis.rows[2][1]), m22 = _mm_set1_ps(basis.rows[2][2]);
+	const __m128 ox = _mm_set1_ps(origin.x), oy = _mm_set1_ps(origin.y), oz = _mm_set1_ps(origin.z);
+
+	// Four vectors at a time: load them as three registers, deinterleave into X, Y and Z
+	// lanes, transform, then interleave back. All loads happen before the stores, so
+	// transforming in place is fine.
+	for (; i + 4 <= p_count; i += 4) {
+		const float *src = (const float *)(p_in + i);
+		__m128 a = _mm_loadu_ps(src); // x0 y0 z0 x1
+		__m128 b = _mm_loadu_ps(src + 4); // y1 z1 x2 y2
+		__m128 c = _mm_loadu_ps(src + 8); // z2 x3 y3 z3
+
+		__m128 x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+		__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m01)), _mm_add_ps(_mm_mul_ps(z, m02), ox));
+		__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m10), _mm_mul_ps(y, m11)), _mm_add_ps(_mm_mul_ps(z, m12), oy));
+		__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m20), _mm_mul_ps(y, m21)), _mm_add_ps(_mm_mul_ps(z, m22), oz));
+
+		__m128 p = _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 0, 2, 0)); // x0 x2 y0 y2
+		__m128 q = _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 1, 2, 0)); // z0 z2 x1 x3
+		__m128 r = _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 1, 3, 1)); // y1 y3 z1 z3
+
+		float *dst = (float *)(p_out + i);
+		_mm_storeu_ps(dst, _mm_shuffle_ps(p, q, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(dst + 4, _mm_shuffle_ps(r, p, _MM_SHUFFLE(3, 1, 2, 0)));
+		_mm_storeu_ps(dst + 8, _mm_shuffle_ps(q, r, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+#endif
+
+	for (; i < p_count; i++) {
+		p_out[i] = xform(p_in[i]);
+	}
+}
+
+void Transform3D::xform_array(const Transform3D *p_in, Transform3D *p_out, int p_count) const {
+	for (int i = 0; i < p_count; i++) {
+		const Basis &b = p_in[i].basis;
+		Transform3D t;
+		for (int j = 0; j < 3; j++) {
+			t.basis.rows[j] = b.rows[0] * basis.rows[j][0] + b.rows[1] * basis.rows[j][1] + b.rows[2] * basis.rows[j][2];
+		}
+		t.origin = xform(p_in[i].origin);
+		p_out[i] = t;
+	}
+}
+
 void Transform3D::operator*=(const real_t p_val) {
 	origin *= p_val;
 	basis *= p_val;
@@ -79,6 +79,11 @@ struct _NO_DISCARD_ Transform3D {
 	_FORCE_INLINE_ AABB xform(const AABB &p_aabb) const;
 	_FORCE_INLINE_ Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
 
+	// Batched versions for large arrays, p_in and p_out may point to the same array.
+	void xform_array(const Vector3 *p_in, Vector3 *p_out, int p_count) const;
+	// Sets each p_out[i] to (*this) * p_in[i].
+	void xform_array(const Transform3D *p_in, Transform3D *p_out, int p_count) const;
+
 	// NOTE: These are UNSAFE with non-uniform scaling, and will produce incorrect results.
 	// They use the transpose.
 	// For safe inverse transforms, xform by the affine_inverse.
@@ -209,12 +214,7 @@ Vector<Vector3> Transform3D::xform(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
 
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
+	xform_array(p_array.ptr(), array.ptrw(), p_array.size());
 	return array;
 }
 
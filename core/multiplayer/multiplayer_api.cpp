@@ -60,6 +60,9 @@ void MultiplayerAPI::poll() {
 		return;
 	}
 
+	// Send what was batched since the last poll before the peer services the connection.
+	rpc->on_network_process();
+
 	multiplayer_peer->poll();
 
 	if (!multiplayer_peer.is_valid()) { // It's possible that polling might have resulted in a disconnection, so check here.
@@ -77,6 +80,10 @@ void MultiplayerAPI::poll() {
 			return; // Something is wrong!
 		}
 
+#ifdef DEBUG_ENABLED
+		profile_bandwidth("in", len);
+#endif
+
 		remote_sender_id = sender;
 		_process_packet(sender, packet, len);
 		remote_sender_id = 0;
@@ -140,10 +147,6 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 	ERR_FAIL_COND_MSG(root_path.is_empty(), "Multiplayer root was not initialized. If you are using custom multiplayer, remember to set the root path via MultiplayerAPI.set_root_path before using it.");
 	ERR_FAIL_COND_MSG(p_packet_len < 1, "Invalid packet received. Size too small.");
 
-#ifdef DEBUG_ENABLED
-	profile_bandwidth("in", p_packet_len);
-#endif
-
 	// Extract the `packet_type` from the LSB three bits:
 	uint8_t packet_type = p_packet[0] & CMD_MASK;
 
@@ -172,6 +175,21 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 		case NETWORK_COMMAND_SYNC: {
 			replicator->on_sync_receive(p_from, p_packet, p_packet_len);
 		} break;
+		case NETWORK_COMMAND_BATCH: {
+			int ofs = 1;
+			while (ofs < p_packet_len) {
+				ERR_FAIL_COND_MSG(ofs + 2 > p_packet_len, "Invalid batch packet received. Size too small.");
+				int size = decode_uint16(&p_packet[ofs]);
+				ofs += 2;
+				ERR_FAIL_COND_MSG(size < 1 || ofs + size > p_packet_len, "Invalid batch packet received. Size smaller than declared.");
+				ERR_FAIL_COND_MSG((p_packet[ofs] & CMD_MASK) == NETWORK_COMMAND_BATCH, "Invalid batch packet received. Batches can't be nested.");
+				_process_packet(p_from, &p_packet[ofs], size);
+				if (!multiplayer_peer.is_valid()) {
+					return; // A packet in the batch might have caused a disconnection.
+				}
+				ofs += size;
+			}
+		} break;
 	}
 }
 
@@ -439,6 +457,7 @@ Error MultiplayerAPI::send_bytes(Vector<uint8_t> p_data, int p_to, Multiplayer::
 	packet_cache.write[0] = NETWORK_COMMAND_RAW;
 	memcpy(&packet_cache.write[1], &r[0], p_data.size());
 
+	flush_rpc_batches();
 	multiplayer_peer->set_target_peer(p_to);
 	multiplayer_peer->set_transfer_channel(p_channel);
 	multiplayer_peer->set_transfer_mode(p_mode);
@@ -459,6 +478,10 @@ void MultiplayerAPI::_process_raw(int p_from, const uint8_t *p_packet, int p_pac
 	emit_signal(SNAME("peer_packet"), p_from, out);
 }
 
+void MultiplayerAPI::flush_rpc_batches() {
+	rpc->on_network_process();
+}
+
 bool MultiplayerAPI::is_cache_confirmed(NodePath p_path, int p_peer) {
 	return cache->is_cache_confirmed(p_path, p_peer);
 }
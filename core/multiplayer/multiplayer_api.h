@@ -63,6 +63,7 @@ public:
 	virtual void rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) {}
 	virtual void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len) {}
 	virtual String get_rpc_md5(const Object *p_obj) const { return String(); }
+	virtual void on_network_process() {}
 
 	MultiplayerRPCInterface() {}
 };
@@ -97,6 +98,7 @@ public:
 		NETWORK_COMMAND_SPAWN,
 		NETWORK_COMMAND_DESPAWN,
 		NETWORK_COMMAND_SYNC,
+		NETWORK_COMMAND_BATCH, // Several packets sent as one, each prefixed by its 16 bits size.
 	};
 
 	// For each command, the 4 MSB can contain custom flags, as defined by subsystems.
@@ -160,6 +162,9 @@ public:
 	Error despawn(Object *p_object, Variant p_config);
 	Error replication_start(Object *p_object, Variant p_config);
 	Error replication_stop(Object *p_object, Variant p_config);
+	// RPC API
+	// Sends the RPCs batched so far. Other commands call it before sending, so they can't overtake them.
+	void flush_rpc_batches();
 	// Cache API
 	bool send_object_cache(Object *p_obj, int p_target, int &r_id);
 	int make_object_cache(Object *p_obj);
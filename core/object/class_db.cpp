@@ -32,6 +32,7 @@
 
 #include "core/config/engine.h"
 #include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/version.h"
 
 #define OBJTYPE_RLOCK RWLockRead _rw_lockr_(lock);
@@ -62,6 +63,10 @@ ClassDB::APIType ClassDB::get_current_api() {
 }
 
 HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
+SafeNumeric<uint64_t> ClassDB::method_cache_version(1);
+bool ClassDB::lazy_binding = false;
+SafeNumeric<uint32_t> ClassDB::pending_bind_count;
+Mutex ClassDB::bind_mutex;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
@@ -161,6 +166,8 @@ ClassDB::APIType ClassDB::get_api_type(const StringName &p_class) {
 }
 
 uint64_t ClassDB::get_api_hash(APIType p_api) {
+	_bind_all_pending_classes(); // Hashes every method, so needs all of them.
+
 	OBJTYPE_RLOCK;
 #ifdef DEBUG_METHODS_ENABLED
 
@@ -339,6 +346,20 @@ Object *ClassDB::instantiate(const StringName &p_class) {
 	}
 }
 
+ClassDB::CreationFunc ClassDB::get_creation_func(const StringName &p_class) {
+	OBJTYPE_RLOCK;
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || ti->native_extension) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 void ClassDB::set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance) {
 	ERR_FAIL_COND(!p_object);
 	ClassInfo *ti;
@@ -407,6 +428,91 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 	}
 }
 
+void ClassDB::_bind_class(const StringName &p_class, void (*p_bind_func)()) {
+	if (!lazy_binding) {
+		p_bind_func();
+		return;
+	}
+
+	OBJTYPE_WLOCK;
+
+	ClassInfo *ti = classes.getptr(p_class);
+	ERR_FAIL_COND_MSG(!ti, "Cannot get class '" + String(p_class) + "'.");
+	ti->pending_bind_func = p_bind_func;
+	pending_bind_count.increment();
+}
+
+void ClassDB::_bind_pending_class_slow(ClassInfo *p_class) {
+	LocalVector<ClassInfo *> pending;
+
+	{
+		OBJTYPE_RLOCK;
+
+		ClassInfo *ti = p_class;
+		while (ti) {
+			if (ti->pending_bind_func) {
+				pending.push_back(ti);
+			}
+			ti = ti->inherits_ptr;
+		}
+	}
+
+	// Held while binding, so other threads looking up the class wait until it's fully bound,
+	// while lookups from the _bind_methods() being run (the mutex is recursive) see what was bound so far.
+	MutexLock bind_lock(bind_mutex);
+
+	// Parents first, as binding may look up what they bound.
+	for (int64_t i = int64_t(pending.size()) - 1; i >= 0; i--) {
+		ClassInfo *ti = pending[i];
+		if (!ti->pending_bind_func || ti->binding) {
+			continue; // Bound by another thread meanwhile, or being bound up the stack.
+		}
+
+		ti->binding = true;
+		ti->pending_bind_func();
+		ti->binding = false;
+
+		{
+			OBJTYPE_WLOCK;
+			ti->pending_bind_func = nullptr;
+		}
+		pending_bind_count.decrement();
+	}
+
+	{
+		OBJTYPE_RLOCK;
+		for (ClassInfo *ti = p_class; ti; ti = ti->inherits_ptr) {
+			if (ti->pending_bind_func) {
+				return; // Still being bound up the stack.
+			}
+		}
+	}
+
+	// Parents of a bound class are bound too, so the next lookups of any of them take the fast path.
+	for (ClassInfo *ti = p_class; ti && !ti->bound.is_set(); ti = ti->inherits_ptr) {
+		ti->bound.set();
+	}
+}
+
+void ClassDB::_bind_all_pending_classes() {
+	if (pending_bind_count.get() == 0) {
+		return;
+	}
+
+	List<StringName> class_list;
+	get_class_list(&class_list);
+	for (const StringName &E : class_list) {
+		_bind_pending_class(E);
+	}
+}
+
+void ClassDB::set_lazy_binding(bool p_enabled) {
+	lazy_binding = p_enabled;
+	if (!p_enabled) {
+		_bind_all_pending_classes();
+	}
+}
+
 static MethodInfo info_from_bind(MethodBind *p_method) {
 	MethodInfo minfo;
 	minfo.name = p_method->get_name();
@@ -429,6 +535,8 @@ static MethodInfo info_from_bind(MethodBind *p_method) {
 }
 
 void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance, bool p_exclude_from_properties) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -479,6 +587,8 @@ void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_met
 }
 
 bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance, bool p_exclude_from_properties) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -529,6 +639,8 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 }
 
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -543,6 +655,43 @@ MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_n
 	return nullptr;
 }
 
+MethodBind *ClassDB::get_method_cached(const StringName &p_class, const StringName &p_name) {
+	// Small direct-mapped, per-thread cache in front of get_method(), so hot dynamic calls
+	// (signals, deferred calls, Callable::call) skip the lock and the inheritance walk.
+	// Entries are keyed by the interned name pointers; those stay alive as long as the
+	// class and the method bind do, and any change to either bumps the version.
+	struct CacheEntry {
+		const void *class_name = nullptr;
+		const void *method_name = nullptr;
+		uint64_t version = 0;
+		MethodBind *method = nullptr;
+	};
+	static const uint32_t CACHE_SIZE = 256;
+	static thread_local CacheEntry cache[CACHE_SIZE];
+
+	const void *class_key = p_class.data_unique_pointer();
+	const void *method_key = p_name.data_unique_pointer();
+	if (unlikely(!class_key || !method_key)) {
+		return get_method(p_class, p_name);
+	}
+
+	uint32_t slot = (p_class.hash() * 31 + p_name.hash()) & (CACHE_SIZE - 1);
+	CacheEntry &entry = cache[slot];
+	uint64_t version = method_cache_version.get();
+	if (entry.class_name == class_key && entry.method_name == method_key && entry.version == version) {
+		return entry.method;
+	}
+
+	MethodBind *method = get_method(p_class, p_name);
+	if (method) {
+		entry.class_name = class_key;
+		entry.method_name = method_key;
+		entry.version = version;
+		entry.method = method;
+	}
+	return method;
+}
+
 void ClassDB::bind_integer_constant(const StringName &p_class, const StringName &p_enum, const StringName &p_name, int64_t p_constant, bool p_is_bitfield) {
 	OBJTYPE_WLOCK;
 
@@ -581,6 +730,8 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 }
 
 void ClassDB::get_integer_constant_list(const StringName &p_class, List<String> *p_constants, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -606,6 +757,8 @@ void ClassDB::get_integer_constant_list(const StringName &p_class, List<String>
 }
 
 int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringName &p_name, bool *p_success) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -630,6 +783,8 @@ int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringNam
 }
 
 bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -649,6 +804,8 @@ bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &
 }
 
 StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -673,6 +830,8 @@ StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const S
 }
 
 void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -691,6 +850,8 @@ void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums
 }
 
 void ClassDB::get_enum_constants(const StringName &p_class, const StringName &p_enum, List<StringName> *p_constants, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -724,6 +885,8 @@ void ClassDB::set_method_error_return_values(const StringName &p_class, const St
 }
 
 Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class, const StringName &p_method) {
+	_bind_pending_class(p_class);
+
 #ifdef DEBUG_METHODS_ENABLED
 	ClassInfo *type = classes.getptr(p_class);
 
@@ -739,6 +902,8 @@ Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class,
 }
 
 bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -758,6 +923,8 @@ bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool
 }
 
 bool ClassDB::is_enum_bitfield(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -796,6 +963,8 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -817,6 +986,8 @@ void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_sig
 }
 
 bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -834,6 +1005,8 @@ bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal,
 }
 
 bool ClassDB::get_signal(const StringName &p_class, const StringName &p_signal, MethodInfo *r_signal) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -969,6 +1142,8 @@ void ClassDB::add_linked_property(const StringName &p_class, const String &p_pro
 }
 
 void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p_list, bool p_no_inheritance, const Object *p_validator) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -993,6 +1168,8 @@ void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p
 }
 
 bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance, const Object *p_validator) {
+	_bind_pending_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *check = classes.getptr(p_class);
@@ -1020,55 +1197,76 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 	ERR_FAIL_NULL_V(p_object, false);
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
-
-			Callable::CallError ce;
+			call_property_setter(p_object, psg, p_value, r_valid);
+			return true;
+		}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+		check = check->inherits_ptr;
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+	return false;
+}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	_bind_pending_class(p_class);
 
-			return true;
+	OBJTYPE_RLOCK;
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
 		}
 
 		check = check->inherits_ptr;
 	}
 
-	return false;
+	return nullptr;
+}
+
+void ClassDB::call_property_setter(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid) {
+	if (!p_setget->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return; // Do nothing.
+	}
+
+	Callable::CallError ce;
+
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[2] = { &index, &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(p_setget->setter, arg, 2, ce);
+		}
+
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(p_setget->setter, arg, 1, ce);
+		}
+	}
+
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1118,6 +1316,7 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
 	ClassInfo *type = classes.getptr(p_class);
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1140,6 +1339,7 @@ int ClassDB::get_property_index(const StringName &p_class, const StringName &p_p
 
 Variant::Type ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
 	ClassInfo *type = classes.getptr(p_class);
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1162,6 +1362,7 @@ Variant::Type ClassDB::get_property_type(const StringName &p_class, const String
 
 StringName ClassDB::get_property_setter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1177,6 +1378,7 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
@@ -1192,6 +1394,7 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		if (check->property_setget.has(p_property)) {
@@ -1218,6 +1421,7 @@ void ClassDB::set_method_flags(const StringName &p_class, const StringName &p_me
 
 bool ClassDB::has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
+	_bind_pending_class(type);
 	ClassInfo *check = type;
 	while (check) {
 		if (check->method_map.has(p_method)) {
@@ -1248,6 +1452,7 @@ void ClassDB::bind_method_custom(const StringName &p_class, MethodBind *p_method
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	method_cache_version.increment();
 }
 
 #ifdef DEBUG_METHODS_ENABLED
@@ -1294,6 +1499,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 #endif
 
 	type->method_map[mdname] = p_bind;
+	method_cache_version.increment();
 
 	Vector<Variant> defvals;
 
@@ -1342,6 +1548,8 @@ void ClassDB::add_virtual_method(const StringName &p_class, const MethodInfo &p_
 }
 
 void ClassDB::get_virtual_methods(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance) {
+	_bind_pending_class(p_class);
+
 	ERR_FAIL_COND_MSG(!classes.has(p_class), "Request for nonexistent class '" + p_class + "'.");
 
 #ifdef DEBUG_METHODS_ENABLED
@@ -1421,6 +1629,8 @@ HashMap<StringName, HashMap<StringName, Variant>> ClassDB::default_values;
 HashSet<StringName> ClassDB::default_values_cached;
 
 Variant ClassDB::class_get_default_property_value(const StringName &p_class, const StringName &p_property, bool *r_valid) {
+	_bind_pending_class(p_class);
+
 	if (!default_values_cached.has(p_class)) {
 		if (!default_values.has(p_class)) {
 			default_values[p_class] = HashMap<StringName, Variant>();
@@ -1518,6 +1728,7 @@ void ClassDB::register_extension_class(ObjectNativeExtension *p_extension) {
 void ClassDB::unregister_extension_class(const StringName &p_class) {
 	ERR_FAIL_COND(!classes.has(p_class));
 	classes.erase(p_class);
+	method_cache_version.increment();
 }
 
 HashMap<StringName, ClassDB::NativeStruct> ClassDB::native_structs;
@@ -1562,6 +1773,7 @@ void ClassDB::cleanup() {
 		}
 	}
 	classes.clear();
+	method_cache_version.increment();
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
@@ -33,6 +33,7 @@
 
 #include "core/object/method_bind.h"
 #include "core/object/object.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 
 // Makes callable_mp readily available in all classes connecting signals.
@@ -129,6 +130,16 @@ public:
 		bool exposed = false;
 		bool is_virtual = false;
 		Object *(*creation_func)() = nullptr;
+		void (*pending_bind_func)() = nullptr; // _bind_methods() of the class, until it's first looked up (see set_lazy_binding()).
+		bool binding = false;
+		// Copyable so ClassInfo can still be stored by value.
+		struct BoundFlag : public SafeFlag {
+			BoundFlag() {}
+			BoundFlag(const BoundFlag &p_other) :
+					SafeFlag(p_other.is_set()) {}
+			void operator=(const BoundFlag &p_other) { set_to(p_other.is_set()); }
+		};
+		BoundFlag bound; // Nothing is pending for the class and its parents anymore, checked without locking.
 
 		ClassInfo() {}
 		~ClassInfo() {}
@@ -141,6 +152,8 @@ public:
 
 	static RWLock lock;
 	static HashMap<StringName, ClassInfo> classes;
+	// Bumped whenever a method is bound or a class goes away, invalidating get_method_cached() entries.
+	static SafeNumeric<uint64_t> method_cache_version;
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -157,6 +170,23 @@ public:
 	static HashMap<StringName, HashMap<StringName, Variant>> default_values;
 	static HashSet<StringName> default_values_cached;
 
+	static bool lazy_binding;
+	static SafeNumeric<uint32_t> pending_bind_count;
+	static Mutex bind_mutex;
+
+	static void _bind_pending_class_slow(ClassInfo *p_class);
+	static void _bind_all_pending_classes();
+	// Runs the pending _bind_methods() of the class and its parents, must be called before looking up anything they bind.
+	_FORCE_INLINE_ static void _bind_pending_class(ClassInfo *p_class) {
+		if (unlikely(p_class && !p_class->bound.is_set())) {
+			_bind_pending_class_slow(p_class);
+		}
+	}
+	// For lookups done under the lock, which can't be held while binding.
+	_FORCE_INLINE_ static void _bind_pending_class(const StringName &p_class) {
+		_bind_pending_class(classes.getptr(p_class));
+	}
+
 	// Native structs, used by binder
 	struct NativeStruct {
 		String ccode; // C code to create the native struct, fields separated by ; Arrays accepted (even containing other structs), also function pointers. All types must be Godot types.
@@ -176,6 +206,9 @@ public:
 		_add_class2(T::get_class_static(), T::get_parent_class_static());
 	}
 
+	// Also called from initialize_class(), runs p_bind_func right away unless binding lazily.
+	static void _bind_class(const StringName &p_class, void (*p_bind_func)());
+
 	template <class T>
 	static void register_class(bool p_virtual = false) {
 		GLOBAL_LOCK_FUNCTION;
@@ -234,6 +267,9 @@ public:
 	static bool can_instantiate(const StringName &p_class);
 	static bool is_virtual(const StringName &p_class);
 	static Object *instantiate(const StringName &p_class);
+	// Returns the function instantiate() would call for p_class, or nullptr if it must be instantiated through instantiate().
+	typedef Object *(*CreationFunc)();
+	static CreationFunc get_creation_func(const StringName &p_class);
 	static void set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance);
 
 	static APIType get_api_type(const StringName &p_class);
@@ -313,6 +349,9 @@ public:
 	static void get_property_list(const StringName &p_class, List<PropertyInfo> *p_list, bool p_no_inheritance = false, const Object *p_validator = nullptr);
 	static bool get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance = false, const Object *p_validator = nullptr);
 	static bool set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid = nullptr);
+	// The setter set_property() uses for objects of p_class, so it can be called without looking it up again.
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+	static void call_property_setter(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid = nullptr);
 	static bool get_property(Object *p_object, const StringName &p_property, Variant &r_value);
 	static bool has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance = false);
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
@@ -326,6 +365,7 @@ public:
 	static void get_method_list(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance = false, bool p_exclude_from_properties = false);
 	static bool get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance = false, bool p_exclude_from_properties = false);
 	static MethodBind *get_method(const StringName &p_class, const StringName &p_name);
+	static MethodBind *get_method_cached(const StringName &p_class, const StringName &p_name);
 
 	static void add_virtual_method(const StringName &p_class, const MethodInfo &p_method, bool p_virtual = true, const Vector<String> &p_arg_names = Vector<String>(), bool p_object_core = false);
 	static void get_virtual_methods(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance = false);
@@ -361,6 +401,8 @@ public:
 
 	static void set_current_api(APIType p_api);
 	static APIType get_current_api();
+	static void set_lazy_binding(bool p_enabled);
+	static bool is_lazy_binding() { return lazy_binding; }
 	static void cleanup_defaults();
 	static void cleanup();
 
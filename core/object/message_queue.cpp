@@ -36,21 +36,153 @@
 #include "core/object/script_language.h"
 
 MessageQueue *MessageQueue::singleton = nullptr;
+uint64_t MessageQueue::last_queue_id = 0;
+thread_local MessageQueue::ThreadBufferRef MessageQueue::thread_buffer;
 
 MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
+MessageQueue::ThreadBufferRef::~ThreadBufferRef() {
+	// The queue may be gone already (or replaced by another one) when the thread exits.
+	if (buffer && singleton && singleton->queue_id == queue_id) {
+		singleton->_release_thread_buffer(buffer);
+	}
+}
+
+MessageQueue::ThreadBuffer *MessageQueue::_get_thread_buffer() {
+	if (likely(thread_buffer.queue_id == queue_id)) {
+		return thread_buffer.buffer;
+	}
+
+	_THREAD_SAFE_METHOD_
+
+	ThreadBuffer *tb;
+	if (free_buffers.size()) {
+		tb = free_buffers[free_buffers.size() - 1];
+		free_buffers.remove_at(free_buffers.size() - 1);
+		tb->released = false;
+	} else {
+		tb = memnew(ThreadBuffer);
+	}
+	thread_buffer.buffer = tb;
+	thread_buffer.queue_id = queue_id;
+	thread_buffers.push_back(tb);
+	return tb;
+}
+
+void MessageQueue::_release_thread_buffer(ThreadBuffer *p_buffer) {
+	_THREAD_SAFE_METHOD_
+	// Its messages may not be flushed yet, so it's only recycled by flush().
+	p_buffer->released = true;
+}
+
+void MessageQueue::_recycle_released_buffers() {
+	// Called with the queue locked, between flush rounds, so no read page is in use.
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *tb = thread_buffers[i];
+		if (!tb->released || tb->write.size > 0) {
+			continue;
+		}
+		thread_buffers.remove_at_unordered(i);
+		i--;
+		free_buffers.push_back(tb);
+	}
+}
+
+void MessageQueue::_shrink_page(Page &p_page, uint32_t p_used) {
+	// Give back the memory of a page that grew for a burst of messages, once it's mostly unused.
+	if (p_page.capacity <= INITIAL_PAGE_SIZE || p_used >= p_page.capacity / 4) {
+		return;
+	}
+
+	uint32_t new_capacity = INITIAL_PAGE_SIZE;
+	while (new_capacity < p_used * 2) {
+		new_capacity <<= 1;
+	}
+	p_page.data = (uint8_t *)memrealloc(p_page.data, new_capacity);
+	p_page.capacity = new_capacity;
+}
+
+void MessageQueue::_free_thread_buffer(ThreadBuffer *p_buffer) {
+	uint32_t read_pos = 0;
+	while (read_pos < p_buffer->write.size) {
+		Message *message = (Message *)&p_buffer->write.data[read_pos];
+		read_pos += _get_message_size(message);
+		_destroy_message(message);
+	}
+
+	if (p_buffer->write.data) {
+		memfree(p_buffer->write.data);
+	}
+	if (p_buffer->read.data) {
+		memfree(p_buffer->read.data);
+	}
+	memdelete(p_buffer);
+}
+
+uint8_t *MessageQueue::_alloc_message(ThreadBuffer *p_buffer, uint32_t p_room) {
+	Page &page = p_buffer->write;
+	uint32_t needed = page.size + p_room;
+
+	if (needed > page.capacity) {
+		if (needed >= buffer_size_limit) {
+			if (!allow_growth) {
+				return nullptr;
+			}
+			WARN_PRINT_ONCE("Message queue grew over 'memory/limits/message_queue/max_size_kb'. Consider increasing it in project settings.");
+		}
+
+		uint32_t new_capacity = MAX(page.capacity, (uint32_t)INITIAL_PAGE_SIZE);
+		while (new_capacity < needed) {
+			new_capacity <<= 1;
+		}
+		if (!allow_growth) {
+			new_capacity = MIN(new_capacity, buffer_size_limit);
+		}
+
+		// Messages only hold Callables and Variants, which can be moved in memory.
+		page.data = (uint8_t *)memrealloc(page.data, new_capacity);
+		page.capacity = new_capacity;
+	}
+
+	uint8_t *ret = &page.data[page.size];
+	page.size = needed;
+	return ret;
+}
+
+uint32_t MessageQueue::_get_message_size(const Message *p_message) {
+	uint32_t size = sizeof(Message);
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		size += sizeof(Variant) * p_message->args;
+	}
+	return size;
+}
+
+void MessageQueue::_destroy_message(Message *p_message) {
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int i = 0; i < p_message->args; i++) {
+			args[i].~Variant();
+		}
+	}
+
+	p_message->~Message();
+}
+
 Error MessageQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
 
 Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	_THREAD_SAFE_METHOD_
-
 	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	ThreadBuffer *tb = _get_thread_buffer();
+	tb->lock.lock();
+
+	uint8_t *mem = _alloc_message(tb, room_needed);
+	if (!mem) {
+		tb->lock.unlock();
 		String type;
 		if (ObjectDB::get_instance(p_id)) {
 			type = ObjectDB::get_instance(p_id)->get_class();
@@ -60,41 +192,45 @@ Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Vari
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(mem, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
+	msg->order = message_order.postincrement();
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
+	Variant *v = memnew_placement(mem + sizeof(Message), Variant);
 	*v = p_value;
 
+	tb->lock.unlock();
+
 	return OK;
 }
 
 Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
-	_THREAD_SAFE_METHOD_
-
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
 	uint8_t room_needed = sizeof(Message);
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	ThreadBuffer *tb = _get_thread_buffer();
+	tb->lock.lock();
+
+	uint8_t *mem = _alloc_message(tb, room_needed);
+	if (!mem) {
+		tb->lock.unlock();
 		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(mem, Message);
 
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
+	msg->order = message_order.postincrement();
 
-	buffer_end += sizeof(Message);
+	tb->lock.unlock();
 
 	return OK;
 }
@@ -112,32 +248,36 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 }
 
 Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	_THREAD_SAFE_METHOD_
-
 	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	ThreadBuffer *tb = _get_thread_buffer();
+	tb->lock.lock();
+
+	uint8_t *mem = _alloc_message(tb, room_needed);
+	if (!mem) {
+		tb->lock.unlock();
 		print_line("Failed method: " + p_callable);
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(mem, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
 	if (p_show_error) {
 		msg->type |= FLAG_SHOW_ERROR;
 	}
+	msg->order = message_order.postincrement();
 
-	buffer_end += sizeof(Message);
-
+	Variant *args = (Variant *)(msg + 1);
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
+		Variant *v = memnew_placement(&args[i], Variant);
 		*v = *p_args[i];
 	}
 
+	tb->lock.unlock();
+
 	return OK;
 }
 
@@ -146,56 +286,64 @@ void MessageQueue::statistics() {
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
 	int null_count = 0;
+	uint32_t total_bytes = 0;
 
-	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	_THREAD_SAFE_LOCK_
 
-		Object *target = message->callable.get_object();
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *tb = thread_buffers[i];
+		tb->lock.lock();
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (!call_count.has(message->callable)) {
-						call_count[message->callable] = 0;
-					}
+		uint32_t read_pos = 0;
+		while (read_pos < tb->write.size) {
+			Message *message = (Message *)&tb->write.data[read_pos];
 
-					call_count[message->callable]++;
+			Object *target = message->callable.get_object();
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (!notify_count.has(message->notification)) {
-						notify_count[message->notification] = 0;
-					}
+			if (target != nullptr) {
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						if (!call_count.has(message->callable)) {
+							call_count[message->callable] = 0;
+						}
 
-					notify_count[message->notification]++;
+						call_count[message->callable]++;
 
-				} break;
-				case TYPE_SET: {
-					StringName t = message->callable.get_method();
-					if (!set_count.has(t)) {
-						set_count[t] = 0;
-					}
+					} break;
+					case TYPE_NOTIFICATION: {
+						if (!notify_count.has(message->notification)) {
+							notify_count[message->notification] = 0;
+						}
 
-					set_count[t]++;
+						notify_count[message->notification]++;
 
-				} break;
-			}
+					} break;
+					case TYPE_SET: {
+						StringName t = message->callable.get_method();
+						if (!set_count.has(t)) {
+							set_count[t] = 0;
+						}
 
-		} else {
-			//object was deleted
-			print_line("Object was deleted while awaiting a callback");
+						set_count[t]++;
 
-			null_count++;
-		}
+					} break;
+				}
+
+			} else {
+				//object was deleted
+				null_count++;
+			}
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+			read_pos += _get_message_size(message);
 		}
+		total_bytes += tb->write.size;
+
+		tb->lock.unlock();
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	_THREAD_SAFE_UNLOCK_
+
+	print_line("TOTAL BYTES: " + itos(total_bytes));
 	print_line("NULL count: " + itos(null_count));
 
 	for (const KeyValue<StringName, int> &E : set_count) {
@@ -233,13 +381,6 @@ void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_a
 }
 
 void MessageQueue::flush() {
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
-	}
-
-	uint32_t read_pos = 0;
-
-	//using reverse locking strategy
 	_THREAD_SAFE_LOCK_
 
 	if (flushing) {
@@ -248,60 +389,90 @@ void MessageQueue::flush() {
 	}
 	flushing = true;
 
-	while (read_pos < buffer_end) {
-		//lock on each iteration, so a call can re-add itself to the message queue
+	_THREAD_SAFE_UNLOCK_
+
+	while (true) {
+		// Take the pending messages of every thread. Messages pushed from now on,
+		// including the ones pushed by the calls below, are run in the next round.
+		uint32_t used = 0;
 
-		Message *message = (Message *)&buffer[read_pos];
+		_THREAD_SAFE_LOCK_
+		_recycle_released_buffers();
+		for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+			ThreadBuffer *tb = thread_buffers[i];
+			tb->lock.lock();
+			if (tb->write.size > 0) {
+				SWAP(tb->write, tb->read);
+				tb->read_pos = 0;
+				used += tb->read.size;
+				flush_buffers.push_back(tb);
+			}
+			tb->lock.unlock();
+		}
+		_THREAD_SAFE_UNLOCK_
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
+		if (flush_buffers.is_empty()) {
+			break;
 		}
 
-		//pre-advance so this function is reentrant
-		read_pos += advance;
+		if (used > buffer_max_used) {
+			buffer_max_used = used;
+		}
 
-		_THREAD_SAFE_UNLOCK_
+		while (!flush_buffers.is_empty()) {
+			// Each buffer is already sorted, pick the oldest message among them.
+			uint32_t next = 0;
+			Message *message = (Message *)&flush_buffers[0]->read.data[flush_buffers[0]->read_pos];
+			for (uint32_t i = 1; i < flush_buffers.size(); i++) {
+				ThreadBuffer *tb = flush_buffers[i];
+				Message *m = (Message *)&tb->read.data[tb->read_pos];
+				if (m->order < message->order) {
+					message = m;
+					next = i;
+				}
+			}
 
-		Object *target = message->callable.get_object();
+			ThreadBuffer *tb = flush_buffers[next];
+			tb->read_pos += _get_message_size(message);
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					Variant *args = (Variant *)(message + 1);
+			Object *target = message->callable.get_object();
 
-					// messages don't expect a return value
+			if (target != nullptr) {
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						Variant *args = (Variant *)(message + 1);
 
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
+						// messages don't expect a return value
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					// messages don't expect a return value
-					target->notification(message->notification);
+						_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
 
-				} break;
-				case TYPE_SET: {
-					Variant *arg = (Variant *)(message + 1);
-					// messages don't expect a return value
-					target->set(message->callable.get_method(), *arg);
+					} break;
+					case TYPE_NOTIFICATION: {
+						// messages don't expect a return value
+						target->notification(message->notification);
 
-				} break;
-			}
-		}
+					} break;
+					case TYPE_SET: {
+						Variant *arg = (Variant *)(message + 1);
+						// messages don't expect a return value
+						target->set(message->callable.get_method(), *arg);
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int i = 0; i < message->args; i++) {
-				args[i].~Variant();
+					} break;
+				}
 			}
-		}
 
-		message->~Message();
+			_destroy_message(message);
 
-		_THREAD_SAFE_LOCK_
+			if (tb->read_pos >= tb->read.size) {
+				// Done with this buffer, so only the others are left to merge.
+				_shrink_page(tb->read, tb->read.size);
+				tb->read.size = 0;
+				flush_buffers.remove_at_unordered(next);
+			}
+		}
 	}
 
-	buffer_end = 0; // reset buffer
+	_THREAD_SAFE_LOCK_
 	flushing = false;
 	_THREAD_SAFE_UNLOCK_
 }
@@ -313,33 +484,21 @@ bool MessageQueue::is_flushing() const {
 MessageQueue::MessageQueue() {
 	ERR_FAIL_COND_MSG(singleton != nullptr, "A MessageQueue singleton already exists.");
 	singleton = this;
+	queue_id = ++last_queue_id;
 
-	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
+	buffer_size_limit = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
-	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+	buffer_size_limit *= 1024;
+	allow_growth = GLOBAL_DEF_RST("memory/limits/message_queue/allow_growth", true);
 }
 
 MessageQueue::~MessageQueue() {
-	uint32_t read_pos = 0;
-
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
-		Variant *args = (Variant *)(message + 1);
-		int argc = message->args;
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			for (int i = 0; i < argc; i++) {
-				args[i].~Variant();
-			}
-		}
-		message->~Message();
-
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
-		}
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		_free_thread_buffer(thread_buffers[i]);
+	}
+	for (uint32_t i = 0; i < free_buffers.size(); i++) {
+		_free_thread_buffer(free_buffers[i]);
 	}
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
 }
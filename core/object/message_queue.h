@@ -32,7 +32,10 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object/object_id.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -41,7 +44,8 @@ class MessageQueue {
 	_THREAD_SAFE_CLASS_
 
 	enum {
-		DEFAULT_QUEUE_SIZE_KB = 4096
+		DEFAULT_QUEUE_SIZE_KB = 4096,
+		INITIAL_PAGE_SIZE = 16 * 1024,
 	};
 
 	enum {
@@ -55,6 +59,7 @@ class MessageQueue {
 
 	struct Message {
 		Callable callable;
+		uint64_t order; // Global push order, used to merge the per-thread buffers.
 		int16_t type;
 		union {
 			int16_t notification;
@@ -62,10 +67,49 @@ class MessageQueue {
 		};
 	};
 
-	uint8_t *buffer = nullptr;
-	uint32_t buffer_end = 0;
+	struct Page {
+		uint8_t *data = nullptr;
+		uint32_t size = 0;
+		uint32_t capacity = 0;
+	};
+
+	// Every thread pushing messages writes to its own buffer, so threads only
+	// contend with the flushing thread while it swaps the pages.
+	struct ThreadBuffer {
+		SpinLock lock;
+		Page write;
+		Page read; // Only used by the flushing thread.
+		uint32_t read_pos = 0;
+		bool released = false; // Its thread exited, recycled once its messages are flushed.
+	};
+
+	// Releases the buffer of the thread when it exits.
+	struct ThreadBufferRef {
+		ThreadBuffer *buffer = nullptr;
+		uint64_t queue_id = 0;
+		~ThreadBufferRef();
+	};
+
+	LocalVector<ThreadBuffer *> thread_buffers;
+	LocalVector<ThreadBuffer *> flush_buffers;
+	LocalVector<ThreadBuffer *> free_buffers; // Released by threads that exited, for new threads to reuse.
+	SafeNumeric<uint64_t> message_order;
+	uint64_t queue_id = 0;
 	uint32_t buffer_max_used = 0;
-	uint32_t buffer_size = 0;
+	uint32_t buffer_size_limit = 0;
+	bool allow_growth = true;
+
+	static uint64_t last_queue_id;
+	static thread_local ThreadBufferRef thread_buffer;
+
+	ThreadBuffer *_get_thread_buffer();
+	void _release_thread_buffer(ThreadBuffer *p_buffer);
+	void _recycle_released_buffers();
+	static void _shrink_page(Page &p_page, uint32_t p_used);
+	static void _free_thread_buffer(ThreadBuffer *p_buffer);
+	uint8_t *_alloc_message(ThreadBuffer *p_buffer, uint32_t p_room);
+	static uint32_t _get_message_size(const Message *p_message);
+	static void _destroy_message(Message *p_message);
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
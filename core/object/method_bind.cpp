@@ -34,6 +34,49 @@
 
 #include "method_bind.h"
 
+#include "core/variant/variant_internal.h"
+
+bool MethodBind::get_ptrcall_arguments(const Variant **p_args, int p_argcount, const void **r_ptr_args) const {
+	if (is_vararg() || is_static() || p_argcount != argument_count || p_argcount > MAX_PTRCALL_ARGUMENTS) {
+		return false;
+	}
+
+	if (_returns && argument_types[0] == Variant::OBJECT) {
+		return false;
+	}
+
+	for (int i = 0; i < p_argcount; i++) {
+		Variant::Type type = argument_types[i + 1];
+		if (type == Variant::NIL) {
+			// The method takes a Variant, pass it as is.
+			r_ptr_args[i] = p_args[i];
+		} else if (type != Variant::OBJECT && p_args[i]->get_type() == type) {
+			r_ptr_args[i] = VariantInternal::get_opaque_pointer(p_args[i]);
+		} else {
+			return false;
+		}
+	}
+	return true;
+}
+
+void MethodBind::ptrcall_variant_return(Object *p_object, const void **p_ptr_args, Variant &r_ret) {
+	if (!_returns) {
+		ptrcall(p_object, p_ptr_args, nullptr);
+		r_ret = Variant();
+		return;
+	}
+
+	Variant::Type ret_type = argument_types[0];
+	if (ret_type == Variant::NIL) {
+		ptrcall(p_object, p_ptr_args, &r_ret);
+	} else {
+		if (r_ret.get_type() != ret_type) {
+			VariantInternal::initialize(&r_ret, ret_type);
+		}
+		ptrcall(p_object, p_ptr_args, VariantInternal::get_opaque_pointer(&r_ret));
+	}
+}
+
 uint32_t MethodBind::get_hash() const {
 	uint32_t hash = hash_murmur3_one_32(has_return() ? 1 : 0);
 	hash = hash_murmur3_one_32(get_argument_count(), hash);
@@ -113,6 +113,16 @@ public:
 	virtual Variant call(Object *p_object, const Variant **p_args, int p_arg_count, Callable::CallError &r_error) = 0;
 	virtual void ptrcall(Object *p_object, const void **p_args, void *r_ret) = 0;
 
+	enum {
+		MAX_PTRCALL_ARGUMENTS = 8,
+	};
+
+	// Points r_ptr_args (of MAX_PTRCALL_ARGUMENTS elements) at the values of p_args when they already have the exact types
+	// the method takes, so it can be called with ptrcall_variant_return(). Returns false when the call has to go through the
+	// generic call() (defaults, conversions, objects, varargs...).
+	bool get_ptrcall_arguments(const Variant **p_args, int p_argcount, const void **r_ptr_args) const;
+	void ptrcall_variant_return(Object *p_object, const void **p_ptr_args, Variant &r_ret);
+
 	StringName get_name() const;
 	void set_name(const StringName &p_name);
 	_FORCE_INLINE_ int get_method_id() const { return method_id; }
@@ -38,6 +38,8 @@
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "core/string/translation.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -625,6 +627,23 @@ Variant Object::callv(const StringName &p_method, const Array &p_args) {
 	return ret;
 }
 
+// Calls through ptrcall when the arguments already have the exact types the method expects,
+// skipping the per-argument Variant conversion done by MethodBind::call(). Returns false when
+// the call has to go through the generic path (defaults, conversions, objects, varargs...).
+static bool _try_method_ptrcall(MethodBind *p_method, Object *p_object, const Variant **p_args, int p_argcount, Variant &r_ret) {
+	const void *ptr_args[MethodBind::MAX_PTRCALL_ARGUMENTS];
+	if (!p_method->get_ptrcall_arguments(p_args, p_argcount, ptr_args)) {
+		return false;
+	}
+	p_method->ptrcall_variant_return(p_object, ptr_args, r_ret);
+	return true;
+}
+
+void Object::method_ptrcall(MethodBind *p_method, const void **p_ptr_args, Variant &r_ret) {
+	OBJ_DEBUG_LOCK
+	p_method->ptrcall_variant_return(this, p_ptr_args, r_ret);
+}
+
 Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
 	r_error.error = Callable::CallError::CALL_OK;
 
@@ -678,10 +697,12 @@ Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_
 
 	//extension does not need this, because all methods are registered in MethodBind
 
-	MethodBind *method = ClassDB::get_method(get_class_name(), p_method);
+	MethodBind *method = ClassDB::get_method_cached(get_class_name(), p_method);
 
 	if (method) {
-		ret = method->call(this, p_args, p_argcount, r_error);
+		if (!_try_method_ptrcall(method, this, p_args, p_argcount, ret)) {
+			ret = method->call(this, p_args, p_argcount, r_error);
+		}
 	} else {
 		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
 	}
@@ -962,18 +983,30 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
-	List<_ObjectSignalDisconnectData> disconnect_data;
+	LocalVector<_ObjectSignalDisconnectData> disconnect_data;
 
-	//copy on write will ensure that disconnecting the signal or even deleting the object will not affect the signal calling.
-	//this happens automatically and will not change the performance of calling.
-	//awesome, isn't it?
+	// Copy on write ensures that disconnecting the signal or even deleting the object during
+	// emission will not affect the signal calling. Taking the copy only adds a reference,
+	// the slots themselves are duplicated just when a connection changes mid-emission.
 	VMap<Callable, SignalData::Slot> slot_map = s->slot_map;
 
 	int ssize = slot_map.size();
 
 	OBJ_DEBUG_LOCK
 
-	Vector<const Variant *> bind_mem;
+	// Room for the emitted arguments followed by the largest set of bound arguments,
+	// reserved once on the stack so connections with binds don't allocate either.
+	int max_binds = 0;
+	for (int i = 0; i < ssize; i++) {
+		max_binds = MAX(max_binds, slot_map.getv(i).conn.binds.size());
+	}
+	const Variant **bind_mem = nullptr;
+	if (max_binds > 0) {
+		bind_mem = (const Variant **)alloca(sizeof(Variant *) * (p_argcount + max_binds));
+		for (int j = 0; j < p_argcount; j++) {
+			bind_mem[j] = p_args[j];
+		}
+	}
 
 	Error err = OK;
 
@@ -991,17 +1024,12 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 		if (c.binds.size()) {
 			//handle binds
-			bind_mem.resize(p_argcount + c.binds.size());
-
-			for (int j = 0; j < p_argcount; j++) {
-				bind_mem.write[j] = p_args[j];
-			}
 			for (int j = 0; j < c.binds.size(); j++) {
-				bind_mem.write[p_argcount + j] = &c.binds[j];
+				bind_mem[p_argcount + j] = &c.binds[j];
 			}
 
-			args = (const Variant **)bind_mem.ptr();
-			argc = bind_mem.size();
+			args = bind_mem;
+			argc = p_argcount + c.binds.size();
 		}
 
 		if (c.flags & CONNECT_DEFERRED) {
@@ -1043,11 +1071,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	while (!disconnect_data.is_empty()) {
-		const _ObjectSignalDisconnectData &dd = disconnect_data.front()->get();
-
-		_disconnect(dd.signal, dd.callable);
-		disconnect_data.pop_front();
+	for (uint32_t i = 0; i < disconnect_data.size(); i++) {
+		_disconnect(disconnect_data[i].signal, disconnect_data[i].callable);
 	}
 
 	return err;
@@ -418,7 +418,7 @@ public:
 		m_inherits::initialize_class();                                                                                                          \
 		::ClassDB::_add_class<m_class>();                                                                                                        \
 		if (m_class::_get_bind_methods() != m_inherits::_get_bind_methods()) {                                                                   \
-			_bind_methods();                                                                                                                     \
+			::ClassDB::_bind_class(get_class_static(), &m_class::_bind_methods);                                                                 \
 		}                                                                                                                                        \
 		initialized = true;                                                                                                                      \
 	}                                                                                                                                            \
@@ -766,6 +766,9 @@ public:
 	Variant callv(const StringName &p_method, const Array &p_args);
 	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	virtual Variant call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	// Calls a native method already resolved for this object's class, with arguments from MethodBind::get_ptrcall_arguments().
+	// Skips the script and method lookups of callp(), so only valid for objects without a script instance.
+	void method_ptrcall(MethodBind *p_method, const void **p_ptr_args, Variant &r_ret);
 
 	template <typename... VarArgs>
 	Variant call(const StringName &p_method, VarArgs... p_args) {
@@ -41,17 +41,91 @@ void WorkerThreadPool::Task::free_template_userdata() {
 
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
+thread_local WorkerThreadPool::ThreadData *WorkerThreadPool::current_thread_data = nullptr;
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_task() {
+	// The caller consumed a post from task_available_semaphore, so a task is guaranteed to be
+	// in one of the queues. Steals may fail spuriously when racing with other threads, so keep
+	// looking until it is found.
+	ThreadData *td = current_thread_data;
+	uint32_t thread_count = threads.size();
+	uint32_t victim = td ? td->index + 1 : 0;
+	Task *task = nullptr;
+
+	while (true) {
+		// Own queue first, most recently posted tasks are the most likely to be hot in cache.
+		if (td && td->local_queue.pop(task)) {
+			return task;
+		}
+
+		if (global_queue_count.get() > 0) {
+			task_mutex.lock();
+			if (task_queue.first()) {
+				task = task_queue.first()->self();
+				task_queue.remove(task_queue.first());
+				global_queue_count.decrement();
+				task_mutex.unlock();
+				return task;
+			}
+			task_mutex.unlock();
+		}
+
+		for (uint32_t i = 0; i < thread_count; i++, victim++) {
+			ThreadData &other = threads[victim % thread_count];
+			if (&other == td) {
+				continue;
+			}
+			if (other.local_queue.steal(task) == WorkStealingQueue<Task *>::STEAL_OK) {
+				return task;
+			}
+		}
+	}
+}
+
 void WorkerThreadPool::_process_task_queue() {
-	task_mutex.lock();
-	Task *task = task_queue.first()->self();
-	task_queue.remove(task_queue.first());
-	task_mutex.unlock();
-	_process_task(task);
+	_process_task(_pop_task());
+}
+
+void WorkerThreadPool::_push_task(Task *p_task) {
+	// Tasks posted from within a pool thread go to its own queue, so they don't contend on task_mutex.
+	ThreadData *td = current_thread_data;
+	if (!td || !td->local_queue.push(p_task)) {
+		task_mutex.lock();
+		task_queue.add_last(&p_task->task_elem);
+		global_queue_count.increment();
+		task_mutex.unlock();
+	}
+	task_available_semaphore.post();
+}
+
+void WorkerThreadPool::_add_profiling_event(const String &p_description, uint64_t p_begin_usec) {
+	ProfilingBuffer &buffer = current_thread_data ? current_thread_data->profiling_buffer : external_profiling_buffer;
+	uint64_t end_usec = OS::get_singleton()->get_ticks_usec();
+
+	buffer.lock.lock();
+	if (buffer.events.size()) { // May have been disabled while the task was running.
+		ProfilingEvent &event = buffer.events[buffer.write_pos];
+		event.description = p_description;
+		event.begin_usec = p_begin_usec;
+		event.end_usec = end_usec;
+		event.thread_index = current_thread_data ? int(current_thread_data->index) : -1;
+		buffer.write_pos = (buffer.write_pos + 1) % buffer.events.size();
+		buffer.count = MIN(buffer.count + 1, buffer.events.size());
+	}
+	buffer.lock.unlock();
 }
 
 void WorkerThreadPool::_process_task(Task *p_task) {
 	bool low_priority = p_task->low_priority;
 
+	// The task may be freed by the time it's done, so keep what's needed for profiling.
+	uint64_t profiling_begin_usec = 0;
+	String profiling_description;
+	if (profiling_enabled.is_set()) {
+		profiling_begin_usec = OS::get_singleton()->get_ticks_usec();
+		profiling_description = p_task->description;
+	}
+
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
@@ -87,6 +161,11 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			memdelete(p_task->template_userdata); // This is no longer needed at this point, so get rid of it.
 		}
 
+		if (do_post) {
+			// Must happen before anyone waiting on the group is woken up, as they may free it.
+			_release_dependents(p_task->group->dependents);
+		}
+
 		if (low_priority && use_native_low_priority_threads) {
 			p_task->completed = true;
 			p_task->done_semaphore.post();
@@ -126,30 +205,35 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call(nullptr, 0, ret, ce);
 		}
 
+		_release_dependents(p_task->dependents);
+
 		p_task->completed = true;
 		p_task->done_semaphore.post();
 	}
 
 	if (!use_native_low_priority_threads && low_priority) {
 		// A low prioriry task was freed, so see if we can move a pending one to the high priority queue.
-		bool post = false;
+		Task *low_prio_task = nullptr;
 		task_mutex.lock();
 		if (low_priority_task_queue.first()) {
-			Task *low_prio_task = low_priority_task_queue.first()->self();
+			low_prio_task = low_priority_task_queue.first()->self();
 			low_priority_task_queue.remove(low_priority_task_queue.first());
-			task_queue.add_last(&low_prio_task->task_elem);
-			post = true;
 		} else {
 			low_priority_threads_used.decrement();
 		}
-		task_mutex.lock();
-		if (post) {
-			task_available_semaphore.post();
+		task_mutex.unlock();
+		if (low_prio_task) {
+			_push_task(low_prio_task);
 		}
 	}
+
+	if (profiling_begin_usec) {
+		_add_profiling_event(profiling_description, profiling_begin_usec);
+	}
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
+	current_thread_data = (ThreadData *)p_user;
 	while (true) {
 		singleton->task_available_semaphore.wait();
 		if (singleton->exit_threads.is_set()) {
@@ -173,12 +257,11 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 		p_task->low_priority_thread->start(_native_low_priority_thread_function, p_task); // Pask task directly to thread.
 
 	} else if (p_high_priority || low_priority_threads_used.get() < max_low_priority_threads) {
-		task_queue.add_last(&p_task->task_elem);
 		if (!p_high_priority) {
 			low_priority_threads_used.increment();
 		}
 		task_mutex.unlock();
-		task_available_semaphore.post();
+		_push_task(p_task);
 	} else {
 		// Too many threads using low priority, must go to queue.
 		low_priority_task_queue.add_last(&p_task->task_elem);
@@ -186,11 +269,81 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 	}
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
-	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
+void WorkerThreadPool::_post_group_tasks(Group *p_group) {
+	if (p_group->pending_tasks.is_empty()) {
+		// Empty group, it completes as soon as its dependencies do.
+		_release_dependents(p_group->dependents);
+		p_group->completed.set_to(true);
+		p_group->done_semaphore.post();
+		return;
+	}
+
+	for (uint32_t i = 0; i < p_group->pending_tasks.size(); i++) {
+		_post_task(p_group->pending_tasks[i], p_group->high_priority);
+	}
+}
+
+void WorkerThreadPool::_add_dependencies(const Vector<TaskID> &p_dependencies, Task *p_task, Group *p_group) {
+	// Called with task_mutex locked, so dependencies can't be freed from under us.
+	// The caller holds an extra pending dependency, so nothing is posted until it releases it.
+	for (int i = 0; i < p_dependencies.size(); i++) {
+		TaskID dep_id = p_dependencies[i];
+		ERR_CONTINUE_MSG(dep_id < 1 || dep_id >= (TaskID)last_task, "Invalid Task ID used as dependency: " + itos(dep_id));
+
+		Dependents *dependents = nullptr;
+		Task **taskp = tasks.getptr(dep_id);
+		if (taskp) {
+			dependents = &(*taskp)->dependents;
+		} else {
+			Group **groupp = groups.getptr(dep_id);
+			if (groupp) {
+				dependents = &(*groupp)->dependents;
+			}
+		}
+
+		if (!dependents) {
+			continue; // Already completed and waited for.
+		}
+
+		dependents->lock.lock();
+		if (!dependents->released) {
+			if (p_task) {
+				dependents->tasks.push_back(p_task);
+				p_task->pending_dependencies.increment();
+			} else {
+				dependents->groups.push_back(p_group);
+				p_group->pending_dependencies.increment();
+			}
+		}
+		dependents->lock.unlock();
+	}
+}
+
+void WorkerThreadPool::_release_dependents(Dependents &p_dependents) {
+	p_dependents.lock.lock();
+	p_dependents.released = true;
+	p_dependents.lock.unlock();
+
+	// Once released, the lists are no longer modified by other threads.
+	for (uint32_t i = 0; i < p_dependents.tasks.size(); i++) {
+		Task *task = p_dependents.tasks[i];
+		if (task->pending_dependencies.decrement() == 0) {
+			_post_task(task, !task->low_priority);
+		}
+	}
+	for (uint32_t i = 0; i < p_dependents.groups.size(); i++) {
+		Group *group = p_dependents.groups[i];
+		if (group->pending_dependencies.decrement() == 0) {
+			_post_group_tasks(group);
+		}
+	}
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -200,16 +353,21 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
+	task->pending_dependencies.set(1);
+	_add_dependencies(p_dependencies, task, nullptr);
 	tasks.insert(id, task);
 	task_mutex.unlock();
 
-	_post_task(task, p_high_priority);
+	if (task->pending_dependencies.decrement() == 0) {
+		_post_task(task, p_high_priority);
+	}
 
 	return id;
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bool p_high_priority, const String &p_description) {
-	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
+WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
 }
 
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
@@ -250,6 +408,8 @@ void WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	task_mutex.unlock();
 
 	if (use_native_low_priority_threads && task->low_priority) {
+		// The thread is only started once the task has no pending dependencies.
+		task->done_semaphore.wait();
 		task->low_priority_thread->wait_to_finish();
 		native_thread_allocator.free(task->low_priority_thread);
 	} else {
@@ -280,7 +440,7 @@ void WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	task_mutex.unlock();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = threads.size();
@@ -291,12 +451,10 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	GroupID id = last_task++;
 	group->max = p_elements;
 	group->self = id;
+	group->high_priority = p_high_priority;
 
-	Task **tasks_posted = nullptr;
 	if (p_elements == 0) {
 		// Should really not call it with zero Elements, but at least it should work.
-		group->completed.set_to(true);
-		group->done_semaphore.post();
 		group->tasks_used = 0;
 		p_tasks = 0;
 		if (p_template_userdata) {
@@ -305,7 +463,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	} else {
 		group->tasks_used = p_tasks;
-		tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
+		group->pending_tasks.resize(p_tasks);
 		for (int i = 0; i < p_tasks; i++) {
 			Task *task = task_allocator.alloc();
 			task->native_group_func = p_func;
@@ -314,34 +472,34 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
-			tasks_posted[i] = task;
+			group->pending_tasks[i] = task;
 			// No task ID is used.
 		}
 	}
 
-	groups[id] = group;
-	task_mutex.unlock();
-
 	if (!p_high_priority && use_native_low_priority_threads) {
-		group->low_priority_native_tasks.resize(p_tasks);
+		group->low_priority_native_tasks = group->pending_tasks;
 	}
 
-	for (int i = 0; i < p_tasks; i++) {
-		_post_task(tasks_posted[i], p_high_priority);
-		if (!p_high_priority && use_native_low_priority_threads) {
-			group->low_priority_native_tasks[i] = tasks_posted[i];
-		}
+	group->pending_dependencies.set(1);
+	_add_dependencies(p_dependencies, nullptr, group);
+
+	groups[id] = group;
+	task_mutex.unlock();
+
+	if (group->pending_dependencies.decrement() == 0) {
+		_post_group_tasks(group);
 	}
 
 	return id;
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 }
 
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
@@ -370,14 +528,16 @@ bool WorkerThreadPool::is_group_task_completed(GroupID p_group) const {
 void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	task_mutex.lock();
 	Group **groupp = groups.getptr(p_group);
+	Group *group = groupp ? *groupp : nullptr;
 	task_mutex.unlock();
-	if (!groupp) {
+	if (!group) {
 		ERR_FAIL_MSG("Invalid Group ID");
 	}
-	Group *group = *groupp;
 
 	if (group->low_priority_native_tasks.size() > 0) {
 		for (uint32_t i = 0; i < group->low_priority_native_tasks.size(); i++) {
+			// Threads are only started once the group has no pending dependencies.
+			group->low_priority_native_tasks[i]->done_semaphore.wait();
 			group->low_priority_native_tasks[i]->low_priority_thread->wait_to_finish();
 			native_thread_allocator.free(group->low_priority_native_tasks[i]->low_priority_thread);
 			task_mutex.lock();
@@ -386,11 +546,17 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 		}
 
 		task_mutex.lock();
+		groups.erase(p_group);
 		group_allocator.free(group);
 		task_mutex.unlock();
 	} else {
 		group->done_semaphore.wait();
 
+		// Must be removed before it can be freed, other threads may be looking up dependencies.
+		task_mutex.lock();
+		groups.erase(p_group);
+		task_mutex.unlock();
+
 		uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = group->finished.increment(); // fetch happens before inc, so increment later.
 
@@ -401,8 +567,47 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			task_mutex.unlock();
 		}
 	}
+}
+
+void WorkerThreadPool::set_profiling_enabled(bool p_enabled) {
+	if (p_enabled == profiling_enabled.is_set()) {
+		return;
+	}
 
-	groups.erase(p_group); // Threads do not access this, so safe to erase here.
+	if (!p_enabled) {
+		profiling_enabled.clear();
+	}
+
+	for (uint32_t i = 0; i <= threads.size(); i++) {
+		ProfilingBuffer &buffer = i < threads.size() ? threads[i].profiling_buffer : external_profiling_buffer;
+		buffer.lock.lock();
+		if (p_enabled) {
+			buffer.events.resize(PROFILING_BUFFER_SIZE);
+		} else {
+			buffer.events.reset();
+		}
+		buffer.write_pos = 0;
+		buffer.count = 0;
+		buffer.lock.unlock();
+	}
+
+	if (p_enabled) {
+		profiling_enabled.set();
+	}
+}
+
+void WorkerThreadPool::flush_profiling_events(LocalVector<ProfilingEvent> &r_events) {
+	for (uint32_t i = 0; i <= threads.size(); i++) {
+		ProfilingBuffer &buffer = i < threads.size() ? threads[i].profiling_buffer : external_profiling_buffer;
+		buffer.lock.lock();
+		uint32_t size = buffer.events.size();
+		uint32_t read_pos = (buffer.write_pos + size - buffer.count) % MAX(size, 1u);
+		for (uint32_t j = 0; j < buffer.count; j++) {
+			r_events.push_back(buffer.events[(read_pos + j) % size]);
+		}
+		buffer.count = 0;
+		buffer.lock.unlock();
+	}
 }
 
 void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_priority, float p_low_priority_task_ratio) {
@@ -455,11 +660,11 @@ void WorkerThreadPool::finish() {
 }
 
 void WorkerThreadPool::_bind_methods() {
-	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description", "dependencies"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()), DEFVAL(Vector<TaskID>()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
-	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description", "dependencies"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()), DEFVAL(Vector<TaskID>()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
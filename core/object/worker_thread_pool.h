@@ -34,11 +34,13 @@
 #include "core/os/memory.h"
 #include "core/os/os.h"
 #include "core/os/semaphore.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_queue.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -50,8 +52,35 @@ public:
 	typedef int64_t TaskID;
 	typedef int64_t GroupID;
 
+	struct ProfilingEvent {
+		String description;
+		uint64_t begin_usec = 0;
+		uint64_t end_usec = 0;
+		int thread_index = -1; // -1 for threads not owned by the pool (such as native low priority threads).
+	};
+
 private:
+	enum {
+		PROFILING_BUFFER_SIZE = 4096 // Events per thread, older ones are overwritten if not flushed in time.
+	};
+
+	struct ProfilingBuffer {
+		SpinLock lock;
+		LocalVector<ProfilingEvent> events;
+		uint32_t write_pos = 0;
+		uint32_t count = 0;
+	};
+
 	struct Task;
+	struct Group;
+
+	// Tasks and groups waiting for this one to complete before they can be posted.
+	struct Dependents {
+		SpinLock lock;
+		bool released = false; // Set once completed, no further dependents can be added.
+		TightLocalVector<Task *> tasks;
+		TightLocalVector<Group *> groups;
+	};
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
@@ -69,6 +98,10 @@ private:
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
 		TightLocalVector<Task *> low_priority_native_tasks;
+		bool high_priority = false;
+		SafeNumeric<uint32_t> pending_dependencies;
+		TightLocalVector<Task *> pending_tasks; // Tasks not posted yet because of dependencies.
+		Dependents dependents;
 	};
 
 	struct Task {
@@ -85,6 +118,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		Thread *low_priority_thread = nullptr;
+		SafeNumeric<uint32_t> pending_dependencies;
+		Dependents dependents;
 
 		void free_template_userdata();
 		Task() :
@@ -96,7 +131,8 @@ private:
 	PagedAllocator<Thread> native_thread_allocator;
 
 	SelfList<Task>::List low_priority_task_queue;
-	SelfList<Task>::List task_queue;
+	SelfList<Task>::List task_queue; // Tasks posted from outside the pool threads.
+	SafeNumeric<uint32_t> global_queue_count;
 
 	Mutex task_mutex;
 	Semaphore task_available_semaphore;
@@ -104,11 +140,18 @@ private:
 	struct ThreadData {
 		uint32_t index;
 		Thread thread;
+		// Tasks posted from this thread go here first, so they are processed
+		// by it in LIFO order (cache friendly) or stolen by idle threads.
+		WorkStealingQueue<Task *> local_queue;
+		ProfilingBuffer profiling_buffer;
 	};
 
 	TightLocalVector<ThreadData> threads;
 	SafeFlag exit_threads;
 
+	SafeFlag profiling_enabled;
+	ProfilingBuffer external_profiling_buffer;
+
 	HashMap<Thread::ID, int> thread_ids;
 	HashMap<TaskID, Task *> tasks;
 	HashMap<GroupID, Group *> groups;
@@ -119,18 +162,27 @@ private:
 
 	uint64_t last_task = 1;
 
+	static thread_local ThreadData *current_thread_data;
+
 	static void _thread_function(void *p_user);
 	static void _native_low_priority_thread_function(void *p_user);
 
+	Task *_pop_task();
 	void _process_task_queue();
+	void _add_profiling_event(const String &p_description, uint64_t p_begin_usec);
 	void _process_task(Task *task);
 
+	void _push_task(Task *p_task);
 	void _post_task(Task *p_task, bool p_high_priority);
+	void _post_group_tasks(Group *p_group);
+
+	void _add_dependencies(const Vector<TaskID> &p_dependencies, Task *p_task, Group *p_group);
+	void _release_dependents(Dependents &p_dependents);
 
 	static WorkerThreadPool *singleton;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies);
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies);
 
 	template <class C, class M, class U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -156,37 +208,49 @@ protected:
 	static void _bind_methods();
 
 public:
+	// All add_*task() functions take an optional list of task or group IDs that must complete
+	// before the new task (or group) starts. This allows building dependency graphs where each
+	// stage is run as a continuation of the previous ones, instead of waiting on each of them.
+	// Dependencies that already completed (or were already waited for) are ignored.
 	template <class C, class M, class U>
-	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
+	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>()) {
 		typedef TaskUserData<C, M, U> TUD;
 		TUD *ud = memnew(TUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description);
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
 	}
-	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
-	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
+	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 
 	bool is_task_completed(TaskID p_task_id) const;
 	void wait_for_task_completion(TaskID p_task_id);
 
 	template <class C, class M, class U>
-	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>()) {
 		typedef GroupUserData<C, M, U> GUD;
 		GUD *ud = memnew(GUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 	}
-	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
-	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
+	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
+	// Index of the pool thread calling this function, or -1 if the caller is not a pool thread.
+	_FORCE_INLINE_ int get_thread_index() const { return current_thread_data ? int(current_thread_data->index) : -1; }
+
+	// Opt-in recording of when each task starts and ends, and which thread runs it.
+	void set_profiling_enabled(bool p_enabled);
+	_FORCE_INLINE_ bool is_profiling_enabled() const { return profiling_enabled.is_set(); }
+	// Moves the events recorded since the last call to r_events, sorted by thread then time.
+	void flush_profiling_events(LocalVector<ProfilingEvent> &r_events);
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	void init(int p_thread_count = -1, bool p_use_native_threads_low_priority = true, float p_low_priority_task_ratio = 0.3);
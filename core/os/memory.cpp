@@ -31,10 +31,15 @@
 #include "memory.h"
 
 #include "core/error/error_macros.h"
+#include "core/os/os.h"
+#include "core/os/spin_lock.h"
+#include "core/string/print_string.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/local_vector.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -61,6 +66,91 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::tag_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_max_usage[TAG_MAX];
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_DEFAULT;
+
+// The padding in front of each allocation holds its size, followed by the tag it was allocated with.
+#define MEMORY_TAG_OFFSET sizeof(uint64_t)
+static_assert(PAD_ALIGN > MEMORY_TAG_OFFSET);
+
+SafeNumeric<uint64_t> Memory::frame_allocations;
+SafeNumeric<uint64_t> Memory::frame_allocated_bytes;
+uint64_t Memory::last_frame_allocations = 0;
+uint64_t Memory::last_frame_allocated_bytes = 0;
+
+uint32_t Memory::allocation_sampling_interval = 0;
+
+// Sampled call stacks are aggregated in a fixed size open addressing table, allocated with malloc() so sampling never allocates through Memory.
+struct AllocationSite {
+	enum {
+		MAX_FRAMES = 12,
+		SKIP_FRAMES = 2, // Memory::_sample_allocation() and the Memory function that called it.
+	};
+
+	void *frames[MAX_FRAMES];
+	uint32_t frame_count;
+	uint32_t hash;
+	uint64_t count;
+	uint64_t bytes;
+};
+
+#define ALLOCATION_SITE_TABLE_SIZE 4096
+#define ALLOCATION_SITE_MAX_PROBES 32
+
+static AllocationSite *allocation_sites = nullptr;
+static uint64_t allocation_sites_dropped = 0;
+static SpinLock allocation_sites_lock;
+static thread_local uint32_t allocation_sample_countdown = 0;
+static thread_local bool allocation_sample_running = false; // Allocations made while sampling or reporting aren't sampled.
+
+void Memory::_sample_allocation(size_t p_bytes) {
+	if (allocation_sample_countdown > 0) {
+		allocation_sample_countdown--;
+		return;
+	}
+	allocation_sample_countdown = allocation_sampling_interval - 1;
+
+	if (allocation_sample_running || !allocation_sites || !OS::get_singleton()) {
+		return;
+	}
+	allocation_sample_running = true;
+
+	void *frames[AllocationSite::SKIP_FRAMES + AllocationSite::MAX_FRAMES];
+	int frame_count = OS::get_singleton()->get_stack_trace(frames, AllocationSite::SKIP_FRAMES + AllocationSite::MAX_FRAMES) - AllocationSite::SKIP_FRAMES;
+
+	if (frame_count > 0) {
+		void **site_frames = frames + AllocationSite::SKIP_FRAMES;
+
+		uint32_t hash = 2166136261u;
+		for (int i = 0; i < frame_count; i++) {
+			hash = (hash ^ uint32_t(uint64_t(site_frames[i]) >> 4)) * 16777619u;
+		}
+
+		allocation_sites_lock.lock();
+		bool stored = false;
+		for (uint32_t probe = 0; probe < ALLOCATION_SITE_MAX_PROBES; probe++) {
+			AllocationSite &site = allocation_sites[(hash + probe) & (ALLOCATION_SITE_TABLE_SIZE - 1)];
+			if (site.count == 0) {
+				memcpy(site.frames, site_frames, frame_count * sizeof(void *));
+				site.frame_count = frame_count;
+				site.hash = hash;
+			} else if (site.hash != hash || site.frame_count != uint32_t(frame_count) || memcmp(site.frames, site_frames, frame_count * sizeof(void *)) != 0) {
+				continue;
+			}
+			site.count++;
+			site.bytes += p_bytes;
+			stored = true;
+			break;
+		}
+		if (!stored) {
+			allocation_sites_dropped++;
+		}
+		allocation_sites_lock.unlock();
+	}
+
+	allocation_sample_running = false;
+}
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
@@ -87,6 +177,17 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+
+		Tag tag = current_tag;
+		s8[MEMORY_TAG_OFFSET] = tag;
+		uint64_t new_tag_usage = tag_usage[tag].add(p_bytes);
+		tag_max_usage[tag].exchange_if_greater(new_tag_usage);
+
+		frame_allocations.increment();
+		frame_allocated_bytes.add(p_bytes);
+		if (unlikely(allocation_sampling_interval)) {
+			_sample_allocation(p_bytes);
+		}
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -112,11 +213,21 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)mem;
 
 #ifdef DEBUG_ENABLED
+		Tag tag = Tag(mem[MEMORY_TAG_OFFSET]);
 		if (p_bytes > *s) {
 			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
 			max_usage.exchange_if_greater(new_mem_usage);
+			uint64_t new_tag_usage = tag_usage[tag].add(p_bytes - *s);
+			tag_max_usage[tag].exchange_if_greater(new_tag_usage);
+
+			frame_allocations.increment();
+			frame_allocated_bytes.add(p_bytes - *s);
+			if (unlikely(allocation_sampling_interval)) {
+				_sample_allocation(p_bytes - *s);
+			}
 		} else {
 			mem_usage.sub(*s - p_bytes);
+			tag_usage[tag].sub(*s - p_bytes);
 		}
 #endif
 
@@ -163,6 +274,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)mem;
 		mem_usage.sub(*s);
+		tag_usage[mem[MEMORY_TAG_OFFSET]].sub(*s);
 #endif
 
 		free(mem);
@@ -171,6 +283,185 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	}
 }
 
+// FrameAllocator
+
+struct FrameAllocatorArena {
+	enum {
+		CHUNK_SIZE = 256 * 1024,
+		MAX_CHUNKS = 64,
+		MAX_ALLOC_SIZE = CHUNK_SIZE / 4, // Bigger allocations go to the heap.
+	};
+
+	struct Header {
+		FrameAllocatorArena *arena; // nullptr if allocated from the heap.
+		uint64_t size;
+	};
+	static_assert(sizeof(Header) == PAD_ALIGN);
+
+	// Live allocations plus one for the owner thread, the last one to release it frees the arena.
+	SafeNumeric<uint32_t> refcount = SafeNumeric<uint32_t>(1);
+
+	uint8_t *chunks[MAX_CHUNKS] = {};
+	uint32_t chunk_count = 0;
+	uint32_t current_chunk = 0;
+	uint32_t chunks_used = 0; // Highest amount used since last frame.
+	size_t offset = 0;
+	Header *last = nullptr; // Can grow in place on realloc.
+	uint64_t frame = 0;
+
+	~FrameAllocatorArena() {
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			Memory::free_static(chunks[i]);
+		}
+	}
+};
+
+static SafeNumeric<uint64_t> frame_allocator_frame;
+
+struct FrameAllocatorThreadArena {
+	FrameAllocatorArena *arena = nullptr;
+
+	~FrameAllocatorThreadArena() {
+		if (arena && arena->refcount.decrement() == 0) {
+			memdelete(arena);
+		}
+	}
+};
+
+static thread_local FrameAllocatorThreadArena frame_allocator_thread_arena;
+
+static _FORCE_INLINE_ FrameAllocatorArena *_get_frame_allocator_arena() {
+	FrameAllocatorArena *arena = frame_allocator_thread_arena.arena;
+	if (unlikely(!arena)) {
+		arena = memnew(FrameAllocatorArena);
+		frame_allocator_thread_arena.arena = arena;
+	}
+	return arena;
+}
+
+static void *_frame_allocator_heap_alloc(size_t p_bytes) {
+	FrameAllocatorArena::Header *header = (FrameAllocatorArena::Header *)Memory::alloc_static(sizeof(FrameAllocatorArena::Header) + p_bytes);
+	ERR_FAIL_COND_V(!header, nullptr);
+	header->arena = nullptr;
+	header->size = p_bytes;
+	return header + 1;
+}
+
+void *FrameAllocator::alloc(size_t p_bytes) {
+	typedef FrameAllocatorArena::Header Header;
+
+	size_t size = (p_bytes + PAD_ALIGN - 1) & ~size_t(PAD_ALIGN - 1);
+	if (size > FrameAllocatorArena::MAX_ALLOC_SIZE) {
+		return _frame_allocator_heap_alloc(p_bytes);
+	}
+
+	FrameAllocatorArena *arena = _get_frame_allocator_arena();
+
+	if (arena->refcount.get() == 1) {
+		// Nothing is using the arena, rewind it.
+		uint64_t frame = frame_allocator_frame.get();
+		if (arena->frame != frame) {
+			// New frame, release chunks that were not needed during the last one.
+			uint32_t keep = MAX(arena->chunks_used, 1u);
+			while (arena->chunk_count > keep) {
+				arena->chunk_count--;
+				Memory::free_static(arena->chunks[arena->chunk_count]);
+			}
+			arena->chunks_used = 0;
+			arena->frame = frame;
+		}
+		arena->current_chunk = 0;
+		arena->offset = 0;
+		arena->last = nullptr;
+	}
+
+	if (unlikely(arena->chunk_count == 0 || arena->offset + sizeof(Header) + size > FrameAllocatorArena::CHUNK_SIZE)) {
+		if (arena->chunk_count > 0) {
+			if (arena->current_chunk + 1 == FrameAllocatorArena::MAX_CHUNKS) {
+				return _frame_allocator_heap_alloc(p_bytes); // Arena exhausted.
+			}
+			arena->current_chunk++;
+		}
+		if (arena->current_chunk == arena->chunk_count) {
+			uint8_t *chunk = (uint8_t *)Memory::alloc_static(FrameAllocatorArena::CHUNK_SIZE);
+			ERR_FAIL_COND_V(!chunk, nullptr);
+			arena->chunks[arena->chunk_count++] = chunk;
+		}
+		arena->offset = 0;
+		arena->chunks_used = MAX(arena->chunks_used, arena->current_chunk + 1);
+	}
+
+	Header *header = (Header *)(arena->chunks[arena->current_chunk] + arena->offset);
+	header->arena = arena;
+	header->size = p_bytes;
+	arena->offset += sizeof(Header) + size;
+	arena->last = header;
+	arena->refcount.increment();
+
+	return header + 1;
+}
+
+void *FrameAllocator::realloc(void *p_ptr, size_t p_bytes) {
+	typedef FrameAllocatorArena::Header Header;
+
+	if (p_ptr == nullptr) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_ptr);
+		return nullptr;
+	}
+
+	Header *header = ((Header *)p_ptr) - 1;
+	FrameAllocatorArena *arena = header->arena;
+
+	if (arena == nullptr) {
+		if (p_bytes > FrameAllocatorArena::MAX_ALLOC_SIZE) {
+			header = (Header *)Memory::realloc_static(header, sizeof(Header) + p_bytes);
+			ERR_FAIL_COND_V(!header, nullptr);
+			header->size = p_bytes;
+			return header + 1;
+		}
+	} else if (arena == frame_allocator_thread_arena.arena && header == arena->last) {
+		// Last allocation of this thread's arena, try growing in place.
+		size_t size = (p_bytes + PAD_ALIGN - 1) & ~size_t(PAD_ALIGN - 1);
+		size_t begin = (uint8_t *)header - arena->chunks[arena->current_chunk];
+		if (begin + sizeof(Header) + size <= FrameAllocatorArena::CHUNK_SIZE) {
+			arena->offset = begin + sizeof(Header) + size;
+			header->size = p_bytes;
+			return p_ptr;
+		}
+	}
+
+	void *mem = alloc(p_bytes);
+	ERR_FAIL_COND_V(!mem, nullptr);
+	memcpy(mem, p_ptr, MIN(header->size, (uint64_t)p_bytes));
+	free(p_ptr);
+	return mem;
+}
+
+void FrameAllocator::free(void *p_ptr) {
+	ERR_FAIL_COND(p_ptr == nullptr);
+
+	FrameAllocatorArena::Header *header = ((FrameAllocatorArena::Header *)p_ptr) - 1;
+	FrameAllocatorArena *arena = header->arena;
+	if (arena == nullptr) {
+		Memory::free_static(header);
+	} else if (arena->refcount.decrement() == 0) {
+		// Owner thread exited before this was freed.
+		memdelete(arena);
+	}
+}
+
+void FrameAllocator::end_frame() {
+	frame_allocator_frame.increment();
+}
+
+uint32_t FrameAllocator::get_thread_allocation_count() {
+	FrameAllocatorArena *arena = frame_allocator_thread_arena.arena;
+	return arena ? arena->refcount.get() - 1 : 0;
+}
+
 uint64_t Memory::get_mem_available() {
 	return -1; // 0xFFFF...
 }
@@ -191,6 +482,131 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_tag_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_max_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_max_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+void Memory::end_frame() {
+#ifdef DEBUG_ENABLED
+	// Subtracted rather than reset, so allocations made by other threads meanwhile count towards the next frame.
+	last_frame_allocations = frame_allocations.get();
+	frame_allocations.sub(last_frame_allocations);
+	last_frame_allocated_bytes = frame_allocated_bytes.get();
+	frame_allocated_bytes.sub(last_frame_allocated_bytes);
+#endif
+}
+
+uint64_t Memory::get_frame_allocation_count() {
+#ifdef DEBUG_ENABLED
+	return last_frame_allocations;
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_frame_allocated_bytes() {
+#ifdef DEBUG_ENABLED
+	return last_frame_allocated_bytes;
+#else
+	return 0;
+#endif
+}
+
+void Memory::set_allocation_sampling(uint32_t p_interval) {
+#ifdef DEBUG_ENABLED
+	if (p_interval > 0 && !allocation_sites) {
+		allocation_sites = (AllocationSite *)calloc(ALLOCATION_SITE_TABLE_SIZE, sizeof(AllocationSite));
+		ERR_FAIL_COND(!allocation_sites);
+	}
+	// The table is kept when disabling, so it can still be printed.
+	allocation_sampling_interval = p_interval;
+#else
+	WARN_PRINT_ONCE("Allocation sampling is only available in debug builds.");
+#endif
+}
+
+uint32_t Memory::get_allocation_sampling() {
+#ifdef DEBUG_ENABLED
+	return allocation_sampling_interval;
+#else
+	return 0;
+#endif
+}
+
+void Memory::print_allocation_sites(int p_max_sites) {
+#ifdef DEBUG_ENABLED
+	if (!allocation_sites || !OS::get_singleton()) {
+		return;
+	}
+
+	struct SiteSort {
+		const AllocationSite *site;
+		bool operator<(const SiteSort &p_other) const {
+			return site->count > p_other.site->count;
+		}
+	};
+
+	// Sites are copied so printing (which allocates) doesn't hold the lock.
+	LocalVector<AllocationSite> sites;
+	LocalVector<SiteSort> sorted;
+	uint64_t dropped;
+
+	allocation_sample_running = true;
+	allocation_sites_lock.lock();
+	for (uint32_t i = 0; i < ALLOCATION_SITE_TABLE_SIZE; i++) {
+		if (allocation_sites[i].count > 0) {
+			sites.push_back(allocation_sites[i]);
+		}
+	}
+	dropped = allocation_sites_dropped;
+	allocation_sites_lock.unlock();
+
+	for (uint32_t i = 0; i < sites.size(); i++) {
+		SiteSort sort;
+		sort.site = &sites[i];
+		sorted.push_back(sort);
+	}
+	sorted.sort();
+
+	const uint32_t interval = MAX(allocation_sampling_interval, 1u);
+	print_line(vformat("Top allocation sites, from %d call stacks sampled one allocation in %d (%d samples dropped):", int64_t(sites.size()), interval, int64_t(dropped)));
+	for (uint32_t i = 0; i < sorted.size() && int(i) < p_max_sites; i++) {
+		const AllocationSite *site = sorted[i].site;
+		print_line(vformat("#%d: ~%d allocations, ~%s", i + 1, int64_t(site->count * interval), String::humanize_size(site->bytes * interval)));
+		for (uint32_t j = 0; j < site->frame_count; j++) {
+			print_line("\t" + OS::get_singleton()->get_stack_frame_name(site->frames[j]));
+		}
+	}
+	allocation_sample_running = false;
+#endif
+}
+
+const char *Memory::get_tag_name(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	static const char *names[TAG_MAX] = {
+		"default",
+		"rendering",
+		"resources",
+		"script",
+		"audio",
+	};
+	return names[p_tag];
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
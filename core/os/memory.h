@@ -42,9 +42,34 @@
 #endif
 
 class Memory {
+public:
+	// Subsystems allocations can be attributed to, see MemoryTagScope.
+	enum Tag : uint8_t {
+		TAG_DEFAULT,
+		TAG_RENDERING,
+		TAG_RESOURCES,
+		TAG_SCRIPT,
+		TAG_AUDIO,
+		TAG_MAX
+	};
+
+private:
+	friend class MemoryTagScope;
+
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> tag_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_max_usage[TAG_MAX];
+	static thread_local Tag current_tag;
+
+	static SafeNumeric<uint64_t> frame_allocations;
+	static SafeNumeric<uint64_t> frame_allocated_bytes;
+	static uint64_t last_frame_allocations;
+	static uint64_t last_frame_allocated_bytes;
+
+	static uint32_t allocation_sampling_interval;
+	static void _sample_allocation(size_t p_bytes);
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
@@ -57,14 +82,70 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	// Usage per tag is only tracked in debug builds, like get_mem_usage().
+	static uint64_t get_tag_usage(Tag p_tag);
+	static uint64_t get_tag_max_usage(Tag p_tag);
+	static const char *get_tag_name(Tag p_tag);
+
+	// Called by Main::iteration() once per frame. Allocations (including reallocations) are counted per frame in debug builds.
+	static void end_frame();
+	static uint64_t get_frame_allocation_count();
+	static uint64_t get_frame_allocated_bytes();
+
+	// Debug builds only: captures the call stack of one in every p_interval allocations (0 disables it),
+	// and aggregates them by call stack, to find where allocations come from.
+	static void set_allocation_sampling(uint32_t p_interval);
+	static uint32_t get_allocation_sampling();
+	// Prints the call stacks that were sampled the most, along with the allocation count and bytes sampled for each.
+	static void print_allocation_sites(int p_max_sites = 20);
+};
+
+// Attributes allocations made by the current thread to a tag for as long as it is in scope.
+// Memory is accounted to the tag it was allocated with, even if freed or reallocated elsewhere.
+class MemoryTagScope {
+#ifdef DEBUG_ENABLED
+	Memory::Tag previous;
+#endif
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {
+#ifdef DEBUG_ENABLED
+		previous = Memory::current_tag;
+		Memory::current_tag = p_tag;
+#endif
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+#ifdef DEBUG_ENABLED
+		Memory::current_tag = previous;
+#endif
+	}
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+// Thread-local linear (bump) allocator for short-lived scratch memory, such as temporary
+// vectors built and thrown away within a frame. Each thread allocates from its own arena
+// without locking. Freeing only decrements a counter, and the arena is rewound once all its
+// allocations have been freed, so memory should not be kept for longer than a frame.
+// Memory can be freed from any thread. Big allocations go through the regular heap.
+class FrameAllocator {
+public:
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_ptr, size_t p_bytes);
+	static void free(void *p_ptr);
+
+	// Called by Main::iteration() once per frame, lets arenas give back memory they no longer need.
+	static void end_frame();
+	// Allocations from the calling thread's arena which were not freed yet.
+	static uint32_t get_thread_allocation_count();
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
@@ -58,6 +58,10 @@ void OS::debug_break() {
 	// something
 }
 
+String OS::get_stack_frame_name(void *p_frame) const {
+	return String("0x") + String::num_uint64(uint64_t(p_frame), 16);
+}
+
 void OS::_set_logger(CompositeLogger *p_logger) {
 	if (_logger) {
 		memdelete(_logger);
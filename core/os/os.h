@@ -290,7 +290,17 @@ public:
 
 	virtual Error move_to_trash(const String &p_path) { return FAILED; }
 
+	// Change notifications for directories (not recursive), so tools can find out what changed without scanning everything.
+	// get_directory_changes() returns the watched directories whose entries changed since the last call, or false if changes were lost and everything must be checked again.
+	virtual bool watch_directory(const String &p_path) { return false; }
+	virtual void clear_directory_watches() {}
+	virtual bool get_directory_changes(List<String> *r_dirs) { return false; }
+
 	virtual void debug_break();
+	// Writes the return addresses of the calling thread's stack to r_frames, innermost first, and returns how many were written.
+	// Must not allocate through Memory, as it's used to sample allocations. Returns 0 where unsupported.
+	virtual int get_stack_trace(void **r_frames, int p_max_frames) const { return 0; }
+	virtual String get_stack_frame_name(void *p_frame) const;
 
 	virtual int get_exit_code() const;
 	// `set_exit_code` should only be used from `SceneTree` (or from a similar
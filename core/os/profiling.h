@@ -0,0 +1,79 @@
+/*************************************************************************/
+/*  profiling.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+// Instrumentation zones for external profilers, selected at build time with the `profiler` SCons option.
+// Without it, all the macros below compile to nothing.
+//
+// PROFILE_ZONE("Name") times the enclosing scope, the name must be a string literal.
+// PROFILE_ZONE_TEXT("Name", text) does the same, and attaches a String (a path, a function name...) to the zone.
+// PROFILE_FRAME_MARK marks the end of a main loop frame.
+
+#if defined(PROFILER_TRACY)
+
+#include "core/string/ustring.h"
+
+#include "tracy/Tracy.hpp"
+
+#define PROFILE_ZONE(m_name) ZoneScopedN(m_name)
+#define PROFILE_ZONE_TEXT(m_name, m_text)                     \
+	ZoneScopedN(m_name);                                      \
+	{                                                         \
+		const CharString _zone_text = (m_text).utf8();        \
+		ZoneText(_zone_text.get_data(), _zone_text.length()); \
+	}
+#define PROFILE_FRAME_MARK FrameMark
+
+#elif defined(PROFILER_PERFETTO)
+
+#include "core/string/ustring.h"
+
+#include <perfetto.h>
+
+PERFETTO_DEFINE_CATEGORIES(perfetto::Category("godot").SetDescription("Godot Engine"));
+
+#define PROFILE_ZONE(m_name) TRACE_EVENT("godot", m_name)
+#define PROFILE_ZONE_TEXT(m_name, m_text) TRACE_EVENT("godot", m_name, "text", (m_text).utf8().get_data())
+#define PROFILE_FRAME_MARK TRACE_EVENT_INSTANT("godot", "Frame")
+
+#else
+
+#define PROFILE_ZONE(m_name)
+#define PROFILE_ZONE_TEXT(m_name, m_text)
+#define PROFILE_FRAME_MARK
+
+#endif
+
+// Connects to the profiler, called by Main before anything is instrumented.
+void profiling_initialize();
+
+#endif // PROFILING_H
@@ -37,63 +37,63 @@ StringBuilder &StringBuilder::append(const String &p_string) {
 		return *this;
 	}
 
-	strings.push_back(p_string);
-	appended_strings.push_back(-1);
-
-	string_length += p_string.length();
-
-	return *this;
+	return append(p_string.ptr(), p_string.length());
 }
 
 StringBuilder &StringBuilder::append(const char *p_cstring) {
 	int32_t len = strlen(p_cstring);
+	uint32_t from = buffer.size();
 
-	c_strings.push_back(p_cstring);
-	appended_strings.push_back(len);
-
-	string_length += len;
+	buffer.resize(from + len);
+	char32_t *w = buffer.ptr() + from;
+	for (int32_t i = 0; i < len; i++) {
+		w[i] = (uint8_t)p_cstring[i];
+	}
+	appended_strings++;
 
 	return *this;
 }
 
-String StringBuilder::as_string() const {
-	if (string_length == 0) {
-		return "";
+StringBuilder &StringBuilder::append(const char32_t *p_string, int p_length) {
+	if (p_length <= 0) {
+		return *this;
 	}
 
-	char32_t *buffer = memnew_arr(char32_t, string_length);
-
-	int current_position = 0;
-
-	int godot_string_elem = 0;
-	int c_string_elem = 0;
+	uint32_t from = buffer.size();
 
-	for (int i = 0; i < appended_strings.size(); i++) {
-		if (appended_strings[i] == -1) {
-			// Godot string
-			const String &s = strings[godot_string_elem];
+	buffer.resize(from + p_length);
+	memcpy(buffer.ptr() + from, p_string, p_length * sizeof(char32_t));
+	appended_strings++;
 
-			memcpy(buffer + current_position, s.ptr(), s.length() * sizeof(char32_t));
+	return *this;
+}
 
-			current_position += s.length();
+StringBuilder &StringBuilder::append(char32_t p_char) {
+	buffer.push_back(p_char);
+	appended_strings++;
 
-			godot_string_elem++;
-		} else {
-			const char *s = c_strings[c_string_elem];
+	return *this;
+}
 
-			for (int32_t j = 0; j < appended_strings[i]; j++) {
-				buffer[current_position + j] = s[j];
-			}
+void StringBuilder::reserve(uint32_t p_length) {
+	buffer.reserve(p_length);
+}
 
-			current_position += appended_strings[i];
+void StringBuilder::clear() {
+	buffer.clear();
+	appended_strings = 0;
+}
 
-			c_string_elem++;
-		}
+String StringBuilder::as_string() const {
+	if (buffer.size() == 0) {
+		return "";
 	}
 
-	String final_string = String(buffer, string_length);
-
-	memdelete_arr(buffer);
+	String final_string;
+	final_string.resize(buffer.size() + 1);
+	char32_t *w = final_string.ptrw();
+	memcpy(w, buffer.ptr(), buffer.size() * sizeof(char32_t));
+	w[buffer.size()] = 0;
 
 	return final_string;
 }
@@ -32,21 +32,19 @@
 #define STRING_BUILDER_H
 
 #include "core/string/ustring.h"
-#include "core/templates/vector.h"
+#include "core/templates/local_vector.h"
 
+// Appends are copied into a single UTF-32 buffer that grows geometrically,
+// so building a string out of many small pieces doesn't reallocate it on every append.
 class StringBuilder {
-	uint32_t string_length = 0;
-
-	Vector<String> strings;
-	Vector<const char *> c_strings;
-
-	// -1 means it's a Godot String
-	// a natural number means C string.
-	Vector<int32_t> appended_strings;
+	LocalVector<char32_t> buffer;
+	int appended_strings = 0;
 
 public:
 	StringBuilder &append(const String &p_string);
 	StringBuilder &append(const char *p_cstring);
+	StringBuilder &append(const char32_t *p_string, int p_length);
+	StringBuilder &append(char32_t p_char);
 
 	_FORCE_INLINE_ StringBuilder &operator+(const String &p_string) {
 		return append(p_string);
@@ -64,14 +62,22 @@ public:
 		append(p_cstring);
 	}
 
+	_FORCE_INLINE_ void operator+=(char32_t p_char) {
+		append(p_char);
+	}
+
 	_FORCE_INLINE_ int num_strings_appended() const {
-		return appended_strings.size();
+		return appended_strings;
 	}
 
 	_FORCE_INLINE_ uint32_t get_string_length() const {
-		return string_length;
+		return buffer.size();
 	}
 
+	// Makes room for p_length characters in total, to avoid growing the buffer several times when the final length is known.
+	void reserve(uint32_t p_length);
+	void clear();
+
 	String as_string() const;
 
 	_FORCE_INLINE_ operator String() const {
@@ -40,13 +40,13 @@ StaticCString StaticCString::create(const char *p_ptr) {
 }
 
 StringName::_Data *StringName::_table[STRING_TABLE_LEN];
+StringName::Shard StringName::shards[SHARD_COUNT];
 
 StringName _scs_create(const char *p_chr, bool p_static) {
 	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
 }
 
 bool StringName::configured = false;
-Mutex StringName::mutex;
 
 #ifdef DEBUG_ENABLED
 bool StringName::debug_stringname = false;
@@ -61,7 +61,9 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(mutex);
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		shards[i].mutex.lock();
+	}
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -90,6 +92,10 @@ void StringName::cleanup() {
 
 		print_line(vformat("\nOut of %d StringNames, %d StringNames were never referenced during this run (0 times) (%.2f%%).", data.size(), unreferenced_stringnames, unreferenced_stringnames / float(data.size()) * 100));
 		print_line(vformat("Out of %d StringNames, %d StringNames were rarely referenced during this run (1-4 times) (%.2f%%).", data.size(), rarely_referenced_stringnames, rarely_referenced_stringnames / float(data.size()) * 100));
+
+		TableStatistics stats = get_table_statistics();
+		print_line(vformat("StringName table: %d entries in %d of %d buckets (longest chain: %d).", stats.entries, stats.used_buckets, stats.table_size, stats.longest_chain));
+		print_line(vformat("StringName lookups: %d, misses: %d, collisions: %d.", stats.lookups, stats.misses, stats.collisions));
 	}
 #endif
 	int lost_strings = 0;
@@ -116,13 +122,97 @@ void StringName::cleanup() {
 		print_verbose("StringName: " + itos(lost_strings) + " unclaimed string names at exit.");
 	}
 	configured = false;
+
+	for (int i = SHARD_COUNT - 1; i >= 0; i--) {
+		shards[i].mutex.unlock();
+	}
+}
+
+StringName::TableStatistics StringName::get_table_statistics() {
+	TableStatistics stats;
+
+	for (int i = 0; i < SHARD_COUNT; i++) {
+		Shard &shard = shards[i];
+		MutexLock lock(shard.mutex);
+
+		stats.lookups += shard.lookups;
+		stats.misses += shard.misses;
+		stats.collisions += shard.collisions;
+
+		for (int j = i; j < STRING_TABLE_LEN; j += SHARD_COUNT) {
+			uint32_t chain = 0;
+			for (_Data *d = _table[j]; d; d = d->next) {
+				chain++;
+			}
+			if (chain) {
+				stats.entries += chain;
+				stats.used_buckets++;
+				stats.longest_chain = MAX(stats.longest_chain, chain);
+			}
+		}
+	}
+
+	return stats;
+}
+
+// Must be called with the shard of p_hash locked. Returns a new reference, or nullptr.
+template <class S>
+StringName::_Data *StringName::_find(uint32_t p_hash, const S &p_name) {
+	Shard &shard = shards[p_hash & SHARD_MASK];
+	shard.lookups++;
+
+	_Data *data = _table[p_hash & STRING_TABLE_MASK];
+
+	while (data) {
+		// compare hash first
+		if (data->hash == p_hash && data->get_name() == p_name) {
+			break;
+		}
+		shard.collisions++;
+		data = data->next;
+	}
+
+	// The last reference may be going away, waiting for the lock in unref().
+	if (data && data->refcount.ref()) {
+#ifdef DEBUG_ENABLED
+		if (unlikely(debug_stringname)) {
+			data->debug_references++;
+		}
+#endif
+		return data;
+	}
+
+	shard.misses++;
+	return nullptr;
+}
+
+// Must be called with the shard of p_data locked.
+void StringName::_insert(_Data *p_data) {
+	uint32_t idx = p_data->hash & STRING_TABLE_MASK;
+
+	p_data->refcount.init();
+	p_data->idx = idx;
+	p_data->next = _table[idx];
+	p_data->prev = nullptr;
+#ifdef DEBUG_ENABLED
+	if (unlikely(debug_stringname)) {
+		// Keep in memory, force static.
+		p_data->refcount.ref();
+		p_data->static_count.increment();
+	}
+#endif
+
+	if (_table[idx]) {
+		_table[idx]->prev = p_data;
+	}
+	_table[idx] = p_data;
 }
 
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(shards[_data->idx & SHARD_MASK].mutex);
 
 		if (_data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -206,59 +296,26 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(shards[hash & SHARD_MASK].mutex);
 
-	_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find(hash, p_name);
 
 	if (_data) {
-		if (_data->refcount.ref()) {
-			// exists
-			if (p_static) {
-				_data->static_count.increment();
-			}
-#ifdef DEBUG_ENABLED
-			if (unlikely(debug_stringname)) {
-				_data->debug_references++;
-			}
-#endif
+		// exists
+		if (p_static) {
+			_data->static_count.increment();
 		}
-
 		return;
 	}
 
 	_data = memnew(_Data);
 	_data->name = p_name;
-	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(_data);
 }
 
 StringName::StringName(const StaticCString &p_static_string, bool p_static) {
@@ -268,57 +325,25 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
+	MutexLock lock(shards[hash & SHARD_MASK].mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find(hash, p_static_string.ptr);
 
 	if (_data) {
-		if (_data->refcount.ref()) {
-			// exists
-			if (p_static) {
-				_data->static_count.increment();
-			}
-#ifdef DEBUG_ENABLED
-			if (unlikely(debug_stringname)) {
-				_data->debug_references++;
-			}
-#endif
-			return;
+		// exists
+		if (p_static) {
+			_data->static_count.increment();
 		}
+		return;
 	}
 
 	_data = memnew(_Data);
-
-	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(_data);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -330,56 +355,26 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_data = _table[idx];
+	MutexLock lock(shards[hash & SHARD_MASK].mutex);
 
-	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find(hash, p_name);
 
 	if (_data) {
-		if (_data->refcount.ref()) {
-			// exists
-			if (p_static) {
-				_data->static_count.increment();
-			}
-#ifdef DEBUG_ENABLED
-			if (unlikely(debug_stringname)) {
-				_data->debug_references++;
-			}
-#endif
-			return;
+		// exists
+		if (p_static) {
+			_data->static_count.increment();
 		}
+		return;
 	}
 
 	_data = memnew(_Data);
 	_data->name = p_name;
-	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(_data);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -390,29 +385,13 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
 
-	if (_data && _data->refcount.ref()) {
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
+	MutexLock lock(shards[hash & SHARD_MASK].mutex);
 
-		return StringName(_data);
+	_Data *data = _find(hash, p_name);
+	if (data) {
+		return StringName(data);
 	}
 
 	return StringName(); //does not exist
@@ -426,24 +405,13 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(shards[hash & SHARD_MASK].mutex);
 
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		return StringName(_data);
+	_Data *data = _find(hash, p_name);
+	if (data) {
+		return StringName(data);
 	}
 
 	return StringName(); //does not exist
@@ -452,29 +420,13 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
+	MutexLock lock(shards[hash & SHARD_MASK].mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && p_name == _data->get_name()) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return StringName(_data);
+	_Data *data = _find(hash, p_name);
+	if (data) {
+		return StringName(data);
 	}
 
 	return StringName(); //does not exist
@@ -46,9 +46,16 @@ struct StaticCString {
 
 class StringName {
 	enum {
+		// Sized for the names registered by the engine and editor at startup,
+		// check get_table_statistics() before changing it.
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Buckets are split between shards by their lowest bits, each shard
+		// with its own lock, so threads interning different names rarely contend.
+		SHARD_BITS = 6,
+		SHARD_COUNT = 1 << SHARD_BITS,
+		SHARD_MASK = SHARD_COUNT - 1,
 	};
 
 	struct _Data {
@@ -69,6 +76,19 @@ class StringName {
 
 	static _Data *_table[STRING_TABLE_LEN];
 
+	struct Shard {
+		Mutex mutex;
+		uint64_t lookups = 0;
+		uint64_t misses = 0;
+		uint64_t collisions = 0;
+	};
+
+	static Shard shards[SHARD_COUNT];
+
+	template <class S>
+	static _Data *_find(uint32_t p_hash, const S &p_name);
+	static void _insert(_Data *p_data);
+
 	_Data *_data = nullptr;
 
 	union _HashUnion {
@@ -80,7 +100,6 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
-	static Mutex mutex;
 	static void setup();
 	static void cleanup();
 	static bool configured;
@@ -145,6 +164,18 @@ public:
 		return String();
 	}
 
+	struct TableStatistics {
+		uint64_t lookups = 0; // Constructions and searches by name.
+		uint64_t misses = 0; // Lookups that did not find an existing name.
+		uint64_t collisions = 0; // Entries compared against that did not match.
+		uint32_t entries = 0;
+		uint32_t used_buckets = 0;
+		uint32_t longest_chain = 0;
+		uint32_t table_size = STRING_TABLE_LEN;
+	};
+
+	static TableStatistics get_table_statistics();
+
 	static StringName search(const char *p_name);
 	static StringName search(const char32_t *p_name);
 	static StringName search(const String &p_name);
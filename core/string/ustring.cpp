@@ -35,6 +35,7 @@
 #include "core/math/math_funcs.h"
 #include "core/os/memory.h"
 #include "core/string/print_string.h"
+#include "core/string/string_builder.h"
 #include "core/string/string_name.h"
 #include "core/string/translation.h"
 #include "core/string/ucaps.h"
@@ -3367,13 +3368,14 @@ String String::format(const Variant &values, String placeholder) const {
 }
 
 String String::replace(const String &p_key, const String &p_with) const {
-	String new_string;
+	StringBuilder new_string;
+	const char32_t *src = get_data();
 	int search_from = 0;
 	int result = 0;
 
 	while ((result = find(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
+		new_string.append(src + search_from, result - search_from);
+		new_string.append(p_with);
 		search_from = result + p_key.length();
 	}
 
@@ -3381,33 +3383,31 @@ String String::replace(const String &p_key, const String &p_with) const {
 		return *this;
 	}
 
-	new_string += substr(search_from, length() - search_from);
+	new_string.append(src + search_from, length() - search_from);
 
-	return new_string;
+	return new_string.as_string();
 }
 
 String String::replace(const char *p_key, const char *p_with) const {
-	String new_string;
+	StringBuilder new_string;
+	const char32_t *src = get_data();
 	int search_from = 0;
 	int result = 0;
+	int key_length = strlen(p_key);
 
 	while ((result = find(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
-		int k = 0;
-		while (p_key[k] != '\0') {
-			k++;
-		}
-		search_from = result + k;
+		new_string.append(src + search_from, result - search_from);
+		new_string.append(p_with);
+		search_from = result + key_length;
 	}
 
 	if (search_from == 0) {
 		return *this;
 	}
 
-	new_string += substr(search_from, length() - search_from);
+	new_string.append(src + search_from, length() - search_from);
 
-	return new_string;
+	return new_string.as_string();
 }
 
 String String::replace_first(const String &p_key, const String &p_with) const {
@@ -3420,13 +3420,14 @@ String String::replace_first(const String &p_key, const String &p_with) const {
 }
 
 String String::replacen(const String &p_key, const String &p_with) const {
-	String new_string;
+	StringBuilder new_string;
+	const char32_t *src = get_data();
 	int search_from = 0;
 	int result = 0;
 
 	while ((result = findn(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
+		new_string.append(src + search_from, result - search_from);
+		new_string.append(p_with);
 		search_from = result + p_key.length();
 	}
 
@@ -3434,8 +3435,8 @@ String String::replacen(const String &p_key, const String &p_with) const {
 		return *this;
 	}
 
-	new_string += substr(search_from, length() - search_from);
-	return new_string;
+	new_string.append(src + search_from, length() - search_from);
+	return new_string.as_string();
 }
 
 String String::repeat(int p_count) const {
@@ -70,10 +70,11 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 	return &sync_sems[idx];
 }
 
-CommandQueueMT::CommandQueueMT(bool p_sync) {
+CommandQueueMT::CommandQueueMT(bool p_sync, bool p_batch_wakeups) {
 	if (p_sync) {
 		sync = memnew(Semaphore);
 	}
+	wake_per_command = !p_batch_wakeups;
 }
 
 CommandQueueMT::~CommandQueueMT() {
@@ -35,6 +35,8 @@
 #include "core/os/mutex.h"
 #include "core/os/semaphore.h"
 #include "core/string/print_string.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hashfuncs.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
 #include "core/typedefs.h"
@@ -250,29 +252,62 @@
 #define DECL_PUSH(N)                                                         \
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>       \
 	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		CMD_TYPE(N) *cmd = allocate_and_lock<CMD_TYPE(N)>();                 \
+		bool wake = false;                                                   \
+		CMD_TYPE(N) *cmd = allocate_and_lock<CMD_TYPE(N)>(&wake);            \
 		cmd->instance = p_instance;                                          \
 		cmd->method = p_method;                                              \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                 \
 		unlock();                                                            \
-		if (sync)                                                            \
+		if (wake)                                                            \
 			sync->post();                                                    \
 	}
 
+// If a command for the same method, instance and first argument is already
+// pending, its arguments are replaced instead of queuing a new command.
+#define DECL_PUSH_COALESCED(N)                                                                  \
+	template <class T, class M, COMMA_SEP_LIST(TYPE_PARAM, N)>                                  \
+	void push_coalesced(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N)) {                  \
+		CoalesceKey key;                                                                        \
+		key.type = _get_command_type_tag<CMD_TYPE(N)>();                                        \
+		key.instance = p_instance;                                                              \
+		key.method_hash = hash_murmur3_buffer(&p_method, sizeof(M));                            \
+		key.arg_hash = HashMapHasherDefault::hash(p1);                                          \
+		lock();                                                                                 \
+		const uint64_t *pending = coalesced_commands.getptr(key);                               \
+		if (pending) {                                                                          \
+			CMD_TYPE(N) *cmd = reinterpret_cast<CMD_TYPE(N) *>(&command_mem[write_buffer][*pending]); \
+			if (cmd->method == p_method && cmd->p1 == p1) {                                     \
+				SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                            \
+				unlock();                                                                       \
+				return;                                                                         \
+			}                                                                                   \
+		}                                                                                       \
+		bool wake = false;                                                                      \
+		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>(&wake);                                        \
+		cmd->instance = p_instance;                                                             \
+		cmd->method = p_method;                                                                 \
+		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                    \
+		coalesced_commands.insert(key, (uint8_t *)cmd - command_mem[write_buffer].ptr());       \
+		unlock();                                                                               \
+		if (wake)                                                                               \
+			sync->post();                                                                       \
+	}
+
 #define CMD_RET_TYPE(N) CommandRet##N<T, M, COMMA_SEP_LIST(TYPE_ARG, N) COMMA(N) R>
 
 #define DECL_PUSH_AND_RET(N)                                                                   \
 	template <class T, class M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) class R>                \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
 		SyncSemaphore *ss = _alloc_sync_sem();                                                 \
-		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>();                           \
+		bool wake = false;                                                                     \
+		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>(&wake);                      \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                   \
 		cmd->ret = r_ret;                                                                      \
 		cmd->sync_sem = ss;                                                                    \
 		unlock();                                                                              \
-		if (sync)                                                                              \
+		if (wake)                                                                              \
 			sync->post();                                                                      \
 		ss->sem.wait();                                                                        \
 		ss->in_use = false;                                                                    \
@@ -284,13 +319,14 @@
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>                \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
 		SyncSemaphore *ss = _alloc_sync_sem();                                        \
-		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>();                \
+		bool wake = false;                                                            \
+		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>(&wake);           \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                          \
 		cmd->sync_sem = ss;                                                           \
 		unlock();                                                                     \
-		if (sync)                                                                     \
+		if (wake)                                                                     \
 			sync->post();                                                             \
 		ss->sem.wait();                                                               \
 		ss->in_use = false;                                                           \
@@ -336,39 +372,91 @@ class CommandQueueMT {
 		SYNC_SEMAPHORES = 8
 	};
 
-	LocalVector<uint8_t> command_mem;
+	struct CoalesceKey {
+		const void *type = nullptr;
+		const void *instance = nullptr;
+		uint32_t method_hash = 0;
+		uint32_t arg_hash = 0;
+
+		static uint32_t hash(const CoalesceKey &p_key) {
+			uint32_t h = hash_murmur3_one_64((uint64_t)p_key.type);
+			h = hash_murmur3_one_64((uint64_t)p_key.instance, h);
+			h = hash_murmur3_one_32(p_key.method_hash, h);
+			h = hash_murmur3_one_32(p_key.arg_hash, h);
+			return hash_fmix32(h);
+		}
+		bool operator==(const CoalesceKey &p_key) const {
+			return type == p_key.type && instance == p_key.instance && method_hash == p_key.method_hash && arg_hash == p_key.arg_hash;
+		}
+	};
+
+	template <class C>
+	static const void *_get_command_type_tag() {
+		static const char tag = 0;
+		return &tag;
+	}
+
+	// Commands are pushed to one buffer while the other one is being flushed,
+	// so producers never wait for commands to run.
+	LocalVector<uint8_t> command_mem[2];
+	uint32_t write_buffer = 0;
+	bool flushing = false;
+	// Whether the consumer is woken up for every command, or only when
+	// a batch starts (see constructor).
+	bool wake_per_command = true;
+	HashMap<CoalesceKey, uint64_t, CoalesceKey> coalesced_commands; // Offsets in the write buffer.
 	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
 	Mutex mutex;
 	Semaphore *sync = nullptr;
 
 	template <class T>
-	T *allocate() {
+	T *allocate(bool *r_wake) {
+		LocalVector<uint8_t> &mem = command_mem[write_buffer];
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		uint64_t size = mem.size();
+		*r_wake = sync && (wake_per_command || size == 0);
+		mem.resize(size + alloc_size + 8);
+		*(uint64_t *)&mem[size] = alloc_size;
+		T *cmd = memnew_placement(&mem[size + 8], T);
 		return cmd;
 	}
 
 	template <class T>
-	T *allocate_and_lock() {
+	T *allocate_and_lock(bool *r_wake) {
 		lock();
-		T *ret = allocate<T>();
+		T *ret = allocate<T>(r_wake);
 		return ret;
 	}
 
 	void _flush() {
 		lock();
 
+		if (flushing) {
+			// Commands are calling back into the queue from the same thread. Whatever they
+			// push is left for the next flush.
+			unlock();
+			return;
+		}
+
+		LocalVector<uint8_t> &mem = command_mem[write_buffer];
+		if (mem.is_empty()) {
+			unlock();
+			return;
+		}
+
+		write_buffer ^= 1;
+		coalesced_commands.clear();
+		flushing = true;
+		unlock();
+
 		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
+		uint64_t limit = mem.size();
 
 		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
+			uint64_t size = *(uint64_t *)&mem[read_ptr];
 			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&mem[read_ptr]);
 
 			cmd->call(); //execute the function
 			cmd->post(); //release in case it needs sync/ret
@@ -377,7 +465,10 @@ class CommandQueueMT {
 			read_ptr += size;
 		}
 
-		command_mem.clear();
+		mem.clear();
+
+		lock();
+		flushing = false;
 		unlock();
 	}
 
@@ -391,6 +482,9 @@ public:
 	DECL_PUSH(0)
 	SPACE_SEP_LIST(DECL_PUSH, 15)
 
+	/* COALESCED PUSH COMMANDS */
+	SPACE_SEP_LIST(DECL_PUSH_COALESCED, 15)
+
 	/* PUSH AND RET COMMANDS */
 	DECL_PUSH_AND_RET(0)
 	SPACE_SEP_LIST(DECL_PUSH_AND_RET, 15)
@@ -400,7 +494,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem[write_buffer].size() > 0)) {
 			_flush();
 		}
 	}
@@ -408,13 +502,23 @@ public:
 		_flush();
 	}
 
+	// Commands pushed from now on are never coalesced into the pending ones,
+	// for when they have to be applied after a command that was pushed since.
+	void end_coalescing() {
+		lock();
+		coalesced_commands.clear();
+		unlock();
+	}
+
 	void wait_and_flush() {
 		ERR_FAIL_COND(!sync);
 		sync->wait();
 		_flush();
 	}
 
-	CommandQueueMT(bool p_sync);
+	// With p_batch_wakeups, wait_and_flush() returns once per batch of commands
+	// pushed since the last flush instead of once per command.
+	CommandQueueMT(bool p_sync, bool p_batch_wakeups = false);
 	~CommandQueueMT();
 };
 
@@ -429,6 +533,7 @@ public:
 #undef CMD_TYPE
 #undef CMD_ASSIGN_PARAM
 #undef DECL_PUSH
+#undef DECL_PUSH_COALESCED
 #undef CMD_RET_TYPE
 #undef DECL_PUSH_AND_RET
 #undef CMD_SYNC_TYPE
@@ -0,0 +1,540 @@
+/*************************************************************************/
+/*  flat_hash_map.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#include <string.h>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * A HashMap implementation in the style of Swiss tables.
+ *
+ * Every slot has a control byte, which is either empty, deleted, or holds
+ * 7 bits of the slot's hash. Lookups compare a whole group of control bytes
+ * at once (16 with SSE2, 8 otherwise) and only compare keys for the slots
+ * whose bits match, so most misses are resolved without touching the keys.
+ *
+ * Keys and values are stored inline in a single array, like OAHashMap, which
+ * makes it a good fit for small trivially copyable keys and values (these are
+ * also moved with memcpy when rehashing). Unlike HashMap, iteration order is
+ * unspecified, and inserting may move existing elements: pointers and
+ * iterators are invalidated by insertions, erasing keeps them valid.
+ */
+
+struct FlatHashMapGroup {
+	enum : int8_t {
+		CTRL_EMPTY = -128,
+		CTRL_DELETED = -2,
+	};
+
+#ifdef FLAT_HASH_MAP_SSE2
+	typedef uint32_t Mask;
+	static constexpr uint32_t WIDTH = 16;
+	static constexpr uint32_t MASK_SHIFT = 0;
+
+	__m128i ctrl;
+
+	_FORCE_INLINE_ explicit FlatHashMapGroup(const int8_t *p_ctrl) {
+		ctrl = _mm_loadu_si128((const __m128i *)p_ctrl);
+	}
+
+	_FORCE_INLINE_ Mask match(int8_t p_h2) const {
+		return (Mask)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), ctrl));
+	}
+
+	_FORCE_INLINE_ Mask match_empty() const {
+		return match(CTRL_EMPTY);
+	}
+
+	_FORCE_INLINE_ Mask match_empty_or_deleted() const {
+		// Full slots are the only non-negative ones.
+		return (Mask)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl));
+	}
+#else
+	// Portable fallback, processing 8 control bytes in a 64-bit integer.
+	typedef uint64_t Mask;
+	static constexpr uint32_t WIDTH = 8;
+	static constexpr uint32_t MASK_SHIFT = 3;
+	static constexpr uint64_t LSBS = 0x0101010101010101ULL;
+	static constexpr uint64_t MSBS = 0x8080808080808080ULL;
+
+	uint64_t ctrl;
+
+	_FORCE_INLINE_ explicit FlatHashMapGroup(const int8_t *p_ctrl) {
+		memcpy(&ctrl, p_ctrl, sizeof(ctrl));
+#ifdef BIG_ENDIAN_ENABLED
+		ctrl = BSWAP64(ctrl);
+#endif
+	}
+
+	_FORCE_INLINE_ Mask match(int8_t p_h2) const {
+		// May report false positives after a real match, keys are compared anyway.
+		uint64_t x = ctrl ^ (LSBS * (uint8_t)p_h2);
+		return (x - LSBS) & ~x & MSBS;
+	}
+
+	_FORCE_INLINE_ Mask match_empty() const {
+		// Empty is the only value with the high bit set and bit 1 clear.
+		return ctrl & (~ctrl << 6) & MSBS;
+	}
+
+	_FORCE_INLINE_ Mask match_empty_or_deleted() const {
+		return ctrl & MSBS;
+	}
+#endif
+
+	// Index of the first slot set in a non-zero mask.
+	static _FORCE_INLINE_ uint32_t lowest(Mask p_mask) {
+#if defined(__GNUC__)
+		return (sizeof(Mask) == 8 ? __builtin_ctzll(p_mask) : __builtin_ctz((uint32_t)p_mask)) >> MASK_SHIFT;
+#elif defined(_MSC_VER)
+		unsigned long index;
+#ifdef FLAT_HASH_MAP_SSE2
+		_BitScanForward(&index, p_mask);
+#else
+		_BitScanForward64(&index, p_mask);
+#endif
+		return index >> MASK_SHIFT;
+#else
+		uint32_t index = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			index++;
+		}
+		return index >> MASK_SHIFT;
+#endif
+	}
+};
+
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+	typedef FlatHashMapGroup Group;
+	typedef KeyValue<TKey, TValue> Slot;
+
+	static constexpr uint32_t MIN_CAPACITY = Group::WIDTH;
+	static constexpr bool TRIVIAL_SLOTS = std::is_trivially_copyable<TKey>::value && std::is_trivially_copyable<TValue>::value;
+
+	// capacity + Group::WIDTH control bytes, the last group mirrors the first
+	// one so groups can be loaded at any position without wrapping.
+	int8_t *ctrl = nullptr;
+	Slot *slots = nullptr;
+	uint32_t capacity = 0; // Zero or a power of two.
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+
+	static _FORCE_INLINE_ uint32_t _get_max_load(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8;
+	}
+
+	static _FORCE_INLINE_ int8_t _h2(uint32_t p_hash) {
+		return (int8_t)(p_hash & 0x7F);
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_pos, int8_t p_value) {
+		ctrl[p_pos] = p_value;
+		if (p_pos < Group::WIDTH) {
+			ctrl[capacity + p_pos] = p_value;
+		}
+	}
+
+	int32_t _lookup_pos(const TKey &p_key) const {
+		if (unlikely(capacity == 0)) {
+			return -1;
+		}
+
+		uint32_t hash = Hasher::hash(p_key);
+		int8_t h2 = _h2(hash);
+		uint32_t mask = capacity - 1;
+		uint32_t pos = (hash >> 7) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			Group group(ctrl + pos);
+			for (typename Group::Mask m = group.match(h2); m; m &= m - 1) {
+				uint32_t idx = (pos + Group::lowest(m)) & mask;
+				if (Comparator::compare(slots[idx].key, p_key)) {
+					return idx;
+				}
+			}
+			if (group.match_empty()) {
+				return -1;
+			}
+			// Triangular probing over groups visits every group once.
+			step += Group::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	uint32_t _find_free_pos(uint32_t p_hash) const {
+		uint32_t mask = capacity - 1;
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			typename Group::Mask m = Group(ctrl + pos).match_empty_or_deleted();
+			if (m) {
+				return (pos + Group::lowest(m)) & mask;
+			}
+			step += Group::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		int8_t *old_ctrl = ctrl;
+		Slot *old_slots = slots;
+		uint32_t old_capacity = capacity;
+
+		capacity = p_new_capacity;
+		ctrl = static_cast<int8_t *>(Memory::alloc_static(capacity + Group::WIDTH));
+		slots = static_cast<Slot *>(Memory::alloc_static(sizeof(Slot) * capacity));
+		memset(ctrl, Group::CTRL_EMPTY, capacity + Group::WIDTH);
+		num_deleted = 0;
+
+		if (old_ctrl == nullptr) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] < 0) {
+				continue;
+			}
+			uint32_t hash = Hasher::hash(old_slots[i].key);
+			uint32_t pos = _find_free_pos(hash);
+			_set_ctrl(pos, _h2(hash));
+			if (TRIVIAL_SLOTS) {
+				memcpy((void *)&slots[pos], (const void *)&old_slots[i], sizeof(Slot));
+			} else {
+				memnew_placement(&slots[pos], Slot(old_slots[i]));
+				old_slots[i].~Slot();
+			}
+		}
+
+		Memory::free_static(old_ctrl);
+		Memory::free_static(old_slots);
+	}
+
+	uint32_t _insert_pos(const TKey &p_key, bool &r_exists) {
+		int32_t existing = _lookup_pos(p_key);
+		if (existing >= 0) {
+			r_exists = true;
+			return existing;
+		}
+		r_exists = false;
+
+		if (unlikely(capacity == 0)) {
+			_resize_and_rehash(MIN_CAPACITY);
+		} else if (num_elements + num_deleted >= _get_max_load(capacity)) {
+			// Mostly tombstones, rehashing at the same size is enough.
+			_resize_and_rehash(num_elements * 2 < _get_max_load(capacity) ? capacity : capacity * 2);
+		}
+
+		uint32_t hash = Hasher::hash(p_key);
+		uint32_t pos = _find_free_pos(hash);
+		if (ctrl[pos] == Group::CTRL_DELETED) {
+			num_deleted--;
+		}
+		_set_ctrl(pos, _h2(hash));
+		num_elements++;
+		return pos;
+	}
+
+	_FORCE_INLINE_ uint32_t _next_full(uint32_t p_pos) const {
+		while (p_pos < capacity && ctrl[p_pos] < 0) {
+			p_pos++;
+		}
+		return p_pos;
+	}
+
+	void _copy_from(const FlatHashMap &p_other) {
+		if (p_other.capacity == 0) {
+			return;
+		}
+		_resize_and_rehash(p_other.capacity);
+		for (uint32_t i = 0; i < p_other.capacity; i++) {
+			if (p_other.ctrl[i] >= 0) {
+				memnew_placement(&slots[i], Slot(p_other.slots[i]));
+			}
+		}
+		memcpy(ctrl, p_other.ctrl, capacity + Group::WIDTH);
+		num_elements = p_other.num_elements;
+		num_deleted = p_other.num_deleted;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr) {
+			return;
+		}
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (ctrl[i] >= 0 && !TRIVIAL_SLOTS) {
+				slots[i].~Slot();
+			}
+		}
+		memset(ctrl, Group::CTRL_EMPTY, capacity + Group::WIDTH);
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		int32_t pos = _lookup_pos(p_key);
+		CRASH_COND_MSG(pos < 0, "FlatHashMap key not found.");
+		return slots[pos].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		int32_t pos = _lookup_pos(p_key);
+		CRASH_COND_MSG(pos < 0, "FlatHashMap key not found.");
+		return slots[pos].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		int32_t pos = _lookup_pos(p_key);
+		return pos < 0 ? nullptr : &slots[pos].value;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		int32_t pos = _lookup_pos(p_key);
+		return pos < 0 ? nullptr : &slots[pos].value;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup_pos(p_key) >= 0;
+	}
+
+	bool erase(const TKey &p_key) {
+		int32_t pos = _lookup_pos(p_key);
+		if (pos < 0) {
+			return false;
+		}
+
+		if (!TRIVIAL_SLOTS) {
+			slots[pos].~Slot();
+		}
+		_set_ctrl(pos, Group::CTRL_DELETED);
+		num_elements--;
+		num_deleted++;
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = MAX(capacity, MIN_CAPACITY);
+		while (_get_max_load(new_capacity) < p_new_capacity) {
+			new_capacity *= 2;
+		}
+		if (new_capacity != capacity) {
+			_resize_and_rehash(new_capacity);
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->slots[pos];
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->slots[pos]; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			pos = map->_next_full(pos + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && pos < map->capacity;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const FlatHashMap *p_map, uint32_t p_pos) {
+			map = p_map;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const FlatHashMap *map = nullptr;
+		uint32_t pos = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->slots[pos];
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->slots[pos]; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			pos = map->_next_full(pos + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && pos < map->capacity;
+		}
+
+		_FORCE_INLINE_ Iterator(FlatHashMap *p_map, uint32_t p_pos) {
+			map = p_map;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, pos);
+		}
+
+	private:
+		FlatHashMap *map = nullptr;
+		uint32_t pos = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_full(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		int32_t pos = _lookup_pos(p_key);
+		return pos < 0 ? end() : Iterator(this, pos);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_full(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		int32_t pos = _lookup_pos(p_key);
+		return pos < 0 ? end() : ConstIterator(this, pos);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		int32_t pos = _lookup_pos(p_key);
+		CRASH_COND(pos < 0);
+		return slots[pos].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		bool exists;
+		uint32_t pos = _insert_pos(p_key, exists);
+		if (!exists) {
+			memnew_placement(&slots[pos], Slot(p_key, TValue()));
+		}
+		return slots[pos].value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		bool exists;
+		uint32_t pos = _insert_pos(p_key, exists);
+		if (exists) {
+			slots[pos].value = p_value;
+		} else {
+			memnew_placement(&slots[pos], Slot(p_key, p_value));
+		}
+		return Iterator(this, pos);
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		_copy_from(p_other);
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		reset();
+		_copy_from(p_other);
+	}
+
+	FlatHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashMap() {}
+
+	void reset() {
+		clear();
+		if (ctrl != nullptr) {
+			Memory::free_static(ctrl);
+			Memory::free_static(slots);
+			ctrl = nullptr;
+			slots = nullptr;
+			capacity = 0;
+		}
+	}
+
+	~FlatHashMap() {
+		reset();
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
@@ -40,7 +40,8 @@
 
 // If tight, it grows strictly as much as needed.
 // Otherwise, it grows exponentially (the default and what you want in most cases).
-template <class T, class U = uint32_t, bool force_trivial = false, bool tight = false>
+// The allocator can be swapped, see FrameLocalVector.
+template <class T, class U = uint32_t, bool force_trivial = false, bool tight = false, class A = DefaultAllocator>
 class LocalVector {
 private:
 	U count = 0;
@@ -63,7 +64,7 @@ public:
 			} else {
 				capacity <<= 1;
 			}
-			data = (T *)memrealloc(data, capacity * sizeof(T));
+			data = (T *)A::realloc(data, capacity * sizeof(T));
 			CRASH_COND_MSG(!data, "Out of memory");
 		}
 
@@ -115,7 +116,7 @@ public:
 	_FORCE_INLINE_ void reset() {
 		clear();
 		if (data) {
-			memfree(data);
+			A::free(data);
 			data = nullptr;
 			capacity = 0;
 		}
@@ -126,7 +127,7 @@ public:
 		p_size = tight ? p_size : nearest_power_of_2_templated(p_size);
 		if (p_size > capacity) {
 			capacity = p_size;
-			data = (T *)memrealloc(data, capacity * sizeof(T));
+			data = (T *)A::realloc(data, capacity * sizeof(T));
 			CRASH_COND_MSG(!data, "Out of memory");
 		}
 	}
@@ -148,7 +149,7 @@ public:
 				while (capacity < p_size) {
 					capacity <<= 1;
 				}
-				data = (T *)memrealloc(data, capacity * sizeof(T));
+				data = (T *)A::realloc(data, capacity * sizeof(T));
 				CRASH_COND_MSG(!data, "Out of memory");
 			}
 			if (!__has_trivial_constructor(T) && !force_trivial) {
@@ -267,4 +268,243 @@ public:
 template <class T, class U = uint32_t, bool force_trivial = false>
 using TightLocalVector = LocalVector<T, U, force_trivial, true>;
 
+// Allocate from the calling thread's FrameAllocator arena instead of the heap.
+// Only meant for temporary data which is freed before the end of the frame.
+template <class T, class U = uint32_t, bool force_trivial = false>
+using FrameLocalVector = LocalVector<T, U, force_trivial, false, FrameAllocator>;
+
+template <class T, class U = uint32_t, bool force_trivial = false>
+using TightFrameLocalVector = LocalVector<T, U, force_trivial, true, FrameAllocator>;
+
+// Like LocalVector, but keeps up to N elements inside the object itself and only
+// allocates from the heap past that, so small vectors don't allocate at all.
+// Whether the elements are inline is told by the capacity, not by a pointer into the
+// object, so it can be moved in memory like other elements of Godot containers.
+template <class T, uint32_t N, class U = uint32_t, bool force_trivial = false>
+class InlineLocalVector {
+	static_assert(N > 0, "InlineLocalVector needs room for at least one inline element.");
+
+private:
+	U count = 0;
+	U capacity = N;
+	T *heap_data = nullptr; // Only valid when capacity is bigger than N.
+	alignas(T) uint8_t inline_buffer[sizeof(T) * N];
+
+	_FORCE_INLINE_ bool _is_inline() const { return capacity <= N; }
+	_FORCE_INLINE_ T *_ptr() { return _is_inline() ? (T *)inline_buffer : heap_data; }
+	_FORCE_INLINE_ const T *_ptr() const { return _is_inline() ? (const T *)inline_buffer : heap_data; }
+
+	void _grow(U p_capacity) {
+		if (_is_inline()) {
+			T *heap = (T *)memalloc(p_capacity * sizeof(T));
+			CRASH_COND_MSG(!heap, "Out of memory");
+			memcpy((void *)heap, (const void *)inline_buffer, count * sizeof(T));
+			heap_data = heap;
+		} else {
+			heap_data = (T *)memrealloc(heap_data, p_capacity * sizeof(T));
+			CRASH_COND_MSG(!heap_data, "Out of memory");
+		}
+		capacity = p_capacity;
+	}
+
+public:
+	T *ptr() {
+		return _ptr();
+	}
+
+	const T *ptr() const {
+		return _ptr();
+	}
+
+	_FORCE_INLINE_ bool is_inline() const { return _is_inline(); }
+
+	_FORCE_INLINE_ void push_back(T p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(capacity == 0 ? 1 : capacity << 1);
+		}
+
+		if (!__has_trivial_constructor(T) && !force_trivial) {
+			memnew_placement(&_ptr()[count++], T(p_elem));
+		} else {
+			_ptr()[count++] = p_elem;
+		}
+	}
+
+	void remove_at(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		for (U i = p_index; i < count; i++) {
+			_ptr()[i] = _ptr()[i + 1];
+		}
+		if (!__has_trivial_destructor(T) && !force_trivial) {
+			_ptr()[count].~T();
+		}
+	}
+
+	/// Removes the item copying the last value into the position of the one to
+	/// remove. It's generally faster than `remove`.
+	void remove_at_unordered(U p_index) {
+		ERR_FAIL_INDEX(p_index, count);
+		count--;
+		if (count > p_index) {
+			_ptr()[p_index] = _ptr()[count];
+		}
+		if (!__has_trivial_destructor(T) && !force_trivial) {
+			_ptr()[count].~T();
+		}
+	}
+
+	void erase(const T &p_val) {
+		int64_t idx = find(p_val);
+		if (idx >= 0) {
+			remove_at(idx);
+		}
+	}
+
+	void invert() {
+		for (U i = 0; i < count / 2; i++) {
+			SWAP(_ptr()[i], _ptr()[count - i - 1]);
+		}
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+	_FORCE_INLINE_ void reset() {
+		clear();
+		if (!_is_inline()) {
+			memfree(heap_data);
+			heap_data = nullptr;
+			capacity = N;
+		}
+	}
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	_FORCE_INLINE_ void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(nearest_power_of_2_templated(p_size));
+		}
+	}
+
+	_FORCE_INLINE_ U size() const { return count; }
+	void resize(U p_size) {
+		if (p_size < count) {
+			if (!__has_trivial_destructor(T) && !force_trivial) {
+				for (U i = p_size; i < count; i++) {
+					_ptr()[i].~T();
+				}
+			}
+			count = p_size;
+		} else if (p_size > count) {
+			if (unlikely(p_size > capacity)) {
+				U new_capacity = capacity == 0 ? 1 : capacity;
+				while (new_capacity < p_size) {
+					new_capacity <<= 1;
+				}
+				_grow(new_capacity);
+			}
+			if (!__has_trivial_constructor(T) && !force_trivial) {
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&_ptr()[i], T);
+				}
+			}
+			count = p_size;
+		}
+	}
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return _ptr()[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return _ptr()[p_index];
+	}
+
+	void insert(U p_pos, T p_val) {
+		ERR_FAIL_UNSIGNED_INDEX(p_pos, count + 1);
+		if (p_pos == count) {
+			push_back(p_val);
+		} else {
+			resize(count + 1);
+			for (U i = count - 1; i > p_pos; i--) {
+				_ptr()[i] = _ptr()[i - 1];
+			}
+			_ptr()[p_pos] = p_val;
+		}
+	}
+
+	int64_t find(const T &p_val, U p_from = 0) const {
+		for (U i = p_from; i < count; i++) {
+			if (_ptr()[i] == p_val) {
+				return int64_t(i);
+			}
+		}
+		return -1;
+	}
+
+	template <class C>
+	void sort_custom() {
+		U len = count;
+		if (len == 0) {
+			return;
+		}
+
+		SortArray<T, C> sorter;
+		sorter.sort(_ptr(), len);
+	}
+
+	void sort() {
+		sort_custom<_DefaultComparator<T>>();
+	}
+
+	void ordered_insert(T p_val) {
+		U i;
+		for (i = 0; i < count; i++) {
+			if (p_val < _ptr()[i]) {
+				break;
+			}
+		}
+		insert(i, p_val);
+	}
+
+	operator Vector<T>() const {
+		Vector<T> ret;
+		ret.resize(size());
+		T *w = ret.ptrw();
+		memcpy(w, _ptr(), sizeof(T) * count);
+		return ret;
+	}
+
+	_FORCE_INLINE_ InlineLocalVector() {}
+	_FORCE_INLINE_ InlineLocalVector(std::initializer_list<T> p_init) {
+		reserve(p_init.size());
+		for (const T &element : p_init) {
+			push_back(element);
+		}
+	}
+	_FORCE_INLINE_ InlineLocalVector(const InlineLocalVector &p_from) {
+		resize(p_from.size());
+		for (U i = 0; i < p_from.count; i++) {
+			_ptr()[i] = p_from._ptr()[i];
+		}
+	}
+	inline void operator=(const InlineLocalVector &p_from) {
+		if (this == &p_from) {
+			return;
+		}
+		resize(p_from.size());
+		for (U i = 0; i < p_from.count; i++) {
+			_ptr()[i] = p_from._ptr()[i];
+		}
+	}
+	inline void operator=(const Vector<T> &p_from) {
+		resize(p_from.size());
+		for (U i = 0; i < count; i++) {
+			_ptr()[i] = p_from[i];
+		}
+	}
+
+	_FORCE_INLINE_ ~InlineLocalVector() {
+		reset();
+	}
+};
+
 #endif // LOCAL_VECTOR_H
@@ -101,6 +101,33 @@ public:
 		}
 	}
 
+	bool erase(const TKey &p_key) {
+		Element *e = _map.getptr(p_key);
+		if (!e) {
+			return false;
+		}
+		_list.erase(*e);
+		_map.erase(p_key);
+		return true;
+	}
+
+	// Removes the least recently used entry, for callers that evict by something other than the entry count.
+	bool evict_least_recent(TKey *r_key = nullptr, TData *r_data = nullptr) {
+		if (_list.is_empty()) {
+			return false;
+		}
+		Element d = _list.back();
+		if (r_key) {
+			*r_key = d->get().key;
+		}
+		if (r_data) {
+			*r_data = d->get().data;
+		}
+		_map.erase(d->get().key);
+		_list.pop_back();
+		return true;
+	}
+
 	_FORCE_INLINE_ size_t get_capacity() const { return capacity; }
 	_FORCE_INLINE_ size_t get_size() const { return _map.size(); }
 
@@ -36,11 +36,13 @@
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
+#include <atomic>
 #include <typeinfo>
 
 class RID_AllocBase {
@@ -76,10 +78,46 @@ class RID_Alloc : public RID_AllocBase {
 	uint32_t elements_in_chunk;
 	uint32_t max_alloc = 0;
 	uint32_t alloc_count = 0;
+	uint32_t chunk_table_size = 0;
 
 	const char *description = nullptr;
 
+	// When THREAD_SAFE, only allocation, initialization and freeing take the lock.
+	// Lookups read the chunk tables and validators with acquire loads instead, which
+	// is why chunk tables replaced while growing are only freed on destruction.
 	SpinLock spin_lock;
+	LocalVector<void *> retired_tables;
+
+	template <class V>
+	static _FORCE_INLINE_ V _load(const V &p_value) {
+		if (THREAD_SAFE) {
+			return ((const std::atomic<V> *)&p_value)->load(std::memory_order_acquire);
+		}
+		return p_value;
+	}
+
+	template <class V>
+	static _FORCE_INLINE_ void _store(V &r_dst, V p_value) {
+		if (THREAD_SAFE) {
+			((std::atomic<V> *)&r_dst)->store(p_value, std::memory_order_release);
+		} else {
+			r_dst = p_value;
+		}
+	}
+
+	template <class V>
+	_FORCE_INLINE_ void _grow_table(V **&r_table, uint32_t p_new_size) {
+		V **new_table = (V **)memalloc(sizeof(V *) * p_new_size);
+		if (r_table) {
+			memcpy(new_table, r_table, sizeof(V *) * chunk_table_size);
+			if (THREAD_SAFE) {
+				retired_tables.push_back(r_table);
+			} else {
+				memfree(r_table);
+			}
+		}
+		_store(r_table, new_table);
+	}
 
 	_FORCE_INLINE_ RID _allocate_rid() {
 		if (THREAD_SAFE) {
@@ -88,17 +126,19 @@ class RID_Alloc : public RID_AllocBase {
 
 		if (alloc_count == max_alloc) {
 			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
+			uint32_t chunk_count = max_alloc / elements_in_chunk;
+
+			//grow chunk tables
+			if (chunk_count == chunk_table_size) {
+				uint32_t new_size = chunk_table_size == 0 ? 1 : chunk_table_size * 2;
+				_grow_table(chunks, new_size);
+				_grow_table(validator_chunks, new_size);
+				_grow_table(free_list_chunks, new_size);
+				chunk_table_size = new_size;
+			}
 
-			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
 			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
-
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
 			//initialize
@@ -108,7 +148,8 @@ class RID_Alloc : public RID_AllocBase {
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			// Publish the new chunk to lookups.
+			_store(max_alloc, max_alloc + elements_in_chunk);
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
@@ -121,9 +162,7 @@ class RID_Alloc : public RID_AllocBase {
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_store(validator_chunks[free_chunk][free_element], validator | 0x80000000); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -134,6 +173,60 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	_FORCE_INLINE_ T *_initialize(const RID &p_rid) {
+		if (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+
+		uint64_t id = p_rid.get_id();
+		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+		if (unlikely(p_rid == RID() || idx >= max_alloc)) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			return nullptr;
+		}
+
+		uint32_t idx_chunk = idx / elements_in_chunk;
+		uint32_t idx_element = idx % elements_in_chunk;
+
+		uint32_t validator = uint32_t(id >> 32);
+
+		if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+
+		if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+
+		T *ptr = &chunks[idx_chunk][idx_element];
+
+		if (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+
+		return ptr;
+	}
+
+	_FORCE_INLINE_ void _mark_initialized(const RID &p_rid) {
+		uint32_t idx = uint32_t(p_rid.get_id() & 0xFFFFFFFF);
+		if (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+		uint32_t &validator = validator_chunks[idx / elements_in_chunk][idx % elements_in_chunk];
+		_store(validator, validator & 0x7FFFFFFF);
+		if (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+	}
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -152,19 +245,21 @@ public:
 	}
 
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
+		if (unlikely(p_initialize)) {
+			T *ptr = _initialize(p_rid);
+			if (ptr) {
+				_mark_initialized(p_rid);
+			}
+			return ptr;
+		}
+
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= _load(max_alloc))) {
 			return nullptr;
 		}
 
@@ -172,65 +267,35 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
+		uint32_t current = _load(_load(validator_chunks)[idx_chunk][idx_element]);
 
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-				return nullptr;
-			}
-
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		if (unlikely(current != validator)) {
+			if ((current & 0x80000000) && current != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return &_load(chunks)[idx_chunk][idx_element];
 	}
 	void initialize_rid(RID p_rid) {
-		T *mem = get_or_null(p_rid, true);
+		T *mem = _initialize(p_rid);
 		ERR_FAIL_COND(!mem);
 		memnew_placement(mem, T);
+		// Only visible to lookups once constructed.
+		_mark_initialized(p_rid);
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
-		T *mem = get_or_null(p_rid, true);
+		T *mem = _initialize(p_rid);
 		ERR_FAIL_COND(!mem);
 		memnew_placement(mem, T(p_value));
+		_mark_initialized(p_rid);
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= _load(max_alloc))) {
 			return false;
 		}
 
@@ -239,13 +304,7 @@ public:
 
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (_load(_load(validator_chunks)[idx_chunk][idx_element]) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -278,8 +337,8 @@ public:
 			ERR_FAIL();
 		}
 
+		_store(validator_chunks[idx_chunk][idx_element], 0xFFFFFFFF); // go invalid
 		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -368,6 +427,10 @@ public:
 			memfree(free_list_chunks);
 			memfree(validator_chunks);
 		}
+
+		for (uint32_t i = 0; i < retired_tables.size(); i++) {
+			memfree(retired_tables[i]);
+		}
 	}
 };
 
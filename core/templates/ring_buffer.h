@@ -93,8 +93,9 @@ public:
 			int end = pos + to_read;
 			end = MIN(end, size());
 			int total = end - pos;
+			const T *read = data.ptr();
 			for (int i = 0; i < total; i++) {
-				p_buf[dst++] = data[pos + i];
+				p_buf[dst++] = read[pos + i];
 			}
 			to_read -= total;
 			pos = 0;
@@ -129,6 +130,15 @@ public:
 		return -1;
 	}
 
+	// Returns a pointer to the next p_size elements to read, or nullptr if they are not all there or wrap around the end of the buffer.
+	// The pointer stays valid until the buffer is written to or resized.
+	const T *get_read_ptr(int p_size) const {
+		if (p_size > data_left() || read_pos + p_size > size()) {
+			return nullptr;
+		}
+		return data.ptr() + read_pos;
+	}
+
 	inline int advance_read(int p_n) {
 		p_n = MIN(p_n, data_left());
 		inc(read_pos, p_n);
@@ -159,8 +169,9 @@ public:
 			end = MIN(end, size());
 			int total = end - pos;
 
+			T *write = data.ptrw();
 			for (int i = 0; i < total; i++) {
-				data.write[pos + i] = p_buf[src++];
+				write[pos + i] = p_buf[src++];
 			}
 			to_write -= total;
 			pos = 0;
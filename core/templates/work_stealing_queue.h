@@ -0,0 +1,134 @@
+/*************************************************************************/
+/*  work_stealing_queue.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef WORK_STEALING_QUEUE_H
+#define WORK_STEALING_QUEUE_H
+
+#include "core/typedefs.h"
+
+#include <atomic>
+
+// Bounded Chase-Lev deque (as described in "Correct and Efficient Work-Stealing
+// for Weak Memory Models", Lê et al. 2013).
+// Only the owner thread may call push() and pop(), which operate on the bottom
+// end in LIFO order. Any other thread may call steal(), which takes from the top
+// end in FIFO order. The queue never grows; push() fails when it is full and the
+// caller is expected to fall back to some other queue.
+
+template <class T, uint32_t SIZE = 1024>
+class WorkStealingQueue {
+	static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "WorkStealingQueue size must be a power of two.");
+	static_assert(std::atomic<T>::is_always_lock_free);
+
+	// Top and bottom are written by different threads, keep them on separate cache lines.
+	alignas(64) std::atomic<int64_t> top;
+	alignas(64) std::atomic<int64_t> bottom;
+	alignas(64) std::atomic<T> buffer[SIZE];
+
+	WorkStealingQueue(const WorkStealingQueue &) = delete;
+	WorkStealingQueue &operator=(const WorkStealingQueue &) = delete;
+
+public:
+	enum StealResult {
+		STEAL_OK,
+		STEAL_EMPTY,
+		STEAL_ABORT, // Lost a race with another thief or the owner, may retry.
+	};
+
+	// Owner only.
+	_FORCE_INLINE_ bool push(T p_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		if (b - t >= (int64_t)SIZE) {
+			return false;
+		}
+		buffer[b & (SIZE - 1)].store(p_value, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Owner only.
+	_FORCE_INLINE_ bool pop(T &r_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		r_value = buffer[b & (SIZE - 1)].load(std::memory_order_relaxed);
+		if (t == b) {
+			// Last element, race against thieves for it.
+			bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	// Any thread.
+	_FORCE_INLINE_ StealResult steal(T &r_value) {
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t b = bottom.load(std::memory_order_acquire);
+
+		if (t >= b) {
+			return STEAL_EMPTY;
+		}
+
+		T value = buffer[t & (SIZE - 1)].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return STEAL_ABORT;
+		}
+		r_value = value;
+		return STEAL_OK;
+	}
+
+	// Approximate when called from a thread other than the owner.
+	_FORCE_INLINE_ bool is_empty() const {
+		return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+	}
+
+	_FORCE_INLINE_ uint32_t get_capacity() const {
+		return SIZE;
+	}
+
+	WorkStealingQueue() {
+		top.store(0, std::memory_order_relaxed);
+		bottom.store(0, std::memory_order_relaxed);
+	}
+};
+
+#endif // WORK_STEALING_QUEUE_H
@@ -71,6 +71,17 @@
 #endif
 #endif
 
+// Should never inline, e.g. to keep a large stack frame out of a recursive caller.
+#ifndef _NO_INLINE_
+#if defined(__GNUC__)
+#define _NO_INLINE_ __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define _NO_INLINE_ __declspec(noinline)
+#else
+#define _NO_INLINE_
+#endif
+#endif
+
 // No discard allows the compiler to flag warnings if we don't use the return value of functions / classes
 #ifndef _NO_DISCARD_
 #define _NO_DISCARD_ [[nodiscard]]
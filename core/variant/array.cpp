@@ -38,6 +38,7 @@
 #include "core/templates/vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/variant.h"
+#include "core/variant/variant_internal.h"
 
 class ArrayPrivate {
 public:
@@ -559,9 +560,51 @@ struct _ArrayVariantSort {
 	}
 };
 
+// Typed arrays mostly hold elements of their type, so these compare the values directly instead of going through Variant::evaluate().
+// They can still hold nulls (resize() pads with them), which are compared as Variants.
+struct _ArrayIntSort {
+	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
+		if (unlikely(p_l.get_type() != Variant::INT || p_r.get_type() != Variant::INT)) {
+			return _ArrayVariantSort()(p_l, p_r);
+		}
+		return *VariantInternal::get_int(&p_l) < *VariantInternal::get_int(&p_r);
+	}
+};
+
+struct _ArrayFloatSort {
+	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
+		if (unlikely(p_l.get_type() != Variant::FLOAT || p_r.get_type() != Variant::FLOAT)) {
+			return _ArrayVariantSort()(p_l, p_r);
+		}
+		return *VariantInternal::get_float(&p_l) < *VariantInternal::get_float(&p_r);
+	}
+};
+
+struct _ArrayStringSort {
+	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
+		if (unlikely(p_l.get_type() != Variant::STRING || p_r.get_type() != Variant::STRING)) {
+			return _ArrayVariantSort()(p_l, p_r);
+		}
+		return *VariantInternal::get_string(&p_l) < *VariantInternal::get_string(&p_r);
+	}
+};
+
 void Array::sort() {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
-	_p->array.sort_custom<_ArrayVariantSort>();
+	switch (_p->typed.type) {
+		case Variant::INT:
+			_p->array.sort_custom<_ArrayIntSort>();
+			break;
+		case Variant::FLOAT:
+			_p->array.sort_custom<_ArrayFloatSort>();
+			break;
+		case Variant::STRING:
+			_p->array.sort_custom<_ArrayStringSort>();
+			break;
+		default:
+			_p->array.sort_custom<_ArrayVariantSort>();
+			break;
+	}
 }
 
 void Array::sort_custom(const Callable &p_callable) {
@@ -586,8 +629,24 @@ void Array::shuffle() {
 
 int Array::bsearch(const Variant &p_value, bool p_before) {
 	ERR_FAIL_COND_V(!_p->typed.validate(p_value, "binary search"), -1);
-	SearchArray<Variant, _ArrayVariantSort> avs;
-	return avs.bisect(_p->array.ptrw(), _p->array.size(), p_value, p_before);
+	switch (_p->typed.type) {
+		case Variant::INT: {
+			SearchArray<Variant, _ArrayIntSort> avs;
+			return avs.bisect(_p->array.ptrw(), _p->array.size(), p_value, p_before);
+		}
+		case Variant::FLOAT: {
+			SearchArray<Variant, _ArrayFloatSort> avs;
+			return avs.bisect(_p->array.ptrw(), _p->array.size(), p_value, p_before);
+		}
+		case Variant::STRING: {
+			SearchArray<Variant, _ArrayStringSort> avs;
+			return avs.bisect(_p->array.ptrw(), _p->array.size(), p_value, p_before);
+		}
+		default: {
+			SearchArray<Variant, _ArrayVariantSort> avs;
+			return avs.bisect(_p->array.ptrw(), _p->array.size(), p_value, p_before);
+		}
+	}
 }
 
 int Array::bsearch_custom(const Variant &p_value, const Callable &p_callable, bool p_before) {
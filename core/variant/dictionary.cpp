@@ -31,6 +31,7 @@
 #include "dictionary.h"
 
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 // required in this order by VariantInternal, do not remove this comment.
@@ -39,10 +40,82 @@
 #include "core/variant/type_info.h"
 #include "core/variant/variant_internal.h"
 
+// Allocates the elements of one dictionary from a few blocks that double in size, instead of one heap allocation per element.
+// Elements never move once allocated (so references returned by operator[] stay valid), freed ones are reused
+// through an intrusive free list, and the blocks are released as soon as the dictionary is empty again.
+template <class T>
+class DictionaryElementAllocator {
+	static_assert(sizeof(T) >= sizeof(T *));
+
+	enum {
+		FIRST_BLOCK_SIZE = 8,
+		MAX_BLOCK_SIZE = 1024,
+	};
+
+	LocalVector<T *> blocks;
+	T *free_list = nullptr;
+	uint32_t block_size = 0;
+	uint32_t block_used = 0;
+	uint32_t allocated = 0;
+
+	void _reset() {
+		for (uint32_t i = 0; i < blocks.size(); i++) {
+			memfree(blocks[i]);
+		}
+		blocks.reset();
+		free_list = nullptr;
+		block_size = 0;
+		block_used = 0;
+	}
+
+public:
+	template <class... Args>
+	T *new_allocation(const Args &&...p_args) {
+		T *mem;
+		if (free_list) {
+			mem = free_list;
+			free_list = *(T **)mem;
+		} else {
+			if (block_used == block_size) {
+				block_size = block_size ? MIN(block_size * 2, (uint32_t)MAX_BLOCK_SIZE) : (uint32_t)FIRST_BLOCK_SIZE;
+				block_used = 0;
+				blocks.push_back((T *)memalloc(sizeof(T) * block_size));
+			}
+			mem = &blocks[blocks.size() - 1][block_used++];
+		}
+
+		allocated++;
+		memnew_placement(mem, T(p_args...));
+		return mem;
+	}
+
+	void delete_allocation(T *p_allocation) {
+		p_allocation->~T();
+		allocated--;
+		if (allocated == 0) {
+			_reset();
+		} else {
+			*(T **)p_allocation = free_list;
+			free_list = p_allocation;
+		}
+	}
+
+	DictionaryElementAllocator() {}
+	DictionaryElementAllocator(const DictionaryElementAllocator &p_other) {} // Not shared, every map allocates its own elements.
+	void operator=(const DictionaryElementAllocator &p_other) {}
+
+	~DictionaryElementAllocator() {
+		ERR_FAIL_COND(allocated > 0);
+		_reset();
+	}
+};
+
+typedef HashMap<Variant, Variant, VariantHasher, VariantComparator, DictionaryElementAllocator<HashMapElement<Variant, Variant>>> DictionaryVariantMap;
+
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, VariantComparator> variant_map;
+	DictionaryVariantMap variant_map;
 };
 
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
@@ -109,13 +182,13 @@ const Variant &Dictionary::operator[](const Variant &p_key) const {
 }
 
 const Variant *Dictionary::getptr(const Variant &p_key) const {
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstIterator E;
+	DictionaryVariantMap::ConstIterator E;
 
 	if (p_key.get_type() == Variant::STRING_NAME) {
 		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(sn->operator String());
+		E = ((const DictionaryVariantMap *)&_p->variant_map)->find(sn->operator String());
 	} else {
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
+		E = ((const DictionaryVariantMap *)&_p->variant_map)->find(p_key);
 	}
 
 	if (!E) {
@@ -125,13 +198,13 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 }
 
 Variant *Dictionary::getptr(const Variant &p_key) {
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E;
+	DictionaryVariantMap::Iterator E;
 
 	if (p_key.get_type() == Variant::STRING_NAME) {
 		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		E = ((HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(sn->operator String());
+		E = ((DictionaryVariantMap *)&_p->variant_map)->find(sn->operator String());
 	} else {
-		E = ((HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
+		E = ((DictionaryVariantMap *)&_p->variant_map)->find(p_key);
 	}
 	if (!E) {
 		return nullptr;
@@ -145,13 +218,13 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 }
 
 Variant Dictionary::get_valid(const Variant &p_key) const {
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstIterator E;
+	DictionaryVariantMap::ConstIterator E;
 
 	if (p_key.get_type() == Variant::STRING_NAME) {
 		const StringName *sn = VariantInternal::get_string_name(&p_key);
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(sn->operator String());
+		E = ((const DictionaryVariantMap *)&_p->variant_map)->find(sn->operator String());
 	} else {
-		E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
+		E = ((const DictionaryVariantMap *)&_p->variant_map)->find(p_key);
 	}
 
 	if (!E) {
@@ -229,7 +302,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	}
 	recursion_count++;
 	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstIterator other_E = ((const HashMap<Variant, Variant, VariantHasher, VariantComparator> *)&p_dictionary._p->variant_map)->find(this_E.key);
+		DictionaryVariantMap::ConstIterator other_E = ((const DictionaryVariantMap *)&p_dictionary._p->variant_map)->find(this_E.key);
 		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count)) {
 			return false;
 		}
@@ -351,7 +424,7 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 		}
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.find(*p_key);
+	DictionaryVariantMap::Iterator E = _p->variant_map.find(*p_key);
 
 	if (!E) {
 		return nullptr;
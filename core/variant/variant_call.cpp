@@ -35,6 +35,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/packed_array_math.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
@@ -893,6 +894,86 @@ struct _VariantCall {
 		return len;
 	}
 
+	// Bulk math on the numeric packed arrays, see PackedArrayMath.
+
+#define PACKED_SCALAR_ARRAY_MATH_FUNCS(m_type, m_scalar)                                                        \
+	static void func_##m_type##_add(m_type *p_instance, const m_type &p_array) {                                \
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");        \
+		PackedArrayMath::add(p_instance->ptrw(), p_array.ptr(), p_instance->size());                            \
+	}                                                                                                           \
+	static void func_##m_type##_multiply(m_type *p_instance, const m_type &p_array) {                           \
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");        \
+		PackedArrayMath::multiply(p_instance->ptrw(), p_array.ptr(), p_instance->size());                       \
+	}                                                                                                           \
+	static void func_##m_type##_add_scalar(m_type *p_instance, double p_value) {                                \
+		PackedArrayMath::add_scalar(p_instance->ptrw(), m_scalar(p_value), p_instance->size());                 \
+	}                                                                                                           \
+	static void func_##m_type##_multiply_scalar(m_type *p_instance, double p_value) {                           \
+		PackedArrayMath::multiply_scalar(p_instance->ptrw(), m_scalar(p_value), p_instance->size());            \
+	}                                                                                                           \
+	static void func_##m_type##_lerp(m_type *p_instance, const m_type &p_to, double p_weight) {                 \
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");           \
+		PackedArrayMath::lerp(p_instance->ptrw(), p_to.ptr(), m_scalar(p_weight), p_instance->size());          \
+	}                                                                                                           \
+	static void func_##m_type##_clamp(m_type *p_instance, double p_min, double p_max) {                         \
+		PackedArrayMath::clamp(p_instance->ptrw(), m_scalar(p_min), m_scalar(p_max), p_instance->size());       \
+	}                                                                                                           \
+	static double func_##m_type##_dot(m_type *p_instance, const m_type &p_array) {                              \
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0.0, "Both arrays must have the same size."); \
+		return PackedArrayMath::dot(p_instance->ptr(), p_array.ptr(), p_instance->size());                      \
+	}                                                                                                           \
+	static double func_##m_type##_sum(m_type *p_instance) {                                                     \
+		return PackedArrayMath::sum(p_instance->ptr(), p_instance->size());                                     \
+	}                                                                                                           \
+	static double func_##m_type##_min(m_type *p_instance) {                                                     \
+		return PackedArrayMath::min(p_instance->ptr(), p_instance->size());                                     \
+	}                                                                                                           \
+	static double func_##m_type##_max(m_type *p_instance) {                                                     \
+		return PackedArrayMath::max(p_instance->ptr(), p_instance->size());                                     \
+	}
+
+	PACKED_SCALAR_ARRAY_MATH_FUNCS(PackedFloat32Array, float)
+	PACKED_SCALAR_ARRAY_MATH_FUNCS(PackedFloat64Array, double)
+
+#undef PACKED_SCALAR_ARRAY_MATH_FUNCS
+
+	// Vector arrays are processed as flat arrays of real_t for the component-wise operations.
+
+#define PACKED_VECTOR_ARRAY_MATH_FUNCS(m_type, m_vector, m_components, m_transform, m_transform_func, m_dot_func, m_sum_func)                 \
+	static void func_##m_type##_add(m_type *p_instance, const m_type &p_array) {                                                              \
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");                                      \
+		PackedArrayMath::add((real_t *)p_instance->ptrw(), (const real_t *)p_array.ptr(), p_instance->size() * m_components);                 \
+	}                                                                                                                                         \
+	static void func_##m_type##_multiply(m_type *p_instance, const m_type &p_array) {                                                         \
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");                                      \
+		PackedArrayMath::multiply((real_t *)p_instance->ptrw(), (const real_t *)p_array.ptr(), p_instance->size() * m_components);            \
+	}                                                                                                                                         \
+	static void func_##m_type##_multiply_scalar(m_type *p_instance, double p_value) {                                                         \
+		PackedArrayMath::multiply_scalar((real_t *)p_instance->ptrw(), real_t(p_value), p_instance->size() * m_components);                   \
+	}                                                                                                                                         \
+	static void func_##m_type##_lerp(m_type *p_instance, const m_type &p_to, double p_weight) {                                               \
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");                                         \
+		PackedArrayMath::lerp((real_t *)p_instance->ptrw(), (const real_t *)p_to.ptr(), real_t(p_weight), p_instance->size() * m_components); \
+	}                                                                                                                                         \
+	static PackedFloat32Array func_##m_type##_dot(m_type *p_instance, const m_type &p_array) {                                                \
+		PackedFloat32Array dots;                                                                                                              \
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), dots, "Both arrays must have the same size.");                              \
+		dots.resize(p_instance->size());                                                                                                      \
+		PackedArrayMath::m_dot_func(p_instance->ptr(), p_array.ptr(), dots.ptrw(), p_instance->size());                                       \
+		return dots;                                                                                                                          \
+	}                                                                                                                                         \
+	static m_vector func_##m_type##_sum(m_type *p_instance) {                                                                                 \
+		return PackedArrayMath::m_sum_func(p_instance->ptr(), p_instance->size());                                                            \
+	}                                                                                                                                         \
+	static void func_##m_type##_transform(m_type *p_instance, const m_transform &p_transform) {                                               \
+		PackedArrayMath::m_transform_func(p_instance->ptrw(), p_transform, p_instance->size());                                               \
+	}
+
+	PACKED_VECTOR_ARRAY_MATH_FUNCS(PackedVector2Array, Vector2, 2, Transform2D, transform_vector2, dot_vector2, sum_vector2)
+	PACKED_VECTOR_ARRAY_MATH_FUNCS(PackedVector3Array, Vector3, 3, Transform3D, transform_vector3, dot_vector3, sum_vector3)
+
+#undef PACKED_VECTOR_ARRAY_MATH_FUNCS
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->call(p_args, p_argcount, r_ret, r_error);
@@ -2176,6 +2257,17 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat32Array, add, _VariantCall::func_PackedFloat32Array_add, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply, _VariantCall::func_PackedFloat32Array_multiply, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, add_scalar, _VariantCall::func_PackedFloat32Array_add_scalar, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_scalar, _VariantCall::func_PackedFloat32Array_multiply_scalar, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedFloat32Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloat32Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloat32Array_dot, sarray("array"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -2199,6 +2291,17 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat64Array, add, _VariantCall::func_PackedFloat64Array_add, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply, _VariantCall::func_PackedFloat64Array_multiply, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, add_scalar, _VariantCall::func_PackedFloat64Array_add_scalar, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_scalar, _VariantCall::func_PackedFloat64Array_multiply_scalar, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_PackedFloat64Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_PackedFloat64Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_PackedFloat64Array_dot, sarray("array"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloat64Array_sum, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloat64Array_min, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloat64Array_max, sarray(), varray());
+
 	/* String Array */
 
 	bind_method(PackedStringArray, size, sarray(), varray());
@@ -2245,6 +2348,14 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedVector2Array, add, _VariantCall::func_PackedVector2Array_add, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, multiply, _VariantCall::func_PackedVector2Array_multiply, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, multiply_scalar, _VariantCall::func_PackedVector2Array_multiply_scalar, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, lerp, _VariantCall::func_PackedVector2Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector2Array, transform, _VariantCall::func_PackedVector2Array_transform, sarray("transform"), varray());
+	bind_function(PackedVector2Array, dot, _VariantCall::func_PackedVector2Array_dot, sarray("array"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_PackedVector2Array_sum, sarray(), varray());
+
 	/* Vector3 Array */
 
 	bind_method(PackedVector3Array, size, sarray(), varray());
@@ -2268,6 +2379,14 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 
+	bind_functionnc(PackedVector3Array, add, _VariantCall::func_PackedVector3Array_add, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply, _VariantCall::func_PackedVector3Array_multiply, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply_scalar, _VariantCall::func_PackedVector3Array_multiply_scalar, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_PackedVector3Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
+	bind_function(PackedVector3Array, dot, _VariantCall::func_PackedVector3Array_dot, sarray("array"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVector3Array_sum, sarray(), varray());
+
 	/* Color Array */
 
 	bind_method(PackedColorArray, size, sarray(), varray());
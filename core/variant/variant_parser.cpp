@@ -34,40 +34,62 @@
 #include "core/io/resource_loader.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/string/string_builder.h"
 
-char32_t VariantParser::StreamFile::get_char() {
-	return f->get_8();
+char32_t VariantParser::Stream::_refill() {
+	if (eof) {
+		return 0;
+	}
+
+	if (!readahead_enabled) {
+		char32_t c;
+		if (_read_buffer(&c, 1) != 1) {
+			// You need to try to read again when you have reached the end for EOF to be reported.
+			eof = true;
+			return 0;
+		}
+		return c;
+	}
+
+	readahead_pointer = 0;
+	readahead_filled = _read_buffer(readahead_buffer, READAHEAD_SIZE);
+	if (readahead_filled == 0) {
+		eof = true;
+		return 0;
+	}
+	return readahead_buffer[readahead_pointer++];
 }
 
-bool VariantParser::StreamFile::is_utf8() const {
-	return true;
+uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	ERR_FAIL_COND_V(f.is_null(), 0);
+
+	// Read the bytes into the upper part of the buffer, then widen them in place from the front.
+	uint8_t *bytes = reinterpret_cast<uint8_t *>(p_buffer) + p_num_chars * (sizeof(char32_t) - 1);
+	uint32_t read = f->get_buffer(bytes, p_num_chars);
+	for (uint32_t i = 0; i < read; i++) {
+		p_buffer[i] = bytes[i];
+	}
+	return read;
 }
 
-bool VariantParser::StreamFile::is_eof() const {
-	return f->eof_reached();
+bool VariantParser::StreamFile::is_utf8() const {
+	return true;
 }
 
-char32_t VariantParser::StreamString::get_char() {
-	if (pos > s.length()) {
-		return 0;
-	} else if (pos == s.length()) {
-		// You need to try to read again when you have reached the end for EOF to be reported,
-		// so this works the same as files (like StreamFile does)
-		pos++;
-		return 0;
-	} else {
-		return s[pos++];
+uint32_t VariantParser::StreamString::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	int available = MAX(s.length() - pos, 0);
+	uint32_t read = MIN((uint32_t)available, p_num_chars);
+	if (read > 0) {
+		memcpy(p_buffer, s.ptr() + pos, read * sizeof(char32_t));
+		pos += read;
 	}
+	return read;
 }
 
 bool VariantParser::StreamString::is_utf8() const {
 	return false;
 }
 
-bool VariantParser::StreamString::is_eof() const {
-	return pos > s.length();
-}
-
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 const char *VariantParser::tk_name[TK_MAX] = {
@@ -1953,13 +1975,15 @@ Error VariantWriter::write(const Variant &p_variant, StoreStringFunc p_store_str
 }
 
 static Error _write_to_str(void *ud, const String &p_string) {
-	String *str = (String *)ud;
-	(*str) += p_string;
+	StringBuilder *builder = (StringBuilder *)ud;
+	builder->append(p_string);
 	return OK;
 }
 
 Error VariantWriter::write_to_string(const Variant &p_variant, String &r_string, EncodeResourceFunc p_encode_res_func, void *p_encode_res_ud) {
-	r_string = String();
+	StringBuilder builder;
+	Error err = write(p_variant, _write_to_str, &builder, p_encode_res_func, p_encode_res_ud);
+	r_string = builder.as_string();
 
-	return write(p_variant, _write_to_str, &r_string, p_encode_res_func, p_encode_res_ud);
+	return err;
 }
@@ -38,33 +38,61 @@
 class VariantParser {
 public:
 	struct Stream {
-		virtual char32_t get_char() = 0;
+	private:
+		enum {
+			READAHEAD_SIZE = 4096
+		};
+		char32_t readahead_buffer[READAHEAD_SIZE];
+		uint32_t readahead_pointer = 0;
+		uint32_t readahead_filled = 0;
+		bool eof = false;
+
+	protected:
+		bool readahead_enabled = true;
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
+
+	public:
+		char32_t saved = 0;
+
+		_FORCE_INLINE_ char32_t get_char() {
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill();
+		}
+		char32_t _refill();
+
 		virtual bool is_utf8() const = 0;
-		virtual bool is_eof() const = 0;
+		bool is_eof() const { return eof; }
 
-		char32_t saved = 0;
+		// Disabling read-ahead keeps the underlying source positioned right after the last character read. Must be called before reading anything.
+		void set_readahead_enabled(bool p_enabled) { readahead_enabled = p_enabled; }
 
 		Stream() {}
 		virtual ~Stream() {}
 	};
 
 	struct StreamFile : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) override;
+
+	public:
 		Ref<FileAccess> f;
 
-		virtual char32_t get_char() override;
 		virtual bool is_utf8() const override;
-		virtual bool is_eof() const override;
 
 		StreamFile() {}
 	};
 
 	struct StreamString : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) override;
+
+	public:
 		String s;
 		int pos = 0;
 
-		virtual char32_t get_char() override;
 		virtual bool is_utf8() const override;
-		virtual bool is_eof() const override;
 
 		StreamString() {}
 	};
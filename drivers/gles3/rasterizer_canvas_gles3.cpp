@@ -41,6 +41,7 @@
 #include "storage/material_storage.h"
 #include "storage/mesh_storage.h"
 #include "storage/texture_storage.h"
+#include "storage/utilities.h"
 
 #ifndef GLES_OVER_GL
 #define glClearDepth glClearDepthf
@@ -329,6 +330,8 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 	state.canvas_texscreen_used = false;
 	state.current_shader_version = state.canvas_shader_default_version;
 
+	GLES3::Utilities::get_singleton()->info.render._2d_item_count += p_item_count;
+
 	for (int i = 0; i < p_item_count; i++) {
 		Item *ci = items[i];
 
@@ -468,6 +471,10 @@ void RasterizerCanvasGLES3::_render_item(RID p_render_target, const Item *p_item
 
 	bool reclip = false;
 
+	// Untextured commands draw with the white texture, so they batch with each other.
+	RID white_texture = GLES3::TextureStorage::get_singleton()->texture_gl_get_default(GLES3::DEFAULT_GL_TEXTURE_WHITE);
+	GLES3::Utilities::Info::Render &render_info = GLES3::Utilities::get_singleton()->info.render;
+
 	bool skipping = false;
 
 	const Item::Command *c = p_item->commands;
@@ -505,7 +512,7 @@ void RasterizerCanvasGLES3::_render_item(RID p_render_target, const Item *p_item
 					current_repeat = RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED;
 				}
 
-				if (rect->texture != state.current_tex || state.current_primitive_points != 0 || state.current_command != Item::Command::TYPE_RECT) {
+				if ((rect->texture.is_valid() ? rect->texture : white_texture) != state.current_tex || state.current_primitive_points != 0 || state.current_command != Item::Command::TYPE_RECT) {
 					_render_batch(r_index);
 
 					state.current_primitive_points = 0;
@@ -593,7 +600,7 @@ void RasterizerCanvasGLES3::_render_item(RID p_render_target, const Item *p_item
 			case Item::Command::TYPE_NINEPATCH: {
 				const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
 
-				if (np->texture != state.current_tex || state.current_primitive_points != 0 || state.current_command != Item::Command::TYPE_NINEPATCH) {
+				if ((np->texture.is_valid() ? np->texture : white_texture) != state.current_tex || state.current_primitive_points != 0 || state.current_command != Item::Command::TYPE_NINEPATCH) {
 					_render_batch(r_index);
 
 					state.current_primitive_points = 0;
@@ -698,6 +705,7 @@ void RasterizerCanvasGLES3::_render_item(RID p_render_target, const Item *p_item
 				} else {
 					glDrawArrays(prim[polygon->primitive], 0, pb->count);
 				}
+				render_info._2d_draw_call_count++;
 				glBindVertexArray(0);
 				state.fences[state.current_buffer] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 
@@ -889,6 +897,7 @@ void RasterizerCanvasGLES3::_render_item(RID p_render_target, const Item *p_item
 							glDrawArraysInstanced(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(surface), instance_count);
 						}
 					}
+					render_info._2d_draw_call_count++;
 
 					state.fences[state.current_buffer] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 
@@ -911,6 +920,8 @@ void RasterizerCanvasGLES3::_render_item(RID p_render_target, const Item *p_item
 				const Item::CommandClipIgnore *ci = static_cast<const Item::CommandClipIgnore *>(c);
 				if (current_clip) {
 					if (ci->ignore != reclip) {
+						// Commands already batched must be drawn with the current scissor state.
+						_render_batch(r_index);
 						if (ci->ignore) {
 							glDisable(GL_SCISSOR_TEST);
 							reclip = true;
@@ -953,6 +964,7 @@ void RasterizerCanvasGLES3::_render_batch(uint32_t &r_index) {
 			static const GLenum prim[5] = { GL_POINTS, GL_POINTS, GL_LINES, GL_TRIANGLES, GL_TRIANGLES };
 			glDrawArraysInstanced(prim[state.current_primitive_points], 0, state.current_primitive_points, r_index);
 		}
+		GLES3::Utilities::get_singleton()->info.render._2d_draw_call_count++;
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
 		state.fences[state.current_buffer] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
@@ -1106,6 +1118,7 @@ void RasterizerCanvasGLES3::_bind_canvas_texture(RID p_texture, RS::CanvasItemTe
 			t->canvas_texture->diffuse = p_texture;
 		}
 
+		t->request_stream();
 		ct = t->canvas_texture;
 	} else {
 		ct = texture_storage->get_canvas_texture(p_texture);
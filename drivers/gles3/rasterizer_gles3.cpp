@@ -100,6 +100,8 @@ void RasterizerGLES3::begin_frame(double frame_step) {
 	canvas->set_time(time_total);
 	scene->set_time(time_total, frame_step);
 
+	texture_storage->update_texture_uploads();
+
 	GLES3::Utilities *utilities = GLES3::Utilities::get_singleton();
 	utilities->info.render_final = utilities->info.render;
 	utilities->info.render.reset();
@@ -345,6 +347,7 @@ void RasterizerGLES3::set_boot_image(const Ref<Image> &p_image, const Color &p_c
 
 	RID texture = texture_storage->texture_allocate();
 	texture_storage->texture_2d_initialize(texture, p_image);
+	texture_storage->texture_finish_upload(texture);
 
 	Rect2 imgrect(0, 0, p_image->get_width(), p_image->get_height());
 	Rect2 screenrect;
@@ -2114,6 +2114,45 @@ void RasterizerSceneGLES3::render_scene(RID p_render_buffers, const CameraData *
 	texture_storage->render_target_disable_clear_request(rb->render_target);
 }
 
+bool RasterizerSceneGLES3::_can_auto_instance(const GeometryInstanceSurface *p_surface, const GeometryInstanceSurface *p_next, bool p_shadow_pass, bool p_uses_lights) const {
+	const GeometryInstanceGLES3 *inst = p_surface->owner;
+	const GeometryInstanceGLES3 *next_inst = p_next->owner;
+
+	if (next_inst->instance_count >= 0 || next_inst->mesh_instance.is_valid() || !next_inst->store_transform_cache) {
+		return false; // MultiMesh, skinned or blend shape geometry.
+	}
+
+	if (p_surface->flags != p_next->flags || p_surface->lod_index != p_next->lod_index || inst->mirror != next_inst->mirror) {
+		return false;
+	}
+
+	if (p_shadow_pass) {
+		if (p_surface->surface_shadow != p_next->surface_shadow || p_surface->material_shadow != p_next->material_shadow) {
+			return false;
+		}
+	} else if (p_surface->surface != p_next->surface || p_surface->material != p_next->material) {
+		return false;
+	}
+
+	if (p_uses_lights) {
+		if (inst->omni_light_count != next_inst->omni_light_count || inst->spot_light_count != next_inst->spot_light_count) {
+			return false;
+		}
+		for (uint32_t i = 0; i < inst->omni_light_count; i++) {
+			if (inst->omni_light_gl_cache[i] != next_inst->omni_light_gl_cache[i]) {
+				return false;
+			}
+		}
+		for (uint32_t i = 0; i < inst->spot_light_count; i++) {
+			if (inst->spot_light_gl_cache[i] != next_inst->spot_light_gl_cache[i]) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 template <PassMode p_pass_mode>
 void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass) {
 	GLES3::MeshStorage *mesh_storage = GLES3::MeshStorage::get_singleton();
@@ -2190,6 +2229,15 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			continue;
 		}
 
+		// Consecutive elements drawing the same surface with the same state are drawn as one instanced call.
+		uint32_t auto_instance_count = 1;
+		if (inst->instance_count < 0 && inst->mesh_instance.is_null() && inst->store_transform_cache) {
+			const bool uses_lights = p_pass_mode == PASS_MODE_COLOR || p_pass_mode == PASS_MODE_COLOR_TRANSPARENT || p_pass_mode == PASS_MODE_COLOR_ADDITIVE;
+			while (i + auto_instance_count < p_to_element && auto_instance_count < MAX_AUTO_INSTANCES && _can_auto_instance(surf, p_params->elements[i + auto_instance_count], p_pass_mode == PASS_MODE_SHADOW, uses_lights)) {
+				auto_instance_count++;
+			}
+		}
+
 		if (p_pass_mode == PASS_MODE_COLOR_TRANSPARENT) {
 			if (scene_state.current_depth_test != shader->depth_test) {
 				if (shader->depth_test == GLES3::SceneShaderData::DEPTH_TEST_DISABLED) {
@@ -2324,7 +2372,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		Transform3D world_transform;
-		if (inst->store_transform_cache) {
+		if (inst->store_transform_cache && auto_instance_count == 1) {
 			world_transform = inst->transform;
 		}
 
@@ -2334,7 +2382,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		SceneShaderGLES3::ShaderVariant instance_variant = shader_variant;
-		if (inst->instance_count > 0) {
+		if (inst->instance_count > 0 || auto_instance_count > 1) {
 			instance_variant = SceneShaderGLES3::ShaderVariant(1 + int(shader_variant));
 		}
 
@@ -2397,6 +2445,43 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			} else {
 				glDrawArraysInstanced(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), inst->instance_count);
 			}
+		} else if (auto_instance_count > 1) {
+			// Using regular Meshes merged into one draw, transforms are streamed like MultiMesh ones.
+			for (uint32_t j = 0; j < auto_instance_count; j++) {
+				const Transform3D &xform = p_params->elements[i + j]->owner->transform;
+				float *data = &scene_state.auto_instance_data[j * AUTO_INSTANCE_STRIDE];
+				for (int k = 0; k < 3; k++) {
+					data[k * 4 + 0] = xform.basis.rows[k][0];
+					data[k * 4 + 1] = xform.basis.rows[k][1];
+					data[k * 4 + 2] = xform.basis.rows[k][2];
+					data[k * 4 + 3] = xform.origin[k];
+				}
+			}
+
+			glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+			glBufferData(GL_ARRAY_BUFFER, auto_instance_count * AUTO_INSTANCE_STRIDE * sizeof(float), scene_state.auto_instance_data, GL_STREAM_DRAW);
+			glEnableVertexAttribArray(12);
+			glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, AUTO_INSTANCE_STRIDE * sizeof(float), CAST_INT_TO_UCHAR_PTR(0));
+			glVertexAttribDivisor(12, 1);
+			glEnableVertexAttribArray(13);
+			glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, AUTO_INSTANCE_STRIDE * sizeof(float), CAST_INT_TO_UCHAR_PTR(4 * 4));
+			glVertexAttribDivisor(13, 1);
+			glEnableVertexAttribArray(14);
+			glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, AUTO_INSTANCE_STRIDE * sizeof(float), CAST_INT_TO_UCHAR_PTR(4 * 8));
+			glVertexAttribDivisor(14, 1);
+			// White color and zero custom data, packed as half floats.
+			glVertexAttribI4ui(15, 0x3C003C00, 0x3C003C00, 0, 0);
+
+			if (use_index_buffer) {
+				glDrawElementsInstanced(primitive_gl, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), mesh_storage->mesh_surface_get_index_type(mesh_surface), 0, auto_instance_count);
+			} else {
+				glDrawArraysInstanced(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(mesh_surface), auto_instance_count);
+			}
+
+			glDisableVertexAttribArray(12);
+			glDisableVertexAttribArray(13);
+			glDisableVertexAttribArray(14);
+			i += auto_instance_count - 1;
 		} else {
 			// Using regular Mesh.
 			if (use_index_buffer) {
@@ -2434,7 +2519,7 @@ RID RasterizerSceneGLES3::render_buffers_create() {
 	return render_buffers_owner.make_rid(rb);
 }
 
-void RasterizerSceneGLES3::render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RS::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) {
+void RasterizerSceneGLES3::render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, RS::ViewportScaling3DMode p_scaling_3d_mode, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RS::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) {
 	GLES3::TextureStorage *texture_storage = GLES3::TextureStorage::get_singleton();
 
 	RenderBuffers *rb = render_buffers_owner.get_or_null(p_render_buffers);
@@ -2615,6 +2700,11 @@ RasterizerSceneGLES3::RasterizerSceneGLES3() {
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 	}
 
+	{
+		scene_state.auto_instance_data = memnew_arr(float, MAX_AUTO_INSTANCES * AUTO_INSTANCE_STRIDE);
+		glGenBuffers(1, &scene_state.auto_instance_buffer);
+	}
+
 	{
 		sky_globals.max_directional_lights = 4;
 		uint32_t directional_light_buffer_size = sky_globals.max_directional_lights * sizeof(DirectionalLightData);
@@ -2760,7 +2850,9 @@ RasterizerSceneGLES3::~RasterizerSceneGLES3() {
 	glDeleteBuffers(1, &scene_state.directional_light_buffer);
 	glDeleteBuffers(1, &scene_state.omni_light_buffer);
 	glDeleteBuffers(1, &scene_state.spot_light_buffer);
+	glDeleteBuffers(1, &scene_state.auto_instance_buffer);
 	memdelete_arr(scene_state.directional_lights);
+	memdelete_arr(scene_state.auto_instance_data);
 	memdelete_arr(scene_state.omni_lights);
 	memdelete_arr(scene_state.spot_lights);
 	memdelete_arr(scene_state.omni_light_sort);
@@ -405,6 +405,10 @@ private:
 
 		DirectionalLightData *directional_lights = nullptr;
 		GLuint directional_light_buffer = 0;
+
+		// Transforms of consecutive render list elements drawn as one instanced call.
+		float *auto_instance_data = nullptr;
+		GLuint auto_instance_buffer = 0;
 	} scene_state;
 
 	struct RenderListParameters {
@@ -483,6 +487,13 @@ private:
 	void _setup_environment(const RenderDataGLES3 *p_render_data, bool p_no_fog, const Size2i &p_screen_size, bool p_flip_y, const Color &p_default_bg_color, bool p_pancake_shadows);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataGLES3 *p_render_data, PassMode p_pass_mode, bool p_append = false);
 
+	enum {
+		MAX_AUTO_INSTANCES = 256,
+		AUTO_INSTANCE_STRIDE = 12, // Same layout as 3D MultiMesh transforms.
+	};
+
+	_FORCE_INLINE_ bool _can_auto_instance(const GeometryInstanceSurface *p_surface, const GeometryInstanceSurface *p_next, bool p_shadow_pass, bool p_uses_lights) const;
+
 	template <PassMode p_pass_mode>
 	_FORCE_INLINE_ void _render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass = false);
 
@@ -870,7 +881,7 @@ public:
 	}
 
 	RID render_buffers_create() override;
-	void render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RS::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) override;
+	void render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, RS::ViewportScaling3DMode p_scaling_3d_mode, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RS::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) override;
 	void gi_set_use_half_resolution(bool p_enable) override;
 
 	void screen_space_roughness_limiter_set_active(bool p_enable, float p_amount, float p_curve) override;
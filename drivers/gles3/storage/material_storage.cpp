@@ -1249,6 +1249,7 @@ void MaterialData::update_textures(const HashMap<StringName, Variant> &p_paramet
 
 				if (tex) {
 					gl_texture = textures[j];
+					tex->request_stream();
 #ifdef TOOLS_ENABLED
 					if (tex->detect_3d_callback && p_use_linear_color) {
 						tex->detect_3d_callback(tex->detect_3d_callback_ud);
@@ -240,6 +240,7 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 
 	s->aabb = p_surface.aabb;
 	s->bone_aabbs = p_surface.bone_aabbs; //only really useful for returning them.
+	s->meshlet_data = p_surface.meshlet_data;
 
 	if (mesh->blend_shape_count > 0) {
 		//s->blend_shape_buffer = RD::get_singleton()->storage_buffer_create(p_surface.blend_shape_data.size(), p_surface.blend_shape_data);
@@ -360,6 +361,7 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	}
 
 	sd.bone_aabbs = s.bone_aabbs;
+	sd.meshlet_data = s.meshlet_data;
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 
 	return sd;
@@ -752,6 +754,10 @@ void MeshStorage::mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int
 	mi->weights_dirty = true;
 }
 
+void MeshStorage::mesh_instance_set_skinning_interval(RID p_mesh_instance, uint32_t p_interval) {
+	// Skinning isn't done by this renderer yet, so there is nothing to throttle.
+}
+
 void MeshStorage::_mesh_instance_clear(MeshInstance *mi) {
 	for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
 		if (mi->surfaces[i].version_count != 0) {
@@ -888,6 +894,8 @@ void MeshStorage::multimesh_allocate_data(RID p_multimesh, int p_instances, RS::
 	multimesh->custom_data_offset_cache = multimesh->color_offset_cache + (p_use_colors ? 2 : 0);
 	multimesh->stride_cache = multimesh->custom_data_offset_cache + (p_use_custom_data ? 2 : 0);
 	multimesh->buffer_set = false;
+	multimesh->map_offset = -1;
+	multimesh->map_count = 0;
 
 	multimesh->data_cache = Vector<float>();
 	multimesh->aabb = AABB();
@@ -1354,6 +1362,105 @@ void MeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_b
 	}
 }
 
+void MeshStorage::_multimesh_set_range(MultiMesh *multimesh, int p_offset, int p_count, const float *p_data) {
+	if (p_count == 0) {
+		return;
+	}
+
+	_multimesh_make_local(multimesh);
+
+	// The data uses the RenderingServer layout, so colors and custom data need to be packed into the data cache.
+	uint32_t xform_size = multimesh->color_offset_cache;
+	uint32_t src_stride = xform_size + (multimesh->uses_colors ? 4 : 0) + (multimesh->uses_custom_data ? 4 : 0);
+
+	float *w = multimesh->data_cache.ptrw();
+	for (int i = 0; i < p_count; i++) {
+		const float *dataptr = p_data + i * src_stride;
+		float *newptr = w + (p_offset + i) * multimesh->stride_cache;
+		memcpy(newptr, dataptr, xform_size * sizeof(float));
+		dataptr += xform_size;
+
+		if (multimesh->uses_colors) {
+			uint16_t val[4] = { Math::make_half_float(dataptr[0]), Math::make_half_float(dataptr[1]), Math::make_half_float(dataptr[2]), Math::make_half_float(dataptr[3]) };
+			memcpy(newptr + multimesh->color_offset_cache, val, 2 * 4);
+			dataptr += 4;
+		}
+		if (multimesh->uses_custom_data) {
+			uint16_t val[4] = { Math::make_half_float(dataptr[0]), Math::make_half_float(dataptr[1]), Math::make_half_float(dataptr[2]), Math::make_half_float(dataptr[3]) };
+			memcpy(newptr + multimesh->custom_data_offset_cache, val, 2 * 4);
+		}
+	}
+
+	// Only the regions the range touches are uploaded on the next update.
+	int last_region = (p_offset + p_count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+	for (int i = p_offset / MULTIMESH_DIRTY_REGION_SIZE; i <= last_region; i++) {
+		_multimesh_mark_dirty(multimesh, i * MULTIMESH_DIRTY_REGION_SIZE, true);
+	}
+}
+
+void MeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND(p_offset < 0 || p_count < 0 || p_offset + p_count > multimesh->instances);
+	int src_stride = multimesh->color_offset_cache + (multimesh->uses_colors ? 4 : 0) + (multimesh->uses_custom_data ? 4 : 0);
+	ERR_FAIL_COND(p_buffer.size() != p_count * src_stride);
+
+	_multimesh_set_range(multimesh, p_offset, p_count, p_buffer.ptr());
+}
+
+float *MeshStorage::multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND_V(!multimesh, nullptr);
+	ERR_FAIL_COND_V(p_offset < 0 || p_count <= 0 || p_offset + p_count > multimesh->instances, nullptr);
+	ERR_FAIL_COND_V_MSG(multimesh->map_offset >= 0, nullptr, "A range of this MultiMesh buffer is already mapped.");
+
+	_multimesh_make_local(multimesh);
+
+	// Hand out the range in the RenderingServer layout, unpacking colors and custom data.
+	uint32_t xform_size = multimesh->color_offset_cache;
+	uint32_t dst_stride = xform_size + (multimesh->uses_colors ? 4 : 0) + (multimesh->uses_custom_data ? 4 : 0);
+	multimesh->map_buffer.resize(p_count * dst_stride);
+
+	const float *r = multimesh->data_cache.ptr();
+	for (int i = 0; i < p_count; i++) {
+		const float *oldptr = r + (p_offset + i) * multimesh->stride_cache;
+		float *newptr = multimesh->map_buffer.ptr() + i * dst_stride;
+		memcpy(newptr, oldptr, xform_size * sizeof(float));
+		newptr += xform_size;
+
+		if (multimesh->uses_colors) {
+			uint16_t raw_data[4];
+			memcpy(raw_data, oldptr + multimesh->color_offset_cache, 2 * 4);
+			for (int j = 0; j < 4; j++) {
+				newptr[j] = Math::half_to_float(raw_data[j]);
+			}
+			newptr += 4;
+		}
+		if (multimesh->uses_custom_data) {
+			uint16_t raw_data[4];
+			memcpy(raw_data, oldptr + multimesh->custom_data_offset_cache, 2 * 4);
+			for (int j = 0; j < 4; j++) {
+				newptr[j] = Math::half_to_float(raw_data[j]);
+			}
+		}
+	}
+
+	multimesh->map_offset = p_offset;
+	multimesh->map_count = p_count;
+
+	return multimesh->map_buffer.ptr();
+}
+
+void MeshStorage::multimesh_unmap_buffer(RID p_multimesh) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND_MSG(multimesh->map_offset < 0, "No range of this MultiMesh buffer is mapped.");
+
+	_multimesh_set_range(multimesh, multimesh->map_offset, multimesh->map_count, multimesh->map_buffer.ptr());
+	multimesh->map_offset = -1;
+	multimesh->map_count = 0;
+}
+
 Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_COND_V(!multimesh, Vector<float>());
@@ -1526,6 +1633,9 @@ void MeshStorage::skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_
 void MeshStorage::skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) {
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+}
+
 int MeshStorage::skeleton_get_bone_count(RID p_skeleton) const {
 	return 0;
 }
@@ -102,6 +102,8 @@ struct Mesh {
 
 		Vector<AABB> bone_aabbs;
 
+		Vector<uint8_t> meshlet_data; // Only useful for returning it, meshlets are not culled in this renderer.
+
 		GLuint blend_shape_buffer = 0;
 
 		RID material;
@@ -175,6 +177,11 @@ struct MultiMesh {
 	bool *data_cache_dirty_regions = nullptr;
 	uint32_t data_cache_used_dirty_regions = 0;
 
+	// Range handed out by multimesh_map_buffer_range(), copied to the data cache when unmapped.
+	LocalVector<float> map_buffer;
+	int map_offset = -1; // -1 when not mapped.
+	int map_count = 0;
+
 	GLuint buffer;
 
 	bool dirty = false;
@@ -227,6 +234,7 @@ private:
 	_FORCE_INLINE_ void _multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_re_create_aabb(MultiMesh *multimesh, const float *p_data, int p_instances);
+	void _multimesh_set_range(MultiMesh *multimesh, int p_offset, int p_count, const float *p_data);
 
 	/* Skeleton */
 
@@ -403,6 +411,7 @@ public:
 	virtual void mesh_instance_free(RID p_rid) override;
 	virtual void mesh_instance_set_skeleton(RID p_mesh_instance, RID p_skeleton) override;
 	virtual void mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int p_shape, float p_weight) override;
+	virtual void mesh_instance_set_skinning_interval(RID p_mesh_instance, uint32_t p_interval) override;
 	virtual void mesh_instance_check_for_update(RID p_mesh_instance) override;
 	virtual void update_mesh_instances() override;
 
@@ -465,8 +474,12 @@ public:
 	virtual Color multimesh_instance_get_color(RID p_multimesh, int p_index) const override;
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const override;
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) override;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) override;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const override;
 
+	virtual float *multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) override;
+	virtual void multimesh_unmap_buffer(RID p_multimesh) override;
+
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const override;
 
@@ -526,6 +539,7 @@ public:
 
 	virtual void skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) override;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) override;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) override;
 	virtual int skeleton_get_bone_count(RID p_skeleton) const override;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) override;
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const override;
@@ -180,6 +180,9 @@ void ParticlesStorage::particles_set_canvas_sdf_collision(RID p_particles, bool
 void ParticlesStorage::update_particles() {
 }
 
+void ParticlesStorage::update_particles_view_axis() {
+}
+
 bool ParticlesStorage::particles_is_inactive(RID p_particles) const {
 	return false;
 }
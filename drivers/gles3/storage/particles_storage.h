@@ -105,6 +105,7 @@ public:
 	virtual void particles_set_canvas_sdf_collision(RID p_particles, bool p_enable, const Transform2D &p_xform, const Rect2 &p_to_screen, RID p_texture) override;
 
 	virtual void update_particles() override;
+	virtual void update_particles_view_axis() override;
 	virtual bool particles_is_inactive(RID p_particles) const override;
 
 	/* PARTICLES COLLISION */
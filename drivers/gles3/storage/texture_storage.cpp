@@ -32,6 +32,7 @@
 
 #include "texture_storage.h"
 #include "config.h"
+#include "core/config/project_settings.h"
 #include "drivers/gles3/effects/copy_effects.h"
 
 using namespace GLES3;
@@ -56,6 +57,8 @@ TextureStorage::TextureStorage() {
 
 	system_fbo = 0;
 
+	texture_upload_budget = uint32_t(MAX(0, int(GLOBAL_GET("rendering/limits/opengl/texture_upload_budget_kb")))) * 1024;
+
 	{ //create default textures
 		{ // White Textures
 
@@ -635,6 +638,11 @@ void TextureStorage::texture_free(RID p_texture) {
 		t->tex_id = 0;
 	}
 
+	int upload_index = _find_texture_upload(p_texture);
+	if (upload_index >= 0) {
+		texture_uploads.remove_at(upload_index);
+	}
+
 	if (t->is_proxy && t->proxy_to.is_valid()) {
 		Texture *proxy_to = texture_owner.get_or_null(t->proxy_to);
 		if (proxy_to) {
@@ -669,7 +677,7 @@ void TextureStorage::texture_2d_initialize(RID p_texture, const Ref<Image> &p_im
 	texture.active = true;
 	glGenTextures(1, &texture.tex_id);
 	texture_owner.initialize_rid(p_texture, texture);
-	texture_set_data(p_texture, p_image);
+	_texture_set_data(p_texture, p_image, 0, true);
 }
 
 void TextureStorage::texture_2d_layered_initialize(RID p_texture, const Vector<Ref<Image>> &p_layers, RS::TextureLayeredType p_layered_type) {
@@ -767,6 +775,16 @@ Ref<Image> TextureStorage::texture_2d_get(RID p_texture) const {
 	}
 #endif
 
+	int upload_index = _find_texture_upload(p_texture);
+	if (upload_index >= 0) {
+		// Not fully uploaded yet, but the image is still around.
+		Ref<Image> image = texture_uploads[upload_index].image->duplicate();
+		if (texture->format != texture->real_format) {
+			image->convert(texture->format);
+		}
+		return image;
+	}
+
 #ifdef GLES_OVER_GL
 	// OpenGL 3.3 supports glGetTexImage which is faster and simpler than glReadPixels.
 	Vector<uint8_t> data;
@@ -842,6 +860,16 @@ void TextureStorage::texture_replace(RID p_texture, RID p_by_texture) {
 		tex_to->tex_id = 0;
 	}
 
+	int upload_index = _find_texture_upload(p_texture);
+	if (upload_index >= 0) {
+		texture_uploads.remove_at(upload_index);
+	}
+	// The GL texture of p_by_texture is now the one of p_texture, so are its pending rows.
+	upload_index = _find_texture_upload(p_by_texture);
+	if (upload_index >= 0) {
+		texture_uploads[upload_index].texture = p_texture;
+	}
+
 	Vector<RID> proxies_to_update = tex_to->proxies;
 	Vector<RID> proxies_to_redirect = tex_from->proxies;
 
@@ -919,6 +947,14 @@ void TextureStorage::texture_set_detect_roughness_callback(RID p_texture, RS::Te
 	texture->detect_roughness_callback_ud = p_userdata;
 }
 
+void TextureStorage::texture_set_stream_request_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) {
+	Texture *texture = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_COND(!texture);
+
+	texture->stream_request_callback = p_callback;
+	texture->stream_request_callback_ud = p_userdata;
+}
+
 void TextureStorage::texture_debug_usage(List<RS::TextureInfo> *r_info) {
 	List<RID> textures;
 	texture_owner.get_owned_list(&textures);
@@ -958,6 +994,16 @@ Size2 TextureStorage::texture_size_with_proxy(RID p_texture) {
 }
 
 void TextureStorage::texture_set_data(RID p_texture, const Ref<Image> &p_image, int p_layer) {
+	// New data replaces whatever was still waiting to be uploaded.
+	int upload_index = _find_texture_upload(p_texture);
+	if (upload_index >= 0) {
+		texture_uploads.remove_at(upload_index);
+	}
+
+	_texture_set_data(p_texture, p_image, p_layer, false);
+}
+
+void TextureStorage::_texture_set_data(RID p_texture, const Ref<Image> &p_image, int p_layer, bool p_initialize) {
 	Texture *texture = texture_owner.get_or_null(p_texture);
 
 	ERR_FAIL_COND(!texture);
@@ -1040,6 +1086,38 @@ void TextureStorage::texture_set_data(RID p_texture, const Ref<Image> &p_image,
 
 	int tsize = 0;
 
+	if (p_initialize && texture_upload_budget > 0 && !compressed && blit_target == GL_TEXTURE_2D && uint32_t(read.size()) > texture_upload_budget) {
+		// Allocate all the mipmaps now, and queue their contents.
+		for (int i = 0; i < mipmaps; i++) {
+			glTexImage2D(blit_target, i, internal_format, w, h, 0, format, type, nullptr);
+			w = MAX(1, w >> 1);
+			h = MAX(1, h >> 1);
+		}
+
+		texture->total_data_size = read.size();
+		texture->stored_cube_sides |= (1 << p_layer);
+		texture->mipmaps = mipmaps;
+
+		TextureUpload upload;
+		upload.texture = p_texture;
+		upload.image = img;
+		upload.data = read;
+		upload.format = format;
+		upload.type = type;
+		upload.mipmap = mipmaps - 1;
+
+		// Nothing can be sampled until the smallest mipmap is there, so upload it (and the other small ones) right away.
+		uint32_t budget = MIN(texture_upload_budget, 65536u);
+		if (!_texture_upload_step(upload, budget)) {
+			texture_uploads.push_back(upload);
+		}
+		return;
+	}
+
+	if (texture->base_mipmap != 0) {
+		_texture_set_base_mipmap(texture, 0);
+	}
+
 	for (int i = 0; i < mipmaps; i++) {
 		int size, ofs;
 		img->get_mipmap_offset_and_size(i, ofs, size);
@@ -1073,6 +1151,88 @@ void TextureStorage::texture_set_data(RID p_texture, const Ref<Image> &p_image,
 	texture->mipmaps = mipmaps;
 }
 
+int TextureStorage::_find_texture_upload(RID p_texture) const {
+	for (uint32_t i = 0; i < texture_uploads.size(); i++) {
+		if (texture_uploads[i].texture == p_texture) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+void TextureStorage::_texture_set_base_mipmap(Texture *p_texture, int p_mipmap) {
+	// Expects the texture to be bound.
+	p_texture->base_mipmap = p_mipmap;
+	glTexParameteri(p_texture->target, GL_TEXTURE_BASE_LEVEL, p_mipmap);
+
+	for (int i = 0; i < p_texture->proxies.size(); i++) {
+		Texture *proxy = texture_owner.get_or_null(p_texture->proxies[i]);
+		if (proxy) {
+			proxy->base_mipmap = p_mipmap;
+		}
+	}
+}
+
+bool TextureStorage::_texture_upload_step(TextureUpload &p_upload, uint32_t &r_budget) {
+	Texture *texture = texture_owner.get_or_null(p_upload.texture);
+	ERR_FAIL_COND_V(!texture, true);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture->tex_id);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	const uint8_t *read = p_upload.data.ptr();
+	int pixel_size = Image::get_format_pixel_size(p_upload.image->get_format());
+
+	while (p_upload.mipmap >= 0 && r_budget > 0) {
+		int ofs, size, w, h;
+		p_upload.image->get_mipmap_offset_size_and_dimensions(p_upload.mipmap, ofs, size, w, h);
+
+		// At least one row, so rows larger than the budget are still uploaded.
+		uint32_t row_size = w * pixel_size;
+		int rows = CLAMP(int(r_budget / row_size), 1, h - p_upload.row);
+
+		glTexSubImage2D(GL_TEXTURE_2D, p_upload.mipmap, 0, p_upload.row, w, rows, p_upload.format, p_upload.type, &read[ofs + p_upload.row * row_size]);
+
+		p_upload.row += rows;
+		r_budget -= MIN(r_budget, rows * row_size);
+
+		if (p_upload.row < h) {
+			break;
+		}
+
+		// This mipmap is complete, sample up to it from now on.
+		_texture_set_base_mipmap(texture, p_upload.mipmap);
+		p_upload.mipmap--;
+		p_upload.row = 0;
+	}
+
+	return p_upload.mipmap < 0;
+}
+
+void TextureStorage::update_texture_uploads() {
+	uint32_t budget = texture_upload_budget;
+
+	// Textures are completed in the order they were created.
+	while (texture_uploads.size() && budget > 0) {
+		if (!_texture_upload_step(texture_uploads[0], budget)) {
+			break;
+		}
+		texture_uploads.remove_at(0);
+	}
+}
+
+void TextureStorage::texture_finish_upload(RID p_texture) {
+	int upload_index = _find_texture_upload(p_texture);
+	if (upload_index < 0) {
+		return;
+	}
+
+	uint32_t budget = UINT32_MAX;
+	_texture_upload_step(texture_uploads[upload_index], budget);
+	texture_uploads.remove_at(upload_index);
+}
+
 void TextureStorage::texture_set_data_partial(RID p_texture, const Ref<Image> &p_image, int src_x, int src_y, int src_w, int src_h, int dst_x, int dst_y, int p_dst_mip, int p_layer) {
 	ERR_PRINT("Not implemented yet, sorry :(");
 }
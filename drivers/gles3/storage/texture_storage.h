@@ -35,6 +35,7 @@
 
 #include "config.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/storage/texture_storage.h"
@@ -187,6 +188,7 @@ struct Texture {
 
 	bool active = false;
 	GLuint tex_id = 0;
+	int base_mipmap = 0; // Largest mipmap that can be sampled, above 0 while the texture is uploaded over several frames.
 
 	uint16_t stored_cube_sides = 0;
 
@@ -205,6 +207,9 @@ struct Texture {
 	RS::TextureDetectRoughnessCallback detect_roughness_callback = nullptr;
 	void *detect_roughness_callback_ud = nullptr;
 
+	RS::TextureDetectCallback stream_request_callback = nullptr;
+	void *stream_request_callback_ud = nullptr;
+
 	CanvasTexture *canvas_texture = nullptr;
 
 	void copy_from(const Texture &o) {
@@ -224,6 +229,7 @@ struct Texture {
 		resize_to_po2 = o.resize_to_po2;
 		active = o.active;
 		tex_id = o.tex_id;
+		base_mipmap = o.base_mipmap;
 		stored_cube_sides = o.stored_cube_sides;
 		render_target = o.render_target;
 		is_render_target = o.is_render_target;
@@ -234,6 +240,16 @@ struct Texture {
 		detect_normal_callback_ud = o.detect_normal_callback_ud;
 		detect_roughness_callback = o.detect_roughness_callback;
 		detect_roughness_callback_ud = o.detect_roughness_callback_ud;
+		stream_request_callback = o.stream_request_callback;
+		stream_request_callback_ud = o.stream_request_callback_ud;
+	}
+
+	_FORCE_INLINE_ void request_stream() {
+		if (stream_request_callback) {
+			RS::TextureDetectCallback callback = stream_request_callback;
+			stream_request_callback = nullptr; // Only request once.
+			callback(stream_request_callback_ud);
+		}
 	}
 
 	// texture state
@@ -293,7 +309,7 @@ struct Texture {
 		}
 		glTexParameteri(target, GL_TEXTURE_MIN_FILTER, pmin);
 		glTexParameteri(target, GL_TEXTURE_MAG_FILTER, pmag);
-		glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, base_mipmap);
 		glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, max_lod);
 		if (config->support_anisotropic_filter && use_anisotropy) {
 			glTexParameterf(target, _GL_TEXTURE_MAX_ANISOTROPY_EXT, config->anisotropic_level);
@@ -384,6 +400,28 @@ private:
 	mutable RID_Owner<Texture> texture_owner;
 
 	Ref<Image> _get_gl_image_and_format(const Ref<Image> &p_image, Image::Format p_format, Image::Format &r_real_format, GLenum &r_gl_format, GLenum &r_gl_internal_format, GLenum &r_gl_type, bool &r_compressed, bool p_force_decompress) const;
+	void _texture_set_data(RID p_texture, const Ref<Image> &p_image, int p_layer, bool p_initialize);
+
+	/* Texture upload queue */
+
+	// Large uncompressed textures are uploaded a few rows at a time, from the smallest mipmap to the largest,
+	// so creating them doesn't stall the frame. The uploaded mipmaps are sampled in the meantime.
+	struct TextureUpload {
+		RID texture;
+		Ref<Image> image; // Already converted to the GL format.
+		Vector<uint8_t> data;
+		GLenum format = 0;
+		GLenum type = 0;
+		int mipmap = 0; // Mipmap being uploaded.
+		int row = 0; // Next row of that mipmap.
+	};
+
+	LocalVector<TextureUpload> texture_uploads;
+	uint32_t texture_upload_budget = 0; // Bytes per frame, 0 to upload right away.
+
+	int _find_texture_upload(RID p_texture) const;
+	void _texture_set_base_mipmap(Texture *p_texture, int p_mipmap);
+	bool _texture_upload_step(TextureUpload &p_upload, uint32_t &r_budget);
 
 	/* Render Target API */
 
@@ -403,6 +441,11 @@ public:
 		return default_gl_textures[p_texture];
 	}
 
+	// Uploads the next rows of the queued textures, up to the per frame budget.
+	void update_texture_uploads();
+	// Uploads the rest of a queued texture right away, for textures that are drawn before the next frame.
+	void texture_finish_upload(RID p_texture);
+
 	/* Canvas Texture API */
 
 	CanvasTexture *get_canvas_texture(RID p_rid) { return canvas_texture_owner.get_or_null(p_rid); };
@@ -468,6 +511,7 @@ public:
 	void texture_set_detect_srgb_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata);
 	virtual void texture_set_detect_normal_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override;
+	virtual void texture_set_stream_request_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override;
 
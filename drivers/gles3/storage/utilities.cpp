@@ -331,6 +331,12 @@ void Utilities::update_memory_info() {
 }
 
 uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
+	// Only 2D rendering is reported here, 3D rendering is counted by the viewports.
+	if (p_info == RS::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME) {
+		return info.render_final._2d_item_count;
+	} else if (p_info == RS::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME) {
+		return info.render_final._2d_draw_call_count;
+	}
 	return 0;
 }
 
@@ -41,6 +41,7 @@
 #include <errno.h>
 
 #if defined(UNIX_ENABLED)
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -150,6 +151,14 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+#if defined(UNIX_ENABLED)
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+#endif
+
 	fclose(f);
 	f = nullptr;
 
@@ -245,6 +254,61 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+uint64_t FileAccessUnix::get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+	ERR_FAIL_COND_V_MSG(!f, -1, "File must be opened before use.");
+
+#if defined(UNIX_ENABLED)
+	if (flags == READ) {
+		// Nothing can be pending in the stream buffer, so read the descriptor directly.
+		int fd = fileno(f);
+		uint64_t read = 0;
+		while (read < p_length) {
+			ssize_t r = pread(fd, p_dst + read, p_length - read, p_offset + read);
+			if (r < 0 && errno == EINTR) {
+				continue;
+			}
+			if (r <= 0) {
+				break;
+			}
+			read += r;
+		}
+		return read;
+	}
+#endif
+
+	return FileAccess::get_buffer_at(p_offset, p_dst, p_length);
+}
+
+const uint8_t *FileAccessUnix::map_contents(uint64_t &r_length) {
+	ERR_FAIL_COND_V_MSG(!f, nullptr, "File must be opened before use.");
+
+#if defined(UNIX_ENABLED)
+	if (!mapped_data) {
+		if (flags != READ) {
+			return nullptr;
+		}
+
+		uint64_t length = get_length();
+		if (length == 0 || length > SIZE_MAX) {
+			return nullptr;
+		}
+
+		void *data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+		if (data == MAP_FAILED) {
+			return nullptr;
+		}
+		mapped_data = (uint8_t *)data;
+		mapped_length = length;
+	}
+
+	r_length = mapped_length;
+	return mapped_data;
+#else
+	return nullptr;
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
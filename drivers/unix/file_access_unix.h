@@ -49,6 +49,9 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
+
 	void _close();
 
 public:
@@ -69,6 +72,8 @@ public:
 
 	virtual uint8_t get_8() const; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const;
+	virtual const uint8_t *map_contents(uint64_t &r_length);
+	virtual uint64_t get_buffer_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const;
 
 	virtual Error get_error() const; ///< get last error
 
@@ -41,6 +41,7 @@
 #include <string.h>
 #include <sys/ioctl.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #ifndef NO_FCNTL
 #include <fcntl.h>
@@ -620,6 +621,56 @@ Error NetSocketPosix::send(const uint8_t *p_buffer, int p_len, int &r_sent) {
 	return OK;
 }
 
+Error NetSocketPosix::sendv(const uint8_t *const *p_buffers, const int *p_lens, int p_count, int &r_sent) {
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_count <= 0 || p_count > MAX_SEND_BUFFERS, ERR_INVALID_PARAMETER);
+
+#if defined(WINDOWS_ENABLED)
+	WSABUF buffers[MAX_SEND_BUFFERS];
+	for (int i = 0; i < p_count; i++) {
+		buffers[i].buf = (char *)p_buffers[i];
+		buffers[i].len = p_lens[i];
+	}
+
+	DWORD sent = 0;
+	if (::WSASend(_sock, buffers, p_count, &sent, 0, nullptr, nullptr) == SOCKET_ERROR) {
+		r_sent = -1;
+	} else {
+		r_sent = sent;
+	}
+#else
+	struct iovec buffers[MAX_SEND_BUFFERS];
+	for (int i = 0; i < p_count; i++) {
+		buffers[i].iov_base = (void *)p_buffers[i];
+		buffers[i].iov_len = p_lens[i];
+	}
+
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = buffers;
+	msg.msg_iovlen = p_count;
+
+	int flags = 0;
+#ifdef MSG_NOSIGNAL
+	if (_is_stream) {
+		flags = MSG_NOSIGNAL;
+	}
+#endif
+	r_sent = ::sendmsg(_sock, &msg, flags);
+#endif
+
+	if (r_sent < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK) {
+			return ERR_BUSY;
+		}
+
+		return FAILED;
+	}
+
+	return OK;
+}
+
 Error NetSocketPosix::sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 
@@ -84,6 +84,7 @@ public:
 	virtual Error recv(uint8_t *p_buffer, int p_len, int &r_read);
 	virtual Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port, bool p_peek = false);
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent);
+	virtual Error sendv(const uint8_t *const *p_buffers, const int *p_lens, int p_count, int &r_sent);
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port);
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port);
 
@@ -80,6 +80,12 @@
 #include <fcntl.h>
 #endif
 
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <cxxabi.h>
+#include <execinfo.h>
+#define UNIX_BACKTRACE
+#endif
+
 /// Clock Setup function (used by get_ticks_usec)
 static uint64_t _clock_start = 0;
 #if defined(__APPLE__)
@@ -108,6 +114,32 @@ void OS_Unix::debug_break() {
 	assert(false);
 }
 
+int OS_Unix::get_stack_trace(void **r_frames, int p_max_frames) const {
+#ifdef UNIX_BACKTRACE
+	return backtrace(r_frames, p_max_frames);
+#else
+	return 0;
+#endif
+}
+
+String OS_Unix::get_stack_frame_name(void *p_frame) const {
+	Dl_info info;
+	if (!dladdr(p_frame, &info) || !info.dli_sname) {
+		return OS::get_stack_frame_name(p_frame);
+	}
+
+	String name = info.dli_sname;
+#ifdef UNIX_BACKTRACE
+	int status = 0;
+	char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+	if (status == 0 && demangled) {
+		name = String::utf8(demangled);
+	}
+	free(demangled);
+#endif
+	return name + " + " + itos((uint8_t *)p_frame - (uint8_t *)info.dli_saddr);
+}
+
 static void handle_interrupt(int sig) {
 	if (!EngineDebugger::is_active()) {
 		return;
@@ -86,6 +86,8 @@ public:
 	virtual int get_processor_count() const override;
 
 	virtual void debug_break() override;
+	virtual int get_stack_trace(void **r_frames, int p_max_frames) const override;
+	virtual String get_stack_frame_name(void *p_frame) const override;
 	virtual void initialize_debugging() override;
 
 	virtual String get_executable_path() const override;
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/compression.h"
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
@@ -1381,7 +1382,7 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	bufferInfo.pQueueFamilyIndices = nullptr;
 
 	VmaAllocationCreateInfo allocInfo;
-	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 	allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
 	allocInfo.requiredFlags = 0;
 	allocInfo.preferredFlags = 0;
@@ -1390,10 +1391,12 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	allocInfo.pUserData = nullptr;
 
 	StagingBufferBlock block;
+	VmaAllocationInfo alloc_info;
 
-	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, nullptr);
+	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, &alloc_info);
 	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vmaCreateBuffer failed with error " + itos(err) + ".");
 
+	block.data = (uint8_t *)alloc_info.pMappedData;
 	block.frame_used = 0;
 	block.fill_amount = 0;
 
@@ -1548,19 +1551,9 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 			return err;
 		}
 
-		//map staging buffer (It's CPU and coherent)
+		//copy to staging buffer (It's CPU, coherent and always mapped)
+		memcpy(staging_buffer_blocks[staging_buffer_current].data + block_write_offset, p_data + submit_from, block_write_amount);
 
-		void *data_ptr = nullptr;
-		{
-			VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-			ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-		}
-
-		//copy to staging buffer
-		memcpy(((uint8_t *)data_ptr) + block_write_offset, p_data + submit_from, block_write_amount);
-
-		//unmap
-		vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
 		//insert a command to copy this
 
 		VkBufferCopy region;
@@ -1579,6 +1572,53 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 	return OK;
 }
 
+void RenderingDeviceVulkan::_flush_pending_uploads() {
+	if (pending_uploads.is_empty()) {
+		return;
+	}
+
+	VkCommandBuffer command_buffer = frames[frame].draw_command_buffer;
+
+	uint32_t i = 0;
+	while (i < pending_uploads.size()) {
+		const PendingUpload &first = pending_uploads[i];
+		pending_upload_regions.clear();
+		pending_upload_regions.push_back(first.region);
+		i++;
+
+		// Consecutive uploads between the same buffers go into the same copy command, as long as their
+		// destinations are in ascending order (so they can't overlap), and are merged when contiguous.
+		while (i < pending_uploads.size() && pending_uploads[i].src_buffer == first.src_buffer && pending_uploads[i].dst_buffer == first.dst_buffer) {
+			VkBufferCopy &last = pending_upload_regions[pending_upload_regions.size() - 1];
+			const VkBufferCopy &region = pending_uploads[i].region;
+			if (region.dstOffset < last.dstOffset + last.size) {
+				break;
+			}
+			if (region.srcOffset == last.srcOffset + last.size && region.dstOffset == last.dstOffset + last.size) {
+				last.size += region.size;
+			} else {
+				pending_upload_regions.push_back(region);
+			}
+			i++;
+		}
+
+		vkCmdCopyBuffer(command_buffer, first.src_buffer, first.dst_buffer, pending_upload_regions.size(), pending_upload_regions.ptr());
+	}
+
+	pending_uploads.clear();
+
+#ifdef FORCE_FULL_BARRIER
+	_full_barrier(true);
+#else
+	if (pending_uploads_dst_stage_mask != 0) {
+		_memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT, pending_uploads_dst_stage_mask, VK_ACCESS_TRANSFER_WRITE_BIT, pending_uploads_dst_access, true);
+	}
+#endif
+
+	pending_uploads_dst_stage_mask = 0;
+	pending_uploads_dst_access = 0;
+}
+
 void RenderingDeviceVulkan::_memory_barrier(VkPipelineStageFlags p_src_stage_mask, VkPipelineStageFlags p_dst_stage_mask, VkAccessFlags p_src_access, VkAccessFlags p_dst_sccess, bool p_sync_with_draw) {
 	VkMemoryBarrier mem_barrier;
 	mem_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
@@ -2502,15 +2542,7 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 					Error err = _staging_buffer_allocate(to_allocate, required_align, alloc_offset, alloc_size, false);
 					ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
-					uint8_t *write_ptr;
-
-					{ //map
-						void *data_ptr = nullptr;
-						VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-						ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-						write_ptr = (uint8_t *)data_ptr;
-						write_ptr += alloc_offset;
-					}
+					uint8_t *write_ptr = staging_buffer_blocks[staging_buffer_current].data + alloc_offset;
 
 					uint32_t block_w, block_h;
 					get_compressed_image_format_block_dimensions(texture->format, block_w, block_h);
@@ -2537,10 +2569,6 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 						_copy_region(read_ptr, write_ptr, x, y, region_w, region_h, width, pixel_size);
 					}
 
-					{ //unmap
-						vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
-					}
-
 					VkBufferImageCopy buffer_image_copy;
 					buffer_image_copy.bufferOffset = alloc_offset;
 					buffer_image_copy.bufferRowLength = 0; //tightly packed
@@ -6231,6 +6259,8 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 	ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
 			"Updating buffers is forbidden during creation of a compute list");
 
+	_flush_pending_uploads();
+
 	VkPipelineStageFlags dst_stage_mask = 0;
 	VkAccessFlags dst_access = 0;
 	if (p_post_barrier & BARRIER_MASK_TRANSFER) {
@@ -6269,6 +6299,73 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 	return err;
 }
 
+uint8_t *RenderingDeviceVulkan::buffer_get_upload_pointer(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(draw_list, nullptr,
+			"Updating buffers is forbidden during creation of a draw list");
+	ERR_FAIL_COND_V_MSG(compute_list, nullptr,
+			"Updating buffers is forbidden during creation of a compute list");
+	ERR_FAIL_COND_V(p_size == 0, nullptr);
+
+	if (p_size > staging_buffer_block_size) {
+		// Does not fit in a single staging block, the caller is expected to use buffer_update() instead.
+		return nullptr;
+	}
+
+	VkPipelineStageFlags dst_stage_mask = 0;
+	VkAccessFlags dst_access = 0;
+	if (p_post_barrier & BARRIER_MASK_TRANSFER) {
+		// Protect subsequent updates...
+		dst_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		dst_access = VK_ACCESS_TRANSFER_WRITE_BIT;
+	}
+	Buffer *buffer = _get_buffer_from_owner(p_buffer, dst_stage_mask, dst_access, p_post_barrier);
+	if (!buffer) {
+		ERR_FAIL_V_MSG(nullptr, "Buffer argument is not a valid buffer of any type.");
+	}
+
+	ERR_FAIL_COND_V_MSG(p_offset + p_size > buffer->size, nullptr,
+			"Attempted to write buffer (" + itos((p_offset + p_size) - buffer->size) + " bytes) past the end.");
+
+	// If there is no room left and this frame has to be flushed, the pending uploads are recorded first,
+	// which is fine as their memory has been written to already.
+	uint32_t block_write_offset;
+	uint32_t block_write_amount;
+	Error err = _staging_buffer_allocate(p_size, 32, block_write_offset, block_write_amount, false);
+	ERR_FAIL_COND_V(err, nullptr);
+
+	StagingBufferBlock &block = staging_buffer_blocks.write[staging_buffer_current];
+	block.fill_amount = block_write_offset + block_write_amount;
+
+	PendingUpload upload;
+	upload.src_buffer = block.buffer;
+	upload.dst_buffer = buffer->buffer;
+	upload.region.srcOffset = block_write_offset;
+	upload.region.dstOffset = p_offset;
+	upload.region.size = p_size;
+	pending_uploads.push_back(upload);
+
+	if (p_post_barrier != RD::BARRIER_MASK_NO_BARRIER) {
+		if (dst_stage_mask == 0) {
+			dst_stage_mask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+		}
+		pending_uploads_dst_stage_mask |= dst_stage_mask;
+		pending_uploads_dst_access |= dst_access;
+	}
+
+	return block.data + block_write_offset;
+}
+
+void RenderingDeviceVulkan::buffer_flush_uploads() {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_MSG(draw_list, "Updating buffers is forbidden during creation of a draw list");
+	ERR_FAIL_COND_MSG(compute_list, "Updating buffers is forbidden during creation of a compute list");
+
+	_flush_pending_uploads();
+}
+
 Error RenderingDeviceVulkan::buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
@@ -6279,6 +6376,8 @@ Error RenderingDeviceVulkan::buffer_clear(RID p_buffer, uint32_t p_offset, uint3
 	ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
 			"Updating buffers is forbidden during creation of a compute list");
 
+	_flush_pending_uploads();
+
 	VkPipelineStageFlags dst_stage_mask = 0;
 	VkAccessFlags dst_access = 0;
 	if (p_post_barrier & BARRIER_MASK_TRANSFER) {
@@ -6316,6 +6415,8 @@ Error RenderingDeviceVulkan::buffer_clear(RID p_buffer, uint32_t p_offset, uint3
 Vector<uint8_t> RenderingDeviceVulkan::buffer_get_data(RID p_buffer) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_uploads();
+
 	// It could be this buffer was just created
 	VkPipelineShaderStageCreateFlags src_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
 	VkAccessFlags src_access_mask = VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -6776,8 +6877,24 @@ RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferForma
 	graphics_pipeline_create_info.basePipelineIndex = 0;
 
 	RenderPipeline pipeline;
-	VkResult err = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
-	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateGraphicsPipelines failed with error " + itos(err) + " for shader '" + shader->name + "'.");
+	String shader_name = shader->name;
+
+	// Compiling the pipeline can take a long time, don't block other threads using the device meanwhile.
+	// Shader modules are kept alive until pipelines_being_created is back to zero (see _free_pending_resources()).
+	pipelines_being_created++;
+	_THREAD_SAFE_UNLOCK_
+	VkResult err = vkCreateGraphicsPipelines(device, pipeline_cache, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
+	_THREAD_SAFE_LOCK_
+	pipelines_being_created--;
+
+	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateGraphicsPipelines failed with error " + itos(err) + " for shader '" + shader_name + "'.");
+
+	shader = shader_owner.get_or_null(p_shader);
+	if (!shader) {
+		// Freed while the pipeline was being compiled.
+		vkDestroyPipeline(device, pipeline.pipeline, nullptr);
+		ERR_FAIL_V_MSG(RID(), "Shader '" + shader_name + "' was freed while creating a render pipeline for it.");
+	}
 
 	pipeline.set_formats = shader->set_formats;
 	pipeline.push_constant_stages = shader->push_constant.push_constants_vk_stage;
@@ -6888,7 +7005,7 @@ RID RenderingDeviceVulkan::compute_pipeline_create(RID p_shader, const Vector<Pi
 	}
 
 	ComputePipeline pipeline;
-	VkResult err = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &compute_pipeline_create_info, nullptr, &pipeline.pipeline);
+	VkResult err = vkCreateComputePipelines(device, pipeline_cache, 1, &compute_pipeline_create_info, nullptr, &pipeline.pipeline);
 	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateComputePipelines failed with error " + itos(err) + ".");
 
 	pipeline.set_formats = shader->set_formats;
@@ -6964,6 +7081,8 @@ RenderingDevice::DrawListID RenderingDeviceVulkan::draw_list_begin_for_screen(Di
 	ERR_FAIL_COND_V_MSG(draw_list != nullptr, INVALID_ID, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr, INVALID_ID, "Only one draw/compute list can be active at the same time.");
 
+	_flush_pending_uploads();
+
 	VkCommandBuffer command_buffer = frames[frame].draw_command_buffer;
 
 	if (!context->window_is_valid_swapchain(p_screen)) {
@@ -7238,6 +7357,8 @@ RenderingDevice::DrawListID RenderingDeviceVulkan::draw_list_begin(RID p_framebu
 	ERR_FAIL_COND_V_MSG(draw_list != nullptr, INVALID_ID, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr && !compute_list->state.allow_draw_overlap, INVALID_ID, "Only one draw/compute list can be active at the same time.");
 
+	_flush_pending_uploads();
+
 	Framebuffer *framebuffer = framebuffer_owner.get_or_null(p_framebuffer);
 	ERR_FAIL_COND_V(!framebuffer, INVALID_ID);
 
@@ -7342,6 +7463,8 @@ Error RenderingDeviceVulkan::draw_list_begin_split(RID p_framebuffer, uint32_t p
 	ERR_FAIL_COND_V_MSG(draw_list != nullptr, ERR_BUSY, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr && !compute_list->state.allow_draw_overlap, ERR_BUSY, "Only one draw/compute list can be active at the same time.");
 
+	_flush_pending_uploads();
+
 	ERR_FAIL_COND_V(p_splits < 1, ERR_INVALID_DECLARATION);
 
 	Framebuffer *framebuffer = framebuffer_owner.get_or_null(p_framebuffer);
@@ -7783,6 +7906,87 @@ void RenderingDeviceVulkan::draw_list_draw(DrawListID p_list, bool p_use_indices
 	}
 }
 
+void RenderingDeviceVulkan::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_COND(!dl);
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_COND(!buffer);
+
+	ERR_FAIL_COND_MSG(!(buffer->usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), "Buffer provided was not created to do indirect dispatch.");
+
+	// VkDrawIndexedIndirectCommand is 5 uints, VkDrawIndirectCommand is 4.
+	uint32_t command_size = p_use_indices ? 20 : 16;
+	uint32_t stride = p_stride ? p_stride : command_size;
+	ERR_FAIL_COND_MSG(p_draw_count == 0, "Draw count must be greater than 0.");
+	ERR_FAIL_COND_MSG(p_draw_count > limits.maxDrawIndirectCount, "Draw count (" + itos(p_draw_count) + ") is larger than the maximum supported by the hardware (" + itos(limits.maxDrawIndirectCount) + ").");
+	ERR_FAIL_COND_MSG(p_draw_count > 1 && (stride < command_size || (stride % 4) != 0), "Stride (" + itos(stride) + ") must be a multiple of 4 and no smaller than a draw command (" + itos(command_size) + ").");
+	ERR_FAIL_COND_MSG((p_offset % 4) != 0, "Offset (" + itos(p_offset) + ") must be a multiple of 4.");
+	ERR_FAIL_COND_MSG(p_offset + (uint64_t)stride * (p_draw_count - 1) + command_size > buffer->size, "Draw commands go past the end of buffer.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		//pipeline uses vertices, validate format
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		//make sure format is right
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		//using push constants, check that they were supplied
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_size,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	}
+#endif
+
+	//Bind descriptor sets
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; //nothing expected by this pipeline
+		}
+#ifdef DEBUG_ENABLED
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+#endif
+		if (!dl->state.sets[i].bound) {
+			//All good, see if this requires re-binding
+			vkCmdBindDescriptorSets(dl->command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, dl->state.pipeline_layout, i, 1, &dl->state.sets[i].descriptor_set, 0, nullptr);
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	// Vertex and index counts and offsets are read from the buffer, so they can't be validated here.
+	if (p_use_indices) {
+		vkCmdDrawIndexedIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, stride);
+	} else {
+		vkCmdDrawIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, stride);
+	}
+}
+
 void RenderingDeviceVulkan::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -8089,6 +8293,8 @@ RenderingDevice::ComputeListID RenderingDeviceVulkan::compute_list_begin(bool p_
 	ERR_FAIL_COND_V_MSG(!p_allow_draw_overlap && draw_list != nullptr, INVALID_ID, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr, INVALID_ID, "Only one draw/compute list can be active at the same time.");
 
+	_flush_pending_uploads();
+
 	// Lock while compute_list is active
 	_THREAD_SAFE_LOCK_
 
@@ -8608,6 +8814,7 @@ void RenderingDeviceVulkan::barrier(uint32_t p_from, uint32_t p_to) {
 		dst_barrier_flags = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 	}
 
+	_flush_pending_uploads();
 	_memory_barrier(src_barrier_flags, dst_barrier_flags, src_access_flags, dst_access_flags, true);
 }
 
@@ -8615,6 +8822,7 @@ void RenderingDeviceVulkan::full_barrier() {
 #ifndef DEBUG_ENABLED
 	ERR_PRINT("Full barrier is debug-only, should not be used in production");
 #endif
+	_flush_pending_uploads();
 	_full_barrier(true);
 }
 
@@ -8845,6 +9053,8 @@ void RenderingDeviceVulkan::_finalize_command_bufers() {
 		ERR_PRINT("Found open compute list at the end of the frame, this should never happen (further compute will likely not work).");
 	}
 
+	_flush_pending_uploads();
+
 	{ //complete the setup buffer (that needs to be processed before anything else)
 		vkEndCommandBuffer(frames[frame].setup_command_buffer);
 		vkEndCommandBuffer(frames[frame].draw_command_buffer);
@@ -8996,7 +9206,7 @@ void RenderingDeviceVulkan::_free_pending_resources(int p_frame) {
 	}
 
 	//shaders
-	while (frames[p_frame].shaders_to_dispose_of.front()) {
+	while (pipelines_being_created == 0 && frames[p_frame].shaders_to_dispose_of.front()) {
 		Shader *shader = &frames[p_frame].shaders_to_dispose_of.front()->get();
 
 		//descriptor set layout for each set
@@ -9071,6 +9281,10 @@ uint32_t RenderingDeviceVulkan::get_frame_delay() const {
 	return frame_count;
 }
 
+uint64_t RenderingDeviceVulkan::get_present_wait_usec() const {
+	return context->get_present_wait_usec();
+}
+
 uint64_t RenderingDeviceVulkan::get_memory_usage(MemoryType p_type) const {
 	if (p_type == MEMORY_BUFFERS) {
 		return buffer_memory;
@@ -9083,12 +9297,29 @@ uint64_t RenderingDeviceVulkan::get_memory_usage(MemoryType p_type) const {
 	}
 }
 
+uint64_t RenderingDeviceVulkan::get_memory_budget() const {
+	// Without VK_EXT_memory_budget, this is estimated by the allocator from the heap sizes.
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+	VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+	vmaGetHeapBudgets(allocator, budgets);
+
+	uint64_t budget = 0;
+	for (uint32_t i = 0; i < memory_properties->memoryHeapCount; i++) {
+		if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+			budget += budgets[i].budget;
+		}
+	}
+	return budget;
+}
+
 void RenderingDeviceVulkan::_flush(bool p_current_frame) {
 	if (local_device.is_valid() && !p_current_frame) {
 		return; //flushing previous frames has no effect with local device
 	}
 	//not doing this crashes RADV (undefined behavior)
 	if (p_current_frame) {
+		_flush_pending_uploads();
 		vkEndCommandBuffer(frames[frame].setup_command_buffer);
 		vkEndCommandBuffer(frames[frame].draw_command_buffer);
 	}
@@ -9164,6 +9395,9 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 		allocatorInfo.physicalDevice = p_context->get_physical_device();
 		allocatorInfo.device = device;
 		allocatorInfo.instance = p_context->get_instance();
+		if (p_context->is_memory_budget_enabled()) {
+			allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+		}
 		vmaCreateAllocator(&allocatorInfo, &allocator);
 	}
 
@@ -9273,6 +9507,8 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 
 	max_descriptors_per_pool = GLOBAL_DEF("rendering/vulkan/descriptor_pools/max_descriptors_per_pool", 64);
 
+	_load_pipeline_cache();
+
 	//check to make sure DescriptorPoolKey is good
 	static_assert(sizeof(uint64_t) * 3 >= UNIFORM_TYPE_MAX * sizeof(uint16_t));
 
@@ -9283,6 +9519,82 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 	compute_list = nullptr;
 }
 
+void RenderingDeviceVulkan::_load_pipeline_cache() {
+	Vector<uint8_t> cache_data;
+
+	bool cache_enabled = GLOBAL_DEF("rendering/vulkan/pipeline_cache/enabled", true);
+	if (cache_enabled && local_device.is_null()) {
+		// The UUID includes the driver version, so updating drivers starts a new cache.
+		pipeline_cache_file_path = String("user://vulkan").plus_file("pipelines." + context->get_device_pipeline_cache_uuid() + ".cache");
+
+		if (FileAccess::exists(pipeline_cache_file_path)) {
+			cache_data = FileAccess::get_file_as_array(pipeline_cache_file_path);
+
+			// Drivers should reject data from other devices themselves, but not all of them do, so check the header too.
+			// It is made of the header size, the header version, the vendor and device IDs and the cache UUID.
+			const uint32_t header_size = 16 + VK_UUID_SIZE;
+			bool valid = uint32_t(cache_data.size()) >= header_size;
+			if (valid) {
+				const uint8_t *r = cache_data.ptr();
+				valid = decode_uint32(&r[0]) >= header_size && decode_uint32(&r[4]) == VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+				valid = valid && context->get_device_pipeline_cache_uuid().begins_with(String::hex_encode_buffer(&r[16], VK_UUID_SIZE));
+			}
+			if (!valid) {
+				WARN_PRINT("Ignoring invalid Vulkan pipeline cache: " + pipeline_cache_file_path);
+				cache_data.clear();
+			}
+		}
+	}
+
+	VkPipelineCacheCreateInfo cache_create_info;
+	cache_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	cache_create_info.pNext = nullptr;
+	cache_create_info.flags = 0;
+	cache_create_info.initialDataSize = cache_data.size();
+	cache_create_info.pInitialData = cache_data.ptr();
+
+	VkResult err = vkCreatePipelineCache(device, &cache_create_info, nullptr, &pipeline_cache);
+	if (err && cache_data.size()) {
+		// Start over with an empty cache.
+		cache_create_info.initialDataSize = 0;
+		cache_create_info.pInitialData = nullptr;
+		err = vkCreatePipelineCache(device, &cache_create_info, nullptr, &pipeline_cache);
+	}
+	if (err) {
+		ERR_PRINT("vkCreatePipelineCache failed with error " + itos(err) + ", pipelines will not be cached.");
+		pipeline_cache = VK_NULL_HANDLE;
+		pipeline_cache_file_path = String();
+	}
+}
+
+Error RenderingDeviceVulkan::pipeline_cache_save() {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(pipeline_cache_file_path.is_empty(), ERR_UNAVAILABLE, "The pipeline cache is disabled, or this is a local device.");
+
+	size_t data_size = 0;
+	VkResult err = vkGetPipelineCacheData(device, pipeline_cache, &data_size, nullptr);
+	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
+	if (data_size == 0) {
+		return OK;
+	}
+
+	Vector<uint8_t> data;
+	data.resize(data_size);
+	err = vkGetPipelineCacheData(device, pipeline_cache, &data_size, data.ptrw());
+	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
+
+	Ref<DirAccess> da = DirAccess::create_for_path(pipeline_cache_file_path.get_base_dir());
+	Error dir_err = da->make_dir_recursive(pipeline_cache_file_path.get_base_dir());
+	ERR_FAIL_COND_V_MSG(dir_err != OK && dir_err != ERR_ALREADY_EXISTS, dir_err, "Can't create the pipeline cache folder: " + pipeline_cache_file_path.get_base_dir());
+
+	Ref<FileAccess> f = FileAccess::open(pipeline_cache_file_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_CREATE, "Can't save the pipeline cache to: " + pipeline_cache_file_path);
+	f->store_buffer(data.ptr(), data_size);
+
+	return OK;
+}
+
 template <class T>
 void RenderingDeviceVulkan::_free_rids(T &p_owner, const char *p_type) {
 	List<RID> owned;
@@ -9598,6 +9910,14 @@ void RenderingDeviceVulkan::finalize() {
 	_free_rids(vertex_buffer_owner, "VertexBuffer");
 	_free_rids(framebuffer_owner, "Framebuffer");
 	_free_rids(sampler_owner, "Sampler");
+
+	if (pipeline_cache != VK_NULL_HANDLE) {
+		if (!pipeline_cache_file_path.is_empty()) {
+			pipeline_cache_save();
+		}
+		vkDestroyPipelineCache(device, pipeline_cache, nullptr);
+		pipeline_cache = VK_NULL_HANDLE;
+	}
 	{
 		//for textures it's a bit more difficult because they may be shared
 		List<RID> owned;
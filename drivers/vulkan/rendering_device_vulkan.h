@@ -196,6 +196,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	struct StagingBufferBlock {
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VmaAllocation allocation = nullptr;
+		uint8_t *data = nullptr; // Persistently mapped.
 		uint64_t frame_used = 0;
 		uint32_t fill_amount = 0;
 	};
@@ -209,6 +210,21 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	Error _staging_buffer_allocate(uint32_t p_amount, uint32_t p_required_align, uint32_t &r_alloc_offset, uint32_t &r_alloc_size, bool p_can_segment = true);
 	Error _insert_staging_block();
 
+	// Copies from staging memory handed out by buffer_get_upload_pointer(),
+	// recorded all at once (with a single barrier) when the uploads are flushed.
+	struct PendingUpload {
+		VkBuffer src_buffer = VK_NULL_HANDLE;
+		VkBuffer dst_buffer = VK_NULL_HANDLE;
+		VkBufferCopy region;
+	};
+
+	LocalVector<PendingUpload> pending_uploads;
+	LocalVector<VkBufferCopy> pending_upload_regions;
+	VkPipelineStageFlags pending_uploads_dst_stage_mask = 0;
+	VkAccessFlags pending_uploads_dst_access = 0;
+
+	void _flush_pending_uploads();
+
 	struct Buffer {
 		uint32_t size = 0;
 		uint32_t usage = 0;
@@ -1022,6 +1038,12 @@ class RenderingDeviceVulkan : public RenderingDevice {
 
 	VulkanContext *context = nullptr;
 
+	// Driver pipeline cache, loaded from and saved to disk for the main device.
+	VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+	uint32_t pipelines_being_created = 0; // Render pipelines compiled with the device lock released.
+	String pipeline_cache_file_path;
+	void _load_pipeline_cache();
+
 	uint64_t image_memory = 0;
 	uint64_t buffer_memory = 0;
 
@@ -1115,6 +1137,8 @@ public:
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, uint32_t p_post_barrier = BARRIER_MASK_ALL); //works for any buffer
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier = BARRIER_MASK_ALL);
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer);
+	virtual uint8_t *buffer_get_upload_pointer(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier = BARRIER_MASK_ALL);
+	virtual void buffer_flush_uploads();
 
 	/*************************/
 	/**** RENDER PIPELINE ****/
@@ -1155,6 +1179,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect);
 	virtual void draw_list_disable_scissor(DrawListID p_list);
@@ -1216,10 +1241,12 @@ public:
 	virtual void sync(); //for local device
 
 	virtual uint32_t get_frame_delay() const;
+	virtual uint64_t get_present_wait_usec() const;
 
 	virtual RenderingDevice *create_local_device();
 
 	virtual uint64_t get_memory_usage(MemoryType p_type) const;
+	virtual uint64_t get_memory_budget() const;
 
 	virtual void set_resource_name(RID p_id, const String p_name);
 
@@ -1233,6 +1260,8 @@ public:
 	virtual String get_device_api_version() const;
 	virtual String get_device_pipeline_cache_uuid() const;
 
+	virtual Error pipeline_cache_save();
+
 	virtual uint64_t get_driver_resource(DriverResource p_resource, RID p_rid = RID(), uint64_t p_index = 0);
 
 	virtual bool has_feature(const Features p_feature) const;
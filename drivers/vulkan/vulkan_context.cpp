@@ -352,6 +352,7 @@ Error VulkanContext::_initialize_extensions() {
 			}
 			if (!strcmp(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, instance_extensions[i].extensionName)) {
 				extension_names[enabled_extension_count++] = VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
+				enabled_physical_device_properties_2 = true;
 			}
 			if (enabled_extension_count >= MAX_EXTENSIONS) {
 				free(instance_extensions);
@@ -1063,6 +1064,11 @@ Error VulkanContext::_create_physical_device(VkSurfaceKHR p_surface) {
 			if (!strcmp(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, device_extensions[i].extensionName)) {
 				extension_names[enabled_extension_count++] = VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME;
 			}
+			if (enabled_physical_device_properties_2 && !strcmp(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, device_extensions[i].extensionName)) {
+				// Lets the memory allocator query how much video memory the system allows us to use.
+				extension_names[enabled_extension_count++] = VK_EXT_MEMORY_BUDGET_EXTENSION_NAME;
+				enabled_memory_budget = true;
+			}
 			if (enabled_extension_count >= MAX_EXTENSIONS) {
 				free(device_extensions);
 				ERR_FAIL_V_MSG(ERR_BUG, "Enabled extension count reaches MAX_EXTENSIONS, BUG");
@@ -2014,6 +2020,8 @@ Error VulkanContext::prepare_buffers() {
 
 	VkResult err;
 
+	const uint64_t wait_begin = OS::get_singleton()->get_ticks_usec();
+
 	// Ensure no more than FRAME_LAG renderings are outstanding.
 	vkWaitForFences(device, 1, &fences[frame_index], VK_TRUE, UINT64_MAX);
 	vkResetFences(device, 1, &fences[frame_index]);
@@ -2052,6 +2060,8 @@ Error VulkanContext::prepare_buffers() {
 		} while (err != VK_SUCCESS);
 	}
 
+	present_wait_usec.set(OS::get_singleton()->get_ticks_usec() - wait_begin);
+
 	buffers_prepared = true;
 
 	return OK;
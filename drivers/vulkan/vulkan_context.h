@@ -33,6 +33,7 @@
 
 #include "core/error/error_list.h"
 #include "core/os/mutex.h"
+#include "core/templates/safe_refcount.h"
 #include "core/string/ustring.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/rid_owner.h"
@@ -124,6 +125,7 @@ private:
 	uint32_t device_api_version = 0;
 
 	bool buffers_prepared = false;
+	SafeNumeric<uint64_t> present_wait_usec; // Time prepare_buffers() was blocked waiting for the previous frames and the swapchain.
 
 	// Present queue.
 	bool queues_initialized = false;
@@ -188,6 +190,8 @@ private:
 	uint32_t enabled_extension_count = 0;
 	const char *extension_names[MAX_EXTENSIONS];
 	bool enabled_debug_utils = false;
+	bool enabled_physical_device_properties_2 = false;
+	bool enabled_memory_budget = false;
 
 	/**
 	 * True if VK_EXT_debug_report extension is used. VK_EXT_debug_report is deprecated but it is
@@ -277,6 +281,7 @@ public:
 	const VRSCapabilities &get_vrs_capabilities() const { return vrs_capabilities; };
 	const ShaderCapabilities &get_shader_capabilities() const { return shader_capabilities; };
 	const StorageBufferCapabilities &get_storage_buffer_capabilities() const { return storage_buffer_capabilities; };
+	bool is_memory_budget_enabled() const { return enabled_memory_budget; };
 
 	VkDevice get_device();
 	VkPhysicalDevice get_physical_device();
@@ -310,6 +315,7 @@ public:
 	void flush(bool p_flush_setup = false, bool p_flush_pending = false);
 	Error prepare_buffers();
 	Error swap_buffers();
+	uint64_t get_present_wait_usec() const { return present_wait_usec.get(); }
 	Error initialize();
 
 	void command_begin_label(VkCommandBuffer p_command_buffer, String p_label_name, const Color p_color);
@@ -41,6 +41,7 @@
 #include <windows.h>
 
 #include <errno.h>
+#include <io.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <tchar.h>
@@ -138,6 +139,14 @@ void FileAccessWindows::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		UnmapViewOfFile(mapped_data);
+		CloseHandle((HANDLE)mapping_handle);
+		mapped_data = nullptr;
+		mapping_handle = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -270,6 +279,41 @@ uint64_t FileAccessWindows::get_buffer(uint8_t *p_dst, uint64_t p_length) const
 	return read;
 }
 
+const uint8_t *FileAccessWindows::map_contents(uint64_t &r_length) {
+	ERR_FAIL_COND_V(!f, nullptr);
+
+#ifdef UWP_ENABLED
+	return nullptr;
+#else
+	if (!mapped_data) {
+		if (flags != READ) {
+			return nullptr;
+		}
+
+		uint64_t length = get_length();
+		if (length == 0 || length > SIZE_MAX) {
+			return nullptr;
+		}
+
+		HANDLE mapping = CreateFileMappingW((HANDLE)_get_osfhandle(_fileno(f)), nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping) {
+			return nullptr;
+		}
+		void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data) {
+			CloseHandle(mapping);
+			return nullptr;
+		}
+		mapping_handle = mapping;
+		mapped_data = (uint8_t *)data;
+		mapped_length = length;
+	}
+
+	r_length = mapped_length;
+	return mapped_data;
+#endif
+}
+
 Error FileAccessWindows::get_error() const {
 	return last_error;
 }
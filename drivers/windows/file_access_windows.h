@@ -48,6 +48,10 @@ class FileAccessWindows : public FileAccess {
 	String path_src;
 	String save_path;
 
+	void *mapping_handle = nullptr;
+	uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
+
 	void _close();
 
 public:
@@ -66,6 +70,7 @@ public:
 
 	virtual uint8_t get_8() const; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const;
+	virtual const uint8_t *map_contents(uint64_t &r_length);
 
 	virtual Error get_error() const; ///< get last error
 
@@ -575,6 +575,11 @@ bool EditorFileSystem::_update_scan_actions() {
 				} else {
 					ia.dir->subdirs.insert(idx, ia.new_dir);
 				}
+				if (watching_dirs && !_watch_directory_tree(ia.new_dir)) {
+					// Out of watches, go back to full scans.
+					watching_dirs = false;
+					OS::get_singleton()->clear_directory_watches();
+				}
 
 				fs_changed = true;
 			} break;
@@ -701,6 +706,7 @@ void EditorFileSystem::scan() {
 		filesystem = new_filesystem;
 		new_filesystem = nullptr;
 		_update_scan_actions();
+		_update_directory_watches();
 		scanning = false;
 		emit_signal(SNAME("filesystem_changed"));
 		emit_signal(SNAME("sources_changed"), sources_changed.size() > 0);
@@ -935,7 +941,31 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 	}
 }
 
+void EditorFileSystem::_update_directory_watches() {
+	OS::get_singleton()->clear_directory_watches();
+	watching_dirs = filesystem && _watch_directory_tree(filesystem);
+	if (!watching_dirs) {
+		OS::get_singleton()->clear_directory_watches();
+	}
+}
+
+bool EditorFileSystem::_watch_directory_tree(EditorFileSystemDirectory *p_dir) {
+	if (!OS::get_singleton()->watch_directory(ProjectSettings::get_singleton()->globalize_path(p_dir->get_path()))) {
+		return false;
+	}
+	for (int i = 0; i < p_dir->get_subdir_count(); i++) {
+		if (!_watch_directory_tree(p_dir->get_subdir(i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress) {
+	if (watch_filter && !watch_dirty_dirs.has(p_dir->get_path())) {
+		return; // Nothing changed here or below.
+	}
+
 	uint64_t current_mtime = FileAccess::get_modified_time(p_dir->get_path());
 
 	bool updated_dir = false;
@@ -1158,6 +1188,38 @@ void EditorFileSystem::scan_changes() {
 
 	_update_extensions();
 	sources_changed.clear();
+
+	watch_filter = false;
+	watch_dirty_dirs.clear();
+	if (watching_dirs) {
+		List<String> changed;
+		if (OS::get_singleton()->get_directory_changes(&changed)) {
+			watch_filter = true;
+			for (const String &E : changed) {
+				// The parents are checked too, they list the changed directory.
+				String path = ProjectSettings::get_singleton()->localize_path(E);
+				while (true) {
+					if (!path.ends_with("/")) {
+						path += "/";
+					}
+					if (watch_dirty_dirs.has(path)) {
+						break;
+					}
+					watch_dirty_dirs.insert(path);
+					if (path == "res://") {
+						break;
+					}
+					path = path.substr(0, path.length() - 1).get_base_dir();
+				}
+			}
+			if (watch_dirty_dirs.is_empty()) {
+				// Nothing changed since the last scan.
+				emit_signal(SNAME("sources_changed"), false);
+				return;
+			}
+		}
+	}
+
 	scanning_changes = true;
 	scanning_changes_done = false;
 
@@ -1175,6 +1237,9 @@ void EditorFileSystem::scan_changes() {
 			if (_update_scan_actions()) {
 				emit_signal(SNAME("filesystem_changed"));
 			}
+			if (!watch_filter) {
+				_update_directory_watches();
+			}
 		}
 		scanning_changes = false;
 		scanning_changes_done = true;
@@ -1217,6 +1282,10 @@ void EditorFileSystem::_notification(int p_what) {
 			}
 			filesystem = nullptr;
 			new_filesystem = nullptr;
+			if (watching_dirs) {
+				OS::get_singleton()->clear_directory_watches();
+				watching_dirs = false;
+			}
 		} break;
 
 		case NOTIFICATION_PROCESS: {
@@ -1231,6 +1300,9 @@ void EditorFileSystem::_notification(int p_what) {
 						if (_update_scan_actions()) {
 							emit_signal(SNAME("filesystem_changed"));
 						}
+						if (!watch_filter) {
+							_update_directory_watches();
+						}
 						emit_signal(SNAME("sources_changed"), sources_changed.size() > 0);
 						_queue_update_script_classes();
 						first_scan = false;
@@ -1245,6 +1317,7 @@ void EditorFileSystem::_notification(int p_what) {
 					new_filesystem = nullptr;
 					thread.wait_to_finish();
 					_update_scan_actions();
+					_update_directory_watches();
 					emit_signal(SNAME("filesystem_changed"));
 					emit_signal(SNAME("sources_changed"), sources_changed.size() > 0);
 					_queue_update_script_classes();
@@ -2069,8 +2142,7 @@ void EditorFileSystem::reimport_file_with_custom_parameters(const String &p_file
 }
 
 void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_import_data) {
-	p_import_data->max_index = MAX(p_import_data->reimport_from + int(p_index), p_import_data->max_index);
-	_reimport_file(p_import_data->reimport_files[p_import_data->reimport_from + p_index].path);
+	_reimport_file(p_import_data->reimport_files[p_index].path);
 }
 
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
@@ -2118,47 +2190,67 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	reimport_files.sort();
 
 	bool use_threads = GLOBAL_GET("editor/import/use_multiple_threads");
+	int max_threads = GLOBAL_GET("editor/import/max_threads");
 
+	// Files are imported by order, as files of a higher order can depend on the lower ones (e.g. scenes on textures).
+	// All the files of an order are independent, so all the ones with a thread safe importer are imported together.
+	int step = 0;
 	int from = 0;
-	for (int i = 0; i < reimport_files.size(); i++) {
-		if (use_threads && reimport_files[i].threaded) {
-			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer) {
-				if (from - i == 0) {
-					//single file, do not use threads
-					pr.step(reimport_files[i].path.get_file(), i);
-					_reimport_file(reimport_files[i].path);
-				} else {
-					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
-					ERR_CONTINUE(!importer.is_valid());
-
-					importer->import_threaded_begin();
-
-					ImportThreadData data;
-					data.max_index = from;
-					data.reimport_from = from;
-					data.reimport_files = reimport_files.ptr();
-
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &data, i - from + 1, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
-					int current_index = from - 1;
-					do {
-						if (current_index < data.max_index) {
-							current_index = data.max_index;
-							pr.step(reimport_files[current_index].path.get_file(), current_index);
-						}
-						OS::get_singleton()->delay_usec(1);
-					} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
+	while (from < reimport_files.size()) {
+		int order = reimport_files[from].order;
+		Vector<ImportFile> threaded_files;
+		Vector<ImportFile> serial_files;
+		for (; from < reimport_files.size() && reimport_files[from].order == order; from++) {
+			if (use_threads && reimport_files[from].threaded) {
+				threaded_files.push_back(reimport_files[from]);
+			} else {
+				serial_files.push_back(reimport_files[from]);
+			}
+		}
+
+		if (threaded_files.size() == 1) {
+			// Single file, do not use threads.
+			serial_files.insert(0, threaded_files[0]);
+			threaded_files.clear();
+		}
+
+		if (threaded_files.size()) {
+			Vector<Ref<ResourceImporter>> importers;
+			for (int i = 0; i < threaded_files.size(); i++) {
+				if (i == 0 || threaded_files[i].importer != threaded_files[i - 1].importer) {
+					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(threaded_files[i].importer);
+					if (importer.is_valid()) {
+						importer->import_threaded_begin();
+						importers.push_back(importer);
+					}
+				}
+			}
 
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			ImportThreadData data;
+			data.reimport_files = threaded_files.ptr();
 
-					importer->import_threaded_end();
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &data, threaded_files.size(), max_threads > 0 ? max_threads : -1, false, TTR("Import resources"));
+			int current_index = -1;
+			do {
+				int processed = WorkerThreadPool::get_singleton()->get_group_processed_element_count(group_task);
+				if (processed > current_index && processed < threaded_files.size()) {
+					current_index = processed;
+					pr.step(threaded_files[current_index].path.get_file(), step + current_index);
 				}
+				OS::get_singleton()->delay_usec(1);
+			} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
+
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			step += threaded_files.size();
 
-				from = i + 1;
+			for (int i = 0; i < importers.size(); i++) {
+				importers.write[i]->import_threaded_end();
 			}
+		}
 
-		} else {
-			pr.step(reimport_files[i].path.get_file(), i);
-			_reimport_file(reimport_files[i].path);
+		for (int i = 0; i < serial_files.size(); i++) {
+			pr.step(serial_files[i].path.get_file(), step++);
+			_reimport_file(serial_files[i].path);
 		}
 	}
 
@@ -2419,6 +2511,8 @@ EditorFileSystem::EditorFileSystem() {
 	ResourceLoader::import = _resource_import;
 	reimport_on_missing_imported_files = GLOBAL_DEF("editor/import/reimport_missing_imported_files", true);
 	GLOBAL_DEF("editor/import/use_multiple_threads", true);
+	GLOBAL_DEF("editor/import/max_threads", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/import/max_threads", PropertyInfo(Variant::INT, "editor/import/max_threads", PROPERTY_HINT_RANGE, "0,256,1"));
 	singleton = this;
 	filesystem = memnew(EditorFileSystemDirectory); //like, empty
 	filesystem->parent = nullptr;
@@ -174,6 +174,13 @@ class EditorFileSystem : public Node {
 	bool first_scan = true;
 	bool scan_changes_pending = false;
 	float scan_total;
+
+	// When the OS can watch the project directories, scan_changes() only checks the ones it reported and their parents.
+	bool watching_dirs = false;
+	bool watch_filter = false;
+	HashSet<String> watch_dirty_dirs;
+	void _update_directory_watches();
+	bool _watch_directory_tree(EditorFileSystemDirectory *p_dir);
 	String filesystem_settings_version_for_import;
 	bool revalidate_import_files = false;
 
@@ -275,9 +282,7 @@ class EditorFileSystem : public Node {
 	HashSet<String> group_file_cache;
 
 	struct ImportThreadData {
-		const ImportFile *reimport_files;
-		int reimport_from;
-		int max_index = 0;
+		const ImportFile *reimport_files = nullptr;
 	};
 
 	void _reimport_thread(uint32_t p_index, ImportThreadData *p_import_data);
@@ -79,6 +79,7 @@ void EditorExport::_save() {
 		config->set_value(section, "encrypt_directory", preset->get_enc_directory());
 		config->set_value(section, "script_export_mode", preset->get_script_export_mode());
 		config->set_value(section, "script_encryption_key", preset->get_script_encryption_key());
+		config->set_value(section, "patches", preset->get_patches());
 
 		String option_section = "preset." + itos(i) + ".options";
 
@@ -264,6 +265,9 @@ void EditorExport::load_config() {
 		if (config->has_section_key(section, "script_encryption_key")) {
 			preset->set_script_encryption_key(config->get_value(section, "script_encryption_key"));
 		}
+		if (config->has_section_key(section, "patches")) {
+			preset->set_patches(config->get_value(section, "patches"));
+		}
 
 		String option_section = "preset." + itos(index) + ".options";
 
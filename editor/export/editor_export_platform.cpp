@@ -43,6 +43,7 @@
 #include "editor/editor_scale.h"
 #include "editor/plugins/script_editor_plugin.h"
 #include "editor_export_plugin.h"
+#include "servers/rendering/renderer_rd/shader_rd.h"
 
 static int _get_pad(int p_alignment, int p_n) {
 	int rest = p_n % p_alignment;
@@ -208,6 +209,25 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
+	// Store MD5 of original file.
+	{
+		unsigned char hash[16];
+		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
+		sd.md5.resize(16);
+		for (int i = 0; i < 16; i++) {
+			sd.md5.write[i] = hash[i];
+		}
+	}
+
+	const SavedData *base = pd->patch_base_files.getptr(p_path);
+	if (base && base->size == sd.size && base->md5 == sd.md5) {
+		// Unchanged since the base packs, the patch doesn't need it.
+		if (pd->ep->step(TTR("Skipping Unchanged File:") + " " + p_path, 2 + p_file * 100 / p_total, false)) {
+			return ERR_SKIP;
+		}
+		return OK;
+	}
+
 	Ref<FileAccessEncrypted> fae;
 	Ref<FileAccess> ftmp = pd->f;
 
@@ -233,16 +253,6 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		pd->f->store_8(Math::rand() % 256);
 	}
 
-	// Store MD5 of original file.
-	{
-		unsigned char hash[16];
-		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
-		sd.md5.resize(16);
-		for (int i = 0; i < 16; i++) {
-			sd.md5.write[i] = hash[i];
-		}
-	}
-
 	pd->file_ofs.push_back(sd);
 
 	if (pd->ep->step(TTR("Storing File:") + " " + p_path, 2 + p_file * 100 / p_total, false)) {
@@ -856,6 +866,34 @@ Error EditorExportPlatform::export_project_files(const Ref<EditorExportPreset> &
 		}
 	}
 
+	// Store the shader versions the project used when run from the editor, so they don't need to be compiled on first launch.
+	if (GLOBAL_GET("rendering/shader_compiler/shader_cache/export_bundle")) {
+		const String cache_dirs[] = { EditorPaths::get_singleton()->get_project_data_dir().plus_file("shader_cache"), "user://shader_cache" };
+		HashSet<String> exported_versions;
+		for (const String &cache_dir : cache_dirs) {
+			Ref<FileAccess> log = FileAccess::open(cache_dir.plus_file(ShaderRD::VARIANT_LOG_FILE), FileAccess::READ);
+			if (log.is_null()) {
+				continue;
+			}
+			while (!log->eof_reached()) {
+				String version = log->get_line().strip_edges();
+				if (version.is_empty() || exported_versions.has(version)) {
+					continue;
+				}
+				String version_file = cache_dir.plus_file(version) + ".cache";
+				if (!FileAccess::exists(version_file)) {
+					continue; // Cleared from the cache since.
+				}
+				exported_versions.insert(version);
+				Vector<uint8_t> array = FileAccess::get_file_as_array(version_file);
+				err = p_func(p_udata, String("res://").plus_file(ShaderRD::BUNDLE_DIR).plus_file(version) + ".cache", array, idx, total, enc_in_filters, enc_ex_filters, key);
+				if (err != OK) {
+					return err;
+				}
+			}
+		}
+	}
+
 	String config_file = "project.binary";
 	String engine_cfb = EditorPaths::get_singleton()->get_cache_dir().plus_file("tmp" + config_file);
 	ProjectSettings::get_singleton()->save_custom(engine_cfb, custom_map, custom_list);
@@ -874,9 +912,84 @@ Error EditorExportPlatform::_add_shared_object(void *p_userdata, const SharedObj
 	return OK;
 }
 
-Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, Vector<SharedObject> *p_so_files, bool p_embed, int64_t *r_embedded_start, int64_t *r_embedded_size) {
+Error EditorExportPlatform::_load_patch_base_files(const String &p_path, HashMap<String, SavedData> &r_files) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		add_message(EXPORT_MESSAGE_ERROR, TTR("Save PCK"), vformat(TTR("Can't open base pack \"%s\"."), p_path));
+		return ERR_FILE_CANT_OPEN;
+	}
+
+	uint32_t magic = f->get_32();
+	if (magic != PACK_HEADER_MAGIC) {
+		// Self contained executable, the pack is at the end.
+		f->seek_end();
+		f->seek(f->get_position() - 4);
+		magic = f->get_32();
+		if (magic == PACK_HEADER_MAGIC) {
+			f->seek(f->get_position() - 12);
+			uint64_t ds = f->get_64();
+			f->seek(f->get_position() - ds - 8);
+			magic = f->get_32();
+		}
+	}
+	if (magic != PACK_HEADER_MAGIC || f->get_32() != PACK_FORMAT_VERSION) {
+		add_message(EXPORT_MESSAGE_ERROR, TTR("Save PCK"), vformat(TTR("\"%s\" is not a supported pack."), p_path));
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	f->get_32(); // Major.
+	f->get_32(); // Minor.
+	f->get_32(); // Patch.
+
+	uint32_t pack_flags = f->get_32();
+	if (pack_flags & PACK_DIR_ENCRYPTED) {
+		add_message(EXPORT_MESSAGE_ERROR, TTR("Save PCK"), vformat(TTR("The directory of base pack \"%s\" is encrypted, it can't be patched."), p_path));
+		return ERR_UNAVAILABLE;
+	}
+
+	f->get_64(); // Files base.
+	for (int i = 0; i < 16; i++) {
+		//reserved
+		f->get_32();
+	}
+
+	uint32_t file_count = f->get_32();
+	for (uint32_t i = 0; i < file_count; i++) {
+		uint32_t sl = f->get_32();
+		CharString cs;
+		cs.resize(sl + 1);
+		f->get_buffer((uint8_t *)cs.ptr(), sl);
+		cs[sl] = 0;
+
+		String path;
+		path.parse_utf8(cs.ptr());
+
+		SavedData sd;
+		sd.path_utf8 = path.utf8();
+		sd.ofs = f->get_64();
+		sd.size = f->get_64();
+		sd.md5.resize(16);
+		f->get_buffer(sd.md5.ptrw(), 16);
+		sd.encrypted = f->get_32() & PACK_FILE_ENCRYPTED;
+
+		// Later packs replace the files of earlier ones when loaded.
+		r_files[path] = sd;
+	}
+
+	return OK;
+}
+
+Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, Vector<SharedObject> *p_so_files, bool p_embed, int64_t *r_embedded_start, int64_t *r_embedded_size, const Vector<String> &p_patches) {
 	EditorProgress ep("savepack", TTR("Packing"), 102, true);
 
+	PackData pd;
+	for (int i = 0; i < p_patches.size(); i++) {
+		Error err = _load_patch_base_files(p_patches[i], pd.patch_base_files);
+		if (err != OK) {
+			return err;
+		}
+	}
+
 	// Create the temporary export directory if it doesn't exist.
 	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
 	da->make_dir_recursive(EditorPaths::get_singleton()->get_cache_dir());
@@ -888,7 +1001,6 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		return ERR_CANT_CREATE;
 	}
 
-	PackData pd;
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
@@ -1115,7 +1227,7 @@ Error EditorExportPlatform::save_zip(const Ref<EditorExportPreset> &p_preset, bo
 
 Error EditorExportPlatform::export_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, int p_flags) {
 	ExportNotifier notifier(*this, p_preset, p_debug, p_path, p_flags);
-	return save_pack(p_preset, p_debug, p_path);
+	return save_pack(p_preset, p_debug, p_path, nullptr, false, nullptr, nullptr, p_preset->get_patches());
 }
 
 Error EditorExportPlatform::export_zip(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, int p_flags) {
@@ -78,6 +78,8 @@ private:
 		Vector<SavedData> file_ofs;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
+		// Files of the packs a patch is loaded on top of, files that didn't change since are left out.
+		HashMap<String, SavedData> patch_base_files;
 	};
 
 	struct ZipData {
@@ -104,6 +106,8 @@ private:
 
 	static Error _add_shared_object(void *p_userdata, const SharedObject &p_so);
 
+	Error _load_patch_base_files(const String &p_path, HashMap<String, SavedData> &r_files);
+
 protected:
 	struct ExportNotifier {
 		ExportNotifier(EditorExportPlatform &p_platform, const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, int p_flags);
@@ -183,7 +187,7 @@ public:
 
 	Error export_project_files(const Ref<EditorExportPreset> &p_preset, bool p_debug, EditorExportSaveFunction p_func, void *p_udata, EditorExportSaveSharedObject p_so_func = nullptr);
 
-	Error save_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, Vector<SharedObject> *p_so_files = nullptr, bool p_embed = false, int64_t *r_embedded_start = nullptr, int64_t *r_embedded_size = nullptr);
+	Error save_pack(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path, Vector<SharedObject> *p_so_files = nullptr, bool p_embed = false, int64_t *r_embedded_start = nullptr, int64_t *r_embedded_size = nullptr, const Vector<String> &p_patches = Vector<String>());
 	Error save_zip(const Ref<EditorExportPreset> &p_preset, bool p_debug, const String &p_path);
 
 	virtual bool poll_export() { return false; }
@@ -218,4 +218,13 @@ String EditorExportPreset::get_script_encryption_key() const {
 	return script_key;
 }
 
+void EditorExportPreset::set_patches(const Vector<String> &p_patches) {
+	patches = p_patches;
+	EditorExport::singleton->save_presets();
+}
+
+Vector<String> EditorExportPreset::get_patches() const {
+	return patches;
+}
+
 EditorExportPreset::EditorExportPreset() {}
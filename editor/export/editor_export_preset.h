@@ -80,6 +80,8 @@ private:
 	int script_mode = MODE_SCRIPT_COMPILED;
 	String script_key;
 
+	Vector<String> patches;
+
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
@@ -137,6 +139,9 @@ public:
 	void set_script_encryption_key(const String &p_key);
 	String get_script_encryption_key() const;
 
+	void set_patches(const Vector<String> &p_patches);
+	Vector<String> get_patches() const;
+
 	const List<PropertyInfo> &get_properties() const { return properties; }
 
 	EditorExportPreset();
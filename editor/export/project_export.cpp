@@ -235,6 +235,7 @@ void ProjectExportDialog::_edit_preset(int p_index) {
 	export_filter->select(current->get_export_filter());
 	include_filters->set_text(current->get_include_filter());
 	exclude_filters->set_text(current->get_exclude_filter());
+	patches->set_text(String(", ").join(current->get_patches()));
 
 	_fill_resource_tree();
 
@@ -719,6 +720,16 @@ void ProjectExportDialog::_filter_changed(const String &p_filter) {
 
 	current->set_include_filter(include_filters->get_text());
 	current->set_exclude_filter(exclude_filters->get_text());
+
+	Vector<String> patch_paths;
+	Vector<String> patch_split = patches->get_text().split(",");
+	for (int i = 0; i < patch_split.size(); i++) {
+		String path = patch_split[i].strip_edges();
+		if (!path.is_empty()) {
+			patch_paths.push_back(path);
+		}
+	}
+	current->set_patches(patch_paths);
 }
 
 void ProjectExportDialog::_fill_resource_tree() {
@@ -1108,6 +1119,12 @@ ProjectExportDialog::ProjectExportDialog() {
 			exclude_filters);
 	exclude_filters->connect("text_changed", callable_mp(this, &ProjectExportDialog::_filter_changed));
 
+	patches = memnew(LineEdit);
+	resources_vb->add_margin_child(
+			TTR("Base packs to patch when exporting a PCK, only changed files are exported\n(comma-separated, e.g: base.pck, patch_1.pck)"),
+			patches);
+	patches->connect("text_changed", callable_mp(this, &ProjectExportDialog::_filter_changed));
+
 	script_mode = memnew(OptionButton);
 	resources_vb->add_margin_child(TTR("GDScript Export Mode:"), script_mode);
 	script_mode->add_item(TTR("Text"), (int)EditorExportPreset::MODE_SCRIPT_TEXT);
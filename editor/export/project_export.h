@@ -74,6 +74,7 @@ private:
 	OptionButton *export_filter = nullptr;
 	LineEdit *include_filters = nullptr;
 	LineEdit *exclude_filters = nullptr;
+	LineEdit *patches = nullptr;
 	Tree *include_files = nullptr;
 
 	Label *include_label = nullptr;
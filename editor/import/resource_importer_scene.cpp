@@ -32,6 +32,8 @@
 
 #include "core/error/error_macros.h"
 #include "core/io/resource_saver.h"
+#include "core/math/convex_hull.h"
+#include "core/object/worker_thread_pool.h"
 #include "editor/editor_node.h"
 #include "editor/import/scene_import_settings.h"
 #include "scene/3d/area_3d.h"
@@ -45,6 +47,7 @@
 #include "scene/animation/animation_player.h"
 #include "scene/resources/animation.h"
 #include "scene/resources/box_shape_3d.h"
+#include "scene/resources/convex_polygon_shape_3d.h"
 #include "scene/resources/importer_mesh.h"
 #include "scene/resources/packed_scene.h"
 #include "scene/resources/resource_format_text.h"
@@ -351,27 +354,145 @@ static String _fixstr(const String &p_what, const String &p_str) {
 	return what;
 }
 
-static void _pre_gen_shape_list(Ref<ImporterMesh> &mesh, Vector<Ref<Shape3D>> &r_shape_list, bool p_convex) {
+void ResourceImporterScene::_pre_gen_shape_list(Ref<ImporterMesh> &mesh, Vector<Ref<Shape3D>> &r_shape_list, bool p_convex, Vector<PendingConvexShape> &r_pending_convex_shapes) {
 	ERR_FAIL_NULL_MSG(mesh, "Cannot generate shape list with null mesh value");
 	ERR_FAIL_NULL_MSG(mesh->get_mesh(), "Cannot generate shape list with null mesh value");
 	if (!p_convex) {
 		Ref<Shape3D> shape = mesh->create_trimesh_shape();
 		r_shape_list.push_back(shape);
 	} else {
-		Vector<Ref<Shape3D>> cd;
-		cd.push_back(mesh->get_mesh()->create_convex_shape(true, /*Passing false, otherwise VHACD will be used to simplify (Decompose) the Mesh.*/ false));
-		if (cd.size()) {
-			for (int i = 0; i < cd.size(); i++) {
-				r_shape_list.push_back(cd[i]);
-			}
+		Ref<ArrayMesh> array_mesh = mesh->get_mesh();
+		PendingConvexShape pending;
+		for (int i = 0; i < array_mesh->get_surface_count(); i++) {
+			Array a = array_mesh->surface_get_arrays(i);
+			ERR_FAIL_COND(a.is_empty());
+			Vector<Vector3> v = a[Mesh::ARRAY_VERTEX];
+			pending.points.append_array(v);
+		}
+		Ref<ConvexPolygonShape3D> shape;
+		shape.instantiate();
+		pending.shape = shape;
+		r_pending_convex_shapes.push_back(pending);
+		r_shape_list.push_back(shape);
+	}
+}
+
+void ResourceImporterScene::_gen_pending_convex_shapes(Vector<PendingConvexShape> &r_pending_convex_shapes) {
+	Vector<Vector<Vector3>> point_sets;
+	point_sets.resize(r_pending_convex_shapes.size());
+	for (int i = 0; i < r_pending_convex_shapes.size(); i++) {
+		point_sets.write[i] = r_pending_convex_shapes[i].points;
+	}
+
+	Vector<Geometry3D::MeshData> hulls;
+	ConvexHullComputer::convex_hull_batch(point_sets, hulls);
+
+	for (int i = 0; i < r_pending_convex_shapes.size(); i++) {
+		Ref<ConvexPolygonShape3D> shape = r_pending_convex_shapes[i].shape;
+		if (!hulls[i].vertices.is_empty()) {
+			shape->set_points(hulls[i].vertices);
+		} else {
+			ERR_PRINT("Convex shape cleaning failed, falling back to simpler process.");
+			shape->set_points(point_sets[i]);
+		}
+	}
+	r_pending_convex_shapes.clear();
+}
+
+Dictionary ResourceImporterScene::_get_decomposition_options(const Dictionary &p_node_settings) {
+	Dictionary options;
+	for (const Variant *key = p_node_settings.next(nullptr); key; key = p_node_settings.next(key)) {
+		const String name = *key;
+		if (name == "physics/shape_type" || name.begins_with("decomposition/")) {
+			options[*key] = p_node_settings[*key];
+		}
+	}
+	return options;
+}
+
+void ResourceImporterScene::_pre_gen_decompositions(Node *p_node, Node *p_root, const Dictionary &p_node_data, const HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &p_collision_map, Vector<PendingDecomposition> &r_decompositions) {
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_pre_gen_decompositions(p_node->get_child(i), p_root, p_node_data, p_collision_map, r_decompositions);
+	}
+
+	ImporterMeshInstance3D *mi = Object::cast_to<ImporterMeshInstance3D>(p_node);
+	if (!mi || mi->get_mesh().is_null() || p_collision_map.has(mi->get_mesh())) {
+		return;
+	}
+
+	// Same settings _post_fix_node() starts from, before the post import plugins get to change them.
+	String import_id = p_node->get_meta("import_id", "PATH:" + p_root->get_path_to(p_node));
+	Dictionary node_settings;
+	if (p_node_data.has(import_id)) {
+		node_settings = p_node_data[import_id];
+	}
+	if (node_settings.has("import/skip_import") && bool(node_settings["import/skip_import"])) {
+		return;
+	}
+	node_settings = node_settings.duplicate(true);
+	List<ImportOption> iopts;
+	get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH_3D_NODE, &iopts);
+	for (const ImportOption &E : iopts) {
+		if (!node_settings.has(E.option.name)) {
+			node_settings[E.option.name] = E.default_value;
+		}
+	}
+
+	if (!node_settings.has("generate/physics") || !bool(node_settings["generate/physics"])) {
+		return;
+	}
+	if (node_settings.has("physics/shape_type") && int(node_settings["physics/shape_type"]) != SHAPE_TYPE_DECOMPOSE_CONVEX) {
+		return;
+	}
+
+	PendingDecomposition decomposition;
+	decomposition.mesh = mi->get_mesh();
+	decomposition.options = _get_decomposition_options(node_settings);
+	for (const PendingDecomposition &E : r_decompositions) {
+		if (E.mesh == decomposition.mesh && E.options == decomposition.options) {
+			return;
+		}
+	}
+
+	// Create the mesh and its triangle mesh here, so the worker threads only read them.
+	decomposition.array_mesh = decomposition.mesh->get_mesh();
+	ERR_FAIL_COND(decomposition.array_mesh.is_null());
+	decomposition.array_mesh->generate_triangle_mesh();
+	r_decompositions.push_back(decomposition);
+}
+
+void ResourceImporterScene::_gen_decomposition_task(uint32_t p_index, PendingDecomposition *p_decompositions) {
+	PendingDecomposition &decomposition = p_decompositions[p_index];
+	decomposition.shapes = get_collision_shapes(decomposition.array_mesh, decomposition.options);
+}
+
+void ResourceImporterScene::_gen_decompositions(Vector<PendingDecomposition> &r_decompositions, EditorProgress &p_progress) {
+	if (r_decompositions.is_empty()) {
+		return;
+	}
+
+	if (WorkerThreadPool::get_singleton()->get_thread_index() != -1) {
+		// Waiting on the pool from one of its own threads could stall it.
+		for (int i = 0; i < r_decompositions.size(); i++) {
+			_gen_decomposition_task(i, r_decompositions.ptrw());
 		}
+		return;
 	}
+
+	const int total = r_decompositions.size();
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceImporterScene::_gen_decomposition_task, r_decompositions.ptrw(), total, -1, false, "Generate convex decompositions");
+	while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+		const int processed = WorkerThreadPool::get_singleton()->get_group_processed_element_count(group_task);
+		p_progress.step(vformat(TTR("Generating Collision Shapes... (%d/%d)"), processed, total), 1);
+		OS::get_singleton()->delay_usec(1);
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 }
 
-Node *ResourceImporterScene::_pre_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &r_collision_map, Pair<PackedVector3Array, PackedInt32Array> *r_occluder_arrays, List<Pair<NodePath, Node *>> &r_node_renames) {
+Node *ResourceImporterScene::_pre_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &r_collision_map, Pair<PackedVector3Array, PackedInt32Array> *r_occluder_arrays, List<Pair<NodePath, Node *>> &r_node_renames, Vector<PendingConvexShape> &r_pending_convex_shapes) {
 	// Children first.
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		Node *r = _pre_fix_node(p_node->get_child(i), p_root, r_collision_map, r_occluder_arrays, r_node_renames);
+		Node *r = _pre_fix_node(p_node->get_child(i), p_root, r_collision_map, r_occluder_arrays, r_node_renames, r_pending_convex_shapes);
 		if (!r) {
 			i--; // Was erased.
 		}
@@ -500,10 +621,10 @@ Node *ResourceImporterScene::_pre_fix_node(Node *p_node, Node *p_root, HashMap<R
 				if (r_collision_map.has(mesh)) {
 					shapes = r_collision_map[mesh];
 				} else if (_teststr(name, "colonly")) {
-					_pre_gen_shape_list(mesh, shapes, false);
+					_pre_gen_shape_list(mesh, shapes, false, r_pending_convex_shapes);
 					r_collision_map[mesh] = shapes;
 				} else if (_teststr(name, "convcolonly")) {
-					_pre_gen_shape_list(mesh, shapes, true);
+					_pre_gen_shape_list(mesh, shapes, true, r_pending_convex_shapes);
 					r_collision_map[mesh] = shapes;
 				}
 
@@ -562,7 +683,7 @@ Node *ResourceImporterScene::_pre_fix_node(Node *p_node, Node *p_root, HashMap<R
 			if (r_collision_map.has(mesh)) {
 				shapes = r_collision_map[mesh];
 			} else {
-				_pre_gen_shape_list(mesh, shapes, true);
+				_pre_gen_shape_list(mesh, shapes, true, r_pending_convex_shapes);
 			}
 
 			RigidDynamicBody3D *rigid_body = memnew(RigidDynamicBody3D);
@@ -588,10 +709,10 @@ Node *ResourceImporterScene::_pre_fix_node(Node *p_node, Node *p_root, HashMap<R
 			if (r_collision_map.has(mesh)) {
 				shapes = r_collision_map[mesh];
 			} else if (_teststr(name, "col")) {
-				_pre_gen_shape_list(mesh, shapes, false);
+				_pre_gen_shape_list(mesh, shapes, false, r_pending_convex_shapes);
 				r_collision_map[mesh] = shapes;
 			} else if (_teststr(name, "convcol")) {
-				_pre_gen_shape_list(mesh, shapes, true);
+				_pre_gen_shape_list(mesh, shapes, true, r_pending_convex_shapes);
 				r_collision_map[mesh] = shapes;
 			}
 
@@ -708,11 +829,11 @@ Node *ResourceImporterScene::_pre_fix_node(Node *p_node, Node *p_root, HashMap<R
 			if (r_collision_map.has(mesh)) {
 				shapes = r_collision_map[mesh];
 			} else if (_teststr(mesh->get_name(), "col")) {
-				_pre_gen_shape_list(mesh, shapes, false);
+				_pre_gen_shape_list(mesh, shapes, false, r_pending_convex_shapes);
 				r_collision_map[mesh] = shapes;
 				mesh->set_name(_fixstr(mesh->get_name(), "col"));
 			} else if (_teststr(mesh->get_name(), "convcol")) {
-				_pre_gen_shape_list(mesh, shapes, true);
+				_pre_gen_shape_list(mesh, shapes, true, r_pending_convex_shapes);
 				r_collision_map[mesh] = shapes;
 				mesh->set_name(_fixstr(mesh->get_name(), "convcol"));
 			} else if (_teststr(mesh->get_name(), "occ")) {
@@ -900,10 +1021,10 @@ Node *ResourceImporterScene::_post_fix_animations(Node *p_node, Node *p_root, co
 	return p_node;
 }
 
-Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps) {
+Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps, const Vector<PendingDecomposition> &p_decompositions) {
 	// children first
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		Node *r = _post_fix_node(p_node->get_child(i), p_root, collision_map, r_occluder_arrays, r_scanned_meshes, p_node_data, p_material_data, p_animation_data, p_animation_fps);
+		Node *r = _post_fix_node(p_node->get_child(i), p_root, collision_map, r_occluder_arrays, r_scanned_meshes, p_node_data, p_material_data, p_animation_data, p_animation_fps, p_decompositions);
 		if (!r) {
 			i--; //was erased
 		}
@@ -1044,9 +1165,20 @@ Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<
 					if (collision_map.has(m)) {
 						shapes = collision_map[m];
 					} else {
-						shapes = get_collision_shapes(
-								m->get_mesh(),
-								node_settings);
+						const Dictionary options = _get_decomposition_options(node_settings);
+						bool decomposed = false;
+						for (const PendingDecomposition &E : p_decompositions) {
+							if (E.mesh == m && E.options == options) {
+								shapes = E.shapes;
+								decomposed = true;
+								break;
+							}
+						}
+						if (!decomposed) {
+							shapes = get_collision_shapes(
+									m->get_mesh(),
+									node_settings);
+						}
 					}
 
 					if (shapes.size()) {
@@ -1450,6 +1582,7 @@ void ResourceImporterScene::get_internal_import_options(InternalImportCategory p
 			r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "save_to_file/make_streamable"), ""));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "generate/shadow_meshes", PROPERTY_HINT_ENUM, "Default,Enable,Disable"), 0));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "generate/lightmap_uv", PROPERTY_HINT_ENUM, "Default,Enable,Disable"), 0));
+			r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "generate/optimize_vertex_order", PROPERTY_HINT_ENUM, "Default,Enable,Disable"), 0));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "generate/lods", PROPERTY_HINT_ENUM, "Default,Enable,Disable"), 0));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "lods/normal_split_angle", PROPERTY_HINT_RANGE, "0,180,0.1,degrees"), 25.0f));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "lods/normal_merge_angle", PROPERTY_HINT_RANGE, "0,180,0.1,degrees"), 60.0f));
@@ -1680,7 +1813,9 @@ void ResourceImporterScene::get_import_options(const String &p_path, List<Import
 
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "nodes/root_scale", PROPERTY_HINT_RANGE, "0.001,1000,0.001"), 1.0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/ensure_tangents"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/optimize_vertex_order"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_lods"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_meshlets"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/create_shadow_meshes"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "meshes/light_baking", PROPERTY_HINT_ENUM, "Disabled,Static (VoxelGI/SDFGI),Static Lightmaps (VoxelGI/SDFGI/LightmapGI),Dynamic (VoxelGI only)", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 1));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/lightmap_texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.2));
@@ -1711,140 +1846,203 @@ void ResourceImporterScene::_replace_owner(Node *p_node, Node *p_scene, Node *p_
 	}
 }
 
-void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+void ResourceImporterScene::_pre_process_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_optimize_vertex_order, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, Vector<PendingMeshProcess> &r_meshes, HashMap<Ref<ImporterMesh>, int> &r_mesh_indices) {
 	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
-	if (src_mesh_node) {
-		//is mesh
-		MeshInstance3D *mesh_node = memnew(MeshInstance3D);
-		mesh_node->set_name(src_mesh_node->get_name());
-		mesh_node->set_transform(src_mesh_node->get_transform());
-		mesh_node->set_skin(src_mesh_node->get_skin());
-		mesh_node->set_skeleton_path(src_mesh_node->get_skeleton_path());
-		if (src_mesh_node->get_mesh().is_valid()) {
-			Ref<ArrayMesh> mesh;
-			if (!src_mesh_node->get_mesh()->has_mesh()) {
-				//do mesh processing
+	if (src_mesh_node && src_mesh_node->get_mesh().is_valid() && !src_mesh_node->get_mesh()->has_mesh() && !r_mesh_indices.has(src_mesh_node->get_mesh())) {
+		//do mesh processing
+
+		PendingMeshProcess pending;
+		pending.mesh = src_mesh_node->get_mesh();
+		pending.optimize_vertex_order = p_optimize_vertex_order;
+		pending.generate_lods = p_generate_lods;
+		pending.create_shadow_meshes = p_create_shadow_meshes;
+		pending.bake_lightmaps = p_light_bake_mode == LIGHT_BAKE_STATIC_LIGHTMAPS;
+
+		String mesh_id = src_mesh_node->get_mesh()->get_meta("import_id", src_mesh_node->get_mesh()->get_name());
+
+		if (!mesh_id.is_empty() && p_mesh_data.has(mesh_id)) {
+			Dictionary mesh_settings = p_mesh_data[mesh_id];
+			{
+				//fill node settings for this node with default values
+				List<ImportOption> iopts;
+				get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH, &iopts);
+				for (const ImportOption &E : iopts) {
+					if (!mesh_settings.has(E.option.name)) {
+						mesh_settings[E.option.name] = E.default_value;
+					}
+				}
+			}
 
-				bool generate_lods = p_generate_lods;
-				float split_angle = 25.0f;
-				float merge_angle = 60.0f;
-				bool create_shadow_meshes = p_create_shadow_meshes;
-				bool bake_lightmaps = p_light_bake_mode == LIGHT_BAKE_STATIC_LIGHTMAPS;
-				String save_to_file;
+			if (mesh_settings.has("generate/shadow_meshes")) {
+				int shadow_meshes = mesh_settings["generate/shadow_meshes"];
+				if (shadow_meshes == MESH_OVERRIDE_ENABLE) {
+					pending.create_shadow_meshes = true;
+				} else if (shadow_meshes == MESH_OVERRIDE_DISABLE) {
+					pending.create_shadow_meshes = false;
+				}
+			}
 
-				String mesh_id = src_mesh_node->get_mesh()->get_meta("import_id", src_mesh_node->get_mesh()->get_name());
+			if (mesh_settings.has("generate/lightmap_uv")) {
+				int lightmap_uv = mesh_settings["generate/lightmap_uv"];
+				if (lightmap_uv == MESH_OVERRIDE_ENABLE) {
+					pending.bake_lightmaps = true;
+				} else if (lightmap_uv == MESH_OVERRIDE_DISABLE) {
+					pending.bake_lightmaps = false;
+				}
+			}
 
-				if (!mesh_id.is_empty() && p_mesh_data.has(mesh_id)) {
-					Dictionary mesh_settings = p_mesh_data[mesh_id];
-					{
-						//fill node settings for this node with default values
-						List<ImportOption> iopts;
-						get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH, &iopts);
-						for (const ImportOption &E : iopts) {
-							if (!mesh_settings.has(E.option.name)) {
-								mesh_settings[E.option.name] = E.default_value;
-							}
-						}
-					}
+			if (mesh_settings.has("generate/optimize_vertex_order")) {
+				int optimize_vertex_order = mesh_settings["generate/optimize_vertex_order"];
+				if (optimize_vertex_order == MESH_OVERRIDE_ENABLE) {
+					pending.optimize_vertex_order = true;
+				} else if (optimize_vertex_order == MESH_OVERRIDE_DISABLE) {
+					pending.optimize_vertex_order = false;
+				}
+			}
 
-					if (mesh_settings.has("generate/shadow_meshes")) {
-						int shadow_meshes = mesh_settings["generate/shadow_meshes"];
-						if (shadow_meshes == MESH_OVERRIDE_ENABLE) {
-							create_shadow_meshes = true;
-						} else if (shadow_meshes == MESH_OVERRIDE_DISABLE) {
-							create_shadow_meshes = false;
-						}
-					}
+			if (mesh_settings.has("generate/lods")) {
+				int lods = mesh_settings["generate/lods"];
+				if (lods == MESH_OVERRIDE_ENABLE) {
+					pending.generate_lods = true;
+				} else if (lods == MESH_OVERRIDE_DISABLE) {
+					pending.generate_lods = false;
+				}
+			}
 
-					if (mesh_settings.has("generate/lightmap_uv")) {
-						int lightmap_uv = mesh_settings["generate/lightmap_uv"];
-						if (lightmap_uv == MESH_OVERRIDE_ENABLE) {
-							bake_lightmaps = true;
-						} else if (lightmap_uv == MESH_OVERRIDE_DISABLE) {
-							bake_lightmaps = false;
-						}
-					}
+			if (mesh_settings.has("lods/normal_split_angle")) {
+				pending.split_angle = mesh_settings["lods/normal_split_angle"];
+			}
 
-					if (mesh_settings.has("generate/lods")) {
-						int lods = mesh_settings["generate/lods"];
-						if (lods == MESH_OVERRIDE_ENABLE) {
-							generate_lods = true;
-						} else if (lods == MESH_OVERRIDE_DISABLE) {
-							generate_lods = false;
-						}
-					}
+			if (mesh_settings.has("lods/normal_merge_angle")) {
+				pending.merge_angle = mesh_settings["lods/normal_merge_angle"];
+			}
 
-					if (mesh_settings.has("lods/normal_split_angle")) {
-						split_angle = mesh_settings["lods/normal_split_angle"];
-					}
+			if (mesh_settings.has("save_to_file/enabled") && bool(mesh_settings["save_to_file/enabled"]) && mesh_settings.has("save_to_file/path")) {
+				pending.save_to_file = mesh_settings["save_to_file/path"];
+				if (!pending.save_to_file.is_resource_file()) {
+					pending.save_to_file = "";
+				}
+			}
 
-					if (mesh_settings.has("lods/normal_merge_angle")) {
-						merge_angle = mesh_settings["lods/normal_merge_angle"];
-					}
+			for (int i = 0; i < post_importer_plugins.size(); i++) {
+				post_importer_plugins.write[i]->internal_process(EditorScenePostImportPlugin::INTERNAL_IMPORT_CATEGORY_MESH, nullptr, src_mesh_node, src_mesh_node->get_mesh(), mesh_settings);
+			}
+		}
 
-					if (mesh_settings.has("save_to_file/enabled") && bool(mesh_settings["save_to_file/enabled"]) && mesh_settings.has("save_to_file/path")) {
-						save_to_file = mesh_settings["save_to_file/path"];
-						if (!save_to_file.is_resource_file()) {
-							save_to_file = "";
-						}
-					}
+		if (pending.bake_lightmaps) {
+			Node3D *n = src_mesh_node;
+			while (n) {
+				pending.lightmap_transform = n->get_transform() * pending.lightmap_transform;
+				n = n->get_parent_node_3d();
+			}
+		}
 
-					for (int i = 0; i < post_importer_plugins.size(); i++) {
-						post_importer_plugins.write[i]->internal_process(EditorScenePostImportPlugin::INTERNAL_IMPORT_CATEGORY_MESH, nullptr, src_mesh_node, src_mesh_node->get_mesh(), mesh_settings);
-					}
-				}
+		r_mesh_indices.insert(pending.mesh, r_meshes.size());
+		r_meshes.push_back(pending);
+	}
 
-				if (bake_lightmaps) {
-					Transform3D xf;
-					Node3D *n = src_mesh_node;
-					while (n) {
-						xf = n->get_transform() * xf;
-						n = n->get_parent_node_3d();
-					}
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_pre_process_meshes(p_node->get_child(i), p_mesh_data, p_optimize_vertex_order, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, r_meshes, r_mesh_indices);
+	}
+}
+
+void ResourceImporterScene::_lightmap_unwrap_task(uint32_t p_index, LightmapUnwrapData *p_data) {
+	PendingMeshProcess &pending = p_data->meshes[p_index];
+	if (pending.bake_lightmaps) {
+		pending.mesh->lightmap_unwrap_cached(pending.lightmap_transform, p_data->texel_size, *p_data->src_cache, pending.lightmap_cache);
+	}
+}
 
-					Vector<uint8_t> lightmap_cache;
-					src_mesh_node->get_mesh()->lightmap_unwrap_cached(xf, p_lightmap_texel_size, p_src_lightmap_cache, lightmap_cache);
+void ResourceImporterScene::_lightmap_unwrap_meshes(Vector<PendingMeshProcess> &r_meshes, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+	LightmapUnwrapData data;
+	data.meshes = r_meshes.ptrw();
+	data.texel_size = p_lightmap_texel_size;
+	data.src_cache = &p_src_lightmap_cache;
 
-					if (!lightmap_cache.is_empty()) {
-						if (r_lightmap_caches.is_empty()) {
-							r_lightmap_caches.push_back(lightmap_cache);
-						} else {
-							String new_md5 = String::md5(lightmap_cache.ptr()); // MD5 is stored at the beginning of the cache data
+	// Every mesh is unwrapped into its own atlas, so they don't depend on each other.
+	if (r_meshes.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceImporterScene::_lightmap_unwrap_task, &data, r_meshes.size(), -1, true, "Unwrap lightmap UVs");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < r_meshes.size(); i++) {
+			_lightmap_unwrap_task(i, &data);
+		}
+	}
 
-							for (int i = 0; i < r_lightmap_caches.size(); i++) {
-								String md5 = String::md5(r_lightmap_caches[i].ptr());
-								if (new_md5 < md5) {
-									r_lightmap_caches.insert(i, lightmap_cache);
-									break;
-								}
+	// Keep the cache entries sorted by hash, in the same order regardless of which mesh finished first.
+	for (const PendingMeshProcess &E : r_meshes) {
+		const Vector<uint8_t> &lightmap_cache = E.lightmap_cache;
+		if (lightmap_cache.is_empty()) {
+			continue;
+		}
 
-								if (new_md5 == md5) {
-									break;
-								}
-							}
-						}
-					}
+		String new_md5 = String::md5(lightmap_cache.ptr()); // MD5 is stored at the beginning of the cache data
+
+		bool found = false;
+		for (int i = 0; i < r_lightmap_caches.size(); i++) {
+			String md5 = String::md5(r_lightmap_caches[i].ptr());
+			if (new_md5 < md5) {
+				r_lightmap_caches.insert(i, lightmap_cache);
+				found = true;
+				break;
+			}
+
+			if (new_md5 == md5) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found) {
+			r_lightmap_caches.push_back(lightmap_cache);
+		}
+	}
+}
+
+void ResourceImporterScene::_generate_meshes(Node *p_node, const Vector<PendingMeshProcess> &p_meshes, const HashMap<Ref<ImporterMesh>, int> &p_mesh_indices, bool p_generate_meshlets, LightBakeMode p_light_bake_mode) {
+	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
+	if (src_mesh_node) {
+		//is mesh
+		MeshInstance3D *mesh_node = memnew(MeshInstance3D);
+		mesh_node->set_name(src_mesh_node->get_name());
+		mesh_node->set_transform(src_mesh_node->get_transform());
+		mesh_node->set_skin(src_mesh_node->get_skin());
+		mesh_node->set_skeleton_path(src_mesh_node->get_skeleton_path());
+		if (src_mesh_node->get_mesh().is_valid()) {
+			Ref<ArrayMesh> mesh;
+			const int *pending_index = p_mesh_indices.getptr(src_mesh_node->get_mesh());
+			if (!src_mesh_node->get_mesh()->has_mesh() && pending_index) {
+				// Finish the processing started in _pre_process_meshes(), the lightmap UVs are already unwrapped.
+				const PendingMeshProcess &pending = p_meshes[*pending_index];
+
+				// Before the LODs and meshlets, which keep the order of the vertices and triangles.
+				if (pending.optimize_vertex_order) {
+					src_mesh_node->get_mesh()->optimize_vertex_order();
+				}
+
+				if (pending.generate_lods) {
+					src_mesh_node->get_mesh()->generate_lods(pending.merge_angle, pending.split_angle);
 				}
 
-				if (generate_lods) {
-					src_mesh_node->get_mesh()->generate_lods(merge_angle, split_angle);
+				if (p_generate_meshlets) {
+					src_mesh_node->get_mesh()->generate_meshlets();
 				}
 
-				if (create_shadow_meshes) {
+				if (pending.create_shadow_meshes) {
 					src_mesh_node->get_mesh()->create_shadow_mesh();
 				}
 
-				if (!save_to_file.is_empty()) {
-					Ref<Mesh> existing = ResourceCache::get_ref(save_to_file);
+				if (!pending.save_to_file.is_empty()) {
+					Ref<Mesh> existing = ResourceCache::get_ref(pending.save_to_file);
 					if (existing.is_valid()) {
 						//if somehow an existing one is useful, create
 						existing->reset_state();
 					}
 					mesh = src_mesh_node->get_mesh()->get_mesh(existing);
 
-					ResourceSaver::save(save_to_file, mesh); //override
+					ResourceSaver::save(pending.save_to_file, mesh); //override
 
-					mesh->set_path(save_to_file, true); //takeover existing, if needed
+					mesh->set_path(pending.save_to_file, true); //takeover existing, if needed
 
 				} else {
 					mesh = src_mesh_node->get_mesh()->get_mesh();
@@ -1880,7 +2078,7 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_m
 	}
 
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
+		_generate_meshes(p_node->get_child(i), p_meshes, p_mesh_indices, p_generate_meshlets, p_light_bake_mode);
 	}
 }
 
@@ -2083,7 +2281,9 @@ Node *ResourceImporterScene::pre_import(const String &p_source_file, const HashM
 
 	HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> collision_map;
 	List<Pair<NodePath, Node *>> node_renames;
-	_pre_fix_node(scene, scene, collision_map, nullptr, node_renames);
+	Vector<PendingConvexShape> pending_convex_shapes;
+	_pre_fix_node(scene, scene, collision_map, nullptr, node_renames, pending_convex_shapes);
+	_gen_pending_convex_shapes(pending_convex_shapes);
 
 	return scene;
 }
@@ -2165,15 +2365,21 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> collision_map;
 	Pair<PackedVector3Array, PackedInt32Array> occluder_arrays;
 	List<Pair<NodePath, Node *>> node_renames;
+	Vector<PendingConvexShape> pending_convex_shapes;
 
-	_pre_fix_node(scene, scene, collision_map, &occluder_arrays, node_renames);
+	_pre_fix_node(scene, scene, collision_map, &occluder_arrays, node_renames, pending_convex_shapes);
+	_gen_pending_convex_shapes(pending_convex_shapes);
 
 	for (int i = 0; i < post_importer_plugins.size(); i++) {
 		post_importer_plugins.write[i]->pre_process(scene, p_options);
 	}
 
+	Vector<PendingDecomposition> decompositions;
+	_pre_gen_decompositions(scene, scene, node_data, collision_map, decompositions);
+	_gen_decompositions(decompositions, progress);
+
 	_pre_fix_animations(scene, scene, node_data, animation_data, fps);
-	_post_fix_node(scene, scene, collision_map, occluder_arrays, scanned_meshes, node_data, material_data, animation_data, fps);
+	_post_fix_node(scene, scene, collision_map, occluder_arrays, scanned_meshes, node_data, material_data, animation_data, fps, decompositions);
 	_post_fix_animations(scene, scene, node_data, animation_data, fps);
 
 	String root_type = p_options["nodes/root_type"];
@@ -2220,7 +2426,9 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 		occluder_instance->set_owner(scene);
 	}
 
+	bool optimize_vertex_order = bool(p_options["meshes/optimize_vertex_order"]);
 	bool gen_lods = bool(p_options["meshes/generate_lods"]);
+	bool gen_meshlets = bool(p_options["meshes/generate_meshlets"]);
 	bool create_shadow_meshes = bool(p_options["meshes/create_shadow_meshes"]);
 	int light_bake_mode = p_options["meshes/light_baking"];
 	float texel_size = p_options["meshes/lightmap_texel_size"];
@@ -2240,7 +2448,11 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	if (subresources.has("meshes")) {
 		mesh_data = subresources["meshes"];
 	}
-	_generate_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
+	Vector<PendingMeshProcess> pending_meshes;
+	HashMap<Ref<ImporterMesh>, int> pending_mesh_indices;
+	_pre_process_meshes(scene, mesh_data, optimize_vertex_order, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), pending_meshes, pending_mesh_indices);
+	_lightmap_unwrap_meshes(pending_meshes, lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
+	_generate_meshes(scene, pending_meshes, pending_mesh_indices, gen_meshlets, LightBakeMode(light_bake_mode));
 
 	if (mesh_lightmap_caches.size()) {
 		Ref<FileAccess> f = FileAccess::open(p_source_file + ".unwrap_cache", FileAccess::WRITE);
@@ -42,6 +42,7 @@
 
 class Material;
 class AnimationPlayer;
+struct EditorProgress;
 
 class ImporterMesh;
 class EditorSceneFormatImporter : public RefCounted {
@@ -209,9 +210,55 @@ class ResourceImporterScene : public ResourceImporter {
 	};
 
 	void _replace_owner(Node *p_node, Node *p_scene, Node *p_new_owner);
-	void _generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
+	// Settings of a mesh to generate, gathered before the meshes are generated so their lightmap UVs can be unwrapped in parallel.
+	struct PendingMeshProcess {
+		Ref<ImporterMesh> mesh;
+		bool optimize_vertex_order = false;
+		bool generate_lods = false;
+		float split_angle = 25.0f;
+		float merge_angle = 60.0f;
+		bool create_shadow_meshes = false;
+		bool bake_lightmaps = false;
+		String save_to_file;
+		Transform3D lightmap_transform;
+		Vector<uint8_t> lightmap_cache;
+	};
+
+	struct LightmapUnwrapData {
+		PendingMeshProcess *meshes = nullptr;
+		float texel_size = 0.0f;
+		const Vector<uint8_t> *src_cache = nullptr;
+	};
+
+	void _pre_process_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_optimize_vertex_order, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, Vector<PendingMeshProcess> &r_meshes, HashMap<Ref<ImporterMesh>, int> &r_mesh_indices);
+	void _lightmap_unwrap_task(uint32_t p_index, LightmapUnwrapData *p_data);
+	void _lightmap_unwrap_meshes(Vector<PendingMeshProcess> &r_meshes, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
+	void _generate_meshes(Node *p_node, const Vector<PendingMeshProcess> &p_meshes, const HashMap<Ref<ImporterMesh>, int> &p_mesh_indices, bool p_generate_meshlets, LightBakeMode p_light_bake_mode);
 	void _add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes);
 
+	// Convex shapes are created empty while walking the scene, and their hulls are computed together afterwards.
+	struct PendingConvexShape {
+		Ref<Shape3D> shape;
+		Vector<Vector3> points;
+	};
+
+	static void _pre_gen_shape_list(Ref<ImporterMesh> &mesh, Vector<Ref<Shape3D>> &r_shape_list, bool p_convex, Vector<PendingConvexShape> &r_pending_convex_shapes);
+	static void _gen_pending_convex_shapes(Vector<PendingConvexShape> &r_pending_convex_shapes);
+
+	// Convex decompositions are slow, so the ones the node settings ask for are all computed on the worker threads
+	// before the nodes are fixed up, then picked up by meshes whose settings still match.
+	struct PendingDecomposition {
+		Ref<ImporterMesh> mesh;
+		Ref<Mesh> array_mesh;
+		Dictionary options;
+		Vector<Ref<Shape3D>> shapes;
+	};
+
+	static Dictionary _get_decomposition_options(const Dictionary &p_node_settings);
+	void _pre_gen_decompositions(Node *p_node, Node *p_root, const Dictionary &p_node_data, const HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &p_collision_map, Vector<PendingDecomposition> &r_decompositions);
+	void _gen_decomposition_task(uint32_t p_index, PendingDecomposition *p_decompositions);
+	void _gen_decompositions(Vector<PendingDecomposition> &r_decompositions, EditorProgress &p_progress);
+
 	enum AnimationImportTracks {
 		ANIMATION_IMPORT_TRACKS_IF_PRESENT,
 		ANIMATION_IMPORT_TRACKS_IF_PRESENT_FOR_ALL,
@@ -273,9 +320,9 @@ public:
 	// Import scenes *after* everything else (such as textures).
 	virtual int get_import_order() const override { return ResourceImporter::IMPORT_ORDER_SCENE; }
 
-	Node *_pre_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &r_collision_map, Pair<PackedVector3Array, PackedInt32Array> *r_occluder_arrays, List<Pair<NodePath, Node *>> &r_node_renames);
+	Node *_pre_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &r_collision_map, Pair<PackedVector3Array, PackedInt32Array> *r_occluder_arrays, List<Pair<NodePath, Node *>> &r_node_renames, Vector<PendingConvexShape> &r_pending_convex_shapes);
 	Node *_pre_fix_animations(Node *p_node, Node *p_root, const Dictionary &p_node_data, const Dictionary &p_animation_data, float p_animation_fps);
-	Node *_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps);
+	Node *_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps, const Vector<PendingDecomposition> &p_decompositions);
 	Node *_post_fix_animations(Node *p_node, Node *p_root, const Dictionary &p_node_data, const Dictionary &p_animation_data, float p_animation_fps);
 
 	Ref<Animation> _save_animation_to_file(Ref<Animation> anim, bool p_save_to_file, String p_save_to_path, bool p_keep_custom_tracks);
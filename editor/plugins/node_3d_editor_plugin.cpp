@@ -2638,6 +2638,18 @@ void Node3DEditorViewport::_notification(int p_what) {
 						frame_time_gradient->get_color_at_offset(
 								Math::range_lerp(gpu_time, 0, 30, 0, 1)));
 
+				// Break the GPU time down per render pass in the tooltip (not averaged, as passes come and go).
+				Array passes = RS::get_singleton()->viewport_get_measured_render_passes(viewport->get_viewport_rid());
+				String passes_text;
+				for (int i = 0; i < passes.size(); i++) {
+					Dictionary pass = passes[i];
+					if (!passes_text.is_empty()) {
+						passes_text += "\n";
+					}
+					passes_text += String("    ").repeat(pass["depth"]) + vformat(TTR("%s: %s ms"), pass["name"], rtos(pass["gpu_msec"]).pad_decimals(2));
+				}
+				gpu_time_label->set_tooltip(passes_text);
+
 				const double fps = 1000.0 / gpu_time;
 				fps_label->set_text(vformat(TTR("FPS: %d"), fps));
 				// Middle point is at 60 FPS.
@@ -4724,6 +4736,7 @@ Node3DEditorViewport::Node3DEditorViewport(Node3DEditor *p_spatial_editor, int p
 
 	gpu_time_label = memnew(Label);
 	top_right_vbox->add_child(gpu_time_label);
+	gpu_time_label->set_mouse_filter(MOUSE_FILTER_PASS); // For the render pass breakdown in the tooltip.
 	gpu_time_label->hide();
 
 	fps_label = memnew(Label);
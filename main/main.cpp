@@ -47,6 +47,7 @@
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
+#include "core/os/profiling.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
 #include "core/string/translation.h"
@@ -55,6 +56,7 @@
 #include "main/app_icon.gen.h"
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
+#include "main/scene_benchmark.h"
 #include "main/splash.gen.h"
 #include "modules/register_module_types.h"
 #include "platform/register_platform_apis.h"
@@ -183,8 +185,14 @@ static bool disable_render_loop = false;
 static int fixed_fps = -1;
 static String write_movie_path;
 static MovieWriter *movie_writer = nullptr;
+static String benchmark_scene_path;
+static String benchmark_output_path = "benchmark.json";
+static int benchmark_frames = 1000;
+static int benchmark_warmup_frames = 60;
+static SceneBenchmark *scene_benchmark = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static bool predictive_frame_pacing = false;
 #ifdef TOOLS_ENABLED
 static bool dump_extension_api = false;
 #endif
@@ -361,6 +369,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --debug-paths                                Show path lines when running the scene.\n");
 	OS::get_singleton()->print("  --debug-navigation                           Show navigation polygons when running the scene.\n");
 	OS::get_singleton()->print("  --debug-stringnames                          Print all StringName allocations to stdout when the engine quits.\n");
+	OS::get_singleton()->print("  --debug-allocations <interval>               Sample the call stack of one in every <interval> allocations, and print the top allocation sites to stdout when the engine quits.\n");
 #endif
 	OS::get_singleton()->print("  --frame-delay <ms>                           Simulate high CPU load (delay each frame by <ms> milliseconds).\n");
 	OS::get_singleton()->print("  --time-scale <scale>                         Force time scale (higher values are faster, 1.0 is normal speed).\n");
@@ -368,6 +377,10 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --disable-crash-handler                      Disable crash handler when supported by the platform code.\n");
 	OS::get_singleton()->print("  --fixed-fps <fps>                            Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	OS::get_singleton()->print("  --print-fps                                  Print the frames per second to the stdout.\n");
+	OS::get_singleton()->print("  --benchmark-scene <scene>                    Run the scene at a fixed FPS without V-Sync, then write its frame statistics to a JSON file and quit.\n");
+	OS::get_singleton()->print("  --benchmark-frames <count>                   Number of frames to record with --benchmark-scene (default: 1000).\n");
+	OS::get_singleton()->print("  --benchmark-warmup <count>                   Number of frames to run before recording with --benchmark-scene (default: 60).\n");
+	OS::get_singleton()->print("  --benchmark-output <file>                    Path of the JSON file written by --benchmark-scene (default: benchmark.json).\n");
 	OS::get_singleton()->print("\n");
 
 	OS::get_singleton()->print("Standalone tools:\n");
@@ -386,6 +399,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --dump-extension-api                         Generate JSON dump of the Godot API for GDExtension bindings named 'extension_api.json' in the current folder.\n");
 #ifdef TESTS_ENABLED
 	OS::get_singleton()->print("  --test [--help]                              Run unit tests. Use --test --help for more information.\n");
+	OS::get_singleton()->print("  --test --benchmark [--help]                  Run microbenchmarks. Use --test --benchmark --help for more information.\n");
 #endif
 #endif
 	OS::get_singleton()->print("\n");
@@ -586,12 +600,18 @@ int Main::test_entrypoint(int argc, char *argv[], bool &tests_need_run) {
  */
 
 Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_phase) {
+	profiling_initialize();
+
 	OS::get_singleton()->initialize();
 
 	engine = memnew(Engine);
 
 	MAIN_PRINT("Main: Initialize CORE");
 
+	// Classes only run their _bind_methods() once something about them is first looked up,
+	// which saves binding the many classes a game never touches.
+	ClassDB::set_lazy_binding(true);
+
 	register_core_types();
 	register_core_driver_types();
 
@@ -1128,6 +1148,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			debug_navigation = true;
 		} else if (I->get() == "--debug-stringnames") {
 			StringName::set_debug_stringnames(true);
+		} else if (I->get() == "--debug-allocations") {
+			if (I->next()) {
+				Memory::set_allocation_sampling(MAX(I->next()->get().to_int(), 1));
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing debug-allocations argument, aborting.\n");
+				goto error;
+			}
 #endif
 		} else if (I->get() == "--remote-debug") {
 			if (I->next()) {
@@ -1172,6 +1200,43 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				OS::get_singleton()->print("Missing write-movie argument, aborting.\n");
 				goto error;
 			}
+		} else if (I->get() == "--benchmark-scene") {
+			if (I->next()) {
+				benchmark_scene_path = I->next()->get();
+				N = I->next()->next();
+				// Frames advance by a fixed step as fast as they can be drawn, so runs are deterministic and comparable.
+				if (fixed_fps == -1) {
+					fixed_fps = 60;
+				}
+				disable_vsync = true;
+			} else {
+				OS::get_singleton()->print("Missing benchmark-scene argument, aborting.\n");
+				goto error;
+			}
+		} else if (I->get() == "--benchmark-frames") {
+			if (I->next()) {
+				benchmark_frames = I->next()->get().to_int();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing benchmark-frames argument, aborting.\n");
+				goto error;
+			}
+		} else if (I->get() == "--benchmark-warmup") {
+			if (I->next()) {
+				benchmark_warmup_frames = I->next()->get().to_int();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing benchmark-warmup argument, aborting.\n");
+				goto error;
+			}
+		} else if (I->get() == "--benchmark-output") {
+			if (I->next()) {
+				benchmark_output_path = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing benchmark-output argument, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--disable-vsync") {
 			disable_vsync = true;
 		} else if (I->get() == "--print-fps") {
@@ -1249,6 +1314,13 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 					"memory/limits/multithreaded_server/rid_pool_prealloc",
 					PROPERTY_HINT_RANGE,
 					"0,500,1")); // No negative and limit to 500 due to crashes
+	GLOBAL_DEF("memory/limits/resource_cache/retain_budget_mb", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/resource_cache/retain_budget_mb",
+			PropertyInfo(Variant::INT,
+					"memory/limits/resource_cache/retain_budget_mb",
+					PROPERTY_HINT_RANGE,
+					"0,65536,1,or_greater"));
+	ResourceCache::set_retain_budget(uint64_t(int(GLOBAL_GET("memory/limits/resource_cache/retain_budget_mb"))) * 1024 * 1024);
 	GLOBAL_DEF("network/limits/debugger/max_chars_per_second", 32768);
 	ProjectSettings::get_singleton()->set_custom_property_info("network/limits/debugger/max_chars_per_second",
 			PropertyInfo(Variant::INT,
@@ -1492,6 +1564,16 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	// list from the display driver for the editor UI.
 	OS::get_singleton()->set_display_driver_id(display_driver_idx);
 
+	// Headless projects (dedicated servers) never draw or play what they load, so they can skip keeping it.
+	if (bool(GLOBAL_DEF("application/run/strip_payloads_when_headless", false)) && !editor && !project_manager && String("headless") == DisplayServer::get_create_function_name(display_driver_idx)) {
+		ResourceLoader::set_strip_payloads(true);
+	}
+
+	// Not in the editor, which saves sub-resources back to the file that owns them.
+	if (bool(GLOBAL_DEF("application/run/deduplicate_sub_resources", false)) && !editor && !project_manager) {
+		ResourceLoader::set_deduplicate_sub_resources(true);
+	}
+
 	GLOBAL_DEF_RST_NOVAL("audio/driver/driver", AudioDriverManager::get_driver(0)->get_name());
 	if (audio_driver.is_empty()) { // Specified in project.godot.
 		audio_driver = GLOBAL_GET("audio/driver/driver");
@@ -1585,6 +1667,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GLOBAL_DEF_BASIC("xr/openxr/reference_space", "1");
 	ProjectSettings::get_singleton()->set_custom_property_info("xr/openxr/reference_space", PropertyInfo(Variant::INT, "xr/openxr/reference_space", PROPERTY_HINT_ENUM, "Local,Stage"));
 
+	GLOBAL_DEF_BASIC("xr/openxr/late_latching", false);
+
 #ifdef TOOLS_ENABLED
 	// Disabled for now, using XR inside of the editor we'll be working on during the coming months.
 
@@ -1595,6 +1679,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 
 	Engine::get_singleton()->set_frame_delay(frame_delay);
 
+	predictive_frame_pacing = GLOBAL_DEF("application/run/predictive_frame_pacing", false);
+
 	message_queue = memnew(MessageQueue);
 
 	if (p_second_phase) {
@@ -1610,6 +1696,7 @@ error:
 	audio_driver = "";
 	tablet_driver = "";
 	write_movie_path = "";
+	benchmark_scene_path = "";
 	project_path = "";
 
 	args.clear();
@@ -1976,6 +2063,9 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	}
 	ProjectSettings::get_singleton()->set_custom_property_info("internationalization/rendering/text_driver", PropertyInfo(Variant::STRING, "internationalization/rendering/text_driver", PROPERTY_HINT_ENUM, text_driver_options));
 
+	// Read by the text servers when they are created, before this.
+	GLOBAL_DEF_RST("gui/fonts/glyph_disk_cache", false);
+
 	/* Determine text driver */
 	if (text_driver.is_empty()) {
 		text_driver = GLOBAL_GET("internationalization/rendering/text_driver");
@@ -2031,6 +2121,11 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 
 #endif
 
+	if (editor || project_manager) {
+		// The editor lists the whole API anyway (docs, autocompletion, create dialogs), bind it all upfront.
+		ClassDB::set_lazy_binding(false);
+	}
+
 	MAIN_PRINT("Main: Load Modules");
 
 	register_platform_apis();
@@ -2233,6 +2328,8 @@ bool Main::start() {
 		GLOBAL_DEF("mono/runtime/unhandled_exception_policy", 0);
 #endif
 
+		ClassDB::set_lazy_binding(false);
+
 		Error err;
 		DocTools doc;
 		doc.generate(doc_base);
@@ -2293,6 +2390,7 @@ bool Main::start() {
 	}
 
 	if (dump_extension_api) {
+		ClassDB::set_lazy_binding(false);
 		NativeExtensionAPIDump::generate_extension_json_file("extension_api.json");
 		return false;
 	}
@@ -2310,6 +2408,10 @@ bool Main::start() {
 
 #endif
 
+	if (!benchmark_scene_path.is_empty()) {
+		game_path = benchmark_scene_path;
+	}
+
 	if (script.is_empty() && game_path.is_empty() && String(GLOBAL_GET("application/run/main_scene")) != "") {
 		game_path = GLOBAL_GET("application/run/main_scene");
 	}
@@ -2439,12 +2541,22 @@ bool Main::start() {
 					}
 				}
 
+				//start loading all of them at once on threads, they are still instantiated and added in order below
+				HashSet<StringName> loading_threaded;
+				if (GLOBAL_DEF("application/run/load_autoloads_in_parallel", false)) {
+					for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : autoloads) {
+						if (ResourceLoader::load_threaded_request(E.value.path, "", true) == OK) {
+							loading_threaded.insert(E.key);
+						}
+					}
+				}
+
 				//second pass, load into global constants
 				List<Node *> to_add;
 				for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : autoloads) {
 					const ProjectSettings::AutoloadInfo &info = E.value;
 
-					Ref<Resource> res = ResourceLoader::load(info.path);
+					Ref<Resource> res = loading_threaded.has(E.key) ? ResourceLoader::load_threaded_get(info.path) : ResourceLoader::load(info.path);
 					ERR_CONTINUE_MSG(res.is_null(), "Can't autoload: " + info.path);
 					Node *n = nullptr;
 					Ref<PackedScene> scn = res;
@@ -2727,6 +2839,11 @@ bool Main::start() {
 		movie_writer->begin(DisplayServer::get_singleton()->window_get_size(), fixed_fps, write_movie_path);
 	}
 
+	if (!benchmark_scene_path.is_empty() && !editor && !project_manager) {
+		scene_benchmark = memnew(SceneBenchmark);
+		scene_benchmark->begin(benchmark_scene_path, benchmark_frames, benchmark_warmup_frames, benchmark_output_path);
+	}
+
 	if (minimum_time_msec) {
 		uint64_t minimum_time = 1000 * minimum_time_msec;
 		uint64_t elapsed_time = OS::get_singleton()->get_ticks_usec();
@@ -2738,6 +2855,50 @@ bool Main::start() {
 	return true;
 }
 
+/* Predictive frame pacing
+ *
+ * When a frame is ready before the display can show it, presenting it blocks until a swapchain image is free.
+ * Input read at the start of that frame is then older than it needs to be, so the time spent blocked is instead
+ * slept before the next frame starts (and reads input), keeping a small margin in case the frame takes longer.
+ */
+
+static uint64_t frame_pacing_sleep_usec = 0;
+static uint64_t frame_pacing_frames_drawn = 0;
+
+#define FRAME_PACING_MARGIN_USEC 1000
+
+static void _frame_pacing_delay(uint64_t p_frame_usec) {
+	const uint64_t frames_drawn = Engine::get_singleton()->get_frames_drawn();
+	if (frames_drawn == frame_pacing_frames_drawn) {
+		return; // Nothing was presented, so there is nothing to measure.
+	}
+	frame_pacing_frames_drawn = frames_drawn;
+
+	const uint64_t wait = RenderingServer::get_singleton()->get_frame_present_wait_usec();
+	if (wait > FRAME_PACING_MARGIN_USEC) {
+		// Move only half of the slack each frame, so a single fast frame doesn't make the next ones late.
+		frame_pacing_sleep_usec += (wait - FRAME_PACING_MARGIN_USEC) / 2;
+	} else {
+		// Getting close to missing the display refresh, back off right away.
+		const uint64_t overshoot = FRAME_PACING_MARGIN_USEC - wait;
+		frame_pacing_sleep_usec = frame_pacing_sleep_usec > overshoot ? frame_pacing_sleep_usec - overshoot : 0;
+	}
+
+	// Never sleep for more than what the frame leaves of a refresh period, even when the wait can't be measured reliably.
+	const float refresh_rate = DisplayServer::get_singleton()->screen_get_refresh_rate();
+	uint64_t work_usec = p_frame_usec > wait ? p_frame_usec - wait : 0;
+	uint64_t period_usec = refresh_rate > 0 ? uint64_t(1000000.0 / refresh_rate) : 0;
+	if (period_usec <= work_usec + FRAME_PACING_MARGIN_USEC) {
+		frame_pacing_sleep_usec = 0;
+	} else {
+		frame_pacing_sleep_usec = MIN(frame_pacing_sleep_usec, period_usec - work_usec - FRAME_PACING_MARGIN_USEC);
+	}
+
+	if (frame_pacing_sleep_usec > 0) {
+		OS::get_singleton()->delay_usec(frame_pacing_sleep_usec);
+	}
+}
+
 /* Main iteration
  *
  * This is the iteration of the engine's game loop, advancing the state of physics,
@@ -2756,6 +2917,10 @@ bool Main::force_redraw_requested = false;
 int Main::iterating = 0;
 bool Main::agile_input_event_flushing = false;
 
+// Sums of the intervals between the frames of the current second and of their squares, for the frame time jitter.
+static double frame_interval_sum = 0.0;
+static double frame_interval_squared_sum = 0.0;
+
 bool Main::is_iterating() {
 	return iterating > 0;
 }
@@ -2768,6 +2933,8 @@ bool Main::iteration() {
 	//for now do not error on this
 	//ERR_FAIL_COND_V(iterating, false);
 
+	PROFILE_ZONE("Main::iteration");
+
 	iterating++;
 
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
@@ -2816,6 +2983,9 @@ bool Main::iteration() {
 
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
 
+		// Transforms set from here on are the ones of the new tick, physics interpolation draws between them and the previous ones.
+		RenderingServer::get_singleton()->tick();
+
 		PhysicsServer3D::get_singleton()->sync();
 		PhysicsServer3D::get_singleton()->flush_queries();
 
@@ -2890,6 +3060,14 @@ bool Main::iteration() {
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
+	PROFILE_FRAME_MARK;
+
+	frame_interval_sum += double(ticks_elapsed);
+	frame_interval_squared_sum += double(ticks_elapsed) * double(ticks_elapsed);
+
+	FrameAllocator::end_frame();
+	Memory::end_frame();
+
 	if (frame > 1000000) {
 		// Wait a few seconds before printing FPS, as FPS reporting just after the engine has started is inaccurate.
 		if (hide_print_fps_attempts == 0) {
@@ -2905,6 +3083,14 @@ bool Main::iteration() {
 		}
 
 		Engine::get_singleton()->_fps = frames;
+
+		// Standard deviation of the frame intervals over the last second.
+		const double interval_mean = frame_interval_sum / frames;
+		const double interval_variance = frame_interval_squared_sum / frames - interval_mean * interval_mean;
+		Engine::get_singleton()->_frame_time_jitter = USEC_TO_SEC(Math::sqrt(MAX(interval_variance, 0.0)));
+		frame_interval_sum = 0.0;
+		frame_interval_squared_sum = 0.0;
+
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
 		process_max = 0;
@@ -2928,12 +3114,20 @@ bool Main::iteration() {
 		movie_writer->add_frame(vp_tex);
 	}
 
+	if (scene_benchmark && scene_benchmark->add_frame(frame_time, process_ticks, physics_process_ticks)) {
+		exit = true;
+	}
+
 	if (fixed_fps != -1) {
 		return exit;
 	}
 
 	OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw());
 
+	if (predictive_frame_pacing) {
+		_frame_pacing_delay(frame_time);
+	}
+
 #ifdef TOOLS_ENABLED
 	if (auto_build_solutions) {
 		auto_build_solutions = false;
@@ -2971,6 +3165,16 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	if (scene_benchmark) {
+		memdelete(scene_benchmark);
+		scene_benchmark = nullptr;
+	}
+
+	if (Memory::get_allocation_sampling()) {
+		Memory::set_allocation_sampling(0);
+		Memory::print_allocation_sites();
+	}
+
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
 
@@ -2979,6 +3183,8 @@ void Main::cleanup(bool p_force) {
 
 	OS::get_singleton()->delete_main_loop();
 
+	ResourceCache::clear_retained();
+
 	OS::get_singleton()->_cmdline.clear();
 	OS::get_singleton()->_execpath = "";
 	OS::get_singleton()->_local_clipboard = "";
@@ -73,6 +73,14 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO);
+	BIND_ENUM_CONSTANT(OBJECT_RETAINED_RESOURCE_COUNT);
+	BIND_ENUM_CONSTANT(MEMORY_RETAINED_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_PER_FRAME);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATED_BYTES_PER_FRAME);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -112,6 +120,14 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/driver/output_latency",
+		"memory/rendering",
+		"memory/resources",
+		"memory/script",
+		"memory/audio",
+		"object/retained_resources",
+		"memory/retained_resources",
+		"memory/allocations_per_frame",
+		"memory/allocated_per_frame",
 
 	};
 
@@ -166,6 +182,22 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case MEMORY_RENDERING:
+			return Memory::get_tag_usage(Memory::TAG_RENDERING);
+		case MEMORY_RESOURCES:
+			return Memory::get_tag_usage(Memory::TAG_RESOURCES);
+		case MEMORY_SCRIPT:
+			return Memory::get_tag_usage(Memory::TAG_SCRIPT);
+		case MEMORY_AUDIO:
+			return Memory::get_tag_usage(Memory::TAG_AUDIO);
+		case OBJECT_RETAINED_RESOURCE_COUNT:
+			return ResourceCache::get_retained_count();
+		case MEMORY_RETAINED_RESOURCES:
+			return ResourceCache::get_retained_cost();
+		case MEMORY_ALLOCATIONS_PER_FRAME:
+			return Memory::get_frame_allocation_count();
+		case MEMORY_ALLOCATED_BYTES_PER_FRAME:
+			return Memory::get_frame_allocated_bytes();
 
 		default: {
 		}
@@ -201,6 +233,14 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -87,6 +87,14 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		MEMORY_RENDERING,
+		MEMORY_RESOURCES,
+		MEMORY_SCRIPT,
+		MEMORY_AUDIO,
+		OBJECT_RETAINED_RESOURCE_COUNT,
+		MEMORY_RETAINED_RESOURCES,
+		MEMORY_ALLOCATIONS_PER_FRAME,
+		MEMORY_ALLOCATED_BYTES_PER_FRAME,
 		MONITOR_MAX
 	};
 
@@ -0,0 +1,195 @@
+/*************************************************************************/
+/*  scene_benchmark.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "scene_benchmark.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/memory.h"
+#include "core/os/os.h"
+#include "core/templates/sort_array.h"
+#include "core/version.h"
+#include "servers/display_server.h"
+#include "servers/rendering_server.h"
+
+void SceneBenchmark::begin(const String &p_scene_path, int p_frame_count, int p_warmup_frames, const String &p_output_path) {
+	scene_path = p_scene_path;
+	frame_count = MAX(p_frame_count, 1);
+	warmup_frames = MAX(p_warmup_frames, 0);
+	output_path = p_output_path;
+	frames_skipped = 0;
+	frames.clear();
+	frames.reserve(frame_count);
+	begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	viewport = RenderingServer::get_singleton()->viewport_find_from_screen_attachment(DisplayServer::MAIN_WINDOW_ID);
+	if (viewport.is_valid()) {
+		RenderingServer::get_singleton()->viewport_set_measure_render_time(viewport, true);
+	}
+
+	print_line(vformat("Benchmarking \"%s\" for %d frames after %d warmup frames.", scene_path, frame_count, warmup_frames));
+}
+
+bool SceneBenchmark::add_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_step_usec) {
+	// The first frames compile shaders and upload resources, which would skew the results.
+	if (frames_skipped < warmup_frames) {
+		frames_skipped++;
+		begin_usec = OS::get_singleton()->get_ticks_usec();
+		return false;
+	}
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	FrameStats stats;
+	stats.frame_usec = p_frame_usec;
+	stats.process_usec = p_process_usec;
+	stats.physics_step_usec = p_physics_step_usec;
+	if (viewport.is_valid()) {
+		// Measured on previous frames, as the GPU lags behind.
+		stats.render_cpu_msec = rs->viewport_get_measured_render_time_cpu(viewport);
+		stats.render_gpu_msec = rs->viewport_get_measured_render_time_gpu(viewport);
+	}
+	stats.objects = rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME);
+	stats.primitives = rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_PRIMITIVES_IN_FRAME);
+	stats.draw_calls = rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME);
+	frames.push_back(stats);
+
+	if (int(frames.size()) < frame_count) {
+		return false;
+	}
+
+	_write_results();
+	return true;
+}
+
+Dictionary SceneBenchmark::_make_summary(LocalVector<double> &p_values) {
+	Dictionary summary;
+	if (p_values.is_empty()) {
+		return summary;
+	}
+
+	SortArray<double> sorter;
+	sorter.sort(p_values.ptr(), p_values.size());
+
+	double sum = 0.0;
+	for (uint32_t i = 0; i < p_values.size(); i++) {
+		sum += p_values[i];
+	}
+	const double mean = sum / p_values.size();
+	double variance = 0.0;
+	for (uint32_t i = 0; i < p_values.size(); i++) {
+		variance += (p_values[i] - mean) * (p_values[i] - mean);
+	}
+
+	const uint32_t last = p_values.size() - 1;
+	summary["min"] = p_values[0];
+	summary["max"] = p_values[last];
+	summary["mean"] = mean;
+	summary["stddev"] = Math::sqrt(variance / p_values.size());
+	summary["median"] = p_values[last / 2];
+	summary["p95"] = p_values[uint32_t(last * 0.95)];
+	summary["p99"] = p_values[uint32_t(last * 0.99)];
+	return summary;
+}
+
+void SceneBenchmark::_write_results() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	LocalVector<double> frame_msec;
+	LocalVector<double> process_msec;
+	LocalVector<double> physics_step_msec;
+	LocalVector<double> render_cpu_msec;
+	LocalVector<double> render_gpu_msec;
+	LocalVector<double> objects;
+	LocalVector<double> primitives;
+	LocalVector<double> draw_calls;
+
+	// Per frame times are also written unsorted, to find where in the scene spikes happen.
+	Array frame_msec_per_frame;
+	Array render_gpu_msec_per_frame;
+
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		const FrameStats &stats = frames[i];
+		frame_msec.push_back(stats.frame_usec / 1000.0);
+		process_msec.push_back(stats.process_usec / 1000.0);
+		physics_step_msec.push_back(stats.physics_step_usec / 1000.0);
+		render_cpu_msec.push_back(stats.render_cpu_msec);
+		render_gpu_msec.push_back(stats.render_gpu_msec);
+		objects.push_back(stats.objects);
+		primitives.push_back(stats.primitives);
+		draw_calls.push_back(stats.draw_calls);
+
+		frame_msec_per_frame.push_back(stats.frame_usec / 1000.0);
+		render_gpu_msec_per_frame.push_back(stats.render_gpu_msec);
+	}
+
+	Dictionary results;
+	results["version"] = VERSION_FULL_BUILD;
+	results["hash"] = VERSION_HASH;
+	results["scene"] = scene_path;
+	results["rendering_method"] = GLOBAL_GET("rendering/renderer/rendering_method");
+	results["rendering_driver"] = OS::get_singleton()->get_current_rendering_driver_name();
+	results["video_adapter"] = rs->get_video_adapter_name();
+	results["video_adapter_vendor"] = rs->get_video_adapter_vendor();
+	results["frames"] = frames.size();
+	results["warmup_frames"] = warmup_frames;
+	results["wall_time_msec"] = (OS::get_singleton()->get_ticks_usec() - begin_usec) / 1000.0;
+
+	results["frame_msec"] = _make_summary(frame_msec);
+	results["process_msec"] = _make_summary(process_msec);
+	results["physics_step_msec"] = _make_summary(physics_step_msec);
+	results["render_cpu_msec"] = _make_summary(render_cpu_msec);
+	results["render_gpu_msec"] = _make_summary(render_gpu_msec);
+	results["objects_in_frame"] = _make_summary(objects);
+	results["primitives_in_frame"] = _make_summary(primitives);
+	results["draw_calls_in_frame"] = _make_summary(draw_calls);
+
+	Dictionary memory;
+	memory["static_usage"] = Memory::get_mem_usage();
+	memory["static_peak"] = Memory::get_mem_max_usage();
+	memory["texture"] = rs->get_rendering_info(RS::RENDERING_INFO_TEXTURE_MEM_USED);
+	memory["buffer"] = rs->get_rendering_info(RS::RENDERING_INFO_BUFFER_MEM_USED);
+	memory["video"] = rs->get_rendering_info(RS::RENDERING_INFO_VIDEO_MEM_USED);
+	results["memory"] = memory;
+
+	results["frame_msec_per_frame"] = frame_msec_per_frame;
+	results["render_gpu_msec_per_frame"] = render_gpu_msec_per_frame;
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_MSG(err != OK, "Cannot write benchmark results to '" + output_path + "'.");
+	Ref<JSON> json;
+	json.instantiate();
+	f->store_string(json->stringify(results, "\t", false, true));
+
+	print_line(vformat("Benchmark results written to \"%s\": median frame time %s ms, median GPU time %s ms.", output_path,
+			rtos(double(Dictionary(results["frame_msec"])["median"])).pad_decimals(2), rtos(double(Dictionary(results["render_gpu_msec"])["median"])).pad_decimals(2)));
+}
@@ -0,0 +1,70 @@
+/*************************************************************************/
+/*  scene_benchmark.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef SCENE_BENCHMARK_H
+#define SCENE_BENCHMARK_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/rid.h"
+#include "core/variant/dictionary.h"
+
+// Records the frame statistics of a scene run with `--benchmark-scene`, and writes them as JSON once enough frames were drawn.
+class SceneBenchmark {
+	struct FrameStats {
+		uint64_t frame_usec = 0;
+		uint64_t process_usec = 0;
+		uint64_t physics_step_usec = 0;
+		double render_cpu_msec = 0.0;
+		double render_gpu_msec = 0.0;
+		uint64_t objects = 0;
+		uint64_t primitives = 0;
+		uint64_t draw_calls = 0;
+	};
+
+	String scene_path;
+	String output_path;
+	int warmup_frames = 0;
+	int frame_count = 0;
+	int frames_skipped = 0;
+	uint64_t begin_usec = 0;
+	RID viewport;
+
+	LocalVector<FrameStats> frames;
+
+	static Dictionary _make_summary(LocalVector<double> &p_values);
+	void _write_results();
+
+public:
+	void begin(const String &p_scene_path, int p_frame_count, int p_warmup_frames, const String &p_output_path);
+	// Returns true when all the frames were recorded and the results written, the main loop should then quit.
+	bool add_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_step_usec);
+};
+
+#endif // SCENE_BENCHMARK_H
@@ -30,7 +30,9 @@
 
 #include "register_types.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/rendering_server.h"
 
 #ifdef TOOLS_ENABLED
@@ -50,6 +52,8 @@ enum BasisDecompressFormat {
 #define USE_RG_AS_RGBA
 
 #ifdef TOOLS_ENABLED
+static SafeNumeric<uint32_t> basis_universal_packers_active;
+
 static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::UsedChannels p_channels) {
 	Vector<uint8_t> budata;
 
@@ -84,7 +88,12 @@ static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::
 		//params.m_disable_hierarchical_endpoint_codebooks = true;
 		//params.m_no_selector_rdo = true;
 
-		basisu::job_pool jpool(OS::get_singleton()->get_processor_count());
+		// The blocks are encoded in batches on the job pool. Textures can be imported on several worker threads at once,
+		// so the threads of the worker pool are split between the encoders running at the same time instead of each of them
+		// starting one per core. The calling thread counts as one of them.
+		const uint32_t packers_active = basis_universal_packers_active.increment();
+		const uint32_t thread_count = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count() / (int)packers_active);
+		basisu::job_pool jpool(thread_count);
 		params.m_pJob_pool = &jpool;
 
 		params.m_mip_gen = false; //sorry, please some day support provided mipmaps.
@@ -126,6 +135,7 @@ static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::
 		c.init(params);
 
 		int buerr = c.process();
+		basis_universal_packers_active.decrement();
 		ERR_FAIL_COND_V(buerr != basisu::basis_compressor::cECSuccess, budata);
 
 		const basisu::uint8_vec &buvec = c.get_output_basis_file();
@@ -30,6 +30,7 @@
 
 #include "csg.h"
 
+#include "core/math/dynamic_bvh.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/math_funcs.h"
 #include "core/templates/sort_array.h"
@@ -282,12 +283,29 @@ void CSGBrush::copy_from(const CSGBrush &p_brush, const Transform3D &p_xform) {
 
 void CSGBrushOperation::merge_brushes(Operation p_operation, const CSGBrush &p_brush_a, const CSGBrush &p_brush_b, CSGBrush &r_merged_brush, float p_vertex_snap) {
 	// Check for face collisions and add necessary faces.
+	// The faces of B overlapping each face of A are found through a BVH, rather than testing every pair.
+	DynamicBVH faces_b_bvh;
+	for (int j = 0; j < p_brush_b.faces.size(); j++) {
+		faces_b_bvh.insert(p_brush_b.faces[j].aabb, (void *)(intptr_t)j);
+	}
+
+	struct FaceQuery {
+		LocalVector<int> faces;
+		bool operator()(void *p_data) {
+			faces.push_back((int)(intptr_t)p_data);
+			return false;
+		}
+	} face_query;
+
 	Build2DFaceCollection build2DFaceCollection;
 	for (int i = 0; i < p_brush_a.faces.size(); i++) {
-		for (int j = 0; j < p_brush_b.faces.size(); j++) {
-			if (p_brush_a.faces[i].aabb.intersects_inclusive(p_brush_b.faces[j].aabb)) {
-				update_faces(p_brush_a, i, p_brush_b, j, build2DFaceCollection, p_vertex_snap);
-			}
+		face_query.faces.clear();
+		faces_b_bvh.aabb_query(p_brush_a.faces[i].aabb, face_query);
+
+		// Keep the order of the faces, so the result doesn't depend on the shape of the tree.
+		face_query.faces.sort();
+		for (uint32_t j = 0; j < face_query.faces.size(); j++) {
+			update_faces(p_brush_a, i, p_brush_b, face_query.faces[j], build2DFaceCollection, p_vertex_snap);
 		}
 	}
 
@@ -31,6 +31,7 @@
 #include "csg_shape.h"
 
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 void CSGShape3D::set_use_collision(bool p_enable) {
 	if (use_collision == p_enable) {
@@ -150,6 +151,26 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 	dirty = true;
 }
 
+bool CSGShape3D::_can_update_brush_threaded() const {
+	if (!dirty) {
+		return true;
+	}
+	if (!_is_brush_build_thread_safe()) {
+		return false;
+	}
+	for (int i = 0; i < get_child_count(); i++) {
+		const CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (child && child->is_visible() && !child->_can_update_brush_threaded()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void CSGShape3D::_update_child_brush_task(uint32_t p_index, CSGShape3D **p_children) {
+	p_children[p_index]->_get_brush();
+}
+
 CSGBrush *CSGShape3D::_get_brush() {
 	if (dirty) {
 		if (brush) {
@@ -157,6 +178,22 @@ CSGBrush *CSGShape3D::_get_brush() {
 		}
 		brush = nullptr;
 
+		if (WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+			// Children that changed don't depend on each other, so their brushes can be rebuilt in parallel before
+			// merging them here. Only done from outside the pool, so the branches themselves are built serially.
+			LocalVector<CSGShape3D *> dirty_children;
+			for (int i = 0; i < get_child_count(); i++) {
+				CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+				if (child && child->is_visible() && child->dirty && child->_can_update_brush_threaded()) {
+					dirty_children.push_back(child);
+				}
+			}
+			if (dirty_children.size() > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CSGShape3D::_update_child_brush_task, dirty_children.ptr(), dirty_children.size(), -1, true, "Update CSG brushes");
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			}
+		}
+
 		CSGBrush *n = _build_brush();
 
 		for (int i = 0; i < get_child_count(); i++) {
@@ -864,6 +901,11 @@ CSGBrush *CSGMesh3D::_build_brush() {
 	return _create_brush_from_arrays(vertices, uvs, smooth, materials);
 }
 
+bool CSGMesh3D::_is_brush_build_thread_safe() const {
+	// Meshes can be shared, and some generate their arrays when first asked for them.
+	return false;
+}
+
 void CSGMesh3D::_mesh_changed() {
 	_make_dirty();
 	update_gizmos();
@@ -2048,6 +2090,11 @@ CSGBrush *CSGPolygon3D::_build_brush() {
 	return brush;
 }
 
+bool CSGPolygon3D::_is_brush_build_thread_safe() const {
+	// Following a path connects to it and reads its global transform and baked curve.
+	return mode != MODE_PATH;
+}
+
 void CSGPolygon3D::_notification(int p_what) {
 	if (p_what == NOTIFICATION_EXIT_TREE) {
 		if (path) {
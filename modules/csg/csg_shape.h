@@ -107,9 +107,14 @@ private:
 	void _update_shape();
 	void _update_collision_faces();
 
+	bool _can_update_brush_threaded() const;
+	void _update_child_brush_task(uint32_t p_index, CSGShape3D **p_children);
+
 protected:
 	void _notification(int p_what);
 	virtual CSGBrush *_build_brush() = 0;
+	// Whether _build_brush() only reads this node, so independent branches can be built on worker threads.
+	virtual bool _is_brush_build_thread_safe() const { return true; }
 	void _make_dirty(bool p_parent_removing = false);
 
 	static void _bind_methods();
@@ -186,6 +191,7 @@ class CSGMesh3D : public CSGPrimitive3D {
 	GDCLASS(CSGMesh3D, CSGPrimitive3D);
 
 	virtual CSGBrush *_build_brush() override;
+	virtual bool _is_brush_build_thread_safe() const override;
 
 	Ref<Mesh> mesh;
 	Ref<Material> material;
@@ -350,6 +356,7 @@ public:
 
 private:
 	virtual CSGBrush *_build_brush() override;
+	virtual bool _is_brush_build_thread_safe() const override;
 
 	Vector<Vector2> polygon;
 	Ref<Material> material;
@@ -39,9 +39,9 @@ void ENetMultiplayerPeer::set_target_peer(int p_peer) {
 
 int ENetMultiplayerPeer::get_packet_peer() const {
 	ERR_FAIL_COND_V_MSG(!_is_active(), 1, "The multiplayer instance isn't currently active.");
-	ERR_FAIL_COND_V(incoming_packets.size() == 0, 1);
+	ERR_FAIL_COND_V(get_available_packet_count() == 0, 1);
 
-	return incoming_packets.front()->get().from;
+	return incoming_packets[incoming_packets_read].from;
 }
 
 Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_max_channels, int p_in_bandwidth, int p_out_bandwidth) {
@@ -58,6 +58,7 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	_start_network_thread();
 	return OK;
 }
 
@@ -89,6 +90,7 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	_start_network_thread();
 
 	return OK;
 }
@@ -99,6 +101,7 @@ Error ENetMultiplayerPeer::create_mesh(int p_id) {
 	active_mode = MODE_MESH;
 	unique_id = p_id;
 	connection_status = CONNECTION_CONNECTED;
+	_start_network_thread();
 	return OK;
 }
 
@@ -108,6 +111,7 @@ Error ENetMultiplayerPeer::add_mesh_peer(int p_id, Ref<ENetConnection> p_host) {
 	List<Ref<ENetPacketPeer>> host_peers;
 	p_host->get_peers(host_peers);
 	ERR_FAIL_COND_V_MSG(host_peers.size() != 1 || host_peers[0]->get_state() != ENetPacketPeer::STATE_CONNECTED, ERR_INVALID_PARAMETER, "The provided host must have exactly one peer in the connected state.");
+	MutexLock lock(mutex);
 	hosts[p_id] = p_host;
 	peers[p_id] = host_peers[0];
 	emit_signal(SNAME("peer_connected"), p_id);
@@ -178,7 +182,7 @@ bool ENetMultiplayerPeer::_parse_server_event(ENetConnection::EventType p_type,
 				// Even if relaying is disabled, these targets are valid as incoming packets.
 				if (target == 1 || target == 0 || target < -1) {
 					packet.packet->referenceCount++;
-					incoming_packets.push_back(packet);
+					_push_packet(packet);
 				}
 
 				if (server_relay && target != 1) {
@@ -250,7 +254,7 @@ bool ENetMultiplayerPeer::_parse_client_event(ENetConnection::EventType p_type,
 				packet.channel = p_event.channel_id;
 
 				packet.packet->referenceCount++;
-				incoming_packets.push_back(packet);
+				_push_packet(packet);
 				// Destroy packet later
 			}
 			return false;
@@ -284,7 +288,7 @@ bool ENetMultiplayerPeer::_parse_mesh_event(ENetConnection::EventType p_type, EN
 			packet.channel = p_event.channel_id;
 
 			packet.packet->referenceCount++;
-			incoming_packets.push_back(packet);
+			_push_packet(packet);
 			return false;
 		} break;
 		default:
@@ -296,8 +300,13 @@ bool ENetMultiplayerPeer::_parse_mesh_event(ENetConnection::EventType p_type, EN
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
+	MutexLock lock(mutex);
+
 	_pop_current_packet();
 
+	// With the network thread, the hosts were already serviced and the events are waiting.
+	const bool threaded = network_thread.is_started();
+
 	switch (active_mode) {
 		case MODE_CLIENT: {
 			if (peers.has(1) && !peers[1]->is_active()) {
@@ -310,6 +319,27 @@ void ENetMultiplayerPeer::poll() {
 				close_connection();
 				return;
 			}
+			if (threaded) {
+				for (uint32_t i = 0; i < service_events.size(); i++) {
+					ServiceEvent &ev = service_events[i];
+					if (ev.type == ENetConnection::EVENT_ERROR) {
+						// The host can't be serviced anymore.
+						if (connection_status == CONNECTION_CONNECTED) {
+							emit_signal(SNAME("server_disconnected"));
+						} else {
+							emit_signal(SNAME("connection_failed"));
+						}
+						close_connection();
+						return;
+					}
+					ENetConnection::Event event = ev.event;
+					ev.event.packet = nullptr; // Owned by the parser now.
+					if (_parse_client_event(ev.type, event)) {
+						break; // Closed, or nothing else to parse. The remaining events are cleared below.
+					}
+				}
+				break;
+			}
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			if (ret == ENetConnection::EVENT_ERROR) {
@@ -328,6 +358,22 @@ void ENetMultiplayerPeer::poll() {
 					peers.erase(E.key);
 				}
 			}
+			if (threaded) {
+				for (uint32_t i = 0; i < service_events.size(); i++) {
+					ServiceEvent &ev = service_events[i];
+					if (ev.type == ENetConnection::EVENT_ERROR) {
+						// The host can't be serviced anymore.
+						close_connection();
+						return;
+					}
+					ENetConnection::Event event = ev.event;
+					ev.event.packet = nullptr; // Owned by the parser now.
+					if (_parse_server_event(ev.type, event)) {
+						break; // The remaining events are cleared below.
+					}
+				}
+				break;
+			}
 			ENetConnection::Event event;
 			ENetConnection::EventType ret = hosts[0]->service(0, event);
 			if (ret == ENetConnection::EVENT_ERROR) {
@@ -349,6 +395,26 @@ void ENetMultiplayerPeer::poll() {
 					}
 				}
 			}
+			if (threaded) {
+				for (uint32_t i = 0; i < service_events.size(); i++) {
+					ServiceEvent &ev = service_events[i];
+					if (!hosts.has(ev.host_id)) {
+						continue; // Removed after the event was serviced, the packet is destroyed below.
+					}
+					if (ev.type == ENetConnection::EVENT_ERROR) {
+						if (peers.has(ev.host_id)) {
+							emit_signal(SNAME("peer_disconnected"), ev.host_id);
+							peers.erase(ev.host_id);
+						}
+						hosts.erase(ev.host_id);
+						continue;
+					}
+					ENetConnection::Event event = ev.event;
+					ev.event.packet = nullptr; // Owned by the parser now.
+					_parse_mesh_event(ev.type, event, ev.host_id);
+				}
+				break;
+			}
 			for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 				ENetConnection::Event event;
 				ENetConnection::EventType ret = E.value->service(0, event);
@@ -370,6 +436,64 @@ void ENetMultiplayerPeer::poll() {
 		default:
 			return;
 	}
+	_clear_service_events();
+}
+
+void ENetMultiplayerPeer::_service_hosts() {
+	for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+		ServiceEvent ev;
+		ev.host_id = E.key;
+		ev.type = E.value->service(0, ev.event);
+		if (ev.type == ENetConnection::EVENT_ERROR) {
+			service_events.push_back(ev);
+			continue;
+		}
+		while (ev.type > ENetConnection::EVENT_NONE) {
+			service_events.push_back(ev);
+			ev.event = ENetConnection::Event();
+			if (E.value->check_events(ev.type, ev.event) <= 0) {
+				break;
+			}
+		}
+	}
+}
+
+void ENetMultiplayerPeer::_clear_service_events() {
+	for (uint32_t i = 0; i < service_events.size(); i++) {
+		// Only set for the events never handed to a parser.
+		if (service_events[i].event.packet) {
+			_destroy_unused(service_events[i].event.packet);
+		}
+	}
+	service_events.clear();
+}
+
+void ENetMultiplayerPeer::_network_thread_func(void *p_user) {
+	ENetMultiplayerPeer *enet_peer = (ENetMultiplayerPeer *)p_user;
+	while (!enet_peer->network_thread_exit.is_set()) {
+		// Don't wait for the main thread to finish polling or sending, it might be waiting for this thread to exit.
+		if (enet_peer->mutex.try_lock() == OK) {
+			enet_peer->_service_hosts();
+			enet_peer->mutex.unlock();
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+}
+
+void ENetMultiplayerPeer::_start_network_thread() {
+	if (!network_thread_enabled) {
+		return;
+	}
+	network_thread_exit.clear();
+	network_thread.start(_network_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_network_thread() {
+	if (!network_thread.is_started()) {
+		return;
+	}
+	network_thread_exit.set();
+	network_thread.wait_to_finish();
 }
 
 bool ENetMultiplayerPeer::is_server() const {
@@ -381,6 +505,9 @@ void ENetMultiplayerPeer::close_connection(uint32_t wait_usec) {
 		return;
 	}
 
+	_stop_network_thread();
+	MutexLock lock(mutex);
+
 	_pop_current_packet();
 
 	bool peers_disconnected = false;
@@ -402,7 +529,13 @@ void ENetMultiplayerPeer::close_connection(uint32_t wait_usec) {
 	}
 
 	active_mode = MODE_NONE;
+	for (uint32_t i = incoming_packets_read; i < incoming_packets.size(); i++) {
+		incoming_packets[i].packet->referenceCount--;
+		_destroy_unused(incoming_packets[i].packet);
+	}
 	incoming_packets.clear();
+	incoming_packets_read = 0;
+	_clear_service_events();
 	peers.clear();
 	hosts.clear();
 	unique_id = 0;
@@ -411,16 +544,20 @@ void ENetMultiplayerPeer::close_connection(uint32_t wait_usec) {
 }
 
 int ENetMultiplayerPeer::get_available_packet_count() const {
-	return incoming_packets.size();
+	return incoming_packets.size() - incoming_packets_read;
 }
 
 Error ENetMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
-	ERR_FAIL_COND_V_MSG(incoming_packets.size() == 0, ERR_UNAVAILABLE, "No incoming packets available.");
+	ERR_FAIL_COND_V_MSG(get_available_packet_count() == 0, ERR_UNAVAILABLE, "No incoming packets available.");
 
 	_pop_current_packet();
 
-	current_packet = incoming_packets.front()->get();
-	incoming_packets.pop_front();
+	current_packet = incoming_packets[incoming_packets_read++];
+	if (incoming_packets_read == incoming_packets.size()) {
+		// All read, keep the storage for the next ones.
+		incoming_packets.clear();
+		incoming_packets_read = 0;
+	}
 
 	*r_buffer = (const uint8_t *)(&current_packet.packet->data[8]);
 	r_buffer_size = current_packet.packet->dataLength - 8;
@@ -434,6 +571,8 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ERR_FAIL_COND_V_MSG(target_peer != 0 && !peers.has(ABS(target_peer)), ERR_INVALID_PARAMETER, vformat("Invalid target peer: %d", target_peer));
 	ERR_FAIL_COND_V(active_mode == MODE_CLIENT && !peers.has(1), ERR_BUG);
 
+	MutexLock lock(mutex);
+
 	int packet_flags = 0;
 	int channel = SYSCH_RELIABLE;
 	int transfer_channel = get_transfer_channel();
@@ -518,6 +657,10 @@ int ENetMultiplayerPeer::get_max_packet_size() const {
 	return 1 << 24; // Anything is good
 }
 
+void ENetMultiplayerPeer::_push_packet(const Packet &p_packet) {
+	incoming_packets.push_back(p_packet);
+}
+
 void ENetMultiplayerPeer::_pop_current_packet() {
 	if (current_packet.packet) {
 		current_packet.packet->referenceCount--;
@@ -540,6 +683,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -558,6 +702,16 @@ bool ENetMultiplayerPeer::is_server_relay_enabled() const {
 	return server_relay;
 }
 
+void ENetMultiplayerPeer::set_network_thread_enabled(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The network thread can't be toggled while the multiplayer instance is active.");
+
+	network_thread_enabled = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_network_thread_enabled() const {
+	return network_thread_enabled;
+}
+
 Ref<ENetConnection> ENetMultiplayerPeer::get_host() const {
 	ERR_FAIL_COND_V(!_is_active(), nullptr);
 	ERR_FAIL_COND_V(active_mode == MODE_MESH, nullptr);
@@ -651,10 +805,13 @@ void ENetMultiplayerPeer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_server_relay_enabled", "enabled"), &ENetMultiplayerPeer::set_server_relay_enabled);
 	ClassDB::bind_method(D_METHOD("is_server_relay_enabled"), &ENetMultiplayerPeer::is_server_relay_enabled);
+	ClassDB::bind_method(D_METHOD("set_network_thread_enabled", "enabled"), &ENetMultiplayerPeer::set_network_thread_enabled);
+	ClassDB::bind_method(D_METHOD("is_network_thread_enabled"), &ENetMultiplayerPeer::is_network_thread_enabled);
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "network_thread"), "set_network_thread_enabled", "is_network_thread_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
 }
 
@@ -33,6 +33,9 @@
 
 #include "core/crypto/crypto.h"
 #include "core/multiplayer/multiplayer_peer.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
 
 #include "enet_connection.h"
 #include <enet/enet.h>
@@ -79,10 +82,32 @@ private:
 		int channel = 0;
 	};
 
-	List<Packet> incoming_packets;
+	// Read from the front, the storage is reused once all of them have been read.
+	LocalVector<Packet> incoming_packets;
+	uint32_t incoming_packets_read = 0;
 
 	Packet current_packet;
 
+	// Events serviced by the network thread, waiting for the next poll.
+	struct ServiceEvent {
+		int host_id = 0;
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+	};
+
+	bool network_thread_enabled = false;
+	Thread network_thread;
+	SafeFlag network_thread_exit;
+	Mutex mutex; // Guards the hosts while the network thread is running.
+	LocalVector<ServiceEvent> service_events;
+
+	static void _network_thread_func(void *p_user);
+	void _start_network_thread();
+	void _stop_network_thread();
+	void _service_hosts();
+	void _clear_service_events();
+
+	void _push_packet(const Packet &p_packet);
 	void _pop_current_packet();
 	bool _parse_server_event(ENetConnection::EventType p_event_type, ENetConnection::Event &p_event);
 	bool _parse_client_event(ENetConnection::EventType p_event_type, ENetConnection::Event &p_event);
@@ -127,6 +152,8 @@ public:
 	void set_bind_ip(const IPAddress &p_ip);
 	void set_server_relay_enabled(bool p_enabled);
 	bool is_server_relay_enabled() const;
+	void set_network_thread_enabled(bool p_enabled);
+	bool is_network_thread_enabled() const;
 
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
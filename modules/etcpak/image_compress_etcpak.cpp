@@ -88,6 +88,35 @@ void _compress_bc(Image *r_img, float p_lossy_quality, Image::UsedChannels p_cha
 	_compress_etcpak(type, r_img, p_lossy_quality);
 }
 
+struct EtcpakBlockRows {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	int width = 0;
+	int dst_row_stride = 0; // In uint64_t units.
+};
+
+static void _compress_etcpak_block_row(void *p_userdata, uint32_t p_row) {
+	const EtcpakBlockRows *rows = static_cast<const EtcpakBlockRows *>(p_userdata);
+	const uint32_t *src = rows->src + p_row * 4 * rows->width;
+	uint64_t *dst = rows->dst + p_row * rows->dst_row_stride;
+	const uint32_t blocks = rows->width / 4;
+
+	if (rows->type == EtcpakType::ETCPAK_TYPE_ETC1) {
+		CompressEtc1RgbDither(src, dst, blocks, rows->width);
+	} else if (rows->type == EtcpakType::ETCPAK_TYPE_ETC2 || rows->type == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
+		CompressEtc2Rgb(src, dst, blocks, rows->width, true);
+	} else if (rows->type == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
+		CompressEtc2Rgba(src, dst, blocks, rows->width, true);
+	} else if (rows->type == EtcpakType::ETCPAK_TYPE_DXT1) {
+		CompressDxt1Dither(src, dst, blocks, rows->width);
+	} else if (rows->type == EtcpakType::ETCPAK_TYPE_DXT5 || rows->type == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
+		CompressDxt5(src, dst, blocks, rows->width);
+	} else {
+		ERR_FAIL_MSG("Invalid or unsupported Etcpak compression format.");
+	}
+}
+
 void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_quality) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -177,6 +206,10 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
 	Vector<uint32_t> padded_src;
 
+	// ETC2 with alpha and DXT5 use 16 bytes per block, the other formats 8.
+	const bool wide_blocks = p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG;
+	const int block_size = wide_blocks ? 16 : 8;
+
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
 		int orig_mip_w, orig_mip_h;
@@ -188,7 +221,6 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 		// Block size. Align stride to multiple of 4 (RGBA8).
 		int mip_w = (orig_mip_w + 3) & ~3;
 		int mip_h = (orig_mip_h + 3) & ~3;
-		const uint32_t blocks = mip_w * mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int src_mip_ofs = r_img->get_mipmap_offset(i);
@@ -217,19 +249,15 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 			// Override the src_mip_read pointer to our temporary Vector.
 			src_mip_read = padded_src.ptr();
 		}
-		if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
-			CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2 || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
-			CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
-			CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
-			CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
-			CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else {
-			ERR_FAIL_MSG("Invalid or unsupported Etcpak compression format.");
-		}
+
+		// Rows of blocks don't depend on each other, so they are compressed in parallel.
+		EtcpakBlockRows rows;
+		rows.type = p_compresstype;
+		rows.src = src_mip_read;
+		rows.dst = dest_mip_write;
+		rows.width = mip_w;
+		rows.dst_row_stride = (mip_w / 4) * (block_size / 8);
+		Image::run_compression_tasks(_compress_etcpak_block_row, &rows, mip_h / 4);
 	}
 
 	// Replace original image with compressed one.
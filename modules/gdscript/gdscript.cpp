@@ -427,6 +427,7 @@ void GDScript::set_source_code(const String &p_code) {
 		return;
 	}
 	source = p_code;
+	binary_tokens.clear();
 #ifdef TOOLS_ENABLED
 	source_changed_cache = true;
 #endif
@@ -827,6 +828,7 @@ String GDScript::_get_debug_path() const {
 }
 
 Error GDScript::reload(bool p_keep_state) {
+	MemoryTagScope memory_tag(Memory::TAG_SCRIPT);
 	bool has_instances;
 	{
 		MutexLock lock(GDScriptLanguage::singleton->lock);
@@ -868,7 +870,12 @@ Error GDScript::reload(bool p_keep_state) {
 
 	valid = false;
 	GDScriptParser parser;
-	Error err = parser.parse(source, path, false);
+	Error err;
+	if (binary_tokens.is_empty()) {
+		err = parser.parse(source, path, false);
+	} else {
+		err = parser.parse_binary(binary_tokens, path);
+	}
 	if (err) {
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
@@ -1028,12 +1035,28 @@ void GDScript::_bind_methods() {
 }
 
 Vector<uint8_t> GDScript::get_as_byte_code() const {
-	return Vector<uint8_t>();
+	if (!binary_tokens.is_empty()) {
+		return binary_tokens;
+	}
+	return GDScriptTokenizer::get_binary_tokens(source);
 };
 
-// TODO: Fully remove this. There's not this kind of "bytecode" anymore.
 Error GDScript::load_byte_code(const String &p_path) {
-	return ERR_COMPILATION_FAILED;
+	Error err;
+	Vector<uint8_t> buffer = FileAccess::get_file_as_array(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open binary script file '" + p_path + "'.");
+	ERR_FAIL_COND_V_MSG(buffer.is_empty(), ERR_FILE_CORRUPT, "Binary script '" + p_path + "' is empty.");
+
+	set_binary_tokens_source(buffer);
+	return OK;
+}
+
+void GDScript::set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens) {
+	binary_tokens = p_binary_tokens;
+	source = String();
+#ifdef TOOLS_ENABLED
+	source_changed_cache = true;
+#endif
 }
 
 Error GDScript::load_source_code(const String &p_path) {
@@ -1270,6 +1293,9 @@ GDScript::~GDScript() {
 		memdelete(implicit_ready);
 	}
 
+	// The address of this script may be reused by another one.
+	GDScriptFunction::inline_cache_version.increment();
+
 	if (GDScriptCache::singleton) { // Cache may have been already destroyed at engine shutdown.
 		GDScriptCache::remove_script(get_path());
 	}
@@ -1747,6 +1773,21 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+	// Parse the scripts the autoloads and the main scene depend on in parallel, instead of one by one as they load.
+	if (!Engine::get_singleton()->is_editor_hint() && !Engine::get_singleton()->is_project_manager_hint()) {
+		Vector<String> startup_paths;
+		for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+			startup_paths.push_back(E.value.path);
+		}
+		String main_scene = GLOBAL_GET("application/run/main_scene");
+		if (!main_scene.is_empty()) {
+			startup_paths.push_back(main_scene);
+		}
+		if (!startup_paths.is_empty()) {
+			GDScriptCache::prepare_startup_scripts(startup_paths);
+		}
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -1768,6 +1809,66 @@ Error GDScriptLanguage::execute_file(const String &p_path) {
 void GDScriptLanguage::finish() {
 }
 
+#ifdef DEBUG_ENABLED
+void GDScriptLanguage::_sampler_thread_func(void *p_userdata) {
+	GDScriptLanguage *language = static_cast<GDScriptLanguage *>(p_userdata);
+	while (!language->sampler_exit.is_set()) {
+		language->_take_sample();
+		OS::get_singleton()->delay_usec(language->sampling_interval_usec);
+	}
+}
+
+void GDScriptLanguage::_take_sample() {
+	// Functions can't be freed while the lock is held, and the ones on the call stack are running.
+	// The main thread keeps pushing and popping meanwhile, so a sample may be slightly off, but never invalid.
+	MutexLock lock(this->lock);
+
+	int stack_pos = _debug_call_stack_pos;
+	if (stack_pos <= 0 || stack_pos > _debug_max_call_stack) {
+		return;
+	}
+
+	for (int i = stack_pos - 1; i >= 0; i--) {
+		GDScriptFunction *function = _call_stack[i].function;
+		int line = _call_stack[i].line ? *_call_stack[i].line : 0;
+		if (!function || line <= 0) {
+			continue;
+		}
+
+		// Only count each line once for the total time, in case of recursion.
+		bool seen = false;
+		for (int j = stack_pos - 1; j > i; j--) {
+			if (_call_stack[j].function == function && _call_stack[j].line && *_call_stack[j].line == line) {
+				seen = true;
+				break;
+			}
+		}
+		if (seen) {
+			continue;
+		}
+
+		HashMap<int, GDScriptFunction::Profile::LineSamples>::Iterator E = function->profile.line_samples.find(line);
+		if (!E) {
+			// Same as the function signature, but pointing to the sampled line.
+			Vector<String> parts = String(function->profile.signature).split("::");
+			if (parts.size() >= 3) {
+				parts.write[parts.size() - 2] = itos(line);
+			}
+			GDScriptFunction::Profile::LineSamples samples;
+			samples.signature = String("::").join(parts);
+			E = function->profile.line_samples.insert(line, samples);
+		}
+
+		E->value.total_samples++;
+		E->value.frame_total_samples++;
+		if (i == stack_pos - 1) {
+			E->value.self_samples++;
+			E->value.frame_self_samples++;
+		}
+	}
+}
+#endif
+
 void GDScriptLanguage::profiling_start() {
 #ifdef DEBUG_ENABLED
 	MutexLock lock(this->lock);
@@ -1783,18 +1884,37 @@ void GDScriptLanguage::profiling_start() {
 		elem->self()->profile.last_frame_call_count = 0;
 		elem->self()->profile.last_frame_self_time = 0;
 		elem->self()->profile.last_frame_total_time = 0;
+		elem->self()->profile.line_samples.clear();
 		elem = elem->next();
 	}
 
-	profiling = true;
+	// The call stack is only tracked while debugging, otherwise fall back to timing every call.
+	int sampling_rate = GLOBAL_GET("debug/settings/gdscript/profiler_sampling_rate");
+	if (sampling_rate > 0 && _call_stack) {
+		if (!sampling) {
+			sampling = true;
+			sampling_interval_usec = 1000000 / sampling_rate;
+			sampler_exit.clear();
+			sampler_thread.start(_sampler_thread_func, this);
+		}
+	} else {
+		profiling = true;
+	}
 #endif
 }
 
 void GDScriptLanguage::profiling_stop() {
 #ifdef DEBUG_ENABLED
+	if (sampling) {
+		// Not under the lock, the sampler needs it to finish its last sample.
+		sampler_exit.set();
+		sampler_thread.wait_to_finish();
+	}
+
 	MutexLock lock(this->lock);
 
 	profiling = false;
+	sampling = false;
 #endif
 }
 
@@ -1809,6 +1929,21 @@ int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr,
 		if (current >= p_info_max) {
 			break;
 		}
+		if (sampling) {
+			// One entry per sampled line, the call count being the number of samples.
+			for (const KeyValue<int, GDScriptFunction::Profile::LineSamples> &E : elem->self()->profile.line_samples) {
+				if (current >= p_info_max) {
+					break;
+				}
+				p_info_arr[current].call_count = E.value.total_samples;
+				p_info_arr[current].self_time = E.value.self_samples * sampling_interval_usec;
+				p_info_arr[current].total_time = E.value.total_samples * sampling_interval_usec;
+				p_info_arr[current].signature = E.value.signature;
+				current++;
+			}
+			elem = elem->next();
+			continue;
+		}
 		p_info_arr[current].call_count = elem->self()->profile.call_count;
 		p_info_arr[current].self_time = elem->self()->profile.self_time;
 		p_info_arr[current].total_time = elem->self()->profile.total_time;
@@ -1832,6 +1967,22 @@ int GDScriptLanguage::profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_
 		if (current >= p_info_max) {
 			break;
 		}
+		if (sampling) {
+			for (const KeyValue<int, GDScriptFunction::Profile::LineSamples> &E : elem->self()->profile.line_samples) {
+				if (current >= p_info_max) {
+					break;
+				}
+				if (E.value.last_frame_total_samples > 0) {
+					p_info_arr[current].call_count = E.value.last_frame_total_samples;
+					p_info_arr[current].self_time = E.value.last_frame_self_samples * sampling_interval_usec;
+					p_info_arr[current].total_time = E.value.last_frame_total_samples * sampling_interval_usec;
+					p_info_arr[current].signature = E.value.signature;
+					current++;
+				}
+			}
+			elem = elem->next();
+			continue;
+		}
 		if (elem->self()->profile.last_frame_call_count > 0) {
 			p_info_arr[current].call_count = elem->self()->profile.last_frame_call_count;
 			p_info_arr[current].self_time = elem->self()->profile.last_frame_self_time;
@@ -2021,7 +2172,25 @@ void GDScriptLanguage::reload_tool_script(const Ref<Script> &p_script, bool p_so
 void GDScriptLanguage::frame() {
 	calls = 0;
 
+	// By now the autoloads and the main scene hold the scripts they use.
+	GDScriptCache::release_startup_scripts();
+
 #ifdef DEBUG_ENABLED
+	if (sampling) {
+		MutexLock lock(this->lock);
+
+		SelfList<GDScriptFunction> *elem = function_list.first();
+		while (elem) {
+			for (KeyValue<int, GDScriptFunction::Profile::LineSamples> &E : elem->self()->profile.line_samples) {
+				E.value.last_frame_self_samples = E.value.frame_self_samples;
+				E.value.last_frame_total_samples = E.value.frame_total_samples;
+				E.value.frame_self_samples = 0;
+				E.value.frame_total_samples = 0;
+			}
+			elem = elem->next();
+		}
+	}
+
 	if (profiling) {
 		MutexLock lock(this->lock);
 
@@ -2246,6 +2415,10 @@ GDScriptLanguage::GDScriptLanguage() {
 	_debug_call_stack_pos = 0;
 	int dmcs = GLOBAL_DEF("debug/settings/gdscript/max_call_stack", 1024);
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/max_call_stack", PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater")); //minimum is 1024
+	GLOBAL_DEF("debug/settings/gdscript/optimization_level", GDScriptCompiler::OPTIMIZATION_BASIC);
+	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/optimization_level", PropertyInfo(Variant::INT, "debug/settings/gdscript/optimization_level", PROPERTY_HINT_ENUM, "None,Basic"));
+	GLOBAL_DEF("debug/settings/gdscript/profiler_sampling_rate", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/profiler_sampling_rate", PropertyInfo(Variant::INT, "debug/settings/gdscript/profiler_sampling_rate", PROPERTY_HINT_RANGE, "0,10000,1,suffix:Hz"));
 
 	if (EngineDebugger::is_active()) {
 		//debugging enabled!
@@ -2275,6 +2448,13 @@ GDScriptLanguage::GDScriptLanguage() {
 }
 
 GDScriptLanguage::~GDScriptLanguage() {
+#ifdef DEBUG_ENABLED
+	if (sampling) {
+		sampler_exit.set();
+		sampler_thread.wait_to_finish();
+	}
+#endif
+
 	if (_call_stack) {
 		memdelete_arr(_call_stack);
 	}
@@ -2332,10 +2512,11 @@ Ref<Resource> ResourceFormatLoaderGDScript::load(const String &p_path, const Str
 		*r_error = ERR_FILE_CANT_OPEN;
 	}
 
+	// Scripts exported as binary tokens are remapped, but are cached and referenced by their original path.
 	Error err;
-	Ref<GDScript> script = GDScriptCache::get_full_script(p_path, err);
+	Ref<GDScript> script = GDScriptCache::get_full_script(p_original_path.is_empty() ? p_path : p_original_path, err);
 
-	// TODO: Reintroduce binary and encrypted scripts.
+	// TODO: Reintroduce encrypted scripts.
 
 	if (script.is_null()) {
 		// Don't fail loading because of parsing error.
@@ -2351,8 +2532,8 @@ Ref<Resource> ResourceFormatLoaderGDScript::load(const String &p_path, const Str
 
 void ResourceFormatLoaderGDScript::get_recognized_extensions(List<String> *p_extensions) const {
 	p_extensions->push_back("gd");
-	// TODO: Reintroduce binary and encrypted scripts.
-	// p_extensions->push_back("gdc");
+	p_extensions->push_back("gdc");
+	// TODO: Reintroduce encrypted scripts.
 	// p_extensions->push_back("gde");
 }
 
@@ -2362,25 +2543,33 @@ bool ResourceFormatLoaderGDScript::handles_type(const String &p_type) const {
 
 String ResourceFormatLoaderGDScript::get_resource_type(const String &p_path) const {
 	String el = p_path.get_extension().to_lower();
-	// TODO: Reintroduce binary and encrypted scripts.
-	if (el == "gd" /*|| el == "gdc" || el == "gde"*/) {
+	// TODO: Reintroduce encrypted scripts.
+	if (el == "gd" || el == "gdc" /*|| el == "gde"*/) {
 		return "GDScript";
 	}
 	return "";
 }
 
 void ResourceFormatLoaderGDScript::get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types) {
-	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
-	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
+	GDScriptParser parser;
 
-	String source = file->get_as_utf8_string();
-	if (source.is_empty()) {
-		return;
-	}
+	if (p_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> buffer = FileAccess::get_file_as_array(p_path);
+		if (buffer.is_empty() || OK != parser.parse_binary(buffer, p_path)) {
+			return;
+		}
+	} else {
+		Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+		ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
 
-	GDScriptParser parser;
-	if (OK != parser.parse(source, p_path, false)) {
-		return;
+		String source = file->get_as_utf8_string();
+		if (source.is_empty()) {
+			return;
+		}
+
+		if (OK != parser.parse(source, p_path, false)) {
+			return;
+		}
 	}
 
 	for (const String &E : parser.get_dependencies()) {
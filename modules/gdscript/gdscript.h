@@ -126,6 +126,7 @@ class GDScript : public Script {
 	RBSet<Object *> instances;
 	//exported members
 	String source;
+	Vector<uint8_t> binary_tokens; // Used instead of the source code by exported scripts, see GDScriptTokenizer::get_binary_tokens().
 	String path;
 	String name;
 	String fully_qualified_name;
@@ -224,7 +225,10 @@ public:
 
 	void set_script_path(const String &p_path) { path = p_path; } //because subclasses need a path too...
 	Error load_source_code(const String &p_path);
+	// Loads the binary tokens saved on export, keeping the path the script is referenced by.
 	Error load_byte_code(const String &p_path);
+	void set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens);
+	const Vector<uint8_t> &get_binary_tokens_source() const { return binary_tokens; }
 
 	Vector<uint8_t> get_as_byte_code() const;
 
@@ -350,6 +354,15 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool profiling;
 	uint64_t script_frame_time;
 
+	// Sampling profiler, snapshots the call stack from its own thread instead of timing every call.
+	bool sampling = false;
+	uint64_t sampling_interval_usec = 0;
+	SafeFlag sampler_exit;
+	Thread sampler_thread;
+
+	static void _sampler_thread_func(void *p_userdata);
+	void _take_sample();
+
 	HashMap<String, ObjectID> orphan_subclasses;
 
 public:
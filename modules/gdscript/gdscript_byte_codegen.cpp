@@ -394,6 +394,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_lambdas_count = 0;
 	}
 
+	if (inline_caches_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_caches_count);
+		function->_inline_caches_count = inline_caches_count;
+	} else {
+		function->_inline_caches_ptr = nullptr;
+		function->_inline_caches_count = 0;
+	}
+
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
@@ -562,6 +570,37 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	append(p_operator);
 }
 
+// Opcodes evaluating the most common operators on two ints or two floats inline, or OPCODE_END if there is none.
+static GDScriptFunction::Opcode get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type != p_right_type || (p_left_type != Variant::INT && p_left_type != Variant::FLOAT)) {
+		return GDScriptFunction::OPCODE_END;
+	}
+	bool is_int = p_left_type == Variant::INT;
+
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_ADD_INT : GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+		case Variant::OP_SUBTRACT:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT : GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+		case Variant::OP_MULTIPLY:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT : GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+		case Variant::OP_EQUAL:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT : GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT;
+		case Variant::OP_NOT_EQUAL:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT : GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT;
+		case Variant::OP_LESS:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_LESS_INT : GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT;
+		case Variant::OP_LESS_EQUAL:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT : GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT;
+		case Variant::OP_GREATER:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_GREATER_INT : GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT;
+		case Variant::OP_GREATER_EQUAL:
+			return is_int ? GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT : GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT;
+		default:
+			return GDScriptFunction::OPCODE_END;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand)) {
 		if (p_target.mode == Address::TEMPORARY) {
@@ -572,6 +611,15 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		GDScriptFunction::Opcode typed_opcode = get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (typed_opcode != GDScriptFunction::OPCODE_END) {
+			append(typed_opcode, 3);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
@@ -701,8 +749,35 @@ void GDScriptByteCodeGenerator::write_end_ternary() {
 	ternary_result.pop_back();
 }
 
+// Opcodes accessing the storage of numeric packed arrays directly, or OPCODE_END for other types.
+static GDScriptFunction::Opcode get_packed_array_indexed_opcode(Variant::Type p_type, bool p_set) {
+	switch (p_type) {
+		case Variant::PACKED_BYTE_ARRAY:
+			return p_set ? GDScriptFunction::OPCODE_SET_INDEXED_PACKED_BYTE_ARRAY : GDScriptFunction::OPCODE_GET_INDEXED_PACKED_BYTE_ARRAY;
+		case Variant::PACKED_INT32_ARRAY:
+			return p_set ? GDScriptFunction::OPCODE_SET_INDEXED_PACKED_INT32_ARRAY : GDScriptFunction::OPCODE_GET_INDEXED_PACKED_INT32_ARRAY;
+		case Variant::PACKED_INT64_ARRAY:
+			return p_set ? GDScriptFunction::OPCODE_SET_INDEXED_PACKED_INT64_ARRAY : GDScriptFunction::OPCODE_GET_INDEXED_PACKED_INT64_ARRAY;
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return p_set ? GDScriptFunction::OPCODE_SET_INDEXED_PACKED_FLOAT32_ARRAY : GDScriptFunction::OPCODE_GET_INDEXED_PACKED_FLOAT32_ARRAY;
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return p_set ? GDScriptFunction::OPCODE_SET_INDEXED_PACKED_FLOAT64_ARRAY : GDScriptFunction::OPCODE_GET_INDEXED_PACKED_FLOAT64_ARRAY;
+		default:
+			return GDScriptFunction::OPCODE_END;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_target)) {
+		GDScriptFunction::Opcode packed_opcode = get_packed_array_indexed_opcode(p_target.type.builtin_type, true);
+		if (packed_opcode != GDScriptFunction::OPCODE_END && IS_BUILTIN_TYPE(p_index, Variant::INT) &&
+				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
+			append(packed_opcode, 3);
+			append(p_target);
+			append(p_index);
+			append(p_source);
+			return;
+		}
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
 				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
 			// Use indexed setter instead.
@@ -732,6 +807,14 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_source)) {
+		GDScriptFunction::Opcode packed_opcode = get_packed_array_indexed_opcode(p_source.type.builtin_type, false);
+		if (packed_opcode != GDScriptFunction::OPCODE_END && IS_BUILTIN_TYPE(p_index, Variant::INT)) {
+			append(packed_opcode, 3);
+			append(p_source);
+			append(p_index);
+			append(p_target);
+			return;
+		}
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
 			Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(p_source.type.builtin_type);
@@ -786,6 +869,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(alloc_inline_cache());
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -929,6 +1013,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(alloc_inline_cache());
 }
 
 void GDScriptByteCodeGenerator::write_super_call(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -950,6 +1035,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(alloc_inline_cache());
 }
 
 void GDScriptByteCodeGenerator::write_call_gdscript_utility(const Address &p_target, GDScriptUtilityFunctions::FunctionPtr p_function, const Vector<Address> &p_arguments) {
@@ -1197,6 +1283,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(alloc_inline_cache());
 }
 
 void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -1208,6 +1295,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(alloc_inline_cache());
 }
 
 void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_target, const Address &p_base, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -1219,6 +1307,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(alloc_inline_cache());
 }
 
 void GDScriptByteCodeGenerator::write_lambda(const Address &p_target, GDScriptFunction *p_function, const Vector<Address> &p_captures, bool p_use_self) {
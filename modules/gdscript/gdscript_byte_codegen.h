@@ -71,6 +71,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 	int ptrcall_max = 0;
+	int inline_caches_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -303,6 +304,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		return pos;
 	}
 
+	int alloc_inline_cache() {
+		return inline_caches_count++;
+	}
+
 	void alloc_ptrcall(int p_params) {
 		if (p_params >= ptrcall_max) {
 			ptrcall_max = p_params;
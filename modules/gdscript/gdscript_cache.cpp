@@ -31,6 +31,9 @@
 #include "gdscript_cache.h"
 
 #include "core/io/file_access.h"
+#include "core/io/resource_loader.h"
+#include "core/io/resource_uid.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/vector.h"
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
@@ -57,10 +60,15 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 
 	while (p_new_status > status) {
 		switch (status) {
-			case EMPTY:
+			case EMPTY: {
 				status = PARSED;
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
-				break;
+				String remapped_path = ResourceLoader::path_remap(path);
+				if (remapped_path.get_extension().to_lower() == "gdc") {
+					result = parser->parse_binary(GDScriptCache::get_binary_tokens(remapped_path), path);
+				} else {
+					result = parser->parse(GDScriptCache::get_source_code(path), path, false);
+				}
+			} break;
 			case PARSED: {
 				analyzer = memnew(GDScriptAnalyzer(parser));
 				status = INHERITANCE_SOLVED;
@@ -127,7 +135,7 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 			return ref;
 		}
 	} else {
-		if (!FileAccess::exists(p_path)) {
+		if (!FileAccess::exists(ResourceLoader::path_remap(p_path))) {
 			r_error = ERR_FILE_NOT_FOUND;
 			return ref;
 		}
@@ -163,6 +171,13 @@ String GDScriptCache::get_source_code(const String &p_path) {
 	return source;
 }
 
+Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
+	Error err;
+	Vector<uint8_t> buffer = FileAccess::get_file_as_array(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, Vector<uint8_t>(), "Cannot open binary script file '" + p_path + "'.");
+	return buffer;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, const String &p_owner) {
 	MutexLock lock(singleton->lock);
 	if (!p_owner.is_empty()) {
@@ -179,7 +194,12 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, const Stri
 	script.instantiate();
 	script->set_path(p_path, true);
 	script->set_script_path(p_path);
-	script->load_source_code(p_path);
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		script->load_byte_code(remapped_path);
+	} else {
+		script->load_source_code(p_path);
+	}
 
 	singleton->shallow_gdscript_cache[p_path] = script.ptr();
 	return script;
@@ -200,7 +220,12 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 	Ref<GDScript> script = get_shallow_script(p_path);
 	ERR_FAIL_COND_V(script.is_null(), Ref<GDScript>());
 
-	r_error = script->load_source_code(p_path);
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		r_error = script->load_byte_code(remapped_path);
+	} else {
+		r_error = script->load_source_code(p_path);
+	}
 
 	if (r_error) {
 		return script;
@@ -241,11 +266,146 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	return err;
 }
 
+static String _get_startup_dependency_path(const String &p_path) {
+	if (!p_path.begins_with("uid://")) {
+		return p_path;
+	}
+	ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(p_path);
+	if (uid == ResourceUID::INVALID_ID || !ResourceUID::get_singleton()->has_id(uid)) {
+		return String();
+	}
+	return ResourceUID::get_singleton()->get_id_path(uid);
+}
+
+void GDScriptCache::_parse_startup_script(uint32_t p_index, Ref<GDScriptParserRef> *p_parsers) {
+	p_parsers[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
+void GDScriptCache::_sort_startup_scripts(const String &p_path, const HashMap<String, Vector<String>> &p_graph, HashSet<String> &r_visited, Vector<String> &r_order) {
+	if (r_visited.has(p_path)) {
+		return;
+	}
+	r_visited.insert(p_path);
+
+	const Vector<String> *deps = p_graph.getptr(p_path);
+	if (deps == nullptr) {
+		return;
+	}
+	for (int i = 0; i < deps->size(); i++) {
+		_sort_startup_scripts((*deps)[i], p_graph, r_visited, r_order);
+	}
+	if (p_path.get_extension().to_lower() == "gd") {
+		r_order.push_back(p_path);
+	}
+}
+
+void GDScriptCache::prepare_startup_scripts(const Vector<String> &p_paths) {
+	// Fill the tables the parser initializes lazily before any worker thread can race for them.
+	GDScriptParser::get_builtin_type("int");
+
+	Vector<String> roots;
+	for (int i = 0; i < p_paths.size(); i++) {
+		roots.push_back(_get_startup_dependency_path(p_paths[i]));
+	}
+
+	HashMap<String, Vector<String>> graph;
+	Vector<String> wave = roots;
+
+	// Scripts are parsed one wave at a time, each wave holding the not yet seen dependencies of the previous one.
+	// Other resources (such as scenes) are only walked for the scripts they use.
+	while (!wave.is_empty()) {
+		Vector<Ref<GDScriptParserRef>> parsers;
+
+		for (int i = 0; i < wave.size(); i++) {
+			const String path = wave[i];
+			if (path.is_empty() || graph.has(path)) {
+				continue;
+			}
+			graph.insert(path, Vector<String>());
+
+			if (path.get_extension().to_lower() == "gd") {
+				Error err = OK;
+				Ref<GDScriptParserRef> ref = get_parser(path, GDScriptParserRef::EMPTY, err);
+				if (ref.is_valid() && ref->get_status() == GDScriptParserRef::EMPTY) {
+					parsers.push_back(ref);
+				}
+			} else if (ResourceLoader::exists(path)) {
+				List<String> deps;
+				ResourceLoader::get_dependencies(path, &deps);
+				Vector<String> &edges = graph[path];
+				for (const String &E : deps) {
+					String dep_path = _get_startup_dependency_path(E);
+					edges.push_back(dep_path);
+					wave.push_back(dep_path);
+				}
+			}
+		}
+
+		if (parsers.is_empty()) {
+			break;
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(singleton, &GDScriptCache::_parse_startup_script, parsers.ptrw(), parsers.size(), -1, true, SNAME("GDScriptStartupParse"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		wave.clear();
+		for (int i = 0; i < parsers.size(); i++) {
+			const Ref<GDScriptParserRef> &ref = parsers[i];
+			singleton->startup_parsers.push_back(ref);
+			if (ref->result != OK) {
+				continue;
+			}
+
+			Vector<String> &edges = graph[ref->path];
+			for (const String &E : ref->get_parser()->get_dependencies()) {
+				edges.push_back(E);
+				wave.push_back(E);
+			}
+
+			const GDScriptParser::ClassNode *tree = ref->get_parser()->get_tree();
+			if (tree != nullptr && tree->extends_path.is_empty() && !tree->extends.is_empty() && ScriptServer::is_global_class(tree->extends[0])) {
+				String base_path = ScriptServer::get_global_class_path(tree->extends[0]);
+				edges.push_back(base_path);
+				wave.push_back(base_path);
+			}
+		}
+	}
+
+	// Compile in dependency order, so each script finds what it extends and preloads already compiled.
+	HashSet<String> visited;
+	Vector<String> order;
+	for (int i = 0; i < roots.size(); i++) {
+		_sort_startup_scripts(roots[i], graph, visited, order);
+	}
+
+	for (int i = 0; i < order.size(); i++) {
+		MutexLock lock(singleton->lock);
+		GDScriptParserRef *const *ref = singleton->parser_map.getptr(order[i]);
+		if (ref == nullptr || (*ref)->result != OK) {
+			// Leave broken scripts to the regular loading, which reports their errors.
+			continue;
+		}
+
+		Error err = OK;
+		Ref<GDScript> script = get_full_script(order[i], err);
+		if (err == OK && script.is_valid()) {
+			singleton->startup_scripts.push_back(script);
+		}
+	}
+}
+
+void GDScriptCache::release_startup_scripts() {
+	singleton->startup_parsers.clear();
+	singleton->startup_scripts.clear();
+}
+
 GDScriptCache::GDScriptCache() {
 	singleton = this;
 }
 
 GDScriptCache::~GDScriptCache() {
+	startup_parsers.clear();
+	startup_scripts.clear();
 	parser_map.clear();
 	shallow_gdscript_cache.clear();
 	full_gdscript_cache.clear();
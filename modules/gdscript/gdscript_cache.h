@@ -81,16 +81,27 @@ class GDScriptCache {
 
 	static GDScriptCache *singleton;
 
+	// Kept alive from the startup pre-pass until the first frame, so the scenes loaded meanwhile reuse them.
+	Vector<Ref<GDScriptParserRef>> startup_parsers;
+	Vector<Ref<GDScript>> startup_scripts;
+
 	Mutex lock;
 	static void remove_script(const String &p_path);
 
+	void _parse_startup_script(uint32_t p_index, Ref<GDScriptParserRef> *p_parsers);
+	static void _sort_startup_scripts(const String &p_path, const HashMap<String, Vector<String>> &p_graph, HashSet<String> &r_visited, Vector<String> &r_order);
+
 public:
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
 	static String get_source_code(const String &p_path);
+	static Vector<uint8_t> get_binary_tokens(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Error finish_compiling(const String &p_owner);
 
+	static void prepare_startup_scripts(const Vector<String> &p_paths);
+	static void release_startup_scripts();
+
 	GDScriptCache();
 	~GDScriptCache();
 };
@@ -867,6 +867,12 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 		case GDScriptParser::Node::TERNARY_OPERATOR: {
 			// x IF a ELSE y operator with early out on failure.
 			const GDScriptParser::TernaryOpNode *ternary = static_cast<const GDScriptParser::TernaryOpNode *>(p_expression);
+
+			if (optimization_level >= OPTIMIZATION_BASIC && ternary->condition->is_constant) {
+				// Only the expression that would be picked needs to be evaluated.
+				return _parse_expression(codegen, r_error, ternary->condition->reduced_value.booleanize() ? ternary->true_expr : ternary->false_expr);
+			}
+
 			GDScriptCodeGenerator::Address result = codegen.add_temporary(_gdtype_from_datatype(ternary->get_datatype()));
 
 			gen->write_start_ternary(result);
@@ -1205,7 +1211,10 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					gen->write_call(GDScriptCodeGenerator::Address(), GDScriptCodeGenerator::Address(GDScriptCodeGenerator::Address::SELF), setter_function, args);
 				} else {
 					// Just assign.
-					if (assignment->use_conversion_assign) {
+					Variant converted;
+					if (assignment->use_conversion_assign && !has_operation && _convert_constant_for_assign(assignment->assigned_value, target.type, converted)) {
+						gen->write_assign(target, codegen.add_constant(converted));
+					} else if (assignment->use_conversion_assign) {
 						gen->write_assign_with_conversion(target, to_assign);
 					} else {
 						gen->write_assign(target, to_assign);
@@ -1649,6 +1658,27 @@ void GDScriptCompiler::_add_locals_in_block(CodeGen &codegen, const GDScriptPars
 	}
 }
 
+bool GDScriptCompiler::_convert_constant_for_assign(const GDScriptParser::ExpressionNode *p_expression, const GDScriptDataType &p_type, Variant &r_value) const {
+	if (optimization_level < OPTIMIZATION_BASIC || !p_expression->is_constant || !p_type.has_type || p_type.kind != GDScriptDataType::BUILTIN || p_type.has_container_element_type()) {
+		return false;
+	}
+
+	// Same conversion OPCODE_ASSIGN_TYPED_BUILTIN does when running, done once here instead.
+	const Variant &value = p_expression->reduced_value;
+	if (value.get_type() == p_type.builtin_type) {
+		r_value = value;
+		return true;
+	}
+	if (!Variant::can_convert_strict(value.get_type(), p_type.builtin_type)) {
+		return false; // Keep the error for runtime.
+	}
+
+	const Variant *args[1] = { &value };
+	Callable::CallError ce;
+	Variant::construct(p_type.builtin_type, r_value, args, 1, ce);
+	return ce.error == Callable::CallError::CALL_OK;
+}
+
 Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block, bool p_add_locals) {
 	Error error = OK;
 	GDScriptCodeGenerator *gen = codegen.generator;
@@ -1753,6 +1783,19 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
+
+				if (optimization_level >= OPTIMIZATION_BASIC && if_n->condition->is_constant) {
+					// Only compile the block that would run.
+					const GDScriptParser::SuiteNode *block = if_n->condition->reduced_value.booleanize() ? if_n->true_block : if_n->false_block;
+					if (block) {
+						error = _parse_block(codegen, block);
+						if (error) {
+							return error;
+						}
+					}
+					break;
+				}
+
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, error, if_n->condition);
 				if (error) {
 					return error;
@@ -1813,6 +1856,11 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			case GDScriptParser::Node::WHILE: {
 				const GDScriptParser::WhileNode *while_n = static_cast<const GDScriptParser::WhileNode *>(s);
 
+				if (optimization_level >= OPTIMIZATION_BASIC && while_n->condition->is_constant && !while_n->condition->reduced_value.booleanize()) {
+					// The loop never runs.
+					break;
+				}
+
 				gen->start_while_condition();
 
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, error, while_n->condition);
@@ -1908,6 +1956,12 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 							codegen.generator->write_construct_array(local, Vector<GDScriptCodeGenerator::Address>());
 						}
 					}
+					Variant converted;
+					if (lv->use_conversion_assign && _convert_constant_for_assign(lv->initializer, local.type, converted)) {
+						gen->write_assign(local, codegen.add_constant(converted));
+						break;
+					}
+
 					GDScriptCodeGenerator::Address src_address = _parse_expression(codegen, error, lv->initializer);
 					if (error) {
 						return error;
@@ -1958,6 +2012,11 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 				}
 			} break;
 		}
+
+		if (optimization_level >= OPTIMIZATION_BASIC && (s->type == GDScriptParser::Node::RETURN || s->type == GDScriptParser::Node::BREAK || s->type == GDScriptParser::Node::CONTINUE)) {
+			// The rest of the block can't be reached.
+			break;
+		}
 	}
 
 	codegen.end_block();
@@ -2048,19 +2107,24 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 						codegen.generator->write_construct_array(dst_address, Vector<GDScriptCodeGenerator::Address>());
 					}
 				}
-				GDScriptCodeGenerator::Address src_address = _parse_expression(codegen, r_error, field->initializer, false, true);
-				if (r_error) {
-					memdelete(codegen.generator);
-					return nullptr;
-				}
-
-				if (field->use_conversion_assign) {
-					codegen.generator->write_assign_with_conversion(dst_address, src_address);
+				Variant converted;
+				if (field->use_conversion_assign && _convert_constant_for_assign(field->initializer, dst_address.type, converted)) {
+					codegen.generator->write_assign(dst_address, codegen.add_constant(converted));
 				} else {
-					codegen.generator->write_assign(dst_address, src_address);
-				}
-				if (src_address.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
-					codegen.generator->pop_temporary();
+					GDScriptCodeGenerator::Address src_address = _parse_expression(codegen, r_error, field->initializer, false, true);
+					if (r_error) {
+						memdelete(codegen.generator);
+						return nullptr;
+					}
+
+					if (field->use_conversion_assign) {
+						codegen.generator->write_assign_with_conversion(dst_address, src_address);
+					} else {
+						codegen.generator->write_assign(dst_address, src_address);
+					}
+					if (src_address.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
 				}
 			} else if (field->get_datatype().is_hard_type()) {
 				codegen.generator->write_newline(field->start_line);
@@ -2246,6 +2310,8 @@ Error GDScriptCompiler::_parse_class_level(GDScript *p_script, const GDScriptPar
 	}
 	p_script->member_functions.clear();
 	p_script->member_indices.clear();
+	// Member indices are cached by the VM.
+	GDScriptFunction::inline_cache_version.increment();
 	p_script->member_info.clear();
 	p_script->_signals.clear();
 	p_script->initializer = nullptr;
@@ -2670,6 +2736,7 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	error = "";
 	parser = p_parser;
 	main_script = p_script;
+	optimization_level = GLOBAL_GET("debug/settings/gdscript/optimization_level");
 	const GDScriptParser::ClassNode *root = parser->get_tree();
 
 	source = p_script->get_path();
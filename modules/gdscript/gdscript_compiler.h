@@ -38,6 +38,14 @@
 #include "gdscript_parser.h"
 
 class GDScriptCompiler {
+public:
+	enum OptimizationLevel {
+		OPTIMIZATION_NONE,
+		// Skips unreachable statements and branches behind constant conditions, and converts constants to the type they are assigned to at compile time.
+		OPTIMIZATION_BASIC,
+	};
+
+private:
 	const GDScriptParser *parser = nullptr;
 	HashSet<GDScript *> parsed_classes;
 	HashSet<GDScript *> parsing_classes;
@@ -122,6 +130,7 @@ class GDScriptCompiler {
 	Error _create_binary_operator(CodeGen &codegen, const GDScriptParser::ExpressionNode *p_left_operand, const GDScriptParser::ExpressionNode *p_right_operand, Variant::Operator op, bool p_initializer = false, const GDScriptCodeGenerator::Address &p_index_addr = GDScriptCodeGenerator::Address());
 
 	GDScriptDataType _gdtype_from_datatype(const GDScriptParser::DataType &p_datatype, GDScript *p_owner = nullptr) const;
+	bool _convert_constant_for_assign(const GDScriptParser::ExpressionNode *p_expression, const GDScriptDataType &p_type, Variant &r_value) const;
 
 	GDScriptCodeGenerator::Address _parse_assign_right_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::AssignmentNode *p_assignmentint, const GDScriptCodeGenerator::Address &p_index_addr = GDScriptCodeGenerator::Address());
 	GDScriptCodeGenerator::Address _parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root = false, bool p_initializer = false, const GDScriptCodeGenerator::Address &p_index_addr = GDScriptCodeGenerator::Address());
@@ -138,6 +147,7 @@ class GDScriptCompiler {
 	StringName source;
 	String error;
 	bool within_await = false;
+	int optimization_level = OPTIMIZATION_BASIC;
 
 public:
 	Error compile(const GDScriptParser *p_parser, GDScript *p_script, bool p_keep_state = false);
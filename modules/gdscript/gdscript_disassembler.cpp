@@ -134,6 +134,33 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_TYPED(m_op_name, m_op, m_v_type) \
+	case OPCODE_OPERATOR_##m_op_name##_##m_v_type: {          \
+		text += "operator (";                                 \
+		text += #m_v_type;                                    \
+		text += ") ";                                         \
+		text += DADDR(3);                                     \
+		text += " = ";                                        \
+		text += DADDR(1);                                     \
+		text += " " #m_op " ";                                \
+		text += DADDR(2);                                     \
+		incr += 4;                                            \
+	} break
+
+#define DISASSEMBLE_OPERATORS_TYPED(m_v_type)               \
+	DISASSEMBLE_OPERATOR_TYPED(ADD, +, m_v_type);           \
+	DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, -, m_v_type);      \
+	DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, *, m_v_type);      \
+	DISASSEMBLE_OPERATOR_TYPED(EQUAL, ==, m_v_type);        \
+	DISASSEMBLE_OPERATOR_TYPED(NOT_EQUAL, !=, m_v_type);    \
+	DISASSEMBLE_OPERATOR_TYPED(LESS, <, m_v_type);          \
+	DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL, <=, m_v_type);   \
+	DISASSEMBLE_OPERATOR_TYPED(GREATER, >, m_v_type);       \
+	DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL, >=, m_v_type)
+
+				DISASSEMBLE_OPERATORS_TYPED(INT);
+				DISASSEMBLE_OPERATORS_TYPED(FLOAT);
 			case OPCODE_EXTENDS_TEST: {
 				text += "is object ";
 				text += DADDR(3);
@@ -217,6 +244,38 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_INDEXED_PACKED_ARRAY(m_var_type)       \
+	case OPCODE_SET_INDEXED_PACKED_##m_var_type##_ARRAY: { \
+		text += "set indexed (Packed";                     \
+		text += #m_var_type;                               \
+		text += "Array) ";                                 \
+		text += DADDR(1);                                  \
+		text += "[";                                       \
+		text += DADDR(2);                                  \
+		text += "] = ";                                    \
+		text += DADDR(3);                                  \
+		incr += 4;                                         \
+	} break;                                               \
+	case OPCODE_GET_INDEXED_PACKED_##m_var_type##_ARRAY: { \
+		text += "get indexed (Packed";                     \
+		text += #m_var_type;                               \
+		text += "Array) ";                                 \
+		text += DADDR(3);                                  \
+		text += " = ";                                     \
+		text += DADDR(1);                                  \
+		text += "[";                                       \
+		text += DADDR(2);                                  \
+		text += "]";                                       \
+		incr += 4;                                         \
+	} break
+
+				DISASSEMBLE_INDEXED_PACKED_ARRAY(BYTE);
+				DISASSEMBLE_INDEXED_PACKED_ARRAY(INT32);
+				DISASSEMBLE_INDEXED_PACKED_ARRAY(INT64);
+				DISASSEMBLE_INDEXED_PACKED_ARRAY(FLOAT32);
+				DISASSEMBLE_INDEXED_PACKED_ARRAY(FLOAT64);
+
 			case OPCODE_SET_NAMED: {
 				text += "set_named ";
 				text += DADDR(1);
@@ -246,7 +305,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -509,7 +568,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
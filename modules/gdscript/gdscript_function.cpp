@@ -30,8 +30,11 @@
 
 #include "gdscript_function.h"
 
+#include "core/templates/hashfuncs.h"
 #include "gdscript.h"
 
+SafeNumeric<uint64_t> GDScriptFunction::inline_cache_version(1);
+
 const int *GDScriptFunction::get_code() const {
 	return _code_ptr;
 }
@@ -148,11 +151,39 @@ GDScriptFunction::GDScriptFunction() {
 #endif
 }
 
+Vector<uint8_t> GDScriptFunction::_take_await_stack() {
+	Vector<uint8_t> stack;
+	MutexLock lock(await_stack_pool_mutex);
+	if (!await_stack_pool.is_empty()) {
+		stack = await_stack_pool[await_stack_pool.size() - 1];
+		await_stack_pool.resize(await_stack_pool.size() - 1);
+	}
+	return stack;
+}
+
+void GDScriptFunction::_release_await_stack(Vector<uint8_t> &p_stack) {
+	MutexLock lock(await_stack_pool_mutex);
+	if (await_stack_pool.size() < MAX_POOLED_AWAIT_STACKS) {
+		await_stack_pool.push_back(p_stack);
+	}
+	p_stack = Vector<uint8_t>();
+}
+
 GDScriptFunction::~GDScriptFunction() {
+	// Other functions may have cached this one.
+	inline_cache_version.increment();
+
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
 
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+	for (uint32_t i = 0; i < inline_cache_entries.size(); i++) {
+		memdelete(inline_cache_entries[i]);
+	}
+
 #ifdef DEBUG_ENABLED
 
 	MutexLock lock(GDScriptLanguage::get_singleton()->lock);
@@ -240,6 +271,8 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 		instances_list.remove_from_list();
 	}
 
+	GDScriptFunction *resumed_function = function;
+
 	state.result = p_arg;
 	Callable::CallError err;
 	Variant ret = function->call(nullptr, nullptr, 0, err, &state);
@@ -275,6 +308,10 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 #endif
 	}
 
+	// The variants on the stack are destroyed by now, either when finishing or when copied to the state of the next `await`.
+	state.stack_size = 0;
+	resumed_function->_release_await_stack(state.stack);
+
 	return ret;
 }
 
@@ -297,6 +334,60 @@ void GDScriptFunctionState::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::NIL, "result", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NIL_IS_VARIANT)));
 }
 
+bool GDScriptFunctionStateCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
+	// Each `await` connects its own callable, so they are only compared by reference.
+	return p_a == p_b;
+}
+
+bool GDScriptFunctionStateCallable::compare_less(const CallableCustom *p_a, const CallableCustom *p_b) {
+	return p_a < p_b;
+}
+
+uint32_t GDScriptFunctionStateCallable::hash() const {
+	return h;
+}
+
+String GDScriptFunctionStateCallable::get_as_text() const {
+	return "GDScriptFunctionState::_signal_callback";
+}
+
+CallableCustom::CompareEqualFunc GDScriptFunctionStateCallable::get_compare_equal_func() const {
+	return compare_equal;
+}
+
+CallableCustom::CompareLessFunc GDScriptFunctionStateCallable::get_compare_less_func() const {
+	return compare_less;
+}
+
+ObjectID GDScriptFunctionStateCallable::get_object() const {
+	return state->get_instance_id();
+}
+
+void GDScriptFunctionStateCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
+	r_call_error.error = Callable::CallError::CALL_OK;
+
+	// Same as _signal_callback(), without the state bound as the last argument.
+	Variant arg;
+	if (p_argcount == 1) {
+		arg = *p_arguments[0];
+	} else if (p_argcount > 1) {
+		Array extra_args;
+		for (int i = 0; i < p_argcount; i++) {
+			extra_args.push_back(*p_arguments[i]);
+		}
+		arg = extra_args;
+	}
+
+	// Keep the state alive until it finishes resuming, as the oneshot connection holding it may be released meanwhile.
+	Ref<GDScriptFunctionState> self = state;
+	r_return_value = self->resume(arg);
+}
+
+GDScriptFunctionStateCallable::GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_state) {
+	state = p_state;
+	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
+}
+
 GDScriptFunctionState::GDScriptFunctionState() :
 		scripts_list(this),
 		instances_list(this) {
@@ -33,8 +33,10 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -219,14 +221,42 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_EQUAL_INT,
+		OPCODE_OPERATOR_NOT_EQUAL_INT,
+		OPCODE_OPERATOR_LESS_INT,
+		OPCODE_OPERATOR_LESS_EQUAL_INT,
+		OPCODE_OPERATOR_GREATER_INT,
+		OPCODE_OPERATOR_GREATER_EQUAL_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_EQUAL_FLOAT,
+		OPCODE_OPERATOR_NOT_EQUAL_FLOAT,
+		OPCODE_OPERATOR_LESS_FLOAT,
+		OPCODE_OPERATOR_LESS_EQUAL_FLOAT,
+		OPCODE_OPERATOR_GREATER_FLOAT,
+		OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,
 		OPCODE_EXTENDS_TEST,
 		OPCODE_IS_BUILTIN,
 		OPCODE_SET_KEYED,
 		OPCODE_SET_KEYED_VALIDATED,
 		OPCODE_SET_INDEXED_VALIDATED,
+		OPCODE_SET_INDEXED_PACKED_BYTE_ARRAY,
+		OPCODE_SET_INDEXED_PACKED_INT32_ARRAY,
+		OPCODE_SET_INDEXED_PACKED_INT64_ARRAY,
+		OPCODE_SET_INDEXED_PACKED_FLOAT32_ARRAY,
+		OPCODE_SET_INDEXED_PACKED_FLOAT64_ARRAY,
 		OPCODE_GET_KEYED,
 		OPCODE_GET_KEYED_VALIDATED,
 		OPCODE_GET_INDEXED_VALIDATED,
+		OPCODE_GET_INDEXED_PACKED_BYTE_ARRAY,
+		OPCODE_GET_INDEXED_PACKED_INT32_ARRAY,
+		OPCODE_GET_INDEXED_PACKED_INT64_ARRAY,
+		OPCODE_GET_INDEXED_PACKED_FLOAT32_ARRAY,
+		OPCODE_GET_INDEXED_PACKED_FLOAT64_ARRAY,
 		OPCODE_SET_NAMED,
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
@@ -429,10 +459,42 @@ public:
 		StringName identifier;
 	};
 
+	// Bumped whenever a script function goes away or a script layout changes, invalidating inline cache entries.
+	static SafeNumeric<uint64_t> inline_cache_version;
+
 private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 
+	// What an untyped call or named get resolved to for a given receiver. The key is the script of the
+	// receiver (or null for objects without one) together with its native class.
+	struct InlineCacheTarget {
+		const void *script_key = nullptr;
+		const void *class_key = nullptr;
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+		int member_index = -1;
+
+		bool operator==(const InlineCacheTarget &p_other) const {
+			return script_key == p_other.script_key && class_key == p_other.class_key && function == p_other.function && method == p_other.method && member_index == p_other.member_index;
+		}
+	};
+
+	// Targets are immutable once published and stay alive until the function goes away. Only the version
+	// changes, when the same target is resolved again after the entry got outdated, so it can be reused.
+	struct InlineCacheEntry : public InlineCacheTarget {
+		SafeNumeric<uint64_t> version;
+
+		InlineCacheEntry(const InlineCacheTarget &p_target, uint64_t p_version) :
+				InlineCacheTarget(p_target), version(p_version) {}
+	};
+
+	// One per OPCODE_CALL and OPCODE_GET_NAMED site, holding a few receiver types (polymorphic).
+	struct InlineCache {
+		static const int SIZE = 4;
+		SafeNumeric<InlineCacheEntry *> entries[SIZE];
+	};
+
 	StringName source;
 
 	mutable Variant nil;
@@ -468,6 +530,8 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	int _lambdas_count = 0;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	int _inline_caches_count = 0;
+	InlineCache *_inline_caches_ptr = nullptr;
 	const int *_code_ptr = nullptr;
 	int _code_size = 0;
 	int _argument_count = 0;
@@ -504,6 +568,16 @@ private:
 
 	HashMap<int, Variant::Type> temporary_slots;
 
+	Mutex inline_cache_mutex;
+	LocalVector<InlineCacheEntry *> inline_cache_entries;
+
+	// Stack buffers of resumed coroutines, reused by the next `await` in this function instead of allocating a new one.
+	enum {
+		MAX_POOLED_AWAIT_STACKS = 16,
+	};
+	Mutex await_stack_pool_mutex;
+	LocalVector<Vector<uint8_t>> await_stack_pool;
+
 #ifdef TOOLS_ENABLED
 	Vector<StringName> arg_names;
 	Vector<Variant> default_arg_values;
@@ -516,6 +590,15 @@ private:
 	_FORCE_INLINE_ Variant *_get_variant(int p_address, GDScriptInstance *p_instance, Variant *p_stack, String &r_error) const;
 	_FORCE_INLINE_ String _get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const;
 
+	static _FORCE_INLINE_ uint64_t _get_inline_cache_version();
+	void _add_inline_cache_entry(InlineCache &p_cache, const InlineCacheTarget &p_target, uint64_t p_version);
+	bool _call_inline_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	bool _get_named_inline_cached(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+
+	Vector<uint8_t> _take_await_stack();
+	void _release_await_stack(Vector<uint8_t> &p_stack);
+
+	friend class GDScriptFunctionState;
 	friend class GDScriptLanguage;
 
 	SelfList<GDScriptFunction> function_list{ this };
@@ -534,6 +617,18 @@ private:
 		uint64_t last_frame_call_count = 0;
 		uint64_t last_frame_self_time = 0;
 		uint64_t last_frame_total_time = 0;
+
+		// Filled by the sampling profiler instead of the timings above, per line of the function.
+		struct LineSamples {
+			StringName signature;
+			uint64_t self_samples = 0;
+			uint64_t total_samples = 0;
+			uint64_t frame_self_samples = 0;
+			uint64_t frame_total_samples = 0;
+			uint64_t last_frame_self_samples = 0;
+			uint64_t last_frame_total_samples = 0;
+		};
+		HashMap<int, LineSamples> line_samples;
 	} profile;
 
 #endif
@@ -607,6 +702,7 @@ public:
 class GDScriptFunctionState : public RefCounted {
 	GDCLASS(GDScriptFunctionState, RefCounted);
 	friend class GDScriptFunction;
+	friend class GDScriptFunctionStateCallable;
 	GDScriptFunction *function = nullptr;
 	GDScriptFunction::CallState state;
 	Variant _signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -628,4 +724,24 @@ public:
 	~GDScriptFunctionState();
 };
 
+// Connected by `await` to resume the state directly, without binding it to a method callable.
+class GDScriptFunctionStateCallable : public CallableCustom {
+	Ref<GDScriptFunctionState> state;
+	uint32_t h = 0;
+
+	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
+	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
+
+public:
+	uint32_t hash() const override;
+	String get_as_text() const override;
+	CompareEqualFunc get_compare_equal_func() const override;
+	CompareLessFunc get_compare_less_func() const override;
+	ObjectID get_object() const override;
+	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
+
+	GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_state);
+	virtual ~GDScriptFunctionStateCallable() = default;
+};
+
 #endif // GDSCRIPT_FUNCTION_H
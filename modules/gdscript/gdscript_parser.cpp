@@ -164,10 +164,28 @@ void GDScriptParser::clear() {
 	_is_tool = false;
 	for_completion = false;
 	errors.clear();
+	dependencies.clear();
+	dependency_set.clear();
 	multiline_stack.clear();
 	nodes_in_progress.clear();
 }
 
+void GDScriptParser::add_dependency(const String &p_path) {
+	if (p_path.is_empty()) {
+		return;
+	}
+	// Resolve the path the same way the analyzer does.
+	String path = p_path;
+	if (path.is_relative_path()) {
+		path = script_path.get_base_dir().plus_file(path);
+	}
+	path = path.simplify_path();
+	if (!dependency_set.has(path)) {
+		dependency_set.insert(path);
+		dependencies.push_back(path);
+	}
+}
+
 void GDScriptParser::push_error(const String &p_message, const Node *p_origin) {
 	// TODO: Improve error reporting by pointing at source code.
 	// TODO: Errors might point at more than one place at once (e.g. show previous declaration).
@@ -358,6 +376,25 @@ Error GDScriptParser::parse(const String &p_source_code, const String &p_script_
 	tokenizer.set_source_code(source);
 	tokenizer.set_cursor_position(cursor_line, cursor_column);
 	script_path = p_script_path;
+
+	return _parse();
+}
+
+Error GDScriptParser::parse_binary(const Vector<uint8_t> &p_binary_tokens, const String &p_script_path) {
+	clear();
+	for_completion = false;
+	script_path = p_script_path;
+
+	Error err = tokenizer.set_binary_tokens(p_binary_tokens);
+	if (err != OK) {
+		push_error(vformat(R"(Could not load the binary tokens of script "%s".)", p_script_path));
+		return err;
+	}
+
+	return _parse();
+}
+
+Error GDScriptParser::_parse() {
 	current = tokenizer.scan();
 	// Avoid error or newline as the first token.
 	// The latter can mess with the parser when opening files filled exclusively with comments and newlines.
@@ -715,6 +752,7 @@ void GDScriptParser::parse_extends() {
 			push_error(vformat(R"(Only strings or identifiers can be used after "extends", found "%s" instead.)", Variant::get_type_name(previous.literal.get_type())));
 		}
 		current_class->extends_path = previous.literal;
+		add_dependency(current_class->extends_path);
 
 		if (!match(GDScriptTokenizer::Token::PERIOD)) {
 			return;
@@ -3072,6 +3110,8 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	if (preload->path == nullptr) {
 		push_error(R"(Expected resource path after "(".)");
+	} else if (preload->path->type == Node::LITERAL && static_cast<LiteralNode *>(preload->path)->value.get_type() == Variant::STRING) {
+		add_dependency(static_cast<LiteralNode *>(preload->path)->value);
 	}
 
 	pop_completion_call();
@@ -1223,6 +1223,8 @@ private:
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
+	List<String> dependencies;
+	HashSet<String> dependency_set;
 #ifdef DEBUG_ENABLED
 	List<GDScriptWarning> warnings;
 	HashSet<String> ignored_warnings;
@@ -1321,6 +1323,7 @@ private:
 	}
 	void clear();
 	void push_error(const String &p_message, const Node *p_origin = nullptr);
+	void add_dependency(const String &p_path);
 #ifdef DEBUG_ENABLED
 	void push_warning(const Node *p_source, GDScriptWarning::Code p_code, const String &p_symbol1 = String(), const String &p_symbol2 = String(), const String &p_symbol3 = String(), const String &p_symbol4 = String());
 	void push_warning(const Node *p_source, GDScriptWarning::Code p_code, const Vector<String> &p_symbols);
@@ -1426,8 +1429,12 @@ private:
 	void get_class_doc_comment(int p_line, String &p_brief, String &p_desc, Vector<Pair<String, String>> &p_tutorials, bool p_inner_class);
 #endif // TOOLS_ENABLED
 
+	Error _parse();
+
 public:
 	Error parse(const String &p_source_code, const String &p_script_path, bool p_for_completion);
+	// Parses the tokens made by GDScriptTokenizer::get_binary_tokens(), as exported scripts are saved.
+	Error parse_binary(const Vector<uint8_t> &p_binary_tokens, const String &p_script_path);
 	ClassNode *get_tree() const { return head; }
 	bool is_tool() const { return _is_tool; }
 	static Variant::Type get_builtin_type(const StringName &p_type);
@@ -1438,10 +1445,8 @@ public:
 	bool annotation_exists(const String &p_annotation_name) const;
 
 	const List<ParserError> &get_errors() const { return errors; }
-	const List<String> get_dependencies() const {
-		// TODO: Keep track of deps.
-		return List<String>();
-	}
+	// Scripts and resources this script extends or preloads by a constant path, resolved to absolute paths.
+	const List<String> &get_dependencies() const { return dependencies; }
 #ifdef DEBUG_ENABLED
 	const List<GDScriptWarning> &get_warnings() const { return warnings; }
 	const HashSet<int> &get_unsafe_lines() const { return unsafe_lines; }
@@ -31,6 +31,8 @@
 #include "gdscript_tokenizer.h"
 
 #include "core/error/error_macros.h"
+#include "core/io/marshalls.h"
+#include "core/templates/local_vector.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_settings.h"
@@ -1239,6 +1241,10 @@ void GDScriptTokenizer::_skip_whitespace() {
 }
 
 GDScriptTokenizer::Token GDScriptTokenizer::scan() {
+	if (binary_mode) {
+		return _scan_binary();
+	}
+
 	if (has_error()) {
 		return pop_error();
 	}
@@ -1303,6 +1309,7 @@ GDScriptTokenizer::Token GDScriptTokenizer::scan() {
 		_advance();
 		newline(false);
 		line_continuation = true;
+		continuation_lines.insert(line);
 		return scan(); // Recurse to get next token.
 	}
 
@@ -1514,3 +1521,315 @@ GDScriptTokenizer::GDScriptTokenizer() {
 	}
 #endif // TOOLS_ENABLED
 }
+
+// Binary tokens.
+//
+// Made by scanning the source code in multiline mode, so there are no newline or indentation tokens, with the first token of each line flagged.
+// _scan_binary() gives again the newlines and indentation changes before the flagged tokens depending on the multiline mode the parser is in, like scan() does.
+//
+// Layout, all integers are little endian:
+// - "GDSC", then the version, identifier count, constant count and token count as 32-bit integers.
+// - The identifiers as UTF-8 strings, and the constants as encoded variants, each after its size.
+// - The tokens: one byte with the type and the line start flag, the index of the identifier or constant if the type has one,
+//   then the start line relative to the previous token, the amount of lines the token spans, and the start and end columns.
+// Sizes, indices, lines and columns are stored in a variable length encoding, seven bits per byte.
+
+#define BINARY_TOKENS_HEADER_SIZE 20
+#define BINARY_TOKEN_LINE_START 0x80
+#define BINARY_TOKEN_TYPE_MASK 0x7F
+
+static_assert(GDScriptTokenizer::Token::TK_MAX <= BINARY_TOKEN_TYPE_MASK, "Token types must fit in the type bits of binary tokens.");
+
+static void _encode_binary_uint(LocalVector<uint8_t> &r_buffer, uint32_t p_value) {
+	while (p_value >= 0x80) {
+		r_buffer.push_back(uint8_t(p_value & 0x7F) | 0x80);
+		p_value >>= 7;
+	}
+	r_buffer.push_back(uint8_t(p_value));
+}
+
+static bool _decode_binary_uint(const uint8_t *p_buffer, int p_size, int &r_pos, uint32_t &r_value) {
+	r_value = 0;
+	for (int shift = 0; shift < 32; shift += 7) {
+		if (r_pos >= p_size) {
+			return false;
+		}
+		uint8_t byte = p_buffer[r_pos++];
+		r_value |= uint32_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool _binary_token_has_identifier(const GDScriptTokenizer::Token &p_token) {
+	// Keywords keep their source too, as they can be used as node names.
+	return p_token.type == GDScriptTokenizer::Token::ANNOTATION || p_token.is_node_name() || p_token.is_identifier();
+}
+
+Vector<uint8_t> GDScriptTokenizer::get_binary_tokens(const String &p_source_code) {
+	GDScriptTokenizer tokenizer;
+	tokenizer.set_source_code(p_source_code);
+	tokenizer.set_multiline_mode(true);
+
+	HashMap<StringName, uint32_t> identifier_map;
+	LocalVector<StringName> identifiers;
+	HashMap<Variant, uint32_t, VariantHasher, VariantComparator> constant_map;
+	LocalVector<Variant> constants;
+	LocalVector<uint8_t> token_data;
+	uint32_t token_count = 0;
+	int previous_start_line = 1;
+	int previous_end_line = 0;
+
+	for (Token token = tokenizer.scan(); token.type != Token::TK_EOF; token = tokenizer.scan()) {
+		if (token.type == Token::ERROR) {
+			return Vector<uint8_t>();
+		}
+		if (token.type == Token::NEWLINE || token.type == Token::INDENT || token.type == Token::DEDENT) {
+			continue;
+		}
+		ERR_FAIL_COND_V(token.start_line < previous_start_line, Vector<uint8_t>());
+
+		bool line_start = token.start_line > previous_end_line && !tokenizer.continuation_lines.has(token.start_line);
+		token_data.push_back(uint8_t(token.type) | (line_start ? BINARY_TOKEN_LINE_START : 0));
+
+		if (token.type == Token::LITERAL) {
+			if (!constant_map.has(token.literal)) {
+				constant_map[token.literal] = constants.size();
+				constants.push_back(token.literal);
+			}
+			_encode_binary_uint(token_data, constant_map[token.literal]);
+		} else if (_binary_token_has_identifier(token)) {
+			StringName identifier = token.source;
+			if (!identifier_map.has(identifier)) {
+				identifier_map[identifier] = identifiers.size();
+				identifiers.push_back(identifier);
+			}
+			_encode_binary_uint(token_data, identifier_map[identifier]);
+		}
+
+		_encode_binary_uint(token_data, token.start_line - previous_start_line);
+		_encode_binary_uint(token_data, token.end_line - token.start_line);
+		_encode_binary_uint(token_data, MAX(token.start_column, 0));
+		_encode_binary_uint(token_data, MAX(token.end_column, 0));
+
+		previous_start_line = token.start_line;
+		previous_end_line = token.end_line;
+		token_count++;
+	}
+
+	LocalVector<uint8_t> buffer;
+	buffer.resize(BINARY_TOKENS_HEADER_SIZE);
+	buffer[0] = 'G';
+	buffer[1] = 'D';
+	buffer[2] = 'S';
+	buffer[3] = 'C';
+	encode_uint32(BINARY_TOKENS_VERSION, &buffer[4]);
+	encode_uint32(identifiers.size(), &buffer[8]);
+	encode_uint32(constants.size(), &buffer[12]);
+	encode_uint32(token_count, &buffer[16]);
+
+	for (uint32_t i = 0; i < identifiers.size(); i++) {
+		CharString utf8 = String(identifiers[i]).utf8();
+		_encode_binary_uint(buffer, utf8.length());
+		for (int j = 0; j < utf8.length(); j++) {
+			buffer.push_back(uint8_t(utf8[j]));
+		}
+	}
+
+	for (uint32_t i = 0; i < constants.size(); i++) {
+		int len = 0;
+		Error err = encode_variant(constants[i], nullptr, len, false);
+		ERR_FAIL_COND_V(err != OK, Vector<uint8_t>());
+		_encode_binary_uint(buffer, len);
+		uint32_t pos = buffer.size();
+		buffer.resize(pos + len);
+		encode_variant(constants[i], &buffer[pos], len, false);
+	}
+
+	uint32_t pos = buffer.size();
+	buffer.resize(pos + token_data.size());
+	memcpy(&buffer[pos], token_data.ptr(), token_data.size());
+
+	Vector<uint8_t> result;
+	result.resize(buffer.size());
+	memcpy(result.ptrw(), buffer.ptr(), buffer.size());
+	return result;
+}
+
+Error GDScriptTokenizer::set_binary_tokens(const Vector<uint8_t> &p_binary_tokens) {
+	const uint8_t *buffer = p_binary_tokens.ptr();
+	const int size = p_binary_tokens.size();
+
+	ERR_FAIL_COND_V_MSG(size < BINARY_TOKENS_HEADER_SIZE || buffer[0] != 'G' || buffer[1] != 'D' || buffer[2] != 'S' || buffer[3] != 'C', ERR_INVALID_DATA, "Invalid binary GDScript tokens.");
+
+	uint32_t version = decode_uint32(&buffer[4]);
+	ERR_FAIL_COND_V_MSG(version != BINARY_TOKENS_VERSION, ERR_INVALID_DATA, vformat("Binary GDScript tokens of version %d can't be loaded by this version of the engine, which expects version %d. The project needs to be exported again.", version, BINARY_TOKENS_VERSION));
+
+	uint32_t identifier_count = decode_uint32(&buffer[8]);
+	uint32_t constant_count = decode_uint32(&buffer[12]);
+	uint32_t token_count = decode_uint32(&buffer[16]);
+	int pos = BINARY_TOKENS_HEADER_SIZE;
+
+	// Every entry takes at least one byte, which bounds the counts before allocating.
+	ERR_FAIL_COND_V(identifier_count > uint32_t(size) || constant_count > uint32_t(size) || token_count > uint32_t(size), ERR_INVALID_DATA);
+
+	LocalVector<StringName> identifiers;
+	identifiers.resize(identifier_count);
+	for (uint32_t i = 0; i < identifier_count; i++) {
+		uint32_t len = 0;
+		ERR_FAIL_COND_V(!_decode_binary_uint(buffer, size, pos, len) || len > uint32_t(size - pos), ERR_INVALID_DATA);
+		String identifier;
+		ERR_FAIL_COND_V(identifier.parse_utf8((const char *)&buffer[pos], len) != OK, ERR_INVALID_DATA);
+		identifiers[i] = identifier;
+		pos += len;
+	}
+
+	LocalVector<Variant> constants;
+	constants.resize(constant_count);
+	for (uint32_t i = 0; i < constant_count; i++) {
+		uint32_t len = 0;
+		ERR_FAIL_COND_V(!_decode_binary_uint(buffer, size, pos, len) || len > uint32_t(size - pos), ERR_INVALID_DATA);
+		Error err = decode_variant(constants[i], &buffer[pos], len, nullptr, false);
+		ERR_FAIL_COND_V(err != OK, ERR_INVALID_DATA);
+		pos += len;
+	}
+
+	binary_tokens.resize(token_count);
+	binary_line_starts.resize(token_count);
+	Token *tokens = binary_tokens.ptrw();
+	bool *line_starts = binary_line_starts.ptrw();
+	int token_line = 1;
+
+	for (uint32_t i = 0; i < token_count; i++) {
+		ERR_FAIL_COND_V(pos >= size, ERR_INVALID_DATA);
+		uint8_t header = buffer[pos++];
+
+		Token &token = tokens[i];
+		token.type = Token::Type(header & BINARY_TOKEN_TYPE_MASK);
+		ERR_FAIL_COND_V(token.type >= Token::TK_MAX, ERR_INVALID_DATA);
+		line_starts[i] = header & BINARY_TOKEN_LINE_START;
+
+		uint32_t index = 0;
+		if (token.type == Token::LITERAL) {
+			ERR_FAIL_COND_V(!_decode_binary_uint(buffer, size, pos, index) || index >= constant_count, ERR_INVALID_DATA);
+			token.literal = constants[index];
+		} else if (_binary_token_has_identifier(token)) {
+			ERR_FAIL_COND_V(!_decode_binary_uint(buffer, size, pos, index) || index >= identifier_count, ERR_INVALID_DATA);
+			token.source = identifiers[index];
+			if (token.type == Token::IDENTIFIER || token.type == Token::ANNOTATION) {
+				token.literal = identifiers[index];
+			}
+		}
+
+		uint32_t line_offset = 0, line_span = 0, from_column = 0, to_column = 0;
+		ERR_FAIL_COND_V(!_decode_binary_uint(buffer, size, pos, line_offset) || !_decode_binary_uint(buffer, size, pos, line_span), ERR_INVALID_DATA);
+		ERR_FAIL_COND_V(!_decode_binary_uint(buffer, size, pos, from_column) || !_decode_binary_uint(buffer, size, pos, to_column), ERR_INVALID_DATA);
+
+		token_line += line_offset;
+		token.start_line = token_line;
+		token.end_line = token_line + line_span;
+		token.start_column = from_column;
+		token.end_column = to_column;
+		token.leftmost_column = MIN(token.start_column, token.end_column);
+		token.rightmost_column = MAX(token.start_column, token.end_column);
+	}
+
+	binary_mode = true;
+	binary_line_checked = false;
+	binary_ended = false;
+	position = 0;
+	line = 1;
+	column = 1;
+	pending_indents = 0;
+	indent_stack.clear();
+	indent_stack_stack.clear();
+	error_stack.clear();
+
+	return OK;
+}
+
+GDScriptTokenizer::Token GDScriptTokenizer::_scan_binary() {
+	if (has_error()) {
+		return pop_error();
+	}
+
+	if (pending_indents != 0) {
+		Token indent(pending_indents > 0 ? Token::INDENT : Token::DEDENT);
+		pending_indents += pending_indents > 0 ? -1 : 1;
+		indent.start_line = line;
+		indent.end_line = line;
+		indent.start_column = 1;
+		indent.end_column = 1;
+		return indent;
+	}
+
+	if (position >= binary_tokens.size()) {
+		if (!binary_ended) {
+			// Like at the end of the source code, add a newline and dedent all the levels.
+			binary_ended = true;
+			pending_indents -= indent_level();
+			indent_stack.clear();
+			if (!multiline_mode) {
+				Token newline(Token::NEWLINE);
+				newline.start_line = line;
+				newline.end_line = line;
+				return newline;
+			}
+			return _scan_binary();
+		}
+		Token eof(Token::TK_EOF);
+		eof.start_line = line;
+		eof.end_line = line;
+		return eof;
+	}
+
+	const Token &token = binary_tokens[position];
+
+	if (binary_line_starts[position] && !binary_line_checked) {
+		binary_line_checked = true;
+
+		if (!multiline_mode) {
+			int newline_line = line;
+			line = token.start_line;
+
+			// Same indentation rules as check_indent().
+			int indent_count = token.start_column - 1;
+			int previous_indent = indent_level() > 0 ? indent_stack.back()->get() : 0;
+			if (indent_count > previous_indent) {
+				indent_stack.push_back(indent_count);
+				pending_indents++;
+			} else if (indent_count < previous_indent) {
+				while (indent_level() > 0 && indent_stack.back()->get() > indent_count) {
+					indent_stack.pop_back();
+					pending_indents--;
+				}
+				if ((indent_level() > 0 && indent_stack.back()->get() != indent_count) || (indent_level() == 0 && indent_count != 0)) {
+					Token error(Token::ERROR);
+					error.literal = "Unindent doesn't match the previous indentation level.";
+					error.start_line = line;
+					error.end_line = line;
+					error.start_column = 1;
+					error.end_column = token.start_column;
+					push_error(error);
+					indent_stack.push_back(indent_count);
+				}
+			}
+
+			if (position > 0) {
+				Token newline(Token::NEWLINE);
+				newline.start_line = newline_line;
+				newline.end_line = newline_line;
+				return newline;
+			}
+			return _scan_binary();
+		}
+	}
+
+	binary_line_checked = false;
+	position++;
+	line = token.end_line;
+	column = token.end_column;
+	return token;
+}
@@ -183,6 +183,11 @@ public:
 		}
 	};
 
+	enum {
+		// Bump whenever the binary token format or the Token::Type values change.
+		BINARY_TOKENS_VERSION = 1,
+	};
+
 #ifdef TOOLS_ENABLED
 	struct CommentData {
 		String comment;
@@ -224,6 +229,14 @@ private:
 	char32_t indent_char = '\0';
 	int position = 0;
 	int length = 0;
+	HashSet<int> continuation_lines; // Lines following a backslash, which don't start a new statement.
+
+	// Binary tokens, see set_binary_tokens().
+	bool binary_mode = false;
+	Vector<Token> binary_tokens;
+	Vector<bool> binary_line_starts; // Whether each token is the first of a line, so the indentation is checked before it.
+	bool binary_line_checked = false; // Whether the newline and indentation before the current token were already given.
+	bool binary_ended = false;
 
 #ifdef TOOLS_ENABLED
 	HashMap<int, CommentData> comments;
@@ -256,10 +269,16 @@ private:
 	Token string();
 	Token annotation();
 
+	Token _scan_binary();
+
 public:
 	Token scan();
 
 	void set_source_code(const String &p_source_code);
+	// Tokens previously made with get_binary_tokens(), which are then given by scan() as if they were scanned from the source code.
+	Error set_binary_tokens(const Vector<uint8_t> &p_binary_tokens);
+	// Returns an empty array if the source code has any tokenizer error.
+	static Vector<uint8_t> get_binary_tokens(const String &p_source_code);
 
 	int get_cursor_line() const;
 	int get_cursor_column() const;
@@ -32,6 +32,7 @@
 
 #include "core/core_string_names.h"
 #include "core/os/os.h"
+#include "core/os/profiling.h"
 #include "gdscript.h"
 #include "gdscript_lambda_callable.h"
 
@@ -155,6 +156,170 @@ Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataT
 	return Variant();
 }
 
+uint64_t GDScriptFunction::_get_inline_cache_version() {
+	// Both counters only grow, so their sum changes whenever either of them does.
+	return inline_cache_version.get() + ClassDB::method_cache_version.get();
+}
+
+void GDScriptFunction::_add_inline_cache_entry(InlineCache &p_cache, const InlineCacheTarget &p_target, uint64_t p_version) {
+	MutexLock lock(inline_cache_mutex);
+
+	// Take the first empty or outdated slot. Once all of them hold valid entries, the site is megamorphic and stays on the regular path.
+	int slot = -1;
+	for (int i = 0; i < InlineCache::SIZE; i++) {
+		InlineCacheEntry *entry = p_cache.entries[i].get();
+		if (!entry) {
+			slot = i;
+			break;
+		}
+		if (entry->version.get() != p_version) {
+			if (*entry == p_target) {
+				entry->version.set(p_version); // Resolved the same way again.
+				return;
+			}
+			slot = i;
+			break;
+		}
+		if (entry->script_key == p_target.script_key && entry->class_key == p_target.class_key) {
+			return; // Added by another thread meanwhile.
+		}
+	}
+	if (slot == -1) {
+		return;
+	}
+
+	// Replaced entries may still be read by other threads, so they can't be freed before the function is.
+	// Reuse one holding the same target instead, readers only ever see its version change.
+	InlineCacheEntry *entry = nullptr;
+	for (uint32_t i = 0; i < inline_cache_entries.size(); i++) {
+		if (*inline_cache_entries[i] == p_target) {
+			entry = inline_cache_entries[i];
+			entry->version.set(p_version);
+			break;
+		}
+	}
+	if (!entry) {
+		entry = memnew(InlineCacheEntry(p_target, p_version));
+		inline_cache_entries.push_back(entry);
+	}
+	p_cache.entries[slot].set(entry);
+}
+
+bool GDScriptFunction::_call_inline_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+#ifdef DEBUG_ENABLED
+	Object *obj = p_base->get_validated_object();
+#else
+	Object *obj = p_base->operator Object *();
+#endif
+	if (unlikely(!obj)) {
+		return false; // Let the regular call report it.
+	}
+
+	GDScriptInstance *instance = nullptr;
+	if (ScriptInstance *script_instance = obj->get_script_instance()) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return false;
+		}
+		instance = static_cast<GDScriptInstance *>(script_instance);
+	}
+
+	const void *script_key = instance ? instance->script.ptr() : nullptr;
+	const void *class_key = obj->get_class_name().data_unique_pointer();
+	uint64_t version = _get_inline_cache_version();
+
+	for (int i = 0; i < InlineCache::SIZE; i++) {
+		const InlineCacheEntry *entry = p_cache.entries[i].get();
+		if (!entry) {
+			break;
+		}
+		if (entry->script_key == script_key && entry->class_key == class_key && entry->version.get() == version) {
+			r_err.error = Callable::CallError::CALL_OK;
+			if (entry->function) {
+				r_ret = entry->function->call(instance, p_args, p_argcount, r_err);
+			} else {
+				r_ret = entry->method->call(obj, p_args, p_argcount, r_err);
+			}
+			return true;
+		}
+	}
+
+	// Resolve it the way Object::callp() does, so the next call with this receiver type hits.
+	// Calls Object::callp() handles on its own are left alone.
+	if (p_method == CoreStringNames::get_singleton()->_free || (instance && p_method == SNAME("_ready"))) {
+		return false;
+	}
+
+	InlineCacheTarget entry;
+	entry.script_key = script_key;
+	entry.class_key = class_key;
+	for (GDScript *sptr = instance ? instance->script.ptr() : nullptr; sptr; sptr = sptr->_base) {
+		HashMap<StringName, GDScriptFunction *>::Iterator E = sptr->member_functions.find(p_method);
+		if (E) {
+			entry.function = E->value;
+			break;
+		}
+	}
+	if (!entry.function) {
+		entry.method = ClassDB::get_method(obj->get_class_name(), p_method);
+		if (!entry.method) {
+			return false;
+		}
+	}
+	_add_inline_cache_entry(p_cache, entry, version);
+
+	return false;
+}
+
+bool GDScriptFunction::_get_named_inline_cached(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+#ifdef DEBUG_ENABLED
+	Object *obj = p_base->get_validated_object();
+#else
+	Object *obj = p_base->operator Object *();
+#endif
+	if (unlikely(!obj)) {
+		return false;
+	}
+
+	// Only members of GDScript instances are cached, those are looked up before anything else.
+	ScriptInstance *script_instance = obj->get_script_instance();
+	if (!script_instance || script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+		return false;
+	}
+	GDScriptInstance *instance = static_cast<GDScriptInstance *>(script_instance);
+
+	const void *script_key = instance->script.ptr();
+	uint64_t version = _get_inline_cache_version();
+
+	for (int i = 0; i < InlineCache::SIZE; i++) {
+		const InlineCacheEntry *entry = p_cache.entries[i].get();
+		if (!entry) {
+			break;
+		}
+		if (entry->script_key == script_key && entry->version.get() == version && likely(entry->member_index < instance->members.size())) {
+			r_ret = instance->members[entry->member_index];
+			return true;
+		}
+	}
+
+	HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = instance->script->member_indices.find(p_name);
+	if (!E || E->value.getter) {
+		return false;
+	}
+
+	InlineCacheTarget entry;
+	entry.script_key = script_key;
+	entry.member_index = E->value.index;
+	_add_inline_cache_entry(p_cache, entry, version);
+
+	return false;
+}
+
 String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const {
 	String err_text;
 
@@ -232,14 +397,42 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {        \
 		&&OPCODE_OPERATOR,                           \
 		&&OPCODE_OPERATOR_VALIDATED,                 \
+		&&OPCODE_OPERATOR_ADD_INT,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,              \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,              \
+		&&OPCODE_OPERATOR_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_LESS_INT,                  \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,            \
+		&&OPCODE_OPERATOR_GREATER_INT,               \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,         \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                 \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,            \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,            \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,               \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,           \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,          \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,             \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,       \
 		&&OPCODE_EXTENDS_TEST,                       \
 		&&OPCODE_IS_BUILTIN,                         \
 		&&OPCODE_SET_KEYED,                          \
 		&&OPCODE_SET_KEYED_VALIDATED,                \
 		&&OPCODE_SET_INDEXED_VALIDATED,              \
+		&&OPCODE_SET_INDEXED_PACKED_BYTE_ARRAY,      \
+		&&OPCODE_SET_INDEXED_PACKED_INT32_ARRAY,     \
+		&&OPCODE_SET_INDEXED_PACKED_INT64_ARRAY,     \
+		&&OPCODE_SET_INDEXED_PACKED_FLOAT32_ARRAY,   \
+		&&OPCODE_SET_INDEXED_PACKED_FLOAT64_ARRAY,   \
 		&&OPCODE_GET_KEYED,                          \
 		&&OPCODE_GET_KEYED_VALIDATED,                \
 		&&OPCODE_GET_INDEXED_VALIDATED,              \
+		&&OPCODE_GET_INDEXED_PACKED_BYTE_ARRAY,      \
+		&&OPCODE_GET_INDEXED_PACKED_INT32_ARRAY,     \
+		&&OPCODE_GET_INDEXED_PACKED_INT64_ARRAY,     \
+		&&OPCODE_GET_INDEXED_PACKED_FLOAT32_ARRAY,   \
+		&&OPCODE_GET_INDEXED_PACKED_FLOAT64_ARRAY,   \
 		&&OPCODE_SET_NAMED,                          \
 		&&OPCODE_SET_NAMED_VALIDATED,                \
 		&&OPCODE_GET_NAMED,                          \
@@ -474,6 +667,8 @@ void (*type_init_function_table[])(Variant *) = {
 #define OP_GET_RID get_rid
 
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
+	PROFILE_ZONE_TEXT("GDScriptFunction::call", String(name));
+
 	OPCODES_TABLE;
 
 	if (!_code_ptr) {
@@ -706,6 +901,32 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			// Same as the validated operators for these types, without the call through the evaluator.
+#define OPCODE_OPERATOR_TYPED(m_op_name, m_op, m_v_type, m_type, m_ret_type)                                                \
+	OPCODE(OPCODE_OPERATOR_##m_op_name##_##m_v_type) {                                                                      \
+		CHECK_SPACE(4);                                                                                                     \
+		GET_INSTRUCTION_ARG(a, 0);                                                                                          \
+		GET_INSTRUCTION_ARG(b, 1);                                                                                          \
+		GET_INSTRUCTION_ARG(dst, 2);                                                                                        \
+		*VariantInternal::get_##m_ret_type(dst) = *VariantInternal::get_##m_type(a) m_op *VariantInternal::get_##m_type(b); \
+		ip += 4;                                                                                                            \
+	}                                                                                                                       \
+	DISPATCH_OPCODE
+
+#define OPCODE_OPERATORS_TYPED(m_v_type, m_type)                     \
+	OPCODE_OPERATOR_TYPED(ADD, +, m_v_type, m_type, m_type);         \
+	OPCODE_OPERATOR_TYPED(SUBTRACT, -, m_v_type, m_type, m_type);    \
+	OPCODE_OPERATOR_TYPED(MULTIPLY, *, m_v_type, m_type, m_type);    \
+	OPCODE_OPERATOR_TYPED(EQUAL, ==, m_v_type, m_type, bool);        \
+	OPCODE_OPERATOR_TYPED(NOT_EQUAL, !=, m_v_type, m_type, bool);    \
+	OPCODE_OPERATOR_TYPED(LESS, <, m_v_type, m_type, bool);          \
+	OPCODE_OPERATOR_TYPED(LESS_EQUAL, <=, m_v_type, m_type, bool);   \
+	OPCODE_OPERATOR_TYPED(GREATER, >, m_v_type, m_type, bool);       \
+	OPCODE_OPERATOR_TYPED(GREATER_EQUAL, >=, m_v_type, m_type, bool)
+
+			OPCODE_OPERATORS_TYPED(INT, int);
+			OPCODE_OPERATORS_TYPED(FLOAT, float);
+
 			OPCODE(OPCODE_EXTENDS_TEST) {
 				CHECK_SPACE(4);
 
@@ -883,6 +1104,42 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			// Numeric packed arrays with known element types are written straight into their storage.
+#ifdef DEBUG_ENABLED
+#define DEBUG_OOB_BREAK(m_what, m_base)                                                                                        \
+	err_text = "Out of bounds " m_what " index '" + index->operator String() + "' (on base: '" + _get_var_type(m_base) + "')"; \
+	OPCODE_BREAK
+#else
+#define DEBUG_OOB_BREAK(m_what, m_base)
+#endif
+
+#define OPCODE_SET_INDEXED_PACKED_ARRAY(m_var_type, m_elem_type, m_get_func, m_value_get_func) \
+	OPCODE(OPCODE_SET_INDEXED_PACKED_##m_var_type##_ARRAY) {                                   \
+		CHECK_SPACE(4);                                                                        \
+		GET_INSTRUCTION_ARG(dst, 0);                                                           \
+		GET_INSTRUCTION_ARG(index, 1);                                                         \
+		GET_INSTRUCTION_ARG(value, 2);                                                         \
+		Vector<m_elem_type> *array = VariantInternal::m_get_func(dst);                         \
+		int64_t int_index = *VariantInternal::get_int(index);                                  \
+		int64_t size = array->size();                                                          \
+		if (int_index < 0) {                                                                   \
+			int_index += size;                                                                 \
+		}                                                                                      \
+		if (likely(int_index >= 0 && int_index < size)) {                                      \
+			array->ptrw()[int_index] = (m_elem_type)*VariantInternal::m_value_get_func(value); \
+		} else {                                                                               \
+			DEBUG_OOB_BREAK("set", dst);                                                       \
+		}                                                                                      \
+		ip += 4;                                                                               \
+	}                                                                                          \
+	DISPATCH_OPCODE
+
+			OPCODE_SET_INDEXED_PACKED_ARRAY(BYTE, uint8_t, get_byte_array, get_int);
+			OPCODE_SET_INDEXED_PACKED_ARRAY(INT32, int32_t, get_int32_array, get_int);
+			OPCODE_SET_INDEXED_PACKED_ARRAY(INT64, int64_t, get_int64_array, get_int);
+			OPCODE_SET_INDEXED_PACKED_ARRAY(FLOAT32, float, get_float32_array, get_float);
+			OPCODE_SET_INDEXED_PACKED_ARRAY(FLOAT64, double, get_float64_array, get_float);
+
 			OPCODE(OPCODE_GET_KEYED) {
 				CHECK_SPACE(3);
 
@@ -983,6 +1240,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_GET_INDEXED_PACKED_ARRAY(m_var_type, m_elem_type, m_get_func, m_ret_type, m_ret_get_func) \
+	OPCODE(OPCODE_GET_INDEXED_PACKED_##m_var_type##_ARRAY) {                                             \
+		CHECK_SPACE(4);                                                                                  \
+		GET_INSTRUCTION_ARG(src, 0);                                                                     \
+		GET_INSTRUCTION_ARG(index, 1);                                                                   \
+		GET_INSTRUCTION_ARG(dst, 2);                                                                     \
+		const Vector<m_elem_type> *array = VariantInternal::m_get_func((const Variant *)src);            \
+		int64_t int_index = *VariantInternal::get_int(index);                                            \
+		int64_t size = array->size();                                                                    \
+		if (int_index < 0) {                                                                             \
+			int_index += size;                                                                           \
+		}                                                                                                \
+		if (likely(int_index >= 0 && int_index < size)) {                                                \
+			m_ret_type element = array->ptr()[int_index];                                                \
+			VariantTypeAdjust<m_ret_type>::adjust(dst);                                                  \
+			*VariantInternal::m_ret_get_func(dst) = element;                                             \
+		} else {                                                                                         \
+			DEBUG_OOB_BREAK("get", src);                                                                 \
+		}                                                                                                \
+		ip += 4;                                                                                         \
+	}                                                                                                    \
+	DISPATCH_OPCODE
+
+			OPCODE_GET_INDEXED_PACKED_ARRAY(BYTE, uint8_t, get_byte_array, int64_t, get_int);
+			OPCODE_GET_INDEXED_PACKED_ARRAY(INT32, int32_t, get_int32_array, int64_t, get_int);
+			OPCODE_GET_INDEXED_PACKED_ARRAY(INT64, int64_t, get_int64_array, int64_t, get_int);
+			OPCODE_GET_INDEXED_PACKED_ARRAY(FLOAT32, float, get_float32_array, double, get_float);
+			OPCODE_GET_INDEXED_PACKED_ARRAY(FLOAT64, double, get_float64_array, double, get_float);
+
 			OPCODE(OPCODE_SET_NAMED) {
 				CHECK_SPACE(3);
 
@@ -1024,7 +1310,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_INSTRUCTION_ARG(src, 0);
 				GET_INSTRUCTION_ARG(dst, 1);
@@ -1034,22 +1320,23 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				// Goes through a copy, as src and dst may be the same stack position.
+				Variant ret;
+				if (unlikely(!_get_named_inline_cached(_inline_caches_ptr[cache_idx], src, *index, ret))) {
+					bool valid;
+					ret = src->get_named(*index, valid);
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
-					OPCODE_BREAK;
+					if (!valid) {
+						err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
+						OPCODE_BREAK;
+					}
+#endif
 				}
 				*dst = ret;
-#endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1504,7 +1791,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_CALL_ASYNC)
 			OPCODE(OPCODE_CALL_RETURN)
 			OPCODE(OPCODE_CALL) {
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 				bool call_ret = (_code_ptr[ip] & INSTR_MASK) != OPCODE_CALL;
 #ifdef DEBUG_ENABLED
 				bool call_async = (_code_ptr[ip] & INSTR_MASK) == OPCODE_CALL_ASYNC;
@@ -1519,6 +1806,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				InlineCache &inline_cache = _inline_caches_ptr[cache_idx];
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1533,7 +1824,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (unlikely(!_call_inline_cached(inline_cache, base, *methodname, (const Variant **)argptrs, argc, *ret, err))) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (!call_async && ret->get_type() == Variant::OBJECT) {
 						// Check if getting a function state without await.
@@ -1552,7 +1845,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
-					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					if (unlikely(!_call_inline_cached(inline_cache, base, *methodname, (const Variant **)argptrs, argc, ret, err))) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling) {
@@ -1597,7 +1892,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2204,6 +2499,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
+					gdfs->state.stack = _take_await_stack();
 					gdfs->state.stack.resize(alloca_size);
 
 					// First 3 stack addresses are special, so we just skip them here.
@@ -2234,7 +2530,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 					retvalue = gdfs;
 
-					Error err = sig.connect(callable_bind(Callable(gdfs.ptr(), "_signal_callback"), retvalue), Object::CONNECT_ONESHOT);
+					Error err = sig.connect(Callable(memnew(GDScriptFunctionStateCallable(gdfs))), Object::CONNECT_ONESHOT);
 					if (err != OK) {
 						err_text = "Error connecting to signal: " + sig.get_name() + " during await.";
 						OPCODE_BREAK;
@@ -85,8 +85,20 @@ public:
 			return;
 		}
 
-		// TODO: Re-add compiled GDScript on export.
-		return;
+		// Save the tokens instead of the source code, so they don't need to be scanned on load.
+		// The script is remapped to the binary file, scripts that fail to tokenize are exported as text so their errors still show up.
+		String source = GDScriptCache::get_source_code(p_path);
+		if (source.is_empty()) {
+			return;
+		}
+
+		Vector<uint8_t> binary_tokens = GDScriptTokenizer::get_binary_tokens(source);
+		if (binary_tokens.is_empty()) {
+			WARN_PRINT(vformat("Script \"%s\" has errors, exporting its source code instead of binary tokens.", p_path));
+			return;
+		}
+
+		add_file(p_path.get_basename() + ".gdc", binary_tokens, true);
 	}
 };
 
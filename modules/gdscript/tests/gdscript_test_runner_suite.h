@@ -31,6 +31,7 @@
 #ifndef GDSCRIPT_TEST_RUNNER_SUITE_H
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
+#include "../gdscript_tokenizer.h"
 #include "gdscript_test_runner.h"
 #include "tests/test_macros.h"
 
@@ -69,6 +70,38 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Load binary tokens and run them") {
+	const Vector<uint8_t> binary_tokens = GDScriptTokenizer::get_binary_tokens(R"(
+extends RefCounted
+
+func _init():
+	var values = [1,
+			2, 3]
+	var sum = func(p_values):
+		var total = 0
+		for value in p_values:
+			total += value
+		return total
+	if sum.call(values) == 6 \
+			and values.map(func(p_value):
+				return p_value * 2
+			).size() == 3:
+		set_meta("result", 42)
+)");
+	REQUIRE_MESSAGE(!binary_tokens.is_empty(), "The source code should be tokenized successfully.");
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_binary_tokens_source(binary_tokens);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(error == OK, "The binary tokens should parse successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should run the same as from source code.");
+}
+
 } // namespace GDScriptTests
 
 #endif // GDSCRIPT_TEST_RUNNER_SUITE_H
@@ -0,0 +1,25 @@
+signal no_args
+signal one_arg(value)
+signal two_args(a, b)
+
+
+func waiter(id):
+	for i in 3:
+		var value = await one_arg
+		print(id, ": ", value, " at ", i)
+	await no_args
+	print(id, ": no args")
+	var pair = await two_args
+	print(id, ": ", pair)
+
+
+func test():
+	var waiters = [waiter(1), waiter(2)]
+	print(waiters[0].is_valid())
+	one_arg.emit("a")
+	print(waiters[0].is_valid())
+	one_arg.emit("b")
+	one_arg.emit("c")
+	no_args.emit()
+	two_args.emit(3, 4)
+	one_arg.emit("not awaited anymore")
@@ -0,0 +1,24 @@
+const ENABLED = true
+const DISABLED = false
+
+var member: float = 1
+
+func test():
+	if DISABLED:
+		print("not printed")
+	elif ENABLED:
+		print("elif taken")
+	else:
+		print("not printed")
+
+	while DISABLED:
+		print("not printed")
+
+	var picked = "true branch" if ENABLED else "false branch"
+	print(picked)
+
+	var converted: float = 2
+	print(typeof(converted) == TYPE_FLOAT)
+	print(typeof(member) == TYPE_FLOAT)
+	converted = 3
+	print(typeof(converted) == TYPE_FLOAT)
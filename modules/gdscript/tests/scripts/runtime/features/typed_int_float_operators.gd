@@ -0,0 +1,22 @@
+func test():
+	var a: int = 7
+	var b: int = -3
+	print(a + b)
+	print(a - b)
+	print(a * b)
+	print(a == b, a != b, a < b, a <= b, a > b, a >= b)
+
+	var x: float = 1.5
+	var y: float = 0.25
+	print(x + y)
+	print(x - y)
+	print(x * y)
+	print(x == y, x != y, x < y, x <= y, x > y, x >= y)
+
+	# Loop counters and accumulators stay typed.
+	var total: int = 0
+	var i: int = 0
+	while i < 10:
+		total = total + i * i
+		i = i + 1
+	print(total)
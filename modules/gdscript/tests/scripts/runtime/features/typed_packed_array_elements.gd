@@ -0,0 +1,23 @@
+func test():
+	var floats := PackedFloat32Array([0.5, 1.5, 2.5])
+	var sum: float = 0.0
+	for i in floats.size():
+		sum += floats[i]
+	print(sum)
+
+	floats[0] = 4.0
+	floats[-1] += 1.0
+	print(floats)
+
+	var bytes := PackedByteArray([1, 2, 3])
+	bytes[1] = 7
+	print(bytes[1], " ", bytes[-1])
+
+	var ints := PackedInt64Array([10, 20])
+	ints[1] *= 3
+	print(ints)
+
+	# Writing goes to this copy only.
+	var copy := ints
+	copy[0] = -1
+	print(ints, " ", copy)
@@ -0,0 +1,38 @@
+class A:
+	var value = "A value"
+	func describe():
+		return "A"
+
+class B extends A:
+	var other = 0
+	var computed = 1:
+		get:
+			return 2
+	func describe():
+		return "B extends " + super()
+
+class C:
+	var value = "C value"
+	func describe():
+		return "C"
+
+func test():
+	# The same call sites see several receiver types, more than once each.
+	var receivers = [A.new(), B.new(), C.new(), A.new(), B.new(), C.new()]
+	for receiver in receivers:
+		print(receiver.describe())
+		print(receiver.value)
+
+	var b = B.new()
+	for i in 2:
+		print(b.computed)
+
+	# Native methods, with and without a script.
+	var objects = [RefCounted.new(), A.new(), RefCounted.new(), A.new()]
+	for object in objects:
+		print(object.get_class())
+
+	# Not objects at all.
+	var values = ["abc", [1, 2], "de"]
+	for value in values:
+		print(value.size() if value is Array else value.length())
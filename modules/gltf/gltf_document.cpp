@@ -44,6 +44,7 @@
 #include "core/io/stream_peer.h"
 #include "core/math/disjoint_set.h"
 #include "core/math/vector2.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/dictionary.h"
 #include "core/variant/typed_array.h"
 #include "core/variant/variant.h"
@@ -1297,7 +1298,38 @@ Error GLTFDocument::_encode_buffer_view(Ref<GLTFState> state, const double *src,
 	return OK;
 }
 
-Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> state, double *dst, const GLTFBufferViewIndex p_buffer_view, const int skip_every, const int skip_bytes, const int element_size, const int count, const GLTFType type, const int component_count, const int component_type, const int component_size, const bool normalized, const int byte_offset, const bool for_vertex) {
+template <class T, class S>
+static void _decode_buffer_view_components(T *p_dst, const uint8_t *p_src, const int p_count, const int p_stride, const int p_component_count, const int p_skip_every, const int p_skip_bytes, const double p_normalize_divisor) {
+	if constexpr (std::is_same_v<T, S>) {
+		if (p_normalize_divisor == 0.0 && !p_skip_every && p_stride == p_component_count * int(sizeof(S))) {
+			// Tightly packed and already in the destination type, nothing to convert.
+			memcpy(p_dst, p_src, sizeof(S) * p_count * p_component_count);
+			return;
+		}
+	}
+
+	for (int i = 0; i < p_count; i++) {
+		const uint8_t *src = p_src + i * p_stride;
+
+		for (int j = 0; j < p_component_count; j++) {
+			if (p_skip_every && j > 0 && (j % p_skip_every) == 0) {
+				src += p_skip_bytes;
+			}
+
+			S s;
+			memcpy(&s, src, sizeof(S));
+			if (p_normalize_divisor != 0.0) {
+				*p_dst++ = T(double(s) / p_normalize_divisor);
+			} else {
+				*p_dst++ = T(s);
+			}
+			src += sizeof(S);
+		}
+	}
+}
+
+template <class T>
+Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> state, T *dst, const GLTFBufferViewIndex p_buffer_view, const int skip_every, const int skip_bytes, const int element_size, const int count, const GLTFType type, const int component_count, const int component_type, const int component_size, const bool normalized, const int byte_offset, const bool for_vertex) {
 	const Ref<GLTFBufferView> bv = state->buffer_views[p_buffer_view];
 
 	int stride = element_size;
@@ -1323,61 +1355,29 @@ Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> state, double *dst, const
 
 	ERR_FAIL_COND_V((int)(offset + buffer_end) > buffer.size(), ERR_PARSE_ERROR);
 
-	//fill everything as doubles
-
-	for (int i = 0; i < count; i++) {
-		const uint8_t *src = &bufptr[offset + i * stride];
-
-		for (int j = 0; j < component_count; j++) {
-			if (skip_every && j > 0 && (j % skip_every) == 0) {
-				src += skip_bytes;
-			}
-
-			double d = 0;
-
-			switch (component_type) {
-				case COMPONENT_TYPE_BYTE: {
-					int8_t b = int8_t(*src);
-					if (normalized) {
-						d = (double(b) / 128.0);
-					} else {
-						d = double(b);
-					}
-				} break;
-				case COMPONENT_TYPE_UNSIGNED_BYTE: {
-					uint8_t b = *src;
-					if (normalized) {
-						d = (double(b) / 255.0);
-					} else {
-						d = double(b);
-					}
-				} break;
-				case COMPONENT_TYPE_SHORT: {
-					int16_t s = *(int16_t *)src;
-					if (normalized) {
-						d = (double(s) / 32768.0);
-					} else {
-						d = double(s);
-					}
-				} break;
-				case COMPONENT_TYPE_UNSIGNED_SHORT: {
-					uint16_t s = *(uint16_t *)src;
-					if (normalized) {
-						d = (double(s) / 65535.0);
-					} else {
-						d = double(s);
-					}
-				} break;
-				case COMPONENT_TYPE_INT: {
-					d = *(int *)src;
-				} break;
-				case COMPONENT_TYPE_FLOAT: {
-					d = *(float *)src;
-				} break;
-			}
-
-			*dst++ = d;
-			src += component_size;
+	// Convert straight to the destination type, picking the source type once for the whole view.
+	const uint8_t *src = &bufptr[offset];
+	switch (component_type) {
+		case COMPONENT_TYPE_BYTE: {
+			_decode_buffer_view_components<T, int8_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 128.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_UNSIGNED_BYTE: {
+			_decode_buffer_view_components<T, uint8_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 255.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_SHORT: {
+			_decode_buffer_view_components<T, int16_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 32768.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_UNSIGNED_SHORT: {
+			_decode_buffer_view_components<T, uint16_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 65535.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_INT: {
+			_decode_buffer_view_components<T, int32_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, 0.0);
+		} break;
+		case COMPONENT_TYPE_FLOAT: {
+			_decode_buffer_view_components<T, float>(dst, src, count, stride, component_count, skip_every, skip_bytes, 0.0);
+		} break;
+		default: {
+			memset(dst, 0, sizeof(T) * count * component_count);
 		}
 	}
 
@@ -1405,21 +1405,26 @@ int GLTFDocument::_get_component_type_size(const int component_type) {
 	return 0;
 }
 
-Vector<double> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
+int GLTFDocument::_get_accessor_component_count(const GLTFType p_type) {
+	const int component_count_for_type[7] = {
+		1, 2, 3, 4, 4, 9, 16
+	};
+	ERR_FAIL_INDEX_V(p_type, 7, 0);
+	return component_count_for_type[p_type];
+}
+
+template <class T>
+Error GLTFDocument::_decode_accessor_into(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex, T *r_dst) {
 	//spec, for reference:
 	//https://github.com/KhronosGroup/glTF/tree/master/specification/2.0#data-alignment
 
-	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<double>());
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), ERR_INVALID_PARAMETER);
 
 	const Ref<GLTFAccessor> a = state->accessors[p_accessor];
 
-	const int component_count_for_type[7] = {
-		1, 2, 3, 4, 4, 9, 16
-	};
-
-	const int component_count = component_count_for_type[a->type];
+	const int component_count = _get_accessor_component_count(a->type);
 	const int component_size = _get_component_type_size(a->component_type);
-	ERR_FAIL_COND_V(component_size == 0, Vector<double>());
+	ERR_FAIL_COND_V(component_size == 0, ERR_PARSE_ERROR);
 	int element_size = component_count * component_size;
 
 	int skip_every = 0;
@@ -1451,51 +1456,67 @@ Vector<double> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAc
 		}
 	}
 
-	Vector<double> dst_buffer;
-	dst_buffer.resize(component_count * a->count);
-	double *dst = dst_buffer.ptrw();
-
 	if (a->buffer_view >= 0) {
-		ERR_FAIL_INDEX_V(a->buffer_view, state->buffer_views.size(), Vector<double>());
+		ERR_FAIL_INDEX_V(a->buffer_view, state->buffer_views.size(), ERR_PARSE_ERROR);
 
-		const Error err = _decode_buffer_view(state, dst, a->buffer_view, skip_every, skip_bytes, element_size, a->count, a->type, component_count, a->component_type, component_size, a->normalized, a->byte_offset, p_for_vertex);
+		const Error err = _decode_buffer_view(state, r_dst, a->buffer_view, skip_every, skip_bytes, element_size, a->count, a->type, component_count, a->component_type, component_size, a->normalized, a->byte_offset, p_for_vertex);
 		if (err != OK) {
-			return Vector<double>();
+			return err;
 		}
 	} else {
 		//fill with zeros, as bufferview is not defined.
 		for (int i = 0; i < (a->count * component_count); i++) {
-			dst_buffer.write[i] = 0;
+			r_dst[i] = T(0);
 		}
 	}
 
 	if (a->sparse_count > 0) {
 		// I could not find any file using this, so this code is so far untested
-		Vector<double> indices;
+		Vector<int> indices;
 		indices.resize(a->sparse_count);
 		const int indices_component_size = _get_component_type_size(a->sparse_indices_component_type);
 
 		Error err = _decode_buffer_view(state, indices.ptrw(), a->sparse_indices_buffer_view, 0, 0, indices_component_size, a->sparse_count, TYPE_SCALAR, 1, a->sparse_indices_component_type, indices_component_size, false, a->sparse_indices_byte_offset, false);
 		if (err != OK) {
-			return Vector<double>();
+			return err;
 		}
 
-		Vector<double> data;
+		Vector<T> data;
 		data.resize(component_count * a->sparse_count);
 		err = _decode_buffer_view(state, data.ptrw(), a->sparse_values_buffer_view, skip_every, skip_bytes, element_size, a->sparse_count, a->type, component_count, a->component_type, component_size, a->normalized, a->sparse_values_byte_offset, p_for_vertex);
 		if (err != OK) {
-			return Vector<double>();
+			return err;
 		}
 
 		for (int i = 0; i < indices.size(); i++) {
-			const int write_offset = int(indices[i]) * component_count;
+			ERR_FAIL_INDEX_V(indices[i], a->count, ERR_PARSE_ERROR);
+			const int write_offset = indices[i] * component_count;
 
 			for (int j = 0; j < component_count; j++) {
-				dst[write_offset + j] = data[i * component_count + j];
+				r_dst[write_offset + j] = data[i * component_count + j];
 			}
 		}
 	}
 
+	return OK;
+}
+
+template <class T>
+Vector<T> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<T>());
+
+	const Ref<GLTFAccessor> a = state->accessors[p_accessor];
+
+	Vector<T> dst_buffer;
+	dst_buffer.resize(_get_accessor_component_count(a->type) * a->count);
+	if (dst_buffer.is_empty()) {
+		return dst_buffer;
+	}
+
+	if (_decode_accessor_into(state, p_accessor, p_for_vertex, dst_buffer.ptrw()) != OK) {
+		return Vector<T>();
+	}
+
 	return dst_buffer;
 }
 
@@ -1553,41 +1574,11 @@ GLTFAccessorIndex GLTFDocument::_encode_accessor_as_ints(Ref<GLTFState> state, c
 }
 
 Vector<int> GLTFDocument::_decode_accessor_as_ints(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<int> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size();
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = int(attribs_ptr[i]);
-		}
-	}
-	return ret;
+	return _decode_accessor<int>(state, p_accessor, p_for_vertex);
 }
 
 Vector<float> GLTFDocument::_decode_accessor_as_floats(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<float> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size();
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = float(attribs_ptr[i]);
-		}
-	}
-	return ret;
+	return _decode_accessor<float>(state, p_accessor, p_for_vertex);
 }
 
 GLTFAccessorIndex GLTFDocument::_encode_accessor_as_vec2(Ref<GLTFState> state, const Vector<Vector2> p_attribs, const bool p_for_vertex) {
@@ -1847,15 +1838,27 @@ GLTFAccessorIndex GLTFDocument::_encode_accessor_as_quaternions(Ref<GLTFState> s
 }
 
 Vector<Vector2> GLTFDocument::_decode_accessor_as_vec2(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<Vector2>());
 	Vector<Vector2> ret;
 
+	const Ref<GLTFAccessor> a = state->accessors[p_accessor];
+	if (a->type == TYPE_VEC2) {
+		// Components can be decoded in place.
+		static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
+		ret.resize(a->count);
+		if (ret.size() && _decode_accessor_into(state, p_accessor, p_for_vertex, (real_t *)ret.ptrw()) != OK) {
+			return Vector<Vector2>();
+		}
+		return ret;
+	}
+
+	const Vector<real_t> attribs = _decode_accessor<real_t>(state, p_accessor, p_for_vertex);
 	if (attribs.size() == 0) {
 		return ret;
 	}
 
 	ERR_FAIL_COND_V(attribs.size() % 2 != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
+	const real_t *attribs_ptr = attribs.ptr();
 	const int ret_size = attribs.size() / 2;
 	ret.resize(ret_size);
 	{
@@ -2026,15 +2029,27 @@ GLTFAccessorIndex GLTFDocument::_encode_accessor_as_xform(Ref<GLTFState> state,
 }
 
 Vector<Vector3> GLTFDocument::_decode_accessor_as_vec3(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<Vector3>());
 	Vector<Vector3> ret;
 
+	const Ref<GLTFAccessor> a = state->accessors[p_accessor];
+	if (a->type == TYPE_VEC3) {
+		// Components can be decoded in place.
+		static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+		ret.resize(a->count);
+		if (ret.size() && _decode_accessor_into(state, p_accessor, p_for_vertex, (real_t *)ret.ptrw()) != OK) {
+			return Vector<Vector3>();
+		}
+		return ret;
+	}
+
+	const Vector<real_t> attribs = _decode_accessor<real_t>(state, p_accessor, p_for_vertex);
 	if (attribs.size() == 0) {
 		return ret;
 	}
 
 	ERR_FAIL_COND_V(attribs.size() % 3 != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
+	const real_t *attribs_ptr = attribs.ptr();
 	const int ret_size = attribs.size() / 3;
 	ret.resize(ret_size);
 	{
@@ -2046,33 +2061,39 @@ Vector<Vector3> GLTFDocument::_decode_accessor_as_vec3(Ref<GLTFState> state, con
 }
 
 Vector<Color> GLTFDocument::_decode_accessor_as_color(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<Color>());
 	Vector<Color> ret;
 
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
 	const int type = state->accessors[p_accessor]->type;
 	ERR_FAIL_COND_V(!(type == TYPE_VEC3 || type == TYPE_VEC4), ret);
-	int vec_len = 3;
 	if (type == TYPE_VEC4) {
-		vec_len = 4;
+		// Components can be decoded in place.
+		static_assert(sizeof(Color) == 4 * sizeof(float));
+		ret.resize(state->accessors[p_accessor]->count);
+		if (ret.size() && _decode_accessor_into(state, p_accessor, p_for_vertex, (float *)ret.ptrw()) != OK) {
+			return Vector<Color>();
+		}
+		return ret;
+	}
+
+	const Vector<float> attribs = _decode_accessor<float>(state, p_accessor, p_for_vertex);
+	if (attribs.size() == 0) {
+		return ret;
 	}
 
-	ERR_FAIL_COND_V(attribs.size() % vec_len != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size() / vec_len;
+	ERR_FAIL_COND_V(attribs.size() % 3 != 0, ret);
+	const float *attribs_ptr = attribs.ptr();
+	const int ret_size = attribs.size() / 3;
 	ret.resize(ret_size);
 	{
 		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = Color(attribs_ptr[i * vec_len + 0], attribs_ptr[i * vec_len + 1], attribs_ptr[i * vec_len + 2], vec_len == 4 ? attribs_ptr[i * 4 + 3] : 1.0);
+			ret.write[i] = Color(attribs_ptr[i * 3 + 0], attribs_ptr[i * 3 + 1], attribs_ptr[i * 3 + 2], 1.0);
 		}
 	}
 	return ret;
 }
 Vector<Quaternion> GLTFDocument::_decode_accessor_as_quaternion(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t>(state, p_accessor, p_for_vertex);
 	Vector<Quaternion> ret;
 
 	if (attribs.size() == 0) {
@@ -2080,7 +2101,7 @@ Vector<Quaternion> GLTFDocument::_decode_accessor_as_quaternion(Ref<GLTFState> s
 	}
 
 	ERR_FAIL_COND_V(attribs.size() % 4 != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
+	const real_t *attribs_ptr = attribs.ptr();
 	const int ret_size = attribs.size() / 4;
 	ret.resize(ret_size);
 	{
@@ -2091,7 +2112,7 @@ Vector<Quaternion> GLTFDocument::_decode_accessor_as_quaternion(Ref<GLTFState> s
 	return ret;
 }
 Vector<Transform2D> GLTFDocument::_decode_accessor_as_xform2d(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t>(state, p_accessor, p_for_vertex);
 	Vector<Transform2D> ret;
 
 	if (attribs.size() == 0) {
@@ -2108,7 +2129,7 @@ Vector<Transform2D> GLTFDocument::_decode_accessor_as_xform2d(Ref<GLTFState> sta
 }
 
 Vector<Basis> GLTFDocument::_decode_accessor_as_basis(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t>(state, p_accessor, p_for_vertex);
 	Vector<Basis> ret;
 
 	if (attribs.size() == 0) {
@@ -2126,7 +2147,7 @@ Vector<Basis> GLTFDocument::_decode_accessor_as_basis(Ref<GLTFState> state, cons
 }
 
 Vector<Transform3D> GLTFDocument::_decode_accessor_as_xform(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t>(state, p_accessor, p_for_vertex);
 	Vector<Transform3D> ret;
 
 	if (attribs.size() == 0) {
@@ -2532,404 +2553,460 @@ Error GLTFDocument::_serialize_meshes(Ref<GLTFState> state) {
 	return OK;
 }
 
-Error GLTFDocument::_parse_meshes(Ref<GLTFState> state) {
-	if (!state->json.has("meshes")) {
-		return OK;
-	}
+Error GLTFDocument::_parse_mesh_primitive(Ref<GLTFState> state, MeshPrimitive &r_primitive) {
+	const Dictionary &p = r_primitive.source;
+	uint32_t &flags = r_primitive.flags;
 
-	Array meshes = state->json["meshes"];
-	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
-		print_verbose("glTF: Parsing mesh: " + itos(i));
-		Dictionary d = meshes[i];
+	Array &array = r_primitive.array;
+	array.resize(Mesh::ARRAY_MAX);
 
-		Ref<GLTFMesh> mesh;
-		mesh.instantiate();
-		bool has_vertex_color = false;
+	ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
 
-		ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
+	const Dictionary &a = p["attributes"];
 
-		Array primitives = d["primitives"];
-		const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
-		Ref<ImporterMesh> import_mesh;
-		import_mesh.instantiate();
-		String mesh_name = "mesh";
-		if (d.has("name") && !String(d["name"]).is_empty()) {
-			mesh_name = d["name"];
-		}
-		import_mesh->set_name(_gen_unique_name(state, vformat("%s_%s", state->scene_name, mesh_name)));
-
-		for (int j = 0; j < primitives.size(); j++) {
-			uint32_t flags = 0;
-			Dictionary p = primitives[j];
-
-			Array array;
-			array.resize(Mesh::ARRAY_MAX);
-
-			ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
-
-			Dictionary a = p["attributes"];
-
-			Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
-			if (p.has("mode")) {
-				const int mode = p["mode"];
-				ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
-				// Convert mesh.primitive.mode to Godot Mesh enum. See:
-				// https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#_mesh_primitive_mode
-				static const Mesh::PrimitiveType primitives2[7] = {
-					Mesh::PRIMITIVE_POINTS, // 0 POINTS
-					Mesh::PRIMITIVE_LINES, // 1 LINES
-					Mesh::PRIMITIVE_LINES, // 2 LINE_LOOP; loop not supported, should be converted
-					Mesh::PRIMITIVE_LINE_STRIP, // 3 LINE_STRIP
-					Mesh::PRIMITIVE_TRIANGLES, // 4 TRIANGLES
-					Mesh::PRIMITIVE_TRIANGLE_STRIP, // 5 TRIANGLE_STRIP
-					Mesh::PRIMITIVE_TRIANGLES, // 6 TRIANGLE_FAN fan not supported, should be converted
+	Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
+	if (p.has("mode")) {
+		const int mode = p["mode"];
+		ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
+		// Convert mesh.primitive.mode to Godot Mesh enum. See:
+		// https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#_mesh_primitive_mode
+		static const Mesh::PrimitiveType primitives2[7] = {
+			Mesh::PRIMITIVE_POINTS, // 0 POINTS
+			Mesh::PRIMITIVE_LINES, // 1 LINES
+			Mesh::PRIMITIVE_LINES, // 2 LINE_LOOP; loop not supported, should be converted
+			Mesh::PRIMITIVE_LINE_STRIP, // 3 LINE_STRIP
+			Mesh::PRIMITIVE_TRIANGLES, // 4 TRIANGLES
+			Mesh::PRIMITIVE_TRIANGLE_STRIP, // 5 TRIANGLE_STRIP
+			Mesh::PRIMITIVE_TRIANGLES, // 6 TRIANGLE_FAN fan not supported, should be converted
 #ifndef _MSC_VER
 #warning line loop and triangle fan are not supported and need to be converted to lines and triangles
 #endif
 
-				};
+		};
 
-				primitive = primitives2[mode];
-			}
+		primitive = primitives2[mode];
+	}
 
-			ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
-			int32_t vertex_num = 0;
-			if (a.has("POSITION")) {
-				PackedVector3Array vertices = _decode_accessor_as_vec3(state, a["POSITION"], true);
-				array[Mesh::ARRAY_VERTEX] = vertices;
-				vertex_num = vertices.size();
-			}
-			if (a.has("NORMAL")) {
-				array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(state, a["NORMAL"], true);
+	ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
+	int32_t vertex_num = 0;
+	if (a.has("POSITION")) {
+		PackedVector3Array vertices = _decode_accessor_as_vec3(state, a["POSITION"], true);
+		array[Mesh::ARRAY_VERTEX] = vertices;
+		vertex_num = vertices.size();
+	}
+	if (a.has("NORMAL")) {
+		array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(state, a["NORMAL"], true);
+	}
+	if (a.has("TANGENT")) {
+		array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(state, a["TANGENT"], true);
+	}
+	if (a.has("TEXCOORD_0")) {
+		array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(state, a["TEXCOORD_0"], true);
+	}
+	if (a.has("TEXCOORD_1")) {
+		array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(state, a["TEXCOORD_1"], true);
+	}
+	for (int custom_i = 0; custom_i < 3; custom_i++) {
+		Vector<float> cur_custom;
+		Vector<Vector2> texcoord_first;
+		Vector<Vector2> texcoord_second;
+
+		int texcoord_i = 2 + 2 * custom_i;
+		String gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i);
+		int num_channels = 0;
+		if (a.has(gltf_texcoord_key)) {
+			texcoord_first = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
+			num_channels = 2;
+		}
+		gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i + 1);
+		if (a.has(gltf_texcoord_key)) {
+			texcoord_second = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
+			num_channels = 4;
+		}
+		if (!num_channels) {
+			break;
+		}
+		if (num_channels == 2 || num_channels == 4) {
+			cur_custom.resize(vertex_num * num_channels);
+			for (int32_t uv_i = 0; uv_i < texcoord_first.size() && uv_i < vertex_num; uv_i++) {
+				cur_custom.write[uv_i * num_channels + 0] = texcoord_first[uv_i].x;
+				cur_custom.write[uv_i * num_channels + 1] = texcoord_first[uv_i].y;
 			}
-			if (a.has("TANGENT")) {
-				array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(state, a["TANGENT"], true);
+			// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
+			for (int32_t uv_i = texcoord_first.size(); uv_i < vertex_num; uv_i++) {
+				cur_custom.write[uv_i * num_channels + 0] = 0;
+				cur_custom.write[uv_i * num_channels + 1] = 0;
 			}
-			if (a.has("TEXCOORD_0")) {
-				array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(state, a["TEXCOORD_0"], true);
+		}
+		if (num_channels == 4) {
+			for (int32_t uv_i = 0; uv_i < texcoord_second.size() && uv_i < vertex_num; uv_i++) {
+				// num_channels must be 4
+				cur_custom.write[uv_i * num_channels + 2] = texcoord_second[uv_i].x;
+				cur_custom.write[uv_i * num_channels + 3] = texcoord_second[uv_i].y;
 			}
-			if (a.has("TEXCOORD_1")) {
-				array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(state, a["TEXCOORD_1"], true);
+			// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
+			for (int32_t uv_i = texcoord_second.size(); uv_i < vertex_num; uv_i++) {
+				cur_custom.write[uv_i * num_channels + 2] = 0;
+				cur_custom.write[uv_i * num_channels + 3] = 0;
 			}
-			for (int custom_i = 0; custom_i < 3; custom_i++) {
-				Vector<float> cur_custom;
-				Vector<Vector2> texcoord_first;
-				Vector<Vector2> texcoord_second;
-
-				int texcoord_i = 2 + 2 * custom_i;
-				String gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i);
-				int num_channels = 0;
-				if (a.has(gltf_texcoord_key)) {
-					texcoord_first = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
-					num_channels = 2;
-				}
-				gltf_texcoord_key = vformat("TEXCOORD_%d", texcoord_i + 1);
-				if (a.has(gltf_texcoord_key)) {
-					texcoord_second = _decode_accessor_as_vec2(state, a[gltf_texcoord_key], true);
-					num_channels = 4;
-				}
-				if (!num_channels) {
-					break;
-				}
-				if (num_channels == 2 || num_channels == 4) {
-					cur_custom.resize(vertex_num * num_channels);
-					for (int32_t uv_i = 0; uv_i < texcoord_first.size() && uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 0] = texcoord_first[uv_i].x;
-						cur_custom.write[uv_i * num_channels + 1] = texcoord_first[uv_i].y;
-					}
-					// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
-					for (int32_t uv_i = texcoord_first.size(); uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 0] = 0;
-						cur_custom.write[uv_i * num_channels + 1] = 0;
-					}
-				}
-				if (num_channels == 4) {
-					for (int32_t uv_i = 0; uv_i < texcoord_second.size() && uv_i < vertex_num; uv_i++) {
-						// num_channels must be 4
-						cur_custom.write[uv_i * num_channels + 2] = texcoord_second[uv_i].x;
-						cur_custom.write[uv_i * num_channels + 3] = texcoord_second[uv_i].y;
-					}
-					// Vector.resize seems to not zero-initialize. Ensure all unused elements are 0:
-					for (int32_t uv_i = texcoord_second.size(); uv_i < vertex_num; uv_i++) {
-						cur_custom.write[uv_i * num_channels + 2] = 0;
-						cur_custom.write[uv_i * num_channels + 3] = 0;
-					}
+		}
+		if (cur_custom.size() > 0) {
+			array[Mesh::ARRAY_CUSTOM0 + custom_i] = cur_custom;
+			int custom_shift = Mesh::ARRAY_FORMAT_CUSTOM0_SHIFT + custom_i * Mesh::ARRAY_FORMAT_CUSTOM_BITS;
+			if (num_channels == 2) {
+				flags |= Mesh::ARRAY_CUSTOM_RG_FLOAT << custom_shift;
+			} else {
+				flags |= Mesh::ARRAY_CUSTOM_RGBA_FLOAT << custom_shift;
+			}
+		}
+	}
+	if (a.has("COLOR_0")) {
+		array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(state, a["COLOR_0"], true);
+		r_primitive.has_vertex_color = true;
+	}
+	if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
+		array[Mesh::ARRAY_BONES] = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
+	} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+		PackedInt32Array joints_0 = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
+		PackedInt32Array joints_1 = _decode_accessor_as_ints(state, a["JOINTS_1"], true);
+		ERR_FAIL_COND_V(joints_0.size() != joints_0.size(), ERR_INVALID_DATA);
+		int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+		Vector<int> joints;
+		joints.resize(vertex_num * weight_8_count);
+		for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
+			joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
+			joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
+			joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
+			joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
+			joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
+			joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
+			joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
+			joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
+		}
+		array[Mesh::ARRAY_BONES] = joints;
+	}
+	if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
+		Vector<float> weights = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
+		{ //gltf does not seem to normalize the weights for some reason..
+			int wc = weights.size();
+			float *w = weights.ptrw();
+
+			for (int k = 0; k < wc; k += 4) {
+				float total = 0.0;
+				total += w[k + 0];
+				total += w[k + 1];
+				total += w[k + 2];
+				total += w[k + 3];
+				if (total > 0.0) {
+					w[k + 0] /= total;
+					w[k + 1] /= total;
+					w[k + 2] /= total;
+					w[k + 3] /= total;
 				}
-				if (cur_custom.size() > 0) {
-					array[Mesh::ARRAY_CUSTOM0 + custom_i] = cur_custom;
-					int custom_shift = Mesh::ARRAY_FORMAT_CUSTOM0_SHIFT + custom_i * Mesh::ARRAY_FORMAT_CUSTOM_BITS;
-					if (num_channels == 2) {
-						flags |= Mesh::ARRAY_CUSTOM_RG_FLOAT << custom_shift;
-					} else {
-						flags |= Mesh::ARRAY_CUSTOM_RGBA_FLOAT << custom_shift;
-					}
+			}
+		}
+		array[Mesh::ARRAY_WEIGHTS] = weights;
+	} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
+		Vector<float> weights_0 = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
+		Vector<float> weights_1 = _decode_accessor_as_floats(state, a["WEIGHTS_1"], true);
+		Vector<float> weights;
+		ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
+		int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+		weights.resize(vertex_num * weight_8_count);
+		for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
+			weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
+			weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
+			weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
+			weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
+			weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
+			weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
+			weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
+			weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
+		}
+		{ //gltf does not seem to normalize the weights for some reason..
+			int wc = weights.size();
+			float *w = weights.ptrw();
+
+			for (int k = 0; k < wc; k += weight_8_count) {
+				float total = 0.0;
+				total += w[k + 0];
+				total += w[k + 1];
+				total += w[k + 2];
+				total += w[k + 3];
+				total += w[k + 4];
+				total += w[k + 5];
+				total += w[k + 6];
+				total += w[k + 7];
+				if (total > 0.0) {
+					w[k + 0] /= total;
+					w[k + 1] /= total;
+					w[k + 2] /= total;
+					w[k + 3] /= total;
+					w[k + 4] /= total;
+					w[k + 5] /= total;
+					w[k + 6] /= total;
+					w[k + 7] /= total;
 				}
 			}
-			if (a.has("COLOR_0")) {
-				array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(state, a["COLOR_0"], true);
-				has_vertex_color = true;
+		}
+		array[Mesh::ARRAY_WEIGHTS] = weights;
+	}
+
+	if (p.has("indices")) {
+		Vector<int> indices = _decode_accessor_as_ints(state, p["indices"], false);
+
+		if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+			//swap around indices, convert ccw to cw for front face
+
+			const int is = indices.size();
+			int *w = indices.ptrw();
+			for (int k = 0; k < is; k += 3) {
+				SWAP(w[k + 1], w[k + 2]);
 			}
-			if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
-				array[Mesh::ARRAY_BONES] = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
-			} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				PackedInt32Array joints_0 = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
-				PackedInt32Array joints_1 = _decode_accessor_as_ints(state, a["JOINTS_1"], true);
-				ERR_FAIL_COND_V(joints_0.size() != joints_0.size(), ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				Vector<int> joints;
-				joints.resize(vertex_num * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
-					joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				array[Mesh::ARRAY_BONES] = joints;
-			}
-			if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
-				Vector<float> weights = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
-				{ //gltf does not seem to normalize the weights for some reason..
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += 4) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
+		}
+		array[Mesh::ARRAY_INDEX] = indices;
+
+	} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+		//generate indices because they need to be swapped for CW/CCW
+		const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
+		ERR_FAIL_COND_V(vertices.size() == 0, ERR_PARSE_ERROR);
+		Vector<int> indices;
+		const int vs = vertices.size();
+		indices.resize(vs);
+		{
+			int *w = indices.ptrw();
+			for (int k = 0; k < vs; k += 3) {
+				w[k] = k;
+				w[k + 1] = k + 2;
+				w[k + 2] = k + 1;
+			}
+		}
+		array[Mesh::ARRAY_INDEX] = indices;
+	}
+
+	bool generate_tangents = (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("TEXCOORD_0") && a.has("NORMAL"));
+
+	Ref<SurfaceTool> mesh_surface_tool;
+	mesh_surface_tool.instantiate();
+	mesh_surface_tool->create_from_triangle_arrays(array);
+	if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+		mesh_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
+	}
+	mesh_surface_tool->index();
+	if (generate_tangents) {
+		//must generate mikktspace tangents.. ergh..
+		mesh_surface_tool->generate_tangents();
+	}
+	array = mesh_surface_tool->commit_to_arrays();
+
+	Array &morphs = r_primitive.morphs;
+	//blend shapes
+	if (p.has("targets")) {
+		print_verbose("glTF: Mesh has targets");
+		const Array &targets = p["targets"];
+
+		for (int k = 0; k < targets.size(); k++) {
+			const Dictionary &t = targets[k];
+
+			Array array_copy;
+			array_copy.resize(Mesh::ARRAY_MAX);
+
+			for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+				array_copy[l] = array[l];
+			}
+
+			if (t.has("POSITION")) {
+				Vector<Vector3> varr = _decode_accessor_as_vec3(state, t["POSITION"], true);
+				const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
+				const int size = src_varr.size();
+				ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+				{
+					const int max_idx = varr.size();
+					varr.resize(size);
+
+					Vector3 *w_varr = varr.ptrw();
+					const Vector3 *r_varr = varr.ptr();
+					const Vector3 *r_src_varr = src_varr.ptr();
+					for (int l = 0; l < size; l++) {
+						if (l < max_idx) {
+							w_varr[l] = r_varr[l] + r_src_varr[l];
+						} else {
+							w_varr[l] = r_src_varr[l];
 						}
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
-			} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
-				Vector<float> weights_0 = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
-				Vector<float> weights_1 = _decode_accessor_as_floats(state, a["WEIGHTS_1"], true);
-				Vector<float> weights;
-				ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				weights.resize(vertex_num * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_num; vertex_i++) {
-					weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				{ //gltf does not seem to normalize the weights for some reason..
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += weight_8_count) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						total += w[k + 4];
-						total += w[k + 5];
-						total += w[k + 6];
-						total += w[k + 7];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-							w[k + 4] /= total;
-							w[k + 5] /= total;
-							w[k + 6] /= total;
-							w[k + 7] /= total;
+				array_copy[Mesh::ARRAY_VERTEX] = varr;
+			}
+			if (t.has("NORMAL")) {
+				Vector<Vector3> narr = _decode_accessor_as_vec3(state, t["NORMAL"], true);
+				const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
+				int size = src_narr.size();
+				ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+				{
+					int max_idx = narr.size();
+					narr.resize(size);
+
+					Vector3 *w_narr = narr.ptrw();
+					const Vector3 *r_narr = narr.ptr();
+					const Vector3 *r_src_narr = src_narr.ptr();
+					for (int l = 0; l < size; l++) {
+						if (l < max_idx) {
+							w_narr[l] = r_narr[l] + r_src_narr[l];
+						} else {
+							w_narr[l] = r_src_narr[l];
 						}
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
+				array_copy[Mesh::ARRAY_NORMAL] = narr;
 			}
+			if (t.has("TANGENT")) {
+				const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(state, t["TANGENT"], true);
+				const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
+				ERR_FAIL_COND_V(src_tangents.size() == 0, ERR_PARSE_ERROR);
 
-			if (p.has("indices")) {
-				Vector<int> indices = _decode_accessor_as_ints(state, p["indices"], false);
+				Vector<float> tangents_v4;
 
-				if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-					//swap around indices, convert ccw to cw for front face
-
-					const int is = indices.size();
-					int *w = indices.ptrw();
-					for (int k = 0; k < is; k += 3) {
-						SWAP(w[k + 1], w[k + 2]);
-					}
-				}
-				array[Mesh::ARRAY_INDEX] = indices;
-
-			} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-				//generate indices because they need to be swapped for CW/CCW
-				const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
-				ERR_FAIL_COND_V(vertices.size() == 0, ERR_PARSE_ERROR);
-				Vector<int> indices;
-				const int vs = vertices.size();
-				indices.resize(vs);
 				{
-					int *w = indices.ptrw();
-					for (int k = 0; k < vs; k += 3) {
-						w[k] = k;
-						w[k + 1] = k + 2;
-						w[k + 2] = k + 1;
+					int max_idx = tangents_v3.size();
+
+					int size4 = src_tangents.size();
+					tangents_v4.resize(size4);
+					float *w4 = tangents_v4.ptrw();
+
+					const Vector3 *r3 = tangents_v3.ptr();
+					const float *r4 = src_tangents.ptr();
+
+					for (int l = 0; l < size4 / 4; l++) {
+						if (l < max_idx) {
+							w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
+							w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
+							w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
+						} else {
+							w4[l * 4 + 0] = r4[l * 4 + 0];
+							w4[l * 4 + 1] = r4[l * 4 + 1];
+							w4[l * 4 + 2] = r4[l * 4 + 2];
+						}
+						w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
 					}
 				}
-				array[Mesh::ARRAY_INDEX] = indices;
-			}
 
-			bool generate_tangents = (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("TEXCOORD_0") && a.has("NORMAL"));
+				array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
+			}
 
-			Ref<SurfaceTool> mesh_surface_tool;
-			mesh_surface_tool.instantiate();
-			mesh_surface_tool->create_from_triangle_arrays(array);
+			Ref<SurfaceTool> blend_surface_tool;
+			blend_surface_tool.instantiate();
+			blend_surface_tool->create_from_triangle_arrays(array_copy);
 			if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				mesh_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
+				blend_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
 			}
-			mesh_surface_tool->index();
+			blend_surface_tool->index();
 			if (generate_tangents) {
-				//must generate mikktspace tangents.. ergh..
-				mesh_surface_tool->generate_tangents();
+				blend_surface_tool->generate_tangents();
 			}
-			array = mesh_surface_tool->commit_to_arrays();
+			array_copy = blend_surface_tool->commit_to_arrays();
 
-			Array morphs;
-			//blend shapes
-			if (p.has("targets")) {
-				print_verbose("glTF: Mesh has targets");
-				const Array &targets = p["targets"];
+			// Enforce blend shape mask array format
+			for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+				if (!(Mesh::ARRAY_FORMAT_BLEND_SHAPE_MASK & (1 << l))) {
+					array_copy[l] = Variant();
+				}
+			}
 
-				//ideally BLEND_SHAPE_MODE_RELATIVE since gltf2 stores in displacement
-				//but it could require a larger refactor?
-				import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
+			morphs.push_back(array_copy);
+		}
+	}
 
-				if (j == 0) {
-					const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
-					for (int k = 0; k < targets.size(); k++) {
-						const String name = k < target_names.size() ? (String)target_names[k] : String("morph_") + itos(k);
-						import_mesh->add_blend_shape(name);
-					}
-				}
+	r_primitive.primitive = primitive;
+	return OK;
+}
 
-				for (int k = 0; k < targets.size(); k++) {
-					const Dictionary &t = targets[k];
+void GLTFDocument::_parse_mesh_primitive_task(uint32_t p_index, MeshPrimitiveData *p_data) {
+	MeshPrimitive &primitive = p_data->primitives[p_index];
+	primitive.err = _parse_mesh_primitive(p_data->state, primitive);
+}
 
-					Array array_copy;
-					array_copy.resize(Mesh::ARRAY_MAX);
+Error GLTFDocument::_parse_meshes(Ref<GLTFState> state) {
+	if (!state->json.has("meshes")) {
+		return OK;
+	}
 
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						array_copy[l] = array[l];
-					}
+	Array meshes = state->json["meshes"];
 
-					if (t.has("POSITION")) {
-						Vector<Vector3> varr = _decode_accessor_as_vec3(state, t["POSITION"], true);
-						const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
-						const int size = src_varr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							const int max_idx = varr.size();
-							varr.resize(size);
-
-							Vector3 *w_varr = varr.ptrw();
-							const Vector3 *r_varr = varr.ptr();
-							const Vector3 *r_src_varr = src_varr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_varr[l] = r_varr[l] + r_src_varr[l];
-								} else {
-									w_varr[l] = r_src_varr[l];
-								}
-							}
-						}
-						array_copy[Mesh::ARRAY_VERTEX] = varr;
-					}
-					if (t.has("NORMAL")) {
-						Vector<Vector3> narr = _decode_accessor_as_vec3(state, t["NORMAL"], true);
-						const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
-						int size = src_narr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							int max_idx = narr.size();
-							narr.resize(size);
-
-							Vector3 *w_narr = narr.ptrw();
-							const Vector3 *r_narr = narr.ptr();
-							const Vector3 *r_src_narr = src_narr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_narr[l] = r_narr[l] + r_src_narr[l];
-								} else {
-									w_narr[l] = r_src_narr[l];
-								}
-							}
-						}
-						array_copy[Mesh::ARRAY_NORMAL] = narr;
-					}
-					if (t.has("TANGENT")) {
-						const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(state, t["TANGENT"], true);
-						const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
-						ERR_FAIL_COND_V(src_tangents.size() == 0, ERR_PARSE_ERROR);
+	// Primitives only read the state, so they are all decoded and indexed on the worker threads at once,
+	// then added to their meshes in order (materials and blend shape names are shared, so that stays serial).
+	MeshPrimitiveData primitive_data;
+	primitive_data.state = state;
+	LocalVector<Ref<ImporterMesh>> import_meshes;
+	LocalVector<uint32_t> mesh_primitive_offsets;
 
-						Vector<float> tangents_v4;
+	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
+		Dictionary d = meshes[i];
 
-						{
-							int max_idx = tangents_v3.size();
-
-							int size4 = src_tangents.size();
-							tangents_v4.resize(size4);
-							float *w4 = tangents_v4.ptrw();
-
-							const Vector3 *r3 = tangents_v3.ptr();
-							const float *r4 = src_tangents.ptr();
-
-							for (int l = 0; l < size4 / 4; l++) {
-								if (l < max_idx) {
-									w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
-									w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
-									w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
-								} else {
-									w4[l * 4 + 0] = r4[l * 4 + 0];
-									w4[l * 4 + 1] = r4[l * 4 + 1];
-									w4[l * 4 + 2] = r4[l * 4 + 2];
-								}
-								w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
-							}
-						}
+		ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
 
-						array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
-					}
+		Array primitives = d["primitives"];
+		Ref<ImporterMesh> import_mesh;
+		import_mesh.instantiate();
+		String mesh_name = "mesh";
+		if (d.has("name") && !String(d["name"]).is_empty()) {
+			mesh_name = d["name"];
+		}
+		import_mesh->set_name(_gen_unique_name(state, vformat("%s_%s", state->scene_name, mesh_name)));
+		import_meshes.push_back(import_mesh);
 
-					Ref<SurfaceTool> blend_surface_tool;
-					blend_surface_tool.instantiate();
-					blend_surface_tool->create_from_triangle_arrays(array_copy);
-					if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-						blend_surface_tool->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-					}
-					blend_surface_tool->index();
-					if (generate_tangents) {
-						blend_surface_tool->generate_tangents();
-					}
-					array_copy = blend_surface_tool->commit_to_arrays();
+		mesh_primitive_offsets.push_back(primitive_data.primitives.size());
+		for (int j = 0; j < primitives.size(); j++) {
+			MeshPrimitive primitive;
+			primitive.source = primitives[j];
+			primitive_data.primitives.push_back(primitive);
+		}
+	}
+	mesh_primitive_offsets.push_back(primitive_data.primitives.size());
 
-					// Enforce blend shape mask array format
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						if (!(Mesh::ARRAY_FORMAT_BLEND_SHAPE_MASK & (1 << l))) {
-							array_copy[l] = Variant();
-						}
-					}
+	if (primitive_data.primitives.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_parse_mesh_primitive_task, &primitive_data, primitive_data.primitives.size(), -1, true, "Parse glTF mesh primitives");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		// Waiting on the pool from one of its own threads could stall it, so just parse them here.
+		for (uint32_t j = 0; j < primitive_data.primitives.size(); j++) {
+			_parse_mesh_primitive_task(j, &primitive_data);
+		}
+	}
+
+	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
+		print_verbose("glTF: Parsing mesh: " + itos(i));
+		Dictionary d = meshes[i];
+
+		Ref<GLTFMesh> mesh;
+		mesh.instantiate();
+		bool has_vertex_color = false;
 
-					morphs.push_back(array_copy);
+		const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
+		Ref<ImporterMesh> import_mesh = import_meshes[i];
+
+		for (uint32_t j = mesh_primitive_offsets[i]; j < mesh_primitive_offsets[i + 1]; j++) {
+			const MeshPrimitive &primitive = primitive_data.primitives[j];
+			if (primitive.err != OK) {
+				return primitive.err;
+			}
+			const Dictionary &p = primitive.source;
+
+			if (primitive.has_vertex_color) {
+				has_vertex_color = true;
+			}
+
+			if (p.has("targets")) {
+				//ideally BLEND_SHAPE_MODE_RELATIVE since gltf2 stores in displacement
+				//but it could require a larger refactor?
+				import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
+
+				if (j == mesh_primitive_offsets[i]) {
+					const Array &targets = p["targets"];
+					const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
+					for (int k = 0; k < targets.size(); k++) {
+						const String name = k < target_names.size() ? (String)target_names[k] : String("morph_") + itos(k);
+						import_mesh->add_blend_shape(name);
+					}
 				}
 			}
 
@@ -2957,8 +3034,8 @@ Error GLTFDocument::_parse_meshes(Ref<GLTFState> state) {
 				ERR_FAIL_NULL_V(mat, ERR_FILE_CORRUPT);
 				mat_name = mat->get_name();
 			}
-			import_mesh->add_surface(primitive, array, morphs,
-					Dictionary(), mat, mat_name, flags);
+			import_mesh->add_surface(primitive.primitive, primitive.array, primitive.morphs,
+					Dictionary(), mat, mat_name, primitive.flags);
 		}
 
 		Vector<float> blend_weights;
@@ -34,6 +34,7 @@
 #include "gltf_defines.h"
 #include "structures/gltf_animation.h"
 
+#include "core/templates/local_vector.h"
 #include "scene/3d/bone_attachment_3d.h"
 #include "scene/3d/importer_mesh_instance_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
@@ -105,7 +106,8 @@ private:
 	Error _parse_buffer_views(Ref<GLTFState> state);
 	GLTFType _get_type_from_str(const String &p_string);
 	Error _parse_accessors(Ref<GLTFState> state);
-	Error _decode_buffer_view(Ref<GLTFState> state, double *dst,
+	template <class T>
+	Error _decode_buffer_view(Ref<GLTFState> state, T *dst,
 			const GLTFBufferViewIndex p_buffer_view,
 			const int skip_every, const int skip_bytes,
 			const int element_size, const int count,
@@ -113,7 +115,13 @@ private:
 			const int component_type, const int component_size,
 			const bool normalized, const int byte_offset,
 			const bool for_vertex);
-	Vector<double> _decode_accessor(Ref<GLTFState> state,
+	static int _get_accessor_component_count(const GLTFType p_type);
+	template <class T>
+	Error _decode_accessor_into(Ref<GLTFState> state,
+			const GLTFAccessorIndex p_accessor,
+			const bool p_for_vertex, T *r_dst);
+	template <class T>
+	Vector<T> _decode_accessor(Ref<GLTFState> state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
 	Vector<float> _decode_accessor_as_floats(Ref<GLTFState> state,
@@ -143,6 +151,21 @@ private:
 	Vector<Transform3D> _decode_accessor_as_xform(Ref<GLTFState> state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
+	struct MeshPrimitive {
+		Dictionary source;
+		Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
+		Array array;
+		Array morphs;
+		uint32_t flags = 0;
+		bool has_vertex_color = false;
+		Error err = OK;
+	};
+	struct MeshPrimitiveData {
+		Ref<GLTFState> state;
+		LocalVector<MeshPrimitive> primitives;
+	};
+	Error _parse_mesh_primitive(Ref<GLTFState> state, MeshPrimitive &r_primitive);
+	void _parse_mesh_primitive_task(uint32_t p_index, MeshPrimitiveData *p_data);
 	Error _parse_meshes(Ref<GLTFState> state);
 	Error _serialize_textures(Ref<GLTFState> state);
 	Error _serialize_images(Ref<GLTFState> state, const String &p_path);
@@ -32,6 +32,7 @@
 
 #include "core/io/marshalls.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/light_3d.h"
 #include "scene/resources/mesh_library.h"
 #include "scene/resources/physics_material.h"
@@ -468,12 +469,9 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	}
 }
 
-bool GridMap::_octant_update(const OctantKey &p_key) {
-	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
+bool GridMap::_octant_clear(const OctantKey &p_key) {
+	// Frees the contents of a dirty octant, returns true if the octant has no cells left and can be deleted.
 	Octant &g = *octant_map[p_key];
-	if (!g.dirty) {
-		return false;
-	}
 
 	//erase body shapes
 	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
@@ -506,15 +504,20 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		return true;
 	}
 
-	Vector<Vector3> col_debug;
+	return false;
+}
+
+void GridMap::_octant_build(OctantBuild &r_build) const {
+	// Only reads the cells and the mesh library, may run on a worker thread.
+	const Octant &g = *octant_map[r_build.key];
 
 	/*
 	 * foreach item in this octant,
-	 * set item's multimesh's instance count to number of cells which have this item
-	 * and set said multimesh bounding box to one containing all cells which have this item
+	 * gather the transforms of the cells which have this item into the item's multimesh buffer
 	 */
 
-	HashMap<int, List<Pair<Transform3D, IndexKey>>> multimesh_items;
+	HashMap<int, uint32_t> multimesh_indices;
+	Vector3 ofs = _get_offset();
 
 	for (const IndexKey &E : g.cells) {
 		ERR_CONTINUE(!cell_map.has(E));
@@ -525,7 +528,6 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		}
 
 		Vector3 cellpos = Vector3(E.x, E.y, E.z);
-		Vector3 ofs = _get_offset();
 
 		Transform3D xform;
 
@@ -534,14 +536,33 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
 		if (baked_meshes.size() == 0) {
 			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform3D, IndexKey>>();
+				uint32_t *index = multimesh_indices.getptr(c.item);
+				if (!index) {
+					index = &multimesh_indices.insert(c.item, r_build.multimeshes.size())->value;
+					r_build.multimeshes.push_back(OctantBuild::Multimesh());
+					r_build.multimeshes[*index].item = c.item;
 				}
+				OctantBuild::Multimesh &mm = r_build.multimeshes[*index];
 
-				Pair<Transform3D, IndexKey> p;
-				p.first = xform * mesh_library->get_item_mesh_transform(c.item);
-				p.second = E;
-				multimesh_items[c.item].push_back(p);
+				Transform3D mesh_xform = xform * mesh_library->get_item_mesh_transform(c.item);
+#ifdef TOOLS_ENABLED
+				Octant::MultimeshInstance::Item it;
+				it.index = mm.buffer.size() / 12;
+				it.transform = mesh_xform;
+				it.key = E;
+				mm.items.push_back(it);
+#endif
+
+				// Same layout as RenderingServer::multimesh_instance_set_transform().
+				int base = mm.buffer.size();
+				mm.buffer.resize(base + 12);
+				float *w = mm.buffer.ptrw() + base;
+				for (int i = 0; i < 3; i++) {
+					w[i * 4 + 0] = mesh_xform.basis.rows[i][0];
+					w[i * 4 + 1] = mesh_xform.basis.rows[i][1];
+					w[i * 4 + 2] = mesh_xform.basis.rows[i][2];
+					w[i * 4 + 3] = mesh_xform.origin[i];
+				}
 			}
 		}
 
@@ -552,70 +573,86 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 			if (!shapes[i].shape.is_valid()) {
 				continue;
 			}
-			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
+			OctantBuild::Shape shape;
+			shape.shape = shapes[i].shape->get_rid();
+			shape.xform = xform * shapes[i].local_transform;
+			r_build.shapes.push_back(shape);
 			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
+				shapes.write[i].shape->add_vertices_to_array(r_build.collision_debug_vertices, shape.xform);
 			}
 		}
 
 		// add the item's navmesh at given xform to GridMap's Navigation ancestor
 		Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c.item);
 		if (navmesh.is_valid()) {
-			Octant::NavMesh nm;
+			OctantBuild::NavMesh nm;
+			nm.cell = E;
+			nm.navmesh = navmesh;
 			nm.xform = xform * mesh_library->get_item_navmesh_transform(c.item);
+			r_build.navmeshes.push_back(nm);
+		}
+	}
+}
+
+void GridMap::_octant_build_task(uint32_t p_index, OctantBuild *p_builds) {
+	_octant_build(p_builds[p_index]);
+}
+
+void GridMap::_octant_commit(const OctantBuild &p_build) {
+	// Hands a built octant to the servers, on the main thread.
+	Octant &g = *octant_map[p_build.key];
+
+	for (uint32_t i = 0; i < p_build.shapes.size(); i++) {
+		PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, p_build.shapes[i].shape, p_build.shapes[i].xform);
+	}
+
+	for (uint32_t i = 0; i < p_build.navmeshes.size(); i++) {
+		const OctantBuild::NavMesh &build_nm = p_build.navmeshes[i];
+		Octant::NavMesh nm;
+		nm.xform = build_nm.xform;
 
-			if (bake_navigation) {
-				RID region = NavigationServer3D::get_singleton()->region_create();
-				NavigationServer3D::get_singleton()->region_set_navigation_layers(region, navigation_layers);
-				NavigationServer3D::get_singleton()->region_set_navmesh(region, navmesh);
-				NavigationServer3D::get_singleton()->region_set_transform(region, get_global_transform() * nm.xform);
-				NavigationServer3D::get_singleton()->region_set_map(region, get_world_3d()->get_navigation_map());
-				nm.region = region;
-
-				// add navigation debugmesh visual instances if debug is enabled
-				SceneTree *st = SceneTree::get_singleton();
-				if (st && st->is_debugging_navigation_hint()) {
-					if (!nm.navmesh_debug_instance.is_valid()) {
-						RID navmesh_debug_rid = navmesh->get_debug_mesh()->get_rid();
-						nm.navmesh_debug_instance = RS::get_singleton()->instance_create();
-						RS::get_singleton()->instance_set_base(nm.navmesh_debug_instance, navmesh_debug_rid);
-						RS::get_singleton()->mesh_surface_set_material(navmesh_debug_rid, 0, st->get_debug_navigation_material()->get_rid());
-					}
-					if (is_inside_tree()) {
-						RS::get_singleton()->instance_set_scenario(nm.navmesh_debug_instance, get_world_3d()->get_scenario());
-						RS::get_singleton()->instance_set_transform(nm.navmesh_debug_instance, get_global_transform() * nm.xform);
-					}
+		if (bake_navigation) {
+			RID region = NavigationServer3D::get_singleton()->region_create();
+			NavigationServer3D::get_singleton()->region_set_navigation_layers(region, navigation_layers);
+			NavigationServer3D::get_singleton()->region_set_navmesh(region, build_nm.navmesh);
+			NavigationServer3D::get_singleton()->region_set_transform(region, get_global_transform() * nm.xform);
+			NavigationServer3D::get_singleton()->region_set_map(region, get_world_3d()->get_navigation_map());
+			nm.region = region;
+
+			// add navigation debugmesh visual instances if debug is enabled
+			SceneTree *st = SceneTree::get_singleton();
+			if (st && st->is_debugging_navigation_hint()) {
+				if (!nm.navmesh_debug_instance.is_valid()) {
+					Ref<NavigationMesh> navmesh = build_nm.navmesh;
+					RID navmesh_debug_rid = navmesh->get_debug_mesh()->get_rid();
+					nm.navmesh_debug_instance = RS::get_singleton()->instance_create();
+					RS::get_singleton()->instance_set_base(nm.navmesh_debug_instance, navmesh_debug_rid);
+					RS::get_singleton()->mesh_surface_set_material(navmesh_debug_rid, 0, st->get_debug_navigation_material()->get_rid());
+				}
+				if (is_inside_tree()) {
+					RS::get_singleton()->instance_set_scenario(nm.navmesh_debug_instance, get_world_3d()->get_scenario());
+					RS::get_singleton()->instance_set_transform(nm.navmesh_debug_instance, get_global_transform() * nm.xform);
 				}
 			}
-
-			g.navmesh_ids[E] = nm;
 		}
+
+		g.navmesh_ids[build_nm.cell] = nm;
 	}
 
 	//update multimeshes, only if not baked
 	if (baked_meshes.size() == 0) {
-		for (const KeyValue<int, List<Pair<Transform3D, IndexKey>>> &E : multimesh_items) {
+		for (uint32_t i = 0; i < p_build.multimeshes.size(); i++) {
+			const OctantBuild::Multimesh &build_mm = p_build.multimeshes[i];
 			Octant::MultimeshInstance mmi;
 
 			RID mm = RS::get_singleton()->multimesh_create();
-			RS::get_singleton()->multimesh_allocate_data(mm, E.value.size(), RS::MULTIMESH_TRANSFORM_3D);
-			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.key)->get_rid());
-
-			int idx = 0;
-			for (const Pair<Transform3D, IndexKey> &F : E.value) {
-				RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
+			RS::get_singleton()->multimesh_allocate_data(mm, build_mm.buffer.size() / 12, RS::MULTIMESH_TRANSFORM_3D);
+			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(build_mm.item)->get_rid());
+			RS::get_singleton()->multimesh_set_buffer(mm, build_mm.buffer);
 #ifdef TOOLS_ENABLED
-
-				Octant::MultimeshInstance::Item it;
-				it.index = idx;
-				it.transform = F.first;
-				it.key = F.second;
-				mmi.items.push_back(it);
+			mmi.items = build_mm.items;
 #endif
 
-				idx++;
-			}
-
 			RID instance = RS::get_singleton()->instance_create();
 			RS::get_singleton()->instance_set_base(instance, mm);
 
@@ -631,10 +668,10 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		}
 	}
 
-	if (col_debug.size()) {
+	if (p_build.collision_debug_vertices.size()) {
 		Array arr;
 		arr.resize(RS::ARRAY_MAX);
-		arr[RS::ARRAY_VERTEX] = col_debug;
+		arr[RS::ARRAY_VERTEX] = p_build.collision_debug_vertices;
 
 		RS::get_singleton()->mesh_add_surface_from_arrays(g.collision_debug, RS::PRIMITIVE_LINES, arr);
 		SceneTree *st = SceneTree::get_singleton();
@@ -644,8 +681,6 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	}
 
 	g.dirty = false;
-
-	return false;
 }
 
 void GridMap::_reset_physic_bodies_collision_filters() {
@@ -865,12 +900,32 @@ void GridMap::_update_octants_callback() {
 	}
 
 	List<OctantKey> to_delete;
+	LocalVector<OctantBuild> builds;
 	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
-		if (_octant_update(E.key)) {
+		if (!E.value->dirty) {
+			continue;
+		}
+		if (_octant_clear(E.key)) {
 			to_delete.push_back(E.key);
+		} else {
+			builds.push_back(OctantBuild());
+			builds[builds.size() - 1].key = E.key;
 		}
 	}
 
+	// Building the octants only reads the cells and the mesh library, so they are built in parallel,
+	// and only handed to the servers on the main thread.
+	if (builds.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GridMap::_octant_build_task, builds.ptr(), builds.size(), -1, true, SNAME("GridMapBuildOctants"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (builds.size() == 1) {
+		_octant_build(builds[0]);
+	}
+
+	for (uint32_t i = 0; i < builds.size(); i++) {
+		_octant_commit(builds[i]);
+	}
+
 	while (to_delete.front()) {
 		memdelete(octant_map[to_delete.front()->get()]);
 		octant_map.erase(to_delete.front()->get());
@@ -183,7 +183,39 @@ class GridMap : public Node3D {
 	void _reset_physic_bodies_collision_filters();
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
-	bool _octant_update(const OctantKey &p_key);
+
+	// Everything an octant update needs without touching the servers, so octants can be built on worker threads.
+	struct OctantBuild {
+		struct Multimesh {
+			int item = -1;
+			Vector<float> buffer;
+#ifdef TOOLS_ENABLED
+			Vector<Octant::MultimeshInstance::Item> items;
+#endif
+		};
+
+		struct Shape {
+			RID shape;
+			Transform3D xform;
+		};
+
+		struct NavMesh {
+			IndexKey cell;
+			Ref<NavigationMesh> navmesh;
+			Transform3D xform;
+		};
+
+		OctantKey key;
+		LocalVector<Multimesh> multimeshes;
+		LocalVector<Shape> shapes;
+		Vector<Vector3> collision_debug_vertices;
+		LocalVector<NavMesh> navmeshes;
+	};
+
+	bool _octant_clear(const OctantKey &p_key);
+	void _octant_build(OctantBuild &r_build) const;
+	void _octant_build_task(uint32_t p_index, OctantBuild *p_builds);
+	void _octant_commit(const OctantBuild &p_build);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
 	bool awaiting_update = false;
@@ -615,6 +615,55 @@ void LightmapperRD::_raster_geometry(RenderingDevice *rd, Size2i atlas_size, int
 	}
 }
 
+void LightmapperRD::_dispatch_regions(RenderingDevice *rd, RID p_pipeline, RID p_base_uniform_set, RID p_uniform_set, PushConstant &push_constant, const Size2i &atlas_size, int atlas_slices, float p_from_progress, float p_to_progress, const String &p_text, BakeStepFunc p_step_function, void *p_bake_userdata) {
+	// Submitting every region on its own keeps each submission short enough to not trip the driver's GPU timeout on big atlases.
+	int max_region_size = nearest_power_of_2_templated(int(GLOBAL_GET("rendering/lightmapping/bake_performance/region_size")));
+
+	int x_regions = (atlas_size.width - 1) / max_region_size + 1;
+	int y_regions = (atlas_size.height - 1) / max_region_size + 1;
+	int total = atlas_slices * x_regions * y_regions;
+	int count = 0;
+
+	for (int s = 0; s < atlas_slices; s++) {
+		push_constant.atlas_slice = s;
+
+		for (int i = 0; i < x_regions; i++) {
+			for (int j = 0; j < y_regions; j++) {
+				int x = i * max_region_size;
+				int y = j * max_region_size;
+				int w = MIN((i + 1) * max_region_size, atlas_size.width) - x;
+				int h = MIN((j + 1) * max_region_size, atlas_size.height) - y;
+
+				push_constant.region_ofs[0] = x;
+				push_constant.region_ofs[1] = y;
+
+				Vector3i group_size((w - 1) / 8 + 1, (h - 1) / 8 + 1, 1);
+
+				RD::ComputeListID compute_list = rd->compute_list_begin();
+				rd->compute_list_bind_compute_pipeline(compute_list, p_pipeline);
+				rd->compute_list_bind_uniform_set(compute_list, p_base_uniform_set, 0);
+				rd->compute_list_bind_uniform_set(compute_list, p_uniform_set, 1);
+				rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(PushConstant));
+				rd->compute_list_dispatch(compute_list, group_size.x, group_size.y, group_size.z);
+				rd->compute_list_end();
+
+				if (total > 1) {
+					rd->submit();
+					rd->sync();
+				}
+
+				count++;
+				if (p_step_function && total > 1) {
+					p_step_function(p_from_progress + (p_to_progress - p_from_progress) * count / total, p_text, p_bake_userdata, false);
+				}
+			}
+		}
+	}
+
+	push_constant.region_ofs[0] = 0;
+	push_constant.region_ofs[1] = 0;
+}
+
 LightmapperRD::BakeError LightmapperRD::_dilate(RenderingDevice *rd, Ref<RDShaderFile> &compute_shader, RID &compute_base_uniform_set, PushConstant &push_constant, RID &source_light_tex, RID &dest_light_tex, const Size2i &atlas_size, int atlas_slices) {
 	Vector<RD::Uniform> uniforms;
 	{
@@ -1045,7 +1094,6 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 		push_constant.environment_xform[11] = 0;
 	}
 
-	Vector3i group_size((atlas_size.x - 1) / 8 + 1, (atlas_size.y - 1) / 8 + 1, 1);
 	rd->submit();
 	rd->sync();
 
@@ -1075,18 +1123,7 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 
 		RID unocclude_uniform_set = rd->uniform_set_create(uniforms, compute_shader_unocclude, 1);
 
-		RD::ComputeListID compute_list = rd->compute_list_begin();
-		rd->compute_list_bind_compute_pipeline(compute_list, compute_shader_unocclude_pipeline);
-		rd->compute_list_bind_uniform_set(compute_list, compute_base_uniform_set, 0);
-		rd->compute_list_bind_uniform_set(compute_list, unocclude_uniform_set, 1);
-
-		for (int i = 0; i < atlas_slices; i++) {
-			push_constant.atlas_slice = i;
-			rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(PushConstant));
-			rd->compute_list_dispatch(compute_list, group_size.x, group_size.y, group_size.z);
-			//no barrier, let them run all together
-		}
-		rd->compute_list_end(); //done
+		_dispatch_regions(rd, compute_shader_unocclude_pipeline, compute_base_uniform_set, unocclude_uniform_set, push_constant, atlas_size, atlas_slices, 0.49, 0.5, RTR("Un-occluding geometry"), p_step_function, p_bake_userdata);
 	}
 
 	if (p_step_function) {
@@ -1160,18 +1197,7 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 
 		push_constant.ray_count = CLAMP(push_constant.ray_count, 16u, 8192u);
 
-		RD::ComputeListID compute_list = rd->compute_list_begin();
-		rd->compute_list_bind_compute_pipeline(compute_list, compute_shader_primary_pipeline);
-		rd->compute_list_bind_uniform_set(compute_list, compute_base_uniform_set, 0);
-		rd->compute_list_bind_uniform_set(compute_list, light_uniform_set, 1);
-
-		for (int i = 0; i < atlas_slices; i++) {
-			push_constant.atlas_slice = i;
-			rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(PushConstant));
-			rd->compute_list_dispatch(compute_list, group_size.x, group_size.y, group_size.z);
-			//no barrier, let them run all together
-		}
-		rd->compute_list_end(); //done
+		_dispatch_regions(rd, compute_shader_primary_pipeline, compute_base_uniform_set, light_uniform_set, push_constant, atlas_size, atlas_slices, 0.5, 0.6, RTR("Plot direct lighting"), p_step_function, p_bake_userdata);
 	}
 
 #ifdef DEBUG_TEXTURES
@@ -1280,7 +1306,7 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 						push_constant.region_ofs[0] = x;
 						push_constant.region_ofs[1] = y;
 
-						group_size = Vector3i((w - 1) / 8 + 1, (h - 1) / 8 + 1, 1);
+						Vector3i group_size((w - 1) / 8 + 1, (h - 1) / 8 + 1, 1);
 
 						for (int k = 0; k < ray_iterations; k++) {
 							RD::ComputeListID compute_list = rd->compute_list_begin();
@@ -29,9 +29,52 @@
 /*************************************************************************/
 
 #include "register_types.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/surface_tool.h"
 #include "thirdparty/meshoptimizer/meshoptimizer.h"
 
+static size_t build_meshlets(unsigned int *r_meshlet_index_counts, unsigned int *r_indices, const unsigned int *p_indices, size_t p_index_count, const float *p_vertex_positions, size_t p_vertex_count, size_t p_vertex_positions_stride, size_t p_max_vertices, size_t p_max_triangles, float p_cone_weight) {
+	size_t max_meshlets = meshopt_buildMeshletsBound(p_index_count, p_max_vertices, p_max_triangles);
+
+	LocalVector<meshopt_Meshlet> meshlets;
+	meshlets.resize(max_meshlets);
+	LocalVector<unsigned int> meshlet_vertices;
+	meshlet_vertices.resize(max_meshlets * p_max_vertices);
+	LocalVector<unsigned char> meshlet_triangles;
+	meshlet_triangles.resize(max_meshlets * p_max_triangles * 3);
+
+	size_t meshlet_count = meshopt_buildMeshlets(meshlets.ptr(), meshlet_vertices.ptr(), meshlet_triangles.ptr(), p_indices, p_index_count, p_vertex_positions, p_vertex_count, p_vertex_positions_stride, p_max_vertices, p_max_triangles, p_cone_weight);
+
+	// Meshlets reference their vertices through a local table, go back to regular indices.
+	size_t offset = 0;
+	for (size_t i = 0; i < meshlet_count; i++) {
+		const meshopt_Meshlet &meshlet = meshlets[i];
+		for (size_t j = 0; j < meshlet.triangle_count * 3; j++) {
+			r_indices[offset++] = meshlet_vertices[meshlet.vertex_offset + meshlet_triangles[meshlet.triangle_offset + j]];
+		}
+		r_meshlet_index_counts[i] = meshlet.triangle_count * 3;
+	}
+
+	return meshlet_count;
+}
+
+static void compute_cluster_bounds(float *r_bounds, const unsigned int *p_indices, size_t p_index_count, const float *p_vertex_positions, size_t p_vertex_count, size_t p_vertex_positions_stride) {
+	meshopt_Bounds bounds = meshopt_computeClusterBounds(p_indices, p_index_count, p_vertex_positions, p_vertex_count, p_vertex_positions_stride);
+
+	r_bounds[0] = bounds.center[0];
+	r_bounds[1] = bounds.center[1];
+	r_bounds[2] = bounds.center[2];
+	r_bounds[3] = bounds.radius;
+	r_bounds[4] = bounds.cone_axis[0];
+	r_bounds[5] = bounds.cone_axis[1];
+	r_bounds[6] = bounds.cone_axis[2];
+	r_bounds[7] = bounds.cone_cutoff;
+}
+
+static float analyze_vertex_cache(const unsigned int *p_indices, size_t p_index_count, size_t p_vertex_count, unsigned int p_cache_size) {
+	return meshopt_analyzeVertexCache(p_indices, p_index_count, p_vertex_count, p_cache_size, 0, 0).acmr;
+}
+
 void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
@@ -45,6 +88,12 @@ void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = meshopt_generateVertexRemap;
 	SurfaceTool::remap_vertex_func = meshopt_remapVertexBuffer;
 	SurfaceTool::remap_index_func = meshopt_remapIndexBuffer;
+	SurfaceTool::build_meshlets_bound_func = meshopt_buildMeshletsBound;
+	SurfaceTool::build_meshlets_func = build_meshlets;
+	SurfaceTool::compute_cluster_bounds_func = compute_cluster_bounds;
+	SurfaceTool::optimize_overdraw_func = meshopt_optimizeOverdraw;
+	SurfaceTool::optimize_vertex_fetch_remap_func = meshopt_optimizeVertexFetchRemap;
+	SurfaceTool::analyze_vertex_cache_func = analyze_vertex_cache;
 }
 
 void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
@@ -59,4 +108,10 @@ void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = nullptr;
 	SurfaceTool::remap_vertex_func = nullptr;
 	SurfaceTool::remap_index_func = nullptr;
+	SurfaceTool::build_meshlets_bound_func = nullptr;
+	SurfaceTool::build_meshlets_func = nullptr;
+	SurfaceTool::compute_cluster_bounds_func = nullptr;
+	SurfaceTool::optimize_overdraw_func = nullptr;
+	SurfaceTool::optimize_vertex_fetch_remap_func = nullptr;
+	SurfaceTool::analyze_vertex_cache_func = nullptr;
 }
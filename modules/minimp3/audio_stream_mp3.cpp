@@ -105,6 +105,7 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(float p_from_pos) {
+	set_prefetch_enabled(mp3_stream->prefetch_enabled);
 	active = true;
 	seek(p_from_pos);
 	loops = 0;
@@ -112,11 +113,12 @@ void AudioStreamPlaybackMP3::start(float p_from_pos) {
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	prefetch_reset();
 	active = false;
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
-	return active;
+	return active || get_prefetched_frames() > 0;
 }
 
 int AudioStreamPlaybackMP3::get_loop_count() const {
@@ -124,10 +126,17 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 float AudioStreamPlaybackMP3::get_playback_position() const {
-	return float(frames_mixed) / mp3_stream->sample_rate;
+	// The frames decoded ahead haven't been played yet.
+	float position = float(frames_mixed) / mp3_stream->sample_rate - float(get_prefetched_frames()) / mp3_stream->sample_rate;
+	if (position < 0) {
+		position = MAX(0, position + mp3_stream->get_length() - mp3_stream->loop_offset);
+	}
+	return position;
 }
 
 void AudioStreamPlaybackMP3::seek(float p_time) {
+	prefetch_reset();
+
 	if (!active) {
 		return;
 	}
@@ -140,11 +149,40 @@ void AudioStreamPlaybackMP3::seek(float p_time) {
 	mp3dec_ex_seek(mp3d, (uint64_t)frames_mixed * mp3_stream->channels);
 }
 
+bool AudioStreamPlaybackMP3::can_skip() const {
+	return true;
+}
+
+void AudioStreamPlaybackMP3::skip(float p_time) {
+	float position = get_playback_position() + p_time;
+	// Drop what was decoded ahead, also when the decoding already reached the end.
+	prefetch_reset();
+	if (!active) {
+		return;
+	}
+
+	float length = mp3_stream->get_length();
+	if (position >= length) {
+		float loop_length = length - mp3_stream->loop_offset;
+		if (!mp3_stream->loop || loop_length <= 0) {
+			active = false;
+			return;
+		}
+		int skipped_loops = int((position - length) / loop_length) + 1;
+		loops += skipped_loops;
+		position -= skipped_loops * loop_length;
+	}
+
+	seek(position);
+}
+
 void AudioStreamPlaybackMP3::tag_used_streams() {
 	mp3_stream->tag_used(get_playback_position());
 }
 
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	prefetch_reset();
+
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
@@ -225,6 +263,14 @@ float AudioStreamMP3::get_loop_offset() const {
 	return loop_offset;
 }
 
+void AudioStreamMP3::set_prefetch_enabled(bool p_enabled) {
+	prefetch_enabled = p_enabled;
+}
+
+bool AudioStreamMP3::is_prefetch_enabled() const {
+	return prefetch_enabled;
+}
+
 float AudioStreamMP3::get_length() const {
 	return length;
 }
@@ -273,6 +319,9 @@ void AudioStreamMP3::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_loop_offset", "seconds"), &AudioStreamMP3::set_loop_offset);
 	ClassDB::bind_method(D_METHOD("get_loop_offset"), &AudioStreamMP3::get_loop_offset);
 
+	ClassDB::bind_method(D_METHOD("set_prefetch_enabled", "enabled"), &AudioStreamMP3::set_prefetch_enabled);
+	ClassDB::bind_method(D_METHOD("is_prefetch_enabled"), &AudioStreamMP3::is_prefetch_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_bpm", "bpm"), &AudioStreamMP3::set_bpm);
 	ClassDB::bind_method(D_METHOD("get_bpm"), &AudioStreamMP3::get_bpm);
 
@@ -288,6 +337,7 @@ void AudioStreamMP3::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "bar_beats", PROPERTY_HINT_RANGE, "2,32,1,or_greater"), "set_bar_beats", "get_bar_beats");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "loop_offset"), "set_loop_offset", "get_loop_offset");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "prefetch_enabled"), "set_prefetch_enabled", "is_prefetch_enabled");
 }
 
 AudioStreamMP3::AudioStreamMP3() {
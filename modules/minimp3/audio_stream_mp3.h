@@ -70,6 +70,9 @@ public:
 	virtual float get_playback_position() const override;
 	virtual void seek(float p_time) override;
 
+	virtual bool can_skip() const override;
+	virtual void skip(float p_time) override;
+
 	virtual void tag_used_streams() override;
 
 	AudioStreamPlaybackMP3() {}
@@ -91,6 +94,7 @@ class AudioStreamMP3 : public AudioStream {
 	float length = 0.0;
 	bool loop = false;
 	float loop_offset = 0.0;
+	bool prefetch_enabled = false;
 	void clear_data();
 
 	double bpm = 0;
@@ -107,6 +111,9 @@ public:
 	void set_loop_offset(float p_seconds);
 	float get_loop_offset() const;
 
+	void set_prefetch_enabled(bool p_enabled);
+	bool is_prefetch_enabled() const;
+
 	void set_bpm(double p_bpm);
 	virtual double get_bpm() const override;
 
@@ -113,6 +113,7 @@ GodotNavigationServer::GodotNavigationServer() {}
 
 GodotNavigationServer::~GodotNavigationServer() {
 	flush_queries();
+	path_queries_solving.clear();
 }
 
 void GodotNavigationServer::add_command(SetCommand *command) const {
@@ -210,6 +211,34 @@ real_t GodotNavigationServer::map_get_edge_connection_margin(RID p_map) const {
 	return map->get_edge_connection_margin();
 }
 
+COMMAND_2(map_set_avoidance_lod_origin, RID, p_map, Vector3, p_origin) {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_COND(map == nullptr);
+
+	map->set_avoidance_lod_origin(p_origin);
+}
+
+Vector3 GodotNavigationServer::map_get_avoidance_lod_origin(RID p_map) const {
+	const NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_COND_V(map == nullptr, Vector3());
+
+	return map->get_avoidance_lod_origin();
+}
+
+COMMAND_2(map_set_avoidance_lod_distance, RID, p_map, real_t, p_distance) {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_COND(map == nullptr);
+
+	map->set_avoidance_lod_distance(p_distance);
+}
+
+real_t GodotNavigationServer::map_get_avoidance_lod_distance(RID p_map) const {
+	const NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_COND_V(map == nullptr, 0);
+
+	return map->get_avoidance_lod_distance();
+}
+
 Vector<Vector3> GodotNavigationServer::map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) const {
 	const NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_COND_V(map == nullptr, Vector<Vector3>());
@@ -217,6 +246,76 @@ Vector<Vector3> GodotNavigationServer::map_get_path(RID p_map, Vector3 p_origin,
 	return map->get_path(p_origin, p_destination, p_optimize, p_navigation_layers);
 }
 
+void GodotNavigationServer::map_get_path_async(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, const Callable &p_callback, uint32_t p_navigation_layers) const {
+	ERR_FAIL_COND(!map_owner.owns(p_map));
+	ERR_FAIL_COND(p_callback.is_null());
+
+	GodotNavigationServer *mut_this = const_cast<GodotNavigationServer *>(this);
+	MutexLock lock(mut_this->path_queries_mutex);
+
+	PathQuery query;
+	query.map = p_map;
+	query.origin = p_origin;
+	query.destination = p_destination;
+	query.optimize = p_optimize;
+	query.navigation_layers = p_navigation_layers;
+	query.callback = p_callback;
+	mut_this->path_queries.push_back(query);
+}
+
+void GodotNavigationServer::_solve_path_query(uint32_t p_index, PathQuery *p_queries) {
+	PathQuery &query = p_queries[p_index];
+	if (query.map_ptr) {
+		query.path = query.map_ptr->get_path(query.origin, query.destination, query.optimize, query.navigation_layers);
+	}
+}
+
+void GodotNavigationServer::_start_path_queries() {
+	MutexLock lock(path_queries_mutex);
+	ERR_FAIL_COND(path_queries_task != -1);
+
+	if (path_queries.is_empty()) {
+		return;
+	}
+	SWAP(path_queries, path_queries_solving);
+
+	// Resolved here, so the worker threads don't access the RID owner. Queries on maps freed since then are answered with an empty path.
+	for (uint32_t i = 0; i < path_queries_solving.size(); i++) {
+		path_queries_solving[i].map_ptr = map_owner.get_or_null(path_queries_solving[i].map);
+	}
+
+	// The maps are only changed again in flush_queries() and sync(), which wait for these to finish first.
+	path_queries_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer::_solve_path_query, path_queries_solving.ptr(), path_queries_solving.size(), -1, false, SNAME("NavigationPathQueries"));
+}
+
+void GodotNavigationServer::_finish_path_queries() {
+	MutexLock lock(path_queries_mutex);
+	if (path_queries_task != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(path_queries_task);
+		path_queries_task = -1;
+	}
+}
+
+void GodotNavigationServer::_dispatch_path_queries() {
+	_finish_path_queries();
+
+	for (uint32_t i = 0; i < path_queries_solving.size(); i++) {
+		const PathQuery &query = path_queries_solving[i];
+		if (!query.callback.is_valid()) {
+			continue;
+		}
+		Variant path = query.path;
+		const Variant *vp[1] = { &path };
+		Variant ret;
+		Callable::CallError ce;
+		query.callback.call(vp, 1, ret, ce);
+		if (ce.error != Callable::CallError::CALL_OK) {
+			ERR_PRINT("Error calling path query callback: " + Variant::get_callable_error_text(query.callback, vp, 1, ce));
+		}
+	}
+	path_queries_solving.clear();
+}
+
 Vector3 GodotNavigationServer::map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	const NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_COND_V(map == nullptr, Vector3());
@@ -591,6 +690,9 @@ void GodotNavigationServer::set_active(bool p_active) const {
 }
 
 void GodotNavigationServer::flush_queries() {
+	// The commands change the maps, so the path queries that are being solved must be done first.
+	_finish_path_queries();
+
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
 	MutexLock lock(commands_mutex);
@@ -612,6 +714,9 @@ void GodotNavigationServer::map_force_update(RID p_map) {
 }
 
 void GodotNavigationServer::process(real_t p_delta_time) {
+	// Deliver the paths solved since the last frame, before the maps change.
+	_dispatch_path_queries();
+
 	flush_queries();
 
 	if (!active) {
@@ -633,6 +738,9 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 			active_maps_update_id[i] = new_map_update_id;
 		}
 	}
+
+	// Solve the queued path queries on the synced maps while the rest of the frame runs.
+	_start_path_queries();
 }
 
 #undef COMMAND_1
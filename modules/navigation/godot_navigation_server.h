@@ -79,6 +79,29 @@ class GodotNavigationServer : public NavigationServer3D {
 	LocalVector<NavMap *> active_maps;
 	LocalVector<uint32_t> active_maps_update_id;
 
+	struct PathQuery {
+		RID map;
+		const NavMap *map_ptr = nullptr;
+		Vector3 origin;
+		Vector3 destination;
+		bool optimize = false;
+		uint32_t navigation_layers = 1;
+		Callable callback;
+		Vector<Vector3> path;
+	};
+
+	/// Guards the queued path queries, which can be added from any thread.
+	Mutex path_queries_mutex;
+	LocalVector<PathQuery> path_queries;
+	/// Queries being solved (or solved and waiting for their callbacks) while the maps are left untouched.
+	LocalVector<PathQuery> path_queries_solving;
+	WorkerThreadPool::GroupID path_queries_task = -1;
+
+	void _solve_path_query(uint32_t p_index, PathQuery *p_queries);
+	void _start_path_queries();
+	void _finish_path_queries();
+	void _dispatch_path_queries();
+
 public:
 	GodotNavigationServer();
 	virtual ~GodotNavigationServer();
@@ -100,7 +123,14 @@ public:
 	COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin);
 	virtual real_t map_get_edge_connection_margin(RID p_map) const override;
 
+	COMMAND_2(map_set_avoidance_lod_origin, RID, p_map, Vector3, p_origin);
+	virtual Vector3 map_get_avoidance_lod_origin(RID p_map) const override;
+
+	COMMAND_2(map_set_avoidance_lod_distance, RID, p_map, real_t, p_distance);
+	virtual real_t map_get_avoidance_lod_distance(RID p_map) const override;
+
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) const override;
+	virtual void map_get_path_async(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, const Callable &p_callback, uint32_t p_navigation_layers = 1) const override;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const override;
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const override;
@@ -31,6 +31,7 @@
 #include "nav_map.h"
 
 #include "core/object/worker_thread_pool.h"
+#include "core/os/profiling.h"
 #include "nav_region.h"
 #include "rvo_agent.h"
 #include <algorithm>
@@ -74,32 +75,35 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	float begin_d = 1e20;
 	float end_d = 1e20;
 	// Find the initial poly and the end poly on this map.
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
+	for (size_t r(0); r < regions.size(); r++) {
+		const std::vector<gd::Polygon> &region_polygons = regions[r]->get_polygons();
+		for (size_t i(0); i < region_polygons.size(); i++) {
+			const gd::Polygon &p = region_polygons[i];
 
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
+			// Only consider the polygon if it in a region with compatible layers.
+			if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
 
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+			// For each face check the distance between the origin/destination
+			for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
+				const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
 
-			Vector3 point = face.get_closest_point_to(p_origin);
-			float distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
+				Vector3 point = face.get_closest_point_to(p_origin);
+				float distance_to_point = point.distance_to(p_origin);
+				if (distance_to_point < begin_d) {
+					begin_d = distance_to_point;
+					begin_poly = &p;
+					begin_point = point;
+				}
 
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
+				point = face.get_closest_point_to(p_destination);
+				distance_to_point = point.distance_to(p_destination);
+				if (distance_to_point < end_d) {
+					end_d = distance_to_point;
+					end_poly = &p;
+					end_point = point;
+				}
 			}
 		}
 	}
@@ -117,8 +121,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	}
 
 	// List of all reachable navigation polys.
-	std::vector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.reserve(polygons.size() * 0.75);
+	// Kept per thread and only cleared, so repeated queries (including the parallel asynchronous ones) don't reallocate it.
+	thread_local std::vector<gd::NavigationPoly> navigation_polys;
+	navigation_polys.clear();
+	navigation_polys.reserve(polygon_count * 0.75);
 
 	// Add the start polygon to the reachable navigation polygons.
 	gd::NavigationPoly begin_navigation_poly = gd::NavigationPoly(begin_poly);
@@ -129,7 +135,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	navigation_polys.push_back(begin_navigation_poly);
 
 	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
+	thread_local LocalVector<uint32_t> to_visit;
+	to_visit.clear();
 	to_visit.push_back(0);
 
 	// This is an implementation of the A* algorithm.
@@ -245,8 +252,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		// Find the polygon with the minimum cost from the list of polygons to visit.
 		least_cost_id = -1;
 		float least_cost = 1e30;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
+		for (uint32_t i = 0; i < to_visit.size(); i++) {
+			gd::NavigationPoly *np = &navigation_polys[to_visit[i]];
 			float cost = np->traveled_distance;
 			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
 			if (cost < least_cost) {
@@ -278,7 +285,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return Vector<Vector3>();
 	}
 
-	Vector<Vector3> path;
+	// Built from the end point back to the begin point, in scratch memory, and only copied out in order once done.
+	FrameLocalVector<Vector3> path;
 	// Optimize the path.
 	if (p_optimize) {
 		// Set the apex poly/point to the end point
@@ -354,8 +362,6 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			path.push_back(begin_point);
 		}
 
-		path.reverse();
-
 	} else {
 		path.push_back(end_point);
 
@@ -370,10 +376,15 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		}
 
 		path.push_back(begin_point);
-		path.reverse();
 	}
 
-	return path;
+	Vector<Vector3> result;
+	result.resize(path.size());
+	Vector3 *result_ptr = result.ptrw();
+	for (uint32_t i = 0; i < path.size(); i++) {
+		result_ptr[i] = path[path.size() - 1 - i];
+	}
+	return result;
 }
 
 Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -381,42 +392,45 @@ Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector
 	Vector3 closest_point;
 	real_t closest_point_d = 1e20;
 
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each face check the distance to the segment
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			Vector3 inters;
-			if (f.intersects_segment(p_from, p_to, &inters)) {
-				const real_t d = closest_point_d = p_from.distance_to(inters);
-				if (use_collision == false) {
-					closest_point = inters;
-					use_collision = true;
-					closest_point_d = d;
-				} else if (closest_point_d > d) {
-					closest_point = inters;
-					closest_point_d = d;
+	for (size_t r(0); r < regions.size(); r++) {
+		const std::vector<gd::Polygon> &region_polygons = regions[r]->get_polygons();
+		for (size_t i(0); i < region_polygons.size(); i++) {
+			const gd::Polygon &p = region_polygons[i];
+
+			// For each face check the distance to the segment
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				Vector3 inters;
+				if (f.intersects_segment(p_from, p_to, &inters)) {
+					const real_t d = closest_point_d = p_from.distance_to(inters);
+					if (use_collision == false) {
+						closest_point = inters;
+						use_collision = true;
+						closest_point_d = d;
+					} else if (closest_point_d > d) {
+						closest_point = inters;
+						closest_point_d = d;
+					}
 				}
 			}
-		}
 
-		if (use_collision == false) {
-			for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
-				Vector3 a, b;
-
-				Geometry3D::get_closest_points_between_segments(
-						p_from,
-						p_to,
-						p.points[point_id].pos,
-						p.points[(point_id + 1) % p.points.size()].pos,
-						a,
-						b);
-
-				const real_t d = a.distance_to(b);
-				if (d < closest_point_d) {
-					closest_point_d = d;
-					closest_point = b;
+			if (use_collision == false) {
+				for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
+					Vector3 a, b;
+
+					Geometry3D::get_closest_points_between_segments(
+							p_from,
+							p_to,
+							p.points[point_id].pos,
+							p.points[(point_id + 1) % p.points.size()].pos,
+							a,
+							b);
+
+					const real_t d = a.distance_to(b);
+					if (d < closest_point_d) {
+						closest_point_d = d;
+						closest_point = b;
+					}
 				}
 			}
 		}
@@ -444,19 +458,22 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 	gd::ClosestPointQueryResult result;
 	real_t closest_point_ds = 1e20;
 
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
+	for (size_t r(0); r < regions.size(); r++) {
+		const std::vector<gd::Polygon> &region_polygons = regions[r]->get_polygons();
+		for (size_t i(0); i < region_polygons.size(); i++) {
+			const gd::Polygon &p = region_polygons[i];
+
+			// For each face check the distance to the point
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				const Vector3 inters = f.get_closest_point_to(p_point);
+				const real_t ds = inters.distance_squared_to(p_point);
+				if (ds < closest_point_ds) {
+					result.point = inters;
+					result.normal = f.get_plane().normal;
+					result.owner = p.owner->get_self();
+					closest_point_ds = ds;
+				}
 			}
 		}
 	}
@@ -466,14 +483,18 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 
 void NavMap::add_region(NavRegion *p_region) {
 	regions.push_back(p_region);
-	regenerate_links = true;
+	p_region->scratch_polygons();
 }
 
 void NavMap::remove_region(NavRegion *p_region) {
 	const std::vector<NavRegion *>::iterator it = std::find(regions.begin(), regions.end(), p_region);
 	if (it != regions.end()) {
+		// Unlink the region right away, as it may be freed before the next sync.
+		if (!p_region->get_polygons().empty()) {
+			removed_region_bounds.push_back(p_region->get_bounds());
+		}
+		_remove_region_links(p_region);
 		regions.erase(it);
-		regenerate_links = true;
 	}
 }
 
@@ -484,7 +505,6 @@ bool NavMap::has_agent(RvoAgent *agent) const {
 void NavMap::add_agent(RvoAgent *agent) {
 	if (!has_agent(agent)) {
 		agents.push_back(agent);
-		agents_dirty = true;
 	}
 }
 
@@ -493,7 +513,7 @@ void NavMap::remove_agent(RvoAgent *agent) {
 	const std::vector<RvoAgent *>::iterator it = std::find(agents.begin(), agents.end(), agent);
 	if (it != agents.end()) {
 		agents.erase(it);
-		agents_dirty = true;
+		_remove_agent_from_grid(agent);
 	}
 }
 
@@ -512,85 +532,119 @@ void NavMap::remove_agent_as_controlled(RvoAgent *agent) {
 	}
 }
 
-void NavMap::sync() {
-	// Check if we need to update the links.
-	if (regenerate_polygons) {
-		for (size_t r(0); r < regions.size(); r++) {
-			regions[r]->scratch_polygons();
+static gd::EdgeKey _get_free_edge_key(const gd::Edge::Connection &p_edge) {
+	return gd::EdgeKey(p_edge.polygon->points[p_edge.edge].key, p_edge.polygon->points[(p_edge.edge + 1) % p_edge.polygon->points.size()].key);
+}
+
+void NavMap::_remove_region_links(NavRegion *p_region) {
+	const LocalVector<gd::Edge::Connection> &free_edges = p_region->get_free_edges();
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		const gd::Edge::Connection &free_edge = free_edges[i];
+		free_edge.polygon->edges[free_edge.edge].connections.clear();
+
+		HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator E = free_edge_keys.find(_get_free_edge_key(free_edge));
+		if (!E) {
+			continue;
+		}
+		for (uint32_t j = 0; j < E->value.size(); j++) {
+			if (E->value[j].polygon == free_edge.polygon && E->value[j].edge == free_edge.edge) {
+				E->value.remove_at(j);
+				break;
+			}
+		}
+		if (E->value.is_empty()) {
+			free_edge_keys.remove(E);
 		}
-		regenerate_links = true;
 	}
+	p_region->get_connections().clear();
 
+	// Only the regions close enough to have an edge near one of this region can be linked to it.
+	const AABB bounds = p_region->get_bounds().grow(edge_connection_margin);
 	for (size_t r(0); r < regions.size(); r++) {
-		if (regions[r]->sync()) {
-			regenerate_links = true;
+		NavRegion *region = regions[r];
+		if (region == p_region || !region->get_bounds().intersects_inclusive(bounds)) {
+			continue;
 		}
-	}
 
-	if (regenerate_links) {
-		// Remove regions connections.
-		for (size_t r(0); r < regions.size(); r++) {
-			regions[r]->get_connections().clear();
+		const LocalVector<gd::Edge::Connection> &region_free_edges = region->get_free_edges();
+		for (uint32_t i = 0; i < region_free_edges.size(); i++) {
+			Vector<gd::Edge::Connection> &connections = region_free_edges[i].polygon->edges[region_free_edges[i].edge].connections;
+			for (int j = connections.size() - 1; j >= 0; j--) {
+				if (connections[j].polygon->owner == p_region) {
+					connections.remove_at(j);
+				}
+			}
 		}
 
-		// Resize the polygon count.
-		int count = 0;
-		for (size_t r(0); r < regions.size(); r++) {
-			count += regions[r]->get_polygons().size();
+		Vector<gd::Edge::Connection> &region_connections = region->get_connections();
+		for (int j = region_connections.size() - 1; j >= 0; j--) {
+			if (region_connections[j].polygon->owner == p_region) {
+				region_connections.remove_at(j);
+			}
 		}
-		polygons.resize(count);
+	}
+}
 
-		// Copy all region polygons in the map.
-		count = 0;
-		for (size_t r(0); r < regions.size(); r++) {
-			std::copy(
-					regions[r]->get_polygons().data(),
-					regions[r]->get_polygons().data() + regions[r]->get_polygons().size(),
-					polygons.begin() + count);
-			count += regions[r]->get_polygons().size();
+void NavMap::_add_region_free_edges(NavRegion *p_region) {
+	const LocalVector<gd::Edge::Connection> &free_edges = p_region->get_free_edges();
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		const gd::EdgeKey ek = _get_free_edge_key(free_edges[i]);
+		HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator E = free_edge_keys.find(ek);
+		if (!E) {
+			E = free_edge_keys.insert(ek, LocalVector<gd::Edge::Connection>());
 		}
+		E->value.push_back(free_edges[i]);
+	}
+}
 
-		// Group all edges per key.
-		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
-		for (size_t poly_id(0); poly_id < polygons.size(); poly_id++) {
-			gd::Polygon &poly(polygons[poly_id]);
+void NavMap::_link_region(NavRegion *p_region) {
+	// Links the free edges of this region to the ones of the other regions. The links the other regions have to this one are made when linking them.
+	const LocalVector<gd::Edge::Connection> &free_edges = p_region->get_free_edges();
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		free_edges[i].polygon->edges[free_edges[i].edge].connections.clear();
+	}
+	p_region->get_connections().clear();
 
-			for (size_t p(0); p < poly.points.size(); p++) {
-				int next_point = (p + 1) % poly.points.size();
-				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+	if (free_edges.is_empty()) {
+		return;
+	}
 
-				HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
-				if (!connection) {
-					connections[ek] = Vector<gd::Edge::Connection>();
-				}
-				if (connections[ek].size() <= 1) {
-					// Add the polygon/edge tuple to this key.
-					gd::Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.points[p].pos;
-					new_connection.pathway_end = poly.points[next_point].pos;
-					connections[ek].push_back(new_connection);
-				} else {
-					// The edge is already connected with another edge, skip.
-					ERR_PRINT_ONCE("Attempted to merge a navigation mesh triangle edge with another already-merged edge. This happens when the current `cell_size` is different from the one used to generate the navigation mesh. This will cause navigation problems.");
-				}
+	// Gather the free edges of the nearby regions that aren't shared with another region.
+	LocalVector<gd::Edge::Connection> near_edges;
+	const AABB bounds = p_region->get_bounds().grow(edge_connection_margin);
+	for (size_t r(0); r < regions.size(); r++) {
+		const NavRegion *region = regions[r];
+		if (region == p_region || !region->get_bounds().intersects_inclusive(bounds)) {
+			continue;
+		}
+
+		const LocalVector<gd::Edge::Connection> &region_free_edges = region->get_free_edges();
+		for (uint32_t j = 0; j < region_free_edges.size(); j++) {
+			const LocalVector<gd::Edge::Connection> *same_key = free_edge_keys.getptr(_get_free_edge_key(region_free_edges[j]));
+			if (same_key && same_key->size() == 1) {
+				near_edges.push_back(region_free_edges[j]);
 			}
 		}
+	}
 
-		Vector<gd::Edge::Connection> free_edges;
-		for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
-			if (E.value.size() == 2) {
-				// Connect edge that are shared in different polygons.
-				gd::Edge::Connection &c1 = E.value.write[0];
-				gd::Edge::Connection &c2 = E.value.write[1];
-				c1.polygon->edges[c1.edge].connections.push_back(c2);
-				c2.polygon->edges[c2.edge].connections.push_back(c1);
-				// Note: The pathway_start/end are full for those connection and do not need to be modified.
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		const gd::Edge::Connection &free_edge = free_edges[i];
+
+		const LocalVector<gd::Edge::Connection> *same_key = free_edge_keys.getptr(_get_free_edge_key(free_edge));
+		ERR_CONTINUE(!same_key);
+		if (same_key->size() >= 2) {
+			// Connect the edge shared with another region. Only the first two edges with a key are connected, like inside a region.
+			const gd::Edge::Connection &c1 = (*same_key)[0];
+			const gd::Edge::Connection &c2 = (*same_key)[1];
+			if (c1.polygon == free_edge.polygon && c1.edge == free_edge.edge) {
+				free_edge.polygon->edges[free_edge.edge].connections.push_back(c2);
+			} else if (c2.polygon == free_edge.polygon && c2.edge == free_edge.edge) {
+				free_edge.polygon->edges[free_edge.edge].connections.push_back(c1);
 			} else {
-				CRASH_COND_MSG(E.value.size() != 1, vformat("Number of connection != 1. Found: %d", E.value.size()));
-				free_edges.push_back(E.value[0]);
+				ERR_PRINT_ONCE("Attempted to merge a navigation mesh triangle edge with another already-merged edge. This happens when the current `cell_size` is different from the one used to generate the navigation mesh. This will cause navigation problems.");
 			}
+			// Note: The pathway_start/end are full for those connection and do not need to be modified.
+			continue;
 		}
 
 		// Find the compatible near edges.
@@ -600,90 +654,244 @@ void NavMap::sync() {
 		// to be connected, create new polygons to remove that small gap is
 		// not really useful and would result in wasteful computation during
 		// connection, integration and path finding.
-		for (int i = 0; i < free_edges.size(); i++) {
-			const gd::Edge::Connection &free_edge = free_edges[i];
-			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
-
-			for (int j = 0; j < free_edges.size(); j++) {
-				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
-				}
+		Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
+		Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
 
-				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
+		for (uint32_t j = 0; j < near_edges.size(); j++) {
+			const gd::Edge::Connection &other_edge = near_edges[j];
 
-				// Compute the projection of the opposite edge on the current one
-				Vector3 edge_vector = edge_p2 - edge_p1;
-				float projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-				float projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-				if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-					continue;
-				}
+			Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
+			Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
 
-				// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-				Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other1;
-				if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-					other1 = other_edge_p1;
-				} else {
-					other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-				}
-				if (other1.distance_to(self1) > edge_connection_margin) {
-					continue;
-				}
+			// Compute the projection of the opposite edge on the current one
+			Vector3 edge_vector = edge_p2 - edge_p1;
+			float projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+			float projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+			if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+				continue;
+			}
 
-				Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other2;
-				if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-					other2 = other_edge_p2;
-				} else {
-					other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-				}
-				if (other2.distance_to(self2) > edge_connection_margin) {
-					continue;
-				}
+			// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+			Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+			Vector3 other1;
+			if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+				other1 = other_edge_p1;
+			} else {
+				other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+			}
+			if (other1.distance_to(self1) > edge_connection_margin) {
+				continue;
+			}
+
+			Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+			Vector3 other2;
+			if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+				other2 = other_edge_p2;
+			} else {
+				other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+			}
+			if (other2.distance_to(self2) > edge_connection_margin) {
+				continue;
+			}
+
+			// The edges can now be connected.
+			gd::Edge::Connection new_connection = other_edge;
+			new_connection.pathway_start = (self1 + other1) / 2.0;
+			new_connection.pathway_end = (self2 + other2) / 2.0;
+			free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
+
+			// Add the connection to the region_connection map.
+			p_region->get_connections().push_back(new_connection);
+		}
+	}
+}
+
+void NavMap::sync() {
+	PROFILE_ZONE("NavMap::sync");
+
+	if (regenerate_polygons) {
+		for (size_t r(0); r < regions.size(); r++) {
+			regions[r]->scratch_polygons();
+		}
+	}
 
-				// The edges can now be connected.
-				gd::Edge::Connection new_connection = other_edge;
-				new_connection.pathway_start = (self1 + other1) / 2.0;
-				new_connection.pathway_end = (self2 + other2) / 2.0;
-				free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
+	// Rebuild the polygons of the changed regions, once nothing links to the ones they replace anymore.
+	LocalVector<AABB> changed_bounds;
+	SWAP(changed_bounds, removed_region_bounds);
+	for (size_t r(0); r < regions.size(); r++) {
+		NavRegion *region = regions[r];
+		if (!region->is_dirty()) {
+			continue;
+		}
+
+		if (!region->get_polygons().empty()) {
+			changed_bounds.push_back(region->get_bounds());
+		}
+		_remove_region_links(region);
+
+		region->sync();
+
+		if (!region->get_polygons().empty()) {
+			changed_bounds.push_back(region->get_bounds());
+		}
+		_add_region_free_edges(region);
+	}
 
-				// Add the connection to the region_connection map.
-				free_edge.polygon->owner->get_connections().push_back(new_connection);
+	// Only the regions near the changed ones need to be linked again, unless the connection margin changed.
+	if (regenerate_links || !changed_bounds.is_empty()) {
+		for (uint32_t i = 0; i < changed_bounds.size(); i++) {
+			changed_bounds[i] = changed_bounds[i].grow(edge_connection_margin);
+		}
+
+		for (size_t r(0); r < regions.size(); r++) {
+			NavRegion *region = regions[r];
+			bool relink = regenerate_links;
+			for (uint32_t i = 0; i < changed_bounds.size() && !relink; i++) {
+				relink = region->get_bounds().intersects_inclusive(changed_bounds[i]);
+			}
+			if (relink) {
+				_link_region(region);
 			}
 		}
 
+		polygon_count = 0;
+		for (size_t r(0); r < regions.size(); r++) {
+			polygon_count += regions[r]->get_polygons().size();
+		}
+
 		// Update the update ID.
 		map_update_id = (map_update_id + 1) % 9999999;
 	}
 
-	// Update agents tree.
-	if (agents_dirty) {
-		std::vector<RVO::Agent *> raw_agents;
-		raw_agents.reserve(agents.size());
+	regenerate_polygons = false;
+	regenerate_links = false;
+}
+
+Vector3i NavMap::_get_agent_grid_cell(RvoAgent *p_agent) const {
+	const RVO::Vector3 &position = p_agent->get_agent()->position_;
+	return Vector3i(
+			int(Math::floor(position.x() / agent_grid_cell_size)),
+			int(Math::floor(position.y() / agent_grid_cell_size)),
+			int(Math::floor(position.z() / agent_grid_cell_size)));
+}
+
+void NavMap::_remove_agent_from_grid(RvoAgent *p_agent) {
+	if (!p_agent->is_in_grid()) {
+		return;
+	}
+
+	HashMap<Vector3i, LocalVector<RvoAgent *>>::Iterator E = agent_grid.find(p_agent->get_grid_cell());
+	ERR_FAIL_COND(!E);
+	LocalVector<RvoAgent *> &cell = E->value;
+	const uint32_t index = p_agent->get_grid_index();
+	ERR_FAIL_COND(index >= cell.size() || cell[index] != p_agent);
+
+	cell.remove_at_unordered(index);
+	if (index < cell.size()) {
+		cell[index]->set_grid_cell(E->key, index);
+	}
+	if (cell.is_empty()) {
+		agent_grid.remove(E);
+	}
+	p_agent->set_grid_cell(Vector3i(), UINT32_MAX);
+}
+
+void NavMap::_update_agent_grid() {
+	real_t cell_size = 0.0;
+	for (size_t i(0); i < agents.size(); i++) {
+		cell_size = MAX(cell_size, agents[i]->get_agent()->neighborDist_);
+	}
+	cell_size = MAX(cell_size, 0.1);
+
+	// Start over when the cells become too small for the neighbor distances, or much larger than needed.
+	if (cell_size > agent_grid_cell_size || cell_size < agent_grid_cell_size * 0.5) {
 		for (size_t i(0); i < agents.size(); i++) {
-			raw_agents.push_back(agents[i]->get_agent());
+			agents[i]->set_grid_cell(Vector3i(), UINT32_MAX);
 		}
-		rvo.buildAgentTree(raw_agents);
+		agent_grid.clear();
+		agent_grid_cell_size = cell_size;
 	}
 
-	regenerate_polygons = false;
-	regenerate_links = false;
-	agents_dirty = false;
+	for (size_t i(0); i < agents.size(); i++) {
+		RvoAgent *agent = agents[i];
+		const Vector3i cell = _get_agent_grid_cell(agent);
+		if (agent->is_in_grid()) {
+			if (agent->get_grid_cell() == cell) {
+				continue;
+			}
+			_remove_agent_from_grid(agent);
+		}
+
+		HashMap<Vector3i, LocalVector<RvoAgent *>>::Iterator E = agent_grid.find(cell);
+		if (!E) {
+			E = agent_grid.insert(cell, LocalVector<RvoAgent *>());
+		}
+		agent->set_grid_cell(cell, E->value.size());
+		E->value.push_back(agent);
+	}
 }
 
 void NavMap::compute_single_step(uint32_t index, RvoAgent **agent) {
-	(*(agent + index))->get_agent()->computeNeighbors(&rvo);
-	(*(agent + index))->get_agent()->computeNewVelocity(deltatime);
+	RvoAgent *rvo_agent = *(agent + index);
+	RVO::Agent *raw_agent = rvo_agent->get_agent();
+
+	raw_agent->agentNeighbors_.clear();
+	if (raw_agent->maxNeighbors_ > 0) {
+		// Agents at lower levels of detail consider fewer neighbors.
+		const size_t max_neighbors = raw_agent->maxNeighbors_;
+		raw_agent->maxNeighbors_ = MAX(max_neighbors >> stepping_agents_lod[index], (size_t)1);
+
+		float range_sq = raw_agent->neighborDist_ * raw_agent->neighborDist_;
+		const Vector3i &cell = rvo_agent->get_grid_cell();
+		for (int x = cell.x - 1; x <= cell.x + 1; x++) {
+			for (int y = cell.y - 1; y <= cell.y + 1; y++) {
+				for (int z = cell.z - 1; z <= cell.z + 1; z++) {
+					const LocalVector<RvoAgent *> *neighbors = agent_grid.getptr(Vector3i(x, y, z));
+					if (!neighbors) {
+						continue;
+					}
+					for (uint32_t i = 0; i < neighbors->size(); i++) {
+						raw_agent->insertAgentNeighbor((*neighbors)[i]->get_agent(), range_sq);
+					}
+				}
+			}
+		}
+
+		raw_agent->maxNeighbors_ = max_neighbors;
+	}
+
+	raw_agent->computeNewVelocity(deltatime);
 }
 
 void NavMap::step(real_t p_deltatime) {
 	deltatime = p_deltatime;
-	if (controlled_agents.size() > 0) {
-		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_step, controlled_agents.data(), controlled_agents.size(), -1, true, SNAME("NavigationMapAgents"));
+	step_count++;
+	if (controlled_agents.size() == 0) {
+		return;
+	}
+
+	_update_agent_grid();
+
+	// Agents further from the level of detail origin compute their avoidance less often, spread over the steps in between.
+	stepping_agents.clear();
+	stepping_agents_lod.clear();
+	for (size_t i(0); i < controlled_agents.size(); i++) {
+		uint8_t lod = 0;
+		if (avoidance_lod_distance > 0.0) {
+			const RVO::Vector3 &position = controlled_agents[i]->get_agent()->position_;
+			const real_t distance = avoidance_lod_origin.distance_to(Vector3(position.x(), position.y(), position.z()));
+			lod = MIN(int(distance / avoidance_lod_distance), AVOIDANCE_LOD_MAX);
+			const uint64_t period = uint64_t(1) << lod;
+			if ((step_count + i) % period != 0) {
+				continue;
+			}
+		}
+		stepping_agents.push_back(controlled_agents[i]);
+		stepping_agents_lod.push_back(lod);
+	}
+
+	if (stepping_agents.size() > 0) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_step, stepping_agents.ptr(), stepping_agents.size(), -1, true, SNAME("NavigationMapAgents"));
 		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 	}
 }
@@ -694,7 +902,7 @@ void NavMap::dispatch_callbacks() {
 	}
 }
 
-void NavMap::clip_path(const std::vector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly) const {
+void NavMap::clip_path(const std::vector<gd::NavigationPoly> &p_navigation_polys, FrameLocalVector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly) const {
 	Vector3 from = path[path.size() - 1];
 
 	if (from.is_equal_approx(p_to_point)) {
@@ -35,16 +35,19 @@
 
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "nav_utils.h"
 
-#include <KdTree.h>
-
 class NavRegion;
 class RvoAgent;
 class NavRegion;
 
 class NavMap : public NavRid {
+	enum {
+		AVOIDANCE_LOD_MAX = 3,
+	};
+
 	/// Map Up
 	Vector3 up = Vector3(0, 1, 0);
 
@@ -60,14 +63,14 @@ class NavMap : public NavRid {
 
 	std::vector<NavRegion *> regions;
 
-	/// Map polygons
-	std::vector<gd::Polygon> polygons;
+	/// Number of polygons of all the regions, the polygons themselves are owned by each region.
+	uint32_t polygon_count = 0;
 
-	/// Rvo world
-	RVO::KdTree rvo;
+	/// The free edges of all the regions, grouped per key, to link edges shared by two regions.
+	HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey> free_edge_keys;
 
-	/// Is agent array modified?
-	bool agents_dirty = false;
+	/// Bounds of the regions removed since the last sync, their neighbors need to be linked again.
+	LocalVector<AABB> removed_region_bounds;
 
 	/// All the Agents (even the controlled one)
 	std::vector<RvoAgent *> agents;
@@ -75,6 +78,20 @@ class NavMap : public NavRid {
 	/// Controlled agents
 	std::vector<RvoAgent *> controlled_agents;
 
+	/// Uniform grid of all the agents to find their neighbors. Only the agents that moved to another cell are updated.
+	/// The cells are as large as the largest neighbor distance, so the neighbors are always in the surrounding cells.
+	HashMap<Vector3i, LocalVector<RvoAgent *>> agent_grid;
+	real_t agent_grid_cell_size = 0.0;
+
+	/// Avoidance level of detail, disabled when the distance is 0.
+	Vector3 avoidance_lod_origin;
+	real_t avoidance_lod_distance = 0.0;
+
+	/// The controlled agents computing their avoidance this step.
+	LocalVector<RvoAgent *> stepping_agents;
+	LocalVector<uint8_t> stepping_agents_lod;
+	uint64_t step_count = 0;
+
 	/// Physics delta time
 	real_t deltatime = 0.0;
 
@@ -100,6 +117,20 @@ public:
 		return edge_connection_margin;
 	}
 
+	void set_avoidance_lod_origin(const Vector3 &p_origin) {
+		avoidance_lod_origin = p_origin;
+	}
+	Vector3 get_avoidance_lod_origin() const {
+		return avoidance_lod_origin;
+	}
+
+	void set_avoidance_lod_distance(real_t p_distance) {
+		avoidance_lod_distance = MAX(p_distance, 0.0);
+	}
+	real_t get_avoidance_lod_distance() const {
+		return avoidance_lod_distance;
+	}
+
 	gd::PointKey get_point_key(const Vector3 &p_pos) const;
 
 	Vector<Vector3> get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) const;
@@ -135,7 +166,13 @@ public:
 
 private:
 	void compute_single_step(uint32_t index, RvoAgent **agent);
-	void clip_path(const std::vector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly) const;
+	Vector3i _get_agent_grid_cell(RvoAgent *p_agent) const;
+	void _remove_agent_from_grid(RvoAgent *p_agent);
+	void _update_agent_grid();
+	void _remove_region_links(NavRegion *p_region);
+	void _add_region_free_edges(NavRegion *p_region);
+	void _link_region(NavRegion *p_region);
+	void clip_path(const std::vector<gd::NavigationPoly> &p_navigation_polys, FrameLocalVector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly) const;
 };
 
 #endif // NAV_MAP_H
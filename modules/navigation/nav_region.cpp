@@ -90,6 +90,8 @@ void NavRegion::update_polygons() {
 		return;
 	}
 	polygons.clear();
+	free_edges.clear();
+	bounds = AABB();
 	polygons_dirty = false;
 
 	if (map == nullptr) {
@@ -154,4 +156,192 @@ void NavRegion::update_polygons() {
 			p.center = center / float(mesh_poly.size());
 		}
 	}
+
+	// Group all edges per key, and connect the ones shared by two polygons of this region.
+	HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
+	bool first_point = true;
+	for (size_t poly_id(0); poly_id < polygons.size(); poly_id++) {
+		gd::Polygon &poly(polygons[poly_id]);
+
+		for (size_t p(0); p < poly.points.size(); p++) {
+			if (first_point) {
+				bounds.position = poly.points[p].pos;
+				first_point = false;
+			} else {
+				bounds.expand_to(poly.points[p].pos);
+			}
+
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
+			if (!connection) {
+				connection = connections.insert(ek, Vector<gd::Edge::Connection>());
+			}
+			if (connection->value.size() <= 1) {
+				// Add the polygon/edge tuple to this key.
+				gd::Edge::Connection new_connection;
+				new_connection.polygon = &poly;
+				new_connection.edge = p;
+				new_connection.pathway_start = poly.points[p].pos;
+				new_connection.pathway_end = poly.points[next_point].pos;
+				connection->value.push_back(new_connection);
+			} else {
+				// The edge is already connected with another edge, skip.
+				ERR_PRINT_ONCE("Attempted to merge a navigation mesh triangle edge with another already-merged edge. This happens when the current `cell_size` is different from the one used to generate the navigation mesh. This will cause navigation problems.");
+			}
+		}
+	}
+
+	for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
+		if (E.value.size() == 2) {
+			// Connect edge that are shared in different polygons.
+			gd::Edge::Connection &c1 = E.value.write[0];
+			gd::Edge::Connection &c2 = E.value.write[1];
+			c1.polygon->edges[c1.edge].connections.push_back(c2);
+			c2.polygon->edges[c2.edge].connections.push_back(c1);
+			// Note: The pathway_start/end are full for those connection and do not need to be modified.
+		} else {
+			CRASH_COND_MSG(E.value.size() != 1, vformat("Number of connection != 1. Found: %d", E.value.size()));
+			free_edges.push_back(E.value[0]);
+		}
+	}
+
+	if (mesh->get_tile_size() > 0) {
+		_link_tile_borders();
+	}
+}
+
+void NavRegion::_link_tile_borders() {
+	// The polygons of the tiles of a tiled bake don't always share their vertices along the tile borders.
+	// Link the free edges lying on the same border where they overlap, and only leave the others to the map.
+	const real_t tile_width = mesh->get_tile_size() * mesh->get_cell_size();
+	const real_t tolerance = mesh->get_cell_size() * 0.5;
+	const real_t max_climb = MAX(mesh->get_agent_max_climb(), mesh->get_cell_height());
+	const Transform3D to_local = transform.affine_inverse();
+
+	struct BorderEdge {
+		uint32_t free_edge = 0;
+		// Extent along the border, in the navigation mesh space.
+		real_t from = 0.0;
+		real_t to = 0.0;
+		real_t from_height = 0.0;
+		real_t to_height = 0.0;
+		Vector3 from_pos;
+		Vector3 to_pos;
+
+		bool operator<(const BorderEdge &p_other) const {
+			return from < p_other.from;
+		}
+	};
+
+	// Grouped per border, as (axis, index of the border along that axis).
+	HashMap<Vector2i, LocalVector<BorderEdge>> borders;
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		const gd::Polygon *poly = free_edges[i].polygon;
+		const Vector3 &pos_a = poly->points[free_edges[i].edge].pos;
+		const Vector3 &pos_b = poly->points[(free_edges[i].edge + 1) % poly->points.size()].pos;
+		const Vector3 a = to_local.xform(pos_a);
+		const Vector3 b = to_local.xform(pos_b);
+
+		for (int axis = 0; axis <= 2; axis += 2) {
+			const int border = int(Math::round(a[axis] / tile_width));
+			if (Math::abs(a[axis] - border * tile_width) > tolerance || Math::abs(b[axis] - border * tile_width) > tolerance) {
+				continue;
+			}
+
+			const int along = axis == 0 ? 2 : 0;
+			BorderEdge border_edge;
+			border_edge.free_edge = i;
+			if (a[along] <= b[along]) {
+				border_edge.from = a[along];
+				border_edge.to = b[along];
+				border_edge.from_height = a.y;
+				border_edge.to_height = b.y;
+				border_edge.from_pos = pos_a;
+				border_edge.to_pos = pos_b;
+			} else {
+				border_edge.from = b[along];
+				border_edge.to = a[along];
+				border_edge.from_height = b.y;
+				border_edge.to_height = a.y;
+				border_edge.from_pos = pos_b;
+				border_edge.to_pos = pos_a;
+			}
+			if (border_edge.to - border_edge.from > tolerance) {
+				Vector2i key(axis, border);
+				if (!borders.has(key)) {
+					borders.insert(key, LocalVector<BorderEdge>());
+				}
+				borders[key].push_back(border_edge);
+			}
+			break;
+		}
+	}
+
+	LocalVector<bool> linked;
+	linked.resize(free_edges.size());
+	for (uint32_t i = 0; i < linked.size(); i++) {
+		linked[i] = false;
+	}
+
+	for (KeyValue<Vector2i, LocalVector<BorderEdge>> &E : borders) {
+		LocalVector<BorderEdge> &border_edges = E.value;
+		border_edges.sort();
+
+		for (uint32_t i = 0; i < border_edges.size(); i++) {
+			const BorderEdge &edge = border_edges[i];
+			const real_t edge_length = edge.to - edge.from;
+
+			for (uint32_t j = i + 1; j < border_edges.size() && border_edges[j].from < edge.to - tolerance; j++) {
+				const BorderEdge &other = border_edges[j];
+				const gd::Edge::Connection &edge_connection = free_edges[edge.free_edge];
+				const gd::Edge::Connection &other_connection = free_edges[other.free_edge];
+				if (edge_connection.polygon == other_connection.polygon) {
+					continue;
+				}
+
+				const real_t from = MAX(edge.from, other.from);
+				const real_t to = MIN(edge.to, other.to);
+				if (to - from <= tolerance) {
+					continue;
+				}
+
+				// Both edges must be at about the same height where they overlap.
+				const real_t other_length = other.to - other.from;
+				const real_t edge_from_t = (from - edge.from) / edge_length;
+				const real_t edge_to_t = (to - edge.from) / edge_length;
+				const real_t other_from_t = (from - other.from) / other_length;
+				const real_t other_to_t = (to - other.from) / other_length;
+				if (Math::abs(Math::lerp(edge.from_height, edge.to_height, edge_from_t) - Math::lerp(other.from_height, other.to_height, other_from_t)) > max_climb ||
+						Math::abs(Math::lerp(edge.from_height, edge.to_height, edge_to_t) - Math::lerp(other.from_height, other.to_height, other_to_t)) > max_climb) {
+					continue;
+				}
+
+				const Vector3 pathway_start = (edge.from_pos.lerp(edge.to_pos, edge_from_t) + other.from_pos.lerp(other.to_pos, other_from_t)) / 2.0;
+				const Vector3 pathway_end = (edge.from_pos.lerp(edge.to_pos, edge_to_t) + other.from_pos.lerp(other.to_pos, other_to_t)) / 2.0;
+
+				gd::Edge::Connection to_other = other_connection;
+				to_other.pathway_start = pathway_start;
+				to_other.pathway_end = pathway_end;
+				edge_connection.polygon->edges[edge_connection.edge].connections.push_back(to_other);
+
+				gd::Edge::Connection to_edge = edge_connection;
+				to_edge.pathway_start = pathway_start;
+				to_edge.pathway_end = pathway_end;
+				other_connection.polygon->edges[other_connection.edge].connections.push_back(to_edge);
+
+				linked[edge.free_edge] = true;
+				linked[other.free_edge] = true;
+			}
+		}
+	}
+
+	uint32_t free_edge_count = 0;
+	for (uint32_t i = 0; i < free_edges.size(); i++) {
+		if (!linked[i]) {
+			free_edges[free_edge_count++] = free_edges[i];
+		}
+	}
+	free_edges.resize(free_edge_count);
 }
@@ -31,6 +31,7 @@
 #ifndef NAV_REGION_H
 #define NAV_REGION_H
 
+#include "core/templates/local_vector.h"
 #include "scene/resources/navigation_mesh.h"
 
 #include "nav_rid.h"
@@ -55,6 +56,10 @@ class NavRegion : public NavRid {
 	/// Cache
 	std::vector<gd::Polygon> polygons;
 
+	/// The edges not shared by two polygons of this region, which the map links with the other regions.
+	LocalVector<gd::Edge::Connection> free_edges;
+	AABB bounds;
+
 public:
 	NavRegion() {}
 
@@ -62,6 +67,10 @@ public:
 		polygons_dirty = true;
 	}
 
+	bool is_dirty() const {
+		return polygons_dirty;
+	}
+
 	void set_map(NavMap *p_map);
 	NavMap *get_map() const {
 		return map;
@@ -97,10 +106,19 @@ public:
 		return polygons;
 	}
 
+	const LocalVector<gd::Edge::Connection> &get_free_edges() const {
+		return free_edges;
+	}
+
+	const AABB &get_bounds() const {
+		return bounds;
+	}
+
 	bool sync();
 
 private:
 	void update_polygons();
+	void _link_tile_borders();
 };
 
 #endif // NAV_REGION_H
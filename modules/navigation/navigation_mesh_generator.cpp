@@ -33,6 +33,7 @@
 #include "navigation_mesh_generator.h"
 
 #include "core/math/convex_hull.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/thread.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/multimesh_instance_3d.h"
@@ -378,14 +379,11 @@ void NavigationMeshGenerator::_parse_geometry(const Transform3D &p_navmesh_trans
 	}
 }
 
-void NavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Ref<NavigationMesh> p_nav_mesh) {
-	Vector<Vector3> nav_vertices;
-
+void NavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
 	for (int i = 0; i < p_detail_mesh->nverts; i++) {
 		const float *v = &p_detail_mesh->verts[i * 3];
-		nav_vertices.push_back(Vector3(v[0], v[1], v[2]));
+		r_vertices.push_back(Vector3(v[0], v[1], v[2]));
 	}
-	p_nav_mesh->set_vertices(nav_vertices);
 
 	for (int i = 0; i < p_detail_mesh->nmeshes; i++) {
 		const unsigned int *m = &p_detail_mesh->meshes[i * 4];
@@ -400,9 +398,280 @@ void NavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_mesh(con
 			nav_indices.write[0] = ((int)(bverts + tris[j * 4 + 0]));
 			nav_indices.write[1] = ((int)(bverts + tris[j * 4 + 2]));
 			nav_indices.write[2] = ((int)(bverts + tris[j * 4 + 1]));
-			p_nav_mesh->add_polygon(nav_indices);
+			r_polygons.push_back(nav_indices);
+		}
+	}
+}
+
+bool NavigationMeshGenerator::_build_recast_detail_mesh(
+		const Ref<NavigationMesh> &p_nav_mesh,
+#ifdef TOOLS_ENABLED
+		EditorProgress *ep,
+#endif
+		const rcConfig &p_cfg,
+		const float *p_verts,
+		int p_nverts,
+		const int *p_tris,
+		int p_ntris,
+		Vector<Vector3> &r_vertices,
+		Vector<Vector<int>> &r_polygons) {
+	rcContext ctx;
+	const rcConfig &cfg = p_cfg;
+
+	// Frees what was allocated when done, or when a step fails.
+	struct RecastBuffers {
+		rcHeightfield *hf = nullptr;
+		rcCompactHeightfield *chf = nullptr;
+		rcContourSet *cset = nullptr;
+		rcPolyMesh *poly_mesh = nullptr;
+		rcPolyMeshDetail *detail_mesh = nullptr;
+
+		~RecastBuffers() {
+			rcFreeHeightField(hf);
+			rcFreeCompactHeightfield(chf);
+			rcFreeContourSet(cset);
+			rcFreePolyMesh(poly_mesh);
+			rcFreePolyMeshDetail(detail_mesh);
+		}
+	} buffers;
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Creating heightfield..."), 3);
+	}
+#endif
+	buffers.hf = rcAllocHeightfield();
+
+	ERR_FAIL_COND_V(!buffers.hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *buffers.hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch), false);
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Marking walkable triangles..."), 4);
+	}
+#endif
+	{
+		Vector<unsigned char> tri_areas;
+		tri_areas.resize(p_ntris);
+
+		ERR_FAIL_COND_V(tri_areas.size() == 0, false);
+
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
+
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *buffers.hf, cfg.walkableClimb), false);
+	}
+
+	if (p_nav_mesh->get_filter_low_hanging_obstacles()) {
+		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *buffers.hf);
+	}
+	if (p_nav_mesh->get_filter_ledge_spans()) {
+		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *buffers.hf);
+	}
+	if (p_nav_mesh->get_filter_walkable_low_height_spans()) {
+		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *buffers.hf);
+	}
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Constructing compact heightfield..."), 5);
+	}
+#endif
+
+	buffers.chf = rcAllocCompactHeightfield();
+
+	ERR_FAIL_COND_V(!buffers.chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *buffers.hf, *buffers.chf), false);
+
+	rcFreeHeightField(buffers.hf);
+	buffers.hf = nullptr;
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Eroding walkable area..."), 6);
+	}
+#endif
+
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *buffers.chf), false);
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Partitioning..."), 7);
+	}
+#endif
+
+	if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *buffers.chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *buffers.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
+	} else if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *buffers.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
+	} else {
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *buffers.chf, cfg.borderSize, cfg.minRegionArea), false);
+	}
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Creating contours..."), 8);
+	}
+#endif
+
+	buffers.cset = rcAllocContourSet();
+
+	ERR_FAIL_COND_V(!buffers.cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *buffers.chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *buffers.cset), false);
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Creating polymesh..."), 9);
+	}
+#endif
+
+	buffers.poly_mesh = rcAllocPolyMesh();
+	ERR_FAIL_COND_V(!buffers.poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *buffers.cset, cfg.maxVertsPerPoly, *buffers.poly_mesh), false);
+
+	buffers.detail_mesh = rcAllocPolyMeshDetail();
+	ERR_FAIL_COND_V(!buffers.detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *buffers.poly_mesh, *buffers.chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *buffers.detail_mesh), false);
+
+	_convert_detail_mesh_to_native_navigation_mesh(buffers.detail_mesh, r_vertices, r_polygons);
+
+	return true;
+}
+
+void NavigationMeshGenerator::_build_recast_tile(uint32_t p_index, TiledBake *p_bake) {
+	BakeTile &tile = p_bake->tiles[p_index];
+
+	rcConfig cfg = p_bake->cfg;
+	const float tile_width = cfg.tileSize * cfg.cs;
+	const float border_width = cfg.borderSize * cfg.cs;
+	cfg.bmin[0] = tile.x * tile_width - border_width;
+	cfg.bmin[2] = tile.z * tile_width - border_width;
+	cfg.bmax[0] = (tile.x + 1) * tile_width + border_width;
+	cfg.bmax[2] = (tile.z + 1) * tile_width + border_width;
+
+	// Only the triangles of this tile are rasterized, they still index the shared vertices.
+	Vector<int> tile_tris;
+	tile_tris.resize(tile.triangles.size() * 3);
+	int *tile_tris_w = tile_tris.ptrw();
+	for (uint32_t i = 0; i < tile.triangles.size(); i++) {
+		const int *tri = &p_bake->tris[tile.triangles[i] * 3];
+		tile_tris_w[i * 3 + 0] = tri[0];
+		tile_tris_w[i * 3 + 1] = tri[1];
+		tile_tris_w[i * 3 + 2] = tri[2];
+	}
+
+	_build_recast_detail_mesh(
+			p_bake->nav_mesh,
+#ifdef TOOLS_ENABLED
+			nullptr,
+#endif
+			cfg,
+			p_bake->verts,
+			p_bake->nverts,
+			tile_tris.ptr(),
+			tile.triangles.size(),
+			tile.vertices,
+			tile.polygons);
+}
+
+void NavigationMeshGenerator::_build_recast_tiles(Ref<NavigationMesh> p_nav_mesh, const rcConfig &p_cfg, Vector<float> &vertices, Vector<int> &indices) {
+	TiledBake bake;
+	bake.nav_mesh = p_nav_mesh;
+	bake.cfg = p_cfg;
+	bake.cfg.tileSize = p_nav_mesh->get_tile_size();
+	// Enough cells around the tile for the erosion and the partitioning not to be affected by where the tile ends.
+	bake.cfg.borderSize = bake.cfg.walkableRadius + 3;
+	bake.cfg.width = bake.cfg.tileSize + bake.cfg.borderSize * 2;
+	bake.cfg.height = bake.cfg.width;
+	bake.verts = vertices.ptr();
+	bake.nverts = vertices.size() / 3;
+	bake.tris = indices.ptr();
+	const int ntris = indices.size() / 3;
+
+	// The tiles are aligned on the origin of the navigation mesh, which lets NavRegion find the edges on their borders.
+	const float tile_width = bake.cfg.tileSize * bake.cfg.cs;
+	const float border_width = bake.cfg.borderSize * bake.cfg.cs;
+	const int from_x = (int)Math::floor(p_cfg.bmin[0] / tile_width);
+	const int from_z = (int)Math::floor(p_cfg.bmin[2] / tile_width);
+	const int tiles_x = MAX((int)Math::ceil(p_cfg.bmax[0] / tile_width) - from_x, 1);
+	const int tiles_z = MAX((int)Math::ceil(p_cfg.bmax[2] / tile_width) - from_z, 1);
+	ERR_FAIL_COND_MSG((int64_t)tiles_x * tiles_z > (1 << 20), "Too many navigation mesh tiles to bake, increase the tile size.");
+
+	bake.tiles.resize(tiles_x * tiles_z);
+	for (int z = 0; z < tiles_z; z++) {
+		for (int x = 0; x < tiles_x; x++) {
+			BakeTile &tile = bake.tiles[z * tiles_x + x];
+			tile.x = from_x + x;
+			tile.z = from_z + z;
+		}
+	}
+
+	// Sort the triangles in the tiles they touch, including their borders.
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &bake.verts[bake.tris[i * 3 + 0] * 3];
+		const float *v1 = &bake.verts[bake.tris[i * 3 + 1] * 3];
+		const float *v2 = &bake.verts[bake.tris[i * 3 + 2] * 3];
+
+		const int tri_from_x = MAX((int)Math::floor((MIN(v0[0], MIN(v1[0], v2[0])) - border_width) / tile_width) - from_x, 0);
+		const int tri_from_z = MAX((int)Math::floor((MIN(v0[2], MIN(v1[2], v2[2])) - border_width) / tile_width) - from_z, 0);
+		const int tri_to_x = MIN((int)Math::floor((MAX(v0[0], MAX(v1[0], v2[0])) + border_width) / tile_width) - from_x, tiles_x - 1);
+		const int tri_to_z = MIN((int)Math::floor((MAX(v0[2], MAX(v1[2], v2[2])) + border_width) / tile_width) - from_z, tiles_z - 1);
+
+		for (int z = tri_from_z; z <= tri_to_z; z++) {
+			for (int x = tri_from_x; x <= tri_to_x; x++) {
+				bake.tiles[z * tiles_x + x].triangles.push_back(i);
+			}
+		}
+	}
+
+	// Only build the tiles with some geometry.
+	uint32_t used_tiles = 0;
+	for (uint32_t i = 0; i < bake.tiles.size(); i++) {
+		if (bake.tiles[i].triangles.is_empty()) {
+			continue;
+		}
+		if (used_tiles != i) {
+			SWAP(bake.tiles[used_tiles], bake.tiles[i]);
+		}
+		used_tiles++;
+	}
+	bake.tiles.resize(used_tiles);
+
+	if (bake.tiles.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavigationMeshGenerator::_build_recast_tile, &bake, bake.tiles.size(), -1, true, SNAME("NavigationMeshTiles"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Merge the tiles, sharing the vertices found in several of them.
+	Vector<Vector3> nav_vertices;
+	HashMap<Vector3, int> vertex_ids;
+	LocalVector<int> tile_vertex_ids;
+	for (uint32_t i = 0; i < bake.tiles.size(); i++) {
+		const BakeTile &tile = bake.tiles[i];
+
+		tile_vertex_ids.resize(tile.vertices.size());
+		for (int j = 0; j < tile.vertices.size(); j++) {
+			HashMap<Vector3, int>::Iterator E = vertex_ids.find(tile.vertices[j]);
+			if (!E) {
+				E = vertex_ids.insert(tile.vertices[j], nav_vertices.size());
+				nav_vertices.push_back(tile.vertices[j]);
+			}
+			tile_vertex_ids[j] = E->value;
+		}
+
+		for (int j = 0; j < tile.polygons.size(); j++) {
+			Vector<int> polygon = tile.polygons[j];
+			int *polygon_w = polygon.ptrw();
+			for (int k = 0; k < polygon.size(); k++) {
+				polygon_w[k] = tile_vertex_ids[polygon_w[k]];
+			}
+			p_nav_mesh->add_polygon(polygon);
 		}
 	}
+	p_nav_mesh->set_vertices(nav_vertices);
 }
 
 void NavigationMeshGenerator::_build_recast_navigation_mesh(
@@ -410,15 +679,8 @@ void NavigationMeshGenerator::_build_recast_navigation_mesh(
 #ifdef TOOLS_ENABLED
 		EditorProgress *ep,
 #endif
-		rcHeightfield *hf,
-		rcCompactHeightfield *chf,
-		rcContourSet *cset,
-		rcPolyMesh *poly_mesh,
-		rcPolyMeshDetail *detail_mesh,
 		Vector<float> &vertices,
 		Vector<int> &indices) {
-	rcContext ctx;
-
 #ifdef TOOLS_ENABLED
 	if (ep) {
 		ep->step(TTR("Setting up Configuration..."), 1);
@@ -512,109 +774,27 @@ void NavigationMeshGenerator::_build_recast_navigation_mesh(
 				   "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry.");
 	}
 
-#ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Creating heightfield..."), 3);
-	}
-#endif
-	hf = rcAllocHeightfield();
-
-	ERR_FAIL_COND(!hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
-
-#ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Marking walkable triangles..."), 4);
-	}
-#endif
-	{
-		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
-
-		ERR_FAIL_COND(tri_areas.size() == 0);
-
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
-
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
-	}
-
-	if (p_nav_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
-	}
-	if (p_nav_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
-	}
-	if (p_nav_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
-	}
-
-#ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Constructing compact heightfield..."), 5);
-	}
-#endif
-
-	chf = rcAllocCompactHeightfield();
-
-	ERR_FAIL_COND(!chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
-
-	rcFreeHeightField(hf);
-	hf = nullptr;
-
-#ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Eroding walkable area..."), 6);
-	}
-#endif
-
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
-
-#ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Partitioning..."), 7);
-	}
-#endif
-
-	if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, 0, cfg.minRegionArea, cfg.mergeRegionArea));
-	} else if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, 0, cfg.minRegionArea, cfg.mergeRegionArea));
-	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, 0, cfg.minRegionArea));
+	if (p_nav_mesh->get_tile_size() > 0) {
+		_build_recast_tiles(p_nav_mesh, cfg, vertices, indices);
+		return;
 	}
 
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (!_build_recast_detail_mesh(
+				p_nav_mesh,
 #ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Creating contours..."), 8);
-	}
+				ep,
 #endif
-
-	cset = rcAllocContourSet();
-
-	ERR_FAIL_COND(!cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
-
-#ifdef TOOLS_ENABLED
-	if (ep) {
-		ep->step(TTR("Creating polymesh..."), 9);
+				cfg,
+				verts,
+				nverts,
+				tris,
+				ntris,
+				nav_vertices,
+				nav_polygons)) {
+		return;
 	}
-#endif
-
-	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_COND(!poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
-
-	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_COND(!detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
-
-	rcFreeCompactHeightfield(chf);
-	chf = nullptr;
-	rcFreeContourSet(cset);
-	cset = nullptr;
 
 #ifdef TOOLS_ENABLED
 	if (ep) {
@@ -622,12 +802,10 @@ void NavigationMeshGenerator::_build_recast_navigation_mesh(
 	}
 #endif
 
-	_convert_detail_mesh_to_native_navigation_mesh(detail_mesh, p_nav_mesh);
-
-	rcFreePolyMesh(poly_mesh);
-	poly_mesh = nullptr;
-	rcFreePolyMeshDetail(detail_mesh);
-	detail_mesh = nullptr;
+	p_nav_mesh->set_vertices(nav_vertices);
+	for (int i = 0; i < nav_polygons.size(); i++) {
+		p_nav_mesh->add_polygon(nav_polygons[i]);
+	}
 }
 
 NavigationMeshGenerator *NavigationMeshGenerator::get_singleton() {
@@ -681,40 +859,15 @@ void NavigationMeshGenerator::bake(Ref<NavigationMesh> p_nav_mesh, Node *p_node)
 		_parse_geometry(navmesh_xform, E, vertices, indices, geometry_type, collision_mask, recurse_children);
 	}
 
+	// The scene is only read up to here, the rest works on the parsed geometry.
 	if (vertices.size() > 0 && indices.size() > 0) {
-		rcHeightfield *hf = nullptr;
-		rcCompactHeightfield *chf = nullptr;
-		rcContourSet *cset = nullptr;
-		rcPolyMesh *poly_mesh = nullptr;
-		rcPolyMeshDetail *detail_mesh = nullptr;
-
 		_build_recast_navigation_mesh(
 				p_nav_mesh,
 #ifdef TOOLS_ENABLED
 				ep,
 #endif
-				hf,
-				chf,
-				cset,
-				poly_mesh,
-				detail_mesh,
 				vertices,
 				indices);
-
-		rcFreeHeightField(hf);
-		hf = nullptr;
-
-		rcFreeCompactHeightfield(chf);
-		chf = nullptr;
-
-		rcFreeContourSet(cset);
-		cset = nullptr;
-
-		rcFreePolyMesh(poly_mesh);
-		poly_mesh = nullptr;
-
-		rcFreePolyMeshDetail(detail_mesh);
-		detail_mesh = nullptr;
 	}
 
 #ifdef TOOLS_ENABLED
@@ -33,6 +33,7 @@
 
 #ifndef _3D_DISABLED
 
+#include "core/templates/local_vector.h"
 #include "scene/3d/navigation_region_3d.h"
 
 #include <Recast.h>
@@ -55,17 +56,46 @@ protected:
 	static void _add_faces(const PackedVector3Array &p_faces, const Transform3D &p_xform, Vector<float> &p_vertices, Vector<int> &p_indices);
 	static void _parse_geometry(const Transform3D &p_navmesh_transform, Node *p_node, Vector<float> &p_vertices, Vector<int> &p_indices, NavigationMesh::ParsedGeometryType p_generate_from, uint32_t p_collision_mask, bool p_recurse_children);
 
-	static void _convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Ref<NavigationMesh> p_nav_mesh);
-	static void _build_recast_navigation_mesh(
+	struct BakeTile {
+		int x = 0;
+		int z = 0;
+		/// Indices of the source triangles touching the tile or its border.
+		LocalVector<int> triangles;
+
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	/// Everything the tiles are built from, which isn't changed while they build.
+	struct TiledBake {
+		Ref<NavigationMesh> nav_mesh;
+		rcConfig cfg;
+		const float *verts = nullptr;
+		int nverts = 0;
+		const int *tris = nullptr;
+		LocalVector<BakeTile> tiles;
+	};
+
+	static void _convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+	static bool _build_recast_detail_mesh(
+			const Ref<NavigationMesh> &p_nav_mesh,
+#ifdef TOOLS_ENABLED
+			EditorProgress *ep,
+#endif
+			const rcConfig &p_cfg,
+			const float *p_verts,
+			int p_nverts,
+			const int *p_tris,
+			int p_ntris,
+			Vector<Vector3> &r_vertices,
+			Vector<Vector<int>> &r_polygons);
+	void _build_recast_tile(uint32_t p_index, TiledBake *p_bake);
+	void _build_recast_tiles(Ref<NavigationMesh> p_nav_mesh, const rcConfig &p_cfg, Vector<float> &vertices, Vector<int> &indices);
+	void _build_recast_navigation_mesh(
 			Ref<NavigationMesh> p_nav_mesh,
 #ifdef TOOLS_ENABLED
 			EditorProgress *ep,
 #endif
-			rcHeightfield *hf,
-			rcCompactHeightfield *chf,
-			rcContourSet *cset,
-			rcPolyMesh *poly_mesh,
-			rcPolyMeshDetail *detail_mesh,
 			Vector<float> &vertices,
 			Vector<int> &indices);
 
@@ -51,6 +51,10 @@ class RvoAgent : public NavRid {
 	AvoidanceComputedCallback callback;
 	uint32_t map_update_id = 0;
 
+	/// Where the agent is in the agent grid of its map.
+	Vector3i grid_cell;
+	uint32_t grid_index = UINT32_MAX;
+
 public:
 	RvoAgent();
 
@@ -65,6 +69,20 @@ public:
 
 	bool is_map_changed();
 
+	void set_grid_cell(const Vector3i &p_cell, uint32_t p_index) {
+		grid_cell = p_cell;
+		grid_index = p_index;
+	}
+	const Vector3i &get_grid_cell() const {
+		return grid_cell;
+	}
+	uint32_t get_grid_index() const {
+		return grid_index;
+	}
+	bool is_in_grid() const {
+		return grid_index != UINT32_MAX;
+	}
+
 	void set_callback(ObjectID p_id, const StringName p_method, const Variant p_udata = Variant());
 	bool has_callback() const;
 
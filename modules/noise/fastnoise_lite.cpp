@@ -336,6 +336,40 @@ real_t FastNoiseLite::get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const {
 	return _noise.GetNoise(p_x, p_y, p_z);
 }
 
+void FastNoiseLite::_get_noise_row(float *r_values, int p_x, int p_y, int p_width, bool p_in_3d_space) const {
+	// Same as calling get_noise_2d() or get_noise_3d() for each point, without dispatching through Noise or checking the settings every time.
+	const real_t y = p_y + offset.y;
+	if (p_in_3d_space) {
+		const real_t z = offset.z;
+		if (domain_warp_enabled) {
+			for (int i = 0; i < p_width; i++) {
+				real_t wx = p_x + i + offset.x;
+				real_t wy = y;
+				real_t wz = z;
+				_domain_warp_noise.DomainWarp(wx, wy, wz);
+				r_values[i] = _noise.GetNoise(wx, wy, wz);
+			}
+		} else {
+			for (int i = 0; i < p_width; i++) {
+				r_values[i] = _noise.GetNoise(p_x + i + offset.x, y, z);
+			}
+		}
+	} else {
+		if (domain_warp_enabled) {
+			for (int i = 0; i < p_width; i++) {
+				real_t wx = p_x + i + offset.x;
+				real_t wy = y;
+				_domain_warp_noise.DomainWarp(wx, wy);
+				r_values[i] = _noise.GetNoise(wx, wy);
+			}
+		} else {
+			for (int i = 0; i < p_width; i++) {
+				r_values[i] = _noise.GetNoise(p_x + i + offset.x, y);
+			}
+		}
+	}
+}
+
 void FastNoiseLite::_changed() {
 	emit_changed();
 }
@@ -94,6 +94,8 @@ protected:
 	static void _bind_methods();
 	virtual void _validate_property(PropertyInfo &property) const override;
 
+	virtual void _get_noise_row(float *r_values, int p_x, int p_y, int p_width, bool p_in_3d_space) const override;
+
 private:
 	_FastNoiseLite _noise;
 	_FastNoiseLite _domain_warp_noise;
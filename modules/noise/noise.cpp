@@ -30,6 +30,50 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+
+// Below this many points, starting the worker threads costs more than it saves.
+#define NOISE_REGION_THREADED_MIN_POINTS 16384
+
+void Noise::_get_noise_row(float *r_values, int p_x, int p_y, int p_width, bool p_in_3d_space) const {
+	for (int i = 0; i < p_width; i++) {
+		r_values[i] = p_in_3d_space ? get_noise_3d(p_x + i, p_y, 0.0) : get_noise_2d(p_x + i, p_y);
+	}
+}
+
+void Noise::_fill_region_row_task(void *p_userdata, uint32_t p_row) {
+	const RegionData *data = (const RegionData *)p_userdata;
+	float *row_values = data->values + p_row * data->region.size.x;
+	data->noise->_get_noise_row(row_values, data->region.position.x, data->region.position.y + p_row, data->region.size.x, data->in_3d_space);
+}
+
+void Noise::_fill_region(const Rect2i &p_region, bool p_in_3d_space, float *r_values) const {
+	RegionData data;
+	data.noise = this;
+	data.region = p_region;
+	data.in_3d_space = p_in_3d_space;
+	data.values = r_values;
+
+	// Noise is read only while sampled, so the rows can be computed in parallel.
+	if (p_region.size.x * p_region.size.y >= NOISE_REGION_THREADED_MIN_POINTS && p_region.size.y > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Noise::_fill_region_row_task, &data, p_region.size.y, -1, true, SNAME("NoiseRegion"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int y = 0; y < p_region.size.y; y++) {
+			_fill_region_row_task(&data, y);
+		}
+	}
+}
+
+PackedFloat32Array Noise::get_noise_2d_region(const Rect2i &p_region, bool p_in_3d_space) const {
+	ERR_FAIL_COND_V(p_region.size.x <= 0 || p_region.size.y <= 0, PackedFloat32Array());
+
+	PackedFloat32Array values;
+	values.resize(p_region.size.x * p_region.size.y);
+	_fill_region(p_region, p_in_3d_space, values.ptrw());
+	return values;
+}
+
 Ref<Image> Noise::get_seamless_image(int p_width, int p_height, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0, Ref<Image>());
 
@@ -65,20 +109,18 @@ Ref<Image> Noise::get_image(int p_width, int p_height, bool p_invert, bool p_in_
 	uint8_t *wd8 = data.ptrw();
 
 	// Get all values and identify min/max values.
-	Vector<real_t> values;
+	Vector<float> values;
 	values.resize(p_width * p_height);
-	real_t min_val = 1000;
-	real_t max_val = -1000;
-
-	for (int y = 0, i = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++, i++) {
-			values.set(i, p_in_3d_space ? get_noise_3d(x, y, 0.0) : get_noise_2d(x, y));
-			if (values[i] > max_val) {
-				max_val = values[i];
-			}
-			if (values[i] < min_val) {
-				min_val = values[i];
-			}
+	_fill_region(Rect2i(0, 0, p_width, p_height), p_in_3d_space, values.ptrw());
+
+	float min_val = 1000;
+	float max_val = -1000;
+	for (const float &value : values) {
+		if (value > max_val) {
+			max_val = value;
+		}
+		if (value < min_val) {
+			min_val = value;
 		}
 	}
 
@@ -109,6 +151,7 @@ void Noise::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_noise_2dv", "v"), &Noise::get_noise_2dv);
 	ClassDB::bind_method(D_METHOD("get_noise_3d", "x", "y", "z"), &Noise::get_noise_3d);
 	ClassDB::bind_method(D_METHOD("get_noise_3dv", "v"), &Noise::get_noise_3dv);
+	ClassDB::bind_method(D_METHOD("get_noise_2d_region", "region", "in_3d_space"), &Noise::get_noise_2d_region, DEFVAL(false));
 
 	// Textures.
 	ClassDB::bind_method(D_METHOD("get_image", "width", "height", "invert", "in_3d_space"), &Noise::get_image, DEFVAL(false), DEFVAL(false));
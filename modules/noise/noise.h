@@ -218,9 +218,25 @@ class Noise : public Resource {
 		return out.l;
 	}
 
+	// Shared by the worker threads filling a region, each of them fills whole rows.
+	struct RegionData {
+		const Noise *noise = nullptr;
+		Rect2i region;
+		bool in_3d_space = false;
+		float *values = nullptr;
+	};
+
+	static void _fill_region_row_task(void *p_userdata, uint32_t p_row);
+
 protected:
 	static void _bind_methods();
 
+	// Writes the noise of p_width points from (p_x, p_y) on, one unit apart along X.
+	// Overridden by noises which can evaluate a row faster than point by point.
+	virtual void _get_noise_row(float *r_values, int p_x, int p_y, int p_width, bool p_in_3d_space) const;
+
+	void _fill_region(const Rect2i &p_region, bool p_in_3d_space, float *r_values) const;
+
 public:
 	// Virtual destructor so we can delete any Noise derived object when referenced as a Noise*.
 	virtual ~Noise() {}
@@ -233,6 +249,8 @@ public:
 	virtual real_t get_noise_3dv(Vector3 p_v) const = 0;
 	virtual real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const = 0;
 
+	PackedFloat32Array get_noise_2d_region(const Rect2i &p_region, bool p_in_3d_space = false) const;
+
 	virtual Ref<Image> get_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false) const;
 	virtual Ref<Image> get_seamless_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false, real_t p_blend_skirt = 0.1) const;
 };
@@ -1413,13 +1413,35 @@ void OpenXRAPI::pre_render() {
 	// "Repeatedly calling xrLocateViews with the same time may not necessarily return the same result. Instead the prediction gets increasingly accurate as the function is called closer to the given time for which a prediction is made"
 
 	// We're calling this "relatively" early, the positioning we're obtaining here will be used to do our frustum culling,
-	// occlusion culling, etc. There is however a technique that we can investigate in the future where after our entire
-	// Vulkan command buffer is build, but right before vkSubmitQueue is called, we call xrLocateViews one more time and
-	// update the view and projection matrix once more with a slightly more accurate predication and then submit the
-	// command queues.
+	// occlusion culling, etc. With late latching enabled, late_latch_views() locates the views once more right before
+	// the scene is recorded, see there.
+	if (!locate_views()) {
+		return;
+	}
+
+	// let's start our frame..
+	XrFrameBeginInfo frame_begin_info = {
+		XR_TYPE_FRAME_BEGIN_INFO, // type
+		nullptr // next
+	};
+	result = xrBeginFrame(session, &frame_begin_info);
+	if (XR_FAILED(result)) {
+		print_line("OpenXR: failed to being frame [", get_error_string(result), "]");
+		return;
+	}
+}
+
+bool OpenXRAPI::late_latch_views() {
+	// Called by the renderer after culling and rendering shadows, right before recording the scene with these views.
+	// The views submitted in end_frame() are the ones located last, so the compositor reprojects from the poses we rendered with.
+	if (!late_latching || !can_render()) {
+		return false;
+	}
 
-	// That is not possible yet but worth investigating in the future.
+	return locate_views();
+}
 
+bool OpenXRAPI::locate_views() {
 	XrViewLocateInfo view_locate_info = {
 		XR_TYPE_VIEW_LOCATE_INFO, // type
 		nullptr, // next
@@ -1433,10 +1455,10 @@ void OpenXRAPI::pre_render() {
 		0 // viewStateFlags
 	};
 	uint32_t view_count_output;
-	result = xrLocateViews(session, &view_locate_info, &view_state, view_count, &view_count_output, views);
+	XrResult result = xrLocateViews(session, &view_locate_info, &view_state, view_count, &view_count_output, views);
 	if (XR_FAILED(result)) {
 		print_line("OpenXR: Couldn't locate views [", get_error_string(result), "]");
-		return;
+		return false;
 	}
 
 	bool pose_valid = true;
@@ -1457,16 +1479,7 @@ void OpenXRAPI::pre_render() {
 #endif
 	}
 
-	// let's start our frame..
-	XrFrameBeginInfo frame_begin_info = {
-		XR_TYPE_FRAME_BEGIN_INFO, // type
-		nullptr // next
-	};
-	result = xrBeginFrame(session, &frame_begin_info);
-	if (XR_FAILED(result)) {
-		print_line("OpenXR: failed to being frame [", get_error_string(result), "]");
-		return;
-	}
+	return true;
 }
 
 bool OpenXRAPI::pre_draw_viewport(RID p_render_target) {
@@ -1625,6 +1638,8 @@ OpenXRAPI::OpenXRAPI() {
 				break;
 		}
 
+		late_latching = GLOBAL_GET("xr/openxr/late_latching");
+
 		int rs = GLOBAL_GET("xr/openxr/reference_space");
 		switch (rs) {
 			case 0: {
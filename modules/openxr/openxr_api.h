@@ -128,6 +128,7 @@ private:
 	XrSpace play_space = XR_NULL_HANDLE;
 	XrSpace view_space = XR_NULL_HANDLE;
 	bool view_pose_valid = false;
+	bool late_latching = false;
 	XRPose::TrackingConfidence head_pose_confidence = XRPose::XR_TRACKING_CONFIDENCE_NONE;
 
 	bool load_layer_properties();
@@ -151,6 +152,7 @@ private:
 	bool is_swapchain_format_supported(int64_t p_swapchain_format);
 	bool create_main_swapchain();
 	void destroy_session();
+	bool locate_views();
 
 	// swapchains
 	bool create_swapchain(int64_t p_swapchain_format, uint32_t p_width, uint32_t p_height, uint32_t p_sample_count, uint32_t p_array_size, XrSwapchain &r_swapchain, void **r_swapchain_graphics_data);
@@ -253,6 +255,7 @@ public:
 	bool process();
 
 	void pre_render();
+	bool late_latch_views();
 	bool pre_draw_viewport(RID p_render_target);
 	void post_draw_viewport(RID p_render_target);
 	void end_frame();
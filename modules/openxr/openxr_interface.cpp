@@ -693,6 +693,14 @@ void OpenXRInterface::pre_render() {
 	}
 }
 
+bool OpenXRInterface::late_latch_views() {
+	if (openxr_api) {
+		return openxr_api->late_latch_views();
+	} else {
+		return false;
+	}
+}
+
 bool OpenXRInterface::pre_draw_viewport(RID p_render_target) {
 	if (openxr_api) {
 		return openxr_api->pre_draw_viewport(p_render_target);
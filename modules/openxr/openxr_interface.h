@@ -125,6 +125,7 @@ public:
 
 	virtual void process() override;
 	virtual void pre_render() override;
+	virtual bool late_latch_views() override;
 	bool pre_draw_viewport(RID p_render_target) override;
 	virtual Vector<BlitToScreen> post_draw_viewport(RID p_render_target, const Rect2 &p_screen_rect) override;
 	virtual void end_frame() override;
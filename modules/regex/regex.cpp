@@ -30,6 +30,9 @@
 
 #include "regex.h"
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
+#include "core/templates/lru.h"
+#include "core/templates/safe_refcount.h"
 
 extern "C" {
 #include <pcre2.h>
@@ -43,6 +46,52 @@ static void _regex_free(void *ptr, void *user) {
 	memfree(ptr);
 }
 
+// Compiled code is never modified after compiling, so instances compiling the same pattern share it.
+// The most recently compiled patterns are kept around even when no instance uses them anymore,
+// as the same few patterns tend to be compiled over and over (e.g. by scripts creating a RegEx in a loop).
+struct RegExCode {
+	pcre2_code_32 *code = nullptr;
+	uint32_t capture_count = 0;
+	SafeRefCount refcount;
+};
+
+static const int PATTERN_CACHE_SIZE = 64;
+
+static Mutex pattern_cache_mutex;
+static LRUCache<String, RegExCode *> pattern_cache(PATTERN_CACHE_SIZE);
+
+static void _regex_code_unref(RegExCode *p_code) {
+	if (p_code->refcount.unref()) {
+		pcre2_code_free_32(p_code->code);
+		memdelete(p_code);
+	}
+}
+
+// Match data only holds the offsets of the last match, so each thread reuses its own instead of allocating it for every search.
+struct RegExMatchData {
+	pcre2_match_data_32 *data = nullptr;
+	uint32_t pairs = 0;
+
+	pcre2_match_data_32 *get(uint32_t p_pairs) {
+		if (pairs < p_pairs) {
+			if (data) {
+				pcre2_match_data_free_32(data);
+			}
+			data = pcre2_match_data_create_32(p_pairs, nullptr);
+			pairs = p_pairs;
+		}
+		return data;
+	}
+
+	~RegExMatchData() {
+		if (data) {
+			pcre2_match_data_free_32(data);
+		}
+	}
+};
+
+static thread_local RegExMatchData thread_match_data;
+
 int RegExMatch::_find(const Variant &p_name) const {
 	if (p_name.is_num()) {
 		int i = (int)p_name;
@@ -156,13 +205,14 @@ void RegExMatch::_bind_methods() {
 }
 
 void RegEx::_pattern_info(uint32_t what, void *where) const {
-	pcre2_pattern_info_32((pcre2_code_32 *)code, what, where);
+	pcre2_pattern_info_32(((RegExCode *)code)->code, what, where);
 }
 
 void RegEx::clear() {
 	if (code) {
-		pcre2_code_free_32((pcre2_code_32 *)code);
+		_regex_code_unref((RegExCode *)code);
 		code = nullptr;
+		capture_count = 0;
 	}
 }
 
@@ -170,6 +220,17 @@ Error RegEx::compile(const String &p_pattern) {
 	pattern = p_pattern;
 	clear();
 
+	{
+		MutexLock lock(pattern_cache_mutex);
+		RegExCode *const *cached = pattern_cache.getptr(pattern);
+		if (cached) {
+			(*cached)->refcount.ref();
+			code = *cached;
+			capture_count = (*cached)->capture_count;
+			return OK;
+		}
+	}
+
 	int err;
 	PCRE2_SIZE offset;
 	uint32_t flags = PCRE2_DUPNAMES;
@@ -178,17 +239,40 @@ Error RegEx::compile(const String &p_pattern) {
 	pcre2_compile_context_32 *cctx = pcre2_compile_context_create_32(gctx);
 	PCRE2_SPTR32 p = (PCRE2_SPTR32)pattern.get_data();
 
-	code = pcre2_compile_32(p, pattern.length(), flags, &err, &offset, cctx);
+	pcre2_code_32 *c = pcre2_compile_32(p, pattern.length(), flags, &err, &offset, cctx);
 
 	pcre2_compile_context_free_32(cctx);
 
-	if (!code) {
+	if (!c) {
 		PCRE2_UCHAR32 buf[256];
 		pcre2_get_error_message_32(err, buf, 256);
 		String message = String::num(offset) + ": " + String((const char32_t *)buf);
 		ERR_PRINT(message.utf8());
 		return FAILED;
 	}
+
+	// Matching uses the JIT compiled code automatically when there is one. It fails when PCRE2 was built without JIT support,
+	// or the platform doesn't allow executable memory, in which case the interpreter is used instead.
+	pcre2_jit_compile_32(c, PCRE2_JIT_COMPLETE);
+
+	RegExCode *rc = memnew(RegExCode);
+	rc->code = c;
+	rc->refcount.init();
+	pcre2_pattern_info_32(c, PCRE2_INFO_CAPTURECOUNT, &rc->capture_count);
+
+	code = rc;
+	capture_count = rc->capture_count;
+
+	MutexLock lock(pattern_cache_mutex);
+	if (!pattern_cache.has(pattern)) {
+		RegExCode *evicted = nullptr;
+		while (pattern_cache.get_size() >= pattern_cache.get_capacity() && pattern_cache.evict_least_recent(nullptr, &evicted)) {
+			_regex_code_unref(evicted);
+		}
+		rc->refcount.ref();
+		pattern_cache.insert(pattern, rc);
+	}
+
 	return OK;
 }
 
@@ -202,23 +286,23 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 		length = p_end;
 	}
 
-	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_code_32 *c = ((RegExCode *)code)->code;
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	// The match data may be larger than this pattern needs, only the offsets of its groups are used.
+	uint32_t size = capture_count + 1;
+	pcre2_match_data_32 *match = thread_match_data.get(size);
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+	int res = pcre2_match_32(c, s, length, p_offset, 0, match, nullptr);
+	if (res == PCRE2_ERROR_JIT_STACKLIMIT) {
+		// The JIT stack has a fixed size, unlike the interpreter's, so deeply backtracking patterns may only match without it.
+		res = pcre2_match_32(c, s, length, p_offset, PCRE2_NO_JIT, match, nullptr);
+	}
 
 	if (res < 0) {
-		pcre2_match_data_free_32(match);
-		pcre2_match_context_free_32(mctx);
-
 		return nullptr;
 	}
 
-	uint32_t size = pcre2_get_ovector_count_32(match);
 	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
 
 	result->data.resize(size);
@@ -228,9 +312,6 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 		result->data.write[i].end = ovector[i * 2 + 1];
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	result->subject = p_subject;
 
 	uint32_t count;
@@ -295,26 +376,28 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 		length = p_end;
 	}
 
-	pcre2_code_32 *c = (pcre2_code_32 *)code;
-	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_code_32 *c = ((RegExCode *)code)->code;
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 	PCRE2_SPTR32 r = (PCRE2_SPTR32)p_replacement.get_data();
 	PCRE2_UCHAR32 *o = (PCRE2_UCHAR32 *)output.ptrw();
 
-	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	pcre2_match_data_32 *match = thread_match_data.get(capture_count + 1);
+	pcre2_match_context_32 *mctx = nullptr;
 
 	int res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 
+	if (res == PCRE2_ERROR_JIT_STACKLIMIT) {
+		flags |= PCRE2_NO_JIT; // See search().
+		olength = output.size() - safety_zone;
+		res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
+	}
+
 	if (res == PCRE2_ERROR_NOMEMORY) {
 		output.resize(olength + safety_zone);
 		o = (PCRE2_UCHAR32 *)output.ptrw();
 		res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 	}
 
-	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
-
 	if (res < 0) {
 		return String();
 	}
@@ -333,11 +416,7 @@ String RegEx::get_pattern() const {
 int RegEx::get_group_count() const {
 	ERR_FAIL_COND_V(!is_valid(), 0);
 
-	uint32_t count;
-
-	_pattern_info(PCRE2_INFO_CAPTURECOUNT, &count);
-
-	return count;
+	return capture_count;
 }
 
 Array RegEx::get_names() const {
@@ -372,10 +451,16 @@ RegEx::RegEx(const String &p_pattern) {
 	compile(p_pattern);
 }
 
-RegEx::~RegEx() {
-	if (code) {
-		pcre2_code_free_32((pcre2_code_32 *)code);
+void RegEx::clear_pattern_cache() {
+	MutexLock lock(pattern_cache_mutex);
+	RegExCode *evicted = nullptr;
+	while (pattern_cache.evict_least_recent(nullptr, &evicted)) {
+		_regex_code_unref(evicted);
 	}
+}
+
+RegEx::~RegEx() {
+	clear();
 	pcre2_general_context_free_32((pcre2_general_context_32 *)general_ctx);
 }
 
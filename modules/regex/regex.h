@@ -72,8 +72,9 @@ class RegEx : public RefCounted {
 	GDCLASS(RegEx, RefCounted);
 
 	void *general_ctx = nullptr;
-	void *code = nullptr;
+	void *code = nullptr; // Compiled pattern, shared with the other instances compiling the same pattern.
 	String pattern;
+	uint32_t capture_count = 0;
 
 	void _pattern_info(uint32_t what, void *where) const;
 
@@ -93,6 +94,8 @@ public:
 	int get_group_count() const;
 	Array get_names() const;
 
+	static void clear_pattern_cache();
+
 	RegEx();
 	RegEx(const String &p_pattern);
 	~RegEx();
@@ -45,4 +45,6 @@ void uninitialize_regex_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+
+	RegEx::clear_pattern_cache();
 }
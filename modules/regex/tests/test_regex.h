@@ -159,6 +159,34 @@ TEST_CASE("[RegEx] Invalid end position") {
 
 	CHECK(re.sub(s, "", true, 0, 10) == "Gdt");
 }
+
+TEST_CASE("[RegEx] Shared patterns") {
+	const String s = "Godot Engine";
+
+	RegEx re1("(\\w+) (\\w+)");
+	RegEx re2("(\\w+) (\\w+)");
+	REQUIRE(re1.is_valid());
+	REQUIRE(re2.is_valid());
+	CHECK(re2.get_group_count() == 2);
+
+	re1.clear();
+	CHECK(re1.is_valid() == false);
+	CHECK(re2.is_valid());
+
+	Ref<RegExMatch> match = re2.search(s);
+	REQUIRE(match != nullptr);
+	CHECK(match->get_group_count() == 2);
+	CHECK(match->get_string(2) == "Engine");
+
+	// Searches with fewer groups after a pattern with more must not report the other pattern's groups.
+	RegEx re3("o");
+	match = re3.search(s);
+	REQUIRE(match != nullptr);
+	CHECK(match->get_group_count() == 0);
+
+	RegEx::clear_pattern_cache();
+	CHECK(re2.sub(s, "$2 $1") == "Engine Godot");
+}
 } // namespace TestRegEx
 
 #endif // TEST_REGEX_H
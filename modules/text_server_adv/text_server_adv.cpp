@@ -34,7 +34,9 @@
 #ifdef GDEXTENSION
 // Headers for building as GDExtension plug-in.
 
+#include <godot_cpp/classes/directory.hpp>
 #include <godot_cpp/classes/file.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/translation_server.hpp>
 #include <godot_cpp/core/error_macros.hpp>
@@ -44,6 +46,7 @@ using namespace godot;
 #else
 // Headers for building as built-in module.
 
+#include "core/config/project_settings.h"
 #include "core/core_bind.h"
 #include "core/error/error_macros.h"
 #include "core/string/print_string.h"
@@ -377,6 +380,12 @@ void TextServerAdvanced::free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
+		{
+			MutexLock lock(fd->mutex);
+			for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : fd->cache) {
+				_font_save_disk_cache(E.value);
+			}
+		}
 		font_owner.free(p_rid);
 		memdelete(fd);
 	} else if (shaped_owner.owns(p_rid)) {
@@ -1167,6 +1176,15 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 		return fd->glyph_map[p_glyph].found;
 	}
 
+	if (glyph_disk_cache && p_font_data->data_ptr && fd->disk_cache_path.is_empty()) {
+		// Only looked up on the first missing glyph, so sizes that are never drawn don't read anything.
+		_font_load_disk_cache(p_font_data, fd);
+		if (fd->glyph_map.has(p_glyph)) {
+			return fd->glyph_map[p_glyph].found;
+		}
+	}
+	fd->disk_cache_dirty = true;
+
 	if (glyph_index == 0) { // Non graphical or invalid glyph, do not render.
 		fd->glyph_map[p_glyph] = FontGlyph();
 		return true;
@@ -1729,6 +1747,7 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_f
 
 _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_data) {
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : p_font_data->cache) {
+		_font_save_disk_cache(E.value);
 		memdelete(E.value);
 	}
 	p_font_data->cache.clear();
@@ -1738,6 +1757,171 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	p_font_data->supported_scripts.clear();
 }
 
+void TextServerAdvanced::_font_load_disk_cache(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data) const {
+	if (!p_font_data->data_hash_valid) {
+		p_font_data->data_hash = hash_murmur3_buffer(p_font_data->data_ptr, p_font_data->data_size);
+		p_font_data->data_hash_valid = true;
+	}
+
+	// Everything that changes how the glyphs are rasterized or packed.
+	uint32_t h = hash_murmur3_one_32(p_font_data->face_index);
+	h = hash_murmur3_one_32(p_font_data->antialiased, h);
+	h = hash_murmur3_one_32(p_font_data->msdf, h);
+	h = hash_murmur3_one_32(p_font_data->msdf_range, h);
+	h = hash_murmur3_one_32(p_font_data->msdf_source_size, h);
+	h = hash_murmur3_one_32(p_font_data->fixed_size, h);
+	h = hash_murmur3_one_32(p_font_data->force_autohinter, h);
+	h = hash_murmur3_one_32(p_font_data->hinting, h);
+	h = hash_murmur3_one_32(p_font_data->subpixel_positioning, h);
+	h = hash_murmur3_one_double(p_font_data->embolden, h);
+	for (int i = 0; i < 3; i++) {
+		h = hash_murmur3_one_real(p_font_data->transform[i].x, h);
+		h = hash_murmur3_one_real(p_font_data->transform[i].y, h);
+	}
+	h = hash_murmur3_one_32(p_font_data->variation_coordinates.hash(), h);
+	h = hash_murmur3_one_double(p_data->oversampling, h);
+	h = hash_murmur3_one_32(p_data->size.x, h);
+	h = hash_murmur3_one_32(p_data->size.y, h);
+	h = hash_murmur3_one_32(rect_range, h);
+	h = hash_fmix32(h);
+
+	p_data->disk_cache_path = "user://font_cache/" + String::num_int64(p_font_data->data_hash, 16) + "_" + String::num_int64(h, 16) + ".glyphs";
+	if (!p_data->textures.is_empty() || !p_data->glyph_map.is_empty()) {
+		// Already has glyphs (e.g. pre-rendered on import), only save the ones added to them.
+		return;
+	}
+	if (!File::file_exists(p_data->disk_cache_path)) {
+		return;
+	}
+
+	Ref<File> f;
+	f.instantiate();
+	if (f->open(p_data->disk_cache_path, File::READ) != OK) {
+		return;
+	}
+	if (f->get_32() != 0x43475447 || f->get_32() != GLYPH_DISK_CACHE_VERSION) { // "GTGC"
+		return;
+	}
+
+	// Read everything before using any of it. Truncated or corrupted files are silently ignored (the glyphs
+	// are rendered again), and sizes are checked against what is left in the file before allocating anything.
+	const uint64_t length = f->get_length();
+	Vector<FontTexture> textures;
+	uint32_t texture_count = f->get_32();
+	for (uint32_t i = 0; i < texture_count && !f->eof_reached(); i++) {
+		FontTexture tex;
+		uint32_t format = f->get_32();
+		uint32_t texture_w = f->get_32();
+		uint32_t texture_h = f->get_32();
+		uint32_t offset_count = f->get_32();
+		// Glyph textures are uncompressed, so they take at least a byte per pixel.
+		if (format >= Image::FORMAT_MAX || texture_w == 0 || texture_h == 0 || offset_count != texture_w || uint64_t(offset_count) * 4 + uint64_t(texture_w) * texture_h > length - f->get_position()) {
+			return;
+		}
+		tex.format = (Image::Format)format;
+		tex.texture_w = texture_w;
+		tex.texture_h = texture_h;
+		tex.offsets.resize(offset_count);
+		int32_t *offw = tex.offsets.ptrw();
+		for (uint32_t j = 0; j < offset_count; j++) {
+			offw[j] = f->get_32();
+		}
+		uint32_t data_size = f->get_32();
+		if (uint64_t(data_size) != uint64_t(Image::get_image_data_size(tex.texture_w, tex.texture_h, tex.format)) || data_size > length - f->get_position()) {
+			return;
+		}
+		tex.imgdata = f->get_buffer(data_size);
+		if ((uint32_t)tex.imgdata.size() != data_size) {
+			return;
+		}
+		textures.push_back(tex);
+	}
+
+	HashMap<int32_t, FontGlyph> glyph_map;
+	uint32_t glyph_count = f->get_32();
+	for (uint32_t i = 0; i < glyph_count && !f->eof_reached(); i++) {
+		int32_t index = f->get_32();
+		FontGlyph gl;
+		gl.found = f->get_8();
+		gl.texture_idx = (int32_t)f->get_32();
+		gl.rect.position.x = f->get_float();
+		gl.rect.position.y = f->get_float();
+		gl.rect.size.x = f->get_float();
+		gl.rect.size.y = f->get_float();
+		gl.uv_rect.position.x = f->get_float();
+		gl.uv_rect.position.y = f->get_float();
+		gl.uv_rect.size.x = f->get_float();
+		gl.uv_rect.size.y = f->get_float();
+		gl.advance.x = f->get_float();
+		gl.advance.y = f->get_float();
+		if (gl.texture_idx < -1 || gl.texture_idx >= textures.size()) {
+			return;
+		}
+		glyph_map[index] = gl;
+	}
+	if (f->eof_reached()) {
+		return;
+	}
+
+	// The textures are only created when first drawn.
+	p_data->textures = textures;
+	p_data->glyph_map = glyph_map;
+}
+
+void TextServerAdvanced::_font_save_disk_cache(FontForSizeAdvanced *p_data) const {
+	if (!p_data->disk_cache_dirty || p_data->disk_cache_path.is_empty()) {
+		return;
+	}
+	p_data->disk_cache_dirty = false;
+
+	Ref<Directory> dir;
+	dir.instantiate();
+	if (dir->open("user://") != OK) {
+		return;
+	}
+	dir->make_dir_recursive("font_cache");
+
+	Ref<File> f;
+	f.instantiate();
+	if (f->open(p_data->disk_cache_path, File::WRITE) != OK) {
+		return;
+	}
+	f->store_32(0x43475447); // "GTGC"
+	f->store_32(GLYPH_DISK_CACHE_VERSION);
+
+	f->store_32(p_data->textures.size());
+	for (int i = 0; i < p_data->textures.size(); i++) {
+		const FontTexture &tex = p_data->textures[i];
+		f->store_32(tex.format);
+		f->store_32(tex.texture_w);
+		f->store_32(tex.texture_h);
+		f->store_32(tex.offsets.size());
+		for (int j = 0; j < tex.offsets.size(); j++) {
+			f->store_32(tex.offsets[j]);
+		}
+		f->store_32(tex.imgdata.size());
+		f->store_buffer(tex.imgdata);
+	}
+
+	f->store_32(p_data->glyph_map.size());
+	for (const KeyValue<int32_t, FontGlyph> &E : p_data->glyph_map) {
+		const FontGlyph &gl = E.value;
+		f->store_32(E.key);
+		f->store_8(gl.found);
+		f->store_32(gl.texture_idx);
+		f->store_float(gl.rect.position.x);
+		f->store_float(gl.rect.position.y);
+		f->store_float(gl.rect.size.x);
+		f->store_float(gl.rect.size.y);
+		f->store_float(gl.uv_rect.position.x);
+		f->store_float(gl.uv_rect.position.y);
+		f->store_float(gl.uv_rect.size.x);
+		f->store_float(gl.uv_rect.size.y);
+		f->store_float(gl.advance.x);
+		f->store_float(gl.advance.y);
+	}
+}
+
 hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_t p_size) const {
 	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
 	ERR_FAIL_COND_V(!fd, nullptr);
@@ -1763,8 +1947,10 @@ void TextServerAdvanced::font_set_data(const RID &p_font_rid, const PackedByteAr
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	_font_clear_cache(fd);
 	fd->data = p_data;
+	fd->data_hash_valid = false;
 	fd->data_ptr = fd->data.ptr();
 	fd->data_size = fd->data.size();
 }
@@ -1774,8 +1960,10 @@ void TextServerAdvanced::font_set_data_ptr(const RID &p_font_rid, const uint8_t
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	_font_clear_cache(fd);
 	fd->data.resize(0);
+	fd->data_hash_valid = false;
 	fd->data_ptr = p_data_ptr;
 	fd->data_size = p_data_size;
 }
@@ -1788,6 +1976,7 @@ void TextServerAdvanced::font_set_face_index(const RID &p_font_rid, int64_t p_fa
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->face_index != p_face_index) {
 		fd->face_index = p_face_index;
 		_font_clear_cache(fd);
@@ -1950,6 +2139,7 @@ void TextServerAdvanced::font_set_multichannel_signed_distance_field(const RID &
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->msdf != p_msdf) {
 		_font_clear_cache(fd);
 		fd->msdf = p_msdf;
@@ -1988,6 +2178,7 @@ void TextServerAdvanced::font_set_msdf_size(const RID &p_font_rid, int64_t p_msd
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->msdf_source_size != p_msdf_size) {
 		_font_clear_cache(fd);
 		fd->msdf_source_size = p_msdf_size;
@@ -2007,6 +2198,7 @@ void TextServerAdvanced::font_set_fixed_size(const RID &p_font_rid, int64_t p_fi
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	fd->fixed_size = p_fixed_size;
 }
 
@@ -2023,6 +2215,7 @@ void TextServerAdvanced::font_set_force_autohinter(const RID &p_font_rid, bool p
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->force_autohinter != p_force_autohinter) {
 		_font_clear_cache(fd);
 		fd->force_autohinter = p_force_autohinter;
@@ -2042,6 +2235,7 @@ void TextServerAdvanced::font_set_hinting(const RID &p_font_rid, TextServer::Hin
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->hinting != p_hinting) {
 		_font_clear_cache(fd);
 		fd->hinting = p_hinting;
@@ -2061,6 +2255,7 @@ void TextServerAdvanced::font_set_subpixel_positioning(const RID &p_font_rid, Te
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	fd->subpixel_positioning = p_subpixel;
 }
 
@@ -2077,6 +2272,7 @@ void TextServerAdvanced::font_set_embolden(const RID &p_font_rid, double p_stren
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->embolden != p_strength) {
 		_font_clear_cache(fd);
 		fd->embolden = p_strength;
@@ -2096,6 +2292,7 @@ void TextServerAdvanced::font_set_transform(const RID &p_font_rid, const Transfo
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->transform != p_transform) {
 		_font_clear_cache(fd);
 		fd->transform = p_transform;
@@ -2115,6 +2312,7 @@ void TextServerAdvanced::font_set_variation_coordinates(const RID &p_font_rid, c
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->variation_coordinates != p_variation_coordinates) {
 		_font_clear_cache(fd);
 		fd->variation_coordinates = p_variation_coordinates;
@@ -2134,6 +2332,7 @@ void TextServerAdvanced::font_set_oversampling(const RID &p_font_rid, double p_o
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->oversampling != p_oversampling) {
 		_font_clear_cache(fd);
 		fd->oversampling = p_oversampling;
@@ -2165,7 +2364,9 @@ void TextServerAdvanced::font_clear_size_cache(const RID &p_font_rid) {
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : fd->cache) {
+		_font_save_disk_cache(E.value);
 		memdelete(E.value);
 	}
 	fd->cache.clear();
@@ -2176,7 +2377,9 @@ void TextServerAdvanced::font_remove_size_cache(const RID &p_font_rid, const Vec
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	if (fd->cache.has(p_size)) {
+		_font_save_disk_cache(fd->cache[p_size]);
 		memdelete(fd->cache[p_size]);
 		fd->cache.erase(p_size);
 	}
@@ -2187,6 +2390,7 @@ void TextServerAdvanced::font_set_ascent(const RID &p_font_rid, int64_t p_size,
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2213,6 +2417,9 @@ void TextServerAdvanced::font_set_descent(const RID &p_font_rid, int64_t p_size,
 	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
 	ERR_FAIL_COND(!fd);
 
+	MutexLock lock(fd->mutex);
+	font_revision++;
+
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2240,6 +2447,7 @@ void TextServerAdvanced::font_set_underline_position(const RID &p_font_rid, int6
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2267,6 +2475,7 @@ void TextServerAdvanced::font_set_underline_thickness(const RID &p_font_rid, int
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2294,6 +2503,7 @@ void TextServerAdvanced::font_set_scale(const RID &p_font_rid, int64_t p_size, d
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2453,6 +2663,7 @@ void TextServerAdvanced::font_clear_glyphs(const RID &p_font_rid, const Vector2i
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 
@@ -2464,6 +2675,7 @@ void TextServerAdvanced::font_remove_glyph(const RID &p_font_rid, const Vector2i
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 
@@ -2517,6 +2729,7 @@ void TextServerAdvanced::font_set_glyph_advance(const RID &p_font_rid, int64_t p
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2553,6 +2766,7 @@ void TextServerAdvanced::font_set_glyph_offset(const RID &p_font_rid, const Vect
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size_outline(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2589,6 +2803,7 @@ void TextServerAdvanced::font_set_glyph_size(const RID &p_font_rid, const Vector
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size_outline(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2810,6 +3025,7 @@ void TextServerAdvanced::font_clear_kerning_map(const RID &p_font_rid, int64_t p
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2821,6 +3037,7 @@ void TextServerAdvanced::font_remove_kerning(const RID &p_font_rid, int64_t p_si
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2832,6 +3049,7 @@ void TextServerAdvanced::font_set_kerning(const RID &p_font_rid, int64_t p_size,
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -3183,6 +3401,7 @@ void TextServerAdvanced::font_set_language_support_override(const RID &p_font_ri
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	fd->language_support_overrides[p_language] = p_supported;
 }
 
@@ -3199,6 +3418,7 @@ void TextServerAdvanced::font_remove_language_support_override(const RID &p_font
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	fd->language_support_overrides.erase(p_language);
 }
 
@@ -3233,6 +3453,7 @@ void TextServerAdvanced::font_set_script_support_override(const RID &p_font_rid,
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	fd->script_support_overrides[p_script] = p_supported;
 }
 
@@ -3249,6 +3470,7 @@ void TextServerAdvanced::font_remove_script_support_override(const RID &p_font_r
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	fd->script_support_overrides.erase(p_script);
 }
 
@@ -3269,6 +3491,7 @@ void TextServerAdvanced::font_set_opentype_feature_overrides(const RID &p_font_r
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	font_revision++;
 	Vector2i size = _get_size(fd, 16);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->feature_overrides = p_overrides;
@@ -3391,6 +3614,11 @@ void TextServerAdvanced::invalidate(TextServerAdvanced::ShapedTextDataAdvanced *
 		ubidi_close(p_shaped->bidi_iter[i]);
 	}
 	p_shaped->bidi_iter.clear();
+	p_shaped->glyphs_shaped.clear();
+	p_shaped->edit_glyphs.clear();
+	p_shaped->edit_start = -1;
+	p_shaped->edit_end = -1;
+	p_shaped->edit_delta = 0;
 
 	if (p_text) {
 		if (p_shaped->script_iter != nullptr) {
@@ -3398,6 +3626,8 @@ void TextServerAdvanced::invalidate(TextServerAdvanced::ShapedTextDataAdvanced *
 			p_shaped->script_iter = nullptr;
 		}
 		p_shaped->break_ops_valid = false;
+		p_shaped->break_ops_dirty_start = -1;
+		p_shaped->break_ops_dirty_end = -1;
 		p_shaped->js_ops_valid = false;
 	}
 }
@@ -3771,6 +4001,146 @@ bool TextServerAdvanced::shaped_text_resize_object(const RID &p_shaped, const Va
 	return true;
 }
 
+// Grows the range changed by the earlier edits, [r_start, r_end) in the current text, to cover the replacement of [p_start, p_end), and moves it to the text after it.
+static void _merge_edit_range(int &r_start, int &r_end, int p_start, int p_end, int p_delta) {
+	if (r_start < 0) {
+		r_start = p_start;
+		r_end = p_end + p_delta;
+	} else {
+		r_end = MAX(r_end, p_end) + p_delta;
+		r_start = MIN(r_start, p_start);
+	}
+}
+
+bool TextServerAdvanced::shaped_text_replace_string(const RID &p_shaped, int64_t p_start, int64_t p_length, const String &p_text) {
+	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
+	ERR_FAIL_COND_V(!sd, false);
+
+	MutexLock lock(sd->mutex);
+	if (sd->parent != RID()) {
+		full_copy(sd);
+	}
+	ERR_FAIL_COND_V(p_start < 0 || p_length < 0 || p_start + p_length > sd->text.length(), false);
+	ERR_FAIL_COND_V(sd->spans.is_empty(), false);
+
+	if (p_length == 0 && p_text.is_empty()) {
+		return true;
+	}
+
+	int start = sd->start + p_start;
+	int end = start + p_length;
+	int delta = p_text.length() - p_length;
+
+	// Inserted characters continue the span before them, replacing characters keeps the span of the first one.
+	int owner_pos = (p_length == 0 && start > sd->start) ? start - 1 : start;
+	int owner = -1;
+	for (int i = 0; i < sd->spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &span = sd->spans[i];
+		ERR_FAIL_COND_V_MSG(span.embedded_key != Variant() && span.start < end && span.end > start, false, "Embedded objects can't be replaced.");
+		if (span.start <= owner_pos && span.end > owner_pos) {
+			owner = i;
+		}
+	}
+	if (owner != -1 && sd->spans[owner].embedded_key != Variant() && owner_pos != start) {
+		// Inserted right after an object, use the span after it.
+		owner = -1;
+		for (int i = 0; i < sd->spans.size(); i++) {
+			if (sd->spans[i].start <= start && sd->spans[i].end > start) {
+				owner = i;
+				break;
+			}
+		}
+	}
+	ERR_FAIL_COND_V_MSG(owner == -1 || sd->spans[owner].embedded_key != Variant(), false, "No text span to insert the string into.");
+
+	// Keep the glyphs and line breaks of the text outside of the edit, the next update only redoes the words around it.
+	Vector<Glyph> edit_glyphs;
+	int edit_start = -1;
+	int edit_end = -1;
+	int edit_delta = 0;
+	if (!sd->edit_glyphs.is_empty()) {
+		edit_glyphs = sd->edit_glyphs;
+		edit_start = sd->edit_start;
+		edit_end = sd->edit_end;
+		edit_delta = sd->edit_delta;
+	} else if (sd->valid) {
+		edit_glyphs = sd->glyphs_shaped;
+	}
+	if (!edit_glyphs.is_empty()) {
+		_merge_edit_range(edit_start, edit_end, start, end, delta);
+		edit_delta += delta;
+	}
+
+	bool breaks_valid = sd->break_ops_valid;
+	HashMap<int, bool> breaks;
+	int breaks_start = sd->break_ops_dirty_start;
+	int breaks_end = sd->break_ops_dirty_end;
+	if (breaks_valid) {
+		for (const KeyValue<int, bool> &E : sd->breaks) {
+			if (E.key <= start) {
+				breaks[E.key] = E.value;
+			} else if (E.key >= end) {
+				breaks[E.key + delta] = E.value;
+			}
+		}
+		_merge_edit_range(breaks_start, breaks_end, start, end, delta);
+	}
+
+	Vector<ShapedTextDataAdvanced::Span> spans;
+	for (int i = 0; i < sd->spans.size(); i++) {
+		ShapedTextDataAdvanced::Span span = sd->spans[i];
+		if (i == owner) {
+			span.end = MAX(span.end, end) + delta;
+		} else if (span.start >= end) {
+			span.start += delta;
+			span.end += delta;
+		} else if (span.end > start) {
+			if (span.end <= end) {
+				continue; // Fully replaced.
+			}
+			span.start = end + delta;
+			span.end += delta;
+		}
+		spans.push_back(span);
+	}
+	sd->spans = spans;
+
+	for (KeyValue<Variant, ShapedTextDataAdvanced::EmbeddedObject> &E : sd->objects) {
+		if (E.value.pos >= end) {
+			E.value.pos += delta;
+		}
+	}
+
+	Vector<Vector2i> bidi_override;
+	for (int i = 0; i < sd->bidi_override.size(); i++) {
+		Vector2i ov = sd->bidi_override[i];
+		ov.x = (ov.x <= start) ? ov.x : ((ov.x >= end) ? ov.x + delta : end + delta);
+		ov.y = (ov.y <= start) ? ov.y : ((ov.y >= end) ? ov.y + delta : end + delta);
+		if (ov.x < ov.y) {
+			bidi_override.push_back(ov);
+		}
+	}
+	sd->bidi_override = bidi_override;
+
+	sd->text = sd->text.substr(0, p_start) + p_text + sd->text.substr(p_start + p_length);
+	sd->end += delta;
+	invalidate(sd, true);
+
+	sd->edited = true;
+	sd->edit_glyphs = edit_glyphs;
+	sd->edit_start = edit_start;
+	sd->edit_end = edit_end;
+	sd->edit_delta = edit_delta;
+	if (breaks_valid) {
+		sd->breaks = breaks;
+		sd->break_ops_valid = true;
+		sd->break_ops_dirty_start = breaks_start;
+		sd->break_ops_dirty_end = breaks_end;
+	}
+
+	return true;
+}
+
 void TextServerAdvanced::_realign(ShapedTextDataAdvanced *p_sd) const {
 	// Align embedded objects to baseline.
 	double full_ascent = p_sd->ascent;
@@ -4400,6 +4770,55 @@ int64_t TextServerAdvanced::shaped_text_get_ellipsis_glyph_count(const RID &p_sh
 	return sd->overrun_trim_data.ellipsis_glyph_buf.size();
 }
 
+void TextServerAdvanced::_update_break_ops(ShapedTextDataAdvanced *p_sd, int p_start, int p_end) {
+	const UChar *data = p_sd->utf16.get_data();
+	UErrorCode err = U_ZERO_ERROR;
+	int i = 0;
+	while (i < p_sd->spans.size()) {
+		String language = p_sd->spans[i].language;
+		int r_start = p_sd->spans[i].start;
+		while (i + 1 < p_sd->spans.size() && language == p_sd->spans[i + 1].language) {
+			i++;
+		}
+		int r_end = p_sd->spans[i].end;
+		i++;
+
+		r_start = MAX(r_start, p_start);
+		r_end = MIN(r_end, p_end);
+		if (r_start >= r_end) {
+			continue;
+		}
+		int u_start = _convert_pos_inv(p_sd, r_start - p_sd->start);
+		int u_end = _convert_pos_inv(p_sd, r_end - p_sd->start);
+		UBreakIterator *bi = ubrk_open(UBRK_LINE, (language.is_empty()) ? TranslationServer::get_singleton()->get_tool_locale().ascii().get_data() : language.ascii().get_data(), data + u_start, u_end - u_start, &err);
+		if (U_FAILURE(err)) {
+			// No data loaded - use fallback.
+			for (int j = r_start; j < r_end; j++) {
+				char32_t c = p_sd->text[j - p_sd->start];
+				if (is_whitespace(c)) {
+					p_sd->breaks[j + 1] = false;
+				}
+				if (is_linebreak(c)) {
+					p_sd->breaks[j + 1] = true;
+				}
+			}
+		} else {
+			while (ubrk_next(bi) != UBRK_DONE) {
+				int pos = _convert_pos(p_sd, u_start + ubrk_current(bi)) + p_sd->start;
+				if (pos == p_end && p_sd->breaks.has(pos)) {
+					continue; // End of the updated range, the break after it is kept.
+				}
+				if ((ubrk_getRuleStatus(bi) >= UBRK_LINE_HARD) && (ubrk_getRuleStatus(bi) < UBRK_LINE_HARD_LIMIT)) {
+					p_sd->breaks[pos] = true;
+				} else if ((ubrk_getRuleStatus(bi) >= UBRK_LINE_SOFT) && (ubrk_getRuleStatus(bi) < UBRK_LINE_SOFT_LIMIT)) {
+					p_sd->breaks[pos] = false;
+				}
+			}
+		}
+		ubrk_close(bi);
+	}
+}
+
 bool TextServerAdvanced::shaped_text_update_breaks(const RID &p_shaped) {
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_V(!sd, false);
@@ -4413,46 +4832,34 @@ bool TextServerAdvanced::shaped_text_update_breaks(const RID &p_shaped) {
 		return true; // Nothing to do.
 	}
 
-	const UChar *data = sd->utf16.get_data();
-
 	if (!sd->break_ops_valid) {
 		sd->breaks.clear();
-		UErrorCode err = U_ZERO_ERROR;
-		int i = 0;
-		while (i < sd->spans.size()) {
-			String language = sd->spans[i].language;
-			int r_start = sd->spans[i].start;
-			while (i + 1 < sd->spans.size() && language == sd->spans[i + 1].language) {
-				i++;
+		_update_break_ops(sd, sd->start, sd->end);
+		sd->break_ops_valid = true;
+	} else if (sd->break_ops_dirty_start >= 0) {
+		// Text was edited, only redo the breaks between the ones around the edit.
+		int from = sd->start;
+		int to = sd->end;
+		for (const KeyValue<int, bool> &E : sd->breaks) {
+			if (E.key < sd->break_ops_dirty_start) {
+				from = MAX(from, E.key);
+			} else if (E.key > sd->break_ops_dirty_end) {
+				to = MIN(to, E.key);
 			}
-			int r_end = sd->spans[i].end;
-			UBreakIterator *bi = ubrk_open(UBRK_LINE, (language.is_empty()) ? TranslationServer::get_singleton()->get_tool_locale().ascii().get_data() : language.ascii().get_data(), data + _convert_pos_inv(sd, r_start), _convert_pos_inv(sd, r_end - r_start), &err);
-			if (U_FAILURE(err)) {
-				// No data loaded - use fallback.
-				for (int j = r_start; j < r_end; j++) {
-					char32_t c = sd->text[j - sd->start];
-					if (is_whitespace(c)) {
-						sd->breaks[j + 1] = false;
-					}
-					if (is_linebreak(c)) {
-						sd->breaks[j + 1] = true;
-					}
-				}
-			} else {
-				while (ubrk_next(bi) != UBRK_DONE) {
-					int pos = _convert_pos(sd, ubrk_current(bi)) + r_start;
-					if ((ubrk_getRuleStatus(bi) >= UBRK_LINE_HARD) && (ubrk_getRuleStatus(bi) < UBRK_LINE_HARD_LIMIT)) {
-						sd->breaks[pos] = true;
-					} else if ((ubrk_getRuleStatus(bi) >= UBRK_LINE_SOFT) && (ubrk_getRuleStatus(bi) < UBRK_LINE_SOFT_LIMIT)) {
-						sd->breaks[pos] = false;
-					}
-				}
+		}
+		LocalVector<int> removed;
+		for (const KeyValue<int, bool> &E : sd->breaks) {
+			if (E.key > from && E.key < to) {
+				removed.push_back(E.key);
 			}
-			ubrk_close(bi);
-			i++;
 		}
-		sd->break_ops_valid = true;
+		for (uint32_t i = 0; i < removed.size(); i++) {
+			sd->breaks.erase(removed[i]);
+		}
+		_update_break_ops(sd, from, to);
 	}
+	sd->break_ops_dirty_start = -1;
+	sd->break_ops_dirty_end = -1;
 
 	sd->sort_valid = false;
 	sd->glyphs_logical.clear();
@@ -4463,6 +4870,10 @@ bool TextServerAdvanced::shaped_text_update_breaks(const RID &p_shaped) {
 	int c_punct_size = sd->custom_punct.length();
 	const char32_t *c_punct = sd->custom_punct.ptr();
 
+	// Virtual spaces are added to a new array, glyphs up to copied_to are already moved there.
+	Vector<Glyph> glyphs_new;
+	int copied_to = 0;
+
 	for (int i = 0; i < sd_size; i++) {
 		if (sd_glyphs[i].count > 0) {
 			char32_t c = ch[sd_glyphs[i].start - sd->start];
@@ -4507,7 +4918,9 @@ bool TextServerAdvanced::shaped_text_update_breaks(const RID &p_shaped) {
 							continue;
 						}
 					} else {
-						if ((i > 0) && ((sd_glyphs[i - 1].flags & (GRAPHEME_IS_SPACE | GRAPHEME_IS_BREAK_SOFT)) == (GRAPHEME_IS_SPACE | GRAPHEME_IS_BREAK_SOFT))) {
+						// The previous glyph is the last virtual space if one was just added.
+						int prev_flags = (copied_to == i && !glyphs_new.is_empty()) ? glyphs_new[glyphs_new.size() - 1].flags : ((i > 0) ? sd_glyphs[i - 1].flags : 0);
+						if ((prev_flags & (GRAPHEME_IS_SPACE | GRAPHEME_IS_BREAK_SOFT)) == (GRAPHEME_IS_SPACE | GRAPHEME_IS_BREAK_SOFT)) {
 							continue;
 						}
 					}
@@ -4518,17 +4931,17 @@ bool TextServerAdvanced::shaped_text_update_breaks(const RID &p_shaped) {
 					gl.font_rid = sd_glyphs[i].font_rid;
 					gl.font_size = sd_glyphs[i].font_size;
 					gl.flags = GRAPHEME_IS_BREAK_SOFT | GRAPHEME_IS_VIRTUAL | GRAPHEME_IS_SPACE;
+					int insert_at = i + count; // Insert after.
 					if (sd_glyphs[i].flags & GRAPHEME_IS_RTL) {
 						gl.flags |= GRAPHEME_IS_RTL;
-						sd->glyphs.insert(i, gl); // Insert before.
-					} else {
-						sd->glyphs.insert(i + count, gl); // Insert after.
+						insert_at = i; // Insert before.
 					}
-					i += count;
-
-					// Update write pointer and size.
-					sd_size = sd->glyphs.size();
-					sd_glyphs = sd->glyphs.ptrw();
+					for (int j = copied_to; j < insert_at; j++) {
+						glyphs_new.push_back(sd_glyphs[j]);
+					}
+					glyphs_new.push_back(gl);
+					copied_to = insert_at;
+					i += count - 1;
 					continue;
 				}
 			}
@@ -4536,6 +4949,12 @@ bool TextServerAdvanced::shaped_text_update_breaks(const RID &p_shaped) {
 			i += (sd_glyphs[i].count - 1);
 		}
 	}
+	if (!glyphs_new.is_empty()) {
+		for (int j = copied_to; j < sd_size; j++) {
+			glyphs_new.push_back(sd_glyphs[j]);
+		}
+		sd->glyphs = glyphs_new;
+	}
 
 	sd->line_breaks_valid = true;
 
@@ -5053,6 +5472,184 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	}
 }
 
+bool TextServerAdvanced::ShapedTextCacheKey::operator==(const ShapedTextCacheKey &p_key) const {
+	if (hash != p_key.hash || font_revision != p_key.font_revision || direction != p_key.direction || orientation != p_key.orientation || preserve_invalid != p_key.preserve_invalid || preserve_control != p_key.preserve_control) {
+		return false;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (extra_spacing[i] != p_key.extra_spacing[i]) {
+			return false;
+		}
+	}
+	if (text != p_key.text || locale != p_key.locale || bidi_override != p_key.bidi_override || spans.size() != p_key.spans.size()) {
+		return false;
+	}
+	for (int i = 0; i < spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &a = spans[i];
+		const ShapedTextDataAdvanced::Span &b = p_key.spans[i];
+		if (a.start != b.start || a.end != b.end || a.font_size != b.font_size || a.language != b.language || a.fonts != b.fonts || a.features != b.features) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void TextServerAdvanced::_shaped_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedTextCacheKey &r_key) const {
+	r_key.text = p_sd->text;
+	r_key.direction = p_sd->direction;
+	r_key.orientation = p_sd->orientation;
+	r_key.preserve_invalid = p_sd->preserve_invalid;
+	r_key.preserve_control = p_sd->preserve_control;
+	r_key.spans = p_sd->spans;
+	r_key.bidi_override = p_sd->bidi_override;
+	r_key.locale = TranslationServer::get_singleton()->get_tool_locale();
+	r_key.font_revision = font_revision.load();
+
+	uint32_t h = HashMapHasherDefault::hash(r_key.text);
+	h = hash_murmur3_one_32(r_key.direction, h);
+	h = hash_murmur3_one_32(r_key.orientation, h);
+	h = hash_murmur3_one_32((r_key.preserve_invalid ? 1 : 0) | (r_key.preserve_control ? 2 : 0), h);
+	for (int i = 0; i < 4; i++) {
+		r_key.extra_spacing[i] = p_sd->extra_spacing[i];
+		h = hash_murmur3_one_32(r_key.extra_spacing[i], h);
+	}
+	for (int i = 0; i < r_key.spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &span = r_key.spans[i];
+		h = hash_murmur3_one_32(span.start, h);
+		h = hash_murmur3_one_32(span.end, h);
+		h = hash_murmur3_one_32(span.font_size, h);
+		h = hash_murmur3_one_32(span.fonts.hash(), h);
+		h = hash_murmur3_one_32(span.features.hash(), h);
+		h = hash_murmur3_one_32(HashMapHasherDefault::hash(span.language), h);
+	}
+	for (int i = 0; i < r_key.bidi_override.size(); i++) {
+		h = hash_murmur3_one_32(r_key.bidi_override[i].x, h);
+		h = hash_murmur3_one_32(r_key.bidi_override[i].y, h);
+	}
+	h = hash_murmur3_one_32(HashMapHasherDefault::hash(r_key.locale), h);
+	h = hash_murmur3_one_64(r_key.font_revision, h);
+	r_key.hash = hash_fmix32(h);
+}
+
+bool TextServerAdvanced::_shaped_cache_fetch(const ShapedTextCacheKey &p_key, ShapedTextDataAdvanced *p_sd) {
+	MutexLock lock(shaped_cache_mutex);
+	List<ShapedTextCacheEntry>::Element **E = shaped_cache.getptr(p_key);
+	if (!E) {
+		return false;
+	}
+	shaped_cache_lru.move_to_front(*E);
+
+	const ShapedTextCacheEntry &entry = (*E)->get();
+	p_sd->glyphs = entry.glyphs; // Shared until either is changed.
+	p_sd->ascent = entry.ascent;
+	p_sd->descent = entry.descent;
+	p_sd->width = entry.width;
+	p_sd->upos = entry.upos;
+	p_sd->uthk = entry.uthk;
+	return true;
+}
+
+void TextServerAdvanced::_shaped_cache_store(const ShapedTextCacheKey &p_key, const ShapedTextDataAdvanced *p_sd) {
+	MutexLock lock(shaped_cache_mutex);
+	List<ShapedTextCacheEntry>::Element **E = shaped_cache.getptr(p_key);
+	if (E) {
+		// Shaped by another thread in the meantime.
+		shaped_cache_lru.move_to_front(*E);
+		return;
+	}
+
+	ShapedTextCacheEntry entry;
+	entry.key = p_key;
+	entry.glyphs = p_sd->glyphs;
+	entry.ascent = p_sd->ascent;
+	entry.descent = p_sd->descent;
+	entry.width = p_sd->width;
+	entry.upos = p_sd->upos;
+	entry.uthk = p_sd->uthk;
+	shaped_cache[p_key] = shaped_cache_lru.push_front(entry);
+
+	while (shaped_cache.size() > SHAPED_CACHE_SIZE) {
+		shaped_cache.erase(shaped_cache_lru.back()->get().key);
+		shaped_cache_lru.pop_back();
+	}
+}
+
+bool TextServerAdvanced::_shape_get_edit_range(const ShapedTextDataAdvanced *p_sd, const Vector<Glyph> &p_glyphs, int p_edit_start, int p_edit_end, int p_edit_delta, int &r_start, int &r_end, int &r_prefix, int &r_suffix) const {
+	// Only left-to-right horizontal text without objects, so the glyphs are in the logical order and can be spliced.
+	if (p_sd->orientation != ORIENTATION_HORIZONTAL || p_sd->direction == DIRECTION_RTL || !p_sd->objects.is_empty()) {
+		return false;
+	}
+	if (p_sd->bidi_override.size() != 1 || p_sd->bidi_override[0] != Vector2i(p_sd->start, p_sd->end)) {
+		return false;
+	}
+	const char32_t *text = p_sd->text.ptr();
+	for (int i = p_edit_start; i < p_edit_end; i++) {
+		UCharDirection dir = u_charDirection(text[i - p_sd->start]);
+		if (dir == U_RIGHT_TO_LEFT || dir == U_RIGHT_TO_LEFT_ARABIC || dir == U_ARABIC_NUMBER || dir == U_RIGHT_TO_LEFT_EMBEDDING || dir == U_RIGHT_TO_LEFT_OVERRIDE || dir == U_RIGHT_TO_LEFT_ISOLATE) {
+			return false;
+		}
+	}
+
+	// Words before and after the edit are reused from the first one that follows a space and is safe to break before, the edit can't change their shaping.
+	const Glyph *glyphs = p_glyphs.ptr();
+	int size = p_glyphs.size();
+	int old_end = p_edit_end - p_edit_delta;
+
+	r_start = 0;
+	r_end = p_sd->text.length();
+	r_prefix = 0;
+	r_suffix = size;
+	for (int i = 0; i < size; i++) {
+		if (glyphs[i].flags & GRAPHEME_IS_RTL) {
+			return false;
+		}
+		if (glyphs[i].count == 0 || (glyphs[i].flags & GRAPHEME_IS_CONNECTED) || glyphs[i].start <= p_sd->start) {
+			continue;
+		}
+		if (glyphs[i].start < p_edit_start) {
+			if (is_whitespace(text[glyphs[i].start - 1 - p_sd->start])) {
+				r_start = glyphs[i].start - p_sd->start;
+				r_prefix = i;
+			}
+		} else if (glyphs[i].start > old_end && r_suffix == size) {
+			if (is_whitespace(text[glyphs[i].start + p_edit_delta - 1 - p_sd->start])) {
+				r_end = glyphs[i].start + p_edit_delta - p_sd->start;
+				r_suffix = i;
+			}
+		}
+	}
+	return true;
+}
+
+void TextServerAdvanced::_shape_reuse_glyphs(ShapedTextDataAdvanced *p_sd, const Vector<Glyph> &p_glyphs, int p_from, int p_to, int p_shift) {
+	// Horizontal text only, see _shape_get_edit_range.
+	const Glyph *glyphs = p_glyphs.ptr();
+	RID last_font;
+	int last_size = 0;
+	for (int i = p_from; i < p_to; i++) {
+		Glyph gl = glyphs[i];
+		gl.start += p_shift;
+		gl.end += p_shift;
+		if (gl.font_rid.is_valid()) {
+			if (gl.font_rid != last_font || gl.font_size != last_size) {
+				last_font = gl.font_rid;
+				last_size = gl.font_size;
+				p_sd->ascent = MAX(p_sd->ascent, font_get_ascent(gl.font_rid, gl.font_size));
+				p_sd->descent = MAX(p_sd->descent, font_get_descent(gl.font_rid, gl.font_size));
+				p_sd->upos = MAX(p_sd->upos, font_get_underline_position(gl.font_rid, gl.font_size));
+				p_sd->uthk = MAX(p_sd->uthk, font_get_underline_thickness(gl.font_rid, gl.font_size));
+			}
+			p_sd->ascent = MAX(p_sd->ascent, -gl.y_off);
+			p_sd->descent = MAX(p_sd->descent, gl.y_off);
+		} else {
+			// Hex code box.
+			p_sd->ascent = MAX(p_sd->ascent, get_hex_code_box_size(gl.font_size, gl.index).y);
+		}
+		p_sd->width += gl.advance;
+		p_sd->glyphs.push_back(gl);
+	}
+}
+
 bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_V(!sd, false);
@@ -5062,6 +5659,12 @@ bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 		return true;
 	}
 
+	// Kept by shaped_text_replace_string, cleared by invalidate().
+	Vector<Glyph> edit_glyphs = sd->edit_glyphs;
+	int edit_start = sd->edit_start;
+	int edit_end = sd->edit_end;
+	int edit_delta = sd->edit_delta;
+
 	invalidate(sd, false);
 	if (sd->parent != RID()) {
 		shaped_text_shape(sd->parent);
@@ -5088,6 +5691,25 @@ bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 		sd->bidi_override.push_back(Vector2i(sd->start, sd->end));
 	}
 
+	// Texts with embedded objects are not cached, their layout depends on the object sizes.
+	ShapedTextCacheKey cache_key;
+	bool cacheable = sd->objects.is_empty();
+	bool cached = false;
+	if (cacheable) {
+		_shaped_cache_make_key(sd, cache_key);
+		cached = _shaped_cache_fetch(cache_key, sd);
+	}
+
+	// After an edit, only shape the words around it and reuse the glyphs of the rest of the text.
+	int shape_start = 0;
+	int shape_end = sd->text.length();
+	int reuse_prefix = 0;
+	int reuse_suffix = edit_glyphs.size();
+	bool reuse = !cached && !edit_glyphs.is_empty() && _shape_get_edit_range(sd, edit_glyphs, edit_start, edit_end, edit_delta, shape_start, shape_end, reuse_prefix, reuse_suffix);
+	if (reuse) {
+		_shape_reuse_glyphs(sd, edit_glyphs, 0, reuse_prefix, 0);
+	}
+
 	for (int ov = 0; ov < sd->bidi_override.size(); ov++) {
 		// Create BiDi iterator.
 		int start = _convert_pos_inv(sd, sd->bidi_override[ov].x - sd->start);
@@ -5124,6 +5746,11 @@ bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 		ERR_FAIL_COND_V_MSG(U_FAILURE(err), false, u_errorName(err));
 		sd->bidi_iter.push_back(bidi_iter);
 
+		if (cached) {
+			// The iterators are still needed for substrings, but the glyphs are already there.
+			continue;
+		}
+
 		err = U_ZERO_ERROR;
 		int bidi_run_count = ubidi_countRuns(bidi_iter, &err);
 		ERR_FAIL_COND_V_MSG(U_FAILURE(err), false, u_errorName(err));
@@ -5160,8 +5787,11 @@ bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 
 			for (int j = scr_from; j != scr_to; j += scr_delta) {
 				if ((sd->script_iter->script_ranges[j].start < bidi_run_end) && (sd->script_iter->script_ranges[j].end > bidi_run_start)) {
-					int32_t script_run_start = MAX(sd->script_iter->script_ranges[j].start, bidi_run_start);
-					int32_t script_run_end = MIN(sd->script_iter->script_ranges[j].end, bidi_run_end);
+					int32_t script_run_start = MAX(MAX(sd->script_iter->script_ranges[j].start, bidi_run_start), shape_start);
+					int32_t script_run_end = MIN(MIN(sd->script_iter->script_ranges[j].end, bidi_run_end), shape_end);
+					if (script_run_start >= script_run_end) {
+						continue; // Outside of the edited range, the glyphs are reused.
+					}
 					char scr_buffer[5] = { 0, 0, 0, 0, 0 };
 					hb_tag_to_string(hb_script_to_iso15924_tag(sd->script_iter->script_ranges[j].script), scr_buffer);
 					String script = String(scr_buffer);
@@ -5221,7 +5851,19 @@ bool TextServerAdvanced::shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
-	_realign(sd);
+	if (reuse) {
+		_shape_reuse_glyphs(sd, edit_glyphs, reuse_suffix, edit_glyphs.size(), edit_delta);
+	}
+
+	if (!cached) {
+		_realign(sd);
+		if (cacheable) {
+			_shaped_cache_store(cache_key, sd);
+		}
+	}
+	if (sd->edited) {
+		sd->glyphs_shaped = sd->glyphs;
+	}
 	sd->valid = true;
 	return sd->valid;
 }
@@ -5740,6 +6382,10 @@ PackedInt32Array TextServerAdvanced::string_get_word_breaks(const String &p_stri
 }
 
 TextServerAdvanced::TextServerAdvanced() {
+	// Read directly, the setting is only registered after the text servers are created.
+	ProjectSettings *ps = ProjectSettings::get_singleton();
+	glyph_disk_cache = ps && ps->has_setting("gui/fonts/glyph_disk_cache") && bool(ps->get_setting("gui/fonts/glyph_disk_cache"));
+
 	_insert_num_systems_lang();
 	_insert_feature_sets();
 	_bmp_create_font_funcs();
@@ -60,6 +60,7 @@
 #include <godot_cpp/classes/text_server_manager.hpp>
 
 #include <godot_cpp/classes/caret_info.hpp>
+#include <godot_cpp/classes/directory.hpp>
 #include <godot_cpp/classes/global_constants_binds.hpp>
 #include <godot_cpp/classes/glyph.hpp>
 #include <godot_cpp/classes/image.hpp>
@@ -69,6 +70,7 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 
 #include <godot_cpp/templates/vector.hpp>
@@ -80,6 +82,7 @@ using namespace godot;
 
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/list.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/texture.h"
 #include "servers/text/text_server_extension.h"
@@ -196,6 +199,10 @@ class TextServerAdvanced : public TextServerExtension {
 
 		Vector<FontTexture> textures;
 		HashMap<int32_t, FontGlyph> glyph_map;
+
+		String disk_cache_path; // Set once the glyph disk cache was looked up for this size.
+		bool disk_cache_dirty = false; // Glyphs were added since then.
+
 		HashMap<Vector2i, Vector2> kerning_map;
 		hb_font_t *hb_handle = nullptr;
 
@@ -254,6 +261,9 @@ class TextServerAdvanced : public TextServerExtension {
 		size_t data_size;
 		int face_index = 0;
 
+		uint32_t data_hash = 0; // Of the font data, for the glyph disk cache.
+		bool data_hash_valid = false;
+
 		~FontAdvanced() {
 			for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : cache) {
 				memdelete(E.value);
@@ -272,6 +282,16 @@ class TextServerAdvanced : public TextServerExtension {
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
+
+	// Glyph disk cache, keeps the rasterized glyphs of dynamic fonts in "user://" between runs.
+	enum {
+		GLYPH_DISK_CACHE_VERSION = 1,
+	};
+
+	bool glyph_disk_cache = false;
+
+	void _font_load_disk_cache(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data) const;
+	void _font_save_disk_cache(FontForSizeAdvanced *p_data) const;
 	void _generateMTSDF_threaded(uint32_t y, void *p_td) const;
 
 	_FORCE_INLINE_ Vector2i _get_size(const FontAdvanced *p_font_data, int p_size) const {
@@ -379,6 +399,16 @@ class TextServerAdvanced : public TextServerExtension {
 		bool break_ops_valid = false;
 		bool js_ops_valid = false;
 
+		/* Incremental update (see shaped_text_replace_string) */
+		bool edited = false; // Keep the shaped glyphs, so the next edit only reshapes the words around it.
+		Vector<Glyph> glyphs_shaped; // Glyphs before line breaks and justification are applied.
+		Vector<Glyph> edit_glyphs; // Glyphs of the text before the pending edits.
+		int edit_start = -1; // Range changed by the pending edits, in the current text.
+		int edit_end = -1;
+		int edit_delta = 0; // Change of the text length since edit_glyphs were shaped.
+		int break_ops_dirty_start = -1; // Range of the text to update the line breaks for, if break_ops_valid.
+		int break_ops_dirty_end = -1;
+
 		~ShapedTextDataAdvanced() {
 			for (int i = 0; i < bidi_iter.size(); i++) {
 				ubidi_close(bidi_iter[i]);
@@ -392,11 +422,56 @@ class TextServerAdvanced : public TextServerExtension {
 		}
 	};
 
+	// Shaped text cache, lets top-level texts reuse the glyphs of an identical text shaped before instead of going through HarfBuzz again.
+	enum {
+		SHAPED_CACHE_SIZE = 256,
+	};
+
+	struct ShapedTextCacheKey {
+		String text;
+		TextServer::Direction direction = DIRECTION_LTR;
+		TextServer::Orientation orientation = ORIENTATION_HORIZONTAL;
+		bool preserve_invalid = true;
+		bool preserve_control = false;
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		Vector<ShapedTextDataAdvanced::Span> spans;
+		Vector<Vector2i> bidi_override;
+		String locale; // Used by the spans without a language.
+		uint64_t font_revision = 0;
+		uint32_t hash = 0;
+
+		bool operator==(const ShapedTextCacheKey &p_key) const;
+	};
+
+	struct ShapedTextCacheKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const ShapedTextCacheKey &p_key) { return p_key.hash; }
+	};
+
+	struct ShapedTextCacheEntry {
+		ShapedTextCacheKey key;
+		Vector<Glyph> glyphs;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+	};
+
+	Mutex shaped_cache_mutex;
+	List<ShapedTextCacheEntry> shaped_cache_lru; // Most recently used first.
+	HashMap<ShapedTextCacheKey, List<ShapedTextCacheEntry>::Element *, ShapedTextCacheKeyHasher> shaped_cache;
+	std::atomic<uint64_t> font_revision = { 0 }; // Incremented by the font changes that may affect shaping, to stop using the cached glyphs.
+
+	void _shaped_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedTextCacheKey &r_key) const;
+	bool _shaped_cache_fetch(const ShapedTextCacheKey &p_key, ShapedTextDataAdvanced *p_sd);
+	void _shaped_cache_store(const ShapedTextCacheKey &p_key, const ShapedTextDataAdvanced *p_sd);
+
 	// Common data.
 
 	double oversampling = 1.0;
-	mutable RID_PtrOwner<FontAdvanced> font_owner;
-	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
+	// Thread safe, so shaping can run on worker threads while texts are created and freed.
+	mutable RID_PtrOwner<FontAdvanced, true> font_owner;
+	mutable RID_PtrOwner<ShapedTextDataAdvanced, true> shaped_owner;
 
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
 	int64_t _convert_pos(const String &p_utf32, const Char16String &p_utf16, int64_t p_pos) const;
@@ -404,6 +479,9 @@ class TextServerAdvanced : public TextServerExtension {
 	int64_t _convert_pos_inv(const ShapedTextDataAdvanced *p_sd, int64_t p_pos) const;
 	bool _shape_substr(ShapedTextDataAdvanced *p_new_sd, const ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_length) const;
 	void _shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, Array p_fonts, int64_t p_span, int64_t p_fb_index);
+	bool _shape_get_edit_range(const ShapedTextDataAdvanced *p_sd, const Vector<Glyph> &p_glyphs, int p_edit_start, int p_edit_end, int p_edit_delta, int &r_start, int &r_end, int &r_prefix, int &r_suffix) const;
+	void _shape_reuse_glyphs(ShapedTextDataAdvanced *p_sd, const Vector<Glyph> &p_glyphs, int p_from, int p_to, int p_shift);
+	void _update_break_ops(ShapedTextDataAdvanced *p_sd, int p_start, int p_end);
 	Glyph _shape_single_glyph(ShapedTextDataAdvanced *p_sd, char32_t p_char, hb_script_t p_script, hb_direction_t p_direction, const RID &p_font, int64_t p_font_size);
 
 	_FORCE_INLINE_ void _add_featuers(const Dictionary &p_source, Vector<hb_feature_t> &r_ftrs);
@@ -655,6 +733,7 @@ public:
 	virtual bool shaped_text_add_string(const RID &p_shaped, const String &p_text, const Array &p_fonts, int64_t p_size, const Dictionary &p_opentype_features = Dictionary(), const String &p_language = "", const Variant &p_meta = Variant()) override;
 	virtual bool shaped_text_add_object(const RID &p_shaped, const Variant &p_key, const Size2 &p_size, InlineAlignment p_inline_align = INLINE_ALIGNMENT_CENTER, int64_t p_length = 1) override;
 	virtual bool shaped_text_resize_object(const RID &p_shaped, const Variant &p_key, const Size2 &p_size, InlineAlignment p_inline_align = INLINE_ALIGNMENT_CENTER) override;
+	virtual bool shaped_text_replace_string(const RID &p_shaped, int64_t p_start, int64_t p_length, const String &p_text) override;
 
 	virtual int64_t shaped_get_span_count(const RID &p_shaped) const override;
 	virtual Variant shaped_get_span_meta(const RID &p_shaped, int64_t p_index) const override;
@@ -2777,6 +2777,79 @@ bool TextServerFallback::shaped_text_resize_object(const RID &p_shaped, const Va
 	return true;
 }
 
+bool TextServerFallback::shaped_text_replace_string(const RID &p_shaped, int64_t p_start, int64_t p_length, const String &p_text) {
+	ShapedTextDataFallback *sd = shaped_owner.get_or_null(p_shaped);
+	ERR_FAIL_COND_V(!sd, false);
+
+	MutexLock lock(sd->mutex);
+	if (sd->parent != RID()) {
+		full_copy(sd);
+	}
+	ERR_FAIL_COND_V(p_start < 0 || p_length < 0 || p_start + p_length > sd->text.length(), false);
+	ERR_FAIL_COND_V(sd->spans.is_empty(), false);
+
+	if (p_length == 0 && p_text.is_empty()) {
+		return true;
+	}
+
+	int64_t start = sd->start + p_start;
+	int64_t end = start + p_length;
+	int64_t delta = p_text.length() - p_length;
+
+	// Inserted characters continue the span before them, replacing characters keeps the span of the first one.
+	int64_t owner_pos = (p_length == 0 && start > sd->start) ? start - 1 : start;
+	int owner = -1;
+	for (int i = 0; i < sd->spans.size(); i++) {
+		const ShapedTextDataFallback::Span &span = sd->spans[i];
+		ERR_FAIL_COND_V_MSG(span.embedded_key != Variant() && span.start < end && span.end > start, false, "Embedded objects can't be replaced.");
+		if (span.start <= owner_pos && span.end > owner_pos) {
+			owner = i;
+		}
+	}
+	if (owner != -1 && sd->spans[owner].embedded_key != Variant() && owner_pos != start) {
+		// Inserted right after an object, use the span after it.
+		owner = -1;
+		for (int i = 0; i < sd->spans.size(); i++) {
+			if (sd->spans[i].start <= start && sd->spans[i].end > start) {
+				owner = i;
+				break;
+			}
+		}
+	}
+	ERR_FAIL_COND_V_MSG(owner == -1 || sd->spans[owner].embedded_key != Variant(), false, "No text span to insert the string into.");
+
+	Vector<ShapedTextDataFallback::Span> spans;
+	for (int i = 0; i < sd->spans.size(); i++) {
+		ShapedTextDataFallback::Span span = sd->spans[i];
+		if (i == owner) {
+			span.end = MAX(span.end, end) + delta;
+		} else if (span.start >= end) {
+			span.start += delta;
+			span.end += delta;
+		} else if (span.end > start) {
+			if (span.end <= end) {
+				continue; // Fully replaced.
+			}
+			span.start = end + delta;
+			span.end += delta;
+		}
+		spans.push_back(span);
+	}
+	sd->spans = spans;
+
+	for (KeyValue<Variant, ShapedTextDataFallback::EmbeddedObject> &E : sd->objects) {
+		if (E.value.pos >= end) {
+			E.value.pos += delta;
+		}
+	}
+
+	sd->text = sd->text.substr(0, p_start) + p_text + sd->text.substr(p_start + p_length);
+	sd->end += delta;
+	invalidate(sd);
+
+	return true;
+}
+
 void TextServerFallback::_realign(ShapedTextDataFallback *p_sd) const {
 	// Align embedded objects to baseline.
 	double full_ascent = p_sd->ascent;
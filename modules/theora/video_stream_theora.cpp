@@ -81,36 +81,105 @@ int VideoStreamPlaybackTheora::queue_page(ogg_page *page) {
 	return 0;
 }
 
-void VideoStreamPlaybackTheora::video_write() {
+void VideoStreamPlaybackTheora::video_write(const th_ycbcr_buffer &p_yuv, uint8_t *p_dst) {
+	//uv_offset=(ti.pic_x/2)+(yuv[1].stride)*(ti.pic_y/2);
+
+	if (px_fmt == TH_PF_444) {
+		yuv444_2_rgb8888(p_dst, (uint8_t *)p_yuv[0].data, (uint8_t *)p_yuv[1].data, (uint8_t *)p_yuv[2].data, size.x, size.y, p_yuv[0].stride, p_yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_422) {
+		yuv422_2_rgb8888(p_dst, (uint8_t *)p_yuv[0].data, (uint8_t *)p_yuv[1].data, (uint8_t *)p_yuv[2].data, size.x, size.y, p_yuv[0].stride, p_yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_420) {
+		yuv420_2_rgb8888(p_dst, (uint8_t *)p_yuv[0].data, (uint8_t *)p_yuv[1].data, (uint8_t *)p_yuv[2].data, size.x, size.y, p_yuv[0].stride, p_yuv[1].stride, size.x << 2);
+	};
+}
+
+bool VideoStreamPlaybackTheora::_decode_packet(const VideoPacket &p_packet, VideoFrame &r_frame) {
+	ogg_packet op;
+	op.packet = (unsigned char *)p_packet.data.ptr();
+	op.bytes = p_packet.data.size();
+	op.b_o_s = p_packet.b_o_s;
+	op.e_o_s = p_packet.e_o_s;
+	op.granulepos = p_packet.granulepos;
+	op.packetno = p_packet.packetno;
+
+	/*HACK: This should be set after a seek or a gap, but we might not have
+	a granulepos for the first packet (we only have them for the last
+	packet on a page), so we just set it as often as we get it.
+	To do this right, we should back-track from the last packet on the
+	page and compute the correct granulepos for the first packet after
+	a seek or a gap.*/
+	if (op.granulepos >= 0) {
+		th_decode_ctl(td, TH_DECCTL_SET_GRANPOS, &op.granulepos,
+				sizeof(op.granulepos));
+	}
+
+	// Duplicate frames (and failures) don't produce a new image.
+	ogg_int64_t videobuf_granulepos;
+	if (th_decode_packetin(td, &op, &videobuf_granulepos) != 0) {
+		return false;
+	}
+
+	r_frame.time = th_granule_time(td, videobuf_granulepos);
+
 	th_ycbcr_buffer yuv;
 	th_decode_ycbcr_out(td, yuv);
 
-	int pitch = 4;
-	frame_data.resize(size.x * size.y * pitch);
-	{
-		uint8_t *w = frame_data.ptrw();
-		char *dst = (char *)w;
+	r_frame.data.resize(size.x * size.y * 4);
+	video_write(yuv, r_frame.data.ptrw());
+
+	return true;
+}
 
-		//uv_offset=(ti.pic_x/2)+(yuv[1].stride)*(ti.pic_y/2);
+void VideoStreamPlaybackTheora::_decode_thread_func(void *p_userdata) {
+	VideoStreamPlaybackTheora *vs = static_cast<VideoStreamPlaybackTheora *>(p_userdata);
 
-		if (px_fmt == TH_PF_444) {
-			yuv444_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+	while (!vs->decode_exit.is_set()) {
+		vs->decode_mutex.lock();
+		if (vs->packet_queue.is_empty() || vs->frame_queue.size() >= MAX_FRAMES) {
+			vs->decode_mutex.unlock();
+			// Posted whenever a packet is queued or a frame is taken.
+			vs->decode_semaphore.wait();
+			continue;
+		}
 
-		} else if (px_fmt == TH_PF_422) {
-			yuv422_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+		VideoPacket packet = vs->packet_queue.front()->get();
+		vs->packet_queue.pop_front();
+		VideoFrame frame;
+		if (!vs->free_frame_data.is_empty()) {
+			frame.data = vs->free_frame_data.front()->get();
+			vs->free_frame_data.pop_front();
+		}
+		vs->decoding_packet = true;
+		vs->decode_mutex.unlock();
 
-		} else if (px_fmt == TH_PF_420) {
-			yuv420_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-		};
+		bool decoded = vs->_decode_packet(packet, frame);
 
-		format = Image::FORMAT_RGBA8;
+		MutexLock lock(vs->decode_mutex);
+		if (decoded) {
+			vs->frame_queue.push_back(frame);
+		} else if (!frame.data.is_empty()) {
+			vs->free_frame_data.push_back(frame.data);
+		}
+		vs->decoding_packet = false;
 	}
+}
 
-	Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame_data)); //zero copy image creation
+void VideoStreamPlaybackTheora::_stop_decode_thread() {
+	if (!decode_thread.is_started()) {
+		return;
+	}
 
-	texture->update(img); //zero copy send to rendering server
+	decode_exit.set();
+	decode_semaphore.post();
+	decode_thread.wait_to_finish();
+	decode_exit.clear();
 
-	frames_pending = 1;
+	packet_queue.clear();
+	frame_queue.clear();
+	free_frame_data.clear();
+	decoding_packet = false;
 }
 
 void VideoStreamPlaybackTheora::clear() {
@@ -118,6 +187,8 @@ void VideoStreamPlaybackTheora::clear() {
 		return;
 	}
 
+	_stop_decode_thread();
+
 	if (vorbis_p) {
 		ogg_stream_clear(&vo);
 		if (vorbis_p >= 3) {
@@ -319,7 +390,6 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 				sizeof(pp_level_max));
 		pp_level = 0;
 		th_decode_ctl(td, TH_DECCTL_SET_PPLEVEL, &pp_level, sizeof(pp_level));
-		pp_inc = 0;
 
 		int w;
 		int h;
@@ -333,6 +403,8 @@ void VideoStreamPlaybackTheora::set_file(const String &p_file) {
 		img->create(w, h, false, Image::FORMAT_RGBA8);
 		texture->set_image(img);
 
+		decode_thread.start(_decode_thread_func, this);
+
 	} else {
 		/* tear down the partial theora setup */
 		th_info_clear(&ti);
@@ -384,18 +456,48 @@ void VideoStreamPlaybackTheora::update(float p_delta) {
 
 	time += p_delta;
 
-	if (videobuf_time > get_time()) {
-		return; //no new frames need to be produced
+	if (theora_p && videobuf_time <= get_time()) {
+		// Show the first decoded frame that is not already in the past, dropping the ones before it.
+		// If the decoder fell behind and every queued frame is late, show the most recent one.
+		VideoFrame frame;
+		bool frame_done = false;
+		{
+			MutexLock lock(decode_mutex);
+			while (!frame_queue.is_empty()) {
+				if (frame_done) {
+					free_frame_data.push_back(frame.data);
+				}
+				frame = frame_queue.front()->get();
+				frame_queue.pop_front();
+				frame_done = true;
+				if (frame.time >= get_time()) {
+					break;
+				}
+			}
+		}
+
+		if (frame_done) {
+			decode_semaphore.post(); // There's room in the frame queue again.
+
+			videobuf_time = frame.time;
+
+			Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame.data)); //zero copy image creation
+			texture->update(img); //zero copy send to rendering server
+			img.unref();
+
+			format = Image::FORMAT_RGBA8;
+			frames_pending = 1;
+
+			MutexLock lock(decode_mutex);
+			free_frame_data.push_back(frame.data);
+		}
 	}
 
-	bool frame_done = false;
 	bool audio_done = !vorbis_p;
+	bool no_theora = false;
 
-	while (!frame_done || (!audio_done && !vorbis_eos)) {
-		//a frame needs to be produced
-
+	while (true) {
 		ogg_packet op;
-		bool no_theora = false;
 		bool buffer_full = false;
 
 		while (vorbis_p && !audio_done && !buffer_full) {
@@ -450,95 +552,70 @@ void VideoStreamPlaybackTheora::update(float p_delta) {
 			audio_done = videobuf_time < (audio_frames_wrote / float(vi.rate));
 
 			if (buffer_full) {
+				// Try again on the next update, reading more pages won't make room.
+				audio_done = true;
 				break;
 			}
 		}
 
-		while (theora_p && !frame_done) {
-			/* theora is one in, one out... */
-			if (ogg_stream_packetout(&to, &op) > 0) {
-				if (false && pp_inc) {
-					pp_level += pp_inc;
-					th_decode_ctl(td, TH_DECCTL_SET_PPLEVEL, &pp_level,
-							sizeof(pp_level));
-					pp_inc = 0;
-				}
-				/*HACK: This should be set after a seek or a gap, but we might not have
-				a granulepos for the first packet (we only have them for the last
-				packet on a page), so we just set it as often as we get it.
-				To do this right, we should back-track from the last packet on the
-				page and compute the correct granulepos for the first packet after
-				a seek or a gap.*/
-				if (op.granulepos >= 0) {
-					th_decode_ctl(td, TH_DECCTL_SET_GRANPOS, &op.granulepos,
-							sizeof(op.granulepos));
-				}
-				ogg_int64_t videobuf_granulepos;
-				if (th_decode_packetin(td, &op, &videobuf_granulepos) == 0) {
-					videobuf_time = th_granule_time(td, videobuf_granulepos);
-
-					//printf("frame time %f, play time %f, ready %i\n", (float)videobuf_time, get_time(), videobuf_ready);
-
-					/* is it already too old to be useful? This is only actually
-					 useful cosmetically after a SIGSTOP. Note that we have to
-					 decode the frame even if we don't show it (for now) due to
-					 keyframing. Soon enough libtheora will be able to deal
-					 with non-keyframe seeks.  */
-
-					if (videobuf_time >= get_time()) {
-						frame_done = true;
-					} else {
-						/*If we are too slow, reduce the pp level.*/
-						pp_inc = pp_level > 0 ? -1 : 0;
-					}
+		// Keep the decoder thread fed, a few packets ahead of the frames it has ready.
+		bool video_done = !theora_p;
+		while (!video_done) {
+			{
+				MutexLock lock(decode_mutex);
+				if (packet_queue.size() + frame_queue.size() >= MAX_PACKETS) {
+					video_done = true;
+					break;
 				}
+			}
 
-			} else {
+			if (ogg_stream_packetout(&to, &op) <= 0) {
+				// Theora is done once its last page is in and no packets are left.
 				no_theora = true;
+				video_done = theora_eos;
 				break;
 			}
-		}
-
-#ifdef THEORA_USE_THREAD_STREAMING
-		if (file.is_valid() && thread_eof && no_theora && theora_eos && ring_buffer.data_left() == 0) {
-#else
-		if (file.is_valid() && /*!videobuf_ready && */ no_theora && theora_eos) {
-#endif
-			//printf("video done, stopping\n");
-			stop();
-			return;
-		};
 
-		if (!frame_done || !audio_done) {
-			//what's the point of waiting for audio to grab a page?
-
-			buffer_data();
-			while (ogg_sync_pageout(&oy, &og) > 0) {
-				queue_page(&og);
+			VideoPacket packet;
+			packet.data.resize(op.bytes);
+			memcpy(packet.data.ptrw(), op.packet, op.bytes);
+			packet.granulepos = op.granulepos;
+			packet.packetno = op.packetno;
+			packet.b_o_s = op.b_o_s;
+			packet.e_o_s = op.e_o_s;
+
+			{
+				MutexLock lock(decode_mutex);
+				packet_queue.push_back(packet);
 			}
+			decode_semaphore.post();
 		}
 
-		/* If playback has begun, top audio buffer off immediately. */
-		//if(stateflag) audio_write_nonblocking();
-
-		/* are we at or past time for this video frame? */
-		if (videobuf_ready && videobuf_time <= get_time()) {
-			//video_write();
-			//videobuf_ready=0;
-		} else {
-			//printf("frame at %f not ready (time %f), ready %i\n", (float)videobuf_time, get_time(), videobuf_ready);
+		if ((audio_done || vorbis_eos) && video_done) {
+			break;
 		}
 
-		float tdiff = videobuf_time - get_time();
-		/*If we have lots of extra time, increase the post-processing level.*/
-		if (tdiff > ti.fps_denominator * 0.25 / ti.fps_numerator) {
-			pp_inc = pp_level < pp_level_max ? 1 : 0;
-		} else if (tdiff < ti.fps_denominator * 0.05 / ti.fps_numerator) {
-			pp_inc = pp_level > 0 ? -1 : 0;
+		//what's the point of waiting for audio to grab a page?
+		if (buffer_data() == 0) {
+			break;
+		}
+		while (ogg_sync_pageout(&oy, &og) > 0) {
+			queue_page(&og);
 		}
 	}
 
-	video_write();
+	if (theora_p && no_theora && theora_eos) {
+		bool video_finished;
+		{
+			MutexLock lock(decode_mutex);
+			video_finished = packet_queue.is_empty() && frame_queue.is_empty() && !decoding_packet;
+		}
+		if (video_finished) {
+			//printf("video done, stopping\n");
+			stop();
+			return;
+		}
+	}
 };
 
 void VideoStreamPlaybackTheora::play() {
@@ -33,8 +33,10 @@
 
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
+#include "core/os/mutex.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/list.h"
 #include "core/templates/ring_buffer.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/resources/video_stream.h"
@@ -50,11 +52,38 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 
 	enum {
 		MAX_FRAMES = 4,
+		MAX_PACKETS = 8,
 	};
 
-	//Image frames[MAX_FRAMES];
+	struct VideoPacket {
+		Vector<uint8_t> data;
+		ogg_int64_t granulepos = -1;
+		ogg_int64_t packetno = 0;
+		bool b_o_s = false;
+		bool e_o_s = false;
+	};
+
+	struct VideoFrame {
+		Vector<uint8_t> data;
+		double time = 0;
+	};
+
+	// Theora packets are decoded and converted to RGBA on decode_thread, so update() only demuxes, mixes the audio and uploads the frames.
+	// Both queues and free_frame_data are guarded by decode_mutex.
+	List<VideoPacket> packet_queue;
+	List<VideoFrame> frame_queue;
+	List<Vector<uint8_t>> free_frame_data;
+	bool decoding_packet = false;
+	Mutex decode_mutex;
+	Semaphore decode_semaphore;
+	Thread decode_thread;
+	SafeFlag decode_exit;
+
+	static void _decode_thread_func(void *p_userdata);
+	bool _decode_packet(const VideoPacket &p_packet, VideoFrame &r_frame);
+	void _stop_decode_thread();
+
 	Image::Format format = Image::Format::FORMAT_L8;
-	Vector<uint8_t> frame_data;
 	int frames_pending = 0;
 	Ref<FileAccess> file;
 	String file_name;
@@ -63,7 +92,7 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 
 	int buffer_data();
 	int queue_page(ogg_page *page);
-	void video_write();
+	void video_write(const th_ycbcr_buffer &p_yuv, uint8_t *p_dst);
 	float get_time() const;
 
 	bool theora_eos = false;
@@ -81,8 +110,7 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	vorbis_block vb;
 	vorbis_comment vc;
 	th_pixel_fmt px_fmt;
-	double videobuf_time = 0;
-	int pp_inc = 0;
+	double videobuf_time = 0; // Time of the frame on screen.
 
 	int theora_p = 0;
 	int vorbis_p = 0;
@@ -226,6 +226,7 @@ bool AudioStreamPlaybackOGGVorbis::_alloc_vorbis() {
 void AudioStreamPlaybackOGGVorbis::start(float p_from_pos) {
 	ERR_FAIL_COND(!ready);
 	loop_fade_remaining = FADE_SIZE;
+	set_prefetch_enabled(vorbis_stream->prefetch_enabled);
 	active = true;
 	seek(p_from_pos);
 	loops = 0;
@@ -233,11 +234,12 @@ void AudioStreamPlaybackOGGVorbis::start(float p_from_pos) {
 }
 
 void AudioStreamPlaybackOGGVorbis::stop() {
+	prefetch_reset();
 	active = false;
 }
 
 bool AudioStreamPlaybackOGGVorbis::is_playing() const {
-	return active;
+	return active || get_prefetched_frames() > 0;
 }
 
 int AudioStreamPlaybackOGGVorbis::get_loop_count() const {
@@ -245,7 +247,39 @@ int AudioStreamPlaybackOGGVorbis::get_loop_count() const {
 }
 
 float AudioStreamPlaybackOGGVorbis::get_playback_position() const {
-	return float(frames_mixed) / vorbis_data->get_sampling_rate();
+	// The frames decoded ahead haven't been played yet.
+	float position = float(frames_mixed) / vorbis_data->get_sampling_rate() - float(get_prefetched_frames()) / vorbis_data->get_sampling_rate();
+	if (position < 0) {
+		position = MAX(0, position + vorbis_stream->get_length() - vorbis_stream->loop_offset);
+	}
+	return position;
+}
+
+bool AudioStreamPlaybackOGGVorbis::can_skip() const {
+	return true;
+}
+
+void AudioStreamPlaybackOGGVorbis::skip(float p_time) {
+	float position = get_playback_position() + p_time;
+	// Drop what was decoded ahead, also when the decoding already reached the end.
+	prefetch_reset();
+	if (!active) {
+		return;
+	}
+
+	float length = vorbis_stream->get_length();
+	if (position >= length) {
+		float loop_length = length - vorbis_stream->loop_offset;
+		if (!vorbis_stream->loop || loop_length <= 0) {
+			active = false;
+			return;
+		}
+		int skipped_loops = int((position - length) / loop_length) + 1;
+		loops += skipped_loops;
+		position -= skipped_loops * loop_length;
+	}
+
+	seek(position);
 }
 
 void AudioStreamPlaybackOGGVorbis::tag_used_streams() {
@@ -253,6 +287,8 @@ void AudioStreamPlaybackOGGVorbis::tag_used_streams() {
 }
 
 void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
+	prefetch_reset();
+
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -371,6 +407,8 @@ void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
 }
 
 AudioStreamPlaybackOGGVorbis::~AudioStreamPlaybackOGGVorbis() {
+	prefetch_reset();
+
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
@@ -470,6 +508,14 @@ float AudioStreamOGGVorbis::get_loop_offset() const {
 	return loop_offset;
 }
 
+void AudioStreamOGGVorbis::set_prefetch_enabled(bool p_enabled) {
+	prefetch_enabled = p_enabled;
+}
+
+bool AudioStreamOGGVorbis::is_prefetch_enabled() const {
+	return prefetch_enabled;
+}
+
 float AudioStreamOGGVorbis::get_length() const {
 	ERR_FAIL_COND_V(packet_sequence.is_null(), 0);
 	return packet_sequence->get_length();
@@ -519,6 +565,9 @@ void AudioStreamOGGVorbis::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_loop_offset", "seconds"), &AudioStreamOGGVorbis::set_loop_offset);
 	ClassDB::bind_method(D_METHOD("get_loop_offset"), &AudioStreamOGGVorbis::get_loop_offset);
 
+	ClassDB::bind_method(D_METHOD("set_prefetch_enabled", "enabled"), &AudioStreamOGGVorbis::set_prefetch_enabled);
+	ClassDB::bind_method(D_METHOD("is_prefetch_enabled"), &AudioStreamOGGVorbis::is_prefetch_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_bpm", "bpm"), &AudioStreamOGGVorbis::set_bpm);
 	ClassDB::bind_method(D_METHOD("get_bpm"), &AudioStreamOGGVorbis::get_bpm);
 
@@ -534,6 +583,7 @@ void AudioStreamOGGVorbis::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "bar_beats", PROPERTY_HINT_RANGE, "2,32,1,or_greater"), "set_bar_beats", "get_bar_beats");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "loop_offset"), "set_loop_offset", "get_loop_offset");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "prefetch_enabled"), "set_prefetch_enabled", "is_prefetch_enabled");
 }
 
 AudioStreamOGGVorbis::AudioStreamOGGVorbis() {}
@@ -92,6 +92,9 @@ public:
 	virtual float get_playback_position() const override;
 	virtual void seek(float p_time) override;
 
+	virtual bool can_skip() const override;
+	virtual void skip(float p_time) override;
+
 	virtual void tag_used_streams() override;
 
 	AudioStreamPlaybackOGGVorbis() {}
@@ -109,6 +112,7 @@ class AudioStreamOGGVorbis : public AudioStream {
 	float length = 0.0;
 	bool loop = false;
 	float loop_offset = 0.0;
+	bool prefetch_enabled = false;
 
 	// Performs a seek to the beginning of the stream, should not be called during playback!
 	// Also causes allocation and deallocation.
@@ -130,6 +134,9 @@ public:
 	void set_loop_offset(float p_seconds);
 	float get_loop_offset() const;
 
+	void set_prefetch_enabled(bool p_enabled);
+	bool is_prefetch_enabled() const;
+
 	void set_bpm(double p_bpm);
 	virtual double get_bpm() const override;
 
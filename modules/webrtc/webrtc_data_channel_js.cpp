@@ -125,8 +125,16 @@ Error WebRTCDataChannelJS::get_packet(const uint8_t **r_buffer, int &r_buffer_si
 
 	in_buffer.read(&is_string, 1);
 	_was_string = is_string == 1;
-	in_buffer.read(packet_buffer, to_read);
-	*r_buffer = packet_buffer;
+
+	// Only copy when the payload wraps around the end of the ring buffer, messages are only queued from the browser event loop, between frames.
+	const uint8_t *view = in_buffer.get_read_ptr(to_read);
+	if (view) {
+		in_buffer.advance_read(to_read);
+		*r_buffer = view;
+	} else {
+		in_buffer.read(packet_buffer, to_read);
+		*r_buffer = packet_buffer;
+	}
 	r_buffer_size = to_read;
 
 	return OK;
@@ -71,11 +71,11 @@ Error EMWSPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 		return ERR_UNAVAILABLE;
 	}
 
+	// Only copies when the packet wraps around the end of the ring buffer.
 	int read = 0;
-	Error err = _in_buffer.read_packet(_packet_buffer.ptrw(), _packet_buffer.size(), &_is_string, read);
+	Error err = _in_buffer.read_packet_view(r_buffer, _packet_buffer.ptrw(), _packet_buffer.size(), &_is_string, read);
 	ERR_FAIL_COND_V(err != OK, err);
 
-	*r_buffer = _packet_buffer.ptr();
 	r_buffer_size = read;
 
 	return OK;
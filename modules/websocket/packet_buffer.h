@@ -90,6 +90,31 @@ public:
 		return OK;
 	}
 
+	// Like read_packet, but points r_payload into the buffer itself when the payload doesn't wrap around the end of it, only copying into p_scratch otherwise.
+	// The payload stays valid until the next write_packet or resize.
+	Error read_packet_view(const uint8_t **r_payload, uint8_t *p_scratch, int p_scratch_size, T *r_info, int &r_read) {
+		ERR_FAIL_COND_V(_packets.data_left() < 1, ERR_UNAVAILABLE);
+		_Packet p;
+		_packets.read(&p, 1);
+		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
+
+		r_read = p.size;
+		memcpy(r_info, &p.info, sizeof(T));
+		const uint8_t *view = _payload.get_read_ptr(p.size);
+		if (view) {
+			_payload.advance_read(p.size);
+			*r_payload = view;
+			return OK;
+		}
+		if (p_scratch_size < (int)p.size) {
+			_payload.advance_read(p.size);
+			ERR_FAIL_V(ERR_OUT_OF_MEMORY);
+		}
+		_payload.read(p_scratch, p.size);
+		*r_payload = p_scratch;
+		return OK;
+	}
+
 	void discard_payload(int p_size) {
 		_packets.decrease_write(p_size);
 	}
@@ -41,16 +41,9 @@ WebSocketMultiplayerPeer::~WebSocketMultiplayerPeer() {
 
 void WebSocketMultiplayerPeer::_clear() {
 	_peer_map.clear();
-	if (_current_packet.data != nullptr) {
-		memfree(_current_packet.data);
-	}
-
-	for (Packet &E : _incoming_packets) {
-		memfree(E.data);
-		E.data = nullptr;
-	}
-
 	_incoming_packets.clear();
+	_incoming_payload.clear();
+	_incoming_packets_read = 0;
 }
 
 void WebSocketMultiplayerPeer::_bind_methods() {
@@ -66,7 +59,7 @@ void WebSocketMultiplayerPeer::_bind_methods() {
 int WebSocketMultiplayerPeer::get_available_packet_count() const {
 	ERR_FAIL_COND_V_MSG(!_is_multiplayer, 0, "Please use get_peer(ID).get_available_packet_count to get available packet count from peers when not using the MultiplayerAPI.");
 
-	return _incoming_packets.size();
+	return _incoming_packets.size() - _incoming_packets_read;
 }
 
 Error WebSocketMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
@@ -74,18 +67,12 @@ Error WebSocketMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buff
 
 	r_buffer_size = 0;
 
-	if (_current_packet.data != nullptr) {
-		memfree(_current_packet.data);
-		_current_packet.data = nullptr;
-	}
-
-	ERR_FAIL_COND_V(_incoming_packets.size() == 0, ERR_UNAVAILABLE);
-
-	_current_packet = _incoming_packets.front()->get();
-	_incoming_packets.pop_front();
+	ERR_FAIL_COND_V(_incoming_packets_read >= _incoming_packets.size(), ERR_UNAVAILABLE);
 
-	*r_buffer = _current_packet.data;
-	r_buffer_size = _current_packet.size;
+	// Stays valid until the next poll, the payload is only reset when storing new packets.
+	const Packet &packet = _incoming_packets[_incoming_packets_read++];
+	*r_buffer = _incoming_payload.ptr() + packet.offset;
+	r_buffer_size = packet.size;
 
 	return OK;
 }
@@ -93,12 +80,12 @@ Error WebSocketMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buff
 Error WebSocketMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
 	ERR_FAIL_COND_V_MSG(!_is_multiplayer, ERR_UNCONFIGURED, "Please use get_peer(ID).put_packet/var to communicate with peers when not using the MultiplayerAPI.");
 
-	Vector<uint8_t> buffer = _make_pkt(SYS_NONE, get_unique_id(), _target_peer, p_buffer, p_buffer_size);
+	_make_pkt(SYS_NONE, get_unique_id(), _target_peer, p_buffer, p_buffer_size);
 
 	if (is_server()) {
-		return _server_relay(1, _target_peer, &(buffer.ptr()[0]), buffer.size());
+		return _server_relay(1, _target_peer, _out_buffer.ptr(), _out_buffer.size());
 	} else {
-		return get_peer(1)->put_packet(&(buffer.ptr()[0]), buffer.size());
+		return get_peer(1)->put_packet(_out_buffer.ptr(), _out_buffer.size());
 	}
 }
 
@@ -111,9 +98,9 @@ void WebSocketMultiplayerPeer::set_target_peer(int p_target_peer) {
 
 int WebSocketMultiplayerPeer::get_packet_peer() const {
 	ERR_FAIL_COND_V_MSG(!_is_multiplayer, 1, "This function is not available when not using the MultiplayerAPI.");
-	ERR_FAIL_COND_V(_incoming_packets.size() == 0, 1);
+	ERR_FAIL_COND_V(_incoming_packets_read >= _incoming_packets.size(), 1);
 
-	return _incoming_packets.front()->get().source;
+	return _incoming_packets[_incoming_packets_read].source;
 }
 
 int WebSocketMultiplayerPeer::get_unique_id() const {
@@ -124,21 +111,19 @@ void WebSocketMultiplayerPeer::_send_sys(Ref<WebSocketPeer> p_peer, uint8_t p_ty
 	ERR_FAIL_COND(!p_peer.is_valid());
 	ERR_FAIL_COND(!p_peer->is_connected_to_host());
 
-	Vector<uint8_t> message = _make_pkt(p_type, 1, 0, (uint8_t *)&p_peer_id, 4);
-	p_peer->put_packet(&(message.ptr()[0]), message.size());
+	_make_pkt(p_type, 1, 0, (uint8_t *)&p_peer_id, 4);
+	p_peer->put_packet(_out_buffer.ptr(), _out_buffer.size());
 }
 
-Vector<uint8_t> WebSocketMultiplayerPeer::_make_pkt(uint8_t p_type, int32_t p_from, int32_t p_to, const uint8_t *p_data, uint32_t p_data_size) {
-	Vector<uint8_t> out;
-	out.resize(PROTO_SIZE + p_data_size);
+void WebSocketMultiplayerPeer::_make_pkt(uint8_t p_type, int32_t p_from, int32_t p_to, const uint8_t *p_data, uint32_t p_data_size) {
+	// Peers copy the packets they queue, so the same buffer can be used for every packet.
+	_out_buffer.resize(PROTO_SIZE + p_data_size);
 
-	uint8_t *w = out.ptrw();
+	uint8_t *w = _out_buffer.ptr();
 	memcpy(&w[0], &p_type, 1);
 	memcpy(&w[1], &p_from, 4);
 	memcpy(&w[5], &p_to, 4);
 	memcpy(&w[PROTO_SIZE], p_data, p_data_size);
-
-	return out;
 }
 
 void WebSocketMultiplayerPeer::_send_add(int32_t p_peer_id) {
@@ -171,12 +156,20 @@ void WebSocketMultiplayerPeer::_send_del(int32_t p_peer_id) {
 }
 
 void WebSocketMultiplayerPeer::_store_pkt(int32_t p_source, int32_t p_dest, const uint8_t *p_data, uint32_t p_data_size) {
+	if (_incoming_packets_read == _incoming_packets.size()) {
+		// Everything was read, start over without releasing the memory.
+		_incoming_packets.clear();
+		_incoming_payload.clear();
+		_incoming_packets_read = 0;
+	}
+
 	Packet packet;
-	packet.data = (uint8_t *)memalloc(p_data_size);
+	packet.offset = _incoming_payload.size();
 	packet.size = p_data_size;
 	packet.source = p_source;
 	packet.destination = p_dest;
-	memcpy(packet.data, &p_data[PROTO_SIZE], p_data_size);
+	_incoming_payload.resize(packet.offset + p_data_size);
+	memcpy(_incoming_payload.ptr() + packet.offset, &p_data[PROTO_SIZE], p_data_size);
 	_incoming_packets.push_back(packet);
 	emit_signal(SNAME("peer_packet"), p_source);
 }
@@ -33,14 +33,16 @@
 
 #include "core/error/error_list.h"
 #include "core/multiplayer/multiplayer_peer.h"
-#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "websocket_peer.h"
 
 class WebSocketMultiplayerPeer : public MultiplayerPeer {
 	GDCLASS(WebSocketMultiplayerPeer, MultiplayerPeer);
 
 private:
-	Vector<uint8_t> _make_pkt(uint8_t p_type, int32_t p_from, int32_t p_to, const uint8_t *p_data, uint32_t p_data_size);
+	LocalVector<uint8_t> _out_buffer; // Reused by _make_pkt.
+
+	void _make_pkt(uint8_t p_type, int32_t p_from, int32_t p_to, const uint8_t *p_data, uint32_t p_data_size);
 	void _store_pkt(int32_t p_source, int32_t p_dest, const uint8_t *p_data, uint32_t p_data_size);
 	Error _server_relay(int32_t p_from, int32_t p_to, const uint8_t *p_buffer, uint32_t p_buffer_size);
 
@@ -57,13 +59,15 @@ protected:
 	struct Packet {
 		int source = 0;
 		int destination = 0;
-		uint8_t *data = nullptr;
+		uint32_t offset = 0; // In _incoming_payload.
 		uint32_t size = 0;
 	};
 
-	List<Packet> _incoming_packets;
+	// Payloads are packed one after the other, and both vectors are only emptied (keeping their capacity) once every packet was read.
+	LocalVector<Packet> _incoming_packets;
+	LocalVector<uint8_t> _incoming_payload;
+	uint32_t _incoming_packets_read = 0;
 	HashMap<int, Ref<WebSocketPeer>> _peer_map;
-	Packet _current_packet;
 
 	bool _is_multiplayer = false;
 	int _target_peer = 0;
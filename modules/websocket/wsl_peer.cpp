@@ -266,11 +266,11 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 		return ERR_UNAVAILABLE;
 	}
 
+	// Only copies when the packet wraps around the end of the ring buffer, which is only written to during poll.
 	int read = 0;
-	uint8_t *rw = _packet_buffer.ptrw();
-	_in_buffer.read_packet(rw, _packet_buffer.size(), &_is_string, read);
+	Error err = _in_buffer.read_packet_view(r_buffer, _packet_buffer.ptrw(), _packet_buffer.size(), &_is_string, read);
+	ERR_FAIL_COND_V(err != OK, err);
 
-	*r_buffer = rw;
 	r_buffer_size = read;
 
 	return OK;
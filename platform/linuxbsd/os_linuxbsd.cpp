@@ -52,6 +52,10 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
 #ifdef FONTCONFIG_ENABLED
 #include <fontconfig/fontconfig.h>
 #endif
@@ -174,6 +178,13 @@ void OS_LinuxBSD::finalize() {
 		memdelete(joypad);
 	}
 #endif
+
+#ifdef __linux__
+	if (inotify_fd != -1) {
+		close(inotify_fd);
+		inotify_fd = -1;
+	}
+#endif
 }
 
 MainLoop *OS_LinuxBSD::get_main_loop() const {
@@ -718,6 +729,81 @@ Error OS_LinuxBSD::move_to_trash(const String &p_path) {
 	return OK;
 }
 
+#ifdef __linux__
+bool OS_LinuxBSD::watch_directory(const String &p_path) {
+	MutexLock lock(watch_mutex);
+	if (inotify_fd == -1) {
+		inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		ERR_FAIL_COND_V_MSG(inotify_fd == -1, false, "Could not initialize inotify.");
+	}
+
+	String path = p_path.rstrip("/");
+	int wd = inotify_add_watch(inotify_fd, path.utf8().get_data(), IN_ONLYDIR | IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+	if (wd == -1) {
+		// Usually out of watches (see /proc/sys/fs/inotify/max_user_watches).
+		return false;
+	}
+	watched_dirs[wd] = path;
+	return true;
+}
+
+void OS_LinuxBSD::clear_directory_watches() {
+	MutexLock lock(watch_mutex);
+	if (inotify_fd != -1) {
+		close(inotify_fd); // Removes all the watches.
+		inotify_fd = -1;
+	}
+	watched_dirs.clear();
+}
+
+bool OS_LinuxBSD::get_directory_changes(List<String> *r_dirs) {
+	MutexLock lock(watch_mutex);
+	if (inotify_fd == -1) {
+		return false;
+	}
+
+	bool complete = true;
+	HashSet<int> changed;
+	HashSet<int> removed;
+	alignas(struct inotify_event) char buffer[4096];
+	while (true) {
+		ssize_t len = read(inotify_fd, buffer, sizeof(buffer));
+		if (len <= 0) {
+			break; // EAGAIN, all events were read.
+		}
+		for (ssize_t ofs = 0; ofs < len;) {
+			const struct inotify_event *event = (const struct inotify_event *)(buffer + ofs);
+			ofs += sizeof(struct inotify_event) + event->len;
+
+			if (event->mask & IN_Q_OVERFLOW) {
+				complete = false;
+				continue;
+			}
+			if (event->wd < 0 || !watched_dirs.has(event->wd)) {
+				continue;
+			}
+			changed.insert(event->wd);
+			if (event->mask & IN_MOVE_SELF) {
+				// The watch follows the directory, so its path is no longer known.
+				complete = false;
+			}
+			if (event->mask & IN_IGNORED) {
+				// Directory removed, the kernel dropped the watch.
+				removed.insert(event->wd);
+			}
+		}
+	}
+
+	for (const int &wd : changed) {
+		r_dirs->push_back(watched_dirs[wd]);
+	}
+	for (const int &wd : removed) {
+		watched_dirs.erase(wd);
+	}
+	return complete;
+}
+#endif
+
 OS_LinuxBSD::OS_LinuxBSD() {
 	main_loop = nullptr;
 	force_quit = false;
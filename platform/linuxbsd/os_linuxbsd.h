@@ -65,6 +65,12 @@ class OS_LinuxBSD : public OS_Unix {
 
 	MainLoop *main_loop = nullptr;
 
+#ifdef __linux__
+	int inotify_fd = -1;
+	HashMap<int, String> watched_dirs;
+	Mutex watch_mutex;
+#endif
+
 protected:
 	virtual void initialize() override;
 	virtual void finalize() override;
@@ -105,6 +111,12 @@ public:
 
 	virtual Error move_to_trash(const String &p_path) override;
 
+#ifdef __linux__
+	virtual bool watch_directory(const String &p_path) override;
+	virtual void clear_directory_watches() override;
+	virtual bool get_directory_changes(List<String> *r_dirs) override;
+#endif
+
 	OS_LinuxBSD();
 };
 
@@ -30,6 +30,7 @@
 
 #include "cpu_particles_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/core_string_names.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/particles_material.h"
@@ -648,41 +649,78 @@ void CPUParticles2D::_particles_process(double p_delta) {
 		velocity_xform[2] = Vector2();
 	}
 
-	double system_phase = time / lifetime;
+	ProcessFrame frame;
+	frame.delta = p_delta;
+	frame.prev_time = prev_time;
+	frame.system_phase = time / lifetime;
+	frame.emission_xform = emission_xform;
+	frame.velocity_xform = velocity_xform;
+	frame.particles = parray;
+	frame.particle_count = pcount;
+	frame.seed = Math::rand();
+
+	// Gradients sort their points lazily, make sure it happens before they are sampled from several threads.
+	if (color_ramp.is_valid()) {
+		(void)color_ramp->get_color_at_offset(0.0);
+	}
+	if (color_initial_ramp.is_valid()) {
+		(void)color_initial_ramp->get_color_at_offset(0.0);
+	}
+
+	uint32_t chunk_count = (pcount + PROCESS_CHUNK_SIZE - 1) / PROCESS_CHUNK_SIZE;
+	// Nodes processed in a sub-thread group already run on the pool, where waiting for a nested group can deadlock it.
+	if (chunk_count > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_particles_process_chunk, &frame, chunk_count, -1, true, SNAME("CPUParticles2DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			_particles_process_chunk(i, &frame);
+		}
+	}
+}
+
+void CPUParticles2D::_particles_process_chunk(uint32_t p_chunk, const ProcessFrame *p_frame) {
+	// Each chunk gets its own generator, so the results don't depend on how chunks are scheduled.
+	RandomPCG rng(p_frame->seed + p_chunk);
+	int from = p_chunk * PROCESS_CHUNK_SIZE;
+	int to = MIN(from + PROCESS_CHUNK_SIZE, p_frame->particle_count);
+	_particles_process_range(from, to, *p_frame, rng);
+}
 
-	for (int i = 0; i < pcount; i++) {
-		Particle &p = parray[i];
+void CPUParticles2D::_particles_process_range(int p_from, int p_to, const ProcessFrame &p_frame, RandomPCG &r_rng) {
+	for (int i = p_from; i < p_to; i++) {
+		Particle &p = p_frame.particles[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		double local_delta = p_delta;
+		double local_delta = p_frame.delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
 		// original shader code, and we later multiply by lifetime to get the time.
-		double restart_phase = double(i) / double(pcount);
+		double restart_phase = double(i) / double(p_frame.particle_count);
 
 		if (randomness_ratio > 0.0) {
 			uint32_t seed = cycle;
-			if (restart_phase >= system_phase) {
+			if (restart_phase >= p_frame.system_phase) {
 				seed -= uint32_t(1);
 			}
-			seed *= uint32_t(pcount);
+			seed *= uint32_t(p_frame.particle_count);
 			seed += uint32_t(i);
 			double random = double(idhash(seed) % uint32_t(65536)) / 65536.0;
-			restart_phase += randomness_ratio * random * 1.0 / double(pcount);
+			restart_phase += randomness_ratio * random * 1.0 / double(p_frame.particle_count);
 		}
 
 		restart_phase *= (1.0 - explosiveness_ratio);
 		double restart_time = restart_phase * lifetime;
 		bool restart = false;
 
-		if (time > prev_time) {
+		if (time > p_frame.prev_time) {
 			// restart_time >= prev_time is used so particles emit in the first frame they are processed
 
-			if (restart_time >= prev_time && restart_time < time) {
+			if (restart_time >= p_frame.prev_time && restart_time < time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = time - restart_time;
@@ -690,7 +728,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			}
 
 		} else if (local_delta > 0.0) {
-			if (restart_time >= prev_time) {
+			if (restart_time >= p_frame.prev_time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = lifetime - restart_time + time;
@@ -732,22 +770,22 @@ void CPUParticles2D::_particles_process(double p_delta) {
 				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(tv);
 			}
 
-			p.seed = Math::rand();
+			p.seed = r_rng.rand();
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = r_rng.randf();
+			p.scale_rand = r_rng.randf();
+			p.hue_rot_rand = r_rng.randf();
+			p.anim_offset_rand = r_rng.randf();
 
 			if (color_initial_ramp.is_valid()) {
-				p.start_color_rand = color_initial_ramp->get_color_at_offset(Math::randf());
+				p.start_color_rand = color_initial_ramp->get_color_at_offset(r_rng.randf());
 			} else {
 				p.start_color_rand = Color(1, 1, 1, 1);
 			}
 
-			real_t angle1_rad = direction.angle() + Math::deg2rad((Math::randf() * 2.0 - 1.0) * spread);
+			real_t angle1_rad = direction.angle() + Math::deg2rad((r_rng.randf() * 2.0 - 1.0) * spread);
 			Vector2 rot = Vector2(Math::cos(angle1_rad), Math::sin(angle1_rad));
-			p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)Math::randf());
+			p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)r_rng.randf());
 
 			real_t base_angle = tex_angle * Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
 			p.rotation = Math::deg2rad(base_angle);
@@ -758,7 +796,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			p.custom[3] = 0.0;
 			p.transform = Transform2D();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - r_rng.randf() * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -766,17 +804,17 @@ void CPUParticles2D::_particles_process(double p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t t = Math_TAU * Math::randf();
-					real_t radius = emission_sphere_radius * Math::randf();
+					real_t t = Math_TAU * r_rng.randf();
+					real_t radius = emission_sphere_radius * r_rng.randf();
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_SPHERE_SURFACE: {
-					real_t s = Math::randf(), t = Math_TAU * Math::randf();
+					real_t s = r_rng.randf(), t = Math_TAU * r_rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_RECTANGLE: {
-					p.transform[2] = Vector2(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_rect_extents;
+					p.transform[2] = Vector2(r_rng.randf() * 2.0 - 1.0, r_rng.randf() * 2.0 - 1.0) * emission_rect_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -785,7 +823,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = r_rng.rand() % pc;
 
 					p.transform[2] = emission_points.get(random_idx);
 
@@ -807,8 +845,8 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			}
 
 			if (!local_coords) {
-				p.velocity = velocity_xform.xform(p.velocity);
-				p.transform = emission_xform * p.transform;
+				p.velocity = p_frame.velocity_xform.xform(p.velocity);
+				p.transform = p_frame.emission_xform * p.transform;
 			}
 
 		} else if (!p.active) {
@@ -878,7 +916,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(alt_seed)) : Vector2();
 			//apply radial acceleration
-			Vector2 org = emission_xform[2];
+			Vector2 org = p_frame.emission_xform[2];
 			Vector2 diff = pos - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(alt_seed)) : Vector2();
 			//apply tangential acceleration;
@@ -31,6 +31,7 @@
 #ifndef CPU_PARTICLES_2D_H
 #define CPU_PARTICLES_2D_H
 
+#include "core/math/random_pcg.h"
 #include "scene/2d/node_2d.h"
 
 class CPUParticles2D : public Node2D {
@@ -177,7 +178,24 @@ private:
 	Vector2 gravity = Vector2(0, 980);
 
 	void _update_internal();
+	enum {
+		PROCESS_CHUNK_SIZE = 256,
+	};
+
+	struct ProcessFrame {
+		double delta = 0.0;
+		double prev_time = 0.0;
+		double system_phase = 0.0;
+		Transform2D emission_xform;
+		Transform2D velocity_xform;
+		Particle *particles = nullptr;
+		int particle_count = 0;
+		uint32_t seed = 0;
+	};
+
 	void _particles_process(double p_delta);
+	void _particles_process_chunk(uint32_t p_chunk, const ProcessFrame *p_frame);
+	void _particles_process_range(int p_from, int p_to, const ProcessFrame &p_frame, RandomPCG &r_rng);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
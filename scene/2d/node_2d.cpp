@@ -389,6 +389,24 @@ bool Node2D::is_y_sort_enabled() const {
 	return y_sort_enabled;
 }
 
+void Node2D::_notification(int p_notification) {
+	switch (p_notification) {
+		case NOTIFICATION_ENTER_TREE: {
+			// Start from the transform it enters with, instead of being interpolated from wherever it was before.
+			RS::get_singleton()->canvas_item_set_interpolated(get_canvas_item(), is_physics_interpolated());
+			RS::get_singleton()->canvas_item_reset_physics_interpolation(get_canvas_item());
+		} break;
+
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			RS::get_singleton()->canvas_item_reset_physics_interpolation(get_canvas_item());
+		} break;
+	}
+}
+
+void Node2D::_physics_interpolated_changed() {
+	RS::get_singleton()->canvas_item_set_interpolated(get_canvas_item(), is_physics_interpolated());
+}
+
 void Node2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_position", "position"), &Node2D::set_position);
 	ClassDB::bind_method(D_METHOD("set_rotation", "radians"), &Node2D::set_rotation);
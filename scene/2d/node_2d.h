@@ -53,6 +53,9 @@ class Node2D : public CanvasItem {
 	void _update_xform_values();
 
 protected:
+	void _notification(int p_notification);
+	virtual void _physics_interpolated_changed() override;
+
 	static void _bind_methods();
 
 public:
@@ -770,6 +770,20 @@ HashMap<Vector2i, TileMapQuadrant>::Iterator TileMap::_create_quadrant(int p_lay
 void TileMap::_make_quadrant_dirty(HashMap<Vector2i, TileMapQuadrant>::Iterator Q) {
 	// Make the given quadrant dirty, then trigger an update later.
 	TileMapQuadrant &q = Q->value;
+	q.all_cells_dirty = true;
+	q.dirty_cells.clear();
+	if (!q.dirty_list_element.in_list()) {
+		layers[q.layer].dirty_quadrant_list.add(&q.dirty_list_element);
+	}
+	_queue_update_dirty_quadrants();
+}
+
+void TileMap::_make_quadrant_cell_dirty(HashMap<Vector2i, TileMapQuadrant>::Iterator Q, const Vector2i &p_cell) {
+	// Make a single cell of the given quadrant dirty, then trigger an update later.
+	TileMapQuadrant &q = Q->value;
+	if (!q.all_cells_dirty) {
+		q.dirty_cells.insert(p_cell);
+	}
 	if (!q.dirty_list_element.in_list()) {
 		layers[q.layer].dirty_quadrant_list.add(&q.dirty_list_element);
 	}
@@ -780,6 +794,8 @@ void TileMap::_make_all_quadrants_dirty() {
 	// Make all quandrants dirty, then trigger an update later.
 	for (unsigned int layer = 0; layer < layers.size(); layer++) {
 		for (KeyValue<Vector2i, TileMapQuadrant> &E : layers[layer].quadrant_map) {
+			E.value.all_cells_dirty = true;
+			E.value.dirty_cells.clear();
 			if (!E.value.dirty_list_element.in_list()) {
 				layers[layer].dirty_quadrant_list.add(&E.value.dirty_list_element);
 			}
@@ -846,9 +862,13 @@ void TileMap::_update_dirty_quadrants() {
 		// Clear the list
 		while (dirty_quadrant_list.first()) {
 			// Clear the runtime tile data.
-			for (const KeyValue<Vector2i, TileData *> &kv : dirty_quadrant_list.first()->self()->runtime_tile_data_cache) {
+			TileMapQuadrant *q = dirty_quadrant_list.first()->self();
+			for (const KeyValue<Vector2i, TileData *> &kv : q->runtime_tile_data_cache) {
 				memdelete(kv.value);
 			}
+			q->runtime_tile_data_cache.clear();
+			q->all_cells_dirty = false;
+			q->dirty_cells.clear();
 
 			dirty_quadrant_list.remove(dirty_quadrant_list.first());
 		}
@@ -1403,11 +1423,13 @@ void TileMap::_physics_notification(int p_what) {
 					for (KeyValue<Vector2i, TileMapQuadrant> &E : layers[layer].quadrant_map) {
 						TileMapQuadrant &q = E.value;
 
-						for (RID body : q.bodies) {
+						for (const KeyValue<Vector2i, Vector<RID>> &E_cell : q.bodies) {
 							Transform2D xform;
-							xform.set_origin(map_to_world(bodies_coords[body]));
+							xform.set_origin(map_to_world(E_cell.key));
 							xform = global_transform * xform;
-							PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+							for (const RID &body : E_cell.value) {
+								PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+							}
 						}
 					}
 				}
@@ -1426,12 +1448,14 @@ void TileMap::_physics_notification(int p_what) {
 					for (KeyValue<Vector2i, TileMapQuadrant> &E : layers[layer].quadrant_map) {
 						TileMapQuadrant &q = E.value;
 
-						for (RID body : q.bodies) {
+						for (const KeyValue<Vector2i, Vector<RID>> &E_cell : q.bodies) {
 							Transform2D xform;
-							xform.set_origin(map_to_world(bodies_coords[body]));
+							xform.set_origin(map_to_world(E_cell.key));
 							xform = new_transform * xform;
 
-							PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+							for (const RID &body : E_cell.value) {
+								PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+							}
 						}
 					}
 				}
@@ -1452,103 +1476,128 @@ void TileMap::_physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r
 	Transform2D global_transform = get_global_transform();
 	last_valid_transform = global_transform;
 	new_transform = global_transform;
-	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 	RID space = get_world_2d()->get_space();
 
 	SelfList<TileMapQuadrant> *q_list_element = r_dirty_quadrant_list.first();
 	while (q_list_element) {
 		TileMapQuadrant &q = *q_list_element->self();
 
-		// Clear bodies.
-		for (RID body : q.bodies) {
-			bodies_coords.erase(body);
-			ps->free(body);
+		if (q.all_cells_dirty) {
+			// Clear and recreate all the bodies.
+			_physics_cleanup_quadrant(&q);
+			for (const Vector2i &E_cell : q.cells) {
+				_physics_create_cell(q, E_cell, global_transform, space);
+			}
+		} else {
+			// Only recreate the bodies of the changed cells.
+			for (const Vector2i &E_cell : q.dirty_cells) {
+				_physics_clear_cell(q, E_cell);
+				if (q.cells.has(E_cell)) {
+					_physics_create_cell(q, E_cell, global_transform, space);
+				}
+			}
 		}
-		q.bodies.clear();
 
-		// Recreate bodies and shapes.
-		for (const Vector2i &E_cell : q.cells) {
-			TileMapCell c = get_cell(q.layer, E_cell, true);
+		q_list_element = q_list_element->next();
+	}
+}
 
-			TileSetSource *source;
-			if (tile_set->has_source(c.source_id)) {
-				source = *tile_set->get_source(c.source_id);
+void TileMap::_physics_create_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell, const Transform2D &p_global_transform, RID p_space) {
+	TileMapCell c = get_cell(r_quadrant.layer, p_cell, true);
 
-				if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-					continue;
-				}
+	if (!tile_set->has_source(c.source_id)) {
+		return;
+	}
+	TileSetSource *source = *tile_set->get_source(c.source_id);
 
-				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-				if (atlas_source) {
-					const TileData *tile_data;
-					if (q.runtime_tile_data_cache.has(E_cell)) {
-						tile_data = q.runtime_tile_data_cache[E_cell];
-					} else {
-						tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
-					}
-					for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-						Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-						uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-						uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
+	if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+		return;
+	}
 
-						// Create the body.
-						RID body = ps->body_create();
-						bodies_coords[body] = E_cell;
-						ps->body_set_mode(body, collision_animatable ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
+	TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+	if (!atlas_source) {
+		return;
+	}
 
-						Transform2D xform;
-						xform.set_origin(map_to_world(E_cell));
-						xform = global_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (!physics_material.is_valid()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
-						}
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
-						q.bodies.push_back(body);
-
-						// Add the shapes to the body.
-						int body_shape_index = 0;
-						for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
-							// Iterate over the polygons.
-							bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
-							float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
-							int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
-							for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
-								// Add decomposed convex shapes.
-								Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
-								ps->body_add_shape(body, shape->get_rid());
-								ps->body_set_shape_as_one_way_collision(body, body_shape_index, one_way_collision, one_way_collision_margin);
-
-								body_shape_index++;
-							}
-						}
-					}
-				}
+	const TileData *tile_data;
+	if (r_quadrant.runtime_tile_data_cache.has(p_cell)) {
+		tile_data = r_quadrant.runtime_tile_data_cache[p_cell];
+	} else {
+		tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+	}
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
+		uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
+		uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
+
+		// Create the body.
+		RID body = ps->body_create();
+		bodies_coords[body] = p_cell;
+		ps->body_set_mode(body, collision_animatable ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+		ps->body_set_space(body, p_space);
+
+		Transform2D xform;
+		xform.set_origin(map_to_world(p_cell));
+		xform = p_global_transform * xform;
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+
+		ps->body_attach_object_instance_id(body, get_instance_id());
+		ps->body_set_collision_layer(body, physics_layer);
+		ps->body_set_collision_mask(body, physics_mask);
+		ps->body_set_pickable(body, false);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
+
+		if (!physics_material.is_valid()) {
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+		} else {
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+		}
+
+		r_quadrant.bodies[p_cell].push_back(body);
+
+		// Add the shapes to the body.
+		int body_shape_index = 0;
+		for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+			// Iterate over the polygons.
+			bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+			float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+			int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+			for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+				// Add decomposed convex shapes.
+				Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+				ps->body_add_shape(body, shape->get_rid());
+				ps->body_set_shape_as_one_way_collision(body, body_shape_index, one_way_collision, one_way_collision_margin);
+
+				body_shape_index++;
 			}
 		}
+	}
+}
 
-		q_list_element = q_list_element->next();
+void TileMap::_physics_clear_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell) {
+	HashMap<Vector2i, Vector<RID>>::Iterator E = r_quadrant.bodies.find(p_cell);
+	if (!E) {
+		return;
 	}
+	for (const RID &body : E->value) {
+		bodies_coords.erase(body);
+		PhysicsServer2D::get_singleton()->free(body);
+	}
+	r_quadrant.bodies.remove(E);
 }
 
 void TileMap::_physics_cleanup_quadrant(TileMapQuadrant *p_quadrant) {
 	// Remove a quadrant.
-	for (RID body : p_quadrant->bodies) {
-		bodies_coords.erase(body);
-		PhysicsServer2D::get_singleton()->free(body);
+	for (const KeyValue<Vector2i, Vector<RID>> &E : p_quadrant->bodies) {
+		for (const RID &body : E.value) {
+			bodies_coords.erase(body);
+			PhysicsServer2D::get_singleton()->free(body);
+		}
 	}
 	p_quadrant->bodies.clear();
 }
@@ -1589,20 +1638,22 @@ void TileMap::_physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant) {
 	qudrant_xform.set_origin(quadrant_pos);
 	Transform2D global_transform_inv = (get_global_transform() * qudrant_xform).affine_inverse();
 
-	for (RID body : p_quadrant->bodies) {
-		Transform2D xform = Transform2D(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM)) * global_transform_inv;
-		rs->canvas_item_add_set_transform(p_quadrant->debug_canvas_item, xform);
-		for (int shape_index = 0; shape_index < ps->body_get_shape_count(body); shape_index++) {
-			const RID &shape = ps->body_get_shape(body, shape_index);
-			PhysicsServer2D::ShapeType type = ps->shape_get_type(shape);
-			if (type == PhysicsServer2D::SHAPE_CONVEX_POLYGON) {
-				Vector<Vector2> polygon = ps->shape_get_data(shape);
-				rs->canvas_item_add_polygon(p_quadrant->debug_canvas_item, polygon, color);
-			} else {
-				WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON.");
+	for (const KeyValue<Vector2i, Vector<RID>> &E_cell : p_quadrant->bodies) {
+		for (const RID &body : E_cell.value) {
+			Transform2D xform = Transform2D(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM)) * global_transform_inv;
+			rs->canvas_item_add_set_transform(p_quadrant->debug_canvas_item, xform);
+			for (int shape_index = 0; shape_index < ps->body_get_shape_count(body); shape_index++) {
+				const RID &shape = ps->body_get_shape(body, shape_index);
+				PhysicsServer2D::ShapeType type = ps->shape_get_type(shape);
+				if (type == PhysicsServer2D::SHAPE_CONVEX_POLYGON) {
+					Vector<Vector2> polygon = ps->shape_get_data(shape);
+					rs->canvas_item_add_polygon(p_quadrant->debug_canvas_item, polygon, color);
+				} else {
+					WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON.");
+				}
 			}
+			rs->canvas_item_add_set_transform(p_quadrant->debug_canvas_item, Transform2D());
 		}
-		rs->canvas_item_add_set_transform(p_quadrant->debug_canvas_item, Transform2D());
 	}
 };
 
@@ -1638,74 +1689,88 @@ void TileMap::_navigation_update_dirty_quadrants(SelfList<TileMapQuadrant>::List
 	ERR_FAIL_COND(!is_inside_tree());
 	ERR_FAIL_COND(!tile_set.is_valid());
 
-	// Get colors for debug.
-	SceneTree *st = SceneTree::get_singleton();
-	Color debug_navigation_color;
-	bool debug_navigation = st && st->is_debugging_navigation_hint();
-	if (debug_navigation) {
-		debug_navigation_color = st->get_debug_navigation_color();
-	}
-
 	Transform2D tilemap_xform = get_global_transform();
+	RID navigation_map = get_world_2d()->get_navigation_map();
 	SelfList<TileMapQuadrant> *q_list_element = r_dirty_quadrant_list.first();
 	while (q_list_element) {
 		TileMapQuadrant &q = *q_list_element->self();
 
-		// Clear navigation shapes in the quadrant.
-		for (const KeyValue<Vector2i, Vector<RID>> &E : q.navigation_regions) {
-			for (int i = 0; i < E.value.size(); i++) {
-				RID region = E.value[i];
-				if (!region.is_valid()) {
-					continue;
+		if (q.all_cells_dirty) {
+			// Clear and recreate all the navigation regions.
+			_navigation_cleanup_quadrant(&q);
+			for (const Vector2i &E_cell : q.cells) {
+				_navigation_create_cell(q, E_cell, tilemap_xform, navigation_map);
+			}
+		} else {
+			// Only recreate the navigation regions of the changed cells.
+			for (const Vector2i &E_cell : q.dirty_cells) {
+				_navigation_clear_cell(q, E_cell);
+				if (q.cells.has(E_cell)) {
+					_navigation_create_cell(q, E_cell, tilemap_xform, navigation_map);
 				}
-				NavigationServer2D::get_singleton()->region_set_map(region, RID());
 			}
 		}
-		q.navigation_regions.clear();
 
-		// Get the navigation polygons and create regions.
-		for (const Vector2i &E_cell : q.cells) {
-			TileMapCell c = get_cell(q.layer, E_cell, true);
+		q_list_element = q_list_element->next();
+	}
+}
 
-			TileSetSource *source;
-			if (tile_set->has_source(c.source_id)) {
-				source = *tile_set->get_source(c.source_id);
+void TileMap::_navigation_create_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell, const Transform2D &p_tilemap_xform, RID p_navigation_map) {
+	TileMapCell c = get_cell(r_quadrant.layer, p_cell, true);
 
-				if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-					continue;
-				}
+	if (!tile_set->has_source(c.source_id)) {
+		return;
+	}
+	TileSetSource *source = *tile_set->get_source(c.source_id);
 
-				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-				if (atlas_source) {
-					const TileData *tile_data;
-					if (q.runtime_tile_data_cache.has(E_cell)) {
-						tile_data = q.runtime_tile_data_cache[E_cell];
-					} else {
-						tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
-					}
-					q.navigation_regions[E_cell].resize(tile_set->get_navigation_layers_count());
+	if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+		return;
+	}
 
-					for (int layer_index = 0; layer_index < tile_set->get_navigation_layers_count(); layer_index++) {
-						Ref<NavigationPolygon> navpoly;
-						navpoly = tile_data->get_navigation_polygon(layer_index);
+	TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+	if (!atlas_source) {
+		return;
+	}
 
-						if (navpoly.is_valid()) {
-							Transform2D tile_transform;
-							tile_transform.set_origin(map_to_world(E_cell));
+	const TileData *tile_data;
+	if (r_quadrant.runtime_tile_data_cache.has(p_cell)) {
+		tile_data = r_quadrant.runtime_tile_data_cache[p_cell];
+	} else {
+		tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+	}
+	Vector<RID> &regions = r_quadrant.navigation_regions[p_cell];
+	regions.resize(tile_set->get_navigation_layers_count());
 
-							RID region = NavigationServer2D::get_singleton()->region_create();
-							NavigationServer2D::get_singleton()->region_set_map(region, get_world_2d()->get_navigation_map());
-							NavigationServer2D::get_singleton()->region_set_transform(region, tilemap_xform * tile_transform);
-							NavigationServer2D::get_singleton()->region_set_navpoly(region, navpoly);
-							q.navigation_regions[E_cell].write[layer_index] = region;
-						}
-					}
-				}
-			}
+	for (int layer_index = 0; layer_index < tile_set->get_navigation_layers_count(); layer_index++) {
+		Ref<NavigationPolygon> navpoly;
+		navpoly = tile_data->get_navigation_polygon(layer_index);
+
+		if (navpoly.is_valid()) {
+			Transform2D tile_transform;
+			tile_transform.set_origin(map_to_world(p_cell));
+
+			RID region = NavigationServer2D::get_singleton()->region_create();
+			NavigationServer2D::get_singleton()->region_set_map(region, p_navigation_map);
+			NavigationServer2D::get_singleton()->region_set_transform(region, p_tilemap_xform * tile_transform);
+			NavigationServer2D::get_singleton()->region_set_navpoly(region, navpoly);
+			regions.write[layer_index] = region;
 		}
+	}
+}
 
-		q_list_element = q_list_element->next();
+void TileMap::_navigation_clear_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell) {
+	HashMap<Vector2i, Vector<RID>>::Iterator E = r_quadrant.navigation_regions.find(p_cell);
+	if (!E) {
+		return;
 	}
+	for (int i = 0; i < E->value.size(); i++) {
+		RID region = E->value[i];
+		if (!region.is_valid()) {
+			continue;
+		}
+		NavigationServer2D::get_singleton()->free(region);
+	}
+	r_quadrant.navigation_regions.remove(E);
 }
 
 void TileMap::_navigation_cleanup_quadrant(TileMapQuadrant *p_quadrant) {
@@ -1817,51 +1882,68 @@ void TileMap::_scenes_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_
 	while (q_list_element) {
 		TileMapQuadrant &q = *q_list_element->self();
 
-		// Clear the scenes.
-		for (const KeyValue<Vector2i, String> &E : q.scenes) {
-			Node *node = get_node_or_null(E.value);
-			if (node) {
-				node->queue_delete();
+		if (q.all_cells_dirty) {
+			// Clear and recreate all the scenes.
+			_scenes_cleanup_quadrant(&q);
+			for (const Vector2i &E_cell : q.cells) {
+				_scenes_create_cell(q, E_cell);
+			}
+		} else {
+			// Only recreate the scenes of the changed cells, the others keep their state.
+			for (const Vector2i &E_cell : q.dirty_cells) {
+				_scenes_clear_cell(q, E_cell);
+				if (q.cells.has(E_cell)) {
+					_scenes_create_cell(q, E_cell);
+				}
 			}
 		}
 
-		q.scenes.clear();
+		q_list_element = q_list_element->next();
+	}
+}
 
-		// Recreate the scenes.
-		for (const Vector2i &E_cell : q.cells) {
-			const TileMapCell &c = get_cell(q.layer, E_cell, true);
+void TileMap::_scenes_create_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell) {
+	const TileMapCell &c = get_cell(r_quadrant.layer, p_cell, true);
 
-			TileSetSource *source;
-			if (tile_set->has_source(c.source_id)) {
-				source = *tile_set->get_source(c.source_id);
+	if (!tile_set->has_source(c.source_id)) {
+		return;
+	}
+	TileSetSource *source = *tile_set->get_source(c.source_id);
 
-				if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-					continue;
-				}
+	if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+		return;
+	}
 
-				TileSetScenesCollectionSource *scenes_collection_source = Object::cast_to<TileSetScenesCollectionSource>(source);
-				if (scenes_collection_source) {
-					Ref<PackedScene> packed_scene = scenes_collection_source->get_scene_tile_scene(c.alternative_tile);
-					if (packed_scene.is_valid()) {
-						Node *scene = packed_scene->instantiate();
-						add_child(scene);
-						Control *scene_as_control = Object::cast_to<Control>(scene);
-						Node2D *scene_as_node2d = Object::cast_to<Node2D>(scene);
-						if (scene_as_control) {
-							scene_as_control->set_position(map_to_world(E_cell) + scene_as_control->get_position());
-						} else if (scene_as_node2d) {
-							Transform2D xform;
-							xform.set_origin(map_to_world(E_cell));
-							scene_as_node2d->set_transform(xform * scene_as_node2d->get_transform());
-						}
-						q.scenes[E_cell] = scene->get_name();
-					}
-				}
+	TileSetScenesCollectionSource *scenes_collection_source = Object::cast_to<TileSetScenesCollectionSource>(source);
+	if (scenes_collection_source) {
+		Ref<PackedScene> packed_scene = scenes_collection_source->get_scene_tile_scene(c.alternative_tile);
+		if (packed_scene.is_valid()) {
+			Node *scene = packed_scene->instantiate();
+			add_child(scene);
+			Control *scene_as_control = Object::cast_to<Control>(scene);
+			Node2D *scene_as_node2d = Object::cast_to<Node2D>(scene);
+			if (scene_as_control) {
+				scene_as_control->set_position(map_to_world(p_cell) + scene_as_control->get_position());
+			} else if (scene_as_node2d) {
+				Transform2D xform;
+				xform.set_origin(map_to_world(p_cell));
+				scene_as_node2d->set_transform(xform * scene_as_node2d->get_transform());
 			}
+			r_quadrant.scenes[p_cell] = scene->get_name();
 		}
+	}
+}
 
-		q_list_element = q_list_element->next();
+void TileMap::_scenes_clear_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell) {
+	HashMap<Vector2i, String>::Iterator E = r_quadrant.scenes.find(p_cell);
+	if (!E) {
+		return;
 	}
+	Node *node = get_node_or_null(E->value);
+	if (node) {
+		node->queue_delete();
+	}
+	r_quadrant.scenes.remove(E);
 }
 
 void TileMap::_scenes_cleanup_quadrant(TileMapQuadrant *p_quadrant) {
@@ -1967,7 +2049,7 @@ void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, c
 		if (q.cells.size() == 0) {
 			_erase_quadrant(Q);
 		} else {
-			_make_quadrant_dirty(Q);
+			_make_quadrant_cell_dirty(Q, pk);
 		}
 
 		used_rect_cache_dirty = true;
@@ -1997,7 +2079,7 @@ void TileMap::set_cell(int p_layer, const Vector2i &p_coords, int p_source_id, c
 		c.set_atlas_coords(atlas_coords);
 		c.alternative_tile = alternative_tile;
 
-		_make_quadrant_dirty(Q);
+		_make_quadrant_cell_dirty(Q, pk);
 		used_rect_cache_dirty = true;
 	}
 }
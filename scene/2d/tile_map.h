@@ -52,6 +52,11 @@ struct TileMapQuadrant {
 	// Dirty list element
 	SelfList<TileMapQuadrant> dirty_list_element;
 
+	// When only some cells changed since the last update, the physics, navigation and scenes of the
+	// other cells are kept as they are.
+	bool all_cells_dirty = true;
+	HashSet<Vector2i> dirty_cells;
+
 	// Quadrant layer and coords.
 	int layer = -1;
 	Vector2i coords;
@@ -71,7 +76,7 @@ struct TileMapQuadrant {
 	List<RID> occluders;
 
 	// Physics.
-	List<RID> bodies;
+	HashMap<Vector2i, Vector<RID>> bodies;
 
 	// Navigation.
 	HashMap<Vector2i, Vector<RID>> navigation_regions;
@@ -224,6 +229,7 @@ private:
 	HashMap<Vector2i, TileMapQuadrant>::Iterator _create_quadrant(int p_layer, const Vector2i &p_qk);
 
 	void _make_quadrant_dirty(HashMap<Vector2i, TileMapQuadrant>::Iterator Q);
+	void _make_quadrant_cell_dirty(HashMap<Vector2i, TileMapQuadrant>::Iterator Q, const Vector2i &p_cell);
 	void _make_all_quadrants_dirty();
 	void _queue_update_dirty_quadrants();
 
@@ -253,15 +259,21 @@ private:
 	Transform2D new_transform;
 	void _physics_notification(int p_what);
 	void _physics_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	void _physics_create_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell, const Transform2D &p_global_transform, RID p_space);
+	void _physics_clear_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell);
 	void _physics_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _physics_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
 
 	void _navigation_notification(int p_what);
 	void _navigation_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	void _navigation_create_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell, const Transform2D &p_tilemap_xform, RID p_navigation_map);
+	void _navigation_clear_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell);
 	void _navigation_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _navigation_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
 
 	void _scenes_update_dirty_quadrants(SelfList<TileMapQuadrant>::List &r_dirty_quadrant_list);
+	void _scenes_create_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell);
+	void _scenes_clear_cell(TileMapQuadrant &r_quadrant, const Vector2i &p_cell);
 	void _scenes_cleanup_quadrant(TileMapQuadrant *p_quadrant);
 	void _scenes_draw_quadrant_debug(TileMapQuadrant *p_quadrant);
 
@@ -80,6 +80,7 @@ private:
 	bool autoplay = false;
 	StringName bus = SNAME("Master");
 	int max_polyphony = 1;
+	int voice_priority = 0;
 
 	uint64_t last_mix_count = -1;
 	bool force_update_panning = false;
@@ -152,6 +153,9 @@ public:
 	void set_max_polyphony(int p_max_polyphony);
 	int get_max_polyphony() const;
 
+	void set_voice_priority(int p_voice_priority);
+	int get_voice_priority() const;
+
 	void set_autoplay(bool p_enable);
 	bool is_autoplay_enabled();
 
@@ -30,6 +30,7 @@
 
 #include "cpu_particles_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/main/viewport.h"
@@ -670,41 +671,78 @@ void CPUParticles3D::_particles_process(double p_delta) {
 		velocity_xform = emission_xform.basis;
 	}
 
-	double system_phase = time / lifetime;
+	ProcessFrame frame;
+	frame.delta = p_delta;
+	frame.prev_time = prev_time;
+	frame.system_phase = time / lifetime;
+	frame.emission_xform = emission_xform;
+	frame.velocity_xform = velocity_xform;
+	frame.particles = parray;
+	frame.particle_count = pcount;
+	frame.seed = Math::rand();
+
+	// Gradients sort their points lazily, make sure it happens before they are sampled from several threads.
+	if (color_ramp.is_valid()) {
+		(void)color_ramp->get_color_at_offset(0.0);
+	}
+	if (color_initial_ramp.is_valid()) {
+		(void)color_initial_ramp->get_color_at_offset(0.0);
+	}
+
+	uint32_t chunk_count = (pcount + PROCESS_CHUNK_SIZE - 1) / PROCESS_CHUNK_SIZE;
+	// Nodes processed in a sub-thread group already run on the pool, where waiting for a nested group can deadlock it.
+	if (chunk_count > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_particles_process_chunk, &frame, chunk_count, -1, true, SNAME("CPUParticles3DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			_particles_process_chunk(i, &frame);
+		}
+	}
+}
+
+void CPUParticles3D::_particles_process_chunk(uint32_t p_chunk, const ProcessFrame *p_frame) {
+	// Each chunk gets its own generator, so the results don't depend on how chunks are scheduled.
+	RandomPCG rng(p_frame->seed + p_chunk);
+	int from = p_chunk * PROCESS_CHUNK_SIZE;
+	int to = MIN(from + PROCESS_CHUNK_SIZE, p_frame->particle_count);
+	_particles_process_range(from, to, *p_frame, rng);
+}
 
-	for (int i = 0; i < pcount; i++) {
-		Particle &p = parray[i];
+void CPUParticles3D::_particles_process_range(int p_from, int p_to, const ProcessFrame &p_frame, RandomPCG &r_rng) {
+	for (int i = p_from; i < p_to; i++) {
+		Particle &p = p_frame.particles[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		double local_delta = p_delta;
+		double local_delta = p_frame.delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
 		// original shader code, and we later multiply by lifetime to get the time.
-		double restart_phase = double(i) / double(pcount);
+		double restart_phase = double(i) / double(p_frame.particle_count);
 
 		if (randomness_ratio > 0.0) {
 			uint32_t seed = cycle;
-			if (restart_phase >= system_phase) {
+			if (restart_phase >= p_frame.system_phase) {
 				seed -= uint32_t(1);
 			}
-			seed *= uint32_t(pcount);
+			seed *= uint32_t(p_frame.particle_count);
 			seed += uint32_t(i);
 			double random = double(idhash(seed) % uint32_t(65536)) / 65536.0;
-			restart_phase += randomness_ratio * random * 1.0 / double(pcount);
+			restart_phase += randomness_ratio * random * 1.0 / double(p_frame.particle_count);
 		}
 
 		restart_phase *= (1.0 - explosiveness_ratio);
 		double restart_time = restart_phase * lifetime;
 		bool restart = false;
 
-		if (time > prev_time) {
+		if (time > p_frame.prev_time) {
 			// restart_time >= prev_time is used so particles emit in the first frame they are processed
 
-			if (restart_time >= prev_time && restart_time < time) {
+			if (restart_time >= p_frame.prev_time && restart_time < time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = time - restart_time;
@@ -712,7 +750,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			}
 
 		} else if (local_delta > 0.0) {
-			if (restart_time >= prev_time) {
+			if (restart_time >= p_frame.prev_time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = lifetime - restart_time + time;
@@ -754,27 +792,27 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(tv);
 			}
 
-			p.seed = Math::rand();
+			p.seed = r_rng.rand();
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = r_rng.randf();
+			p.scale_rand = r_rng.randf();
+			p.hue_rot_rand = r_rng.randf();
+			p.anim_offset_rand = r_rng.randf();
 
 			if (color_initial_ramp.is_valid()) {
-				p.start_color_rand = color_initial_ramp->get_color_at_offset(Math::randf());
+				p.start_color_rand = color_initial_ramp->get_color_at_offset(r_rng.randf());
 			} else {
 				p.start_color_rand = Color(1, 1, 1, 1);
 			}
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
-				real_t angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg2rad((Math::randf() * 2.0 - 1.0) * spread);
+				real_t angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg2rad((r_rng.randf() * 2.0 - 1.0) * spread);
 				Vector3 rot = Vector3(Math::cos(angle1_rad), Math::sin(angle1_rad), 0.0);
-				p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)Math::randf());
+				p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)r_rng.randf());
 			} else {
 				//initiate velocity spread in 3D
-				real_t angle1_rad = Math::deg2rad((Math::randf() * (real_t)2.0 - (real_t)1.0) * spread);
-				real_t angle2_rad = Math::deg2rad((Math::randf() * (real_t)2.0 - (real_t)1.0) * ((real_t)1.0 - flatness) * spread);
+				real_t angle1_rad = Math::deg2rad((r_rng.randf() * (real_t)2.0 - (real_t)1.0) * spread);
+				real_t angle2_rad = Math::deg2rad((r_rng.randf() * (real_t)2.0 - (real_t)1.0) * ((real_t)1.0 - flatness) * spread);
 
 				Vector3 direction_xz = Vector3(Math::sin(angle1_rad), 0, Math::cos(angle1_rad));
 				Vector3 direction_yz = Vector3(0, Math::sin(angle2_rad), Math::cos(angle2_rad));
@@ -794,7 +832,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				binormal.normalize();
 				Vector3 normal = binormal.cross(direction_nrm);
 				spread_direction = binormal * spread_direction.x + normal * spread_direction.y + direction_nrm * spread_direction.z;
-				p.velocity = spread_direction * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)Math::randf());
+				p.velocity = spread_direction * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], (real_t)r_rng.randf());
 			}
 
 			real_t base_angle = tex_angle * Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
@@ -803,7 +841,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand); //animation offset (0-1)
 			p.transform = Transform3D();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - r_rng.randf() * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -811,20 +849,20 @@ void CPUParticles3D::_particles_process(double p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t s = 2.0 * Math::randf() - 1.0;
-					real_t t = Math_TAU * Math::randf();
-					real_t x = Math::randf();
+					real_t s = 2.0 * r_rng.randf() - 1.0;
+					real_t t = Math_TAU * r_rng.randf();
+					real_t x = r_rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(0, 0, 0).lerp(Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s), x);
 				} break;
 				case EMISSION_SHAPE_SPHERE_SURFACE: {
-					real_t s = 2.0 * Math::randf() - 1.0;
-					real_t t = Math_TAU * Math::randf();
+					real_t s = 2.0 * r_rng.randf() - 1.0;
+					real_t t = Math_TAU * r_rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s);
 				} break;
 				case EMISSION_SHAPE_BOX: {
-					p.transform.origin = Vector3(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_box_extents;
+					p.transform.origin = Vector3(r_rng.randf() * 2.0 - 1.0, r_rng.randf() * 2.0 - 1.0, r_rng.randf() * 2.0 - 1.0) * emission_box_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -833,7 +871,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = r_rng.rand() % pc;
 
 					p.transform.origin = emission_points.get(random_idx);
 
@@ -866,8 +904,8 @@ void CPUParticles3D::_particles_process(double p_delta) {
 					}
 				} break;
 				case EMISSION_SHAPE_RING: {
-					real_t ring_random_angle = Math::randf() * Math_TAU;
-					real_t ring_random_radius = Math::randf() * (emission_ring_radius - emission_ring_inner_radius) + emission_ring_inner_radius;
+					real_t ring_random_angle = r_rng.randf() * Math_TAU;
+					real_t ring_random_radius = r_rng.randf() * (emission_ring_radius - emission_ring_inner_radius) + emission_ring_inner_radius;
 					Vector3 axis = emission_ring_axis.normalized();
 					Vector3 ortho_axis = Vector3();
 					if (axis == Vector3(1.0, 0.0, 0.0)) {
@@ -878,7 +916,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 					ortho_axis = ortho_axis.normalized();
 					ortho_axis.rotate(axis, ring_random_angle);
 					ortho_axis = ortho_axis.normalized();
-					p.transform.origin = ortho_axis * ring_random_radius + (Math::randf() * emission_ring_height - emission_ring_height / 2.0) * axis;
+					p.transform.origin = ortho_axis * ring_random_radius + (r_rng.randf() * emission_ring_height - emission_ring_height / 2.0) * axis;
 				} break;
 				case EMISSION_SHAPE_MAX: { // Max value for validity check.
 					break;
@@ -886,8 +924,8 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			}
 
 			if (!local_coords) {
-				p.velocity = velocity_xform.xform(p.velocity);
-				p.transform = emission_xform * p.transform;
+				p.velocity = p_frame.velocity_xform.xform(p.velocity);
+				p.transform = p_frame.emission_xform * p.transform;
 			}
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
@@ -966,7 +1004,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(alt_seed)) : Vector3();
 			//apply radial acceleration
-			Vector3 org = emission_xform.origin;
+			Vector3 org = p_frame.emission_xform.origin;
 			Vector3 diff = position - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(alt_seed)) : Vector3();
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
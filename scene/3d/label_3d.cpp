@@ -319,33 +319,24 @@ void Label3D::_generate_glyph_surfaces(const Glyph &p_glyph, Vector2 &r_offset,
 		SurfaceKey key = SurfaceKey(tex.get_id(), p_priority, p_outline_size);
 		if (!surfaces.has(key)) {
 			SurfaceData surf;
-			surf.material = RenderingServer::get_singleton()->material_create();
-			// Set defaults for material, names need to match up those in StandardMaterial3D
-			RS::get_singleton()->material_set_param(surf.material, "albedo", Color(1, 1, 1, 1));
-			RS::get_singleton()->material_set_param(surf.material, "specular", 0.5);
-			RS::get_singleton()->material_set_param(surf.material, "metallic", 0.0);
-			RS::get_singleton()->material_set_param(surf.material, "roughness", 1.0);
-			RS::get_singleton()->material_set_param(surf.material, "uv1_offset", Vector3(0, 0, 0));
-			RS::get_singleton()->material_set_param(surf.material, "uv1_scale", Vector3(1, 1, 1));
-			RS::get_singleton()->material_set_param(surf.material, "uv2_offset", Vector3(0, 0, 0));
-			RS::get_singleton()->material_set_param(surf.material, "uv2_scale", Vector3(1, 1, 1));
-			RS::get_singleton()->material_set_param(surf.material, "alpha_scissor_threshold", alpha_scissor_threshold);
-			if (msdf) {
-				RS::get_singleton()->material_set_param(surf.material, "msdf_pixel_range", TS->font_get_msdf_pixel_range(p_glyph.font_rid));
-				RS::get_singleton()->material_set_param(surf.material, "msdf_outline_size", p_outline_size);
-			}
 
 			RID shader_rid;
 			StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), true, get_draw_flag(FLAG_DOUBLE_SIDED), get_alpha_cut_mode() == ALPHA_CUT_DISCARD, get_alpha_cut_mode() == ALPHA_CUT_OPAQUE_PREPASS, get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, msdf, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), texture_filter, &shader_rid);
 
-			RS::get_singleton()->material_set_shader(surf.material, shader_rid);
-			RS::get_singleton()->material_set_param(surf.material, "texture_albedo", tex);
+			int priority = 0;
 			if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
-				RS::get_singleton()->material_set_render_priority(surf.material, p_priority);
+				priority = p_priority;
 			} else {
 				surf.z_shift = p_priority * pixel_size;
 			}
 
+			// Shared with the other labels (and sprites) using the same font texture and settings.
+			if (msdf) {
+				surf.material = BaseMaterial3D::acquire_material_instance_for_2d(shader_rid, tex, alpha_scissor_threshold, priority, TS->font_get_msdf_pixel_range(p_glyph.font_rid), p_outline_size);
+			} else {
+				surf.material = BaseMaterial3D::acquire_material_instance_for_2d(shader_rid, tex, alpha_scissor_threshold, priority);
+			}
+
 			surfaces[key] = surf;
 		}
 		SurfaceData &s = surfaces[key];
@@ -404,7 +395,7 @@ void Label3D::_shape() {
 
 	// Clear materials.
 	for (const KeyValue<SurfaceKey, SurfaceData> &E : surfaces) {
-		RenderingServer::get_singleton()->free(E.value.material);
+		BaseMaterial3D::release_material_instance_for_2d(E.value.material);
 	}
 	surfaces.clear();
 
@@ -941,7 +932,7 @@ Label3D::~Label3D() {
 
 	RenderingServer::get_singleton()->free(mesh);
 	for (KeyValue<SurfaceKey, SurfaceData> E : surfaces) {
-		RenderingServer::get_singleton()->free(E.value.material);
+		BaseMaterial3D::release_material_instance_for_2d(E.value.material);
 	}
 	surfaces.clear();
 }
@@ -320,6 +320,14 @@ real_t NavigationAgent3D::get_path_max_distance() {
 }
 
 void NavigationAgent3D::set_target_location(Vector3 p_location) {
+	if (navigation_path.size() > 0 && !navigation_finished && p_location.distance_to(target_location) < path_max_distance) {
+		// Keep following the current path, only its end is found again on the next update.
+		target_location = p_location;
+		target_reached = false;
+		target_moved = true;
+		return;
+	}
+
 	target_location = p_location;
 	_request_repath();
 }
@@ -409,12 +417,17 @@ void NavigationAgent3D::update_navigation() {
 	Vector3 o = agent_parent->get_global_transform().origin;
 
 	bool reload_path = false;
+	bool path_changed = false;
 
 	if (NavigationServer3D::get_singleton()->agent_is_map_changed(agent)) {
 		reload_path = true;
 	} else if (navigation_path.size() == 0) {
 		reload_path = true;
 	} else {
+		if (target_moved) {
+			reload_path = !_repath_end();
+			path_changed = true;
+		}
 		// Check if too far from the navigation path
 		if (nav_path_index > 0) {
 			Vector3 segment[2];
@@ -423,21 +436,24 @@ void NavigationAgent3D::update_navigation() {
 			segment[0].y -= navigation_height_offset;
 			segment[1].y -= navigation_height_offset;
 			Vector3 p = Geometry3D::get_closest_point_to_segment(o, segment);
-			if (o.distance_to(p) >= path_max_distance) {
-				// To faraway, reload path
-				reload_path = true;
+			if (!reload_path && o.distance_to(p) >= path_max_distance) {
+				// To faraway, find the way back to the path, or reload it.
+				reload_path = !_repath_rejoin(o);
+				path_changed = true;
 			}
 		}
 	}
 
+	target_moved = false;
+
 	if (reload_path) {
-		if (map_override.is_valid()) {
-			navigation_path = NavigationServer3D::get_singleton()->map_get_path(map_override, o, target_location, true, navigation_layers);
-		} else {
-			navigation_path = NavigationServer3D::get_singleton()->map_get_path(agent_parent->get_world_3d()->get_navigation_map(), o, target_location, true, navigation_layers);
-		}
+		navigation_path = _query_path(o, target_location);
 		navigation_finished = false;
 		nav_path_index = 0;
+		path_changed = true;
+	}
+
+	if (path_changed) {
 		emit_signal(SNAME("path_changed"));
 	}
 
@@ -465,9 +481,49 @@ void NavigationAgent3D::_request_repath() {
 	navigation_path.clear();
 	target_reached = false;
 	navigation_finished = false;
+	target_moved = false;
 	update_frame_id = 0;
 }
 
+Vector<Vector3> NavigationAgent3D::_query_path(const Vector3 &p_from, const Vector3 &p_to) const {
+	return NavigationServer3D::get_singleton()->map_get_path(get_navigation_map(), p_from, p_to, true, navigation_layers);
+}
+
+bool NavigationAgent3D::_repath_end() {
+	// Replace the part of the path after its last corner, the searched and string pulled part stays small when the target only moved a little.
+	int corner = navigation_path.size() - 2;
+	if (corner < nav_path_index) {
+		return false;
+	}
+
+	Vector<Vector3> path_end = _query_path(navigation_path[corner], target_location);
+	if (path_end.size() < 2) {
+		return false;
+	}
+
+	navigation_path.resize(corner + 1);
+	for (int i = 1; i < path_end.size(); i++) {
+		navigation_path.push_back(path_end[i]);
+	}
+	return true;
+}
+
+bool NavigationAgent3D::_repath_rejoin(const Vector3 &p_origin) {
+	// Find the way back to the location the agent was heading to, and keep the rest of the path from there.
+	const Vector3 next_location = navigation_path[nav_path_index];
+	Vector<Vector3> path_start = _query_path(p_origin, next_location);
+	if (path_start.size() == 0 || path_start[path_start.size() - 1].distance_to(next_location) >= path_desired_distance) {
+		return false;
+	}
+
+	for (int i = nav_path_index + 1; i < navigation_path.size(); i++) {
+		path_start.push_back(navigation_path[i]);
+	}
+	navigation_path = path_start;
+	nav_path_index = 0;
+	return true;
+}
+
 void NavigationAgent3D::_check_distance_to_target() {
 	if (!target_reached) {
 		if (distance_to_target() < target_desired_distance) {
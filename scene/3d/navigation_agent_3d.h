@@ -68,6 +68,8 @@ class NavigationAgent3D : public Node {
 	Vector3 target_velocity;
 	bool target_reached = false;
 	bool navigation_finished = true;
+	/// The target moved but the path still leads close to it, only its end needs to be found again.
+	bool target_moved = false;
 	// No initialized on purpose
 	uint32_t update_frame_id = 0;
 
@@ -172,6 +174,9 @@ public:
 private:
 	void update_navigation();
 	void _request_repath();
+	Vector<Vector3> _query_path(const Vector3 &p_from, const Vector3 &p_to) const;
+	bool _repath_end();
+	bool _repath_rejoin(const Vector3 &p_origin);
 	void _check_distance_to_target();
 };
 
@@ -75,12 +75,12 @@ Node3DGizmo::Node3DGizmo() {
 
 void Node3D::_notify_dirty() {
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	if (data.notify_transform && !data.ignore_notification) {
 
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
@@ -106,6 +106,13 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	uint64_t epoch = get_tree()->xform_change_epoch;
+	if ((data.dirty & DIRTY_GLOBAL_TRANSFORM) && data.transform_propagation_epoch == epoch) {
+		// Already propagated since the transform notifications were last flushed, so the whole
+		// subtree is still dirty and queued. Avoids walking it again for every animated child.
+		return;
+	}
+
 	data.children_lock++;
 
 	for (Node3D *&E : data.children) {
@@ -115,17 +122,31 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		E->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	if (data.notify_transform && !data.ignore_notification) {
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL_TRANSFORM;
+	data.transform_propagation_epoch = epoch;
 
 	data.children_lock--;
 }
 
+void Node3D::_invalidate_transform_propagation() {
+	// Called when a node stops being dirty and queued like the rest of its subtree without a flush,
+	// so the next transform change of any of its ancestors walks the subtree again.
+	Node3D *n = this;
+	while (n) {
+		n->data.transform_propagation_epoch = 0;
+		if (n->data.top_level_active) {
+			break;
+		}
+		n = n->data.parent;
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -151,6 +172,7 @@ void Node3D::_notification(int p_what) {
 			}
 
 			data.dirty |= DIRTY_GLOBAL_TRANSFORM; // Global is always dirty upon entering a scene.
+			_invalidate_transform_propagation(); // Not queued anymore, even if it was propagated to in this flush before leaving.
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -159,9 +181,7 @@ void Node3D::_notification(int p_what) {
 
 		case NOTIFICATION_EXIT_TREE: {
 			notification(NOTIFICATION_EXIT_WORLD, true);
-			if (xform_change.in_list()) {
-				get_tree()->xform_change_list.remove(&xform_change);
-			}
+			get_tree()->_remove_xform_change(&xform_change);
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
 			}
@@ -531,6 +551,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -628,6 +649,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 
 		data.top_level = p_enabled;
 		data.top_level_active = p_enabled;
+		_invalidate_transform_propagation();
 	} else {
 		data.top_level = p_enabled;
 	}
@@ -810,6 +832,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 }
 
 void Node3D::set_notify_transform(bool p_enabled) {
+	if (p_enabled && !data.notify_transform && is_inside_tree()) {
+		_invalidate_transform_propagation();
+	}
 	data.notify_transform = p_enabled;
 }
 
@@ -827,10 +852,10 @@ bool Node3D::is_local_transform_notification_enabled() const {
 
 void Node3D::force_update_transform() {
 	ERR_FAIL_COND(!is_inside_tree());
-	if (!xform_change.in_list()) {
+	if (!get_tree()->_remove_xform_change(&xform_change)) {
 		return; //nothing to update
 	}
-	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -115,6 +115,7 @@ private:
 		RID visibility_parent;
 
 		int children_lock = 0;
+		uint64_t transform_propagation_epoch = 0; // SceneTree flush epoch in which this whole subtree was last marked dirty.
 		Node3D *parent = nullptr;
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
@@ -140,6 +141,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
@@ -147,7 +149,13 @@ private:
 	void _update_visibility_parent(bool p_update_root);
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		if (data.ignore_notification && !p_ignore && data.transform_propagation_epoch != 0) {
+			// Propagated while ignoring, so marked as dirty without being queued. Later changes of its ancestors must not skip it.
+			_invalidate_transform_propagation();
+		}
+		data.ignore_notification = p_ignore;
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -31,6 +31,7 @@
 #include "skeleton_3d.h"
 
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/type_info.h"
 #include "scene/3d/physics_body_3d.h"
 #include "scene/resources/skeleton_modification_3d.h"
@@ -259,8 +260,15 @@ void Skeleton3D::_notification(int p_what) {
 			int len = bones.size();
 			dirty = false;
 
-			// Update bone transforms.
-			force_update_all_bone_transforms();
+			// Update bone transforms, unless already done with the other dirty skeletons.
+			if (bone_transforms_precomputed) {
+				bone_transforms_precomputed = false;
+				for (int i = 0; i < len; i++) {
+					emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, i);
+				}
+			} else {
+				force_update_all_bone_transforms();
+			}
 
 			// Update skins.
 			for (SkinReference *E : skin_bindings) {
@@ -311,11 +319,27 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				// Uploaded at once, same layout as RenderingServer::skeleton_bone_set_transform().
+				Vector<float> buffer;
+				buffer.resize(bind_count * 12);
+				float *w = buffer.ptrw();
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					Transform3D xform;
+					if (bone_index < (uint32_t)len) {
+						xform = bonesptr[bone_index].pose_global * skin->get_bind_pose(i);
+					} else {
+						ERR_PRINT("Skin bind #" + itos(i) + " points to an invalid bone.");
+					}
+					float *bone_data = w + i * 12;
+					for (int j = 0; j < 3; j++) {
+						bone_data[j * 4 + 0] = xform.basis.rows[j][0];
+						bone_data[j * 4 + 1] = xform.basis.rows[j][1];
+						bone_data[j * 4 + 2] = xform.basis.rows[j][2];
+						bone_data[j * 4 + 3] = xform.origin[j];
+					}
 				}
+				rs->skeleton_set_buffer(skeleton, buffer);
 			}
 #ifdef TOOLS_ENABLED
 			emit_signal(SceneStringNames::get_singleton()->pose_updated);
@@ -770,12 +794,68 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	// Changed after the transforms were computed with the other dirty skeletons, compute them again.
+	bone_transforms_precomputed = false;
+
 	if (dirty) {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_notification(this, NOTIFICATION_UPDATE_SKELETON);
 	dirty = true;
+
+	MutexLock lock(update_mutex);
+	if (update_queued) {
+		return; // Updated directly since queued, and made dirty again.
+	}
+	if (update_queue.is_empty()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp_static(&Skeleton3D::_flush_updates));
+	}
+	update_queue.push_back(get_instance_id());
+	update_queued = true;
+}
+
+BinaryMutex Skeleton3D::update_mutex;
+LocalVector<ObjectID> Skeleton3D::update_queue;
+
+void Skeleton3D::_update_bone_transforms_task(void *p_skeletons, uint32_t p_index) {
+	Skeleton3D *skeleton = static_cast<Skeleton3D **>(p_skeletons)[p_index];
+	skeleton->_update_process_order();
+	for (int i = 0; i < skeleton->parentless_bones.size(); i++) {
+		skeleton->_update_bone_children_transforms(skeleton->parentless_bones[i], false);
+	}
+	skeleton->bone_transforms_precomputed = true;
+}
+
+void Skeleton3D::_flush_updates() {
+	LocalVector<Skeleton3D *> skeletons;
+	{
+		MutexLock lock(update_mutex);
+		for (uint32_t i = 0; i < update_queue.size(); i++) {
+			Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(update_queue[i]));
+			if (!skeleton) {
+				continue;
+			}
+			skeleton->update_queued = false;
+			if (skeleton->dirty) {
+				skeleton->bone_transforms_precomputed = false;
+				skeletons.push_back(skeleton);
+			}
+		}
+		update_queue.clear();
+	}
+
+	if (skeletons.size() > 1) {
+		// Only touches the bones of each skeleton, the signals and the skins are handled in NOTIFICATION_UPDATE_SKELETON.
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Skeleton3D::_update_bone_transforms_task, skeletons.ptr(), skeletons.size(), -1, true, SNAME("Skeleton3DUpdateBones"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	for (uint32_t i = 0; i < skeletons.size(); i++) {
+		// May have been updated in the meantime, by a signal of a previous skeleton.
+		if (skeletons[i]->dirty) {
+			skeletons[i]->notification(NOTIFICATION_UPDATE_SKELETON);
+		}
+	}
 }
 
 void Skeleton3D::localize_rests() {
@@ -1048,16 +1128,19 @@ void Skeleton3D::force_update_all_bone_transforms() {
 }
 
 void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
+	_update_bone_children_transforms(p_bone_idx, true);
+}
+
+void Skeleton3D::_update_bone_children_transforms(int p_bone_idx, bool p_emit_signals) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
 	Bone *bonesptr = bones.ptrw();
-	List<int> bones_to_process = List<int>();
+	LocalVector<int> bones_to_process;
 	bones_to_process.push_back(p_bone_idx);
 
-	while (bones_to_process.size() > 0) {
-		int current_bone_idx = bones_to_process[0];
-		bones_to_process.erase(current_bone_idx);
+	for (uint32_t process_idx = 0; process_idx < bones_to_process.size(); process_idx++) {
+		int current_bone_idx = bones_to_process[process_idx];
 
 		Bone &b = bonesptr[current_bone_idx];
 		bool bone_enabled = b.enabled && !show_rest_only;
@@ -1113,7 +1196,9 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 			bones_to_process.push_back(b.child_bones[i]);
 		}
 
-		emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, current_bone_idx);
+		if (p_emit_signals) {
+			emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, current_bone_idx);
+		}
 	}
 	rest_dirty = false;
 }
@@ -31,6 +31,8 @@
 #ifndef SKELETON_3D_H
 #define SKELETON_3D_H
 
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/skeleton_modification_3d.h"
 #include "scene/resources/skin.h"
@@ -145,6 +147,17 @@ private:
 	bool dirty = false;
 	bool rest_dirty = false;
 
+	// Dirty skeletons are updated together once the message queue is flushed, computing the bone transforms
+	// of all of them on the WorkerThreadPool before updating each one on the main thread.
+	bool bone_transforms_precomputed = false;
+	bool update_queued = false;
+	static BinaryMutex update_mutex;
+	static LocalVector<ObjectID> update_queue;
+
+	void _update_bone_children_transforms(int p_bone_idx, bool p_emit_signals);
+	static void _update_bone_transforms_task(void *p_skeletons, uint32_t p_index);
+	static void _flush_updates();
+
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
 
@@ -163,6 +163,25 @@ Vector3::Axis SpriteBase3D::get_axis() const {
 	return axis;
 }
 
+void SpriteBase3D::_update_material(RID p_shader, RID p_texture) {
+	int priority = get_alpha_cut_mode() == ALPHA_CUT_DISABLED ? get_render_priority() : 0;
+	if (material.is_valid() && p_shader == last_shader && p_texture == last_texture && priority == last_render_priority) {
+		return;
+	}
+
+	// The material is shared with the other sprites and labels drawn the same way.
+	RID new_material = BaseMaterial3D::acquire_material_instance_for_2d(p_shader, p_texture, 0.98, priority);
+	if (material.is_valid()) {
+		BaseMaterial3D::release_material_instance_for_2d(material);
+	}
+	material = new_material;
+	last_shader = p_shader;
+	last_texture = p_texture;
+	last_render_priority = priority;
+
+	RS::get_singleton()->mesh_surface_set_material(mesh, 0, material);
+}
+
 void SpriteBase3D::_im_update() {
 	_draw();
 
@@ -367,18 +386,6 @@ SpriteBase3D::SpriteBase3D() {
 		flags[i] = i == FLAG_TRANSPARENT || i == FLAG_DOUBLE_SIDED;
 	}
 
-	material = RenderingServer::get_singleton()->material_create();
-	// Set defaults for material, names need to match up those in StandardMaterial3D
-	RS::get_singleton()->material_set_param(material, "albedo", Color(1, 1, 1, 1));
-	RS::get_singleton()->material_set_param(material, "specular", 0.5);
-	RS::get_singleton()->material_set_param(material, "metallic", 0.0);
-	RS::get_singleton()->material_set_param(material, "roughness", 1.0);
-	RS::get_singleton()->material_set_param(material, "uv1_offset", Vector3(0, 0, 0));
-	RS::get_singleton()->material_set_param(material, "uv1_scale", Vector3(1, 1, 1));
-	RS::get_singleton()->material_set_param(material, "uv2_offset", Vector3(0, 0, 0));
-	RS::get_singleton()->material_set_param(material, "uv2_scale", Vector3(1, 1, 1));
-	RS::get_singleton()->material_set_param(material, "alpha_scissor_threshold", 0.98);
-
 	mesh = RenderingServer::get_singleton()->mesh_create();
 
 	PackedVector3Array mesh_vertices;
@@ -430,8 +437,6 @@ SpriteBase3D::SpriteBase3D() {
 	vertex_buffer = sd.vertex_data;
 	attribute_buffer = sd.attribute_data;
 
-	sd.material = material;
-
 	RS::get_singleton()->mesh_surface_make_offsets_from_format(sd.format, sd.vertex_count, sd.index_count, mesh_surface_offsets, vertex_stride, attrib_stride, skin_stride);
 	RS::get_singleton()->mesh_add_surface(mesh, sd);
 	set_base(mesh);
@@ -439,7 +444,9 @@ SpriteBase3D::SpriteBase3D() {
 
 SpriteBase3D::~SpriteBase3D() {
 	RenderingServer::get_singleton()->free(mesh);
-	RenderingServer::get_singleton()->free(material);
+	if (material.is_valid()) {
+		BaseMaterial3D::release_material_instance_for_2d(material);
+	}
 }
 
 ///////////////////////////////////////////
@@ -620,18 +627,7 @@ void Sprite3D::_draw() {
 
 	RID shader_rid;
 	StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), get_draw_flag(FLAG_TRANSPARENT), get_draw_flag(FLAG_DOUBLE_SIDED), get_alpha_cut_mode() == ALPHA_CUT_DISCARD, get_alpha_cut_mode() == ALPHA_CUT_OPAQUE_PREPASS, get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, false, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), get_texture_filter(), &shader_rid);
-	if (last_shader != shader_rid) {
-		RS::get_singleton()->material_set_shader(get_material(), shader_rid);
-		last_shader = shader_rid;
-	}
-	if (last_texture != texture->get_rid()) {
-		RS::get_singleton()->material_set_param(get_material(), "texture_albedo", texture->get_rid());
-		last_texture = texture->get_rid();
-	}
-	if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
-		RS::get_singleton()->material_set_render_priority(get_material(), get_render_priority());
-		RS::get_singleton()->mesh_surface_set_material(mesh, 0, get_material());
-	}
+	_update_material(shader_rid, texture->get_rid());
 }
 
 void Sprite3D::set_texture(const Ref<Texture2D> &p_texture) {
@@ -986,18 +982,7 @@ void AnimatedSprite3D::_draw() {
 
 	RID shader_rid;
 	StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), get_draw_flag(FLAG_TRANSPARENT), get_draw_flag(FLAG_DOUBLE_SIDED), get_alpha_cut_mode() == ALPHA_CUT_DISCARD, get_alpha_cut_mode() == ALPHA_CUT_OPAQUE_PREPASS, get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, false, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), get_texture_filter(), &shader_rid);
-	if (last_shader != shader_rid) {
-		RS::get_singleton()->material_set_shader(get_material(), shader_rid);
-		last_shader = shader_rid;
-	}
-	if (last_texture != texture->get_rid()) {
-		RS::get_singleton()->material_set_param(get_material(), "texture_albedo", texture->get_rid());
-		last_texture = texture->get_rid();
-	}
-	if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
-		RS::get_singleton()->material_set_render_priority(get_material(), get_render_priority());
-		RS::get_singleton()->mesh_surface_set_material(mesh, 0, get_material());
-	}
+	_update_material(shader_rid, texture->get_rid());
 }
 
 void AnimatedSprite3D::_validate_property(PropertyInfo &property) const {
@@ -79,6 +79,9 @@ private:
 
 	RID mesh;
 	RID material;
+	RID last_shader;
+	RID last_texture;
+	int last_render_priority = 0;
 
 	bool flags[FLAG_MAX] = {};
 	AlphaCutMode alpha_cut = ALPHA_CUT_DISABLED;
@@ -97,6 +100,7 @@ protected:
 	_FORCE_INLINE_ void set_aabb(const AABB &p_aabb) { aabb = p_aabb; }
 	_FORCE_INLINE_ RID &get_mesh() { return mesh; }
 	_FORCE_INLINE_ RID &get_material() { return material; }
+	void _update_material(RID p_shader, RID p_texture);
 
 	uint32_t mesh_surface_offsets[RS::ARRAY_MAX];
 	PackedByteArray vertex_buffer;
@@ -167,9 +171,6 @@ class Sprite3D : public SpriteBase3D {
 	int vframes = 1;
 	int hframes = 1;
 
-	RID last_shader;
-	RID last_texture;
-
 protected:
 	virtual void _draw() override;
 	static void _bind_methods();
@@ -222,9 +223,6 @@ class AnimatedSprite3D : public SpriteBase3D {
 	void _set_playing(bool p_playing);
 	bool _is_playing() const;
 
-	RID last_shader;
-	RID last_texture;
-
 protected:
 	virtual void _draw() override;
 	static void _bind_methods();
@@ -58,6 +58,11 @@ void VisualInstance3D::_notification(int p_what) {
 			ERR_FAIL_COND(get_world_3d().is_null());
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
 			_update_visibility();
+
+			// Start from the transform it enters with, instead of being interpolated from wherever it was before.
+			RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
+			RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+			RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
@@ -73,9 +78,21 @@ void VisualInstance3D::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			_update_visibility();
 		} break;
+
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			if (is_inside_tree()) {
+				// The transform is only sent when transform notifications are flushed, send it now so the reset applies to it.
+				RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+			}
+		} break;
 	}
 }
 
+void VisualInstance3D::_physics_interpolated_changed() {
+	RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
+}
+
 RID VisualInstance3D::get_instance() const {
 	return instance;
 }
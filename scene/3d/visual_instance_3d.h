@@ -46,6 +46,7 @@ protected:
 	void _update_visibility();
 
 	void _notification(int p_what);
+	virtual void _physics_interpolated_changed() override;
 	static void _bind_methods();
 
 	GDVIRTUAL0RC(AABB, _get_aabb)
@@ -30,6 +30,8 @@
 
 #include "voxelizer.h"
 
+#include "core/object/worker_thread_pool.h"
+
 static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3 *p_vtx, const Vector2 *p_uv, const Vector3 *p_normal, Vector2 &r_uv, Vector3 &r_normal) {
 	if (p_pos.is_equal_approx(p_vtx[0])) {
 		r_uv = p_uv[0];
@@ -70,7 +72,7 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+void Voxelizer::_plot_face(LocalVector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
 	if (p_level == cell_subdiv) {
 		//plot the face by guessing its albedo and emission value
 
@@ -217,16 +219,16 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 		}
 
 		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		r_cells[p_idx].albedo[0] += albedo_accum.r;
+		r_cells[p_idx].albedo[1] += albedo_accum.g;
+		r_cells[p_idx].albedo[2] += albedo_accum.b;
+		r_cells[p_idx].emission[0] += emission_accum.r;
+		r_cells[p_idx].emission[1] += emission_accum.g;
+		r_cells[p_idx].emission[2] += emission_accum.b;
+		r_cells[p_idx].normal[0] += normal_accum.x;
+		r_cells[p_idx].normal[1] += normal_accum.y;
+		r_cells[p_idx].normal[2] += normal_accum.z;
+		r_cells[p_idx].alpha += alpha;
 
 	} else {
 		//go down
@@ -269,23 +271,153 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 				}
 			}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			if (r_cells[p_idx].children[i] == CHILD_EMPTY) {
 				//sub cell must be created
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
-				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
-				bake_cells.write[child_idx].x = nx / half;
-				bake_cells.write[child_idx].y = ny / half;
-				bake_cells.write[child_idx].z = nz / half;
+				uint32_t child_idx = r_cells.size();
+				r_cells[p_idx].children[i] = child_idx;
+				r_cells.resize(r_cells.size() + 1);
+				r_cells[child_idx].level = p_level + 1;
+				r_cells[child_idx].x = nx / half;
+				r_cells[child_idx].y = ny / half;
+				r_cells[child_idx].z = nz / half;
 			}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+			_plot_face(r_cells, r_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
 		}
 	}
 }
 
+void Voxelizer::_plot_face_regions(int p_idx, int p_level, int p_x, int p_y, int p_z, uint32_t p_face, const AABB &p_aabb) {
+	if (p_level == plot_region_level) {
+		uint32_t region_index;
+		HashMap<uint32_t, uint32_t>::Iterator E = plot_region_cells.find(p_idx);
+		if (E) {
+			region_index = E->value;
+		} else {
+			region_index = plot_regions.size();
+			plot_regions.resize(region_index + 1);
+			PlotRegion &region = plot_regions[region_index];
+			region.cell = p_idx;
+			region.x = p_x;
+			region.y = p_y;
+			region.z = p_z;
+			region.aabb = p_aabb;
+			region.cells.push_back(bake_cells[p_idx]);
+			plot_region_cells.insert(p_idx, region_index);
+		}
+		plot_regions[region_index].faces.push_back(p_face);
+		return;
+	}
+
+	//same descent as _plot_face, but only down to the region cells
+	int half = (1 << cell_subdiv) >> (p_level + 1);
+	for (int i = 0; i < 8; i++) {
+		AABB aabb = p_aabb;
+		aabb.size *= 0.5;
+
+		int nx = p_x;
+		int ny = p_y;
+		int nz = p_z;
+
+		if (i & 1) {
+			aabb.position.x += aabb.size.x;
+			nx += half;
+		}
+		if (i & 2) {
+			aabb.position.y += aabb.size.y;
+			ny += half;
+		}
+		if (i & 4) {
+			aabb.position.z += aabb.size.z;
+			nz += half;
+		}
+		//make sure to not plot beyond limits
+		if (nx < 0 || nx >= axis_cell_size[0] || ny < 0 || ny >= axis_cell_size[1] || nz < 0 || nz >= axis_cell_size[2]) {
+			continue;
+		}
+
+		Vector3 qsize = aabb.size * 0.5;
+		if (!Geometry3D::triangle_box_overlap(aabb.position + qsize, qsize, plot_faces[p_face].vtx)) {
+			continue;
+		}
+
+		if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			uint32_t child_idx = bake_cells.size();
+			bake_cells.write[p_idx].children[i] = child_idx;
+			bake_cells.resize(bake_cells.size() + 1);
+			bake_cells.write[child_idx].level = p_level + 1;
+			bake_cells.write[child_idx].x = nx / half;
+			bake_cells.write[child_idx].y = ny / half;
+			bake_cells.write[child_idx].z = nz / half;
+		}
+
+		_plot_face_regions(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_face, aabb);
+	}
+}
+
+void Voxelizer::_plot_region(uint32_t p_index, const uint32_t *p_regions) {
+	PlotRegion &region = plot_regions[p_regions[p_index]];
+	for (uint32_t i = 0; i < region.faces.size(); i++) {
+		const PlotFace &face = plot_faces[region.faces[i]];
+		_plot_face(region.cells, 0, plot_region_level, region.x, region.y, region.z, face.vtx, face.normal, face.uv, plot_materials[face.material], region.aabb);
+	}
+}
+
+void Voxelizer::_plot_queued_faces() {
+	if (plot_faces.is_empty()) {
+		return;
+	}
+
+	// Find the regions touched by every face serially and in order, then plot each region on its own thread.
+	for (uint32_t i = 0; i < plot_faces.size(); i++) {
+		_plot_face_regions(0, 0, 0, 0, 0, i, po2_bounds);
+	}
+
+	LocalVector<uint32_t> pending_regions;
+	for (uint32_t i = 0; i < plot_regions.size(); i++) {
+		if (!plot_regions[i].faces.is_empty()) {
+			pending_regions.push_back(i);
+		}
+	}
+
+	if (!pending_regions.is_empty()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Voxelizer::_plot_region, pending_regions.ptr(), pending_regions.size(), -1, true, SNAME("VoxelizerPlotRegions"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	for (uint32_t i = 0; i < pending_regions.size(); i++) {
+		plot_regions[pending_regions[i]].faces.clear();
+	}
+	plot_faces.clear();
+	plot_materials.clear();
+}
+
+void Voxelizer::_merge_plot_regions() {
+	for (uint32_t i = 0; i < plot_regions.size(); i++) {
+		const PlotRegion &region = plot_regions[i];
+
+		// The region root replaces its cell, the rest are appended.
+		uint32_t base = bake_cells.size() - 1;
+		bake_cells.resize(base + region.cells.size());
+		Cell *cellsp = bake_cells.ptrw();
+
+		for (uint32_t j = 0; j < region.cells.size(); j++) {
+			Cell cell = region.cells[j];
+			for (int k = 0; k < 8; k++) {
+				if (cell.children[k] != CHILD_EMPTY) {
+					cell.children[k] += base;
+				}
+			}
+			cellsp[j == 0 ? region.cell : base + j] = cell;
+		}
+	}
+
+	plot_regions.clear();
+	plot_region_cells.clear();
+	max_original_cells = bake_cells.size();
+}
+
 Vector<Color> Voxelizer::_get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add) {
 	Vector<Color> ret;
 
@@ -388,7 +520,8 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 		} else {
 			src_material = p_mesh->surface_get_material(i);
 		}
-		MaterialCache material = _get_material_cache(src_material);
+		uint32_t material = plot_materials.size();
+		plot_materials.push_back(_get_material_cache(src_material));
 
 		Array a = p_mesh->surface_get_arrays(i);
 
@@ -413,69 +546,68 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 			const int *ir = index.ptr();
 
 			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+				PlotFace face;
+				face.material = material;
 
 				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[ir[j * 3 + k]]);
+					face.vtx[k] = p_xform.xform(vr[ir[j * 3 + k]]);
 				}
 
 				if (uvr) {
 					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[ir[j * 3 + k]];
+						face.uv[k] = uvr[ir[j * 3 + k]];
 					}
 				}
 
 				if (nr) {
 					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[ir[j * 3 + k]];
+						face.normal[k] = nr[ir[j * 3 + k]];
 					}
 				}
 
 				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
+				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, face.vtx)) {
 					continue;
 				}
-				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				plot_faces.push_back(face);
 			}
 
 		} else {
 			int facecount = vertices.size() / 3;
 
 			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+				PlotFace face;
+				face.material = material;
 
 				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[j * 3 + k]);
+					face.vtx[k] = p_xform.xform(vr[j * 3 + k]);
 				}
 
 				if (uvr) {
 					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[j * 3 + k];
+						face.uv[k] = uvr[j * 3 + k];
 					}
 				}
 
 				if (nr) {
 					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[j * 3 + k];
+						face.normal[k] = nr[j * 3 + k];
 					}
 				}
 
 				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
+				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, face.vtx)) {
 					continue;
 				}
-				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				plot_faces.push_back(face);
 			}
 		}
-	}
 
-	max_original_cells = bake_cells.size();
+		//plot in batches, so large scenes don't keep all their faces around
+		if (plot_faces.size() >= PLOT_FACE_QUEUE_SIZE) {
+			_plot_queued_faces();
+		}
+	}
 }
 
 void Voxelizer::_sort() {
@@ -614,6 +746,11 @@ void Voxelizer::begin_bake(int p_subdiv, const AABB &p_bounds) {
 	cell_subdiv = p_subdiv;
 	bake_cells.resize(1);
 	material_cache.clear();
+	plot_materials.clear();
+	plot_faces.clear();
+	plot_regions.clear();
+	plot_region_cells.clear();
+	plot_region_level = MIN(int(PLOT_REGION_LEVEL), cell_subdiv);
 
 	//find out the actual real bounds, power of 2, which gets the highest subdivision
 	po2_bounds = p_bounds;
@@ -651,6 +788,9 @@ void Voxelizer::begin_bake(int p_subdiv, const AABB &p_bounds) {
 }
 
 void Voxelizer::end_bake() {
+	_plot_queued_faces();
+	_merge_plot_regions();
+
 	if (!sorted) {
 		_sort();
 	}
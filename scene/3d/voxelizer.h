@@ -31,13 +31,15 @@
 #ifndef VOXELIZER_H
 #define VOXELIZER_H
 
+#include "core/templates/local_vector.h"
 #include "scene/resources/multimesh.h"
 
 class Voxelizer {
 private:
 	enum {
-		CHILD_EMPTY = 0xFFFFFFFF
-
+		CHILD_EMPTY = 0xFFFFFFFF,
+		PLOT_REGION_LEVEL = 3, // Faces are plotted in parallel below the cells of this level.
+		PLOT_FACE_QUEUE_SIZE = 65536,
 	};
 
 	struct Cell {
@@ -87,6 +89,31 @@ private:
 	};
 
 	HashMap<Ref<Material>, MaterialCache> material_cache;
+
+	struct PlotFace {
+		Vector3 vtx[3];
+		Vector3 normal[3];
+		Vector2 uv[3];
+		uint32_t material = 0;
+	};
+
+	// Subtree below a cell of plot_region_level, plotted by a single thread into its own cells and merged into bake_cells at the end.
+	// Each one receives its faces in the order they were plotted, so leaves accumulate exactly as if plotted serially.
+	struct PlotRegion {
+		uint32_t cell = 0;
+		int x = 0;
+		int y = 0;
+		int z = 0;
+		AABB aabb;
+		LocalVector<Cell> cells;
+		LocalVector<uint32_t> faces;
+	};
+
+	LocalVector<MaterialCache> plot_materials;
+	LocalVector<PlotFace> plot_faces;
+	LocalVector<PlotRegion> plot_regions;
+	HashMap<uint32_t, uint32_t> plot_region_cells;
+	int plot_region_level = 0;
 	AABB original_bounds;
 	AABB po2_bounds;
 	int axis_cell_size[3] = {};
@@ -103,7 +130,11 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_face(LocalVector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_face_regions(int p_idx, int p_level, int p_x, int p_y, int p_z, uint32_t p_face, const AABB &p_aabb);
+	void _plot_region(uint32_t p_index, const uint32_t *p_regions);
+	void _plot_queued_faces();
+	void _merge_plot_regions();
 	void _fixup_plot(int p_idx, int p_level);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx);
 
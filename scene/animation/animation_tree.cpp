@@ -32,7 +32,10 @@
 
 #include "animation_blend_tree.h"
 #include "core/config/engine.h"
+#include "core/object/worker_thread_pool.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/resources/animation.h"
+#include "scene/main/viewport.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
 
@@ -842,6 +845,8 @@ bool AnimationTree::_update_caches(AnimationPlayer *player) {
 }
 
 void AnimationTree::_clear_caches() {
+	// The caches are about to be freed, don't let a pending threaded blend use them.
+	threaded_blending_pending = false;
 	for (KeyValue<NodePath, TrackCache *> &K : track_cache) {
 		memdelete(K.value);
 	}
@@ -866,7 +871,12 @@ static void _call_object(Object *p_object, const StringName &p_method, const Vec
 		p_object->callp(p_method, argptrs, argcount, ce);
 	}
 }
-void AnimationTree::_process_graph(double p_delta) {
+void AnimationTree::_process_graph(double p_delta, bool p_update_lod) {
+	if (threaded_blending_pending) {
+		// Processed again before the threaded blend was flushed (e.g. with advance()), finish it first.
+		_finish_threaded_blending();
+	}
+
 	_update_properties(); //if properties need updating, update them
 
 	//check all tracks, see if they need modification
@@ -922,6 +932,25 @@ void AnimationTree::_process_graph(double p_delta) {
 		}
 	}
 
+	if (p_update_lod && lod_distance > 0) {
+		// Far from the camera, the graph is only evaluated every few frames, with the time elapsed since the last
+		// evaluation, and the poses are interpolated in between.
+		lod_delta += p_delta;
+		if (lod_frame > 0 && lod_frame < lod_interval) {
+			lod_frame++;
+			_apply_lod_tracks(real_t(lod_frame) / lod_interval);
+			return;
+		}
+		p_delta = lod_delta;
+		lod_delta = 0.0;
+		lod_frame = 1;
+		lod_interval = _get_lod_interval(player);
+	} else {
+		lod_interval = 1;
+		lod_frame = 0;
+		lod_delta = 0.0;
+	}
+
 	{ //setup
 
 		process_pass++;
@@ -957,6 +986,20 @@ void AnimationTree::_process_graph(double p_delta) {
 	if (!state.valid) {
 		return; //state is not valid. do nothing.
 	}
+
+	if (threaded_blending_enabled && process_callback != ANIMATION_PROCESS_MANUAL && is_inside_tree()) {
+		_queue_threaded_blending();
+		return;
+	}
+
+	_process_tracks(true, true);
+	_apply_tracks();
+}
+
+void AnimationTree::_process_tracks(bool p_sample, bool p_trigger) {
+	// Sampling blends the value/transform/bezier tracks into the track caches, and only touches the tree and its caches,
+	// triggering executes the discrete value and method/audio/animation tracks.
+
 	//apply value/transform/bezier blends to track caches and execute method/audio/animation tracks
 
 	{
@@ -979,13 +1022,25 @@ void AnimationTree::_process_graph(double p_delta) {
 					continue;
 				}
 
+				Animation::TrackType ttype = a->track_get_type(i);
+				bool triggered = ttype == Animation::TYPE_METHOD || ttype == Animation::TYPE_AUDIO || ttype == Animation::TYPE_ANIMATION;
+				if (ttype == Animation::TYPE_VALUE) {
+					Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
+					triggered = update_mode != Animation::UPDATE_CONTINUOUS && update_mode != Animation::UPDATE_CAPTURE;
+				}
+				if (triggered ? !p_trigger : !p_sample) {
+					continue;
+				}
+				if (!triggered && lod_interval > 1 && lod_transform_tracks_only && (ttype == Animation::TYPE_BLEND_SHAPE || ttype == Animation::TYPE_VALUE || ttype == Animation::TYPE_BEZIER)) {
+					continue;
+				}
+
 				NodePath path = a->track_get_path(i);
 
 				ERR_CONTINUE(!track_cache.has(path));
 
 				TrackCache *track = track_cache[path];
 
-				Animation::TrackType ttype = a->track_get_type(i);
 				if (ttype != Animation::TYPE_POSITION_3D && ttype != Animation::TYPE_ROTATION_3D && ttype != Animation::TYPE_SCALE_3D && track->type != ttype) {
 					//broken animation, but avoid error spamming
 					continue;
@@ -1615,7 +1670,9 @@ void AnimationTree::_process_graph(double p_delta) {
 			}
 		}
 	}
+}
 
+void AnimationTree::_apply_tracks() {
 	{
 		// finally, set the tracks
 		for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
@@ -1636,27 +1693,27 @@ void AnimationTree::_process_graph(double p_delta) {
 
 						root_motion_transform = xform;
 
-					} else if (t->skeleton && t->bone_idx >= 0) {
-						if (t->loc_used) {
-							t->skeleton->set_bone_pose_position(t->bone_idx, t->loc);
-						}
-						if (t->rot_used) {
-							t->skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-						}
-						if (t->scale_used) {
-							t->skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
+					} else if (lod_distance > 0) {
+						if (lod_interval > 1 && t->lod_pass + 1 == process_pass) {
+							t->lod_from_loc = t->lod_to_loc;
+							t->lod_from_rot = t->lod_to_rot;
+							t->lod_from_scale = t->lod_to_scale;
+						} else {
+							// Nothing to interpolate from.
+							t->lod_from_loc = t->loc;
+							t->lod_from_rot = t->rot;
+							t->lod_from_scale = t->scale;
 						}
+						t->lod_to_loc = t->loc;
+						t->lod_to_rot = t->rot;
+						t->lod_to_scale = t->scale;
+						t->lod_pass = process_pass;
 
-					} else if (!t->skeleton) {
-						if (t->loc_used) {
-							t->node_3d->set_position(t->loc);
-						}
-						if (t->rot_used) {
-							t->node_3d->set_rotation(t->rot.get_euler());
-						}
-						if (t->scale_used) {
-							t->node_3d->set_scale(t->scale);
-						}
+						real_t weight = 1.0 / lod_interval;
+						_apply_transform_track(t, t->lod_from_loc.lerp(t->lod_to_loc, weight), t->lod_from_rot.slerp(t->lod_to_rot, weight), t->lod_from_scale.lerp(t->lod_to_scale, weight));
+
+					} else {
+						_apply_transform_track(t, t->loc, t->rot, t->scale);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1688,6 +1745,127 @@ void AnimationTree::_process_graph(double p_delta) {
 	}
 }
 
+#ifndef _3D_DISABLED
+void AnimationTree::_apply_transform_track(TrackCacheTransform *p_track, const Vector3 &p_loc, const Quaternion &p_rot, const Vector3 &p_scale) {
+	if (p_track->skeleton && p_track->bone_idx >= 0) {
+		if (p_track->loc_used) {
+			p_track->skeleton->set_bone_pose_position(p_track->bone_idx, p_loc);
+		}
+		if (p_track->rot_used) {
+			p_track->skeleton->set_bone_pose_rotation(p_track->bone_idx, p_rot);
+		}
+		if (p_track->scale_used) {
+			p_track->skeleton->set_bone_pose_scale(p_track->bone_idx, p_scale);
+		}
+
+	} else if (!p_track->skeleton) {
+		if (p_track->loc_used) {
+			p_track->node_3d->set_position(p_loc);
+		}
+		if (p_track->rot_used) {
+			p_track->node_3d->set_rotation(p_rot.get_euler());
+		}
+		if (p_track->scale_used) {
+			p_track->node_3d->set_scale(p_scale);
+		}
+	}
+}
+#endif // _3D_DISABLED
+
+int AnimationTree::_get_lod_interval(AnimationPlayer *p_player) const {
+#ifndef _3D_DISABLED
+	// The distance is measured from the node the animated paths are relative to.
+	const Node3D *node = Object::cast_to<Node3D>(p_player->get_node_or_null(p_player->get_root()));
+	const Camera3D *camera = get_viewport()->get_camera_3d();
+	if (!node || !camera) {
+		return 1;
+	}
+
+	real_t distance = camera->get_global_transform().origin.distance_to(node->get_global_transform().origin);
+	return MIN(1 + int(distance / lod_distance), lod_max_interval);
+#else
+	return 1;
+#endif // _3D_DISABLED
+}
+
+void AnimationTree::_apply_lod_tracks(real_t p_weight) {
+#ifndef _3D_DISABLED
+	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
+		if (K.value->type != Animation::TYPE_POSITION_3D || K.value->root_motion) {
+			continue;
+		}
+		TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+		if (t->lod_pass != process_pass) {
+			continue; //not processed in the last evaluation
+		}
+		_apply_transform_track(t, t->lod_from_loc.lerp(t->lod_to_loc, p_weight), t->lod_from_rot.slerp(t->lod_to_rot, p_weight), t->lod_from_scale.lerp(t->lod_to_scale, p_weight));
+	}
+#endif // _3D_DISABLED
+}
+
+BinaryMutex AnimationTree::threaded_blending_mutex;
+LocalVector<ObjectID> AnimationTree::threaded_blending_queue;
+
+void AnimationTree::_queue_threaded_blending() {
+	// The track blends point to the animation nodes, which may be shared with other trees processed before the flush.
+	threaded_blending_track_blends.resize(state.animation_states.size());
+	uint32_t idx = 0;
+	for (AnimationNode::AnimationState &as : state.animation_states) {
+		threaded_blending_track_blends[idx] = *as.track_blends;
+		as.track_blends = &threaded_blending_track_blends[idx];
+		idx++;
+	}
+
+	threaded_blending_pending = true;
+
+	MutexLock lock(threaded_blending_mutex);
+	if (threaded_blending_queue.is_empty()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp_static(&AnimationTree::_flush_threaded_blending));
+	}
+	threaded_blending_queue.push_back(get_instance_id());
+}
+
+void AnimationTree::_finish_threaded_blending() {
+	threaded_blending_pending = false;
+	_process_tracks(true, false);
+	_process_tracks(false, true);
+	_apply_tracks();
+}
+
+void AnimationTree::_threaded_blending_task(void *p_trees, uint32_t p_index) {
+	AnimationTree *tree = static_cast<AnimationTree **>(p_trees)[p_index];
+	tree->_process_tracks(true, false);
+}
+
+void AnimationTree::_flush_threaded_blending() {
+	LocalVector<AnimationTree *> trees;
+	{
+		MutexLock lock(threaded_blending_mutex);
+		for (uint32_t i = 0; i < threaded_blending_queue.size(); i++) {
+			AnimationTree *tree = Object::cast_to<AnimationTree>(ObjectDB::get_instance(threaded_blending_queue[i]));
+			if (tree && tree->threaded_blending_pending) {
+				trees.push_back(tree);
+			}
+		}
+		threaded_blending_queue.clear();
+	}
+
+	if (trees.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationTree::_threaded_blending_task, trees.ptr(), trees.size(), -1, true, SNAME("AnimationTreeBlending"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (trees.size() == 1) {
+		trees[0]->_process_tracks(true, false);
+	}
+
+	// Method, audio and animation tracks, and the final values are applied in order, on the main thread.
+	for (uint32_t i = 0; i < trees.size(); i++) {
+		AnimationTree *tree = trees[i];
+		tree->threaded_blending_pending = false;
+		tree->_process_tracks(false, true);
+		tree->_apply_tracks();
+	}
+}
+
 Variant AnimationTree::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, const Object *p_object, int p_object_idx) {
 	switch (p_anim->track_get_type(p_track)) {
 #ifndef _3D_DISABLED
@@ -1732,13 +1910,13 @@ void AnimationTree::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && process_callback == ANIMATION_PROCESS_IDLE) {
-				_process_graph(get_process_delta_time());
+				_process_graph(get_process_delta_time(), true);
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && process_callback == ANIMATION_PROCESS_PHYSICS) {
-				_process_graph(get_physics_process_delta_time());
+				_process_graph(get_physics_process_delta_time(), true);
 			}
 		} break;
 	}
@@ -1753,6 +1931,38 @@ NodePath AnimationTree::get_animation_player() const {
 	return animation_player;
 }
 
+void AnimationTree::set_threaded_blending_enabled(bool p_enabled) {
+	threaded_blending_enabled = p_enabled;
+}
+
+bool AnimationTree::is_threaded_blending_enabled() const {
+	return threaded_blending_enabled;
+}
+
+void AnimationTree::set_lod_distance(real_t p_distance) {
+	lod_distance = MAX(p_distance, 0.0);
+}
+
+real_t AnimationTree::get_lod_distance() const {
+	return lod_distance;
+}
+
+void AnimationTree::set_lod_max_interval(int p_interval) {
+	lod_max_interval = MAX(p_interval, 1);
+}
+
+int AnimationTree::get_lod_max_interval() const {
+	return lod_max_interval;
+}
+
+void AnimationTree::set_lod_transform_tracks_only(bool p_enabled) {
+	lod_transform_tracks_only = p_enabled;
+}
+
+bool AnimationTree::is_lod_transform_tracks_only() const {
+	return lod_transform_tracks_only;
+}
+
 void AnimationTree::set_advance_expression_base_node(const NodePath &p_advance_expression_base_node) {
 	advance_expression_base_node = p_advance_expression_base_node;
 }
@@ -1956,6 +2166,18 @@ void AnimationTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_animation_player", "root"), &AnimationTree::set_animation_player);
 	ClassDB::bind_method(D_METHOD("get_animation_player"), &AnimationTree::get_animation_player);
 
+	ClassDB::bind_method(D_METHOD("set_threaded_blending_enabled", "enabled"), &AnimationTree::set_threaded_blending_enabled);
+	ClassDB::bind_method(D_METHOD("is_threaded_blending_enabled"), &AnimationTree::is_threaded_blending_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationTree::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationTree::get_lod_distance);
+
+	ClassDB::bind_method(D_METHOD("set_lod_max_interval", "interval"), &AnimationTree::set_lod_max_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_max_interval"), &AnimationTree::get_lod_max_interval);
+
+	ClassDB::bind_method(D_METHOD("set_lod_transform_tracks_only", "enabled"), &AnimationTree::set_lod_transform_tracks_only);
+	ClassDB::bind_method(D_METHOD("is_lod_transform_tracks_only"), &AnimationTree::is_lod_transform_tracks_only);
+
 	ClassDB::bind_method(D_METHOD("set_advance_expression_base_node", "node"), &AnimationTree::set_advance_expression_base_node);
 	ClassDB::bind_method(D_METHOD("get_advance_expression_base_node"), &AnimationTree::get_advance_expression_base_node);
 
@@ -1976,8 +2198,13 @@ void AnimationTree::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_callback", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_callback", "get_process_callback");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "threaded_blending_enabled"), "set_threaded_blending_enabled", "is_threaded_blending_enabled");
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_max_interval", PROPERTY_HINT_RANGE, "1,16,1,or_greater"), "set_lod_max_interval", "get_lod_max_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_transform_tracks_only"), "set_lod_transform_tracks_only", "is_lod_transform_tracks_only");
 
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_PHYSICS);
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_IDLE);
@@ -32,6 +32,8 @@
 #define ANIMATION_TREE_H
 
 #include "animation_player.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/animation.h"
@@ -216,6 +218,15 @@ private:
 		Quaternion rot;
 		Vector3 scale;
 
+		// The pose is interpolated between the last two evaluations when the tree is updated less often, see lod_distance.
+		uint64_t lod_pass = 0;
+		Vector3 lod_from_loc;
+		Quaternion lod_from_rot;
+		Vector3 lod_from_scale;
+		Vector3 lod_to_loc;
+		Quaternion lod_to_rot;
+		Vector3 lod_to_scale;
+
 		TrackCacheTransform() {
 			type = Animation::TYPE_POSITION_3D;
 		}
@@ -283,7 +294,35 @@ private:
 
 	void _clear_caches();
 	bool _update_caches(AnimationPlayer *player);
-	void _process_graph(double p_delta);
+	void _process_graph(double p_delta, bool p_update_lod = false);
+	void _process_tracks(bool p_sample, bool p_trigger);
+	void _apply_tracks();
+
+	real_t lod_distance = 0.0;
+	int lod_max_interval = 4;
+	bool lod_transform_tracks_only = false;
+	int lod_interval = 1;
+	int lod_frame = 0;
+	double lod_delta = 0.0;
+
+	int _get_lod_interval(AnimationPlayer *p_player) const;
+	void _apply_lod_tracks(real_t p_weight);
+#ifndef _3D_DISABLED
+	void _apply_transform_track(TrackCacheTransform *p_track, const Vector3 &p_loc, const Quaternion &p_rot, const Vector3 &p_scale);
+#endif // _3D_DISABLED
+
+	// Trees with threaded blending sample and blend their tracks together on the WorkerThreadPool,
+	// once the frame is processed.
+	bool threaded_blending_enabled = false;
+	bool threaded_blending_pending = false;
+	LocalVector<Vector<real_t>> threaded_blending_track_blends;
+	static BinaryMutex threaded_blending_mutex;
+	static LocalVector<ObjectID> threaded_blending_queue;
+
+	void _queue_threaded_blending();
+	void _finish_threaded_blending();
+	static void _threaded_blending_task(void *p_trees, uint32_t p_index);
+	static void _flush_threaded_blending();
 
 	uint64_t setup_pass = 1;
 	uint64_t process_pass = 1;
@@ -336,6 +375,18 @@ public:
 	void set_animation_player(const NodePath &p_player);
 	NodePath get_animation_player() const;
 
+	void set_threaded_blending_enabled(bool p_enabled);
+	bool is_threaded_blending_enabled() const;
+
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_max_interval(int p_interval);
+	int get_lod_max_interval() const;
+
+	void set_lod_transform_tracks_only(bool p_enabled);
+	bool is_lod_transform_tracks_only() const;
+
 	void set_advance_expression_base_node(const NodePath &p_advance_expression_base_node);
 	NodePath get_advance_expression_base_node() const;
 
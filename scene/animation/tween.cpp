@@ -749,6 +749,16 @@ void PropertyTweener::start() {
 	}
 
 	delta_val = tween->calculate_delta_value(initial_val, final_val);
+
+	property_setget = property.size() == 1 ? ClassDB::get_property_setget(target_instance->get_class_name(), property[0]) : nullptr;
+}
+
+void PropertyTweener::_set_property(Object *p_target, const Variant &p_value) {
+	if (property_setget && !p_target->get_script_instance()) {
+		ClassDB::call_property_setter(p_target, property_setget, p_value);
+	} else {
+		p_target->set_indexed(property, p_value);
+	}
 }
 
 bool PropertyTweener::step(float &r_delta) {
@@ -770,11 +780,11 @@ bool PropertyTweener::step(float &r_delta) {
 
 	float time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
-		target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+		_set_property(target_instance, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		_set_property(target_instance, final_val);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SNAME("finished"));
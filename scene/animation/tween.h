@@ -31,6 +31,7 @@
 #ifndef TWEEN_H
 #define TWEEN_H
 
+#include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 
 class Tween;
@@ -204,6 +205,8 @@ protected:
 private:
 	ObjectID target;
 	Vector<StringName> property;
+	// Resolved in start() for plain properties, so they're set without looking them up on every step.
+	const ClassDB::PropertySetGet *property_setget = nullptr;
 	Variant initial_val;
 	Variant base_final_val;
 	Variant final_val;
@@ -216,6 +219,8 @@ private:
 	float delay = 0;
 	bool do_continue = true;
 	bool relative = false;
+
+	void _set_property(Object *p_target, const Variant &p_value);
 };
 
 class IntervalTweener : public Tweener {
@@ -56,6 +56,7 @@ private:
 	bool autoplay = false;
 	StringName bus = SNAME("Master");
 	int max_polyphony = 1;
+	int voice_priority = 0;
 
 	MixTarget mix_target = MIX_TARGET_STEREO;
 
@@ -89,6 +90,9 @@ public:
 	void set_max_polyphony(int p_max_polyphony);
 	int get_max_polyphony() const;
 
+	void set_voice_priority(int p_voice_priority);
+	int get_voice_priority() const;
+
 	void play(float p_from_pos = 0.0);
 	void seek(float p_seconds);
 	void stop();
@@ -30,7 +30,6 @@
 
 #include "container.h"
 
-#include "core/object/message_queue.h"
 #include "scene/scene_string_names.h"
 
 void Container::_child_minsize_changed() {
@@ -140,8 +139,8 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
 	pending_sort = true;
+	_queue_layout_sort(this);
 }
 
 Vector<int> Container::get_allowed_size_flags_horizontal() const {
@@ -1491,7 +1491,9 @@ void Control::update_minimum_size() {
 
 	data.updating_last_minimum_size = true;
 
-	MessageQueue::get_singleton()->push_call(this, "_update_minimum_size");
+	MutexLock lock(layout_queue_mutex);
+	layout_minimum_size_queue.push_back(get_instance_id());
+	_queue_layout_flush();
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
@@ -1607,6 +1609,106 @@ void Control::_size_changed() {
 	}
 }
 
+LocalVector<ObjectID> Control::layout_minimum_size_queue;
+LocalVector<ObjectID> Control::layout_sort_queue;
+bool Control::layout_flush_queued = false;
+Mutex Control::layout_queue_mutex;
+
+void Control::_queue_layout_sort(Container *p_container) {
+	MutexLock lock(layout_queue_mutex);
+	layout_sort_queue.push_back(p_container->get_instance_id());
+	_queue_layout_flush();
+}
+
+// Must be called with the layout queue mutex held.
+void Control::_queue_layout_flush() {
+	if (layout_flush_queued) {
+		return;
+	}
+	layout_flush_queued = true;
+	MessageQueue::get_singleton()->push_callable(callable_mp_static(&Control::_flush_layout));
+}
+
+struct _LayoutQueueItem {
+	Control *control = nullptr;
+	int depth = 0;
+	uint32_t order = 0;
+};
+
+struct _LayoutQueueDeepestFirst {
+	_FORCE_INLINE_ bool operator()(const _LayoutQueueItem &p_a, const _LayoutQueueItem &p_b) const {
+		return p_a.depth != p_b.depth ? p_a.depth > p_b.depth : p_a.order < p_b.order;
+	}
+};
+
+struct _LayoutQueueShallowestFirst {
+	_FORCE_INLINE_ bool operator()(const _LayoutQueueItem &p_a, const _LayoutQueueItem &p_b) const {
+		return p_a.depth != p_b.depth ? p_a.depth < p_b.depth : p_a.order < p_b.order;
+	}
+};
+
+static void _resolve_layout_queue(LocalVector<ObjectID> &r_queue, LocalVector<_LayoutQueueItem> &r_items) {
+	r_items.clear();
+	for (uint32_t i = 0; i < r_queue.size(); i++) {
+		Control *control = Object::cast_to<Control>(ObjectDB::get_instance(r_queue[i]));
+		if (!control) {
+			continue; // Freed in the meantime.
+		}
+		_LayoutQueueItem item;
+		item.control = control;
+		item.order = i;
+		for (Node *parent = control->get_parent(); parent; parent = parent->get_parent()) {
+			item.depth++;
+		}
+		r_items.push_back(item);
+	}
+	r_queue.clear();
+}
+
+void Control::_flush_layout() {
+	// Minimum sizes are updated from the deepest controls up, so parents see the final size of
+	// their children, and containers are sorted from the top down, so children placed by a sort
+	// are only sorted once afterwards. Anything queued during a pass is handled in the next one.
+	LocalVector<ObjectID> queue;
+	LocalVector<_LayoutQueueItem> items;
+
+	while (true) {
+		bool minimum_size = false;
+		{
+			MutexLock lock(layout_queue_mutex);
+			if (!layout_minimum_size_queue.is_empty()) {
+				SWAP(queue, layout_minimum_size_queue);
+				minimum_size = true;
+			} else if (!layout_sort_queue.is_empty()) {
+				SWAP(queue, layout_sort_queue);
+			} else {
+				layout_flush_queued = false;
+				break;
+			}
+		}
+
+		if (minimum_size) {
+			_resolve_layout_queue(queue, items);
+			items.sort_custom<_LayoutQueueDeepestFirst>();
+			for (uint32_t i = 0; i < items.size(); i++) {
+				if (items[i].control->data.updating_last_minimum_size) {
+					items[i].control->_update_minimum_size();
+				}
+			}
+			continue;
+		}
+
+		_resolve_layout_queue(queue, items);
+		items.sort_custom<_LayoutQueueShallowestFirst>();
+		for (uint32_t i = 0; i < items.size(); i++) {
+			Container *container = static_cast<Container *>(items[i].control);
+			if (container->pending_sort) {
+				container->_sort_children();
+			}
+		}
+	}
+}
+
 void Control::_clear_size_warning() {
 	data.size_warning = false;
 }
@@ -38,6 +38,7 @@
 #include "scene/main/timer.h"
 #include "scene/resources/theme.h"
 
+class Container;
 class Viewport;
 class Label;
 class Panel;
@@ -275,6 +276,17 @@ private:
 	void _update_minimum_size();
 	void _size_changed();
 
+	// Layout updates are batched and flushed once per message queue flush,
+	// so each dirty control is handled once, in depth order. Controls outside
+	// the tree may be queued from other threads, so the queues are locked.
+	static LocalVector<ObjectID> layout_minimum_size_queue;
+	static LocalVector<ObjectID> layout_sort_queue;
+	static bool layout_flush_queued;
+	static Mutex layout_queue_mutex;
+
+	static void _queue_layout_flush();
+	static void _flush_layout();
+
 	void _clear_size_warning();
 
 	// Input events.
@@ -304,6 +316,8 @@ private:
 	String _get_tooltip() const;
 
 protected:
+	static void _queue_layout_sort(Container *p_container);
+
 	// Dynamic properties.
 
 	bool _set(const StringName &p_name, const Variant &p_value);
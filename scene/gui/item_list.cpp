@@ -155,7 +155,6 @@ void ItemList::set_item_tooltip(int p_idx, const String &p_tooltip) {
 
 	items.write[p_idx].tooltip = p_tooltip;
 	update();
-	shape_changed = true;
 }
 
 String ItemList::get_item_tooltip(int p_idx) const {
@@ -270,7 +269,6 @@ void ItemList::set_item_tag_icon(int p_idx, const Ref<Texture2D> &p_tag_icon) {
 
 	items.write[p_idx].tag_icon = p_tag_icon;
 	update();
-	shape_changed = true;
 }
 
 Ref<Texture2D> ItemList::get_item_tag_icon(int p_idx) const {
@@ -316,7 +314,6 @@ void ItemList::set_item_metadata(int p_idx, const Variant &p_metadata) {
 
 	items.write[p_idx].metadata = p_metadata;
 	update();
-	shape_changed = true;
 }
 
 Variant ItemList::get_item_metadata(int p_idx) const {
@@ -1747,9 +1744,6 @@ void ItemList::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("item_clicked", PropertyInfo(Variant::INT, "index"), PropertyInfo(Variant::VECTOR2, "at_position"), PropertyInfo(Variant::INT, "mouse_button_index")));
 	ADD_SIGNAL(MethodInfo("multi_selected", PropertyInfo(Variant::INT, "index"), PropertyInfo(Variant::BOOL, "selected")));
 	ADD_SIGNAL(MethodInfo("item_activated", PropertyInfo(Variant::INT, "index")));
-
-	GLOBAL_DEF("gui/timers/incremental_search_max_interval_msec", 2000);
-	ProjectSettings::get_singleton()->set_custom_property_info("gui/timers/incremental_search_max_interval_msec", PropertyInfo(Variant::INT, "gui/timers/incremental_search_max_interval_msec", PROPERTY_HINT_RANGE, "0,10000,1,or_greater")); // No negative numbers
 }
 
 ItemList::ItemList() {
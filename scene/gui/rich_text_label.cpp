@@ -2789,6 +2789,7 @@ void RichTextLabel::add_text(const String &p_text) {
 
 		pos = end + 1;
 	}
+	_trim_retained_lines();
 	update();
 }
 
@@ -2833,13 +2834,13 @@ void RichTextLabel::_add_item(Item *p_item, bool p_enter, bool p_ensure_newline)
 void RichTextLabel::_remove_item(Item *p_item, const int p_line, const int p_subitem_line) {
 	int size = p_item->subitems.size();
 	if (size == 0) {
-		p_item->parent->subitems.erase(p_item);
+		p_item->parent->subitems.erase(p_item->E);
 		// If a newline was erased, all lines AFTER the newline need to be decremented.
 		if (p_item->type == ITEM_NEWLINE) {
 			current_frame->lines.remove_at(p_line);
-			for (int i = 0; i < current->subitems.size(); i++) {
-				if (current->subitems[i]->line > p_subitem_line) {
-					current->subitems[i]->line--;
+			for (Item *E : current->subitems) {
+				if (E->line > p_subitem_line) {
+					E->line--;
 				}
 			}
 		}
@@ -2849,7 +2850,7 @@ void RichTextLabel::_remove_item(Item *p_item, const int p_line, const int p_sub
 			_remove_item(p_item->subitems.front()->get(), p_line, p_subitem_line);
 		}
 		// Then remove the provided item itself.
-		p_item->parent->subitems.erase(p_item);
+		p_item->parent->subitems.erase(p_item->E);
 	}
 	memdelete(p_item);
 }
@@ -2908,6 +2909,7 @@ void RichTextLabel::add_newline() {
 	_add_item(item, false);
 	current_frame->lines.resize(current_frame->lines.size() + 1);
 	_invalidate_current_line(current_frame);
+	_trim_retained_lines();
 	update();
 }
 
@@ -2919,20 +2921,25 @@ bool RichTextLabel::remove_line(const int p_line) {
 		return false;
 	}
 
+	int line_count = main->lines.size();
+	int first_invalid_line = main->first_invalid_line.load();
+	int first_resized_line = main->first_resized_line.load();
+	int first_invalid_font_line = main->first_invalid_font_line.load();
+
 	// Remove all subitems with the same line as that provided.
-	Vector<int> subitem_indices_to_remove;
-	for (int i = 0; i < current->subitems.size(); i++) {
-		if (current->subitems[i]->line == p_line) {
-			subitem_indices_to_remove.push_back(i);
+	LocalVector<Item *> subitems_to_remove;
+	for (Item *E : current->subitems) {
+		if (E->line == p_line) {
+			subitems_to_remove.push_back(E);
 		}
 	}
 
 	bool had_newline = false;
 	// Reverse for loop to remove items from the end first.
-	for (int i = subitem_indices_to_remove.size() - 1; i >= 0; i--) {
-		int subitem_idx = subitem_indices_to_remove[i];
-		had_newline = had_newline || current->subitems[subitem_idx]->type == ITEM_NEWLINE;
-		_remove_item(current->subitems[subitem_idx], current->subitems[subitem_idx]->line, p_line);
+	for (int i = subitems_to_remove.size() - 1; i >= 0; i--) {
+		Item *subitem = subitems_to_remove[i];
+		had_newline = had_newline || subitem->type == ITEM_NEWLINE;
+		_remove_item(subitem, subitem->line, p_line);
 	}
 
 	if (!had_newline) {
@@ -2946,12 +2953,63 @@ bool RichTextLabel::remove_line(const int p_line) {
 		main->lines[0].from = main;
 	}
 
-	main->first_invalid_line.store(0);
+	if (current_frame == main && (int)main->lines.size() == line_count - 1) {
+		// The other lines keep their shaped text, only the lines after the removed one have to be moved up.
+		first_invalid_line = (first_invalid_line > p_line) ? first_invalid_line - 1 : first_invalid_line;
+		first_resized_line = (first_resized_line > p_line) ? first_resized_line - 1 : first_resized_line;
+		first_invalid_font_line = (first_invalid_font_line > p_line) ? first_invalid_font_line - 1 : first_invalid_font_line;
+		_update_line_offsets(main, p_line, MIN(first_invalid_line, MIN(first_resized_line, first_invalid_font_line)));
+
+		main->first_invalid_line.store(first_invalid_line);
+		main->first_resized_line.store(first_resized_line);
+		main->first_invalid_font_line.store(first_invalid_font_line);
+
+		if (scroll_visible && first_resized_line == (int)main->lines.size() && vscroll->get_max() <= get_size().height) {
+			// The scroll bar may no longer be needed, let the lines be resized to check.
+			main->first_resized_line.store(0);
+		}
+	} else {
+		main->first_invalid_line.store(0);
+	}
 	update();
 
 	return true;
 }
 
+void RichTextLabel::_update_line_offsets(ItemFrame *p_frame, int p_from, int p_to) {
+	if (p_from >= p_to) {
+		return;
+	}
+
+	float total_height = (p_from == 0) ? 0 : _calculate_line_vertical_offset(p_frame->lines[p_from - 1]);
+	int total_chars = (p_from == 0) ? 0 : (p_frame->lines[p_from - 1].char_offset + p_frame->lines[p_from - 1].char_count);
+	for (int i = p_from; i < p_to; i++) {
+		Line &l = p_frame->lines[i];
+		l.offset.y = total_height;
+		l.char_offset = total_chars;
+		total_height = _calculate_line_vertical_offset(l);
+		total_chars += l.char_count;
+	}
+
+	if (p_frame == main && p_to == (int)p_frame->lines.size()) {
+		updating_scroll = true;
+		vscroll->set_max(total_height);
+		if (scroll_follow && scroll_following) {
+			vscroll->set_value(total_height);
+		}
+		updating_scroll = false;
+	}
+}
+
+void RichTextLabel::_trim_retained_lines() {
+	if (max_retained_lines <= 0 || current != main) {
+		return;
+	}
+	while ((int)main->lines.size() > max_retained_lines) {
+		remove_line(0);
+	}
+}
+
 void RichTextLabel::push_dropcap(const String &p_string, const Ref<Font> &p_font, int p_size, const Rect2 &p_dropcap_margins, const Color &p_color, int p_ol_size, const Color &p_ol_color) {
 	_stop_thread();
 	MutexLock data_lock(data_mutex);
@@ -3379,6 +3437,19 @@ int RichTextLabel::get_tab_size() const {
 	return tab_size;
 }
 
+void RichTextLabel::set_max_retained_lines(int p_lines) {
+	ERR_FAIL_COND(p_lines < 0);
+	_stop_thread();
+	MutexLock data_lock(data_mutex);
+
+	max_retained_lines = p_lines;
+	_trim_retained_lines();
+}
+
+int RichTextLabel::get_max_retained_lines() const {
+	return max_retained_lines;
+}
+
 void RichTextLabel::set_fit_content_height(bool p_enabled) {
 	if (p_enabled != fit_content_height) {
 		fit_content_height = p_enabled;
@@ -5056,6 +5127,9 @@ void RichTextLabel::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_tab_size", "spaces"), &RichTextLabel::set_tab_size);
 	ClassDB::bind_method(D_METHOD("get_tab_size"), &RichTextLabel::get_tab_size);
 
+	ClassDB::bind_method(D_METHOD("set_max_retained_lines", "lines"), &RichTextLabel::set_max_retained_lines);
+	ClassDB::bind_method(D_METHOD("get_max_retained_lines"), &RichTextLabel::get_max_retained_lines);
+
 	ClassDB::bind_method(D_METHOD("set_fit_content_height", "enabled"), &RichTextLabel::set_fit_content_height);
 	ClassDB::bind_method(D_METHOD("is_fit_content_height_enabled"), &RichTextLabel::is_fit_content_height_enabled);
 
@@ -5135,6 +5209,7 @@ void RichTextLabel::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "progress_bar_delay", PROPERTY_HINT_NONE, "suffix:ms"), "set_progress_bar_delay", "get_progress_bar_delay");
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "tab_size", PROPERTY_HINT_RANGE, "0,24,1"), "set_tab_size", "get_tab_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_retained_lines", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), "set_max_retained_lines", "get_max_retained_lines");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "text", PROPERTY_HINT_MULTILINE_TEXT), "set_text", "get_text");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "fit_content_height"), "set_fit_content_height", "is_fit_content_height_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_active"), "set_scroll_active", "is_scroll_active");
@@ -380,6 +380,7 @@ private:
 	int visible_line_count = 0;
 
 	int tab_size = 4;
+	int max_retained_lines = 0;
 	bool underline_meta = true;
 	bool underline_hint = true;
 	bool override_selected_font_color = false;
@@ -400,6 +401,8 @@ private:
 
 	void _add_item(Item *p_item, bool p_enter = false, bool p_ensure_newline = false);
 	void _remove_item(Item *p_item, const int p_line, const int p_subitem_line);
+	void _update_line_offsets(ItemFrame *p_frame, int p_from, int p_to);
+	void _trim_retained_lines();
 
 	String language;
 	TextDirection text_direction = TEXT_DIRECTION_AUTO;
@@ -576,6 +579,9 @@ public:
 	void set_tab_size(int p_spaces);
 	int get_tab_size() const;
 
+	void set_max_retained_lines(int p_lines);
+	int get_max_retained_lines() const;
+
 	void set_context_menu_enabled(bool p_enabled);
 	bool is_context_menu_enabled() const;
 
@@ -94,6 +94,7 @@ void TextEdit::Text::set_draw_control_chars(bool p_enabled) {
 
 int TextEdit::Text::get_line_width(int p_line, int p_wrap_index) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
+	_ensure_line_metrics(p_line);
 	if (p_wrap_index != -1) {
 		return text[p_line].data_buf->get_line_width(p_wrap_index);
 	}
@@ -114,6 +115,7 @@ float TextEdit::Text::get_width() const {
 
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
+	_ensure_line_metrics(p_line);
 
 	return text[p_line].data_buf->get_line_count() - 1;
 }
@@ -121,6 +123,7 @@ int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 	Vector<Vector2i> ret;
 	ERR_FAIL_INDEX_V(p_line, text.size(), ret);
+	_ensure_line_metrics(p_line);
 
 	for (int i = 0; i < text[p_line].data_buf->get_line_count(); i++) {
 		ret.push_back(text[p_line].data_buf->get_line_range(i));
@@ -130,6 +133,7 @@ Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 
 const Ref<TextParagraph> TextEdit::Text::get_line_data(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), Ref<TextParagraph>());
+	_ensure_line_metrics(p_line);
 	return text[p_line].data_buf;
 }
 
@@ -137,7 +141,7 @@ _FORCE_INLINE_ const String &TextEdit::Text::operator[](int p_line) const {
 	return text[p_line].data;
 }
 
-void TextEdit::Text::_calculate_line_height() {
+void TextEdit::Text::_calculate_line_height() const {
 	int height = 0;
 	for (const Line &l : text) {
 		// Found another line with the same height...nothing to update.
@@ -150,7 +154,7 @@ void TextEdit::Text::_calculate_line_height() {
 	line_height = height;
 }
 
-void TextEdit::Text::_calculate_max_line_width() {
+void TextEdit::Text::_calculate_max_line_width() const {
 	int width = 0;
 	for (const Line &l : text) {
 		if (l.hidden) {
@@ -215,14 +219,23 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 		text.write[p_line].data_buf->tab_align(tabs);
 	}
 
+	// The size is updated when it's needed, so only lines that are shown get shaped.
+	text.write[p_line].metrics_dirty = true;
+	line_height = MAX(line_height, font_height);
+}
+
+void TextEdit::Text::_update_line_metrics(int p_line) const {
+	Line &line = text.write[p_line];
+	line.metrics_dirty = false;
+
 	// Update height.
-	const int old_height = text.write[p_line].height;
-	const int wrap_amount = get_line_wrap_amount(p_line);
+	const int old_height = line.height;
+	const int wrap_amount = line.data_buf->get_line_count() - 1;
 	int height = font_height;
 	for (int i = 0; i <= wrap_amount; i++) {
-		height = MAX(height, text[p_line].data_buf->get_line_size(i).y);
+		height = MAX(height, line.data_buf->get_line_size(i).y);
 	}
-	text.write[p_line].height = height;
+	line.height = height;
 
 	// If this line has shrunk, this may no longer the the tallest line.
 	if (old_height == line_height && height < line_height) {
@@ -232,14 +245,14 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 	}
 
 	// Update width.
-	const int old_width = text.write[p_line].width;
-	int width = get_line_width(p_line);
-	text.write[p_line].width = width;
+	const int old_width = line.width;
+	int width = line.data_buf->get_size().x;
+	line.width = width;
 
 	// If this line has shrunk, this may no longer the the longest line.
 	if (old_width == max_width && width < max_width) {
 		_calculate_max_line_width();
-	} else if (!is_hidden(p_line)) {
+	} else if (!line.hidden) {
 		max_width = MAX(width, max_width);
 	}
 }
@@ -254,7 +267,7 @@ void TextEdit::Text::invalidate_all_lines() {
 				text.write[i].data_buf->tab_align(tabs);
 			}
 			// Tabs have changes, force width update.
-			text.write[i].width = get_line_width(i);
+			text.write[i].metrics_dirty = true;
 		}
 	}
 
@@ -5451,12 +5464,6 @@ void TextEdit::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("gutter_clicked", PropertyInfo(Variant::INT, "line"), PropertyInfo(Variant::INT, "gutter")));
 	ADD_SIGNAL(MethodInfo("gutter_added"));
 	ADD_SIGNAL(MethodInfo("gutter_removed"));
-
-	/* Settings. */
-	GLOBAL_DEF("gui/timers/text_edit_idle_detect_sec", 3);
-	ProjectSettings::get_singleton()->set_custom_property_info("gui/timers/text_edit_idle_detect_sec", PropertyInfo(Variant::FLOAT, "gui/timers/text_edit_idle_detect_sec", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater")); // No negative numbers.
-	GLOBAL_DEF("gui/common/text_edit_undo_stack_max_size", 1024);
-	ProjectSettings::get_singleton()->set_custom_property_info("gui/common/text_edit_undo_stack_max_size", PropertyInfo(Variant::INT, "gui/common/text_edit_undo_stack_max_size", PROPERTY_HINT_RANGE, "0,10000,1,or_greater")); // No negative numbers.
 }
 
 /* Internal API for CodeEdit. */
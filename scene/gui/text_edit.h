@@ -143,6 +143,7 @@ private:
 
 			Color background_color = Color(0, 0, 0, 0);
 			bool hidden = false;
+			bool metrics_dirty = false;
 			int height = 0;
 			int width = 0;
 
@@ -164,15 +165,23 @@ private:
 		TextServer::Direction direction = TextServer::DIRECTION_AUTO;
 		bool draw_control_chars = false;
 
-		int line_height = -1;
-		int max_width = -1;
+		mutable int line_height = -1;
+		mutable int max_width = -1;
 		int width = -1;
 
 		int tab_size = 4;
 		int gutter_count = 0;
 
-		void _calculate_line_height();
-		void _calculate_max_line_width();
+		void _calculate_line_height() const;
+		void _calculate_max_line_width() const;
+
+		// Shaping a line is only done when its size is first needed, usually when it gets drawn.
+		void _update_line_metrics(int p_line) const;
+		_FORCE_INLINE_ void _ensure_line_metrics(int p_line) const {
+			if (text[p_line].metrics_dirty) {
+				_update_line_metrics(p_line);
+			}
+		}
 
 	public:
 		void set_tab_size(int p_tab_size);
@@ -126,12 +126,15 @@ void TreeItem::_change_tree(Tree *p_tree) {
 			tree->pressing_for_editor = false;
 		}
 
+		tree->_invalidate_item_heights();
 		tree->update();
 	}
 
 	tree = p_tree;
+	height_dirty = true;
 
 	if (tree) {
+		tree->_invalidate_item_heights();
 		tree->update();
 		cells.resize(tree->columns.size());
 	}
@@ -556,6 +559,7 @@ TreeItem *TreeItem::create_child(int p_idx) {
 	TreeItem *ti = memnew(TreeItem(tree));
 	if (tree) {
 		ti->cells.resize(tree->columns.size());
+		tree->_invalidate_item_heights();
 		tree->update();
 	}
 
@@ -805,6 +809,7 @@ void TreeItem::move_before(TreeItem *p_item) {
 	p_item->prev = this;
 
 	if (tree && old_tree == tree) {
+		tree->_invalidate_item_heights();
 		tree->update();
 	}
 }
@@ -843,6 +848,7 @@ void TreeItem::move_after(TreeItem *p_item) {
 	}
 
 	if (tree && old_tree == tree) {
+		tree->_invalidate_item_heights();
 		tree->update();
 	}
 }
@@ -857,6 +863,7 @@ void TreeItem::remove_child(TreeItem *p_item) {
 	p_item->parent = nullptr;
 
 	if (tree) {
+		tree->_invalidate_item_heights();
 		tree->update();
 	}
 }
@@ -1396,6 +1403,9 @@ TreeItem::TreeItem(Tree *p_tree) {
 
 TreeItem::~TreeItem() {
 	_unlink_from_tree();
+	if (tree) {
+		tree->_invalidate_item_heights();
+	}
 	prev = nullptr;
 	clear_children();
 	_change_tree(nullptr);
@@ -1478,6 +1488,10 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 	}
 
 	ERR_FAIL_COND_V(cache.font.is_null(), 0);
+	if (!p_item->height_dirty) {
+		return p_item->height_cache;
+	}
+
 	int height = 0;
 
 	for (int i = 0; i < columns.size(); i++) {
@@ -1530,6 +1544,8 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 
 	height += cache.vseparation;
 
+	p_item->height_cache = height;
+	p_item->height_dirty = false;
 	return height;
 }
 
@@ -1537,6 +1553,10 @@ int Tree::get_item_height(TreeItem *p_item) const {
 	if (!p_item->is_visible()) {
 		return 0;
 	}
+	if (p_item->subtree_height_version == item_heights_version) {
+		return p_item->subtree_height_cache;
+	}
+
 	int height = compute_item_height(p_item);
 	height += cache.vseparation;
 
@@ -1551,6 +1571,8 @@ int Tree::get_item_height(TreeItem *p_item) const {
 		}
 	}
 
+	p_item->subtree_height_cache = height;
+	p_item->subtree_height_version = item_heights_version;
 	return height;
 }
 
@@ -1704,6 +1726,7 @@ void Tree::update_item_cache(TreeItem *p_item) {
 	for (int i = 0; i < p_item->cells.size(); i++) {
 		update_item_cell(p_item, i);
 	}
+	p_item->height_dirty = true;
 
 	TreeItem *c = p_item->first_child;
 	while (c) {
@@ -1721,6 +1744,14 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 		return 0;
 	}
 
+	if (p_item != root) {
+		// Nothing to draw if the item and its children end above the visible area.
+		int item_h = get_item_height(p_item);
+		if (p_pos.y + item_h - cache.offset.y <= 0) {
+			return item_h;
+		}
+	}
+
 	RID ci = get_canvas_item();
 
 	int htotal = 0;
@@ -3895,6 +3926,7 @@ void Tree::_notification(int p_what) {
 }
 
 void Tree::_update_all() {
+	_invalidate_item_heights();
 	for (int i = 0; i < columns.size(); i++) {
 		update_column(i);
 	}
@@ -3978,6 +4010,10 @@ void Tree::item_changed(int p_column, TreeItem *p_item) {
 	if (p_item != nullptr && p_column >= 0 && p_column < p_item->cells.size()) {
 		p_item->cells.write[p_column].dirty = true;
 	}
+	if (p_item != nullptr) {
+		p_item->height_dirty = true;
+	}
+	_invalidate_item_heights();
 	update();
 }
 
@@ -4058,6 +4094,7 @@ void Tree::clear() {
 		memdelete(root);
 		root = nullptr;
 	};
+	_invalidate_item_heights();
 
 	selected_item = nullptr;
 	edited_item = nullptr;
@@ -4069,6 +4106,7 @@ void Tree::clear() {
 
 void Tree::set_hide_root(bool p_enabled) {
 	hide_root = p_enabled;
+	_invalidate_item_heights();
 	update();
 }
 
@@ -4257,6 +4295,7 @@ int Tree::get_column_width(int p_column) const {
 
 void Tree::propagate_set_columns(TreeItem *p_item) {
 	p_item->cells.resize(columns.size());
+	p_item->height_dirty = true;
 
 	TreeItem *c = p_item->get_first_child();
 	while (c) {
@@ -4276,6 +4315,7 @@ void Tree::set_columns(int p_columns) {
 	if (selected_col >= p_columns) {
 		selected_col = p_columns - 1;
 	}
+	_invalidate_item_heights();
 	update();
 }
 
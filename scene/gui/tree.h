@@ -127,6 +127,12 @@ private:
 	bool disable_folding = false;
 	int custom_min_height = 0;
 
+	// Heights cached by the tree, see Tree::compute_item_height() and Tree::get_item_height().
+	bool height_dirty = true;
+	int height_cache = 0;
+	uint64_t subtree_height_version = 0;
+	int subtree_height_cache = 0;
+
 	TreeItem *parent = nullptr; // parent item
 	TreeItem *prev = nullptr; // previous in list
 	TreeItem *next = nullptr; // next in list
@@ -413,6 +419,10 @@ private:
 	bool hide_root = false;
 	SelectMode select_mode = SELECT_SINGLE;
 
+	// Bumped whenever items are added, removed, moved or changed, so the cached subtree heights get recomputed.
+	uint64_t item_heights_version = 1;
+	_FORCE_INLINE_ void _invalidate_item_heights() { item_heights_version++; }
+
 	int blocked = 0;
 
 	int drop_mode_flags = 0;
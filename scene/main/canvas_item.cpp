@@ -312,8 +312,8 @@ void CanvasItem::_notification(int p_what) {
 			_update_texture_filter_changed(false);
 			_update_texture_repeat_changed(false);
 
-			if (!block_transform_notify && !xform_change.in_list()) {
-				get_tree()->xform_change_list.add(&xform_change);
+			if (!block_transform_notify) {
+				get_tree()->_add_xform_change(&xform_change);
 			}
 		} break;
 
@@ -332,9 +332,7 @@ void CanvasItem::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
-			if (xform_change.in_list()) {
-				get_tree()->xform_change_list.remove(&xform_change);
-			}
+			get_tree()->_remove_xform_change(&xform_change);
 			_exit_canvas();
 			if (C) {
 				Object::cast_to<CanvasItem>(get_parent())->children_items.erase(C);
@@ -718,10 +716,10 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 
 	p_node->global_invalid = true;
 
-	if (p_node->notify_transform && !p_node->xform_change.in_list()) {
+	if (p_node->notify_transform) {
 		if (!p_node->block_transform_notify) {
 			if (p_node->is_inside_tree()) {
-				get_tree()->xform_change_list.add(&p_node->xform_change);
+				get_tree()->_add_xform_change(&p_node->xform_change);
 			}
 		}
 	}
@@ -854,12 +852,10 @@ Vector2 CanvasItem::get_local_mouse_position() const {
 
 void CanvasItem::force_update_transform() {
 	ERR_FAIL_COND(!is_inside_tree());
-	if (!xform_change.in_list()) {
+	if (!get_tree()->_remove_xform_change(&xform_change)) {
 		return;
 	}
 
-	get_tree()->xform_change_list.remove(&xform_change);
-
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
 
@@ -35,10 +35,95 @@
 void HTTPRequest::_redirect_request(const String &p_new_url) {
 }
 
+HashMap<String, List<Ref<HTTPClient>>> HTTPRequest::connection_pool;
+Mutex HTTPRequest::connection_pool_mutex;
+
 Error HTTPRequest::_request() {
+	if (reused_connection) {
+		return OK; // Already connected to the host.
+	}
 	return client->connect_to_host(url, port, use_ssl, validate_ssl);
 }
 
+String HTTPRequest::_get_connection_pool_key() const {
+	String key = vformat("%s:%d:%d:%d", url, port, int(use_ssl), int(validate_ssl));
+	if (!http_proxy_host.is_empty() || !https_proxy_host.is_empty()) {
+		key += vformat("|%s:%d|%s:%d", http_proxy_host, http_proxy_port, https_proxy_host, https_proxy_port);
+	}
+	return key;
+}
+
+Ref<HTTPClient> HTTPRequest::_create_client() const {
+	Ref<HTTPClient> new_client = Ref<HTTPClient>(HTTPClient::create());
+	new_client->set_read_chunk_size(client->get_read_chunk_size());
+	new_client->set_http_proxy(http_proxy_host, http_proxy_port);
+	new_client->set_https_proxy(https_proxy_host, https_proxy_port);
+	return new_client;
+}
+
+void HTTPRequest::_acquire_pooled_connection() {
+	reused_connection = false;
+	if (!use_connection_pool) {
+		return;
+	}
+
+	Ref<HTTPClient> pooled;
+	{
+		MutexLock lock(connection_pool_mutex);
+		List<Ref<HTTPClient>> *idle = connection_pool.getptr(_get_connection_pool_key());
+		while (idle && !idle->is_empty()) {
+			Ref<HTTPClient> candidate = idle->back()->get();
+			idle->pop_back();
+			// The server may have closed the connection while it was idle.
+			candidate->poll();
+			if (candidate->get_status() == HTTPClient::STATUS_CONNECTED) {
+				pooled = candidate;
+				break;
+			}
+		}
+	}
+
+	if (pooled.is_valid()) {
+		pooled->set_read_chunk_size(client->get_read_chunk_size());
+		client = pooled;
+		reused_connection = true;
+	}
+}
+
+void HTTPRequest::_release_pooled_connection() {
+	if (!use_connection_pool || client->get_status() != HTTPClient::STATUS_CONNECTED) {
+		return;
+	}
+
+	{
+		MutexLock lock(connection_pool_mutex);
+		List<Ref<HTTPClient>> &idle = connection_pool[_get_connection_pool_key()];
+		if (idle.size() >= MAX_POOLED_CONNECTIONS_PER_HOST) {
+			return;
+		}
+		idle.push_back(client);
+	}
+
+	client = _create_client();
+}
+
+bool HTTPRequest::_retry_reused_connection() {
+	// The server may have closed an idle connection right when it was reused, retry once with a new one.
+	if (!reused_connection || got_response) {
+		return false;
+	}
+
+	reused_connection = false;
+	request_sent = false;
+	client->close();
+	return client->connect_to_host(url, port, use_ssl, validate_ssl) == OK;
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(connection_pool_mutex);
+	connection_pool.clear();
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_ssl = false;
 	request_string = "";
@@ -142,6 +227,8 @@ Error HTTPRequest::request_raw(const String &p_url, const Vector<String> &p_cust
 
 	request_data = p_request_data_raw;
 
+	_acquire_pooled_connection();
+
 	requesting = true;
 
 	if (use_threads.is_set()) {
@@ -184,6 +271,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_cancel_request(false);
+}
+
+void HTTPRequest::_cancel_request(bool p_release_connection) {
 	timer->stop();
 
 	if (!requesting) {
@@ -197,6 +288,10 @@ void HTTPRequest::cancel_request() {
 		thread.wait_to_finish();
 	}
 
+	if (p_release_connection) {
+		_release_pooled_connection();
+	}
+
 	file.unref();
 	client->close();
 	body.clear();
@@ -208,6 +303,10 @@ void HTTPRequest::cancel_request() {
 
 bool HTTPRequest::_handle_response(bool *ret_value) {
 	if (!client->has_response()) {
+		if (_retry_reused_connection()) {
+			*ret_value = false;
+			return true;
+		}
 		call_deferred(SNAME("_request_done"), RESULT_NO_RESPONSE, 0, PackedStringArray(), PackedByteArray());
 		*ret_value = true;
 		return true;
@@ -243,6 +342,7 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 		if (!new_request.is_empty()) {
 			// Process redirect.
 			client->close();
+			reused_connection = false;
 			int new_redirs = redirections + 1; // Because _request() will clear it.
 			Error err;
 			if (new_request.begins_with("http")) {
@@ -272,6 +372,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_reused_connection()) {
+				return false;
+			}
 			call_deferred(SNAME("_request_done"), RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -410,6 +513,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_reused_connection()) {
+				return false;
+			}
 			call_deferred(SNAME("_request_done"), RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -423,7 +529,8 @@ bool HTTPRequest::_update_connection() {
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	// Keep the connection open for the next request to the same host if the response was fully read.
+	_cancel_request(p_status == RESULT_SUCCESS);
 
 	// Determine if the request body is compressed.
 	bool is_compressed;
@@ -497,6 +604,14 @@ bool HTTPRequest::is_accepting_gzip() const {
 	return accept_gzip;
 }
 
+void HTTPRequest::set_use_connection_pool(bool p_use) {
+	use_connection_pool = p_use;
+}
+
+bool HTTPRequest::is_using_connection_pool() const {
+	return use_connection_pool;
+}
+
 void HTTPRequest::set_body_size_limit(int p_bytes) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -548,10 +663,14 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
 	client->set_https_proxy(p_host, p_port);
 }
 
@@ -582,6 +701,9 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
+	ClassDB::bind_method(D_METHOD("set_use_connection_pool", "enable"), &HTTPRequest::set_use_connection_pool);
+	ClassDB::bind_method(D_METHOD("is_using_connection_pool"), &HTTPRequest::is_using_connection_pool);
+
 	ClassDB::bind_method(D_METHOD("set_body_size_limit", "bytes"), &HTTPRequest::set_body_size_limit);
 	ClassDB::bind_method(D_METHOD("get_body_size_limit"), &HTTPRequest::get_body_size_limit);
 
@@ -609,6 +731,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "download_file", PROPERTY_HINT_FILE), "set_download_file", "get_download_file");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_connection_pool"), "set_use_connection_pool", "is_using_connection_pool");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
@@ -32,7 +32,10 @@
 #define HTTP_REQUEST_H
 
 #include "core/io/http_client.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -61,6 +64,14 @@ public:
 	};
 
 private:
+	enum {
+		MAX_POOLED_CONNECTIONS_PER_HOST = 4,
+	};
+
+	// Idle keep-alive connections, shared by all nodes using the connection pool.
+	static HashMap<String, List<Ref<HTTPClient>>> connection_pool;
+	static Mutex connection_pool_mutex;
+
 	bool requesting = false;
 
 	String request_string;
@@ -77,6 +88,13 @@ private:
 	PackedByteArray body;
 	SafeFlag use_threads;
 	bool accept_gzip = true;
+	bool use_connection_pool = false;
+	bool reused_connection = false;
+
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
 
 	bool got_response = false;
 	int response_code = 0;
@@ -105,6 +123,12 @@ private:
 	Error _parse_url(const String &p_url);
 	Error _request();
 
+	String _get_connection_pool_key() const;
+	Ref<HTTPClient> _create_client() const;
+	void _acquire_pooled_connection();
+	void _release_pooled_connection();
+	bool _retry_reused_connection();
+
 	bool has_header(const PackedStringArray &p_headers, const String &p_header_name);
 	String get_header_value(const PackedStringArray &p_headers, const String &header_name);
 
@@ -113,6 +137,7 @@ private:
 
 	Thread thread;
 
+	void _cancel_request(bool p_release_connection);
 	void _request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data);
 	static void _thread_func(void *p_userdata);
 
@@ -132,6 +157,11 @@ public:
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
+	void set_use_connection_pool(bool p_use);
+	bool is_using_connection_pool() const;
+
+	static void clear_connection_pool();
+
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
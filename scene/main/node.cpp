@@ -35,6 +35,7 @@
 #include "core/io/resource_loader.h"
 #include "core/multiplayer/multiplayer_api.h"
 #include "core/object/message_queue.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "instance_placeholder.h"
 #include "scene/animation/tween.h"
@@ -46,9 +47,17 @@
 #include <stdint.h>
 
 VARIANT_ENUM_CAST(Node::ProcessMode);
+VARIANT_ENUM_CAST(Node::ProcessThreadGroup);
+VARIANT_ENUM_CAST(Node::PhysicsInterpolationMode);
 VARIANT_ENUM_CAST(Node::InternalMode);
 
 int Node::orphan_node_count = 0;
+SafeNumeric<uint64_t> Node::node_path_lookup_generation;
+
+// Nodes processed in a sub-thread group can't change the tree directly, only defer the changes to the main thread.
+static _FORCE_INLINE_ bool _is_off_main_thread() {
+	return Thread::get_caller_id() != Thread::get_main_id();
+}
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -76,6 +85,18 @@ void Node::_notification(int p_notification) {
 				data.process_owner = this;
 			}
 
+			if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+				data.process_thread_group_owner = data.parent ? data.parent->data.process_thread_group_owner : nullptr;
+			} else {
+				data.process_thread_group_owner = this;
+			}
+
+			if (data.physics_interpolation_mode == PHYSICS_INTERPOLATION_MODE_INHERIT) {
+				data.physics_interpolated = data.parent ? data.parent->data.physics_interpolated : true;
+			} else {
+				data.physics_interpolated = data.physics_interpolation_mode == PHYSICS_INTERPOLATION_MODE_ON;
+			}
+
 			if (data.input) {
 				add_to_group("_vp_input" + itos(get_viewport()->get_instance_id()));
 			}
@@ -262,6 +283,7 @@ void Node::_propagate_after_exit_tree() {
 			}
 			data.owner->data.owned.erase(data.OW);
 			data.owner = nullptr;
+			_invalidate_node_path_lookups();
 		}
 	}
 
@@ -324,6 +346,7 @@ void Node::_propagate_exit_tree() {
 
 void Node::move_child(Node *p_child, int p_pos) {
 	ERR_FAIL_NULL(p_child);
+	ERR_FAIL_COND_MSG(data.inside_tree && _is_off_main_thread(), "Moving children of a node inside the SceneTree is only allowed from the main thread. Consider using call_deferred(\"move_child\", child, to_position) instead.");
 	ERR_FAIL_COND_MSG(p_child->data.parent != this, "Child is not a child of this node.");
 
 	// We need to check whether node is internal and move it only in the relevant node range.
@@ -436,6 +459,11 @@ void Node::set_physics_process(bool p_process) {
 		return;
 	}
 
+	if (data.inside_tree && _is_off_main_thread()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Node::set_physics_process), p_process);
+		return;
+	}
+
 	data.physics_process = p_process;
 
 	if (data.physics_process) {
@@ -454,6 +482,11 @@ void Node::set_physics_process_internal(bool p_process_internal) {
 		return;
 	}
 
+	if (data.inside_tree && _is_off_main_thread()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Node::set_physics_process_internal), p_process_internal);
+		return;
+	}
+
 	data.physics_process_internal = p_process_internal;
 
 	if (data.physics_process_internal) {
@@ -541,6 +574,90 @@ Node::ProcessMode Node::get_process_mode() const {
 	return data.process_mode;
 }
 
+void Node::set_process_thread_group(ProcessThreadGroup p_group) {
+	ERR_FAIL_INDEX(p_group, PROCESS_THREAD_GROUP_SUB_THREAD + 1);
+	if (data.process_thread_group == p_group) {
+		return;
+	}
+
+	if (data.inside_tree) {
+		ERR_FAIL_COND_MSG(_is_off_main_thread(), "The process thread group of a node inside the SceneTree can only be changed from the main thread.");
+		ERR_FAIL_COND_MSG(data.tree->is_processing_in_threads(), "Can't change the process thread group of a node while sub-thread groups are being processed.");
+	}
+
+	data.process_thread_group = p_group;
+
+	if (!data.inside_tree) {
+		return;
+	}
+
+	if (p_group == PROCESS_THREAD_GROUP_INHERIT) {
+		_propagate_process_thread_group_owner(data.parent ? data.parent->data.process_thread_group_owner : nullptr);
+	} else {
+		_propagate_process_thread_group_owner(this);
+	}
+}
+
+Node::ProcessThreadGroup Node::get_process_thread_group() const {
+	return data.process_thread_group;
+}
+
+void Node::set_physics_interpolation_mode(PhysicsInterpolationMode p_mode) {
+	ERR_FAIL_INDEX(p_mode, 3);
+	if (data.physics_interpolation_mode == p_mode) {
+		return;
+	}
+
+	data.physics_interpolation_mode = p_mode;
+
+	if (!is_inside_tree()) {
+		return; // Resolved when entering the tree.
+	}
+
+	if (p_mode == PHYSICS_INTERPOLATION_MODE_INHERIT) {
+		_propagate_physics_interpolated(data.parent ? data.parent->data.physics_interpolated : true);
+	} else {
+		_propagate_physics_interpolated(p_mode == PHYSICS_INTERPOLATION_MODE_ON);
+	}
+}
+
+Node::PhysicsInterpolationMode Node::get_physics_interpolation_mode() const {
+	return data.physics_interpolation_mode;
+}
+
+void Node::reset_physics_interpolation() {
+	if (is_inside_tree()) {
+		propagate_notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+	}
+}
+
+void Node::_propagate_physics_interpolated(bool p_interpolated) {
+	if (data.physics_interpolated == p_interpolated) {
+		return;
+	}
+
+	data.physics_interpolated = p_interpolated;
+	_physics_interpolated_changed();
+
+	for (int i = 0; i < data.children.size(); i++) {
+		Node *c = data.children[i];
+		if (c->data.physics_interpolation_mode == PHYSICS_INTERPOLATION_MODE_INHERIT) {
+			c->_propagate_physics_interpolated(p_interpolated);
+		}
+	}
+}
+
+void Node::_propagate_process_thread_group_owner(Node *p_owner) {
+	data.process_thread_group_owner = p_owner;
+
+	for (int i = 0; i < data.children.size(); i++) {
+		Node *c = data.children[i];
+		if (c->data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+			c->_propagate_process_thread_group_owner(p_owner);
+		}
+	}
+}
+
 void Node::_propagate_process_owner(Node *p_owner, int p_pause_notification, int p_enabled_notification) {
 	data.process_owner = p_owner;
 
@@ -767,6 +884,11 @@ void Node::set_process(bool p_process) {
 		return;
 	}
 
+	if (data.inside_tree && _is_off_main_thread()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Node::set_process), p_process);
+		return;
+	}
+
 	data.process = p_process;
 
 	if (data.process) {
@@ -785,6 +907,11 @@ void Node::set_process_internal(bool p_process_internal) {
 		return;
 	}
 
+	if (data.inside_tree && _is_off_main_thread()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Node::set_process_internal), p_process_internal);
+		return;
+	}
+
 	data.process_internal = p_process_internal;
 
 	if (data.process_internal) {
@@ -914,6 +1041,7 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	_invalidate_node_path_lookups();
 }
 
 void Node::set_name(const String &p_name) {
@@ -934,6 +1062,7 @@ void Node::set_name(const String &p_name) {
 		_acquire_unique_name_in_owner();
 	}
 
+	_invalidate_node_path_lookups();
 	propagate_notification(NOTIFICATION_PATH_RENAMED);
 
 	if (is_inside_tree()) {
@@ -1123,6 +1252,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	p_child->data.pos = data.children.size();
 	data.children.push_back(p_child);
 	p_child->data.parent = this;
+	_invalidate_node_path_lookups();
 
 	if (data.internal_children_back > 0) {
 		_move_child(p_child, data.children.size() - data.internal_children_back - 1);
@@ -1147,6 +1277,7 @@ void Node::add_child(Node *p_child, bool p_legible_unique_name, InternalMode p_i
 	ERR_FAIL_COND_MSG(p_child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", p_child->get_name(), get_name(), p_child->get_name(), get_name()));
 #endif
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, add_node() failed. Consider using call_deferred(\"add_child\", child) instead.");
+	ERR_FAIL_COND_MSG(data.inside_tree && _is_off_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Consider using call_deferred(\"add_child\", child) instead.");
 
 	_validate_child_name(p_child, p_legible_unique_name);
 	_add_child_nocheck(p_child, p_child->data.name);
@@ -1182,6 +1313,7 @@ void Node::add_sibling(Node *p_sibling, bool p_legible_unique_name) {
 void Node::remove_child(Node *p_child) {
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, remove_node() failed. Consider using call_deferred(\"remove_child\", child) instead.");
+	ERR_FAIL_COND_MSG(data.inside_tree && _is_off_main_thread(), "Removing children from a node inside the SceneTree is only allowed from the main thread. Consider using call_deferred(\"remove_child\", child) instead.");
 
 	int child_count = data.children.size();
 	Node **children = data.children.ptrw();
@@ -1231,6 +1363,7 @@ void Node::remove_child(Node *p_child) {
 
 	p_child->data.parent = nullptr;
 	p_child->data.pos = -1;
+	_invalidate_node_path_lookups();
 
 	if (data.inside_tree) {
 		p_child->_propagate_after_exit_tree();
@@ -1282,6 +1415,37 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Single names are resolved with one scan of the children, not worth caching.
+	// The cache isn't shared between threads, so only the main thread uses it.
+	if (p_path.get_name_count() < 2 || _is_off_main_thread()) {
+		return _resolve_node_path(p_path);
+	}
+
+	uint64_t generation = node_path_lookup_generation.get();
+	if (!data.node_path_lookups) {
+		data.node_path_lookups = memnew(NodePathLookups);
+	}
+	NodePathLookups *lookups = data.node_path_lookups;
+
+	if (lookups->generation != generation) {
+		lookups->nodes.clear();
+		lookups->generation = generation;
+	} else {
+		Node **cached = lookups->nodes.getptr(p_path);
+		if (cached) {
+			return *cached;
+		}
+	}
+
+	Node *node = _resolve_node_path(p_path);
+	if (lookups->nodes.size() >= MAX_NODE_PATH_LOOKUPS) {
+		lookups->nodes.clear();
+	}
+	lookups->nodes.insert(p_path, node);
+	return node;
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1555,6 +1719,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
+	_invalidate_node_path_lookups();
 
 	owner_changed_notify();
 }
@@ -1567,6 +1732,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	_invalidate_node_path_lookups();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -1581,6 +1747,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	_invalidate_node_path_lookups();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -1612,6 +1779,7 @@ void Node::set_owner(Node *p_owner) {
 		data.owner->data.owned.erase(data.OW);
 		data.OW = nullptr;
 		data.owner = nullptr;
+		_invalidate_node_path_lookups();
 	}
 
 	ERR_FAIL_COND(p_owner == this);
@@ -2790,11 +2958,6 @@ void Node::unhandled_key_input(const Ref<InputEvent> &p_key_event) {
 }
 
 void Node::_bind_methods() {
-	GLOBAL_DEF("editor/node_naming/name_num_separator", 0);
-	ProjectSettings::get_singleton()->set_custom_property_info("editor/node_naming/name_num_separator", PropertyInfo(Variant::INT, "editor/node_naming/name_num_separator", PROPERTY_HINT_ENUM, "None,Space,Underscore,Dash"));
-	GLOBAL_DEF("editor/node_naming/name_casing", NAME_CASING_PASCAL_CASE);
-	ProjectSettings::get_singleton()->set_custom_property_info("editor/node_naming/name_casing", PropertyInfo(Variant::INT, "editor/node_naming/name_casing", PROPERTY_HINT_ENUM, "PascalCase,camelCase,snake_case"));
-
 	ClassDB::bind_method(D_METHOD("add_sibling", "sibling", "legible_unique_name"), &Node::add_sibling, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("set_name", "name"), &Node::set_name);
@@ -2853,6 +3016,12 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_processing_unhandled_key_input"), &Node::is_processing_unhandled_key_input);
 	ClassDB::bind_method(D_METHOD("set_process_mode", "mode"), &Node::set_process_mode);
 	ClassDB::bind_method(D_METHOD("get_process_mode"), &Node::get_process_mode);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group", "group"), &Node::set_process_thread_group);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group"), &Node::get_process_thread_group);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolation_mode", "mode"), &Node::set_physics_interpolation_mode);
+	ClassDB::bind_method(D_METHOD("get_physics_interpolation_mode"), &Node::get_physics_interpolation_mode);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolated"), &Node::is_physics_interpolated);
+	ClassDB::bind_method(D_METHOD("reset_physics_interpolation"), &Node::reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("can_process"), &Node::can_process);
 	ClassDB::bind_method(D_METHOD("print_orphan_nodes"), &Node::_print_orphan_nodes);
 
@@ -2954,6 +3123,7 @@ void Node::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_WM_DPI_CHANGE);
 	BIND_CONSTANT(NOTIFICATION_VP_MOUSE_ENTER);
 	BIND_CONSTANT(NOTIFICATION_VP_MOUSE_EXIT);
+	BIND_CONSTANT(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
 	BIND_CONSTANT(NOTIFICATION_OS_MEMORY_WARNING);
 	BIND_CONSTANT(NOTIFICATION_TRANSLATION_CHANGED);
 	BIND_CONSTANT(NOTIFICATION_WM_ABOUT);
@@ -2971,6 +3141,14 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PROCESS_MODE_ALWAYS);
 	BIND_ENUM_CONSTANT(PROCESS_MODE_DISABLED);
 
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_INHERIT);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+
+	BIND_ENUM_CONSTANT(PHYSICS_INTERPOLATION_MODE_INHERIT);
+	BIND_ENUM_CONSTANT(PHYSICS_INTERPOLATION_MODE_ON);
+	BIND_ENUM_CONSTANT(PHYSICS_INTERPOLATION_MODE_OFF);
+
 	BIND_ENUM_CONSTANT(DUPLICATE_SIGNALS);
 	BIND_ENUM_CONSTANT(DUPLICATE_GROUPS);
 	BIND_ENUM_CONSTANT(DUPLICATE_SCRIPTS);
@@ -2997,6 +3175,10 @@ void Node::_bind_methods() {
 	ADD_GROUP("Process", "process_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,When Paused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
+
+	ADD_GROUP("Physics Interpolation", "physics_interpolation_");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_interpolation_mode", PROPERTY_HINT_ENUM, "Inherit,On,Off"), "set_physics_interpolation_mode", "get_physics_interpolation_mode");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT), "set_editor_description", "get_editor_description");
@@ -3032,6 +3214,10 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.node_path_lookups) {
+		memdelete(data.node_path_lookups);
+	}
+
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
@@ -53,6 +53,18 @@ public:
 		PROCESS_MODE_DISABLED, // never process
 	};
 
+	enum ProcessThreadGroup {
+		PROCESS_THREAD_GROUP_INHERIT, // same as parent node
+		PROCESS_THREAD_GROUP_MAIN_THREAD, // process on the main thread
+		PROCESS_THREAD_GROUP_SUB_THREAD, // process on a worker thread, in parallel with other sub-thread groups
+	};
+
+	enum PhysicsInterpolationMode {
+		PHYSICS_INTERPOLATION_MODE_INHERIT, // same as parent node
+		PHYSICS_INTERPOLATION_MODE_ON, // drawn between the last two physics ticks
+		PHYSICS_INTERPOLATION_MODE_OFF, // drawn where the last physics tick left it
+	};
+
 	enum DuplicateFlags {
 		DUPLICATE_SIGNALS = 1,
 		DUPLICATE_GROUPS = 2,
@@ -86,6 +98,20 @@ public:
 	static int orphan_node_count;
 
 private:
+	enum {
+		MAX_NODE_PATH_LOOKUPS = 64,
+	};
+
+	// Results of get_node() for paths of more than one name, valid while node_path_lookup_generation doesn't change.
+	struct NodePathLookups {
+		HashMap<NodePath, Node *> nodes;
+		uint64_t generation = 0;
+	};
+
+	// Incremented whenever a node is added, removed, renamed or changes owner anywhere, to invalidate all the lookups.
+	static SafeNumeric<uint64_t> node_path_lookup_generation;
+	_FORCE_INLINE_ static void _invalidate_node_path_lookups() { node_path_lookup_generation.increment(); }
+
 	struct GroupData {
 		bool persistent = false;
 		SceneTree::Group *group = nullptr;
@@ -126,6 +152,12 @@ private:
 		ProcessMode process_mode = PROCESS_MODE_INHERIT;
 		Node *process_owner = nullptr;
 
+		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
+		Node *process_thread_group_owner = nullptr; // Nearest node (self included) not set to inherit, or null for the main thread.
+
+		PhysicsInterpolationMode physics_interpolation_mode = PHYSICS_INTERPOLATION_MODE_INHERIT;
+		bool physics_interpolated = true; // Mode resolved against the parents, updated when entering the tree.
+
 		int multiplayer_authority = 1; // Server by default.
 		Vector<Multiplayer::RPCConfig> rpc_methods;
 
@@ -151,6 +183,7 @@ private:
 		bool editable_instance = false;
 
 		mutable NodePath *path_cache = nullptr;
+		mutable NodePathLookups *node_path_lookups = nullptr;
 
 	} data;
 
@@ -160,6 +193,7 @@ private:
 	void _print_tree(const Node *p_node);
 
 	Node *_get_child_by_name(const StringName &p_name) const;
+	Node *_resolve_node_path(const NodePath &p_path) const;
 
 	void _replace_connections_target(Node *p_new_target);
 
@@ -174,6 +208,8 @@ private:
 	void _propagate_after_exit_tree();
 	void _print_orphan_nodes();
 	void _propagate_process_owner(Node *p_owner, int p_pause_notification, int p_enabled_notification);
+	void _propagate_process_thread_group_owner(Node *p_owner);
+	void _propagate_physics_interpolated(bool p_interpolated);
 	void _propagate_groups_dirty();
 	Array _get_node_and_resource(const NodePath &p_path);
 
@@ -196,6 +232,7 @@ private:
 
 	_FORCE_INLINE_ bool _can_process(bool p_paused) const;
 	_FORCE_INLINE_ bool _is_enabled() const;
+	_FORCE_INLINE_ bool _is_processed_in_sub_thread() const { return data.process_thread_group_owner && data.process_thread_group_owner->data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD; }
 
 	void _release_unique_name_in_owner();
 	void _acquire_unique_name_in_owner();
@@ -210,6 +247,7 @@ protected:
 	virtual void remove_child_notify(Node *p_child);
 	virtual void move_child_notify(Node *p_child);
 	virtual void owner_changed_notify();
+	virtual void _physics_interpolated_changed() {}
 
 	void _propagate_replace_owner(Node *p_owner, Node *p_by_owner);
 
@@ -281,6 +319,7 @@ public:
 		NOTIFICATION_WM_DPI_CHANGE = 1009,
 		NOTIFICATION_VP_MOUSE_ENTER = 1010,
 		NOTIFICATION_VP_MOUSE_EXIT = 1011,
+		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = 2001, // 2000 is NOTIFICATION_TRANSFORM_CHANGED in CanvasItem and Node3D.
 
 		NOTIFICATION_OS_MEMORY_WARNING = MainLoop::NOTIFICATION_OS_MEMORY_WARNING,
 		NOTIFICATION_TRANSLATION_CHANGED = MainLoop::NOTIFICATION_TRANSLATION_CHANGED,
@@ -448,6 +487,12 @@ public:
 
 	void set_process_mode(ProcessMode p_mode);
 	ProcessMode get_process_mode() const;
+	void set_process_thread_group(ProcessThreadGroup p_group);
+	ProcessThreadGroup get_process_thread_group() const;
+	void set_physics_interpolation_mode(PhysicsInterpolationMode p_mode);
+	PhysicsInterpolationMode get_physics_interpolation_mode() const;
+	_FORCE_INLINE_ bool is_physics_interpolated() const { return data.physics_interpolated; }
+	void reset_physics_interpolation();
 	bool can_process() const;
 	bool can_process_notification(int p_what) const;
 	bool is_enabled() const;
@@ -31,6 +31,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/core_string_names.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/io/dir_access.h"
@@ -39,6 +40,7 @@
 #include "core/io/resource_loader.h"
 #include "core/multiplayer/multiplayer_api.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
@@ -57,6 +59,7 @@
 #include "servers/navigation_server_3d.h"
 #include "servers/physics_server_2d.h"
 #include "servers/physics_server_3d.h"
+#include "servers/rendering_server.h"
 #include "window.h"
 
 #include <stdio.h>
@@ -160,6 +163,8 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 }
 
 void SceneTree::flush_transform_notifications() {
+	xform_change_epoch++;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -211,6 +216,47 @@ void SceneTree::_update_group_order(Group &g, bool p_use_priority) {
 	g.changed = false;
 }
 
+// Calls the same method with the same arguments on every node of a group. Groups are usually made of
+// nodes of a few classes, so for nodes without a script, the bound method and whether the arguments can
+// be passed through ptrcall are only worked out again when the class differs from the previous node's.
+class GroupMethodCaller {
+	const StringName &function;
+	const Variant **args = nullptr;
+	int argcount = 0;
+	bool native_calls = false;
+
+	StringName last_class;
+	MethodBind *method = nullptr;
+	bool use_ptrcall = false;
+	const void *ptr_args[MethodBind::MAX_PTRCALL_ARGUMENTS];
+	Variant ret;
+
+public:
+	void call(Node *p_node) {
+		if (native_calls && !p_node->get_script_instance()) {
+			const StringName &class_name = p_node->get_class_name();
+			if (class_name != last_class) {
+				last_class = class_name;
+				method = ClassDB::get_method_cached(class_name, function);
+				use_ptrcall = method && method->get_ptrcall_arguments(args, argcount, ptr_args);
+			}
+			if (use_ptrcall) {
+				p_node->method_ptrcall(method, ptr_args, ret);
+				return;
+			}
+		}
+
+		Callable::CallError ce;
+		p_node->callp(function, args, argcount, ce);
+	}
+
+	GroupMethodCaller(const StringName &p_function, const Variant **p_args, int p_argcount) :
+			function(p_function), args(p_args), argcount(p_argcount) {
+		// "free" is handled by Object::callp() itself.
+		native_calls = p_function != CoreStringNames::get_singleton()->_free;
+	}
+};
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
@@ -244,9 +290,11 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 	_update_group_order(g);
 
 	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr(); // Not ptrw(), which would copy the shared array on every call.
 	int node_count = nodes_copy.size();
 
+	GroupMethodCaller caller(p_function, p_args, p_argcount);
+
 	call_lock++;
 
 	if (p_call_flags & GROUP_CALL_REVERSE) {
@@ -256,8 +304,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				caller.call(nodes[i]);
 			} else {
 				MessageQueue::get_singleton()->push_callp(nodes[i], p_function, p_args, p_argcount);
 			}
@@ -270,8 +317,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				caller.call(nodes[i]);
 			} else {
 				MessageQueue::get_singleton()->push_callp(nodes[i], p_function, p_args, p_argcount);
 			}
@@ -297,7 +343,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 	_update_group_order(g);
 
 	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr();
 	int node_count = nodes_copy.size();
 
 	call_lock++;
@@ -348,7 +394,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 	_update_group_order(g);
 
 	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr();
 	int node_count = nodes_copy.size();
 
 	call_lock++;
@@ -530,28 +576,30 @@ bool SceneTree::process(double p_time) {
 }
 
 void SceneTree::process_tweens(float p_delta, bool p_physics) {
-	// This methods works similarly to how SceneTreeTimers are handled.
-	List<Ref<Tween>>::Element *L = tweens.back();
-
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
+	// This methods works similarly to how SceneTreeTimers are handled: tweens created while stepping are only processed
+	// from the next frame. Finished tweens are removed by compacting the array in place, keeping the order.
+	uint32_t tween_count = tweens.size();
+	uint32_t kept = 0;
+
+	for (uint32_t i = 0; i < tween_count; i++) {
+		// Stepping may create tweens and reallocate the array.
+		Ref<Tween> tween = tweens[i];
 		// Don't process if paused or process mode doesn't match.
-		if (!E->get()->can_process(paused) || (p_physics == (E->get()->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
-			}
-			E = N;
+		if (tween->can_process(paused) && (p_physics != (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE)) && !tween->step(p_delta)) {
+			tween->clear();
 			continue;
 		}
-
-		if (!E->get()->step(p_delta)) {
-			E->get()->clear();
-			tweens.erase(E);
+		if (kept != i) {
+			tweens[kept] = tween;
 		}
-		if (E == L) {
-			break;
+		kept++;
+	}
+
+	if (kept != tween_count) {
+		for (uint32_t i = tween_count; i < tweens.size(); i++) {
+			tweens[kept + i - tween_count] = tweens[i];
 		}
-		E = N;
+		tweens.resize(kept + tweens.size() - tween_count);
 	}
 }
 
@@ -884,16 +932,33 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 	Vector<Node *> nodes_copy = g.nodes;
 
 	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr();
 
 	call_lock++;
 
+	process_thread_group_count = 0;
+
 	for (int i = 0; i < node_count; i++) {
 		Node *n = nodes[i];
 		if (call_lock && call_skip.has(n)) {
 			continue;
 		}
 
+		if (n->_is_processed_in_sub_thread()) {
+			// Gathered by group and processed once the main thread nodes are done.
+			uint32_t *index = process_thread_group_indices.getptr(n->data.process_thread_group_owner);
+			if (!index) {
+				if (process_thread_group_count == process_thread_groups.size()) {
+					process_thread_groups.resize(process_thread_group_count + 1);
+				}
+				process_thread_groups[process_thread_group_count].clear();
+				index = &process_thread_group_indices.insert(n->data.process_thread_group_owner, process_thread_group_count)->value;
+				process_thread_group_count++;
+			}
+			process_thread_groups[*index].push_back(n);
+			continue;
+		}
+
 		if (!n->can_process()) {
 			continue;
 		}
@@ -905,12 +970,42 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 		//ERR_FAIL_COND(node_count != g.nodes.size());
 	}
 
+	if (process_thread_group_count > 0) {
+		// Groups run in parallel, the nodes of each group in order. Tree changes made from them are deferred,
+		// and flushed on the main thread with the rest of the message queue.
+		process_thread_group_indices.clear();
+		processing_in_threads = true;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_thread_group, p_notification, process_thread_group_count, -1, true, SNAME("SceneTreeProcessThreadGroups"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		processing_in_threads = false;
+	}
+
 	call_lock--;
 	if (call_lock == 0) {
 		call_skip.clear();
 	}
 }
 
+void SceneTree::_process_thread_group(uint32_t p_index, int p_notification) {
+	const LocalVector<Node *> &group_nodes = process_thread_groups[p_index];
+	for (uint32_t i = 0; i < group_nodes.size(); i++) {
+		Node *n = group_nodes[i];
+		// Main thread nodes run before the groups, and may have removed (and freed) nodes gathered here.
+		// Tree changes made from the groups are deferred, so call_skip is not modified while they run.
+		if (call_skip.has(n)) {
+			continue;
+		}
+		if (!n->can_process()) {
+			continue;
+		}
+		if (!n->can_process_notification(p_notification)) {
+			continue;
+		}
+
+		n->notification(p_notification);
+	}
+}
+
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
@@ -928,7 +1023,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	Vector<Node *> nodes_copy = g.nodes;
 
 	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr();
 
 	call_lock++;
 
@@ -1175,10 +1270,8 @@ Array SceneTree::get_processed_tweens() {
 	Array ret;
 	ret.resize(tweens.size());
 
-	int i = 0;
-	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+	for (uint32_t i = 0; i < tweens.size(); i++) {
+		ret[i] = tweens[i];
 	}
 
 	return ret;
@@ -1447,6 +1540,11 @@ SceneTree::SceneTree() {
 	bool snap_2d_vertices = GLOBAL_DEF("rendering/2d/snap/snap_2d_vertices_to_pixel", false);
 	root->set_snap_2d_vertices_to_pixel(snap_2d_vertices);
 
+	// Edited scenes aren't moved by physics, they shouldn't lag behind while being edited.
+	bool physics_interpolation = GLOBAL_DEF("physics/common/physics_interpolation", false) && !Engine::get_singleton()->is_editor_hint();
+	RenderingServer::get_singleton()->set_physics_interpolation_enabled(physics_interpolation);
+	root->set_physics_interpolation_mode(physics_interpolation ? Node::PHYSICS_INTERPOLATION_MODE_ON : Node::PHYSICS_INTERPOLATION_MODE_OFF);
+
 	// We setup VRS for the main viewport here, in the editor this will have little effect.
 	const int vrs_mode = GLOBAL_DEF("rendering/vrs/mode", 0);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/vrs/mode", PropertyInfo(Variant::INT, "rendering/vrs/mode", PROPERTY_HINT_ENUM, String::utf8("Disabled,Texture,XR")));
@@ -33,6 +33,7 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
 
@@ -133,6 +134,12 @@ private:
 	int call_lock = 0;
 	HashSet<Node *> call_skip; // Skip erased nodes.
 
+	// Nodes of each sub-thread process group, gathered while notifying a process group.
+	LocalVector<LocalVector<Node *>> process_thread_groups;
+	HashMap<Node *, uint32_t> process_thread_group_indices;
+	uint32_t process_thread_group_count = 0;
+	bool processing_in_threads = false;
+
 	List<ObjectID> delete_queue;
 
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
@@ -161,7 +168,7 @@ private:
 	void _change_scene(Node *p_to);
 
 	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	LocalVector<Ref<Tween>> tweens;
 
 	///network///
 
@@ -183,6 +190,7 @@ private:
 	void make_group_changed(const StringName &p_group);
 
 	void _notify_group_pause(const StringName &p_group, int p_notification);
+	void _process_thread_group(uint32_t p_index, int p_notification);
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -193,6 +201,24 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	Mutex xform_change_mutex; // Nodes processed in sub-threads can queue transform changes concurrently.
+	uint64_t xform_change_epoch = 1; // Incremented every time the transform notifications are flushed.
+
+	_FORCE_INLINE_ void _add_xform_change(SelfList<Node> *p_xform_change) {
+		MutexLock lock(xform_change_mutex);
+		if (!p_xform_change->in_list()) {
+			xform_change_list.add(p_xform_change);
+		}
+	}
+	// Returns whether it was queued.
+	_FORCE_INLINE_ bool _remove_xform_change(SelfList<Node> *p_xform_change) {
+		MutexLock lock(xform_change_mutex);
+		if (!p_xform_change->in_list()) {
+			return false;
+		}
+		xform_change_list.remove(p_xform_change);
+		return true;
+	}
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -296,6 +322,7 @@ public:
 
 	void set_pause(bool p_enabled);
 	bool is_paused() const;
+	_FORCE_INLINE_ bool is_processing_in_threads() const { return processing_in_threads; }
 
 #ifdef DEBUG_ENABLED
 	void set_debug_collisions_hint(bool p_enabled);
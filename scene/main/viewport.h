@@ -92,6 +92,7 @@ public:
 	enum Scaling3DMode {
 		SCALING_3D_MODE_BILINEAR,
 		SCALING_3D_MODE_FSR,
+		SCALING_3D_MODE_TEMPORAL,
 		SCALING_3D_MODE_MAX
 	};
 
@@ -32,6 +32,8 @@
 
 #include "core/config/engine.h"
 #include "core/multiplayer/multiplayer_api.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
 	if (p_path.get_name_count() == 0) {
@@ -132,6 +134,10 @@ void MultiplayerSynchronizer::set_visibility_public(bool p_visible) {
 }
 
 bool MultiplayerSynchronizer::is_visible_to(int p_peer) {
+	if (interest_radius > 0 && (p_peer == 0 || !interest_peers.has(p_peer))) {
+		// Out of range, no need to run the filters.
+		return false;
+	}
 	if (visibility_filters.size()) {
 		Variant arg = p_peer;
 		const Variant *argv[1] = { &arg };
@@ -183,6 +189,75 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_interest_radius(real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "Interest radius must be greater or equal to 0 (where 0 means disabled)");
+	if (interest_radius == p_radius) {
+		return;
+	}
+	interest_radius = p_radius;
+	// Peers in range are computed again on the next network process.
+	interest_peers.clear();
+	update_visibility(0);
+}
+
+real_t MultiplayerSynchronizer::get_interest_radius() const {
+	return interest_radius;
+}
+
+void MultiplayerSynchronizer::set_interest_priority(real_t p_priority) {
+	ERR_FAIL_COND_MSG(p_priority <= 0, "Interest priority must be greater than 0.");
+	interest_priority = p_priority;
+}
+
+real_t MultiplayerSynchronizer::get_interest_priority() const {
+	return interest_priority;
+}
+
+void MultiplayerSynchronizer::set_interest_viewer_peer(int p_peer) {
+	interest_viewer_peer = p_peer;
+}
+
+int MultiplayerSynchronizer::get_interest_viewer_peer() const {
+	return interest_viewer_peer;
+}
+
+bool MultiplayerSynchronizer::get_interest_position(Vector3 &r_position) const {
+	Node *node = is_inside_tree() ? get_node_or_null(root_path) : nullptr;
+	Node3D *node_3d = Object::cast_to<Node3D>(node);
+	if (node_3d) {
+		r_position = node_3d->get_global_transform().origin;
+		return true;
+	}
+	Node2D *node_2d = Object::cast_to<Node2D>(node);
+	if (node_2d) {
+		Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
+void MultiplayerSynchronizer::update_interest_peers(const LocalVector<int> &p_peers) {
+	LocalVector<int> changed;
+	for (const int &peer : interest_peers) {
+		if (p_peers.find(peer) < 0) {
+			changed.push_back(peer);
+		}
+	}
+	for (uint32_t i = 0; i < changed.size(); i++) {
+		interest_peers.erase(changed[i]);
+	}
+	for (uint32_t i = 0; i < p_peers.size(); i++) {
+		if (!interest_peers.has(p_peers[i])) {
+			interest_peers.insert(p_peers[i]);
+			changed.push_back(p_peers[i]);
+		}
+	}
+	for (uint32_t i = 0; i < changed.size(); i++) {
+		update_visibility(changed[i]);
+	}
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -205,12 +280,24 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
+	ClassDB::bind_method(D_METHOD("set_interest_radius", "radius"), &MultiplayerSynchronizer::set_interest_radius);
+	ClassDB::bind_method(D_METHOD("get_interest_radius"), &MultiplayerSynchronizer::get_interest_radius);
+	ClassDB::bind_method(D_METHOD("set_interest_priority", "priority"), &MultiplayerSynchronizer::set_interest_priority);
+	ClassDB::bind_method(D_METHOD("get_interest_priority"), &MultiplayerSynchronizer::get_interest_priority);
+	ClassDB::bind_method(D_METHOD("set_interest_viewer_peer", "peer"), &MultiplayerSynchronizer::set_interest_viewer_peer);
+	ClassDB::bind_method(D_METHOD("get_interest_viewer_peer"), &MultiplayerSynchronizer::get_interest_viewer_peer);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
 
+	ADD_GROUP("Interest", "interest_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_radius", PROPERTY_HINT_RANGE, "0,10000,0.01,or_greater"), "set_interest_radius", "get_interest_radius");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_priority", PROPERTY_HINT_RANGE, "0.01,100,0.01,or_greater"), "set_interest_priority", "get_interest_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "interest_viewer_peer"), "set_interest_viewer_peer", "get_interest_viewer_peer");
+
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_NONE);
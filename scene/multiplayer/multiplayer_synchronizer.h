@@ -52,6 +52,10 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	real_t interest_radius = 0.0;
+	real_t interest_priority = 1.0;
+	int interest_viewer_peer = 0;
+	HashSet<int> interest_peers; // Peers whose viewer is in range, as last computed by the replication interface.
 
 	static Object *_get_prop_target(Object *p_obj, const NodePath &p_prop);
 	void _start();
@@ -88,6 +92,15 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_interest_radius(real_t p_radius);
+	real_t get_interest_radius() const;
+	void set_interest_priority(real_t p_priority);
+	real_t get_interest_priority() const;
+	void set_interest_viewer_peer(int p_peer);
+	int get_interest_viewer_peer() const;
+	bool get_interest_position(Vector3 &r_position) const;
+	void update_interest_peers(const LocalVector<int> &p_peers);
+
 	MultiplayerSynchronizer();
 };
 
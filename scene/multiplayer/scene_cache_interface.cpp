@@ -109,6 +109,7 @@ void SceneCacheInterface::process_simplify_path(int p_from, const uint8_t *p_pac
 	multiplayer->profile_bandwidth("out", packet.size());
 #endif
 
+	multiplayer->flush_rpc_batches();
 	multiplayer_peer->set_transfer_channel(0);
 	multiplayer_peer->set_transfer_mode(Multiplayer::TRANSFER_MODE_RELIABLE);
 	multiplayer_peer->set_target_peer(p_from);
@@ -166,6 +167,7 @@ Error SceneCacheInterface::_send_confirm_path(Node *p_node, NodePath p_path, Pat
 	multiplayer->profile_bandwidth("out", packet.size() * p_peers.size());
 #endif
 
+	multiplayer->flush_rpc_batches();
 	Error err = OK;
 	for (int peer_id : p_peers) {
 		multiplayer_peer->set_target_peer(peer_id);
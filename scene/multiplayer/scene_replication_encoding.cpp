@@ -0,0 +1,208 @@
+/*************************************************************************/
+/*  scene_replication_encoding.cpp                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "scene_replication_encoding.h"
+
+void ReplicationBitWriter::clear() {
+	data.clear();
+	pending = 0;
+	pending_bits = 0;
+}
+
+void ReplicationBitWriter::write(uint32_t p_value, int p_bits) {
+	DEV_ASSERT(p_bits > 0 && p_bits <= 32);
+	pending |= uint64_t(p_value & (0xFFFFFFFF >> (32 - p_bits))) << pending_bits;
+	pending_bits += p_bits;
+	while (pending_bits >= 8) {
+		data.push_back(pending & 0xFF);
+		pending >>= 8;
+		pending_bits -= 8;
+	}
+}
+
+void ReplicationBitWriter::flush() {
+	if (pending_bits) {
+		data.push_back(pending & 0xFF);
+		pending = 0;
+		pending_bits = 0;
+	}
+}
+
+bool ReplicationBitReader::read(uint32_t &r_value, int p_bits) {
+	DEV_ASSERT(p_bits > 0 && p_bits <= 32);
+	if (bit_pos + p_bits > size * 8) {
+		return false;
+	}
+	uint64_t value = 0;
+	for (int read = 0; read < p_bits;) {
+		int byte = (bit_pos + read) / 8;
+		int shift = (bit_pos + read) % 8;
+		int count = MIN(8 - shift, p_bits - read);
+		value |= uint64_t((data[byte] >> shift) & ((1 << count) - 1)) << read;
+		read += count;
+	}
+	bit_pos += p_bits;
+	r_value = value;
+	return true;
+}
+
+// Number of components the quantized and half encodings write, after a 2 bits tag telling the type.
+static int _get_component_count(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return 1;
+		case Variant::VECTOR2:
+			return 2;
+		case Variant::VECTOR3:
+			return 3;
+		default:
+			return 0;
+	}
+}
+
+static void _write_quantized(real_t p_value, real_t p_min, real_t p_max, int p_bits, ReplicationBitWriter &r_writer) {
+	const uint64_t steps = (uint64_t(1) << p_bits) - 1;
+	real_t unit = CLAMP((p_value - p_min) / (p_max - p_min), 0, 1);
+	r_writer.write(uint32_t(Math::round(double(unit) * steps)), p_bits);
+}
+
+static bool _read_quantized(real_t p_min, real_t p_max, int p_bits, ReplicationBitReader &r_reader, real_t &r_value) {
+	uint32_t value;
+	if (!r_reader.read(value, p_bits)) {
+		return false;
+	}
+	const uint64_t steps = (uint64_t(1) << p_bits) - 1;
+	r_value = p_min + real_t(double(value) / steps) * (p_max - p_min);
+	return true;
+}
+
+Error SceneReplicationEncoding::encode(const SceneReplicationConfig::Encoding &p_encoding, const Variant &p_value, ReplicationBitWriter &r_writer) {
+	switch (p_encoding.type) {
+		case SceneReplicationConfig::ENCODING_QUANTIZED:
+		case SceneReplicationConfig::ENCODING_HALF: {
+			int count = _get_component_count(p_value.get_type());
+			ERR_FAIL_COND_V_MSG(!count, ERR_INVALID_PARAMETER, vformat("Type '%s' can't be encoded as a quantized or half value.", Variant::get_type_name(p_value.get_type())));
+			real_t components[3];
+			if (count == 1) {
+				components[0] = p_value;
+			} else if (count == 2) {
+				Vector2 v = p_value;
+				components[0] = v.x;
+				components[1] = v.y;
+			} else {
+				Vector3 v = p_value;
+				components[0] = v.x;
+				components[1] = v.y;
+				components[2] = v.z;
+			}
+			r_writer.write(count - 1, 2);
+			for (int i = 0; i < count; i++) {
+				if (p_encoding.type == SceneReplicationConfig::ENCODING_HALF) {
+					r_writer.write(Math::make_half_float(components[i]), 16);
+				} else {
+					_write_quantized(components[i], p_encoding.range_min, p_encoding.range_max, p_encoding.bits, r_writer);
+				}
+			}
+			return OK;
+		}
+		case SceneReplicationConfig::ENCODING_QUATERNION_SMALLEST_THREE: {
+			ERR_FAIL_COND_V_MSG(p_value.get_type() != Variant::QUATERNION, ERR_INVALID_PARAMETER, vformat("Type '%s' can't be encoded as a smallest three quaternion.", Variant::get_type_name(p_value.get_type())));
+			Quaternion q = p_value;
+			q.normalize();
+			// The largest component is left out, and rebuilt from the others since the quaternion is normalized.
+			int largest = 0;
+			for (int i = 1; i < 4; i++) {
+				if (Math::abs(q.components[i]) > Math::abs(q.components[largest])) {
+					largest = i;
+				}
+			}
+			// q and -q are the same rotation, so the left out component can always be positive.
+			real_t sign = q.components[largest] < 0 ? -1 : 1;
+			r_writer.write(largest, 2);
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					_write_quantized(q.components[i] * sign, -Math_SQRT12, Math_SQRT12, p_encoding.bits, r_writer);
+				}
+			}
+			return OK;
+		}
+		default: {
+			ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Variant encoded properties are not bit-packed.");
+		}
+	}
+}
+
+Error SceneReplicationEncoding::decode(const SceneReplicationConfig::Encoding &p_encoding, ReplicationBitReader &r_reader, Variant &r_value) {
+	switch (p_encoding.type) {
+		case SceneReplicationConfig::ENCODING_QUANTIZED:
+		case SceneReplicationConfig::ENCODING_HALF: {
+			uint32_t tag;
+			ERR_FAIL_COND_V(!r_reader.read(tag, 2) || tag > 2, ERR_INVALID_DATA);
+			int count = tag + 1;
+			real_t components[3];
+			for (int i = 0; i < count; i++) {
+				if (p_encoding.type == SceneReplicationConfig::ENCODING_HALF) {
+					uint32_t half;
+					ERR_FAIL_COND_V(!r_reader.read(half, 16), ERR_INVALID_DATA);
+					components[i] = Math::half_to_float(half);
+				} else {
+					ERR_FAIL_COND_V(!_read_quantized(p_encoding.range_min, p_encoding.range_max, p_encoding.bits, r_reader, components[i]), ERR_INVALID_DATA);
+				}
+			}
+			if (count == 1) {
+				r_value = components[0];
+			} else if (count == 2) {
+				r_value = Vector2(components[0], components[1]);
+			} else {
+				r_value = Vector3(components[0], components[1], components[2]);
+			}
+			return OK;
+		}
+		case SceneReplicationConfig::ENCODING_QUATERNION_SMALLEST_THREE: {
+			uint32_t largest;
+			ERR_FAIL_COND_V(!r_reader.read(largest, 2), ERR_INVALID_DATA);
+			Quaternion q;
+			real_t sum = 0;
+			for (int i = 0; i < 4; i++) {
+				if (i != (int)largest) {
+					ERR_FAIL_COND_V(!_read_quantized(-Math_SQRT12, Math_SQRT12, p_encoding.bits, r_reader, q.components[i]), ERR_INVALID_DATA);
+					sum += q.components[i] * q.components[i];
+				}
+			}
+			q.components[largest] = Math::sqrt(MAX(0, 1 - sum));
+			r_value = q.normalized();
+			return OK;
+		}
+		default: {
+			ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Variant encoded properties are not bit-packed.");
+		}
+	}
+}
@@ -0,0 +1,74 @@
+/*************************************************************************/
+/*  scene_replication_encoding.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef SCENE_REPLICATION_ENCODING_H
+#define SCENE_REPLICATION_ENCODING_H
+
+#include "scene/resources/scene_replication_config.h"
+
+class ReplicationBitWriter {
+	LocalVector<uint8_t> data;
+	uint64_t pending = 0;
+	int pending_bits = 0;
+
+public:
+	void clear();
+	void write(uint32_t p_value, int p_bits);
+	// Pads the last byte with zeros.
+	void flush();
+
+	const uint8_t *ptr() const { return data.ptr(); }
+	int size() const { return data.size(); }
+};
+
+class ReplicationBitReader {
+	const uint8_t *data = nullptr;
+	int size = 0;
+	int bit_pos = 0;
+
+public:
+	bool read(uint32_t &r_value, int p_bits);
+	// Whole bytes, like the writer pads them.
+	int get_consumed_bytes() const { return (bit_pos + 7) / 8; }
+
+	ReplicationBitReader(const uint8_t *p_data, int p_size) {
+		data = p_data;
+		size = p_size;
+	}
+};
+
+class SceneReplicationEncoding {
+public:
+	static Error encode(const SceneReplicationConfig::Encoding &p_encoding, const Variant &p_value, ReplicationBitWriter &r_writer);
+	static Error decode(const SceneReplicationConfig::Encoding &p_encoding, ReplicationBitReader &r_reader, Variant &r_value);
+};
+
+#endif // SCENE_REPLICATION_ENCODING_H
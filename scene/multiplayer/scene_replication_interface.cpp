@@ -30,6 +30,7 @@
 
 #include "scene_replication_interface.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
 #include "scene/main/node.h"
 #include "scene/multiplayer/multiplayer_spawner.h"
@@ -82,9 +83,77 @@ void SceneReplicationInterface::on_reset() {
 	rep_state->reset();
 }
 
+void SceneReplicationInterface::_update_interest() {
+	// Where each peer sees the world from, and the synchronizers limited to the peers in range.
+	HashMap<int, Vector3> viewers;
+	interest_nodes.clear();
+	real_t cell_size = 0.0;
+	for (const ObjectID &oid : rep_state->get_synced_nodes()) {
+		MultiplayerSynchronizer *sync = rep_state->get_synchronizer(oid);
+		ERR_CONTINUE(!sync); // ERR_BUG
+		Vector3 position;
+		if (sync->get_interest_viewer_peer() && sync->get_interest_position(position)) {
+			viewers[sync->get_interest_viewer_peer()] = position;
+		}
+		if (sync->get_interest_radius() > 0 && sync->is_multiplayer_authority()) {
+			InterestNode in;
+			in.id = oid;
+			in.radius = sync->get_interest_radius();
+			in.located = sync->get_interest_position(in.position);
+			interest_nodes.push_back(in);
+			cell_size = MAX(cell_size, in.radius);
+		}
+	}
+	if (interest_nodes.is_empty()) {
+		return;
+	}
+
+	// Cells are as large as the largest radius, so only the cells next to a viewer can hold synchronizers in its range.
+	interest_grid.clear();
+	for (uint32_t i = 0; i < interest_nodes.size(); i++) {
+		if (interest_nodes[i].located) {
+			const Vector3 &pos = interest_nodes[i].position;
+			interest_grid[Vector3i(Math::floor(pos.x / cell_size), Math::floor(pos.y / cell_size), Math::floor(pos.z / cell_size))].push_back(i);
+		}
+	}
+	const HashSet<int> peers = rep_state->get_peers();
+	for (const KeyValue<int, Vector3> &E : viewers) {
+		if (!peers.has(E.key)) {
+			continue;
+		}
+		const Vector3 &pos = E.value;
+		const Vector3i center = Vector3i(Math::floor(pos.x / cell_size), Math::floor(pos.y / cell_size), Math::floor(pos.z / cell_size));
+		for (int x = -1; x <= 1; x++) {
+			for (int y = -1; y <= 1; y++) {
+				for (int z = -1; z <= 1; z++) {
+					const LocalVector<uint32_t> *cell = interest_grid.getptr(center + Vector3i(x, y, z));
+					if (!cell) {
+						continue;
+					}
+					for (uint32_t i = 0; i < cell->size(); i++) {
+						InterestNode &in = interest_nodes[(*cell)[i]];
+						if (in.position.distance_squared_to(pos) <= in.radius * in.radius) {
+							in.peers.push_back(E.key);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Applied last, since the visibility changes spawn and despawn nodes.
+	for (uint32_t i = 0; i < interest_nodes.size(); i++) {
+		MultiplayerSynchronizer *sync = rep_state->get_synchronizer(interest_nodes[i].id);
+		ERR_CONTINUE(!sync); // ERR_BUG
+		sync->update_interest_peers(interest_nodes[i].peers);
+	}
+}
+
 void SceneReplicationInterface::on_network_process() {
+	_update_interest();
 	uint64_t msec = OS::get_singleton()->get_ticks_msec();
 	for (int peer : rep_state->get_peers()) {
+		_send_sync_acks(peer);
 		_send_sync(peer, msec);
 	}
 }
@@ -179,11 +248,11 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, const Objec
 	if (p_peer == 0) {
 		for (int pid : rep_state->get_peers()) {
 			// Might be visible to this specific peer.
-			is_visible = is_visible || sync->is_visible_to(pid);
-			if (rep_state->is_peer_sync(pid, p_oid) == is_visible) {
+			bool peer_visible = is_visible || sync->is_visible_to(pid);
+			if (rep_state->is_peer_sync(pid, p_oid) == peer_visible) {
 				continue;
 			}
-			if (is_visible) {
+			if (peer_visible) {
 				rep_state->peer_add_sync(pid, p_oid);
 			} else {
 				rep_state->peer_del_sync(pid, p_oid);
@@ -264,6 +333,7 @@ Error SceneReplicationInterface::_send_raw(const uint8_t *p_buffer, int p_size,
 	multiplayer->profile_bandwidth("out", p_size);
 #endif
 
+	multiplayer->flush_rpc_batches();
 	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
 	peer->set_target_peer(p_peer);
 	peer->set_transfer_channel(0);
@@ -433,14 +503,34 @@ void SceneReplicationInterface::_send_sync(int p_peer, uint64_t p_msec) {
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = MultiplayerAPI::NETWORK_COMMAND_SYNC;
 	int ofs = 1;
-	ofs += encode_uint16(rep_state->peer_sync_next(p_peer), &ptr[1]);
+	// Every packet gets its own time, so the peer can acknowledge them separately.
+	uint16_t time = rep_state->peer_sync_next(p_peer);
+	ofs += encode_uint16(time, &ptr[1]);
 	// Can only send updates for already notified nodes.
 	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
+	sync_candidates.clear();
 	for (const ObjectID &oid : to_sync) {
-		if (!rep_state->update_sync_time(oid, p_msec)) {
+		SceneReplicationState::SyncBaseline *baseline = rep_state->peer_get_sync_baseline(p_peer, oid);
+		ERR_CONTINUE(!baseline);
+		// States held back by the budget are due regardless of the interval.
+		if (!rep_state->update_sync_time(oid, p_msec) && !baseline->deferred) {
 			continue; // nothing to sync.
 		}
 		MultiplayerSynchronizer *sync = rep_state->get_synchronizer(oid);
+		ERR_CONTINUE(!sync);
+		SyncCandidate candidate;
+		candidate.id = oid;
+		candidate.score = sync->get_interest_priority() * (1 + baseline->deferred);
+		sync_candidates.push_back(candidate);
+	}
+	if (sync_budget > 0) {
+		// Spend the budget on the most important states, the longer a state waits the more important it gets.
+		sync_candidates.sort();
+	}
+	int sent = 0;
+	for (uint32_t c = 0; c < sync_candidates.size(); c++) {
+		const ObjectID &oid = sync_candidates[c].id;
+		MultiplayerSynchronizer *sync = rep_state->get_synchronizer(oid);
 		ERR_CONTINUE(!sync || !sync->get_replication_config().is_valid());
 		Node *node = rep_state->get_node(oid);
 		ERR_CONTINUE(!node);
@@ -459,27 +549,73 @@ void SceneReplicationInterface::_send_sync(int p_peer, uint64_t p_msec) {
 				continue;
 			}
 		}
-		int size;
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
 		const List<NodePath> props = sync->get_replication_config()->get_sync_properties();
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+
+		// Only send the properties the peer isn't known to hold already.
+		SceneReplicationState::SyncBaseline *baseline = rep_state->peer_get_sync_baseline(p_peer, oid);
+		if (baseline->state.size() != vars.size()) {
+			baseline->reset(vars.size());
+		}
+		// Properties with a replication encoding are bit-packed first, the others follow as variants.
+		const LocalVector<SceneReplicationConfig::Encoding> &encodings = sync->get_replication_config()->get_sync_encodings();
+		ERR_CONTINUE(encodings.size() != (uint32_t)vars.size());
+		int mask_size = (vars.size() + 7) / 8;
+		sync_mask.resize(mask_size);
+		memset(sync_mask.ptr(), 0, mask_size);
+		sync_writer.clear();
+		Vector<const Variant *> changed;
+		bool any_changed = false;
+		for (int i = 0; i < vars.size() && err == OK; i++) {
+			if (baseline->is_known(i, vars[i])) {
+				continue;
+			}
+			sync_mask[i / 8] |= 1 << (i % 8);
+			any_changed = true;
+			if (encodings[i].type == SceneReplicationConfig::ENCODING_VARIANT) {
+				changed.push_back(varp[i]);
+			} else {
+				err = SceneReplicationEncoding::encode(encodings[i], vars[i], sync_writer);
+			}
+		}
+		ERR_CONTINUE_MSG(err != OK, vformat("Unable to encode sync state: %s", node->get_path()));
+		if (!any_changed) {
+			baseline->deferred = 0;
+			continue; // Nothing changed for this peer.
+		}
+		sync_writer.flush();
+
+		int state_size;
+		err = MultiplayerAPI::encode_and_compress_variants(changed.ptrw(), changed.size(), nullptr, state_size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		int size = mask_size + sync_writer.size() + state_size;
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > 3 + 4 + 4 + sync_mtu, vformat("Node states bigger then MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (sync_budget > 0 && sent > 0 && sent + 4 + 4 + size > sync_budget) {
+			// Over budget, try again next time (smaller states might still fit).
+			baseline->deferred++;
+			continue;
+		}
+		sent += 4 + 4 + size;
+		baseline->deferred = 0;
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
-			ofs = 3;
+			time = rep_state->peer_sync_next(p_peer);
+			ofs = 1 + encode_uint16(time, &ptr[1]);
 		}
-		if (size) {
-			ofs += encode_uint32(rep_state->get_net_id(oid), &ptr[ofs]);
-			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
-			ofs += size;
+		ofs += encode_uint32(rep_state->get_net_id(oid), &ptr[ofs]);
+		ofs += encode_uint32(size, &ptr[ofs]);
+		memcpy(&ptr[ofs], sync_mask.ptr(), mask_size);
+		if (sync_writer.size()) {
+			memcpy(&ptr[ofs + mask_size], sync_writer.ptr(), sync_writer.size());
 		}
+		MultiplayerAPI::encode_and_compress_variants(changed.ptrw(), changed.size(), &ptr[ofs + mask_size + sync_writer.size()], state_size);
+		ofs += size;
+		rep_state->peer_sync_sent(p_peer, oid, time, vars);
 	}
 	if (ofs > 3) {
 		// Got some left over to send.
@@ -487,11 +623,44 @@ void SceneReplicationInterface::_send_sync(int p_peer, uint64_t p_msec) {
 	}
 }
 
+void SceneReplicationInterface::_send_sync_acks(int p_peer) {
+	LocalVector<uint16_t> acks = rep_state->peer_take_sync_acks(p_peer);
+	int start = 0;
+	while (start < (int)acks.size()) {
+		int count = MIN((int)acks.size() - start, (sync_mtu - 1) / 2);
+		MAKE_ROOM(1 + count * 2);
+		uint8_t *ptr = packet_cache.ptrw();
+		ptr[0] = MultiplayerAPI::NETWORK_COMMAND_SYNC | SYNC_CMD_FLAG_ACK;
+		int ofs = 1;
+		for (int i = 0; i < count; i++) {
+			ofs += encode_uint16(acks[start + i], &ptr[ofs]);
+		}
+		_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+		start += count;
+	}
+}
+
+SceneReplicationInterface::SceneReplicationInterface(MultiplayerAPI *p_multiplayer) {
+	rep_state.instantiate();
+	multiplayer = p_multiplayer;
+	sync_budget = GLOBAL_GET("network/limits/replication/max_sync_bytes_per_peer");
+}
+
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	if (p_buffer[0] & SYNC_CMD_FLAG_ACK) {
+		// The sync packets the peer received from us.
+		for (int ofs = 1; ofs + 2 <= p_buffer_len; ofs += 2) {
+			rep_state->peer_sync_acknowledged(p_from, decode_uint16(&p_buffer[ofs]));
+		}
+		return OK;
+	}
+
 	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
 	uint16_t time = decode_uint16(&p_buffer[1]);
 	int ofs = 3;
 	rep_state->peer_sync_recv(p_from, time);
+	// Only acknowledge the packet if all of it could be applied, the sender sends the skipped states again otherwise.
+	bool complete = true;
 	while (ofs + 8 < p_buffer_len) {
 		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
 		ofs += 4;
@@ -508,6 +677,7 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		if (!node) {
 			// Not received yet.
 			ofs += size;
+			complete = false;
 			continue;
 		}
 		const ObjectID oid = node->get_instance_id();
@@ -519,15 +689,45 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		MultiplayerSynchronizer *sync = rep_state->get_synchronizer(oid);
 		ERR_FAIL_COND_V(!sync, ERR_BUG);
 		ERR_FAIL_COND_V(size > uint32_t(p_buffer_len - ofs), ERR_BUG);
-		const List<NodePath> props = sync->get_replication_config()->get_sync_properties();
+		// The state only holds the properties marked in the leading bitmask, the bit-packed ones first.
+		const List<NodePath> all_props = sync->get_replication_config()->get_sync_properties();
+		const LocalVector<SceneReplicationConfig::Encoding> &encodings = sync->get_replication_config()->get_sync_encodings();
+		ERR_FAIL_COND_V(encodings.size() != (uint32_t)all_props.size(), ERR_BUG);
+		uint32_t mask_size = (all_props.size() + 7) / 8;
+		ERR_FAIL_COND_V(size < mask_size, ERR_INVALID_DATA);
+		ReplicationBitReader reader(&p_buffer[ofs + mask_size], size - mask_size);
+		List<NodePath> props;
+		List<NodePath> packed_props;
+		Vector<Variant> packed_vars;
+		int idx = 0;
+		for (const NodePath &prop : all_props) {
+			if (p_buffer[ofs + idx / 8] & (1 << (idx % 8))) {
+				if (encodings[idx].type == SceneReplicationConfig::ENCODING_VARIANT) {
+					props.push_back(prop);
+				} else {
+					Variant value;
+					Error err = SceneReplicationEncoding::decode(encodings[idx], reader, value);
+					ERR_FAIL_COND_V(err, err);
+					packed_props.push_back(prop);
+					packed_vars.push_back(value);
+				}
+			}
+			idx++;
+		}
+		uint32_t packed_size = mask_size + reader.get_consumed_bytes();
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs + packed_size], size - packed_size, consumed);
+		ERR_FAIL_COND_V(err, err);
+		err = MultiplayerSynchronizer::set_state(packed_props, node, packed_vars);
 		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
 	}
+	if (complete) {
+		rep_state->peer_add_sync_ack(p_from, time);
+	}
 	return OK;
 }
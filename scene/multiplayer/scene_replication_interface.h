@@ -33,13 +33,37 @@
 
 #include "core/multiplayer/multiplayer_api.h"
 
+#include "scene/multiplayer/scene_replication_encoding.h"
 #include "scene/multiplayer/scene_replication_state.h"
 
 class SceneReplicationInterface : public MultiplayerReplicationInterface {
 	GDCLASS(SceneReplicationInterface, MultiplayerReplicationInterface);
 
 private:
+	enum {
+		// Set on sync packets listing the times of the sync packets received, instead of a state.
+		SYNC_CMD_FLAG_ACK = 1 << MultiplayerAPI::CMD_FLAG_0_SHIFT,
+	};
+
+	struct InterestNode {
+		ObjectID id;
+		Vector3 position;
+		real_t radius = 0.0;
+		bool located = false;
+		LocalVector<int> peers;
+	};
+
+	struct SyncCandidate {
+		ObjectID id;
+		real_t score = 0.0;
+
+		// Highest score first.
+		bool operator<(const SyncCandidate &p_other) const { return score > p_other.score; }
+	};
+
+	void _update_interest();
 	void _send_sync(int p_peer, uint64_t p_msec);
+	void _send_sync_acks(int p_peer);
 	Error _make_spawn_packet(Node *p_node, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
@@ -52,7 +76,13 @@ private:
 	Ref<SceneReplicationState> rep_state;
 	MultiplayerAPI *multiplayer = nullptr;
 	PackedByteArray packet_cache;
+	LocalVector<uint8_t> sync_mask;
+	ReplicationBitWriter sync_writer;
+	LocalVector<SyncCandidate> sync_candidates;
+	LocalVector<InterestNode> interest_nodes;
+	HashMap<Vector3i, LocalVector<uint32_t>> interest_grid;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
+	int sync_budget = 0; // Bytes of sync state sent to each peer per network process, 0 means unlimited.
 
 	// An hack to apply the initial state before ready.
 	ObjectID pending_spawn;
@@ -78,10 +108,7 @@ public:
 	virtual Error on_despawn_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) override;
 	virtual Error on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) override;
 
-	SceneReplicationInterface(MultiplayerAPI *p_multiplayer) {
-		rep_state.instantiate();
-		multiplayer = p_multiplayer;
-	}
+	SceneReplicationInterface(MultiplayerAPI *p_multiplayer);
 };
 
 #endif // SCENE_REPLICATION_INTERFACE_H
@@ -58,6 +58,7 @@ void SceneReplicationState::_untrack(const ObjectID &p_id) {
 			for (KeyValue<int, PeerInfo> &E : peers_info) {
 				E.value.sync_nodes.erase(p_id);
 				E.value.spawn_nodes.erase(p_id);
+				E.value.sync_baselines.erase(p_id);
 			}
 		}
 	}
@@ -177,6 +178,7 @@ Error SceneReplicationState::config_del_sync(Node *p_node, MultiplayerSynchroniz
 	synced_nodes.erase(oid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(oid);
+		E.value.sync_baselines.erase(oid);
 	}
 	return OK;
 }
@@ -190,6 +192,8 @@ Error SceneReplicationState::peer_add_sync(int p_peer, const ObjectID &p_id) {
 Error SceneReplicationState::peer_del_sync(int p_peer, const ObjectID &p_id) {
 	ERR_FAIL_COND_V(!peers_info.has(p_peer), ERR_INVALID_PARAMETER);
 	peers_info[p_peer].sync_nodes.erase(p_id);
+	// Start over with the full state if it becomes visible again.
+	peers_info[p_peer].sync_baselines.erase(p_id);
 	return OK;
 }
 
@@ -265,3 +269,135 @@ void SceneReplicationState::peer_sync_recv(int p_peer, uint16_t p_time) {
 	ERR_FAIL_COND(!peers_info.has(p_peer));
 	peers_info[p_peer].last_recv_sync = p_time;
 }
+
+SceneReplicationState::SyncBaseline *SceneReplicationState::peer_get_sync_baseline(int p_peer, const ObjectID &p_id) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND_V(!info, nullptr);
+	return &info->sync_baselines[p_id];
+}
+
+void SceneReplicationState::peer_sync_sent(int p_peer, const ObjectID &p_id, uint16_t p_time, const Vector<Variant> &p_state) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND(!info);
+	SyncBaseline *baseline = info->sync_baselines.getptr(p_id);
+	ERR_FAIL_COND(!baseline);
+	baseline->add_pending(p_time, p_state);
+	if (!info->sync_sent.has(p_time) && info->sync_sent.size() >= SyncBaseline::MAX_PENDING_RECORDS) {
+		// The oldest packet is not going to be acknowledged anymore.
+		info->sync_sent.erase(info->sync_sent.begin()->key);
+	}
+	info->sync_sent[p_time].push_back(p_id);
+}
+
+void SceneReplicationState::peer_sync_acknowledged(int p_peer, uint16_t p_time) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND(!info);
+	const LocalVector<ObjectID> *sent = info->sync_sent.getptr(p_time);
+	if (!sent) {
+		return; // Already acknowledged, or too old.
+	}
+	for (uint32_t i = 0; i < sent->size(); i++) {
+		SyncBaseline *baseline = info->sync_baselines.getptr((*sent)[i]);
+		if (baseline) {
+			baseline->acknowledge(p_time);
+		}
+	}
+	// The packets sent before it can't be acknowledged anymore for these nodes, and the other ones were superseded or lost.
+	LocalVector<uint16_t> to_erase;
+	for (const KeyValue<uint16_t, LocalVector<ObjectID>> &E : info->sync_sent) {
+		if (uint16_t(p_time - E.key) < 32768) {
+			to_erase.push_back(E.key);
+		}
+	}
+	for (uint32_t i = 0; i < to_erase.size(); i++) {
+		info->sync_sent.erase(to_erase[i]);
+	}
+}
+
+void SceneReplicationState::peer_add_sync_ack(int p_peer, uint16_t p_time) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND(!info);
+	info->sync_acks.push_back(p_time);
+}
+
+LocalVector<uint16_t> SceneReplicationState::peer_take_sync_acks(int p_peer) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_COND_V(!info, LocalVector<uint16_t>());
+	LocalVector<uint16_t> acks = info->sync_acks;
+	info->sync_acks.clear();
+	return acks;
+}
+
+void SceneReplicationState::SyncBaseline::reset(int p_size) {
+	state.clear();
+	state.resize(p_size);
+	known.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		known[i] = false;
+	}
+	pending.clear();
+}
+
+bool SceneReplicationState::SyncBaseline::is_known(int p_index, const Variant &p_value) const {
+	if (!known[p_index] || state[p_index] != p_value) {
+		return false;
+	}
+	// The peer may still apply any of the states in flight, so they must all agree too.
+	for (uint32_t i = 0; i < pending.size(); i++) {
+		if (pending[i].state[p_index] != p_value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void SceneReplicationState::SyncBaseline::add_pending(uint16_t p_time, const Vector<Variant> &p_state) {
+	if (pending.size() == MAX_PENDING_RECORDS) {
+		// Give up on the oldest state, the peer may or may not have applied it.
+		const Vector<Variant> &oldest = pending[0].state;
+		for (int i = 0; i < state.size(); i++) {
+			if (oldest[i] != state[i]) {
+				known[i] = false;
+			}
+		}
+		pending.remove_at(0);
+	}
+	Record record;
+	record.time = p_time;
+	record.state = p_state;
+	pending.push_back(record);
+}
+
+void SceneReplicationState::SyncBaseline::acknowledge(uint16_t p_time) {
+	int acked = -1;
+	for (uint32_t i = 0; i < pending.size(); i++) {
+		if (pending[i].time == p_time) {
+			acked = i;
+			break;
+		}
+	}
+	if (acked < 0) {
+		return;
+	}
+
+	// The peer applied this state, or a later one still in flight, so it surely holds only the values they all agree on.
+	const Vector<Variant> &acked_state = pending[acked].state;
+	ERR_FAIL_COND(acked_state.size() != state.size());
+	for (int i = 0; i < acked_state.size(); i++) {
+		bool agreed = true;
+		for (uint32_t j = acked + 1; j < pending.size() && agreed; j++) {
+			agreed = pending[j].state[i] == acked_state[i];
+		}
+		if (agreed) {
+			state.write[i] = acked_state[i];
+		}
+		known[i] = agreed;
+	}
+
+	// The peer discards older states of this node from now on.
+	uint32_t removed = acked + 1;
+	for (uint32_t i = removed; i < pending.size(); i++) {
+		pending[i - removed] = pending[i];
+	}
+	pending.resize(pending.size() - removed);
+}
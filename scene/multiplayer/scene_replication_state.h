@@ -32,12 +32,36 @@
 #define SCENE_REPLICATION_STATE_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class MultiplayerSpawner;
 class MultiplayerSynchronizer;
 class Node;
 
 class SceneReplicationState : public RefCounted {
+public:
+	// What a peer is known to hold of the synchronized properties of a node, to only send it the ones that changed.
+	struct SyncBaseline {
+		struct Record {
+			uint16_t time = 0;
+			Vector<Variant> state;
+		};
+
+		enum {
+			MAX_PENDING_RECORDS = 32,
+		};
+
+		Vector<Variant> state; // Only meaningful for the properties marked as known.
+		LocalVector<bool> known;
+		LocalVector<Record> pending; // Full states sent and not yet acknowledged, oldest first.
+		uint32_t deferred = 0; // Times in a row the state was held back by the send budget.
+
+		void reset(int p_size);
+		bool is_known(int p_index, const Variant &p_value) const;
+		void add_pending(uint16_t p_time, const Vector<Variant> &p_state);
+		void acknowledge(uint16_t p_time);
+	};
+
 private:
 	struct TrackedNode {
 		ObjectID id;
@@ -67,6 +91,9 @@ private:
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
 		uint16_t last_recv_sync = 0;
+		HashMap<ObjectID, SyncBaseline> sync_baselines;
+		HashMap<uint16_t, LocalVector<ObjectID>> sync_sent; // Nodes sent in each sync packet not acknowledged yet.
+		LocalVector<uint16_t> sync_acks; // Received sync packets not acknowledged yet.
 	};
 
 	HashSet<int> known_peers;
@@ -126,6 +153,12 @@ public:
 	uint16_t peer_sync_next(int p_peer);
 	void peer_sync_recv(int p_peer, uint16_t p_time);
 
+	SyncBaseline *peer_get_sync_baseline(int p_peer, const ObjectID &p_id);
+	void peer_sync_sent(int p_peer, const ObjectID &p_id, uint16_t p_time, const Vector<Variant> &p_state);
+	void peer_sync_acknowledged(int p_peer, uint16_t p_time);
+	void peer_add_sync_ack(int p_peer, uint16_t p_time);
+	LocalVector<uint16_t> peer_take_sync_acks(int p_peer);
+
 	SceneReplicationState() {}
 };
 
@@ -30,6 +30,7 @@
 
 #include "scene/multiplayer/scene_rpc_interface.h"
 
+#include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
 #include "core/multiplayer/multiplayer_api.h"
@@ -396,14 +397,9 @@ void SceneRPCInterface::_send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, con
 	multiplayer->profile_bandwidth("out", ofs);
 #endif
 
-	// Take chance and set transfer mode, since all send methods will use it.
-	peer->set_transfer_channel(p_config.channel);
-	peer->set_transfer_mode(p_config.transfer_mode);
-
 	if (has_all_peers) {
 		// They all have verified paths, so send fast.
-		peer->set_target_peer(p_to); // To all of you.
-		peer->put_packet(packet_cache.ptr(), ofs); // A message with love.
+		_put_rpc(p_to, p_config, packet_cache.ptr(), ofs); // A message with love, to all of you.
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
 		CRASH_COND(node_id_compression != NETWORK_NODE_ID_COMPRESSION_32);
@@ -428,21 +424,106 @@ void SceneRPCInterface::_send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, con
 
 			bool confirmed = multiplayer->is_cache_confirmed(from_path, P);
 
-			peer->set_target_peer(P); // To this one specifically.
-
+			// To this one specifically.
 			if (confirmed) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc_id, &(packet_cache.write[1]));
-				peer->put_packet(packet_cache.ptr(), ofs);
+				_put_rpc(P, p_config, packet_cache.ptr(), ofs);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				peer->put_packet(packet_cache.ptr(), ofs + path_len);
+				_put_rpc(P, p_config, packet_cache.ptr(), ofs + path_len);
 			}
 		}
 	}
 }
 
+void SceneRPCInterface::_put_rpc(int p_to, const Multiplayer::RPCConfig &p_config, const uint8_t *p_packet, int p_size) {
+	// RPCs on a channel must arrive in the order they were called, so first send the batches going to any of the same peers.
+	for (uint32_t i = 0; i < batches.size();) {
+		const RPCBatch &batch = batches[i];
+		bool overlaps = batch.to != p_to && (batch.to <= 0 || p_to <= 0);
+		if (overlaps && batch.transfer_mode == p_config.transfer_mode && batch.channel == p_config.channel) {
+			_flush_batch(i);
+		} else {
+			i++;
+		}
+	}
+
+	const int entry_size = 2 + p_size;
+	if (1 + entry_size > max_batch_size || p_size > UINT16_MAX) {
+		// Batching disabled, or too big to share the packet.
+		for (uint32_t i = 0; i < batches.size(); i++) {
+			if (batches[i].to == p_to && batches[i].transfer_mode == p_config.transfer_mode && batches[i].channel == p_config.channel) {
+				_flush_batch(i);
+				break;
+			}
+		}
+		Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+		peer->set_transfer_channel(p_config.channel);
+		peer->set_transfer_mode(p_config.transfer_mode);
+		peer->set_target_peer(p_to);
+		peer->put_packet(p_packet, p_size);
+		return;
+	}
+
+	RPCBatch *batch = nullptr;
+	for (uint32_t i = 0; i < batches.size(); i++) {
+		if (batches[i].to == p_to && batches[i].transfer_mode == p_config.transfer_mode && batches[i].channel == p_config.channel) {
+			if ((int)batches[i].data.size() + entry_size > max_batch_size) {
+				_flush_batch(i);
+			} else {
+				batch = &batches[i];
+			}
+			break;
+		}
+	}
+	if (!batch) {
+		RPCBatch new_batch;
+		new_batch.to = p_to;
+		new_batch.transfer_mode = p_config.transfer_mode;
+		new_batch.channel = p_config.channel;
+		new_batch.data.push_back(MultiplayerAPI::NETWORK_COMMAND_BATCH);
+		batches.push_back(new_batch);
+		batch = &batches[batches.size() - 1];
+	}
+	uint32_t ofs = batch->data.size();
+	batch->data.resize(ofs + entry_size);
+	encode_uint16(p_size, &batch->data[ofs]);
+	memcpy(&batch->data[ofs + 2], p_packet, p_size);
+	batch->count++;
+}
+
+void SceneRPCInterface::_flush_batch(uint32_t p_index) {
+	const RPCBatch &batch = batches[p_index];
+	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+	// The peer might have left, or the connection changed, since the RPCs were called.
+	bool can_send = peer.is_valid() && peer->get_connection_status() == MultiplayerPeer::CONNECTION_CONNECTED && (batch.to <= 0 || multiplayer->get_connected_peers().has(batch.to));
+	if (can_send) {
+		peer->set_transfer_channel(batch.channel);
+		peer->set_transfer_mode(batch.transfer_mode);
+		peer->set_target_peer(batch.to);
+		if (batch.count == 1) {
+			// Skip the batch header.
+			peer->put_packet(&batch.data[3], batch.data.size() - 3);
+		} else {
+			peer->put_packet(batch.data.ptr(), batch.data.size());
+		}
+	}
+	batches.remove_at(p_index);
+}
+
+void SceneRPCInterface::on_network_process() {
+	while (batches.size()) {
+		_flush_batch(0);
+	}
+}
+
+SceneRPCInterface::SceneRPCInterface(MultiplayerAPI *p_multiplayer) {
+	multiplayer = p_multiplayer;
+	max_batch_size = GLOBAL_GET("network/limits/rpc/max_batch_size");
+}
+
 void SceneRPCInterface::rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) {
 	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
 	ERR_FAIL_COND_MSG(!peer.is_valid(), "Trying to call an RPC while no multiplayer peer is active.");
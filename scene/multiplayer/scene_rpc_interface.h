@@ -66,8 +66,21 @@ private:
 		BYTE_ONLY_OR_NO_ARGS_FLAG = (1 << BYTE_ONLY_OR_NO_ARGS_SHIFT),
 	};
 
+	struct RPCBatch {
+		int to = 0;
+		Multiplayer::TransferMode transfer_mode = Multiplayer::TRANSFER_MODE_RELIABLE;
+		int channel = 0;
+		int count = 0;
+		LocalVector<uint8_t> data; // The batch command, then the size and content of each RPC packet.
+	};
+
 	MultiplayerAPI *multiplayer = nullptr;
 	Vector<uint8_t> packet_cache;
+	LocalVector<RPCBatch> batches;
+	int max_batch_size = 0; // 0 means RPCs are sent right away.
+
+	void _put_rpc(int p_to, const Multiplayer::RPCConfig &p_config, const uint8_t *p_packet, int p_size);
+	void _flush_batch(uint32_t p_index);
 
 protected:
 	static MultiplayerRPCInterface *_create(MultiplayerAPI *p_multiplayer);
@@ -84,8 +97,9 @@ public:
 	virtual void rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) override;
 	virtual void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len) override;
 	virtual String get_rpc_md5(const Object *p_obj) const override;
+	virtual void on_network_process() override;
 
-	SceneRPCInterface(MultiplayerAPI *p_multiplayer) { multiplayer = p_multiplayer; }
+	SceneRPCInterface(MultiplayerAPI *p_multiplayer);
 };
 
 #endif // SCENE_RPC_INTERFACE_H
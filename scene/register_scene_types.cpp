@@ -171,6 +171,7 @@
 #include "scene/resources/primitive_meshes.h"
 #include "scene/resources/rectangle_shape_2d.h"
 #include "scene/resources/resource_format_text.h"
+#include "scene/resources/scene_pool.h"
 #include "scene/resources/segment_shape_2d.h"
 #include "scene/resources/separation_ray_shape_2d.h"
 #include "scene/resources/separation_ray_shape_3d.h"
@@ -931,6 +932,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_CLASS(ScenePool);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
@@ -1113,11 +1115,33 @@ void register_scene_types() {
 		GLOBAL_DEF_BASIC(vformat("%s/layer_%d", PNAME("layer_names/3d_navigation"), i + 1), "");
 	}
 
+	// Node and Control settings, defined here since _bind_methods() may only run once the class is first looked up.
+	GLOBAL_DEF("editor/node_naming/name_num_separator", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/node_naming/name_num_separator", PropertyInfo(Variant::INT, "editor/node_naming/name_num_separator", PROPERTY_HINT_ENUM, "None,Space,Underscore,Dash"));
+	GLOBAL_DEF("editor/node_naming/name_casing", Node::NAME_CASING_PASCAL_CASE);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/node_naming/name_casing", PropertyInfo(Variant::INT, "editor/node_naming/name_casing", PROPERTY_HINT_ENUM, "PascalCase,camelCase,snake_case"));
+
+	GLOBAL_DEF("gui/common/default_scroll_deadzone", 0);
+	GLOBAL_DEF("gui/timers/incremental_search_max_interval_msec", 2000);
+	ProjectSettings::get_singleton()->set_custom_property_info("gui/timers/incremental_search_max_interval_msec", PropertyInfo(Variant::INT, "gui/timers/incremental_search_max_interval_msec", PROPERTY_HINT_RANGE, "0,10000,1,or_greater")); // No negative numbers
+
+	GLOBAL_DEF("gui/timers/text_edit_idle_detect_sec", 3);
+	ProjectSettings::get_singleton()->set_custom_property_info("gui/timers/text_edit_idle_detect_sec", PropertyInfo(Variant::FLOAT, "gui/timers/text_edit_idle_detect_sec", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater")); // No negative numbers.
+	GLOBAL_DEF("gui/common/text_edit_undo_stack_max_size", 1024);
+	ProjectSettings::get_singleton()->set_custom_property_info("gui/common/text_edit_undo_stack_max_size", PropertyInfo(Variant::INT, "gui/common/text_edit_undo_stack_max_size", PROPERTY_HINT_RANGE, "0,10000,1,or_greater")); // No negative numbers.
+
 	if (RenderingServer::get_singleton()) {
 		ColorPicker::init_shaders(); // RenderingServer needs to exist for this to succeed.
+		// Stop streaming in full size textures while video memory is running out.
+		RenderingServer::get_singleton()->connect(SNAME("video_memory_pressure_changed"), callable_mp_static(&CompressedTexture2D::set_streaming_paused), Vector<Variant>(), Object::CONNECT_DEFERRED);
 	}
 
 	SceneDebugger::initialize();
+
+	GLOBAL_DEF("network/limits/replication/max_sync_bytes_per_peer", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("network/limits/replication/max_sync_bytes_per_peer", PropertyInfo(Variant::INT, "network/limits/replication/max_sync_bytes_per_peer", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"));
+	GLOBAL_DEF("network/limits/rpc/max_batch_size", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("network/limits/rpc/max_batch_size", PropertyInfo(Variant::INT, "network/limits/rpc/max_batch_size", PROPERTY_HINT_RANGE, "0,65536,1"));
 	SceneReplicationInterface::make_default();
 	SceneRPCInterface::make_default();
 	SceneCacheInterface::make_default();
@@ -1175,6 +1199,7 @@ void initialize_theme() {
 void unregister_scene_types() {
 	SceneDebugger::deinitialize();
 	clear_default_theme();
+	HTTPRequest::clear_connection_pool();
 
 	ResourceLoader::remove_resource_format_loader(resource_loader_texture_layered);
 	resource_loader_texture_layered.unref();
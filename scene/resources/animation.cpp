@@ -62,6 +62,7 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 			compression.pages[i].time_offset = page["time_offset"];
 		}
 		compression.enabled = true;
+		compression.id = compression_id_counter.increment();
 		return true;
 	} else if (name.begins_with("tracks/")) {
 		int track = name.get_slicec('/', 1).to_int();
@@ -4854,6 +4855,7 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 	compression.bounds = track_bounds;
 	compression.fps = p_fps;
 	compression.enabled = true;
+	compression.id = compression_id_counter.increment();
 
 	for (uint32_t i = 0; i < tracks_to_compress.size(); i++) {
 		Track *t = tracks[tracks_to_compress[i]];
@@ -4912,6 +4914,8 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
+SafeNumeric<uint64_t> Animation::compression_id_counter;
+
 bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
 	Vector3i current;
 	Vector3i next;
@@ -4992,15 +4996,48 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		*key_index = 0;
 	}
 
+	// Small direct-mapped, per-thread cache of the decoded keys, so the many instances playing the same
+	// animation in sync (crowds) decode each track only once per frame. The pages of a compression id never change.
+	struct FetchCacheEntry {
+		uint64_t compression_id = 0;
+		uint32_t track = 0;
+		double time = 0.0;
+		Vector3i current_value;
+		double current_time = 0.0;
+		Vector3i next_value;
+		double next_time = 0.0;
+		uint32_t key_index = 0;
+	};
+	static const uint32_t FETCH_CACHE_SIZE = 1024;
+	static thread_local FetchCacheEntry fetch_cache[FETCH_CACHE_SIZE];
+
+	uint32_t slot = hash_murmur3_one_double(p_time, hash_murmur3_one_32(p_compressed_track, hash_murmur3_one_64(compression.id))) & (FETCH_CACHE_SIZE - 1);
+	FetchCacheEntry &entry = fetch_cache[slot];
+	if (entry.compression_id == compression.id && entry.track == p_compressed_track && entry.time == p_time) {
+		r_current_value = entry.current_value;
+		r_current_time = entry.current_time;
+		r_next_value = entry.next_value;
+		r_next_time = entry.next_time;
+		if (key_index) {
+			*key_index = entry.key_index;
+		}
+		return true;
+	}
+
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	// Last page starting before p_time.
+	uint32_t page_begin = 0;
+	uint32_t page_end = compression.pages.size();
+	while (page_begin < page_end) {
+		uint32_t middle = (page_begin + page_end) / 2;
+		if (compression.pages[middle].time_offset > p_time) {
+			page_end = middle;
+		} else {
+			page_begin = middle + 1;
 		}
-		page_index = i;
 	}
+	int32_t page_index = int32_t(page_begin) - 1;
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -5013,25 +5050,24 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	const uint16_t *time_keys = (const uint16_t *)&page_data[indices[p_compressed_track * 3 + 0]];
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
-	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
-
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
-
-		if (frame_time > p_time) {
-			break;
-		}
-
-		if (key_index) {
-			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
+	// Last time key starting before p_time, the first one is used if none does.
+	uint32_t packet_begin = 1;
+	uint32_t packet_end = time_key_count;
+	while (packet_begin < packet_end) {
+		uint32_t middle = (packet_begin + packet_end) / 2;
+		if (double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+			packet_end = middle;
+		} else {
+			packet_begin = middle + 1;
 		}
+	}
+	int32_t packet_idx = packet_begin - 1;
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
+	double packet_time = double(base_frame) * frame_to_sec + page_base_time;
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+	uint32_t found_key_index = 0;
+	for (int32_t i = 0; i < packet_idx; i++) {
+		found_key_index += (time_keys[i * 2 + 1] >> 12) + 1;
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
@@ -5095,9 +5131,7 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 					decode[j] = decode_next[j];
 				}
 
-				if (key_index) {
-					(*key_index)++;
-				}
+				found_key_index++;
 			}
 		}
 
@@ -5128,6 +5162,19 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		r_next_value[i] = decode_next[i];
 	}
 
+	if (key_index) {
+		*key_index = found_key_index;
+	}
+
+	entry.compression_id = compression.id;
+	entry.track = p_compressed_track;
+	entry.time = p_time;
+	entry.current_value = r_current_value;
+	entry.current_time = r_current_time;
+	entry.next_value = r_next_value;
+	entry.next_time = r_next_time;
+	entry.key_index = found_key_index;
+
 	return true;
 }
 
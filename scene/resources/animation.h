@@ -33,6 +33,7 @@
 
 #include "core/io/resource.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 #define ANIM_MIN_LENGTH 0.001
 
@@ -311,8 +312,11 @@ private:
 		LocalVector<Page> pages;
 		LocalVector<AABB> bounds; //used by position and scale tracks (which contain index to track and index to bounds).
 		bool enabled = false;
+		uint64_t id = 0; // Unique for each set of pages, identifies them in the decoded key cache.
 	} compression;
 
+	static SafeNumeric<uint64_t> compression_id_counter;
+
 	Vector3i _compress_key(uint32_t p_track, const AABB &p_bounds, int32_t p_key = -1, float p_time = 0.0);
 	bool _rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const;
 	bool _pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const;
@@ -32,6 +32,7 @@
 
 #include "core/io/file_access.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
 
 void AudioStreamPlaybackSample::start(float p_from_pos) {
 	if (base->format == AudioStreamSample::FORMAT_IMA_ADPCM) {
@@ -86,6 +87,29 @@ void AudioStreamPlaybackSample::seek(float p_time) {
 	offset = uint64_t(p_time * base->mix_rate) << MIX_FRAC_BITS;
 }
 
+bool AudioStreamPlaybackSample::can_skip() const {
+	// IMA-ADPCM can't seek, and the position of backward loops depends on the direction.
+	return base->format != AudioStreamSample::FORMAT_IMA_ADPCM && (base->loop_mode == AudioStreamSample::LOOP_DISABLED || base->loop_mode == AudioStreamSample::LOOP_FORWARD);
+}
+
+void AudioStreamPlaybackSample::skip(float p_time) {
+	if (!active) {
+		return;
+	}
+
+	int64_t position = int64_t(offset >> MIX_FRAC_BITS) + int64_t(p_time * base->mix_rate);
+	if (base->loop_mode == AudioStreamSample::LOOP_FORWARD && base->loop_end > base->loop_begin) {
+		if (position >= base->loop_end) {
+			position = base->loop_begin + (position - base->loop_begin) % (base->loop_end - base->loop_begin);
+		}
+	} else if (position >= int64_t(base->get_length() * base->mix_rate)) {
+		active = false;
+		return;
+	}
+
+	offset = position << MIX_FRAC_BITS;
+}
+
 template <class Depth, bool is_stereo, bool is_ima_adpcm>
 void AudioStreamPlaybackSample::do_resample(const Depth *p_src, AudioFrame *p_dst, int64_t &offset, int32_t &increment, uint32_t amount, IMA_ADPCM_State *ima_adpcm) {
 	// this function will be compiled branchless by any decent compiler
@@ -493,11 +517,14 @@ void AudioStreamSample::set_data(const Vector<uint8_t> &p_data) {
 	if (data) {
 		memfree(data);
 		data = nullptr;
-		data_bytes = 0;
 	}
+	data_bytes = 0;
 
 	int datalen = p_data.size();
-	if (datalen) {
+	if (datalen && ResourceLoader::is_stripping_payloads()) {
+		// Never played, only keep the size so get_length() still works.
+		data_bytes = datalen;
+	} else if (datalen) {
 		const uint8_t *r = p_data.ptr();
 		int alloc_len = datalen + DATA_PAD * 2;
 		data = memalloc(alloc_len); //alloc with some padding for interpolation
@@ -530,6 +557,7 @@ Error AudioStreamSample::save_to_wav(const String &p_path) {
 		WARN_PRINT("Saving IMA_ADPC samples are not supported yet");
 		return ERR_UNAVAILABLE;
 	}
+	ERR_FAIL_COND_V_MSG(data_bytes && !data, ERR_UNAVAILABLE, "The sample data was stripped when loading, see ResourceLoader::set_strip_payloads().");
 
 	int sub_chunk_2_size = data_bytes; //Subchunk2Size = Size of data in bytes
 
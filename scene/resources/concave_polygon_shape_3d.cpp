@@ -73,6 +73,9 @@ void ConcavePolygonShape3D::_update_shape() {
 	Dictionary d;
 	d["faces"] = faces;
 	d["backface_collision"] = backface_collision;
+	if (!bvh_data.is_empty()) {
+		d["bvh"] = bvh_data;
+	}
 	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
 
 	Shape3D::_update_shape();
@@ -81,6 +84,7 @@ void ConcavePolygonShape3D::_update_shape() {
 void ConcavePolygonShape3D::set_faces(const Vector<Vector3> &p_faces) {
 	faces = p_faces;
 	_update_shape();
+	bvh_data.clear();
 	notify_change_to_owners();
 }
 
@@ -101,6 +105,19 @@ bool ConcavePolygonShape3D::is_backface_collision_enabled() const {
 	return backface_collision;
 }
 
+void ConcavePolygonShape3D::_set_bvh_data(const PackedByteArray &p_data) {
+	// Used by the next call to set_faces(), so loading the shape doesn't rebuild its BVH.
+	bvh_data = p_data;
+}
+
+PackedByteArray ConcavePolygonShape3D::_get_bvh_data() const {
+	if (faces.is_empty()) {
+		return PackedByteArray();
+	}
+	Dictionary d = PhysicsServer3D::get_singleton()->shape_get_data(get_shape());
+	return d.get("bvh", PackedByteArray());
+}
+
 void ConcavePolygonShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_faces", "faces"), &ConcavePolygonShape3D::set_faces);
 	ClassDB::bind_method(D_METHOD("get_faces"), &ConcavePolygonShape3D::get_faces);
@@ -108,8 +125,13 @@ void ConcavePolygonShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_backface_collision_enabled", "enabled"), &ConcavePolygonShape3D::set_backface_collision_enabled);
 	ClassDB::bind_method(D_METHOD("is_backface_collision_enabled"), &ConcavePolygonShape3D::is_backface_collision_enabled);
 
-	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR3_ARRAY, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_faces", "get_faces");
+	ClassDB::bind_method(D_METHOD("_set_bvh_data", "data"), &ConcavePolygonShape3D::_set_bvh_data);
+	ClassDB::bind_method(D_METHOD("_get_bvh_data"), &ConcavePolygonShape3D::_get_bvh_data);
+
+	// The BVH and backface collision are loaded before the faces, so the shape is only set up once.
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "bvh", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "_set_bvh_data", "_get_bvh_data");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "backface_collision"), "set_backface_collision_enabled", "is_backface_collision_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR3_ARRAY, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_faces", "get_faces");
 }
 
 ConcavePolygonShape3D::ConcavePolygonShape3D() :
@@ -38,6 +38,7 @@ class ConcavePolygonShape3D : public Shape3D {
 
 	Vector<Vector3> faces;
 	bool backface_collision = false;
+	PackedByteArray bvh_data; // Saved BVH, only kept until the faces it was built for are set.
 
 	struct DrawEdge {
 		Vector3 a;
@@ -64,6 +65,9 @@ protected:
 
 	virtual void _update_shape() override;
 
+	void _set_bvh_data(const PackedByteArray &p_data);
+	PackedByteArray _get_bvh_data() const;
+
 public:
 	void set_faces(const Vector<Vector3> &p_faces);
 	Vector<Vector3> get_faces() const;
@@ -179,6 +179,41 @@ Vector<real_t> HeightMapShape3D::get_map_data() const {
 	return map_data;
 }
 
+void HeightMapShape3D::set_map_data_region(const Rect2i &p_region, const Vector<real_t> &p_data) {
+	ERR_FAIL_COND(p_region.position.x < 0 || p_region.position.y < 0 || p_region.size.x <= 0 || p_region.size.y <= 0);
+	ERR_FAIL_COND(p_region.get_end().x > map_width || p_region.get_end().y > map_depth);
+	ERR_FAIL_COND(p_data.size() != p_region.size.x * p_region.size.y);
+
+	real_t *w = map_data.ptrw();
+	const real_t *r = p_data.ptr();
+	real_t region_min_height = r[0];
+	real_t region_max_height = r[0];
+	for (int z = 0; z < p_region.size.y; z++) {
+		for (int x = 0; x < p_region.size.x; x++) {
+			real_t val = r[z * p_region.size.x + x];
+			w[(p_region.position.y + z) * map_width + p_region.position.x + x] = val;
+			region_min_height = MIN(region_min_height, val);
+			region_max_height = MAX(region_max_height, val);
+		}
+	}
+
+	// Like the physics shape, the height range is only grown, to avoid going through all the heights.
+	min_height = MIN(min_height, region_min_height);
+	max_height = MAX(max_height, region_max_height);
+
+	// Only send the region, so the physics server doesn't rebuild the whole shape.
+	Dictionary d;
+	d["width"] = map_width;
+	d["depth"] = map_depth;
+	d["region"] = p_region;
+	d["heights"] = p_data;
+	d["min_height"] = region_min_height;
+	d["max_height"] = region_max_height;
+	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
+	Shape3D::_update_shape();
+	notify_change_to_owners();
+}
+
 void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_map_width", "width"), &HeightMapShape3D::set_map_width);
 	ClassDB::bind_method(D_METHOD("get_map_width"), &HeightMapShape3D::get_map_width);
@@ -186,6 +221,7 @@ void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_map_depth"), &HeightMapShape3D::get_map_depth);
 	ClassDB::bind_method(D_METHOD("set_map_data", "data"), &HeightMapShape3D::set_map_data);
 	ClassDB::bind_method(D_METHOD("get_map_data"), &HeightMapShape3D::get_map_data);
+	ClassDB::bind_method(D_METHOD("set_map_data_region", "region", "data"), &HeightMapShape3D::set_map_data_region);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "map_width", PROPERTY_HINT_RANGE, "0.001,100,0.001,or_greater"), "set_map_width", "get_map_width");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "map_depth", PROPERTY_HINT_RANGE, "0.001,100,0.001,or_greater"), "set_map_depth", "get_map_depth");
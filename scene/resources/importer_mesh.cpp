@@ -618,6 +618,248 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 	}
 }
 
+void ImporterMesh::generate_meshlets(int p_max_vertices, int p_max_triangles, float p_cone_weight) {
+	ERR_FAIL_COND_MSG(!SurfaceTool::build_meshlets_bound_func || !SurfaceTool::build_meshlets_func || !SurfaceTool::compute_cluster_bounds_func, "Generating meshlets requires the meshoptimizer module.");
+	ERR_FAIL_COND(p_max_vertices < 3 || p_max_vertices > 255);
+	ERR_FAIL_COND_MSG(p_max_triangles < 4 || p_max_triangles > 512 || p_max_triangles % 4 != 0, "The maximum amount of triangles per meshlet must be a multiple of 4, between 4 and 512.");
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		surfaces.write[i].meshlet_data.clear();
+
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+
+		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+		PackedInt32Array indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+
+		unsigned int index_count = indices.size();
+		unsigned int vertex_count = vertices.size();
+
+		if (index_count == 0) {
+			continue; // No meshlets if no indices.
+		}
+
+		LocalVector<float> positions;
+		positions.resize(vertex_count * 3);
+		for (unsigned int j = 0; j < vertex_count; j++) {
+			positions[j * 3 + 0] = vertices[j].x;
+			positions[j * 3 + 1] = vertices[j].y;
+			positions[j * 3 + 2] = vertices[j].z;
+		}
+
+		LocalVector<unsigned int> meshlet_index_counts;
+		meshlet_index_counts.resize(SurfaceTool::build_meshlets_bound_func(index_count, p_max_vertices, p_max_triangles));
+
+		PackedInt32Array new_indices;
+		new_indices.resize(index_count);
+		unsigned int *new_indices_ptr = (unsigned int *)new_indices.ptrw();
+
+		size_t meshlet_count = SurfaceTool::build_meshlets_func(meshlet_index_counts.ptr(), new_indices_ptr, (const unsigned int *)indices.ptr(), index_count, positions.ptr(), vertex_count, sizeof(float) * 3, p_max_vertices, p_max_triangles, p_cone_weight);
+
+		Vector<uint8_t> meshlet_data;
+		meshlet_data.resize(meshlet_count * RS::SurfaceData::MESHLET_DATA_STRIDE);
+		uint8_t *meshlet_ptr = meshlet_data.ptrw();
+
+		uint32_t offset = 0;
+		for (size_t j = 0; j < meshlet_count; j++) {
+			uint32_t meshlet_range[2] = { offset, meshlet_index_counts[j] };
+			float bounds[8];
+			SurfaceTool::compute_cluster_bounds_func(bounds, new_indices_ptr + offset, meshlet_index_counts[j], positions.ptr(), vertex_count, sizeof(float) * 3);
+
+			memcpy(meshlet_ptr, meshlet_range, sizeof(meshlet_range));
+			memcpy(meshlet_ptr + sizeof(meshlet_range), bounds, sizeof(bounds));
+			meshlet_ptr += RS::SurfaceData::MESHLET_DATA_STRIDE;
+			offset += meshlet_index_counts[j];
+		}
+
+		// Triangles are only reordered, so the LODs remain valid.
+		surfaces.write[i].arrays[RS::ARRAY_INDEX] = new_indices;
+		surfaces.write[i].meshlet_data = meshlet_data;
+	}
+}
+
+// Moves the values of each vertex to its position in p_remap, dropping the unused ones (remapped to UINT32_MAX).
+template <class T>
+static Vector<T> _remap_vertex_array(const Vector<T> &p_array, const LocalVector<unsigned int> &p_remap, unsigned int p_new_vertex_count) {
+	const unsigned int vertex_count = p_remap.size();
+	const int elements = p_array.size() / vertex_count;
+
+	Vector<T> remapped;
+	remapped.resize(p_new_vertex_count * elements);
+	const T *src = p_array.ptr();
+	T *dst = remapped.ptrw();
+	for (unsigned int i = 0; i < vertex_count; i++) {
+		if (p_remap[i] == UINT32_MAX) {
+			continue;
+		}
+		for (int j = 0; j < elements; j++) {
+			dst[p_remap[i] * elements + j] = src[i * elements + j];
+		}
+	}
+	return remapped;
+}
+
+static bool _can_remap_vertex_array(const Variant &p_array, unsigned int p_vertex_count) {
+	int size = 0;
+	switch (p_array.get_type()) {
+		case Variant::NIL:
+			return true;
+		case Variant::PACKED_BYTE_ARRAY:
+			size = PackedByteArray(p_array).size();
+			break;
+		case Variant::PACKED_INT32_ARRAY:
+			size = PackedInt32Array(p_array).size();
+			break;
+		case Variant::PACKED_FLOAT32_ARRAY:
+			size = PackedFloat32Array(p_array).size();
+			break;
+		case Variant::PACKED_FLOAT64_ARRAY:
+			size = PackedFloat64Array(p_array).size();
+			break;
+		case Variant::PACKED_VECTOR2_ARRAY:
+			size = PackedVector2Array(p_array).size();
+			break;
+		case Variant::PACKED_VECTOR3_ARRAY:
+			size = PackedVector3Array(p_array).size();
+			break;
+		case Variant::PACKED_COLOR_ARRAY:
+			size = PackedColorArray(p_array).size();
+			break;
+		default:
+			return false;
+	}
+	return size % p_vertex_count == 0;
+}
+
+static Variant _remap_vertex_variant(const Variant &p_array, const LocalVector<unsigned int> &p_remap, unsigned int p_new_vertex_count) {
+	switch (p_array.get_type()) {
+		case Variant::PACKED_BYTE_ARRAY:
+			return _remap_vertex_array<uint8_t>(p_array, p_remap, p_new_vertex_count);
+		case Variant::PACKED_INT32_ARRAY:
+			return _remap_vertex_array<int32_t>(p_array, p_remap, p_new_vertex_count);
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return _remap_vertex_array<float>(p_array, p_remap, p_new_vertex_count);
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return _remap_vertex_array<double>(p_array, p_remap, p_new_vertex_count);
+		case Variant::PACKED_VECTOR2_ARRAY:
+			return _remap_vertex_array<Vector2>(p_array, p_remap, p_new_vertex_count);
+		case Variant::PACKED_VECTOR3_ARRAY:
+			return _remap_vertex_array<Vector3>(p_array, p_remap, p_new_vertex_count);
+		case Variant::PACKED_COLOR_ARRAY:
+			return _remap_vertex_array<Color>(p_array, p_remap, p_new_vertex_count);
+		default:
+			return p_array;
+	}
+}
+
+void ImporterMesh::optimize_vertex_order(float p_overdraw_threshold) {
+	ERR_FAIL_COND_MSG(!SurfaceTool::optimize_vertex_cache_func || !SurfaceTool::optimize_overdraw_func || !SurfaceTool::optimize_vertex_fetch_remap_func, "Optimizing the vertex order requires the meshoptimizer module.");
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+
+		Surface &surface = surfaces.write[i];
+		Vector<Vector3> vertices = surface.arrays[RS::ARRAY_VERTEX];
+		PackedInt32Array indices = surface.arrays[RS::ARRAY_INDEX];
+
+		unsigned int index_count = indices.size();
+		unsigned int vertex_count = vertices.size();
+
+		if (index_count == 0 || vertex_count == 0) {
+			continue; // Nothing to reorder if no indices.
+		}
+
+		LocalVector<float> positions;
+		positions.resize(vertex_count * 3);
+		for (unsigned int j = 0; j < vertex_count; j++) {
+			positions[j * 3 + 0] = vertices[j].x;
+			positions[j * 3 + 1] = vertices[j].y;
+			positions[j * 3 + 2] = vertices[j].z;
+		}
+
+		float acmr_before = 0.0f;
+		if (SurfaceTool::analyze_vertex_cache_func) {
+			acmr_before = SurfaceTool::analyze_vertex_cache_func((const unsigned int *)indices.ptr(), index_count, vertex_count, 16);
+		}
+
+		// Order the triangles for the post-transform cache first, then regroup them to reduce overdraw where it doesn't make the cache much worse.
+		PackedInt32Array new_indices;
+		new_indices.resize(index_count);
+		unsigned int *new_indices_ptr = (unsigned int *)new_indices.ptrw();
+		SurfaceTool::optimize_vertex_cache_func(new_indices_ptr, (const unsigned int *)indices.ptr(), index_count, vertex_count);
+		SurfaceTool::optimize_overdraw_func(new_indices_ptr, new_indices_ptr, index_count, positions.ptr(), vertex_count, sizeof(float) * 3, p_overdraw_threshold);
+
+		// Then store the vertices in the order they are first used, which requires every vertex array to be remapped.
+		bool can_remap = true;
+		for (int j = 0; j < RS::ARRAY_MAX && can_remap; j++) {
+			can_remap = j == RS::ARRAY_INDEX || _can_remap_vertex_array(surface.arrays[j], vertex_count);
+		}
+		for (int j = 0; j < surface.blend_shape_data.size() && can_remap; j++) {
+			const Array &bs_arrays = surface.blend_shape_data[j].arrays;
+			for (int k = 0; k < bs_arrays.size() && can_remap; k++) {
+				// Blend shape arrays are full surface arrays, so they can hold an index array too.
+				can_remap = k == RS::ARRAY_INDEX || _can_remap_vertex_array(bs_arrays[k], vertex_count);
+			}
+		}
+
+		if (can_remap) {
+			// The LODs can use vertices the base index array doesn't, so they are appended to keep those vertices too.
+			LocalVector<unsigned int> fetch_indices;
+			fetch_indices.resize(index_count);
+			memcpy(fetch_indices.ptr(), new_indices_ptr, sizeof(unsigned int) * index_count);
+			for (int j = 0; j < surface.lods.size(); j++) {
+				const Vector<int> &lod_indices = surface.lods[j].indices;
+				for (int k = 0; k < lod_indices.size(); k++) {
+					fetch_indices.push_back(lod_indices[k]);
+				}
+			}
+
+			LocalVector<unsigned int> remap;
+			remap.resize(vertex_count);
+			unsigned int new_vertex_count = SurfaceTool::optimize_vertex_fetch_remap_func(remap.ptr(), fetch_indices.ptr(), fetch_indices.size(), vertex_count);
+
+			for (unsigned int j = 0; j < index_count; j++) {
+				new_indices_ptr[j] = remap[new_indices_ptr[j]];
+			}
+
+			for (int j = 0; j < RS::ARRAY_MAX; j++) {
+				if (j != RS::ARRAY_INDEX) {
+					surface.arrays[j] = _remap_vertex_variant(surface.arrays[j], remap, new_vertex_count);
+				}
+			}
+
+			for (int j = 0; j < surface.blend_shape_data.size(); j++) {
+				Array &bs_arrays = surface.blend_shape_data.write[j].arrays;
+				for (int k = 0; k < bs_arrays.size(); k++) {
+					if (k != RS::ARRAY_INDEX) {
+						bs_arrays[k] = _remap_vertex_variant(bs_arrays[k], remap, new_vertex_count);
+					}
+				}
+			}
+
+			for (int j = 0; j < surface.lods.size(); j++) {
+				Vector<int> &lod_indices = surface.lods.write[j].indices;
+				int *lod_indices_ptr = lod_indices.ptrw();
+				for (int k = 0; k < lod_indices.size(); k++) {
+					lod_indices_ptr[k] = remap[lod_indices_ptr[k]];
+				}
+			}
+		}
+
+		if (SurfaceTool::analyze_vertex_cache_func) {
+			float acmr_after = SurfaceTool::analyze_vertex_cache_func(new_indices_ptr, index_count, vertex_count, 16);
+			print_verbose(vformat("Mesh '%s' surface %d: ACMR %.3f -> %.3f.", get_name(), i, acmr_before, acmr_after));
+		}
+
+		// The triangles are reordered, so the meshlets no longer match the index array.
+		surface.arrays[RS::ARRAY_INDEX] = new_indices;
+		surface.meshlet_data.clear();
+	}
+}
+
 bool ImporterMesh::has_mesh() const {
 	return mesh.is_valid();
 }
@@ -654,7 +896,14 @@ Ref<ArrayMesh> ImporterMesh::get_mesh(const Ref<ArrayMesh> &p_base) {
 				}
 			}
 
-			mesh->add_surface_from_arrays(surfaces[i].primitive, surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+			if (surfaces[i].meshlet_data.is_empty()) {
+				mesh->add_surface_from_arrays(surfaces[i].primitive, surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+			} else {
+				RS::SurfaceData sd;
+				Error err = RS::get_singleton()->mesh_create_surface_data_from_arrays(&sd, (RS::PrimitiveType)surfaces[i].primitive, surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+				ERR_CONTINUE(err != OK);
+				mesh->add_surface(sd.format, Mesh::PrimitiveType(sd.primitive), sd.vertex_data, sd.attribute_data, sd.skin_data, sd.vertex_count, sd.index_data, sd.index_count, sd.aabb, sd.blend_shape_data, sd.bone_aabbs, sd.lods, surfaces[i].meshlet_data);
+			}
 			if (surfaces[i].material.is_valid()) {
 				mesh->surface_set_material(mesh->get_surface_count() - 1, surfaces[i].material);
 			}
@@ -812,6 +1061,9 @@ void ImporterMesh::_set_data(const Dictionary &p_data) {
 				flags = s["flags"];
 			}
 			add_surface(prim, arr, b_shapes, lods, material, name, flags);
+			if (s.has("meshlets")) {
+				surfaces.write[surfaces.size() - 1].meshlet_data = s["meshlets"];
+			}
 		}
 	}
 }
@@ -840,6 +1092,10 @@ Dictionary ImporterMesh::_get_data() const {
 			d["lods"] = lods;
 		}
 
+		if (surfaces[i].meshlet_data.size()) {
+			d["meshlets"] = surfaces[i].meshlet_data;
+		}
+
 		if (surfaces[i].material.is_valid()) {
 			d["material"] = surfaces[i].material;
 		}
@@ -1247,6 +1503,8 @@ void ImporterMesh::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_surface_material", "surface_idx", "material"), &ImporterMesh::set_surface_material);
 
 	ClassDB::bind_method(D_METHOD("generate_lods", "normal_merge_angle", "normal_split_angle"), &ImporterMesh::generate_lods);
+	ClassDB::bind_method(D_METHOD("generate_meshlets", "max_vertices", "max_triangles", "cone_weight"), &ImporterMesh::generate_meshlets, DEFVAL(64), DEFVAL(124), DEFVAL(0.25));
+	ClassDB::bind_method(D_METHOD("optimize_vertex_order", "overdraw_threshold"), &ImporterMesh::optimize_vertex_order, DEFVAL(1.05));
 	ClassDB::bind_method(D_METHOD("get_mesh", "base_mesh"), &ImporterMesh::get_mesh, DEFVAL(Ref<ArrayMesh>()));
 	ClassDB::bind_method(D_METHOD("clear"), &ImporterMesh::clear);
 
@@ -59,6 +59,7 @@ class ImporterMesh : public Resource {
 			float distance = 0.0f;
 		};
 		Vector<LOD> lods;
+		Vector<uint8_t> meshlet_data; // In the format of RS::SurfaceData::meshlet_data, ranges of arrays[RS::ARRAY_INDEX].
 		Ref<Material> material;
 		String name;
 		uint32_t flags = 0;
@@ -113,6 +114,8 @@ public:
 	void set_surface_material(int p_surface, const Ref<Material> &p_material);
 
 	void generate_lods(float p_normal_merge_angle, float p_normal_split_angle);
+	void generate_meshlets(int p_max_vertices = 64, int p_max_triangles = 124, float p_cone_weight = 0.25);
+	void optimize_vertex_order(float p_overdraw_threshold = 1.05);
 
 	void create_shadow_mesh();
 	Ref<ImporterMesh> get_shadow_mesh() const;
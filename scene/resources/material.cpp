@@ -527,8 +527,16 @@ void BaseMaterial3D::init_shaders() {
 }
 
 HashMap<uint64_t, Ref<StandardMaterial3D>> BaseMaterial3D::materials_for_2d;
+HashMap<BaseMaterial3D::MaterialInstanceFor2DKey, BaseMaterial3D::MaterialInstanceFor2D, BaseMaterial3D::MaterialInstanceFor2DKeyHasher> BaseMaterial3D::material_instances_for_2d;
+HashMap<RID, BaseMaterial3D::MaterialInstanceFor2DKey> BaseMaterial3D::material_instance_for_2d_keys;
 
 void BaseMaterial3D::finish_shaders() {
+	for (const KeyValue<MaterialInstanceFor2DKey, MaterialInstanceFor2D> &E : material_instances_for_2d) {
+		RS::get_singleton()->free(E.value.material);
+	}
+	material_instances_for_2d.clear();
+	material_instance_for_2d_keys.clear();
+
 	materials_for_2d.clear();
 
 	memdelete(dirty_materials);
@@ -2335,6 +2343,69 @@ Ref<Material> BaseMaterial3D::get_material_for_2d(bool p_shaded, bool p_transpar
 	return materials_for_2d[hash];
 }
 
+RID BaseMaterial3D::acquire_material_instance_for_2d(RID p_shader, RID p_texture, float p_alpha_scissor_threshold, int p_render_priority, float p_msdf_pixel_range, float p_msdf_outline_size) {
+	MaterialInstanceFor2DKey key;
+	key.shader = p_shader;
+	key.texture = p_texture;
+	key.alpha_scissor_threshold = p_alpha_scissor_threshold;
+	key.render_priority = p_render_priority;
+	key.msdf_pixel_range = p_msdf_pixel_range;
+	key.msdf_outline_size = p_msdf_outline_size;
+
+	MutexLock lock(material_mutex);
+
+	MaterialInstanceFor2D *instance = material_instances_for_2d.getptr(key);
+	if (instance) {
+		instance->users++;
+		return instance->material;
+	}
+
+	RID material = RS::get_singleton()->material_create();
+	// Set defaults for material, names need to match up those in StandardMaterial3D
+	RS::get_singleton()->material_set_param(material, "albedo", Color(1, 1, 1, 1));
+	RS::get_singleton()->material_set_param(material, "specular", 0.5);
+	RS::get_singleton()->material_set_param(material, "metallic", 0.0);
+	RS::get_singleton()->material_set_param(material, "roughness", 1.0);
+	RS::get_singleton()->material_set_param(material, "uv1_offset", Vector3(0, 0, 0));
+	RS::get_singleton()->material_set_param(material, "uv1_scale", Vector3(1, 1, 1));
+	RS::get_singleton()->material_set_param(material, "uv2_offset", Vector3(0, 0, 0));
+	RS::get_singleton()->material_set_param(material, "uv2_scale", Vector3(1, 1, 1));
+	RS::get_singleton()->material_set_param(material, "alpha_scissor_threshold", p_alpha_scissor_threshold);
+	if (p_msdf_pixel_range > 0.0) {
+		RS::get_singleton()->material_set_param(material, "msdf_pixel_range", p_msdf_pixel_range);
+		RS::get_singleton()->material_set_param(material, "msdf_outline_size", p_msdf_outline_size);
+	}
+	RS::get_singleton()->material_set_shader(material, p_shader);
+	RS::get_singleton()->material_set_param(material, "texture_albedo", p_texture);
+	RS::get_singleton()->material_set_render_priority(material, p_render_priority);
+
+	MaterialInstanceFor2D new_instance;
+	new_instance.key = key;
+	new_instance.material = material;
+	new_instance.users = 1;
+	material_instances_for_2d.insert(key, new_instance);
+	material_instance_for_2d_keys.insert(material, key);
+
+	return material;
+}
+
+void BaseMaterial3D::release_material_instance_for_2d(RID p_material) {
+	MutexLock lock(material_mutex);
+
+	MaterialInstanceFor2DKey *key = material_instance_for_2d_keys.getptr(p_material);
+	ERR_FAIL_COND(!key);
+
+	MaterialInstanceFor2D *instance = material_instances_for_2d.getptr(*key);
+	ERR_FAIL_COND(!instance);
+
+	instance->users--;
+	if (instance->users == 0) {
+		RS::get_singleton()->free(p_material);
+		material_instances_for_2d.erase(*key);
+		material_instance_for_2d_keys.erase(p_material);
+	}
+}
+
 void BaseMaterial3D::set_on_top_of_alpha() {
 	set_transparency(TRANSPARENCY_DISABLED);
 	set_render_priority(RENDER_PRIORITY_MAX);
@@ -549,6 +549,41 @@ private:
 
 	static HashMap<uint64_t, Ref<StandardMaterial3D>> materials_for_2d; //used by Sprite3D, Label3D and other stuff
 
+	struct MaterialInstanceFor2DKey {
+		RID shader;
+		RID texture;
+		float alpha_scissor_threshold = 0.0;
+		int render_priority = 0;
+		float msdf_pixel_range = 0.0;
+		float msdf_outline_size = 0.0;
+
+		bool operator==(const MaterialInstanceFor2DKey &p_key) const {
+			return shader == p_key.shader && texture == p_key.texture && alpha_scissor_threshold == p_key.alpha_scissor_threshold && render_priority == p_key.render_priority && msdf_pixel_range == p_key.msdf_pixel_range && msdf_outline_size == p_key.msdf_outline_size;
+		}
+	};
+
+	struct MaterialInstanceFor2DKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const MaterialInstanceFor2DKey &p_key) {
+			uint32_t h = hash_murmur3_one_64(p_key.shader.get_id());
+			h = hash_murmur3_one_64(p_key.texture.get_id(), h);
+			h = hash_murmur3_one_float(p_key.alpha_scissor_threshold, h);
+			h = hash_murmur3_one_32(p_key.render_priority, h);
+			h = hash_murmur3_one_float(p_key.msdf_pixel_range, h);
+			h = hash_murmur3_one_float(p_key.msdf_outline_size, h);
+			return hash_fmix32(h);
+		}
+	};
+
+	struct MaterialInstanceFor2D {
+		MaterialInstanceFor2DKey key;
+		RID material;
+		uint32_t users = 0;
+	};
+
+	// Sprites and labels drawing with the same shader, texture and parameters use the same material, so the renderer can draw them without switching materials.
+	static HashMap<MaterialInstanceFor2DKey, MaterialInstanceFor2D, MaterialInstanceFor2DKeyHasher> material_instances_for_2d;
+	static HashMap<RID, MaterialInstanceFor2DKey> material_instance_for_2d_keys;
+
 	void _validate_high_end(const String &text, PropertyInfo &property) const;
 
 protected:
@@ -764,6 +799,9 @@ public:
 	static void flush_changes();
 
 	static Ref<Material> get_material_for_2d(bool p_shaded, bool p_transparent, bool p_double_sided, bool p_cut_alpha, bool p_opaque_prepass, bool p_billboard = false, bool p_billboard_y = false, bool p_msdf = false, bool p_no_depth = false, bool p_fixed_size = false, TextureFilter p_filter = TEXTURE_FILTER_LINEAR_WITH_MIPMAPS, RID *r_shader_rid = nullptr);
+	// Returns a material using p_shader (from get_material_for_2d()) with the given parameters, shared with every other user of the same ones. Call release_material_instance_for_2d() when done with it.
+	static RID acquire_material_instance_for_2d(RID p_shader, RID p_texture, float p_alpha_scissor_threshold, int p_render_priority, float p_msdf_pixel_range = 0.0, float p_msdf_outline_size = 0.0);
+	static void release_material_instance_for_2d(RID p_material);
 
 	virtual RID get_shader_rid() const override;
 
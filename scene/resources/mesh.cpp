@@ -1357,6 +1357,10 @@ Array ArrayMesh::_get_surfaces() const {
 			data["bone_aabbs"] = bone_aabbs;
 		}
 
+		if (surface.meshlet_data.size()) {
+			data["meshlets"] = surface.meshlet_data;
+		}
+
 		if (surface.blend_shape_data.size()) {
 			data["blend_shapes"] = surface.blend_shape_data;
 		}
@@ -1437,6 +1441,10 @@ void ArrayMesh::_set_surfaces(const Array &p_surfaces) {
 			}
 		}
 
+		if (d.has("meshlets")) {
+			surface.meshlet_data = d["meshlets"];
+		}
+
 		if (d.has("blend_shapes")) {
 			surface.blend_shape_data = d["blend_shapes"];
 		}
@@ -1566,7 +1574,7 @@ void ArrayMesh::_recompute_aabb() {
 #ifndef _MSC_VER
 #warning need to add binding to add_surface using future MeshSurfaceData object
 #endif
-void ArrayMesh::add_surface(uint32_t p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data, const Vector<AABB> &p_bone_aabbs, const Vector<RS::SurfaceData::LOD> &p_lods) {
+void ArrayMesh::add_surface(uint32_t p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data, const Vector<AABB> &p_bone_aabbs, const Vector<RS::SurfaceData::LOD> &p_lods, const Vector<uint8_t> &p_meshlet_data) {
 	_create_if_empty();
 
 	Surface s;
@@ -1593,6 +1601,7 @@ void ArrayMesh::add_surface(uint32_t p_format, PrimitiveType p_primitive, const
 	sd.blend_shape_data = p_blend_shape_data;
 	sd.bone_aabbs = p_bone_aabbs;
 	sd.lods = p_lods;
+	sd.meshlet_data = p_meshlet_data;
 
 	RenderingServer::get_singleton()->mesh_add_surface(mesh, sd);
 
@@ -106,6 +106,7 @@ protected:
 	float verts_per_poly = 6.0f;
 	float detail_sample_distance = 6.0f;
 	float detail_sample_max_error = 1.0f;
+	int tile_size = 0;
 
 	SamplePartitionType partition_type = SAMPLE_PARTITION_WATERSHED;
 	ParsedGeometryType parsed_geometry_type = PARSED_GEOMETRY_MESH_INSTANCES;
@@ -179,6 +180,9 @@ public:
 	void set_detail_sample_max_error(float p_value);
 	float get_detail_sample_max_error() const;
 
+	void set_tile_size(int p_value);
+	int get_tile_size() const;
+
 	void set_filter_low_hanging_obstacles(bool p_value);
 	bool get_filter_low_hanging_obstacles() const;
 
@@ -70,6 +70,50 @@ static Array _sanitize_node_pinned_properties(Node *p_node) {
 	return pinned;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_valid) {
+		return &instantiation_plan;
+	}
+
+	instantiation_plan.nodes.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::NodePlan &node_plan = instantiation_plan.nodes[i];
+		node_plan.creation_func = nullptr;
+		node_plan.setters.clear();
+
+		if (n.type == TYPE_INSTANCED || n.instance >= 0 || (i == 0 && base_scene_idx >= 0) || n.type >= names.size()) {
+			continue; // The class of the node is only known once it's instantiated.
+		}
+
+		const StringName &type = names[n.type];
+		node_plan.creation_func = ClassDB::get_creation_func(type);
+		if (!node_plan.creation_func) {
+			continue;
+		}
+
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			int name = n.properties[j].name;
+			if ((name & FLAG_PATH_PROPERTY_IS_NODE) || name >= names.size() || names[name] == CoreStringNames::get_singleton()->_script) {
+				node_plan.setters[j] = nullptr;
+				continue;
+			}
+			node_plan.setters[j] = ClassDB::get_property_setget(type, names[name]);
+		}
+	}
+
+	instantiation_plan_valid = true;
+	return &instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan.nodes.clear();
+	instantiation_plan_valid = false;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// nodes where instancing failed (because something is missing)
 	List<Node *> stray_instances;
@@ -111,8 +155,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// Script and editor setters can't be bypassed, so only use the plan for plain runtime instances.
+	const InstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = _get_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const LocalVector<const ClassDB::PropertySetGet *> *setters = nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -181,9 +232,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			ClassDB::CreationFunc creation_func = plan ? plan->nodes[i].creation_func : nullptr;
+			Object *obj = creation_func ? creation_func() : ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
+			if (node && creation_func) {
+				setters = &plan->nodes[i].setters;
+			}
 
 			if (!node) {
 				if (obj) {
@@ -317,7 +372,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							const ClassDB::PropertySetGet *setget = setters ? (*setters)[j] : nullptr;
+							if (setget && !node->get_script_instance()) {
+								ClassDB::call_property_setter(node, setget, value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -984,6 +1044,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1142,6 +1203,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1595,6 +1658,7 @@ int SceneState::add_node_path(const NodePath &p_path) {
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -1612,6 +1676,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
+	_clear_instantiation_plan();
 
 	NodeData::Property prop;
 	prop.name = p_name;
@@ -1630,6 +1695,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
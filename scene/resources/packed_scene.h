@@ -32,6 +32,8 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +91,24 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Class constructors and property setters resolved for the nodes created by this scene, so that
+	// instantiating it many times doesn't look them up for every node and property.
+	struct InstantiationPlan {
+		struct NodePlan {
+			ClassDB::CreationFunc creation_func = nullptr;
+			LocalVector<const ClassDB::PropertySetGet *> setters;
+		};
+
+		LocalVector<NodePlan> nodes;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable bool instantiation_plan_valid = false;
+	mutable Mutex instantiation_plan_mutex;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
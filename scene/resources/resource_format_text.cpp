@@ -651,6 +651,11 @@ Error ResourceLoaderText::load() {
 			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
 		}
 
+		if (do_assign && cache_mode != ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceLoader::is_deduplicating_sub_resources()) {
+			// Share it if an identical one was already loaded from another file, the one just loaded is freed with the loader.
+			int_resources[id] = ResourceLoader::deduplicate_sub_resource(res);
+		}
+
 		if (progress && resources_total > 0) {
 			*progress = resource_current / float(resources_total);
 		}
@@ -882,6 +887,8 @@ void ResourceLoaderText::get_dependencies(Ref<FileAccess> p_f, List<String> *p_d
 }
 
 Error ResourceLoaderText::rename_dependencies(Ref<FileAccess> p_f, const String &p_path, const HashMap<String, String> &p_map) {
+	// The rest of the file is copied from the position where tag parsing stopped.
+	stream.set_readahead_enabled(false);
 	open(p_f, true);
 	ERR_FAIL_COND_V(error != OK, error);
 	ignore_resource_parsing = true;
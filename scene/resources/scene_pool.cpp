@@ -0,0 +1,183 @@
+/*************************************************************************/
+/*  scene_pool.cpp                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "scene_pool.h"
+
+void ScenePool::_capture_state(Node *p_root, Node *p_node) {
+	NodeState state;
+	state.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & (PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_SCRIPT_VARIABLE)) || E.name == "script") {
+			continue;
+		}
+
+		Variant value = p_node->get(E.name);
+		if (value.get_validated_object()) {
+			// Nodes and local to scene resources belong to this instance, they can't be restored in another one.
+			Ref<Resource> res = value;
+			if (res.is_null() || res->is_local_to_scene()) {
+				continue;
+			}
+		}
+		state.properties.push_back(Pair<StringName, Variant>(E.name, value.duplicate(true)));
+	}
+	initial_state.push_back(state);
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_capture_state(p_root, p_node->get_child(i));
+	}
+}
+
+bool ScenePool::_restore_state(Node *p_root) {
+	for (uint32_t i = 0; i < initial_state.size(); i++) {
+		const NodeState &state = initial_state[i];
+		Node *node = p_root->get_node_or_null(state.path);
+		if (!node) {
+			return false; // Part of the scene was removed, it's simpler to instantiate a new one.
+		}
+
+		for (uint32_t j = 0; j < state.properties.size(); j++) {
+			const Pair<StringName, Variant> &E = state.properties[j];
+			if (node->get(E.first) != E.second) {
+				node->set(E.first, E.second.duplicate(true));
+			}
+		}
+
+		// Run _ready() again the next time the node enters the tree, as it's back to its initial state.
+		node->request_ready();
+	}
+	return true;
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_idle_count(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	max_idle_count = p_count;
+	while (idle_nodes.size() > uint32_t(max_idle_count)) {
+		memdelete(idle_nodes[idle_nodes.size() - 1]);
+		idle_nodes.remove_at(idle_nodes.size() - 1);
+	}
+}
+
+int ScenePool::get_max_idle_count() const {
+	return max_idle_count;
+}
+
+Node *ScenePool::acquire() {
+	if (!idle_nodes.is_empty()) {
+		Node *node = idle_nodes[idle_nodes.size() - 1];
+		idle_nodes.remove_at(idle_nodes.size() - 1);
+		return node;
+	}
+
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene to instantiate was set.");
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	if (initial_state.is_empty()) {
+		_capture_state(node, node);
+	}
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(initial_state.is_empty(), "Node was not acquired from this pool.");
+	ERR_FAIL_COND_MSG(p_node->get_scene_file_path() != scene->get_path(), "Node is not an instance of the pooled scene.");
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	if (idle_nodes.size() >= uint32_t(max_idle_count) || !_restore_state(p_node)) {
+		p_node->queue_delete();
+		return;
+	}
+	idle_nodes.push_back(p_node);
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	while (idle_nodes.size() < uint32_t(MIN(p_count, max_idle_count))) {
+		ERR_FAIL_COND_MSG(scene.is_null(), "No scene to instantiate was set.");
+		Node *node = scene->instantiate();
+		ERR_FAIL_NULL(node);
+		if (initial_state.is_empty()) {
+			_capture_state(node, node);
+		}
+		idle_nodes.push_back(node);
+	}
+}
+
+int ScenePool::get_idle_count() const {
+	return idle_nodes.size();
+}
+
+void ScenePool::clear() {
+	for (uint32_t i = 0; i < idle_nodes.size(); i++) {
+		memdelete(idle_nodes[i]);
+	}
+	idle_nodes.clear();
+	initial_state.clear();
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_idle_count", "count"), &ScenePool::set_max_idle_count);
+	ClassDB::bind_method(D_METHOD("get_max_idle_count"), &ScenePool::get_max_idle_count);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("get_idle_count"), &ScenePool::get_idle_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_idle_count", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_max_idle_count", "get_max_idle_count");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
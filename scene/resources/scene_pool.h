@@ -0,0 +1,75 @@
+/*************************************************************************/
+/*  scene_pool.h                                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef SCENE_POOL_H
+#define SCENE_POOL_H
+
+#include "core/templates/local_vector.h"
+#include "scene/resources/packed_scene.h"
+
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	struct NodeState {
+		NodePath path;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int max_idle_count = 32;
+
+	LocalVector<Node *> idle_nodes;
+	// Property values of a freshly instantiated scene, restored when a node is released.
+	LocalVector<NodeState> initial_state;
+
+	void _capture_state(Node *p_root, Node *p_node);
+	bool _restore_state(Node *p_root);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_idle_count(int p_count);
+	int get_max_idle_count() const;
+
+	Node *acquire();
+	void release(Node *p_node);
+	void prewarm(int p_count);
+	int get_idle_count() const;
+	void clear();
+
+	ScenePool() {}
+	~ScenePool();
+};
+
+#endif // SCENE_POOL_H
@@ -47,24 +47,40 @@ bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_val
 			add_property(path);
 			return true;
 		}
-		ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 		ERR_FAIL_INDEX_V(idx, properties.size(), false);
 		ReplicationProperty &prop = properties[idx];
 		if (what == "sync") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 			prop.sync = p_value;
-			if (prop.sync) {
-				sync_props.push_back(prop.name);
-			} else {
-				sync_props.erase(prop.name);
-			}
+			_update_props();
 			return true;
 		} else if (what == "spawn") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 			prop.spawn = p_value;
-			if (prop.spawn) {
-				spawn_props.push_back(prop.name);
-			} else {
-				spawn_props.erase(prop.name);
-			}
+			_update_props();
+			return true;
+		} else if (what == "encoding") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
+			ReplicationEncoding encoding = (ReplicationEncoding)(int)p_value;
+			ERR_FAIL_INDEX_V(encoding, ENCODING_QUATERNION_SMALLEST_THREE + 1, false);
+			ERR_FAIL_COND_V_MSG(encoding == ENCODING_QUANTIZED && prop.encoding.range_min >= prop.encoding.range_max, false, "Quantization range must not be empty.");
+			prop.encoding.type = encoding;
+			_update_props();
+			return true;
+		} else if (what == "encoding_range") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::VECTOR2, false);
+			Vector2 range = p_value;
+			ERR_FAIL_COND_V_MSG(prop.encoding.type == ENCODING_QUANTIZED && range.x >= range.y, false, "Quantization range must not be empty.");
+			prop.encoding.range_min = range.x;
+			prop.encoding.range_max = range.y;
+			_update_props();
+			return true;
+		} else if (what == "encoding_bits") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
+			int bits = p_value;
+			ERR_FAIL_COND_V_MSG(bits < 1 || bits > 32, false, "Encoding bits must be between 1 and 32.");
+			prop.encoding.bits = bits;
+			_update_props();
 			return true;
 		}
 	}
@@ -88,6 +104,15 @@ bool SceneReplicationConfig::_get(const StringName &p_name, Variant &r_ret) cons
 		} else if (what == "spawn") {
 			r_ret = prop.spawn;
 			return true;
+		} else if (what == "encoding") {
+			r_ret = prop.encoding.type;
+			return true;
+		} else if (what == "encoding_range") {
+			r_ret = Vector2(prop.encoding.range_min, prop.encoding.range_max);
+			return true;
+		} else if (what == "encoding_bits") {
+			r_ret = prop.encoding.bits;
+			return true;
 		}
 	}
 	return false;
@@ -98,6 +123,12 @@ void SceneReplicationConfig::_get_property_list(List<PropertyInfo> *p_list) cons
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/spawn", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/sync", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		// Only stored when used, so existing configs stay unchanged.
+		if (properties[i].encoding.type != ENCODING_VARIANT) {
+			p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/encoding", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+			p_list->push_back(PropertyInfo(Variant::VECTOR2, "properties/" + itos(i) + "/encoding_range", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+			p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/encoding_bits", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		}
 	}
 }
 
@@ -114,6 +145,7 @@ void SceneReplicationConfig::add_property(const NodePath &p_path, int p_index) {
 
 	if (p_index < 0 || p_index == properties.size()) {
 		properties.push_back(ReplicationProperty(p_path));
+		_update_props();
 		return;
 	}
 
@@ -126,10 +158,12 @@ void SceneReplicationConfig::add_property(const NodePath &p_path, int p_index) {
 		c++;
 	}
 	properties.insert_before(I, ReplicationProperty(p_path));
+	_update_props();
 }
 
 void SceneReplicationConfig::remove_property(const NodePath &p_path) {
 	properties.erase(p_path);
+	_update_props();
 }
 
 bool SceneReplicationConfig::has_property(const NodePath &p_path) const {
@@ -163,12 +197,7 @@ void SceneReplicationConfig::property_set_spawn(const NodePath &p_path, bool p_e
 		return;
 	}
 	E->get().spawn = p_enabled;
-	spawn_props.clear();
-	for (const ReplicationProperty &prop : properties) {
-		if (prop.spawn) {
-			spawn_props.push_back(p_path);
-		}
-	}
+	_update_props();
 }
 
 bool SceneReplicationConfig::property_get_sync(const NodePath &p_path) {
@@ -184,10 +213,51 @@ void SceneReplicationConfig::property_set_sync(const NodePath &p_path, bool p_en
 		return;
 	}
 	E->get().sync = p_enabled;
+	_update_props();
+}
+
+SceneReplicationConfig::ReplicationEncoding SceneReplicationConfig::property_get_encoding(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, ENCODING_VARIANT);
+	return E->get().encoding.type;
+}
+
+Vector2 SceneReplicationConfig::property_get_encoding_range(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, Vector2());
+	return Vector2(E->get().encoding.range_min, E->get().encoding.range_max);
+}
+
+int SceneReplicationConfig::property_get_encoding_bits(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0);
+	return E->get().encoding.bits;
+}
+
+void SceneReplicationConfig::property_set_encoding(const NodePath &p_path, ReplicationEncoding p_encoding, const Vector2 &p_range, int p_bits) {
+	ERR_FAIL_INDEX(p_encoding, ENCODING_QUATERNION_SMALLEST_THREE + 1);
+	ERR_FAIL_COND_MSG(p_bits < 1 || p_bits > 32, "Encoding bits must be between 1 and 32.");
+	ERR_FAIL_COND_MSG(p_encoding == ENCODING_QUANTIZED && p_range.x >= p_range.y, "Quantization range must not be empty.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	E->get().encoding.type = p_encoding;
+	E->get().encoding.range_min = p_range.x;
+	E->get().encoding.range_max = p_range.y;
+	E->get().encoding.bits = p_bits;
+	_update_props();
+}
+
+void SceneReplicationConfig::_update_props() {
+	spawn_props.clear();
 	sync_props.clear();
+	sync_encodings.clear();
 	for (const ReplicationProperty &prop : properties) {
+		if (prop.spawn) {
+			spawn_props.push_back(prop.name);
+		}
 		if (prop.sync) {
-			sync_props.push_back(p_path);
+			sync_props.push_back(prop.name);
+			sync_encodings.push_back(prop.encoding);
 		}
 	}
 }
@@ -202,4 +272,13 @@ void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("property_set_spawn", "path", "enabled"), &SceneReplicationConfig::property_set_spawn);
 	ClassDB::bind_method(D_METHOD("property_get_sync", "path"), &SceneReplicationConfig::property_get_sync);
 	ClassDB::bind_method(D_METHOD("property_set_sync", "path", "enabled"), &SceneReplicationConfig::property_set_sync);
+	ClassDB::bind_method(D_METHOD("property_get_encoding", "path"), &SceneReplicationConfig::property_get_encoding);
+	ClassDB::bind_method(D_METHOD("property_get_encoding_range", "path"), &SceneReplicationConfig::property_get_encoding_range);
+	ClassDB::bind_method(D_METHOD("property_get_encoding_bits", "path"), &SceneReplicationConfig::property_get_encoding_bits);
+	ClassDB::bind_method(D_METHOD("property_set_encoding", "path", "encoding", "range", "bits"), &SceneReplicationConfig::property_set_encoding, DEFVAL(Vector2(0, 1)), DEFVAL(16));
+
+	BIND_ENUM_CONSTANT(ENCODING_VARIANT);
+	BIND_ENUM_CONSTANT(ENCODING_QUANTIZED);
+	BIND_ENUM_CONSTANT(ENCODING_HALF);
+	BIND_ENUM_CONSTANT(ENCODING_QUATERNION_SMALLEST_THREE);
 }
@@ -33,6 +33,7 @@
 
 #include "core/io/resource.h"
 
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 
 class SceneReplicationConfig : public Resource {
@@ -40,11 +41,27 @@ class SceneReplicationConfig : public Resource {
 	OBJ_SAVE_TYPE(SceneReplicationConfig);
 	RES_BASE_EXTENSION("repl");
 
+public:
+	enum ReplicationEncoding {
+		ENCODING_VARIANT,
+		ENCODING_QUANTIZED,
+		ENCODING_HALF,
+		ENCODING_QUATERNION_SMALLEST_THREE,
+	};
+
+	struct Encoding {
+		ReplicationEncoding type = ENCODING_VARIANT;
+		real_t range_min = 0.0;
+		real_t range_max = 1.0;
+		int bits = 16;
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		bool sync = true;
+		Encoding encoding;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -60,6 +77,9 @@ private:
 	List<ReplicationProperty> properties;
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
+	LocalVector<Encoding> sync_encodings;
+
+	void _update_props();
 
 protected:
 	static void _bind_methods();
@@ -82,10 +102,19 @@ public:
 	bool property_get_sync(const NodePath &p_path);
 	void property_set_sync(const NodePath &p_path, bool p_enabled);
 
+	ReplicationEncoding property_get_encoding(const NodePath &p_path);
+	Vector2 property_get_encoding_range(const NodePath &p_path);
+	int property_get_encoding_bits(const NodePath &p_path);
+	void property_set_encoding(const NodePath &p_path, ReplicationEncoding p_encoding, const Vector2 &p_range = Vector2(0, 1), int p_bits = 16);
+
 	const List<NodePath> &get_spawn_properties() { return spawn_props; }
 	const List<NodePath> &get_sync_properties() { return sync_props; }
+	// Matches the order of get_sync_properties().
+	const LocalVector<Encoding> &get_sync_encodings() { return sync_encodings; }
 
 	SceneReplicationConfig() {}
 };
 
+VARIANT_ENUM_CAST(SceneReplicationConfig::ReplicationEncoding);
+
 #endif // SCENE_REPLICATION_CONFIG_H
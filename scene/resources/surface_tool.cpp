@@ -40,6 +40,12 @@ SurfaceTool::SimplifySloppyFunc SurfaceTool::simplify_sloppy_func = nullptr;
 SurfaceTool::GenerateRemapFunc SurfaceTool::generate_remap_func = nullptr;
 SurfaceTool::RemapVertexFunc SurfaceTool::remap_vertex_func = nullptr;
 SurfaceTool::RemapIndexFunc SurfaceTool::remap_index_func = nullptr;
+SurfaceTool::BuildMeshletsBoundFunc SurfaceTool::build_meshlets_bound_func = nullptr;
+SurfaceTool::BuildMeshletsFunc SurfaceTool::build_meshlets_func = nullptr;
+SurfaceTool::ComputeClusterBoundsFunc SurfaceTool::compute_cluster_bounds_func = nullptr;
+SurfaceTool::OptimizeOverdrawFunc SurfaceTool::optimize_overdraw_func = nullptr;
+SurfaceTool::OptimizeVertexFetchRemapFunc SurfaceTool::optimize_vertex_fetch_remap_func = nullptr;
+SurfaceTool::AnalyzeVertexCacheFunc SurfaceTool::analyze_vertex_cache_func = nullptr;
 
 void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices) {
 	ERR_FAIL_COND_MSG(!generate_remap_func || !remap_vertex_func || !remap_index_func, "Meshoptimizer library is not initialized.");
@@ -90,6 +90,21 @@ public:
 	static RemapVertexFunc remap_vertex_func;
 	typedef void (*RemapIndexFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const unsigned int *remap);
 	static RemapIndexFunc remap_index_func;
+	typedef size_t (*BuildMeshletsBoundFunc)(size_t index_count, size_t max_vertices, size_t max_triangles);
+	static BuildMeshletsBoundFunc build_meshlets_bound_func;
+	// Writes the indices of all meshlets one after another to r_indices, and the number of indices of each meshlet to r_meshlet_index_counts.
+	typedef size_t (*BuildMeshletsFunc)(unsigned int *r_meshlet_index_counts, unsigned int *r_indices, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride, size_t max_vertices, size_t max_triangles, float cone_weight);
+	static BuildMeshletsFunc build_meshlets_func;
+	// Writes the bounding sphere center and radius, then the normal cone axis and cutoff to r_bounds (8 floats).
+	typedef void (*ComputeClusterBoundsFunc)(float *r_bounds, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride);
+	static ComputeClusterBoundsFunc compute_cluster_bounds_func;
+	typedef void (*OptimizeOverdrawFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride, float threshold);
+	static OptimizeOverdrawFunc optimize_overdraw_func;
+	typedef size_t (*OptimizeVertexFetchRemapFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, size_t vertex_count);
+	static OptimizeVertexFetchRemapFunc optimize_vertex_fetch_remap_func;
+	// Returns the average cache miss ratio (transformed vertices per triangle) of a FIFO cache of cache_size vertices.
+	typedef float (*AnalyzeVertexCacheFunc)(const unsigned int *indices, size_t index_count, size_t vertex_count, unsigned int cache_size);
+	static AnalyzeVertexCacheFunc analyze_vertex_cache_func;
 	static void strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices);
 
 private:
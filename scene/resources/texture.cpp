@@ -30,10 +30,12 @@
 
 #include "texture.h"
 
+#include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/io/image_loader.h"
 #include "core/io/marshalls.h"
 #include "core/math/geometry_2d.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "mesh.h"
 #include "scene/resources/bit_map.h"
@@ -644,7 +646,7 @@ PortableCompressedTexture2D::~PortableCompressedTexture2D() {
 
 //////////////////////////////////////////
 
-Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_size_limit) {
+Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_size_limit, bool *r_size_limited) {
 	uint32_t data_format = f->get_32();
 	uint32_t w = f->get_16();
 	uint32_t h = f->get_16();
@@ -666,8 +668,11 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
+				if (r_size_limited) {
+					*r_size_limited = true;
+				}
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
 				f->seek(f->get_position() + size);
@@ -739,24 +744,29 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->create(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->create(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_start = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
+				if (r_size_limited) {
+					*r_size_limited = true;
 				}
 				continue; //oops, size limit enforced, go to next
 			}
 
+			if (ofs) {
+				f->seek(data_start + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -814,7 +824,7 @@ Image::Format CompressedTexture2D::get_format() const {
 	return format;
 }
 
-Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
+Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit, bool *r_size_limited) {
 	alpha_cache.unref();
 
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
@@ -857,11 +867,21 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	r_request_normal = false;
 
 #endif
+	if (ResourceLoader::is_stripping_payloads()) {
+		// Only the header the image starts with is read (data format, size, mipmap count and format), see load_image_from_file().
+		f->get_32();
+		f->get_32();
+		f->get_32();
+		format = Image::Format(f->get_32());
+		image.unref();
+		return OK;
+	}
+
 	if (!(df & FORMAT_BIT_STREAM)) {
 		p_size_limit = 0;
 	}
 
-	image = load_image_from_file(f, p_size_limit);
+	image = load_image_from_file(f, p_size_limit, r_size_limited);
 
 	if (image.is_null() || image->is_empty()) {
 		return ERR_CANT_OPEN;
@@ -870,6 +890,119 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	return OK;
 }
 
+void CompressedTexture2D::_requested_stream(void *p_ud) {
+	// May be called from the rendering thread after the texture was freed, so
+	// look up its ObjectID by request ID instead of dereferencing anything.
+	MutexLock lock(stream_mutex);
+	const ObjectID *id = stream_requests.getptr((uint32_t)(uintptr_t)p_ud);
+	if (id) {
+		MessageQueue::get_singleton()->push_callable(callable_mp_static(&CompressedTexture2D::_stream_enqueue), *id);
+	}
+}
+
+void CompressedTexture2D::_stream_enqueue(ObjectID p_texture) {
+	stream_queue.push_back(p_texture);
+	_stream_process_queue();
+}
+
+void CompressedTexture2D::_stream_process_queue() {
+	while (!stream_queue.is_empty()) {
+		CompressedTexture2D *ct = Object::cast_to<CompressedTexture2D>(ObjectDB::get_instance(stream_queue.front()->get()));
+		if (ct && ct->stream_pending && ct->stream_task == WorkerThreadPool::INVALID_TASK_ID && !ct->_stream_begin()) {
+			break; // Over budget, try again once some memory is released.
+		}
+		stream_queue.pop_front();
+	}
+}
+
+bool CompressedTexture2D::_stream_begin() {
+	MutexLock lock(stream_mutex);
+
+	if (stream_paused) {
+		return false;
+	}
+
+	uint64_t budget = uint64_t(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024;
+	uint64_t memory = Image::get_image_data_size(w, h, format, true);
+	if (budget > 0 && stream_memory_used > 0 && stream_memory_used + memory > budget) {
+		return false;
+	}
+
+	stream_memory = memory;
+	stream_memory_used += memory;
+	stream_task = WorkerThreadPool::get_singleton()->add_template_task(this, &CompressedTexture2D::_stream_load, (void *)nullptr, false, SNAME("StreamTexture"));
+	return true;
+}
+
+void CompressedTexture2D::_stream_load(void *p_userdata) {
+	Ref<FileAccess> f = FileAccess::open(path_to_file, FileAccess::READ);
+	if (f.is_valid()) {
+		// Skip the header (magic, version, size, flags, mipmap limit and reserved fields), load() already validated it.
+		f->seek(4 + 8 * 4);
+		stream_image = load_image_from_file(f, 0);
+	}
+
+	MessageQueue::get_singleton()->push_callable(callable_mp_static(&CompressedTexture2D::_stream_finished), get_instance_id());
+}
+
+void CompressedTexture2D::_stream_finished(ObjectID p_texture) {
+	CompressedTexture2D *ct = Object::cast_to<CompressedTexture2D>(ObjectDB::get_instance(p_texture));
+	if (!ct || ct->stream_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return; // Freed or reloaded in the meantime.
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(ct->stream_task);
+	ct->stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	ct->stream_pending = false;
+
+	Ref<Image> image = ct->stream_image;
+	ct->stream_image.unref();
+	if (image.is_null() || image->is_empty()) {
+		ct->_stream_cancel();
+		ERR_FAIL_MSG(vformat("Unable to stream texture: %s.", ct->path_to_file));
+	}
+
+	RID new_texture = RS::get_singleton()->texture_2d_create(image);
+	RS::get_singleton()->texture_replace(ct->texture, new_texture);
+	RS::get_singleton()->texture_set_size_override(ct->texture, ct->w, ct->h);
+	RS::get_singleton()->texture_set_path(ct->texture, ct->get_path().is_empty() ? ct->path_to_file : ct->get_path());
+	ct->alpha_cache.unref();
+}
+
+void CompressedTexture2D::_stream_cancel() {
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+		stream_task = WorkerThreadPool::INVALID_TASK_ID;
+		stream_image.unref();
+	}
+	stream_pending = false;
+
+	if (stream_memory > 0) {
+		MutexLock lock(stream_mutex);
+		stream_memory_used -= stream_memory;
+		stream_memory = 0;
+		// The queue is only handled on the main thread, as it's filled from the message queue.
+		if (MessageQueue::get_singleton()) {
+			MessageQueue::get_singleton()->push_callable(callable_mp_static(&CompressedTexture2D::_stream_process_queue));
+		}
+	}
+}
+
+void CompressedTexture2D::set_streaming_paused(bool p_paused) {
+	// Textures keep their reduced size while paused, the queue resumes where it left off.
+	stream_paused = p_paused;
+	if (!p_paused) {
+		_stream_process_queue();
+	}
+}
+
+List<ObjectID> CompressedTexture2D::stream_queue;
+HashMap<uint32_t, ObjectID> CompressedTexture2D::stream_requests;
+uint32_t CompressedTexture2D::stream_request_last_id = 0;
+uint64_t CompressedTexture2D::stream_memory_used = 0;
+Mutex CompressedTexture2D::stream_mutex;
+bool CompressedTexture2D::stream_paused = false;
+
 Error CompressedTexture2D::load(const String &p_path) {
 	int lw, lh;
 	Ref<Image> image;
@@ -880,11 +1013,31 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	_stream_cancel();
+	int stream_size_limit = GLOBAL_GET("rendering/textures/streaming/initial_size");
+	bool size_limited = false;
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, stream_size_limit, &size_limited);
 	if (err) {
 		return err;
 	}
 
+	if (image.is_null()) {
+		// Payload stripped, keep an empty texture that reports the right size and format.
+		RID placeholder = RS::get_singleton()->texture_2d_placeholder_create();
+		if (texture.is_valid()) {
+			RS::get_singleton()->texture_replace(texture, placeholder);
+		} else {
+			texture = placeholder;
+		}
+		w = lw;
+		h = lh;
+		path_to_file = p_path;
+		notify_property_list_changed();
+		emit_changed();
+		return OK;
+	}
+
 	if (texture.is_valid()) {
 		RID new_texture = RS::get_singleton()->texture_2d_create(image);
 		RS::get_singleton()->texture_replace(texture, new_texture);
@@ -905,6 +1058,19 @@ Error CompressedTexture2D::load(const String &p_path) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
 	}
 
+	// Only the smaller mipmaps were loaded, stream in the rest once the texture is drawn.
+	stream_pending = size_limited;
+	if (stream_pending) {
+		if (stream_request_id == 0) {
+			MutexLock lock(stream_mutex);
+			stream_request_id = ++stream_request_last_id;
+			stream_requests.insert(stream_request_id, get_instance_id());
+		}
+		RS::get_singleton()->texture_set_stream_request_callback(texture, _requested_stream, (void *)(uintptr_t)stream_request_id);
+	} else {
+		RS::get_singleton()->texture_set_stream_request_callback(texture, nullptr, nullptr);
+	}
+
 #ifdef TOOLS_ENABLED
 
 	if (request_3d) {
@@ -1051,6 +1217,11 @@ void CompressedTexture2D::_bind_methods() {
 CompressedTexture2D::CompressedTexture2D() {}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	_stream_cancel();
+	if (stream_request_id != 0) {
+		MutexLock lock(stream_mutex);
+		stream_requests.erase(stream_request_id);
+	}
 	if (texture.is_valid()) {
 		RS::get_singleton()->free(texture);
 	}
@@ -35,6 +35,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/math/rect2.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/os/rw_lock.h"
 #include "core/os/thread_safe.h"
@@ -235,7 +236,7 @@ public:
 	};
 
 private:
-	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0, bool *r_size_limited = nullptr);
 	String path_to_file;
 	mutable RID texture;
 	Image::Format format = Image::FORMAT_MAX;
@@ -243,18 +244,41 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Streaming, only used when the file was imported as streamable and loaded at a reduced size.
+	bool stream_pending = false;
+	uint64_t stream_memory = 0;
+	WorkerThreadPool::TaskID stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	Ref<Image> stream_image;
+	uint32_t stream_request_id = 0;
+
+	static List<ObjectID> stream_queue;
+	static HashMap<uint32_t, ObjectID> stream_requests;
+	static uint32_t stream_request_last_id;
+	static uint64_t stream_memory_used;
+	static Mutex stream_mutex;
+	static bool stream_paused;
+
 	virtual void reload_from_file() override;
 
 	static void _requested_3d(void *p_ud);
 	static void _requested_roughness(void *p_ud, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
 	static void _requested_normal(void *p_ud);
+	static void _requested_stream(void *p_ud);
+
+	static void _stream_enqueue(ObjectID p_texture);
+	static void _stream_finished(ObjectID p_texture);
+	static void _stream_process_queue();
+	bool _stream_begin();
+	void _stream_load(void *p_userdata);
+	void _stream_cancel();
 
 protected:
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &property) const override;
 
 public:
-	static Ref<Image> load_image_from_file(Ref<FileAccess> p_file, int p_size_limit);
+	static Ref<Image> load_image_from_file(Ref<FileAccess> p_file, int p_size_limit, bool *r_size_limited = nullptr);
+	static void set_streaming_paused(bool p_paused);
 
 	typedef void (*TextureFormatRequestCallback)(const Ref<CompressedTexture2D> &);
 	typedef void (*TextureFormatRoughnessRequestCallback)(const Ref<CompressedTexture2D> &, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
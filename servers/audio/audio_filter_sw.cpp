@@ -30,6 +30,14 @@
 
 #include "audio_filter_sw.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_FILTER_SW_USE_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AUDIO_FILTER_SW_USE_NEON
+#include <arm_neon.h>
+#endif
+
 void AudioFilterSW::set_mode(Mode p_mode) {
 	mode = p_mode;
 }
@@ -241,6 +249,125 @@ void AudioFilterSW::Processor::update_coeffs(int p_interp_buffer_len) {
 	}
 }
 
+void AudioFilterSW::Processor::process_stereo_interp(Processor &p_left, Processor &p_right, float *p_samples, int p_frames) {
+#if defined(AUDIO_FILTER_SW_USE_SSE)
+	// Both channels go through the same steps, so they are filtered side by side in the two low lanes.
+	__m128 b0 = _mm_setr_ps(p_left.coeffs.b0, p_right.coeffs.b0, 0, 0);
+	__m128 b1 = _mm_setr_ps(p_left.coeffs.b1, p_right.coeffs.b1, 0, 0);
+	__m128 b2 = _mm_setr_ps(p_left.coeffs.b2, p_right.coeffs.b2, 0, 0);
+	__m128 a1 = _mm_setr_ps(p_left.coeffs.a1, p_right.coeffs.a1, 0, 0);
+	__m128 a2 = _mm_setr_ps(p_left.coeffs.a2, p_right.coeffs.a2, 0, 0);
+	const __m128 incr_b0 = _mm_setr_ps(p_left.incr_coeffs.b0, p_right.incr_coeffs.b0, 0, 0);
+	const __m128 incr_b1 = _mm_setr_ps(p_left.incr_coeffs.b1, p_right.incr_coeffs.b1, 0, 0);
+	const __m128 incr_b2 = _mm_setr_ps(p_left.incr_coeffs.b2, p_right.incr_coeffs.b2, 0, 0);
+	const __m128 incr_a1 = _mm_setr_ps(p_left.incr_coeffs.a1, p_right.incr_coeffs.a1, 0, 0);
+	const __m128 incr_a2 = _mm_setr_ps(p_left.incr_coeffs.a2, p_right.incr_coeffs.a2, 0, 0);
+	__m128 ha1 = _mm_setr_ps(p_left.ha1, p_right.ha1, 0, 0);
+	__m128 ha2 = _mm_setr_ps(p_left.ha2, p_right.ha2, 0, 0);
+	__m128 hb1 = _mm_setr_ps(p_left.hb1, p_right.hb1, 0, 0);
+	__m128 hb2 = _mm_setr_ps(p_left.hb2, p_right.hb2, 0, 0);
+
+	for (int i = 0; i < p_frames; i++) {
+		float *frame = &p_samples[i * 2];
+		const __m128 pre = _mm_castpd_ps(_mm_load_sd((const double *)frame));
+		__m128 sample = _mm_mul_ps(pre, b0);
+		sample = _mm_add_ps(sample, _mm_mul_ps(hb1, b1));
+		sample = _mm_add_ps(sample, _mm_mul_ps(hb2, b2));
+		sample = _mm_add_ps(sample, _mm_mul_ps(ha1, a1));
+		sample = _mm_add_ps(sample, _mm_mul_ps(ha2, a2));
+		_mm_store_sd((double *)frame, _mm_castps_pd(sample));
+
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = pre;
+		ha1 = sample;
+
+		b0 = _mm_add_ps(b0, incr_b0);
+		b1 = _mm_add_ps(b1, incr_b1);
+		b2 = _mm_add_ps(b2, incr_b2);
+		a1 = _mm_add_ps(a1, incr_a1);
+		a2 = _mm_add_ps(a2, incr_a2);
+	}
+
+	float values[4];
+#define STORE_LANES(m_vector, m_member) \
+	_mm_storeu_ps(values, m_vector);    \
+	p_left.m_member = values[0];        \
+	p_right.m_member = values[1];
+	STORE_LANES(b0, coeffs.b0);
+	STORE_LANES(b1, coeffs.b1);
+	STORE_LANES(b2, coeffs.b2);
+	STORE_LANES(a1, coeffs.a1);
+	STORE_LANES(a2, coeffs.a2);
+	STORE_LANES(ha1, ha1);
+	STORE_LANES(ha2, ha2);
+	STORE_LANES(hb1, hb1);
+	STORE_LANES(hb2, hb2);
+#undef STORE_LANES
+
+#elif defined(AUDIO_FILTER_SW_USE_NEON)
+	// Both channels go through the same steps, so they are filtered side by side.
+#define LOAD_LANES(m_member) vset_lane_f32(p_right.m_member, vdup_n_f32(p_left.m_member), 1)
+	float32x2_t b0 = LOAD_LANES(coeffs.b0);
+	float32x2_t b1 = LOAD_LANES(coeffs.b1);
+	float32x2_t b2 = LOAD_LANES(coeffs.b2);
+	float32x2_t a1 = LOAD_LANES(coeffs.a1);
+	float32x2_t a2 = LOAD_LANES(coeffs.a2);
+	const float32x2_t incr_b0 = LOAD_LANES(incr_coeffs.b0);
+	const float32x2_t incr_b1 = LOAD_LANES(incr_coeffs.b1);
+	const float32x2_t incr_b2 = LOAD_LANES(incr_coeffs.b2);
+	const float32x2_t incr_a1 = LOAD_LANES(incr_coeffs.a1);
+	const float32x2_t incr_a2 = LOAD_LANES(incr_coeffs.a2);
+	float32x2_t ha1 = LOAD_LANES(ha1);
+	float32x2_t ha2 = LOAD_LANES(ha2);
+	float32x2_t hb1 = LOAD_LANES(hb1);
+	float32x2_t hb2 = LOAD_LANES(hb2);
+#undef LOAD_LANES
+
+	for (int i = 0; i < p_frames; i++) {
+		float *frame = &p_samples[i * 2];
+		const float32x2_t pre = vld1_f32(frame);
+		float32x2_t sample = vmul_f32(pre, b0);
+		sample = vadd_f32(sample, vmul_f32(hb1, b1));
+		sample = vadd_f32(sample, vmul_f32(hb2, b2));
+		sample = vadd_f32(sample, vmul_f32(ha1, a1));
+		sample = vadd_f32(sample, vmul_f32(ha2, a2));
+		vst1_f32(frame, sample);
+
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = pre;
+		ha1 = sample;
+
+		b0 = vadd_f32(b0, incr_b0);
+		b1 = vadd_f32(b1, incr_b1);
+		b2 = vadd_f32(b2, incr_b2);
+		a1 = vadd_f32(a1, incr_a1);
+		a2 = vadd_f32(a2, incr_a2);
+	}
+
+#define STORE_LANES(m_vector, m_member)             \
+	p_left.m_member = vget_lane_f32(m_vector, 0); \
+	p_right.m_member = vget_lane_f32(m_vector, 1);
+	STORE_LANES(b0, coeffs.b0);
+	STORE_LANES(b1, coeffs.b1);
+	STORE_LANES(b2, coeffs.b2);
+	STORE_LANES(a1, coeffs.a1);
+	STORE_LANES(a2, coeffs.a2);
+	STORE_LANES(ha1, ha1);
+	STORE_LANES(ha2, ha2);
+	STORE_LANES(hb1, hb1);
+	STORE_LANES(hb2, hb2);
+#undef STORE_LANES
+
+#else
+	for (int i = 0; i < p_frames; i++) {
+		p_left.process_one_interp(p_samples[i * 2]);
+		p_right.process_one_interp(p_samples[i * 2 + 1]);
+	}
+#endif
+}
+
 void AudioFilterSW::Processor::process(float *p_samples, int p_amount, int p_stride, bool p_interpolate) {
 	if (!filter) {
 		return;
@@ -70,6 +70,8 @@ public:
 		void update_coeffs(int p_interp_buffer_len = 0);
 		_ALWAYS_INLINE_ void process_one(float &p_sample);
 		_ALWAYS_INLINE_ void process_one_interp(float &p_sample);
+		// Processes interleaved stereo samples, with p_left filtering the left channel and p_right the right one.
+		static void process_stereo_interp(Processor &p_left, Processor &p_right, float *p_samples, int p_frames);
 
 		Processor();
 	};
@@ -48,6 +48,23 @@ template <int C>
 uint32_t AudioRBResampler::_resample(AudioFrame *p_dest, int p_todo, int32_t p_increment) {
 	uint32_t read = offset & MIX_FRAC_MASK;
 
+	if (p_increment == MIX_FRAC_LEN && read == 0) {
+		// Same rate on both sides, every output frame is an input frame.
+		for (int i = 0; i < p_todo; i++) {
+			offset = (offset + p_increment) & (((1 << (rb_bits + MIX_FRAC_BITS)) - 1));
+			uint32_t pos = offset >> MIX_FRAC_BITS;
+			ERR_FAIL_COND_V(pos >= rb_len, 0);
+
+			if (C == 1) {
+				p_dest[i] = AudioFrame(rb[pos], rb[pos]);
+			} else {
+				p_dest[i] = AudioFrame(rb[pos * C + 0], rb[pos * C + 1]);
+			}
+		}
+
+		return p_todo;
+	}
+
 	for (int i = 0; i < p_todo; i++) {
 		offset = (offset + p_increment) & (((1 << (rb_bits + MIX_FRAC_BITS)) - 1));
 		read += p_increment;
@@ -0,0 +1,148 @@
+/*************************************************************************/
+/*  audio_resampler_sinc.cpp                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "audio_resampler_sinc.h"
+
+#include "core/math/math_funcs.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define AUDIO_RESAMPLER_SINC_USE_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AUDIO_RESAMPLER_SINC_USE_NEON
+#include <arm_neon.h>
+#endif
+
+// PHASE_COUNT + 1 rows of coefficients, so the last phase can be interpolated towards the next frame.
+// Each coefficient is stored twice, once per channel, so they line up with the interleaved samples.
+template <int T>
+struct AudioResamplerSincTable {
+	float coeffs[(AudioResamplerSinc::PHASE_COUNT + 1) * T * 2];
+
+	AudioResamplerSincTable() {
+		// Cut off a bit below the Nyquist frequency, as the transition band gets wider with fewer taps.
+		const double cutoff = T >= 16 ? 0.95 : 0.9;
+		const int center = T / 2 - 1;
+
+		for (int phase = 0; phase <= AudioResamplerSinc::PHASE_COUNT; phase++) {
+			double fraction = double(phase) / AudioResamplerSinc::PHASE_COUNT;
+			double row[T];
+			double sum = 0.0;
+
+			for (int tap = 0; tap < T; tap++) {
+				double t = double(tap - center) - fraction;
+				double x = Math_PI * cutoff * t;
+				double sinc = Math::is_zero_approx(x) ? 1.0 : Math::sin(x) / x;
+				// Blackman window over the taps.
+				double u = t / (T / 2);
+				double window = ABS(u) >= 1.0 ? 0.0 : 0.42 + 0.5 * Math::cos(Math_PI * u) + 0.08 * Math::cos(2.0 * Math_PI * u);
+				row[tap] = sinc * window;
+				sum += row[tap];
+			}
+
+			// Normalize, so constant signals keep their level at every phase.
+			float *dst = &coeffs[phase * T * 2];
+			for (int tap = 0; tap < T; tap++) {
+				dst[tap * 2 + 0] = row[tap] / sum;
+				dst[tap * 2 + 1] = row[tap] / sum;
+			}
+		}
+	}
+};
+
+template <int T>
+static const float *get_table() {
+	static const AudioResamplerSincTable<T> table;
+	return table.coeffs;
+}
+
+template <int T>
+static AudioFrame interpolate_taps(const AudioFrame *p_frames, uint32_t p_fraction) {
+	const uint32_t phase_shift = AudioResamplerSinc::FRACTION_BITS - AudioResamplerSinc::PHASE_BITS;
+	const uint32_t phase = p_fraction >> phase_shift;
+	const float phase_fraction = float(p_fraction & ((1 << phase_shift) - 1)) / float(1 << phase_shift);
+
+	const float *row = get_table<T>() + phase * T * 2;
+	const float *next_row = row + T * 2;
+	const float *samples = &p_frames[0].l;
+
+#if defined(AUDIO_RESAMPLER_SINC_USE_SSE)
+	__m128 sum = _mm_setzero_ps();
+	if (phase_fraction == 0.0f) {
+		// Exactly on a phase, such as with integer rate ratios.
+		for (int i = 0; i < T * 2; i += 4) {
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(samples + i), _mm_loadu_ps(row + i)));
+		}
+	} else {
+		const __m128 weight = _mm_set1_ps(phase_fraction);
+		for (int i = 0; i < T * 2; i += 4) {
+			const __m128 c = _mm_loadu_ps(row + i);
+			const __m128 coeffs = _mm_add_ps(c, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(next_row + i), c), weight));
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(samples + i), coeffs));
+		}
+	}
+	// Lanes hold left, right, left, right.
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	float result[4];
+	_mm_storeu_ps(result, sum);
+	return AudioFrame(result[0], result[1]);
+#elif defined(AUDIO_RESAMPLER_SINC_USE_NEON)
+	float32x4_t sum = vdupq_n_f32(0.0f);
+	if (phase_fraction == 0.0f) {
+		for (int i = 0; i < T * 2; i += 4) {
+			sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(samples + i), vld1q_f32(row + i)));
+		}
+	} else {
+		const float32x4_t weight = vdupq_n_f32(phase_fraction);
+		for (int i = 0; i < T * 2; i += 4) {
+			const float32x4_t c = vld1q_f32(row + i);
+			const float32x4_t coeffs = vaddq_f32(c, vmulq_f32(vsubq_f32(vld1q_f32(next_row + i), c), weight));
+			sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(samples + i), coeffs));
+		}
+	}
+	const float32x2_t result = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+	return AudioFrame(vget_lane_f32(result, 0), vget_lane_f32(result, 1));
+#else
+	AudioFrame sum;
+	for (int i = 0; i < T; i++) {
+		const float c = row[i * 2] + (next_row[i * 2] - row[i * 2]) * phase_fraction;
+		sum += p_frames[i] * c;
+	}
+	return sum;
+#endif
+}
+
+AudioFrame AudioResamplerSinc::interpolate(const AudioFrame *p_frames, int p_taps, uint32_t p_fraction) {
+	if (p_taps >= 16) {
+		return interpolate_taps<16>(p_frames, p_fraction);
+	}
+	return interpolate_taps<8>(p_frames, p_fraction);
+}
@@ -0,0 +1,52 @@
+/*************************************************************************/
+/*  audio_resampler_sinc.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef AUDIO_RESAMPLER_SINC_H
+#define AUDIO_RESAMPLER_SINC_H
+
+#include "core/math/audio_frame.h"
+
+// Table driven polyphase windowed-sinc interpolation of stereo frames.
+class AudioResamplerSinc {
+public:
+	enum {
+		MAX_TAPS = 16,
+		FRACTION_BITS = 16, // Precision of the position between two frames.
+		PHASE_BITS = 8, // Phases in the table, the coefficients are interpolated linearly between them.
+		PHASE_COUNT = 1 << PHASE_BITS,
+	};
+
+	// Returns the frame at p_fraction (out of 1 << FRACTION_BITS) between p_frames[p_taps / 2 - 1] and p_frames[p_taps / 2].
+	// p_taps is 8 or 16, p_frames must contain p_taps frames.
+	static AudioFrame interpolate(const AudioFrame *p_frames, int p_taps, uint32_t p_fraction);
+};
+
+#endif // AUDIO_RESAMPLER_SINC_H
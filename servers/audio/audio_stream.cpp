@@ -74,6 +74,14 @@ void AudioStreamPlayback::seek(float p_time) {
 	}
 }
 
+bool AudioStreamPlayback::can_skip() const {
+	return false;
+}
+
+void AudioStreamPlayback::skip(float p_time) {
+	seek(get_playback_position() + p_time);
+}
+
 int AudioStreamPlayback::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
 	int ret;
 	if (GDVIRTUAL_REQUIRED_CALL(_mix, p_buffer, p_rate_scale, p_frames, ret)) {
@@ -100,16 +108,112 @@ void AudioStreamPlayback::_bind_methods() {
 //////////////////////////////
 
 void AudioStreamPlaybackResampled::begin_resample() {
-	//clear cubic interpolation history
-	internal_buffer[0] = AudioFrame(0.0, 0.0);
-	internal_buffer[1] = AudioFrame(0.0, 0.0);
-	internal_buffer[2] = AudioFrame(0.0, 0.0);
-	internal_buffer[3] = AudioFrame(0.0, 0.0);
+	//clear interpolation history
+	for (int i = 0; i < INTERP_HISTORY; i++) {
+		internal_buffer[i] = AudioFrame(0.0, 0.0);
+	}
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_read_internal(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
 }
 
+// Set while _mix_internal() is called to prefetch, as it may seek when looping.
+static thread_local AudioStreamPlaybackResampled *prefetching_playback = nullptr;
+
+void AudioStreamPlaybackResampled::set_prefetch_enabled(bool p_enabled) {
+	prefetch_reset();
+	prefetch_enabled = p_enabled;
+	prefetch_buffer.resize(p_enabled ? PREFETCH_BUFFER_LEN : 0);
+}
+
+void AudioStreamPlaybackResampled::prefetch_reset() {
+	if (prefetching_playback == this) {
+		return;
+	}
+
+	if (prefetch_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(prefetch_task);
+		prefetch_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	prefetch_read.set(0);
+	prefetch_write.set(0);
+	prefetch_ended.clear();
+}
+
+uint32_t AudioStreamPlaybackResampled::get_prefetched_frames() const {
+	if (!prefetch_enabled) {
+		return 0;
+	}
+	return prefetch_write.get() - prefetch_read.get();
+}
+
+void AudioStreamPlaybackResampled::_prefetch_fill(uint32_t p_frames) {
+	prefetching_playback = this;
+
+	uint32_t filled = 0;
+	while (filled < p_frames && !prefetch_ended.is_set()) {
+		uint32_t write = prefetch_write.get();
+		if (PREFETCH_BUFFER_LEN - (write - prefetch_read.get()) < INTERNAL_BUFFER_LEN) {
+			break; // Full.
+		}
+
+		// Chunks never wrap around the end of the buffer, as the write position stays a multiple of their size until the stream ends.
+		int mixed = _mix_internal(&prefetch_buffer[write % PREFETCH_BUFFER_LEN], INTERNAL_BUFFER_LEN);
+		prefetch_write.set(write + mixed);
+		filled += mixed;
+		if (mixed < INTERNAL_BUFFER_LEN) {
+			prefetch_ended.set();
+		}
+	}
+
+	prefetching_playback = nullptr;
+}
+
+void AudioStreamPlaybackResampled::_prefetch_task(void *p_userdata) {
+	_prefetch_fill(PREFETCH_BUFFER_LEN);
+}
+
+int AudioStreamPlaybackResampled::_read_internal(AudioFrame *p_buffer, int p_frames) {
+	if (!prefetch_enabled) {
+		return _mix_internal(p_buffer, p_frames);
+	}
+
+	WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+	if (prefetch_task != WorkerThreadPool::INVALID_TASK_ID && thread_pool->is_task_completed(prefetch_task)) {
+		thread_pool->wait_for_task_completion(prefetch_task);
+		prefetch_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	if (prefetch_task == WorkerThreadPool::INVALID_TASK_ID && get_prefetched_frames() < uint32_t(p_frames)) {
+		// Just started or seeked, or the decoding task fell behind.
+		_prefetch_fill(PREFETCH_DIRECT_FRAMES);
+	}
+
+	uint32_t read = prefetch_read.get();
+	int frames = MIN(get_prefetched_frames(), uint32_t(p_frames));
+	for (int i = 0; i < frames; i++) {
+		p_buffer[i] = prefetch_buffer[(read + i) % PREFETCH_BUFFER_LEN];
+	}
+	prefetch_read.set(read + frames);
+
+	int mixed = frames;
+	if (frames < p_frames) {
+		for (int i = frames; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+		if (!prefetch_ended.is_set()) {
+			// The decoding task is late, play silence rather than waiting for it.
+			mixed = p_frames;
+		}
+	}
+
+	if (prefetch_task == WorkerThreadPool::INVALID_TASK_ID && !prefetch_ended.is_set() && get_prefetched_frames() < PREFETCH_BUFFER_LEN / 2) {
+		prefetch_task = thread_pool->add_template_task(this, &AudioStreamPlaybackResampled::_prefetch_task, (void *)nullptr, true, SNAME("AudioStreamPrefetch"));
+	}
+
+	return mixed;
+}
+
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	int ret;
 	if (GDVIRTUAL_REQUIRED_CALL(_mix_resampled, p_buffer, p_frames, ret)) {
@@ -139,41 +243,52 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
 
 	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
+	// The interpolation uses this many frames around the output position, half of them before it.
+	const int taps = AudioServer::get_singleton()->get_resampling_taps();
+
+	static_assert(int(FP_BITS) == int(AudioResamplerSinc::FRACTION_BITS), "The resampling position must have the precision AudioResamplerSinc expects.");
 
 	int mixed_frames_total = -1;
 
 	int i;
 	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
+		uint32_t idx = INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
+		uint32_t fraction = mix_offset & FP_MASK;
 
 		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
 			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
 			mixed_frames_total = i;
 		}
 
-		float mu2 = mu * mu;
-		AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
-		AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = 2 * y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		if (fraction == 0) {
+			// Exactly on a frame, like every frame when the rates match or every other frame when doubling the rate.
+			p_buffer[i] = internal_buffer[idx - taps / 2];
+		} else if (taps == 4) {
+			//standard cubic interpolation (great quality/performance ratio)
+			float mu = fraction / float(FP_LEN);
+			AudioFrame y0 = internal_buffer[idx - 3];
+			AudioFrame y1 = internal_buffer[idx - 2];
+			AudioFrame y2 = internal_buffer[idx - 1];
+			AudioFrame y3 = internal_buffer[idx - 0];
+
+			float mu2 = mu * mu;
+			AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
+			AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
+			AudioFrame a2 = y2 - y0;
+			AudioFrame a3 = 2 * y1;
+
+			p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		} else {
+			p_buffer[i] = AudioResamplerSinc::interpolate(&internal_buffer[idx - taps + 1], taps, fraction);
+		}
 
 		mix_offset += mix_increment;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
-			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
-			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
-			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
-			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			for (int j = 0; j < INTERP_HISTORY; j++) {
+				internal_buffer[j] = internal_buffer[INTERNAL_BUFFER_LEN + j];
+			}
+			int mixed_frames = _read_internal(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
@@ -190,6 +305,11 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 	return mixed_frames_total;
 }
 
+AudioStreamPlaybackResampled::~AudioStreamPlaybackResampled() {
+	// Subclasses should have reset prefetching already, as the decoding task can't call their _mix_internal() anymore.
+	prefetch_reset();
+}
+
 ////////////////////////////////
 
 Ref<AudioStreamPlayback> AudioStream::instantiate_playback() {
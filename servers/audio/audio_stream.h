@@ -33,7 +33,11 @@
 
 #include "core/io/image.h"
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/audio/audio_filter_sw.h"
+#include "servers/audio/audio_resampler_sinc.h"
 #include "servers/audio_server.h"
 
 #include "core/object/gdvirtual.gen.inc"
@@ -65,6 +69,11 @@ public:
 	virtual float get_playback_position() const;
 	virtual void seek(float p_time);
 
+	// Moves the playback forward by p_time seconds of the stream without mixing it, stopping it if it ends.
+	// Used by the AudioServer to virtualize inaudible voices, only for playbacks which return true in can_skip().
+	virtual bool can_skip() const;
+	virtual void skip(float p_time);
+
 	virtual void tag_used_streams();
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames);
@@ -78,19 +87,42 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 		FP_LEN = (1 << FP_BITS),
 		FP_MASK = FP_LEN - 1,
 		INTERNAL_BUFFER_LEN = 128, // 128 warrants 3ms positional jitter at much at 44100hz
-		CUBIC_INTERP_HISTORY = 4
+		INTERP_HISTORY = AudioResamplerSinc::MAX_TAPS
 	};
 
-	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
+	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	enum {
+		PREFETCH_BUFFER_LEN = 8192, // Must be a power of two, and a multiple of INTERNAL_BUFFER_LEN.
+		PREFETCH_DIRECT_FRAMES = 1024, // Decoded on the audio thread when nothing is decoded yet.
+	};
+
+	// Ring buffer of frames decoded ahead, written by a single decoding task at a time and read by the audio thread.
+	bool prefetch_enabled = false;
+	LocalVector<AudioFrame> prefetch_buffer;
+	SafeNumeric<uint32_t> prefetch_read;
+	SafeNumeric<uint32_t> prefetch_write;
+	SafeFlag prefetch_ended;
+	WorkerThreadPool::TaskID prefetch_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	void _prefetch_fill(uint32_t p_frames);
+	void _prefetch_task(void *p_userdata);
+	int _read_internal(AudioFrame *p_buffer, int p_frames);
+
 protected:
 	void begin_resample();
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
 	virtual float get_stream_sampling_rate();
 
+	// When prefetching, _mix_internal() is called ahead of playback on the WorkerThreadPool, so the audio thread only copies decoded frames.
+	// Subclasses must call prefetch_reset() before changing their decoding state from outside of _mix_internal() (when starting, stopping, seeking or being destroyed).
+	void set_prefetch_enabled(bool p_enabled);
+	void prefetch_reset();
+	uint32_t get_prefetched_frames() const;
+
 	GDVIRTUAL2R(int, _mix_resampled, GDNativePtr<AudioFrame>, int)
 	GDVIRTUAL0RC(float, _get_stream_sampling_rate)
 
@@ -100,6 +132,7 @@ public:
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
 
 	AudioStreamPlaybackResampled() { mix_offset = 0; }
+	~AudioStreamPlaybackResampled();
 };
 
 class AudioStream : public Resource {
@@ -36,7 +36,9 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/math/audio_frame.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/os/profiling.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/resources/audio_stream_sample.h"
@@ -45,12 +47,115 @@
 
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_SERVER_USE_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AUDIO_SERVER_USE_NEON
+#include <arm_neon.h>
+#endif
+
 #ifdef TOOLS_ENABLED
 #define MARK_EDITED set_edited(true);
 #else
 #define MARK_EDITED
 #endif
 
+// Virtual voices skip their position forward once they have this much stream time to skip, in seconds.
+static const float VIRTUAL_VOICE_SKIP_TIME = 0.25f;
+
+// Mixing kernels, the vector versions handle two stereo frames at a time.
+
+// Stores (or adds to p_out) p_src multiplied by a volume which is p_vol_start + p_vol_step * p_first for the first frame, and moves by p_vol_step every frame.
+static void _mix_volume_ramp(AudioFrame *p_out, const AudioFrame *p_src, uint32_t p_count, AudioFrame p_vol_start, AudioFrame p_vol_step, uint32_t p_first, bool p_add) {
+	uint32_t i = 0;
+#if defined(AUDIO_SERVER_USE_SSE)
+	const __m128 start = _mm_setr_ps(p_vol_start.l, p_vol_start.r, p_vol_start.l + p_vol_step.l, p_vol_start.r + p_vol_step.r);
+	const __m128 step = _mm_setr_ps(p_vol_step.l, p_vol_step.r, p_vol_step.l, p_vol_step.r);
+	for (; i + 2 <= p_count; i += 2) {
+		const __m128 vol = _mm_add_ps(start, _mm_mul_ps(step, _mm_set1_ps((float)(p_first + i))));
+		__m128 mixed = _mm_mul_ps(vol, _mm_loadu_ps(&p_src[i].l));
+		if (p_add) {
+			mixed = _mm_add_ps(mixed, _mm_loadu_ps(&p_out[i].l));
+		}
+		_mm_storeu_ps(&p_out[i].l, mixed);
+	}
+#elif defined(AUDIO_SERVER_USE_NEON)
+	const float start_values[4] = { p_vol_start.l, p_vol_start.r, p_vol_start.l + p_vol_step.l, p_vol_start.r + p_vol_step.r };
+	const float step_values[4] = { p_vol_step.l, p_vol_step.r, p_vol_step.l, p_vol_step.r };
+	const float32x4_t start = vld1q_f32(start_values);
+	const float32x4_t step = vld1q_f32(step_values);
+	for (; i + 2 <= p_count; i += 2) {
+		const float32x4_t vol = vaddq_f32(start, vmulq_f32(step, vdupq_n_f32((float)(p_first + i))));
+		float32x4_t mixed = vmulq_f32(vol, vld1q_f32(&p_src[i].l));
+		if (p_add) {
+			mixed = vaddq_f32(mixed, vld1q_f32(&p_out[i].l));
+		}
+		vst1q_f32(&p_out[i].l, mixed);
+	}
+#endif
+	for (; i < p_count; i++) {
+		const AudioFrame mixed = (p_vol_start + p_vol_step * (float)(p_first + i)) * p_src[i];
+		if (p_add) {
+			p_out[i] += mixed;
+		} else {
+			p_out[i] = mixed;
+		}
+	}
+}
+
+static void _mix_add(AudioFrame *p_out, const AudioFrame *p_src, uint32_t p_count) {
+	uint32_t i = 0;
+#if defined(AUDIO_SERVER_USE_SSE)
+	for (; i + 2 <= p_count; i += 2) {
+		_mm_storeu_ps(&p_out[i].l, _mm_add_ps(_mm_loadu_ps(&p_out[i].l), _mm_loadu_ps(&p_src[i].l)));
+	}
+#elif defined(AUDIO_SERVER_USE_NEON)
+	for (; i + 2 <= p_count; i += 2) {
+		vst1q_f32(&p_out[i].l, vaddq_f32(vld1q_f32(&p_out[i].l), vld1q_f32(&p_src[i].l)));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_out[i] += p_src[i];
+	}
+}
+
+// Multiplies p_buf by p_volume, and returns the peak absolute value of each channel.
+static AudioFrame _mix_apply_volume(AudioFrame *p_buf, uint32_t p_count, float p_volume) {
+	AudioFrame peak = AudioFrame(0, 0);
+	uint32_t i = 0;
+#if defined(AUDIO_SERVER_USE_SSE)
+	const __m128 volume = _mm_set1_ps(p_volume);
+	const __m128 sign_mask = _mm_set1_ps(-0.0f);
+	__m128 peak4 = _mm_setzero_ps();
+	for (; i + 2 <= p_count; i += 2) {
+		const __m128 samples = _mm_mul_ps(_mm_loadu_ps(&p_buf[i].l), volume);
+		_mm_storeu_ps(&p_buf[i].l, samples);
+		peak4 = _mm_max_ps(peak4, _mm_andnot_ps(sign_mask, samples));
+	}
+	peak4 = _mm_max_ps(peak4, _mm_movehl_ps(peak4, peak4));
+	float peak_values[4];
+	_mm_storeu_ps(peak_values, peak4);
+	peak = AudioFrame(peak_values[0], peak_values[1]);
+#elif defined(AUDIO_SERVER_USE_NEON)
+	const float32x4_t volume = vdupq_n_f32(p_volume);
+	float32x4_t peak4 = vdupq_n_f32(0.0f);
+	for (; i + 2 <= p_count; i += 2) {
+		const float32x4_t samples = vmulq_f32(vld1q_f32(&p_buf[i].l), volume);
+		vst1q_f32(&p_buf[i].l, samples);
+		peak4 = vmaxq_f32(peak4, vabsq_f32(samples));
+	}
+	const float32x2_t peak2 = vmax_f32(vget_low_f32(peak4), vget_high_f32(peak4));
+	peak = AudioFrame(vget_lane_f32(peak2, 0), vget_lane_f32(peak2, 1));
+#endif
+	for (; i < p_count; i++) {
+		p_buf[i] *= p_volume;
+		peak.l = MAX(peak.l, ABS(p_buf[i].l));
+		peak.r = MAX(peak.r, ABS(p_buf[i].r));
+	}
+	return peak;
+}
+
 AudioDriver *AudioDriver::singleton = nullptr;
 AudioDriver *AudioDriver::get_singleton() {
 	return singleton;
@@ -230,6 +335,7 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	MemoryTagScope memory_tag(Memory::TAG_AUDIO);
 	mix_count++;
 	int todo = p_frames;
 
@@ -292,7 +398,9 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
-	bool solo_mode = false;
+	PROFILE_ZONE("AudioServer::_mix_step");
+
+	solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
 		Bus *bus = buses[i];
@@ -332,6 +440,8 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	_update_virtual_voices();
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
@@ -340,6 +450,29 @@ void AudioServer::_mix_step() {
 
 		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
+		if (playback->is_virtual) {
+			if (playback->virtual_voice) {
+				// Keep the position of the voice moving forward without mixing it, skipping a chunk at a time to keep it cheap.
+				playback->virtual_time += buffer_size / get_mix_rate() * playback->pitch_scale.get() * playback_speed_scale;
+				if (playback->virtual_time >= VIRTUAL_VOICE_SKIP_TIME) {
+					playback->stream_playback->skip(playback->virtual_time);
+					playback->virtual_time = 0.0f;
+					if (!playback->stream_playback->is_playing()) {
+						playback_list.erase(playback, _delete_playback_list_node);
+					}
+				}
+				continue;
+			}
+
+			// Becomes real again, fading in from silence since the previous volumes are zero.
+			playback->stream_playback->skip(playback->virtual_time);
+			playback->virtual_time = 0.0f;
+			playback->is_virtual = false;
+		}
+
+		// Voices becoming virtual are mixed one last time while fading out.
+		bool virtualizing = playback->virtual_voice && !fading_out;
+
 		AudioFrame *buf = mix_buffer.ptrw();
 
 		// Copy the lookeahead buffer into the mix buffer.
@@ -399,7 +532,7 @@ void AudioServer::_mix_step() {
 
 			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
 				AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
-				if (fading_out) {
+				if (fading_out || virtualizing) {
 					bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
 				}
 				AudioFrame channel_vol = bus_details.volume[idx][channel_idx];
@@ -445,19 +578,18 @@ void AudioServer::_mix_step() {
 			std::copy(std::begin(bus_details.volume[bus_idx]), std::end(bus_details.volume[bus_idx]), std::begin(playback->prev_bus_details->volume[bus_idx]));
 		}
 
+		if (virtualizing) {
+			playback->is_virtual = true;
+			// The lookahead would be out of date once the voice is real again.
+			for (AudioFrame &frame : playback->lookahead) {
+				frame = AudioFrame(0, 0);
+			}
+		}
+
 		switch (playback->state.load()) {
 			case AudioStreamPlaybackListNode::AWAITING_DELETION:
 			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
-				playback_list.erase(playback, [](AudioStreamPlaybackListNode *p) {
-					if (p->prev_bus_details) {
-						delete p->prev_bus_details;
-					}
-					if (p->bus_details) {
-						delete p->bus_details;
-					}
-					p->stream_playback.unref();
-					delete p;
-				});
+				playback_list.erase(playback, _delete_playback_list_node);
 				break;
 			case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
 				// Pause the stream.
@@ -474,134 +606,242 @@ void AudioServer::_mix_step() {
 		}
 	}
 
+	// Buses only send to buses before them, so a bus can be processed once all the buses after it that send to it are.
+	// Buses at the same depth of the send graph don't depend on each other, and have their effects processed together.
+	bus_send_indices.resize(buses.size());
+	bus_levels.resize(buses.size());
+	for (int i = 0; i < buses.size(); i++) {
+		bus_levels[i] = 0;
+	}
+
+	int level_count = 0;
 	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
 		Bus *bus = buses[i];
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
-
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
+		int send_index = -1;
+		if (i > 0) {
+			//everything has a send save for master bus
+			send_index = 0;
+			if (bus_map.has(bus->send)) {
+				Bus *send = bus_map[bus->send];
+				if (send->index_cache < bus->index_cache) { //otherwise invalid, send to master
+					send_index = send->index_cache;
 				}
 			}
+			bus_levels[send_index] = MAX(bus_levels[send_index], bus_levels[i] + 1);
 		}
+		bus_send_indices[i] = send_index;
+		level_count = MAX(level_count, bus_levels[i] + 1);
+	}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+	for (int level = 0; level < level_count; level++) {
+		level_buses.clear();
+		int effect_bus_count = 0;
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			if (bus_levels[i] != level) {
+				continue;
+			}
+			level_buses.push_back(i);
+			if (_bus_has_effects(buses[i])) {
+				effect_bus_count++;
+			}
+		}
 
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+		if (parallel_bus_effects && effect_bus_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AudioServer::_mix_step_bus, level_buses.ptr(), level_buses.size(), -1, true, SNAME("AudioServerBusEffects"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < level_buses.size(); i++) {
+				_mix_step_bus(i, level_buses.ptr());
+			}
+		}
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
-				}
+		// Sends are mixed here, as several buses of the level may send to the same bus.
+		for (uint32_t i = 0; i < level_buses.size(); i++) {
+			int bus_index = level_buses[i];
+			if (bus_send_indices[bus_index] == -1) {
+				continue;
+			}
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+			Bus *bus = buses[bus_index];
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!bus->channels[k].active) {
+					continue;
 				}
-
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+				//if not master bus, send
+				AudioFrame *target_buf = thread_get_channel_mix_buffer(bus_send_indices[bus_index], k);
+				_mix_add(target_buf, bus->channels[k].buffer.ptr(), buffer_size);
 			}
 		}
+	}
+
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-		//process send
+void AudioServer::_delete_playback_list_node(AudioStreamPlaybackListNode *p_node) {
+	if (p_node->prev_bus_details) {
+		delete p_node->prev_bus_details;
+	}
+	if (p_node->bus_details) {
+		delete p_node->bus_details;
+	}
+	p_node->stream_playback.unref();
+	delete p_node;
+}
 
-		Bus *send = nullptr;
+void AudioServer::_update_virtual_voices() {
+	// Voices which are already real need to be this much louder to be kept real, so voices close to the limits don't keep switching.
+	const float real_voice_bias = 2.0f;
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
-			}
+	voice_scores.clear();
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->virtual_voice = false;
+		// Only playing voices are virtualized, fading voices are mixed until they are done.
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING || !playback->stream_playback->can_skip()) {
+			continue;
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+		AudioStreamPlaybackBusDetails *bus_details = playback->bus_details.load();
+		if (bus_details == nullptr) {
+			continue;
+		}
+
+		float audibility = 0.0f;
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (!bus_details->bus_active[idx]) {
 				continue;
 			}
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				const AudioFrame &volume = bus_details->volume[idx][channel_idx];
+				audibility = MAX(audibility, MAX(ABS(volume.l), ABS(volume.r)));
+			}
+		}
+		if (!playback->is_virtual) {
+			audibility *= real_voice_bias;
+		}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		if (audibility < virtual_voice_threshold) {
+			playback->virtual_voice = true;
+			continue;
+		}
 
-			AudioFrame peak = AudioFrame(0, 0);
+		VoiceScore score;
+		score.playback = playback;
+		score.priority = playback->priority.get();
+		score.audibility = audibility;
+		voice_scores.push_back(score);
+	}
 
-			float volume = Math::db2linear(bus->volume_db);
+	if (max_real_voices <= 0 || (int)voice_scores.size() <= max_real_voices) {
+		return;
+	}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
-			}
+	voice_scores.sort_custom<VoiceScoreComparator>();
+	for (uint32_t i = max_real_voices; i < voice_scores.size(); i++) {
+		voice_scores[i].playback->virtual_voice = true;
+	}
+}
+
+bool AudioServer::_bus_has_effects(const Bus *p_bus) const {
+	if (p_bus->bypass) {
+		return false;
+	}
+	for (int i = 0; i < p_bus->effects.size(); i++) {
+		if (p_bus->effects[i].enabled) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void AudioServer::_mix_step_bus(uint32_t p_index, int *p_bus_indices) {
+	Bus *bus = buses[p_bus_indices[p_index]];
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-			//apply volume and compute peak
 			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
+
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
+
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), bus->channels.write[k].effect_buffer.ptrw(), buffer_size);
+			}
+
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(bus->channels.write[k].buffer, bus->channels.write[k].effect_buffer);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + AUDIO_PEAK_OFFSET), Math::linear2db(peak.r + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-				if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		float volume = Math::db2linear(bus->volume_db);
+
+		if (solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		//apply volume and compute peak
+		AudioFrame peak = _mix_apply_volume(buf, buffer_size, volume);
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + AUDIO_PEAK_OFFSET), Math::linear2db(peak.r + AUDIO_PEAK_OFFSET));
+
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false; //went inactive, don't mix.
 			}
 		}
 	}
-
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	// Make this buffer size invariant if buffer_size ever becomes a project setting.
+	const AudioFrame vol_step = (p_vol_final - p_vol_start) / (float)buffer_size;
+
 	if (p_highshelf_gain != 0) {
 		AudioFilterSW filter;
 		filter.set_mode(AudioFilterSW::HIGHSHELF);
@@ -620,22 +860,18 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
-			AudioFrame mixed = vol * p_source_buf[frame_idx];
-			p_processor_l->process_one_interp(mixed.l);
-			p_processor_r->process_one_interp(mixed.r);
-			p_out_buf[frame_idx] += mixed;
+		// Filter in chunks small enough to stay on the stack.
+		const uint32_t chunk_size = 64;
+		AudioFrame mixed[chunk_size];
+		for (uint32_t from = 0; from < buffer_size; from += chunk_size) {
+			uint32_t count = MIN(chunk_size, buffer_size - from);
+			_mix_volume_ramp(mixed, p_source_buf + from, count, p_vol_start, vol_step, from, false);
+			AudioFilterSW::Processor::process_stereo_interp(*p_processor_l, *p_processor_r, &mixed[0].l, count);
+			_mix_add(p_out_buf + from, mixed, count);
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		_mix_volume_ramp(p_out_buf, p_source_buf, buffer_size, p_vol_start, vol_step, 0, true);
 	}
 }
 
@@ -730,6 +966,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -799,6 +1036,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1245,6 +1483,17 @@ void AudioServer::set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback,
 	playback_node->pitch_scale.set(p_pitch_scale);
 }
 
+void AudioServer::set_playback_priority(Ref<AudioStreamPlayback> p_playback, int p_priority) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->priority.set(p_priority);
+}
+
 void AudioServer::set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused) {
 	ERR_FAIL_COND(p_playback.is_null());
 
@@ -1328,17 +1577,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1348,6 +1593,14 @@ void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST("audio/buses/channel_disable_time", 2.0)) * get_mix_rate();
 	ProjectSettings::get_singleton()->set_custom_property_info("audio/buses/channel_disable_time", PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"));
+	parallel_bus_effects = GLOBAL_DEF_RST("audio/buses/parallel_effect_processing", false);
+	max_real_voices = GLOBAL_DEF_RST("audio/general/max_real_voices", 0);
+	const int resampling_quality = GLOBAL_DEF_RST("audio/general/resampling_quality", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/general/resampling_quality", PropertyInfo(Variant::INT, "audio/general/resampling_quality", PROPERTY_HINT_ENUM, "Cubic (Fastest),Sinc 8 Taps (Average),Sinc 16 Taps (Best)"));
+	resampling_taps = resampling_quality <= 0 ? 4 : (resampling_quality == 1 ? 8 : 16);
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/general/max_real_voices", PropertyInfo(Variant::INT, "audio/general/max_real_voices", PROPERTY_HINT_RANGE, "0,256,1,or_greater"));
+	virtual_voice_threshold = Math::db2linear(float(GLOBAL_DEF_RST("audio/general/virtual_voice_threshold_db", -80.0)));
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/general/virtual_voice_threshold_db", PropertyInfo(Variant::FLOAT, "audio/general/virtual_voice_threshold_db", PROPERTY_HINT_RANGE, "-100,0,0.1"));
 	buffer_size = 512; //hardcoded for now
 
 	init_channels_and_buffers();
@@ -1604,6 +1857,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -34,6 +34,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -181,6 +182,9 @@ private:
 
 	float channel_disable_threshold_db = 0.0f;
 	uint32_t channel_disable_frames = 0;
+	bool parallel_bus_effects = false;
+	bool solo_mode = false; // Whether any bus is soloed in the current mix step.
+	int resampling_taps = 8;
 
 	int channel_count = 0;
 	int to_mix = 0;
@@ -203,6 +207,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Output of the effects, swapped with buffer after each one.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -243,6 +248,7 @@ private:
 		SafeNumeric<float> pitch_scale;
 		SafeNumeric<float> highshelf_gain;
 		SafeNumeric<float> attenuation_filter_cutoff_hz; // This isn't used unless highshelf_gain is nonzero.
+		SafeNumeric<int> priority; // Voices with a higher priority are kept real over louder ones with a lower priority.
 		AudioFilterSW::Processor filter_process[8];
 		// Updating this ref after the list node is created breaks consistency guarantees, don't do it!
 		Ref<AudioStreamPlayback> stream_playback;
@@ -254,15 +260,41 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Virtual voices aren't mixed, their position only moves forward. These are only accessed on the audio thread.
+		bool virtual_voice = false; // Whether the voice should be virtual in the current mix.
+		bool is_virtual = false; // Whether the voice was faded out and isn't mixed anymore.
+		float virtual_time = 0.0f; // Stream time not skipped yet.
 	};
 
+	struct VoiceScore {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		int priority = 0;
+		float audibility = 0.0f;
+	};
+
+	struct VoiceScoreComparator {
+		_FORCE_INLINE_ bool operator()(const VoiceScore &p_a, const VoiceScore &p_b) const {
+			if (p_a.priority != p_b.priority) {
+				return p_a.priority > p_b.priority;
+			}
+			return p_a.audibility > p_b.audibility;
+		}
+	};
+
+	int max_real_voices = 0;
+	float virtual_voice_threshold = 0.0f;
+	LocalVector<VoiceScore> voice_scores;
+
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard;
 
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
+	// Send graph of the buses, rebuilt every mix step.
+	LocalVector<int> bus_send_indices;
+	LocalVector<int> bus_levels;
+	LocalVector<int> level_buses;
 	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
@@ -274,6 +306,10 @@ private:
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _update_virtual_voices();
+	static void _delete_playback_list_node(AudioStreamPlaybackListNode *p_node);
+	bool _bus_has_effects(const Bus *p_bus) const;
+	void _mix_step_bus(uint32_t p_index, int *p_bus_indices);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -376,6 +412,10 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	void set_playback_priority(Ref<AudioStreamPlayback> p_playback, int p_priority);
+
+	// Frames used to interpolate resampled streams: 4 for cubic interpolation, 8 or 16 for windowed-sinc interpolation.
+	_FORCE_INLINE_ int get_resampling_taps() const { return resampling_taps; }
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/engine_profiler.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/display_server.h"
 
 #define CHECK_SIZE(arr, expected, what) ERR_FAIL_COND_V_MSG((uint32_t)arr.size() < (uint32_t)(expected), false, String("Malformed ") + what + " message from script debugger, message too short. Expected size: " + itos(expected) + ", actual size: " + itos(arr.size()))
@@ -285,6 +286,45 @@ class ServersDebugger::ServersProfiler : public EngineProfiler {
 	double physics_time = 0;
 	double physics_frame_time = 0;
 
+	void _add_worker_thread_pool_data(ServersDebugger::ServersProfilerFrame &r_frame) {
+		LocalVector<WorkerThreadPool::ProfilingEvent> events;
+		WorkerThreadPool::get_singleton()->flush_profiling_events(events);
+
+		// Time spent per task description, and busy time per thread.
+		HashMap<String, uint64_t> task_times;
+		HashMap<int, uint64_t> thread_times;
+		for (uint32_t i = 0; i < events.size(); i++) {
+			const WorkerThreadPool::ProfilingEvent &ev = events[i];
+			uint64_t time = ev.end_usec - ev.begin_usec;
+			String name = ev.description.is_empty() ? String("unnamed_task") : ev.description;
+			task_times[name] = task_times.has(name) ? task_times[name] + time : time;
+			thread_times[ev.thread_index] = thread_times.has(ev.thread_index) ? thread_times[ev.thread_index] + time : time;
+		}
+
+		ServerInfo tasks_info;
+		tasks_info.name = "worker_thread_pool_tasks";
+		for (const KeyValue<String, uint64_t> &E : task_times) {
+			ServerFunctionInfo fi;
+			fi.name = E.key;
+			fi.time = USEC_TO_SEC(E.value);
+			tasks_info.functions.push_back(fi);
+		}
+		r_frame.servers.push_back(tasks_info);
+
+		ServerInfo threads_info;
+		threads_info.name = "worker_thread_pool_threads";
+		for (int i = -1; i < WorkerThreadPool::get_singleton()->get_thread_count(); i++) {
+			if (i == -1 && !thread_times.has(i)) {
+				continue; // Only show threads outside the pool if they did run tasks.
+			}
+			ServerFunctionInfo fi;
+			fi.name = i == -1 ? String("low_priority_threads") : "thread_" + itos(i);
+			fi.time = thread_times.has(i) ? USEC_TO_SEC(thread_times[i]) : 0.0;
+			threads_info.functions.push_back(fi);
+		}
+		r_frame.servers.push_back(threads_info);
+	}
+
 	void _send_frame_data(bool p_final) {
 		ServersDebugger::ServersProfilerFrame frame;
 		frame.frame_number = Engine::get_singleton()->get_process_frames();
@@ -300,6 +340,9 @@ class ServersDebugger::ServersProfiler : public EngineProfiler {
 			E->value.functions.clear();
 			++E;
 		}
+		if (!p_final) {
+			_add_worker_thread_pool_data(frame);
+		}
 		uint64_t time = 0;
 		scripts_profiler.write_frame_data(frame.script_functions, time, p_final);
 		frame.script_time = USEC_TO_SEC(time);
@@ -322,6 +365,7 @@ public:
 		} else {
 			_send_frame_data(true); // Send final frame.
 		}
+		WorkerThreadPool::get_singleton()->set_profiling_enabled(p_enable);
 		scripts_profiler.toggle(p_enable, p_opts);
 	}
 
@@ -85,6 +85,65 @@ void MovieWriter::write_end() {
 	GDVIRTUAL_REQUIRED_CALL(_write_end);
 }
 
+Vector<uint8_t> MovieWriter::encode_frame(const Ref<Image> &p_image) {
+	return Vector<uint8_t>();
+}
+
+Error MovieWriter::store_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data) {
+	return ERR_UNAVAILABLE;
+}
+
+void MovieWriter::_encode_queued_frame(QueuedFrame *p_frame) {
+	p_frame->encoded = encode_frame(p_frame->image);
+	p_frame->image.unref();
+}
+
+Error MovieWriter::_store_oldest_frame() {
+	QueuedFrame *frame = queued_frames[0];
+	queued_frames.remove_at(0);
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(frame->task);
+	Error err = store_frame(frame->encoded, frame->audio.ptr());
+	memdelete(frame);
+
+	return err;
+}
+
+Error MovieWriter::queue_frame(const Ref<Image> &p_image, const int32_t *p_audio_data, uint32_t p_audio_size) {
+	ERR_FAIL_COND_V(p_image.is_null(), ERR_INVALID_PARAMETER);
+
+	// Each queued frame keeps a full sized image around, so only queue as many as can be encoded at once.
+	uint32_t max_queued = CLAMP(WorkerThreadPool::get_singleton()->get_thread_count(), 1, int(MAX_QUEUED_FRAMES));
+
+	Error err = OK;
+	while (queued_frames.size() >= max_queued) {
+		Error store_err = _store_oldest_frame();
+		if (err == OK) {
+			err = store_err;
+		}
+	}
+
+	QueuedFrame *frame = memnew(QueuedFrame);
+	frame->image = p_image;
+	frame->audio.resize((p_audio_size + sizeof(int32_t) - 1) / sizeof(int32_t));
+	memcpy(frame->audio.ptr(), p_audio_data, p_audio_size);
+	frame->task = WorkerThreadPool::get_singleton()->add_template_task(this, &MovieWriter::_encode_queued_frame, frame, false, "MovieWriterEncodeFrame");
+	queued_frames.push_back(frame);
+
+	return err;
+}
+
+Error MovieWriter::flush_frames() {
+	Error err = OK;
+	while (queued_frames.size()) {
+		Error store_err = _store_oldest_frame();
+		if (err == OK) {
+			err = store_err;
+		}
+	}
+	return err;
+}
+
 bool MovieWriter::handles_file(const String &p_path) const {
 	bool ret = false;
 	if (GDVIRTUAL_REQUIRED_CALL(_handles_file, p_path, ret)) {
@@ -129,18 +188,6 @@ void MovieWriter::_bind_methods() {
 	GDVIRTUAL_BIND(_write_begin, "movie_size", "fps", "base_path")
 	GDVIRTUAL_BIND(_write_frame, "frame_image", "audio_frame_block")
 	GDVIRTUAL_BIND(_write_end)
-
-	GLOBAL_DEF("editor/movie_writer/mix_rate", 48000);
-	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/mix_rate", PropertyInfo(Variant::INT, "editor/movie_writer/mix_rate", PROPERTY_HINT_RANGE, "8000,192000,1,suffix:Hz"));
-	GLOBAL_DEF("editor/movie_writer/speaker_mode", 0);
-	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/speaker_mode", PropertyInfo(Variant::INT, "editor/movie_writer/speaker_mode", PROPERTY_HINT_ENUM, "Stereo,3.1,5.1,7.1"));
-	GLOBAL_DEF("editor/movie_writer/mjpeg_quality", 0.75);
-	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/mjpeg_quality", PropertyInfo(Variant::FLOAT, "editor/movie_writer/mjpeg_quality", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"));
-	// used by the editor
-	GLOBAL_DEF_BASIC("editor/movie_writer/movie_file", "");
-	GLOBAL_DEF_BASIC("editor/movie_writer/disable_vsync", false);
-	GLOBAL_DEF_BASIC("editor/movie_writer/fps", 60);
-	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/fps", PropertyInfo(Variant::INT, "editor/movie_writer/fps", PROPERTY_HINT_RANGE, "1,300,1,suffix:FPS"));
 }
 
 void MovieWriter::set_extensions_hint() {
@@ -182,5 +229,9 @@ void MovieWriter::add_frame(const Ref<Image> &p_image) {
 }
 
 void MovieWriter::end() {
+	Error err = flush_frames();
+	if (err != OK) {
+		ERR_PRINT("MovieWriter: Failed to write the last frames of the movie.");
+	}
 	write_end();
 }
@@ -31,6 +31,7 @@
 #ifndef MOVIE_WRITER_H
 #define MOVIE_WRITER_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio_server.h"
@@ -47,11 +48,24 @@ class MovieWriter : public Object {
 	LocalVector<int32_t> audio_mix_buffer;
 
 	enum {
-		MAX_WRITERS = 8
+		MAX_WRITERS = 8,
+		MAX_QUEUED_FRAMES = 8,
 	};
 	static MovieWriter *writers[];
 	static uint32_t writer_count;
 
+	struct QueuedFrame {
+		Ref<Image> image;
+		LocalVector<int32_t> audio;
+		Vector<uint8_t> encoded;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	LocalVector<QueuedFrame *> queued_frames; // Oldest first.
+
+	void _encode_queued_frame(QueuedFrame *p_frame);
+	Error _store_oldest_frame();
+
 protected:
 	virtual uint32_t get_audio_mix_rate() const;
 	virtual AudioServer::SpeakerMode get_audio_speaker_mode() const;
@@ -60,6 +74,14 @@ protected:
 	virtual Error write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data);
 	virtual void write_end();
 
+	// Writers calling queue_frame() from write_frame() have their frames encoded on WorkerThreadPool, while the following frames are rendered.
+	// encode_frame() is called from the worker threads, and store_frame() from the main thread, in the order the frames were queued.
+	virtual Vector<uint8_t> encode_frame(const Ref<Image> &p_image);
+	virtual Error store_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data);
+
+	Error queue_frame(const Ref<Image> &p_image, const int32_t *p_audio_data, uint32_t p_audio_size);
+	Error flush_frames();
+
 	GDVIRTUAL0RC(uint32_t, _get_audio_mix_rate)
 	GDVIRTUAL0RC(AudioServer::SpeakerMode, _get_audio_speaker_mode)
 
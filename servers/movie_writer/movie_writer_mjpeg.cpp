@@ -193,13 +193,22 @@ Error MovieWriterMJPEG::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 Error MovieWriterMJPEG::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
 	ERR_FAIL_COND_V(!f.is_valid(), ERR_UNCONFIGURED);
 
-	Vector<uint8_t> jpg_buffer = p_image->save_jpg_to_buffer(quality);
-	uint32_t s = jpg_buffer.size();
+	return queue_frame(p_image, p_audio_data, audio_block_size);
+}
+
+Vector<uint8_t> MovieWriterMJPEG::encode_frame(const Ref<Image> &p_image) {
+	return p_image->save_jpg_to_buffer(quality);
+}
+
+Error MovieWriterMJPEG::store_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data) {
+	ERR_FAIL_COND_V(!f.is_valid(), ERR_UNCONFIGURED);
+
+	uint32_t s = p_encoded.size();
 
 	f->store_buffer((const uint8_t *)"00db", 4); // Stream 0, Video
-	f->store_32(jpg_buffer.size()); // sizes
-	f->store_buffer(jpg_buffer.ptr(), jpg_buffer.size());
-	if (jpg_buffer.size() & 1) {
+	f->store_32(p_encoded.size()); // sizes
+	f->store_buffer(p_encoded.ptr(), p_encoded.size());
+	if (p_encoded.size() & 1) {
 		f->store_8(0);
 		s++;
 	}
@@ -44,7 +44,12 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_cell_size", "map"), &NavigationServer3D::map_get_cell_size);
 	ClassDB::bind_method(D_METHOD("map_set_edge_connection_margin", "map", "margin"), &NavigationServer3D::map_set_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_get_edge_connection_margin", "map"), &NavigationServer3D::map_get_edge_connection_margin);
+	ClassDB::bind_method(D_METHOD("map_set_avoidance_lod_origin", "map", "origin"), &NavigationServer3D::map_set_avoidance_lod_origin);
+	ClassDB::bind_method(D_METHOD("map_get_avoidance_lod_origin", "map"), &NavigationServer3D::map_get_avoidance_lod_origin);
+	ClassDB::bind_method(D_METHOD("map_set_avoidance_lod_distance", "map", "distance"), &NavigationServer3D::map_set_avoidance_lod_distance);
+	ClassDB::bind_method(D_METHOD("map_get_avoidance_lod_distance", "map"), &NavigationServer3D::map_get_avoidance_lod_distance);
 	ClassDB::bind_method(D_METHOD("map_get_path", "map", "origin", "destination", "optimize", "navigation_layers"), &NavigationServer3D::map_get_path, DEFVAL(1));
+	ClassDB::bind_method(D_METHOD("map_get_path_async", "map", "origin", "destination", "optimize", "callback", "navigation_layers"), &NavigationServer3D::map_get_path_async, DEFVAL(1));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_to_segment", "map", "start", "end", "use_collision"), &NavigationServer3D::map_get_closest_point_to_segment, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer3D::map_get_closest_point);
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_normal", "map", "to_point"), &NavigationServer3D::map_get_closest_point_normal);
@@ -85,9 +85,24 @@ public:
 	/// Returns the edge connection margin of this map.
 	virtual real_t map_get_edge_connection_margin(RID p_map) const = 0;
 
+	/// Set the point the avoidance level of detail distances are measured from, usually the camera.
+	virtual void map_set_avoidance_lod_origin(RID p_map, Vector3 p_origin) const = 0;
+
+	/// Returns the avoidance level of detail origin.
+	virtual Vector3 map_get_avoidance_lod_origin(RID p_map) const = 0;
+
+	/// Set the distance between avoidance levels of detail, 0 to disable them.
+	virtual void map_set_avoidance_lod_distance(RID p_map, real_t p_distance) const = 0;
+
+	/// Returns the distance between avoidance levels of detail.
+	virtual real_t map_get_avoidance_lod_distance(RID p_map) const = 0;
+
 	/// Returns the navigation path to reach the destination from the origin.
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) const = 0;
 
+	/// Queues a path query, solved in parallel with the other queued ones after the next sync. The callback receives the path.
+	virtual void map_get_path_async(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, const Callable &p_callback, uint32_t p_navigation_layers = 1) const = 0;
+
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const = 0;
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const = 0;
 	virtual Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const = 0;
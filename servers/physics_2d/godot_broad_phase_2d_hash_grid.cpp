@@ -0,0 +1,436 @@
+/*************************************************************************/
+/*  godot_broad_phase_2d_hash_grid.cpp                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "godot_broad_phase_2d_hash_grid.h"
+#include "godot_collision_object_2d.h"
+
+#include "core/config/project_settings.h"
+
+void GodotBroadPhase2DHashGrid::_enter_grid(ID p_id) {
+	Element &e = elements[p_id - 1];
+	e.large = _get_cells(e.aabb, large_object_min_cells, e.cells);
+
+	if (e.large) {
+		e.large_index = large_elements.size();
+		large_elements.push_back(p_id);
+		return;
+	}
+
+	for (int y = e.cells.position.y; y < e.cells.position.y + e.cells.size.y; y++) {
+		for (int x = e.cells.position.x; x < e.cells.position.x + e.cells.size.x; x++) {
+			cells[Vector2i(x, y)].push_back(p_id);
+		}
+	}
+}
+
+void GodotBroadPhase2DHashGrid::_exit_grid(ID p_id) {
+	Element &e = elements[p_id - 1];
+
+	if (e.large) {
+		ID last = large_elements[large_elements.size() - 1];
+		large_elements[e.large_index] = last;
+		elements[last - 1].large_index = e.large_index;
+		large_elements.resize(large_elements.size() - 1);
+		return;
+	}
+
+	// Cells are left in the map when they get empty, they are likely to be used again.
+	for (int y = e.cells.position.y; y < e.cells.position.y + e.cells.size.y; y++) {
+		for (int x = e.cells.position.x; x < e.cells.position.x + e.cells.size.x; x++) {
+			LocalVector<ID> *cell = cells.getptr(Vector2i(x, y));
+			ERR_CONTINUE(!cell);
+			int64_t index = cell->find(p_id);
+			ERR_CONTINUE(index < 0);
+			cell->remove_at_unordered(index);
+		}
+	}
+}
+
+void GodotBroadPhase2DHashGrid::_mark_moved(ID p_id) {
+	Element &e = elements[p_id - 1];
+	if (!e.moved) {
+		e.moved = true;
+		moved_elements.push_back(p_id);
+	}
+}
+
+bool GodotBroadPhase2DHashGrid::_can_pair(const Element &p_a, const Element &p_b) const {
+	if (p_a.owner == p_b.owner || (p_a._static && p_b._static)) {
+		return false;
+	}
+	return p_a.owner->interacts_with(p_b.owner);
+}
+
+int GodotBroadPhase2DHashGrid::_find_pair(const Element &p_element, ID p_other) const {
+	for (uint32_t i = 0; i < p_element.pairs.size(); i++) {
+		if (p_element.pairs[i].other == p_other) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+void GodotBroadPhase2DHashGrid::_pair(ID p_a, ID p_b) {
+	Element &a = elements[p_a - 1];
+	Element &b = elements[p_b - 1];
+
+	PairEntry entry;
+	if (pair_callback) {
+		entry.data = pair_callback(a.owner, a.subindex, b.owner, b.subindex, pair_userdata);
+	}
+
+	entry.other = p_b;
+	a.pairs.push_back(entry);
+	entry.other = p_a;
+	b.pairs.push_back(entry);
+}
+
+void GodotBroadPhase2DHashGrid::_unpair(ID p_a, int p_pair_index) {
+	Element &a = elements[p_a - 1];
+	PairEntry entry = a.pairs[p_pair_index];
+	Element &b = elements[entry.other - 1];
+
+	a.pairs.remove_at_unordered(p_pair_index);
+	int other_index = _find_pair(b, p_a);
+	if (other_index >= 0) {
+		b.pairs.remove_at_unordered(other_index);
+	}
+
+	if (unpair_callback) {
+		unpair_callback(a.owner, a.subindex, b.owner, b.subindex, entry.data, unpair_userdata);
+	}
+}
+
+void GodotBroadPhase2DHashGrid::_pair_with(ID p_id, const LocalVector<ID> &p_others) {
+	for (uint32_t i = 0; i < p_others.size(); i++) {
+		ID other_id = p_others[i];
+		Element &other = elements[other_id - 1];
+		if (other.pass == pass) {
+			continue;
+		}
+		other.pass = pass;
+
+		Element &e = elements[p_id - 1];
+		if (!_can_pair(e, other) || !e.aabb.intersects(other.aabb, true)) {
+			continue;
+		}
+		if (_find_pair(e, other_id) >= 0) {
+			continue;
+		}
+		_pair(p_id, other_id);
+	}
+}
+
+GodotBroadPhase2D::ID GodotBroadPhase2DHashGrid::create(GodotCollisionObject2D *p_object, int p_subindex, const Rect2 &p_aabb, bool p_static) {
+	ID id;
+	if (free_ids.size()) {
+		id = free_ids[free_ids.size() - 1];
+		free_ids.resize(free_ids.size() - 1);
+	} else {
+		elements.push_back(Element());
+		id = elements.size();
+	}
+
+	Element &e = elements[id - 1];
+	e.owner = p_object;
+	e.subindex = p_subindex;
+	e.aabb = p_aabb;
+	e._static = p_static;
+	e.in_use = true;
+	e.pass = 0;
+	e.pairs.clear();
+
+	_enter_grid(id);
+	_mark_moved(id);
+
+	return id;
+}
+
+void GodotBroadPhase2DHashGrid::move(ID p_id, const Rect2 &p_aabb) {
+	ERR_FAIL_COND(!p_id || p_id > elements.size());
+	Element &e = elements[p_id - 1];
+	ERR_FAIL_COND(!e.in_use);
+
+	Rect2i new_cells;
+	bool large = _get_cells(p_aabb, large_object_min_cells, new_cells);
+	if (large == e.large && (large || new_cells == e.cells)) {
+		e.aabb = p_aabb;
+	} else {
+		_exit_grid(p_id);
+		e.aabb = p_aabb;
+		_enter_grid(p_id);
+	}
+
+	_mark_moved(p_id);
+}
+
+void GodotBroadPhase2DHashGrid::set_static(ID p_id, bool p_static) {
+	ERR_FAIL_COND(!p_id || p_id > elements.size());
+	Element &e = elements[p_id - 1];
+	ERR_FAIL_COND(!e.in_use);
+
+	if (e._static == p_static) {
+		return;
+	}
+	e._static = p_static;
+
+	_mark_moved(p_id);
+}
+
+void GodotBroadPhase2DHashGrid::remove(ID p_id) {
+	ERR_FAIL_COND(!p_id || p_id > elements.size());
+	Element &e = elements[p_id - 1];
+	ERR_FAIL_COND(!e.in_use);
+
+	while (e.pairs.size()) {
+		_unpair(p_id, e.pairs.size() - 1);
+	}
+
+	_exit_grid(p_id);
+
+	// Still in the moved list if it was there, it's skipped or paired again if the ID is reused.
+	e.in_use = false;
+	e.owner = nullptr;
+	free_ids.push_back(p_id);
+}
+
+GodotCollisionObject2D *GodotBroadPhase2DHashGrid::get_object(ID p_id) const {
+	ERR_FAIL_COND_V(!p_id || p_id > elements.size(), nullptr);
+	const Element &e = elements[p_id - 1];
+	ERR_FAIL_COND_V(!e.in_use, nullptr);
+	return e.owner;
+}
+
+bool GodotBroadPhase2DHashGrid::is_static(ID p_id) const {
+	ERR_FAIL_COND_V(!p_id || p_id > elements.size(), false);
+	const Element &e = elements[p_id - 1];
+	ERR_FAIL_COND_V(!e.in_use, false);
+	return e._static;
+}
+
+int GodotBroadPhase2DHashGrid::get_subindex(ID p_id) const {
+	ERR_FAIL_COND_V(!p_id || p_id > elements.size(), 0);
+	const Element &e = elements[p_id - 1];
+	ERR_FAIL_COND_V(!e.in_use, 0);
+	return e.subindex;
+}
+
+void GodotBroadPhase2DHashGrid::_cull_aabb(const LocalVector<ID> &p_ids, const Rect2 &p_aabb, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices, int &r_count) {
+	for (uint32_t i = 0; i < p_ids.size() && r_count < p_max_results; i++) {
+		Element &e = elements[p_ids[i] - 1];
+		if (e.pass == pass) {
+			continue;
+		}
+		e.pass = pass;
+
+		if (!e.aabb.intersects(p_aabb, true)) {
+			continue;
+		}
+
+		p_results[r_count] = e.owner;
+		if (p_result_indices) {
+			p_result_indices[r_count] = e.subindex;
+		}
+		r_count++;
+	}
+}
+
+void GodotBroadPhase2DHashGrid::_cull_segment(const LocalVector<ID> &p_ids, const Vector2 &p_from, const Vector2 &p_to, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices, int &r_count) {
+	for (uint32_t i = 0; i < p_ids.size() && r_count < p_max_results; i++) {
+		Element &e = elements[p_ids[i] - 1];
+		if (e.pass == pass) {
+			continue;
+		}
+		e.pass = pass;
+
+		if (!e.aabb.intersects_segment(p_from, p_to)) {
+			continue;
+		}
+
+		p_results[r_count] = e.owner;
+		if (p_result_indices) {
+			p_result_indices[r_count] = e.subindex;
+		}
+		r_count++;
+	}
+}
+
+int GodotBroadPhase2DHashGrid::cull_segment(const Vector2 &p_from, const Vector2 &p_to, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices) {
+	pass++;
+	int count = 0;
+
+	Vector2 from = p_from / cell_size;
+	Vector2 to = p_to / cell_size;
+	Vector2 from_cell = from.floor();
+	Vector2 to_cell = to.floor();
+	real_t cell_steps = Math::abs(to_cell.x - from_cell.x) + Math::abs(to_cell.y - from_cell.y);
+
+	if (!(cell_steps <= cells.size())) {
+		// Going through the used cells is cheaper than walking the segment.
+		for (const KeyValue<Vector2i, LocalVector<ID>> &E : cells) {
+			if (count >= p_max_results) {
+				break;
+			}
+			_cull_segment(E.value, p_from, p_to, p_results, p_max_results, p_result_indices, count);
+		}
+	} else {
+		// Walk the cells the segment crosses.
+		Vector2 dir = to - from;
+		Vector2i cell = Vector2i(from_cell);
+		Vector2i step = Vector2i(SIGN(dir.x), SIGN(dir.y));
+
+		const real_t infinite = 1e20;
+		real_t delta_x = step.x != 0 ? 1.0 / Math::abs(dir.x) : infinite;
+		real_t delta_y = step.y != 0 ? 1.0 / Math::abs(dir.y) : infinite;
+		real_t cross_x = step.x > 0 ? (from_cell.x + 1.0 - from.x) * delta_x : (step.x < 0 ? (from.x - from_cell.x) * delta_x : infinite);
+		real_t cross_y = step.y > 0 ? (from_cell.y + 1.0 - from.y) * delta_y : (step.y < 0 ? (from.y - from_cell.y) * delta_y : infinite);
+
+		for (int i = 0; i <= int(cell_steps) && count < p_max_results; i++) {
+			const LocalVector<ID> *ids = cells.getptr(cell);
+			if (ids) {
+				_cull_segment(*ids, p_from, p_to, p_results, p_max_results, p_result_indices, count);
+			}
+
+			if (cross_x < cross_y) {
+				cell.x += step.x;
+				cross_x += delta_x;
+			} else {
+				cell.y += step.y;
+				cross_y += delta_y;
+			}
+		}
+	}
+
+	if (count < p_max_results) {
+		_cull_segment(large_elements, p_from, p_to, p_results, p_max_results, p_result_indices, count);
+	}
+
+	return count;
+}
+
+int GodotBroadPhase2DHashGrid::cull_aabb(const Rect2 &p_aabb, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices) {
+	pass++;
+	int count = 0;
+
+	Rect2i range;
+	if (_get_cells(p_aabb, MAX(cells.size(), 1u), range)) {
+		// Going through the used cells is cheaper than the ones in the AABB.
+		for (const KeyValue<Vector2i, LocalVector<ID>> &E : cells) {
+			if (count >= p_max_results) {
+				break;
+			}
+			_cull_aabb(E.value, p_aabb, p_results, p_max_results, p_result_indices, count);
+		}
+	} else {
+		for (int y = range.position.y; y < range.position.y + range.size.y && count < p_max_results; y++) {
+			for (int x = range.position.x; x < range.position.x + range.size.x && count < p_max_results; x++) {
+				const LocalVector<ID> *ids = cells.getptr(Vector2i(x, y));
+				if (ids) {
+					_cull_aabb(*ids, p_aabb, p_results, p_max_results, p_result_indices, count);
+				}
+			}
+		}
+	}
+
+	if (count < p_max_results) {
+		_cull_aabb(large_elements, p_aabb, p_results, p_max_results, p_result_indices, count);
+	}
+
+	return count;
+}
+
+void GodotBroadPhase2DHashGrid::set_pair_callback(PairCallback p_pair_callback, void *p_userdata) {
+	pair_callback = p_pair_callback;
+	pair_userdata = p_userdata;
+}
+
+void GodotBroadPhase2DHashGrid::set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) {
+	unpair_callback = p_unpair_callback;
+	unpair_userdata = p_userdata;
+}
+
+void GodotBroadPhase2DHashGrid::update() {
+	for (uint32_t i = 0; i < moved_elements.size(); i++) {
+		ID id = moved_elements[i];
+		Element &e = elements[id - 1];
+		if (!e.moved) {
+			continue; // Removed and listed again when the ID was reused.
+		}
+		e.moved = false;
+		if (!e.in_use) {
+			continue;
+		}
+
+		// Drop the pairs that don't overlap anymore.
+		for (int j = int(e.pairs.size()) - 1; j >= 0; j--) {
+			const Element &other = elements[e.pairs[j].other - 1];
+			if (!_can_pair(e, other) || !e.aabb.intersects(other.aabb, true)) {
+				_unpair(id, j);
+			}
+		}
+
+		pass++;
+		e.pass = pass;
+
+		if (e.large) {
+			for (const KeyValue<Vector2i, LocalVector<ID>> &E : cells) {
+				_pair_with(id, E.value);
+			}
+		} else {
+			for (int y = e.cells.position.y; y < e.cells.position.y + e.cells.size.y; y++) {
+				for (int x = e.cells.position.x; x < e.cells.position.x + e.cells.size.x; x++) {
+					const LocalVector<ID> *ids = cells.getptr(Vector2i(x, y));
+					if (ids) {
+						_pair_with(id, *ids);
+					}
+				}
+			}
+		}
+
+		_pair_with(id, large_elements);
+	}
+
+	moved_elements.clear();
+}
+
+GodotBroadPhase2D *GodotBroadPhase2DHashGrid::_create() {
+	return memnew(GodotBroadPhase2DHashGrid);
+}
+
+GodotBroadPhase2DHashGrid::GodotBroadPhase2DHashGrid() {
+	cell_size = GLOBAL_GET("physics/2d/broadphase/hash_grid_cell_size");
+	cell_size = MAX(cell_size, (real_t)CMP_EPSILON);
+
+	large_object_min_cells = GLOBAL_GET("physics/2d/broadphase/hash_grid_large_object_cells");
+	large_object_min_cells = MAX(large_object_min_cells, 1);
+}
+
+GodotBroadPhase2DHashGrid::~GodotBroadPhase2DHashGrid() {
+}
@@ -0,0 +1,138 @@
+/*************************************************************************/
+/*  godot_broad_phase_2d_hash_grid.h                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_BROAD_PHASE_2D_HASH_GRID_H
+#define GODOT_BROAD_PHASE_2D_HASH_GRID_H
+
+#include "godot_broad_phase_2d.h"
+
+#include "core/math/rect2.h"
+#include "core/math/vector2.h"
+#include "core/math/vector2i.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+// Uniform grid of cells stored in a hash map. Each element is added to all the cells its AABB touches,
+// so creating, moving and removing elements doesn't depend on how many there are. Fits best with many
+// elements of about the cell size. Elements covering too many cells are kept in a separate list instead.
+class GodotBroadPhase2DHashGrid : public GodotBroadPhase2D {
+	struct PairEntry {
+		ID other = 0;
+		void *data = nullptr;
+	};
+
+	struct Element {
+		GodotCollisionObject2D *owner = nullptr;
+		int subindex = 0;
+		Rect2 aabb;
+		bool _static = false;
+		bool in_use = false;
+		bool moved = false; // In the list of elements to pair in update().
+		bool large = false;
+
+		Rect2i cells; // Cells the element is in, in cell coordinates, when it's not large.
+		uint32_t large_index = 0;
+
+		uint64_t pass = 0; // Last query that found the element, to report it only once.
+
+		LocalVector<PairEntry> pairs;
+	};
+
+	LocalVector<Element> elements; // ID - 1 is the index.
+	LocalVector<ID> free_ids;
+	LocalVector<ID> moved_elements;
+	LocalVector<ID> large_elements;
+
+	HashMap<Vector2i, LocalVector<ID>> cells;
+
+	real_t cell_size = 64.0;
+	int large_object_min_cells = 512;
+
+	uint64_t pass = 0;
+
+	PairCallback pair_callback = nullptr;
+	void *pair_userdata = nullptr;
+	UnpairCallback unpair_callback = nullptr;
+	void *unpair_userdata = nullptr;
+
+	// Returns true if the AABB covers more than the given amount of cells, in which case they aren't computed.
+	_FORCE_INLINE_ bool _get_cells(const Rect2 &p_aabb, real_t p_max_cells, Rect2i &r_cells) const {
+		real_t from_x = Math::floor(p_aabb.position.x / cell_size);
+		real_t from_y = Math::floor(p_aabb.position.y / cell_size);
+		real_t to_x = Math::floor((p_aabb.position.x + p_aabb.size.x) / cell_size);
+		real_t to_y = Math::floor((p_aabb.position.y + p_aabb.size.y) / cell_size);
+
+		// Also catches AABBs too big to be converted to cell coordinates.
+		if (!((to_x - from_x + 1.0) * (to_y - from_y + 1.0) <= p_max_cells)) {
+			return true;
+		}
+
+		r_cells = Rect2i(int(from_x), int(from_y), int(to_x - from_x) + 1, int(to_y - from_y) + 1);
+		return false;
+	}
+
+	void _enter_grid(ID p_id);
+	void _exit_grid(ID p_id);
+	void _mark_moved(ID p_id);
+
+	_FORCE_INLINE_ bool _can_pair(const Element &p_a, const Element &p_b) const;
+	int _find_pair(const Element &p_element, ID p_other) const;
+	void _pair(ID p_a, ID p_b);
+	void _unpair(ID p_a, int p_pair_index);
+	void _pair_with(ID p_id, const LocalVector<ID> &p_others);
+
+	void _cull_aabb(const LocalVector<ID> &p_ids, const Rect2 &p_aabb, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices, int &r_count);
+	void _cull_segment(const LocalVector<ID> &p_ids, const Vector2 &p_from, const Vector2 &p_to, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices, int &r_count);
+
+public:
+	// 0 is an invalid ID
+	virtual ID create(GodotCollisionObject2D *p_object, int p_subindex = 0, const Rect2 &p_aabb = Rect2(), bool p_static = false) override;
+	virtual void move(ID p_id, const Rect2 &p_aabb) override;
+	virtual void set_static(ID p_id, bool p_static) override;
+	virtual void remove(ID p_id) override;
+
+	virtual GodotCollisionObject2D *get_object(ID p_id) const override;
+	virtual bool is_static(ID p_id) const override;
+	virtual int get_subindex(ID p_id) const override;
+
+	virtual int cull_segment(const Vector2 &p_from, const Vector2 &p_to, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+	virtual int cull_aabb(const Rect2 &p_aabb, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+
+	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) override;
+	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) override;
+
+	virtual void update() override;
+
+	static GodotBroadPhase2D *_create();
+	GodotBroadPhase2DHashGrid();
+	~GodotBroadPhase2DHashGrid();
+};
+
+#endif // GODOT_BROAD_PHASE_2D_HASH_GRID_H
@@ -32,6 +32,7 @@
 
 #include "godot_body_direct_state_2d.h"
 #include "godot_broad_phase_2d_bvh.h"
+#include "godot_broad_phase_2d_hash_grid.h"
 #include "godot_collision_solver_2d.h"
 
 #include "core/config/project_settings.h"
@@ -1347,7 +1348,17 @@ GodotPhysicsServer2D *GodotPhysicsServer2D::godot_singleton = nullptr;
 
 GodotPhysicsServer2D::GodotPhysicsServer2D(bool p_using_threads) {
 	godot_singleton = this;
-	GodotBroadPhase2D::create_func = GodotBroadPhase2DBVH::_create;
+	int broadphase_type = GLOBAL_DEF("physics/2d/broadphase/type", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/broadphase/type", PropertyInfo(Variant::INT, "physics/2d/broadphase/type", PROPERTY_HINT_ENUM, "BVH,Hash Grid"));
+	GLOBAL_DEF("physics/2d/broadphase/hash_grid_cell_size", 64.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/broadphase/hash_grid_cell_size", PropertyInfo(Variant::FLOAT, "physics/2d/broadphase/hash_grid_cell_size", PROPERTY_HINT_RANGE, "1,1024,1,or_greater"));
+	GLOBAL_DEF("physics/2d/broadphase/hash_grid_large_object_cells", 512);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/broadphase/hash_grid_large_object_cells", PropertyInfo(Variant::INT, "physics/2d/broadphase/hash_grid_large_object_cells", PROPERTY_HINT_RANGE, "1,4096,1,or_greater"));
+	if (broadphase_type == 1) {
+		GodotBroadPhase2D::create_func = GodotBroadPhase2DHashGrid::_create;
+	} else {
+		GodotBroadPhase2D::create_func = GodotBroadPhase2DBVH::_create;
+	}
 
 	using_threads = p_using_threads;
 }
@@ -59,65 +59,118 @@ void GodotBodyPair3D::contact_added_callback(const Vector3 &p_point_A, int p_ind
 	contact.normal = (p_point_A - p_point_B).normalized();
 	contact.used = true;
 
-	// Attempt to determine if the contact will be reused.
+	// Attempt to determine if the contact will be reused, matching it with the closest contact
+	// from the previous step that wasn't already matched in this one, so nearby contacts don't
+	// steal each other's accumulated impulses.
 	real_t contact_recycle_radius = space->get_contact_recycle_radius();
+	real_t recycle_radius2 = contact_recycle_radius * contact_recycle_radius;
+
+	int recycled = -1;
+	real_t recycled_distance2 = 0.0;
 
 	for (int i = 0; i < contact_count; i++) {
-		Contact &c = contacts[i];
-		if (c.local_A.distance_squared_to(local_A) < (contact_recycle_radius * contact_recycle_radius) &&
-				c.local_B.distance_squared_to(local_B) < (contact_recycle_radius * contact_recycle_radius)) {
-			contact.acc_normal_impulse = c.acc_normal_impulse;
-			contact.acc_bias_impulse = c.acc_bias_impulse;
-			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
-			contact.acc_tangent_impulse = c.acc_tangent_impulse;
-			c = contact;
-			return;
+		const Contact &c = contacts[i];
+		if (c.used) {
+			continue;
+		}
+
+		real_t distance_A2 = c.local_A.distance_squared_to(local_A);
+		real_t distance_B2 = c.local_B.distance_squared_to(local_B);
+		if (distance_A2 < recycle_radius2 && distance_B2 < recycle_radius2 && (recycled == -1 || distance_A2 + distance_B2 < recycled_distance2)) {
+			recycled = i;
+			recycled_distance2 = distance_A2 + distance_B2;
 		}
 	}
 
+	if (recycled != -1) {
+		// Warm start from the previous impulses, keeping the friction in the new tangent plane.
+		Contact &c = contacts[recycled];
+		contact.acc_normal_impulse = c.acc_normal_impulse;
+		contact.acc_bias_impulse = c.acc_bias_impulse;
+		contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+		contact.acc_tangent_impulse = c.acc_tangent_impulse - contact.normal * contact.normal.dot(c.acc_tangent_impulse);
+		c = contact;
+		return;
+	}
+
 	// Figure out if the contact amount must be reduced to fit the new contact.
 	if (new_index == MAX_CONTACTS) {
-		// Remove the contact with the minimum depth.
+		int replaced = _find_contact_to_replace(contact);
+		if (replaced > -1) {
+			contacts[replaced] = contact;
+		}
 
-		const Basis &basis_A = A->get_transform().basis;
-		const Basis &basis_B = B->get_transform().basis;
+		return;
+	}
 
-		int least_deep = -1;
-		real_t min_depth;
+	contacts[new_index] = contact;
+	contact_count++;
+}
 
-		// Start with depth for new contact.
-		{
-			Vector3 global_A = basis_A.xform(contact.local_A);
-			Vector3 global_B = basis_B.xform(contact.local_B) + offset_B;
+int GodotBodyPair3D::_find_contact_to_replace(const Contact &p_contact) const {
+	// Keep the deepest contact, and replace the one that leaves the largest area between the
+	// remaining contacts, so a full manifold still covers the whole contact patch and stacks stay
+	// supported from all sides.
+	const Basis &basis_A = A->get_transform().basis;
+	const Basis &basis_B = B->get_transform().basis;
 
-			Vector3 axis = global_A - global_B;
-			min_depth = axis.dot(contact.normal);
+	Vector3 points[MAX_CONTACTS + 1];
+	int deepest = -1;
+	real_t max_depth = 0.0;
+
+	for (int i = 0; i <= contact_count; i++) {
+		const Contact &c = i < contact_count ? contacts[i] : p_contact;
+		Vector3 global_A = basis_A.xform(c.local_A);
+		Vector3 global_B = basis_B.xform(c.local_B) + offset_B;
+
+		real_t depth = (global_A - global_B).dot(c.normal);
+		if (deepest == -1 || depth > max_depth) {
+			max_depth = depth;
+			deepest = i;
 		}
 
-		for (int i = 0; i < contact_count; i++) {
-			const Contact &c = contacts[i];
-			Vector3 global_A = basis_A.xform(c.local_A);
-			Vector3 global_B = basis_B.xform(c.local_B) + offset_B;
+		points[i] = global_A;
+	}
 
-			Vector3 axis = global_A - global_B;
-			real_t depth = axis.dot(c.normal);
+	int replaced = -1;
+	real_t max_area = 0.0;
+
+	for (int i = 0; i < contact_count; i++) {
+		if (i == deepest) {
+			continue;
+		}
 
-			if (depth < min_depth) {
-				min_depth = depth;
-				least_deep = i;
+		// Gather the points that would remain, the 4th one being the new contact.
+		Vector3 p[MAX_CONTACTS];
+		int count = 0;
+		for (int j = 0; j <= contact_count; j++) {
+			if (j != i) {
+				p[count++] = points[j];
 			}
 		}
 
-		if (least_deep > -1) {
-			// Replace the least deep contact by the new one.
-			contacts[least_deep] = contact;
+		// Quadrilateral area measure, as the largest of the cross products of its diagonals.
+		real_t area = MAX(MAX((p[0] - p[1]).cross(p[2] - p[3]).length_squared(), (p[0] - p[2]).cross(p[1] - p[3]).length_squared()), (p[0] - p[3]).cross(p[1] - p[2]).length_squared());
+		if (replaced == -1 || area > max_area) {
+			max_area = area;
+			replaced = i;
 		}
+	}
 
-		return;
+	if (deepest == contact_count) {
+		// The new contact is the deepest, it must be kept.
+		return replaced;
 	}
 
-	contacts[new_index] = contact;
-	contact_count++;
+	// Replacing none of the existing contacts can also be the best option.
+	{
+		real_t area = MAX(MAX((points[0] - points[1]).cross(points[2] - points[3]).length_squared(), (points[0] - points[2]).cross(points[1] - points[3]).length_squared()), (points[0] - points[3]).cross(points[1] - points[2]).length_squared());
+		if (area >= max_area) {
+			return -1;
+		}
+	}
+
+	return replaced;
 }
 
 void GodotBodyPair3D::validate_contacts() {
@@ -32,6 +32,8 @@
 
 #include "godot_collision_object_3d.h"
 
+#include "core/config/project_settings.h"
+
 GodotBroadPhase3DBVH::ID GodotBroadPhase3DBVH::create(GodotCollisionObject3D *p_object, int p_subindex, const AABB &p_aabb, bool p_static) {
 	uint32_t tree_id = p_static ? TREE_STATIC : TREE_DYNAMIC;
 	uint32_t tree_collision_mask = p_static ? TREE_FLAG_DYNAMIC : (TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
@@ -86,6 +88,14 @@ int GodotBroadPhase3DBVH::cull_aabb(const AABB &p_aabb, GodotCollisionObject3D *
 	return bvh.cull_aabb(p_aabb, p_results, p_max_results, nullptr, 0xFFFFFFFF, p_result_indices);
 }
 
+int GodotBroadPhase3DBVH::cull_segment_concurrent(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, CullScratch &r_scratch, int *p_result_indices) {
+	return bvh.cull_segment_concurrent(p_from, p_to, p_results, p_max_results, nullptr, r_scratch.hits, 0xFFFFFFFF, p_result_indices);
+}
+
+int GodotBroadPhase3DBVH::cull_aabb_concurrent(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, CullScratch &r_scratch, int *p_result_indices) {
+	return bvh.cull_aabb_concurrent(p_aabb, p_results, p_max_results, nullptr, r_scratch.hits, 0xFFFFFFFF, p_result_indices);
+}
+
 void *GodotBroadPhase3DBVH::_pair_callback(void *self, uint32_t p_A, GodotCollisionObject3D *p_object_A, int subindex_A, uint32_t p_B, GodotCollisionObject3D *p_object_B, int subindex_B) {
 	GodotBroadPhase3DBVH *bpo = static_cast<GodotBroadPhase3DBVH *>(self);
 	if (!bpo->pair_callback) {
@@ -125,4 +135,8 @@ GodotBroadPhase3D *GodotBroadPhase3DBVH::_create() {
 GodotBroadPhase3DBVH::GodotBroadPhase3DBVH() {
 	bvh.set_pair_callback(_pair_callback, this);
 	bvh.set_unpair_callback(_unpair_callback, this);
+
+	uint32_t pair_thread_threshold = GLOBAL_DEF("physics/3d/broadphase/pair_thread_threshold", 256);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/3d/broadphase/pair_thread_threshold", PropertyInfo(Variant::INT, "physics/3d/broadphase/pair_thread_threshold", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"));
+	bvh.params_set_pair_thread_threshold(pair_thread_threshold);
 }
@@ -1060,12 +1060,18 @@ static void _collision_box_box(const GodotShape3D *p_a, const Transform3D &p_tra
 		return;
 	}
 
+	// The face normals are also the edge directions, so they are only normalized once for all the tests.
+	Vector3 axes_A[3];
+	Vector3 axes_B[3];
+	for (int i = 0; i < 3; i++) {
+		axes_A[i] = p_transform_a.basis.get_column(i).normalized();
+		axes_B[i] = p_transform_b.basis.get_column(i).normalized();
+	}
+
 	// test faces of A
 
 	for (int i = 0; i < 3; i++) {
-		Vector3 axis = p_transform_a.basis.get_column(i).normalized();
-
-		if (!separator.test_axis(axis)) {
+		if (!separator.test_axis(axes_A[i])) {
 			return;
 		}
 	}
@@ -1073,9 +1079,7 @@ static void _collision_box_box(const GodotShape3D *p_a, const Transform3D &p_tra
 	// test faces of B
 
 	for (int i = 0; i < 3; i++) {
-		Vector3 axis = p_transform_b.basis.get_column(i).normalized();
-
-		if (!separator.test_axis(axis)) {
+		if (!separator.test_axis(axes_B[i])) {
 			return;
 		}
 	}
@@ -1083,7 +1087,7 @@ static void _collision_box_box(const GodotShape3D *p_a, const Transform3D &p_tra
 	// test combined edges
 	for (int i = 0; i < 3; i++) {
 		for (int j = 0; j < 3; j++) {
-			Vector3 axis = p_transform_a.basis.get_column(i).cross(p_transform_b.basis.get_column(j));
+			Vector3 axis = axes_A[i].cross(axes_B[j]);
 
 			if (Math::is_zero_approx(axis.length_squared())) {
 				continue;
@@ -1404,7 +1408,7 @@ static void _collision_box_convex_polygon(const GodotShape3D *p_a, const Transfo
 		Vector3 e1 = p_transform_a.basis.get_column(i);
 
 		for (int j = 0; j < edge_count; j++) {
-			Vector3 e2 = p_transform_b.basis.xform(vertices[edges[j].a]) - p_transform_b.basis.xform(vertices[edges[j].b]);
+			Vector3 e2 = p_transform_b.basis.xform(vertices[edges[j].a] - vertices[edges[j].b]);
 
 			Vector3 axis = e1.cross(e2).normalized();
 
@@ -1771,7 +1775,7 @@ static void _collision_capsule_convex_polygon(const GodotShape3D *p_a, const Tra
 
 	for (int i = 0; i < edge_count; i++) {
 		// cylinder
-		Vector3 edge_axis = p_transform_b.basis.xform(vertices[edges[i].a]) - p_transform_b.basis.xform(vertices[edges[i].b]);
+		Vector3 edge_axis = p_transform_b.basis.xform(vertices[edges[i].a] - vertices[edges[i].b]);
 		Vector3 axis = edge_axis.cross(p_transform_a.basis.get_column(1)).normalized();
 
 		if (!separator.test_axis(axis)) {
@@ -1790,7 +1794,7 @@ static void _collision_capsule_convex_polygon(const GodotShape3D *p_a, const Tra
 
 		for (int j = 0; j < edge_count; j++) {
 			Vector3 n1 = sphere_pos - p_transform_b.xform(vertices[edges[j].a]);
-			Vector3 n2 = p_transform_b.basis.xform(vertices[edges[j].a]) - p_transform_b.basis.xform(vertices[edges[j].b]);
+			Vector3 n2 = p_transform_b.basis.xform(vertices[edges[j].a] - vertices[edges[j].b]);
 
 			Vector3 axis = n1.cross(n2).cross(n2).normalized();
 
@@ -2105,7 +2109,7 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 	int vertex_count_B = mesh_B.vertices.size();
 
 	// Precalculating this makes the transforms faster.
-	Basis a_xform_normal = p_transform_b.basis.inverse().transposed();
+	Basis a_xform_normal = p_transform_a.basis.inverse().transposed();
 
 	// faces of A
 	for (int i = 0; i < face_count_A; i++) {
@@ -2130,10 +2134,10 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 
 	// A<->B edges
 	for (int i = 0; i < edge_count_A; i++) {
-		Vector3 e1 = p_transform_a.basis.xform(vertices_A[edges_A[i].a]) - p_transform_a.basis.xform(vertices_A[edges_A[i].b]);
+		Vector3 e1 = p_transform_a.basis.xform(vertices_A[edges_A[i].a] - vertices_A[edges_A[i].b]);
 
 		for (int j = 0; j < edge_count_B; j++) {
-			Vector3 e2 = p_transform_b.basis.xform(vertices_B[edges_B[j].a]) - p_transform_b.basis.xform(vertices_B[edges_B[j].b]);
+			Vector3 e2 = p_transform_b.basis.xform(vertices_B[edges_B[j].a] - vertices_B[edges_B[j].b]);
 
 			Vector3 axis = e1.cross(e2).normalized();
 
@@ -2231,7 +2235,7 @@ static void _collision_convex_polygon_face(const GodotShape3D *p_a, const Transf
 
 	// A<->B edges
 	for (int i = 0; i < edge_count; i++) {
-		Vector3 e1 = p_transform_a.xform(vertices[edges[i].a]) - p_transform_a.xform(vertices[edges[i].b]);
+		Vector3 e1 = p_transform_a.basis.xform(vertices[edges[i].a] - vertices[edges[i].b]);
 
 		for (int j = 0; j < 3; j++) {
 			Vector3 e2 = vertex[j] - vertex[(j + 1) % 3];
@@ -1597,6 +1597,10 @@ void GodotPhysicsServer3D::set_active(bool p_active) {
 
 void GodotPhysicsServer3D::init() {
 	stepper = memnew(GodotStep3D);
+
+	substeps = GLOBAL_DEF("physics/3d/solver/substeps", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/3d/solver/substeps", PropertyInfo(Variant::INT, "physics/3d/solver/substeps", PROPERTY_HINT_RANGE, "1,8,1,or_greater"));
+	substeps = MAX(substeps, 1);
 }
 
 void GodotPhysicsServer3D::step(real_t p_step) {
@@ -1611,8 +1615,11 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	real_t substep = p_step / substeps;
 	for (const GodotSpace3D *E : active_spaces) {
-		stepper->step(const_cast<GodotSpace3D *>(E), p_step);
+		for (int i = 0; i < substeps; i++) {
+			stepper->step(const_cast<GodotSpace3D *>(E), substep);
+		}
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
@@ -1696,11 +1703,40 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_STATE_CHECKSUM: {
+			return (int)_get_state_checksum();
+		} break;
 	}
 
 	return 0;
 }
 
+uint32_t GodotPhysicsServer3D::_get_state_checksum() const {
+	// Spaces and their objects are iterated in the order they were added, so the same simulation gives the same value.
+	uint32_t h = HASH_MURMUR3_SEED;
+
+	for (const GodotSpace3D *space : active_spaces) {
+		for (const GodotCollisionObject3D *E : space->get_objects()) {
+			if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+				continue;
+			}
+
+			const GodotBody3D *body = static_cast<const GodotBody3D *>(E);
+			const Transform3D &transform = body->get_transform();
+			for (int i = 0; i < 3; i++) {
+				for (int j = 0; j < 3; j++) {
+					h = hash_murmur3_one_real(transform.basis.rows[i][j], h);
+				}
+				h = hash_murmur3_one_real(transform.origin[i], h);
+				h = hash_murmur3_one_real(body->get_linear_velocity()[i], h);
+				h = hash_murmur3_one_real(body->get_angular_velocity()[i], h);
+			}
+		}
+	}
+
+	return hash_fmix32(h);
+}
+
 void GodotPhysicsServer3D::_update_shapes() {
 	while (pending_shape_update_list.first()) {
 		pending_shape_update_list.first()->self()->_shape_changed();
@@ -49,6 +49,8 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	int active_objects = 0;
 	int collision_pairs = 0;
 
+	int substeps = 1;
+
 	bool using_threads = false;
 	bool doing_sync = false;
 	bool flushing_queries = false;
@@ -67,6 +69,7 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	friend class GodotCollisionObject3D;
 	SelfList<GodotCollisionObject3D>::List pending_shape_update_list;
 	void _update_shapes();
+	uint32_t _get_state_checksum() const;
 
 	static GodotPhysicsServer3D *godot_singleton;
 
@@ -33,7 +33,7 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
-#include "core/templates/sort_array.h"
+#include "core/object/worker_thread_pool.h"
 
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
 
@@ -503,8 +503,12 @@ void GodotCapsuleShape3D::project_range(const Vector3 &p_normal, const Transform
 	n *= radius;
 	n.y += (n.y > 0) ? h : -h;
 
-	r_max = p_normal.dot(p_transform.xform(n));
-	r_min = p_normal.dot(p_transform.xform(-n));
+	// The capsule is symmetric around its origin, so the range is centered on it.
+	real_t distance = p_normal.dot(p_transform.origin);
+	real_t length = p_normal.dot(p_transform.basis.xform(n));
+
+	r_max = distance + length;
+	r_min = distance - length;
 }
 
 Vector3 GodotCapsuleShape3D::get_support(const Vector3 &p_normal) const {
@@ -847,16 +851,22 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 
 	const Vector3 *vrts = &mesh.vertices[0];
 
-	for (int i = 0; i < vertex_count; i++) {
-		real_t d = p_normal.dot(p_transform.xform(vrts[i]));
+	// Project the vertices on the normal in local space, so only the normal is transformed
+	// (xform_inv multiplies by the transposed basis, which is what the dot product needs).
+	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+	real_t distance = p_normal.dot(p_transform.origin);
 
-		if (i == 0 || d > r_max) {
-			r_max = d;
-		}
-		if (i == 0 || d < r_min) {
-			r_min = d;
-		}
+	real_t d = local_normal.dot(vrts[0]);
+	real_t min = d;
+	real_t max = d;
+	for (int i = 1; i < vertex_count; i++) {
+		d = local_normal.dot(vrts[i]);
+		min = MIN(min, d);
+		max = MAX(max, d);
 	}
+
+	r_min = distance + min;
+	r_max = distance + max;
 }
 
 Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
@@ -1224,11 +1234,13 @@ Vector<Vector3> GodotConcavePolygonShape3D::get_faces() const {
 	Vector<Vector3> rfaces;
 	rfaces.resize(faces.size() * 3);
 
+	// Give the faces back in their original order.
 	for (int i = 0; i < faces.size(); i++) {
 		Face f = faces.get(i);
+		int src = face_order[i];
 
 		for (int j = 0; j < 3; j++) {
-			rfaces.set(i * 3 + j, vertices.get(f.indices[j]));
+			rfaces.set(src * 3 + j, vertices.get(f.indices[j]));
 		}
 	}
 
@@ -1281,39 +1293,48 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *bvh = &p_params->bvh[p_idx];
+void GodotConcavePolygonShape3D::_cull_segment(_SegmentCullParams *p_params) const {
+	int stack[BVH_MAX_DEPTH];
+	int stack_size = 0;
+	int idx = 0;
 
-	if (!bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
-	}
+	while (true) {
+		const BVH *node = &p_params->bvh[idx];
 
-	if (bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->collisions++;
+		if (node->aabb.intersects_segment(p_params->from, p_params->to)) {
+			if (node->face_count == 0) {
+				// Visit the first child right away, the second one later.
+				stack[stack_size++] = node->index;
+				idx++;
+				continue;
+			}
+
+			for (int i = node->index; i < node->index + node->face_count; i++) {
+				const Face *f = &p_params->faces[i];
+				GodotFaceShape3D *face = p_params->face;
+				face->normal = f->normal;
+				face->vertex[0] = p_params->vertices[f->indices[0]];
+				face->vertex[1] = p_params->vertices[f->indices[1]];
+				face->vertex[2] = p_params->vertices[f->indices[2]];
+
+				Vector3 res;
+				Vector3 normal;
+				if (face->intersect_segment(p_params->from, p_params->to, res, normal, true)) {
+					real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
+					if ((d > 0) && (d < p_params->min_d)) {
+						p_params->min_d = d;
+						p_params->result = res;
+						p_params->normal = normal;
+						p_params->collisions++;
+					}
+				}
 			}
 		}
-	} else {
-		if (bvh->left >= 0) {
-			_cull_segment(bvh->left, p_params);
-		}
-		if (bvh->right >= 0) {
-			_cull_segment(bvh->right, p_params);
+
+		if (stack_size == 0) {
+			break;
 		}
+		idx = stack[--stack_size];
 	}
 }
 
@@ -1342,7 +1363,7 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	params.face = &face;
 
 	// cull
-	_cull_segment(0, &params);
+	_cull_segment(&params);
 
 	if (params.collisions > 0) {
 		r_result = params.result;
@@ -1361,35 +1382,39 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 	return Vector3();
 }
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *bvh = &p_params->bvh[p_idx];
+bool GodotConcavePolygonShape3D::_cull(_CullParams *p_params) const {
+	int stack[BVH_MAX_DEPTH];
+	int stack_size = 0;
+	int idx = 0;
 
-	if (!p_params->aabb.intersects(bvh->aabb)) {
-		return false;
-	}
+	while (true) {
+		const BVH *node = &p_params->bvh[idx];
 
-	if (bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
-		}
-	} else {
-		if (bvh->left >= 0) {
-			if (_cull(bvh->left, p_params)) {
-				return true;
+		if (p_params->aabb.intersects(node->aabb)) {
+			if (node->face_count == 0) {
+				// Visit the first child right away, the second one later.
+				stack[stack_size++] = node->index;
+				idx++;
+				continue;
 			}
-		}
 
-		if (bvh->right >= 0) {
-			if (_cull(bvh->right, p_params)) {
-				return true;
+			for (int i = node->index; i < node->index + node->face_count; i++) {
+				const Face *f = &p_params->faces[i];
+				GodotFaceShape3D *face = p_params->face;
+				face->normal = f->normal;
+				face->vertex[0] = p_params->vertices[f->indices[0]];
+				face->vertex[1] = p_params->vertices[f->indices[1]];
+				face->vertex[2] = p_params->vertices[f->indices[2]];
+				if (p_params->callback(p_params->userdata, face)) {
+					return true;
+				}
 			}
 		}
+
+		if (stack_size == 0) {
+			break;
+		}
+		idx = stack[--stack_size];
 	}
 
 	return false;
@@ -1422,7 +1447,7 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	params.userdata = p_userdata;
 
 	// cull
-	_cull(0, &params);
+	_cull(&params);
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1441,108 +1466,290 @@ struct _Volume_BVH_Element {
 	int face_index = 0;
 };
 
-struct _Volume_BVH_CompareX {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.x < b.center.x;
-	}
-};
+static _FORCE_INLINE_ real_t _volume_bvh_area(const AABB &p_aabb) {
+	const Vector3 &size = p_aabb.size;
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
 
-struct _Volume_BVH_CompareY {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.y < b.center.y;
-	}
-};
+// Splits the elements with binned SAH, and returns where the second half starts.
+static int _volume_bvh_partition(_Volume_BVH_Element *p_elements, int p_from, int p_to, AABB &r_aabb) {
+	const int bin_count = GodotConcavePolygonShape3D::BVH_SAH_BINS;
 
-struct _Volume_BVH_CompareZ {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.z < b.center.z;
+	AABB aabb = p_elements[p_from].aabb;
+	AABB centers(p_elements[p_from].center, Vector3());
+	for (int i = p_from + 1; i < p_to; i++) {
+		aabb.merge_with(p_elements[i].aabb);
+		centers.expand_to(p_elements[i].center);
 	}
-};
+	r_aabb = aabb;
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
+	int best_axis = -1;
+	int best_bin = 0;
+	real_t best_cost = 0.0;
 
-	int face_index = 0;
-};
+	for (int axis = 0; axis < 3; axis++) {
+		real_t extent = centers.size[axis];
+		if (extent <= CMP_EPSILON) {
+			continue;
+		}
+		real_t scale = bin_count / extent;
+
+		int counts[bin_count] = {};
+		AABB bounds[bin_count];
+		for (int i = p_from; i < p_to; i++) {
+			int bin = MIN(int((p_elements[i].center[axis] - centers.position[axis]) * scale), bin_count - 1);
+			if (counts[bin] == 0) {
+				bounds[bin] = p_elements[i].aabb;
+			} else {
+				bounds[bin].merge_with(p_elements[i].aabb);
+			}
+			counts[bin]++;
+		}
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
-
-	if (p_size == 1) {
-		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+		// Area and count of everything after each split, swept from the right.
+		real_t right_areas[bin_count] = {};
+		int right_counts[bin_count] = {};
+		AABB right_bounds;
+		int right_count = 0;
+		for (int bin = bin_count - 1; bin > 0; bin--) {
+			if (counts[bin] > 0) {
+				if (right_count == 0) {
+					right_bounds = bounds[bin];
+				} else {
+					right_bounds.merge_with(bounds[bin]);
+				}
+				right_count += counts[bin];
+			}
+			right_areas[bin] = right_count > 0 ? _volume_bvh_area(right_bounds) : 0.0;
+			right_counts[bin] = right_count;
+		}
+
+		AABB left_bounds;
+		int left_count = 0;
+		for (int bin = 0; bin < bin_count - 1; bin++) {
+			if (counts[bin] > 0) {
+				if (left_count == 0) {
+					left_bounds = bounds[bin];
+				} else {
+					left_bounds.merge_with(bounds[bin]);
+				}
+				left_count += counts[bin];
+			}
+			if (left_count == 0 || right_counts[bin + 1] == 0) {
+				continue;
+			}
+
+			real_t cost = left_count * _volume_bvh_area(left_bounds) + right_counts[bin + 1] * right_areas[bin + 1];
+			if (best_axis == -1 || cost < best_cost) {
+				best_axis = axis;
+				best_bin = bin;
+				best_cost = cost;
+			}
+		}
 	}
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
+	if (best_axis == -1) {
+		// All the centers are in the same place, any split will do.
+		return p_from + (p_to - p_from) / 2;
+	}
+
+	real_t scale = bin_count / centers.size[best_axis];
+	int left = p_from;
+	int right = p_to - 1;
+	while (left <= right) {
+		int bin = MIN(int((p_elements[left].center[best_axis] - centers.position[best_axis]) * scale), bin_count - 1);
+		if (bin <= best_bin) {
+			left++;
 		} else {
+			SWAP(p_elements[left], p_elements[right]);
+			right--;
+		}
+	}
+
+	return left;
+}
+
+void GodotConcavePolygonShape3D::_build_bvh(_Volume_BVH_Element *p_elements, int p_from, int p_to, int p_depth, LocalVector<BVH> &r_nodes) {
+	int idx = r_nodes.size();
+	r_nodes.push_back(BVH());
+
+	int count = p_to - p_from;
+	if (count <= BVH_LEAF_FACES || p_depth >= BVH_MAX_DEPTH) {
+		AABB aabb = p_elements[p_from].aabb;
+		for (int i = p_from + 1; i < p_to; i++) {
 			aabb.merge_with(p_elements[i].aabb);
 		}
+		r_nodes[idx].aabb = aabb;
+		r_nodes[idx].index = p_from;
+		r_nodes[idx].face_count = count;
+		return;
 	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
-		case 0: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
 
-		} break;
-		case 1: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
-		} break;
-		case 2: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
-		} break;
+	AABB aabb;
+	int split = _volume_bvh_partition(p_elements, p_from, p_to, aabb);
+
+	_build_bvh(p_elements, p_from, split, p_depth + 1, r_nodes);
+	r_nodes[idx].aabb = aabb;
+	r_nodes[idx].index = r_nodes.size();
+	_build_bvh(p_elements, split, p_to, p_depth + 1, r_nodes);
+}
+
+int GodotConcavePolygonShape3D::_split_bvh_top(int p_from, int p_to, int p_depth, int p_task_size, LocalVector<BVHBuildTopNode> &r_top) {
+	int idx = r_top.size();
+	r_top.push_back(BVHBuildTopNode());
+
+	if (p_to - p_from <= p_task_size || p_depth >= BVH_MAX_DEPTH / 2) {
+		BVHBuildTask task;
+		task.from = p_from;
+		task.to = p_to;
+		task.depth = p_depth;
+		r_top[idx].task = _build_tasks.size();
+		_build_tasks.push_back(task);
+		return idx;
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
+	AABB aabb;
+	int split = _volume_bvh_partition(_build_elements, p_from, p_to, aabb);
+	r_top[idx].aabb = aabb;
 
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
+	int left = _split_bvh_top(p_from, split, p_depth + 1, p_task_size, r_top);
+	int right = _split_bvh_top(split, p_to, p_depth + 1, p_task_size, r_top);
+	r_top[idx].left = left;
+	r_top[idx].right = right;
+	return idx;
 }
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+void GodotConcavePolygonShape3D::_build_bvh_task(uint32_t p_index, void *p_userdata) {
+	BVHBuildTask &task = _build_tasks[p_index];
+	_build_bvh(_build_elements, task.from, task.to, task.depth, task.nodes);
+}
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
+void GodotConcavePolygonShape3D::_emit_bvh_top(const LocalVector<BVHBuildTopNode> &p_top, int p_top_index, LocalVector<BVH> &r_nodes) {
+	const BVHBuildTopNode &top = p_top[p_top_index];
 
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	if (top.task >= 0) {
+		// Subtrees were built on their own, move their internal node links to where they end up.
+		const LocalVector<BVH> &task_nodes = _build_tasks[top.task].nodes;
+		int offset = r_nodes.size();
+		for (uint32_t i = 0; i < task_nodes.size(); i++) {
+			BVH node = task_nodes[i];
+			if (node.face_count == 0) {
+				node.index += offset;
+			}
+			r_nodes.push_back(node);
+		}
+		return;
+	}
 
-	} else {
-		p_bvh_array[p_idx].left = -1;
+	int idx = r_nodes.size();
+	r_nodes.push_back(BVH());
+	r_nodes[idx].aabb = top.aabb;
+	_emit_bvh_top(p_top, top.left, r_nodes);
+	r_nodes[idx].index = r_nodes.size();
+	_emit_bvh_top(p_top, top.right, r_nodes);
+}
+
+bool GodotConcavePolygonShape3D::_load_bvh_data(const PackedByteArray &p_data, const Vector<Vector3> &p_faces) {
+	int face_count = p_faces.size() / 3;
+
+	if (p_data.size() < (int)sizeof(BVHDataHeader)) {
+		return false;
+	}
+	BVHDataHeader header;
+	memcpy(&header, p_data.ptr(), sizeof(BVHDataHeader));
+	if (header.version != BVH_DATA_VERSION || header.real_size != sizeof(real_t) || header.face_count != (uint32_t)face_count || header.node_count == 0) {
+		return false;
+	}
+	if (p_data.size() != (int)(sizeof(BVHDataHeader) + header.node_count * sizeof(BVH) + header.face_count * sizeof(int))) {
+		return false;
+	}
+	// Data saved for other faces.
+	if (header.faces_hash != hash_murmur3_buffer(p_faces.ptr(), p_faces.size() * sizeof(Vector3))) {
+		return false;
 	}
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
+	const uint8_t *r = p_data.ptr() + sizeof(BVHDataHeader);
+	bvh.resize(header.node_count);
+	memcpy(bvh.ptrw(), r, header.node_count * sizeof(BVH));
+	face_order.resize(face_count);
+	memcpy(face_order.ptrw(), r + header.node_count * sizeof(BVH), face_count * sizeof(int));
 
-	} else {
-		p_bvh_array[p_idx].right = -1;
+	// Check the tree can be walked like the queries do, and covers every face once.
+	const BVH *nodes = bvh.ptr();
+	int node_count = header.node_count;
+	int stack[BVH_MAX_DEPTH];
+	int stack_size = 0;
+	int idx = 0;
+	int visited = 0;
+	int next_face = 0;
+	while (true) {
+		visited++;
+		const BVH &node = nodes[idx];
+		if (node.face_count == 0) {
+			if (stack_size == BVH_MAX_DEPTH || idx + 1 >= node_count || node.index <= idx + 1 || node.index >= node_count) {
+				return false;
+			}
+			stack[stack_size++] = node.index;
+			idx++;
+			continue;
+		}
+		if (node.face_count < 0 || node.index != next_face || node.index + node.face_count > face_count) {
+			return false;
+		}
+		next_face += node.face_count;
+
+		if (stack_size == 0) {
+			break;
+		}
+		idx = stack[--stack_size];
+	}
+	if (visited != node_count || next_face != face_count) {
+		return false;
 	}
 
-	memdelete(p_bvh_tree);
+	LocalVector<uint8_t> used;
+	used.resize(face_count);
+	memset(used.ptr(), 0, face_count);
+	const int *order = face_order.ptr();
+	for (int i = 0; i < face_count; i++) {
+		if (order[i] < 0 || order[i] >= face_count || used[order[i]]) {
+			return false;
+		}
+		used[order[i]] = 1;
+	}
+
+	return true;
 }
 
-void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
+PackedByteArray GodotConcavePolygonShape3D::_save_bvh_data() const {
+	PackedByteArray data;
+	if (bvh.is_empty()) {
+		return data;
+	}
+
+	BVHDataHeader header;
+	header.face_count = faces.size();
+	header.node_count = bvh.size();
+	header.faces_hash = faces_hash;
+
+	data.resize(sizeof(BVHDataHeader) + header.node_count * sizeof(BVH) + header.face_count * sizeof(int));
+	uint8_t *w = data.ptrw();
+	memcpy(w, &header, sizeof(BVHDataHeader));
+	w += sizeof(BVHDataHeader);
+	memcpy(w, bvh.ptr(), header.node_count * sizeof(BVH));
+	w += header.node_count * sizeof(BVH);
+	memcpy(w, face_order.ptr(), header.face_count * sizeof(int));
+
+	return data;
+}
+
+void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision, const PackedByteArray &p_bvh_data) {
+	faces.clear();
+	vertices.clear();
+	face_order.clear();
+	bvh.clear();
+	faces_hash = 0;
+
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
 		configure(AABB());
@@ -1551,28 +1758,65 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 	ERR_FAIL_COND(src_face_count % 3);
 	src_face_count /= 3;
 
+	faces_hash = hash_murmur3_buffer(p_faces.ptr(), p_faces.size() * sizeof(Vector3));
+
 	const Vector3 *facesr = p_faces.ptr();
 
-	Vector<_Volume_BVH_Element> bvh_array;
-	bvh_array.resize(src_face_count);
+	// A saved BVH is only used when it was built for the same faces with the same precision, otherwise it's rebuilt.
+	if (p_bvh_data.is_empty() || !_load_bvh_data(p_bvh_data, p_faces)) {
+		LocalVector<_Volume_BVH_Element> elements;
+		elements.resize(src_face_count);
+		for (int i = 0; i < src_face_count; i++) {
+			Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
+			elements[i].aabb = face.get_aabb();
+			elements[i].center = elements[i].aabb.get_center();
+			elements[i].face_index = i;
+		}
+
+		LocalVector<BVH> nodes;
+		nodes.reserve(src_face_count * 2 / BVH_LEAF_FACES + 1);
+
+		if (src_face_count >= BVH_THREADING_THRESHOLD) {
+			// Split the top of the tree until there is enough work for every thread, and build the subtrees in parallel.
+			int task_size = MAX(src_face_count / (WorkerThreadPool::get_singleton()->get_thread_count() * 4), (int)BVH_LEAF_FACES);
+
+			_build_elements = elements.ptr();
+			LocalVector<BVHBuildTopNode> top;
+			_split_bvh_top(0, src_face_count, 0, task_size, top);
+
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotConcavePolygonShape3D::_build_bvh_task, nullptr, _build_tasks.size(), -1, true, SNAME("ConcavePolygonShape3DBuildBVH"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+			_emit_bvh_top(top, 0, nodes);
+
+			_build_tasks.clear();
+			_build_elements = nullptr;
+		} else {
+			_build_bvh(elements.ptr(), 0, src_face_count, 0, nodes);
+		}
 
-	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
+		bvh.resize(nodes.size());
+		memcpy(bvh.ptrw(), nodes.ptr(), nodes.size() * sizeof(BVH));
 
+		face_order.resize(src_face_count);
+		int *order = face_order.ptrw();
+		for (int i = 0; i < src_face_count; i++) {
+			order[i] = elements[i].face_index;
+		}
+	}
+
+	// Store the faces in the order of the leaves, so the faces of a leaf are next to each other in memory.
 	faces.resize(src_face_count);
 	Face *facesw = faces.ptrw();
 
 	vertices.resize(src_face_count * 3);
-
 	Vector3 *verticesw = vertices.ptrw();
 
-	AABB _aabb;
-
+	const int *order = face_order.ptr();
 	for (int i = 0; i < src_face_count; i++) {
-		Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
+		int src = order[i];
+		Face3 face(facesr[src * 3 + 0], facesr[src * 3 + 1], facesr[src * 3 + 2]);
 
-		bvh_arrayw[i].aabb = face.get_aabb();
-		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
-		bvh_arrayw[i].face_index = i;
 		facesw[i].indices[0] = i * 3 + 0;
 		facesw[i].indices[1] = i * 3 + 1;
 		facesw[i].indices[2] = i * 3 + 2;
@@ -1580,39 +1824,25 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		verticesw[i * 3 + 0] = face.vertex[0];
 		verticesw[i * 3 + 1] = face.vertex[1];
 		verticesw[i * 3 + 2] = face.vertex[2];
-		if (i == 0) {
-			_aabb = bvh_arrayw[i].aabb;
-		} else {
-			_aabb.merge_with(bvh_arrayw[i].aabb);
-		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
-
-	bvh.resize(count + 1);
-
-	BVH *bvh_arrayw2 = bvh.ptrw();
-
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
-
 	backface_collision = p_backface_collision;
 
-	configure(_aabb); // this type of shape has no margin
+	configure(bvh[0].aabb); // this type of shape has no margin
 }
 
 void GodotConcavePolygonShape3D::set_data(const Variant &p_data) {
 	Dictionary d = p_data;
 	ERR_FAIL_COND(!d.has("faces"));
 
-	_setup(d["faces"], d["backface_collision"]);
+	_setup(d["faces"], d["backface_collision"], d.get("bvh", PackedByteArray()));
 }
 
 Variant GodotConcavePolygonShape3D::get_data() const {
 	Dictionary d;
 	d["faces"] = get_faces();
 	d["backface_collision"] = backface_collision;
+	d["bvh"] = _save_bvh_data();
 
 	return d;
 }
@@ -1700,24 +1930,27 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
-
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
+_FORCE_INLINE_ void _heightmap_grid_segment_range(const _HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state, Vector3 &r_enter_pos, Vector3 &r_exit_pos) {
 	if (p_state.length_flat > CMP_EPSILON) {
 		real_t flat_to_3d = p_state.length / p_state.length_flat;
 		real_t enter_param = p_state.prev_dist * flat_to_3d;
 		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
+		r_enter_pos = p_params.from + p_params.dir * enter_param;
+		r_exit_pos = p_params.from + p_params.dir * exit_param;
 	} else {
 		// Consider the ray vertical.
 		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
+		r_enter_pos = p_params.from;
+		r_exit_pos = p_params.to;
 	}
+}
+
+_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
+	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
+
+	Vector3 enter_pos;
+	Vector3 exit_pos;
+	_heightmap_grid_segment_range(p_params, p_state, enter_pos, exit_pos);
 
 	// Transform positions to heightmap space.
 	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
@@ -1735,6 +1968,32 @@ _FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p
 	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
 }
 
+_FORCE_INLINE_ bool _heightmap_region_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
+	const GodotHeightMapShape3D::Range &region = p_params.heightmap->_get_bounds_region(p_state.x, p_state.z);
+
+	Vector3 enter_pos;
+	Vector3 exit_pos;
+	_heightmap_grid_segment_range(p_params, p_state, enter_pos, exit_pos);
+
+	// Transform positions to chunk space.
+	enter_pos *= GodotHeightMapShape3D::BOUNDS_REGION_SIZE;
+	exit_pos *= GodotHeightMapShape3D::BOUNDS_REGION_SIZE;
+
+	const real_t enter_height = enter_pos.y * GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+	const real_t exit_height = exit_pos.y * GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+	if ((enter_height > region.max) && (exit_height > region.max)) {
+		return false;
+	}
+	if ((enter_height < region.min) && (exit_height < region.min)) {
+		return false;
+	}
+
+	// Chunks are cells of the grid, so the grid is given one more line of points than there are chunks.
+	const GodotHeightMapShape3D *heightmap = p_params.heightmap;
+	Vector3 chunk_offset = heightmap->local_origin / GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+	return heightmap->_intersect_grid_segment(_heightmap_chunk_cull_segment, enter_pos, exit_pos, heightmap->bounds_grid_width + 1, heightmap->bounds_grid_depth + 1, chunk_offset, p_params.result, p_params.normal);
+}
+
 template <typename ProcessFunction>
 bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const {
 	Vector3 delta = (p_end - p_begin);
@@ -1918,15 +2177,23 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 	} else {
 		Vector3 ray_diff = (p_end - p_begin);
 		real_t length_flat_sqr = ray_diff.x * ray_diff.x + ray_diff.z * ray_diff.z;
+		const real_t region_cells = BOUNDS_CHUNK_SIZE * BOUNDS_REGION_SIZE;
 		if (length_flat_sqr < BOUNDS_CHUNK_SIZE * BOUNDS_CHUNK_SIZE) {
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
-		} else {
+		} else if (bounds_region_grid.is_empty() || length_flat_sqr < region_cells * region_cells) {
 			// The ray is long, run raycast on a higher-level grid.
+			// Chunks are cells of that grid, hence the extra line of points.
 			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
 			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
 			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_grid_width, bounds_grid_depth, bounds_offset, r_point, r_normal);
+			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_grid_width + 1, bounds_grid_depth + 1, bounds_offset, r_point, r_normal);
+		} else {
+			// The ray crosses several regions, skip the ones it passes over or under before looking at their chunks.
+			Vector3 region_from = p_begin / region_cells;
+			Vector3 region_to = p_end / region_cells;
+			Vector3 region_offset = local_origin / region_cells;
+			return _intersect_grid_segment(_heightmap_region_cull_segment, region_from, region_to, bounds_region_grid_width + 1, bounds_region_grid_depth + 1, region_offset, r_point, r_normal);
 		}
 	}
 
@@ -1982,27 +2249,57 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	int start_z = MAX(0, aabb_min[2]);
 	int end_z = MIN(depth - 1, aabb_max[2]);
 
+	if (start_x >= end_x || start_z >= end_z) {
+		return;
+	}
+
 	GodotFaceShape3D face;
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+	const real_t aabb_min_height = local_aabb.position.y;
+	const real_t aabb_max_height = local_aabb.position.y + local_aabb.size.y;
+
+	// Go through the cells one chunk at a time, so whole chunks the AABB passes over or under are skipped.
+	int chunk_size = bounds_grid.is_empty() ? MAX(width, depth) : BOUNDS_CHUNK_SIZE;
+	int start_chunk_x = start_x / chunk_size;
+	int end_chunk_x = (end_x - 1) / chunk_size;
+	int start_chunk_z = start_z / chunk_size;
+	int end_chunk_z = (end_z - 1) / chunk_size;
+
+	for (int cz = start_chunk_z; cz <= end_chunk_z; cz++) {
+		for (int cx = start_chunk_x; cx <= end_chunk_x; cx++) {
+			if (!bounds_grid.is_empty()) {
+				const Range &chunk = _get_bounds_chunk(cx, cz);
+				if (chunk.max < aabb_min_height || chunk.min > aabb_max_height) {
+					continue;
+				}
 			}
 
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			int chunk_start_z = MAX(start_z, cz * chunk_size);
+			int chunk_end_z = MIN(end_z, (cz + 1) * chunk_size);
+			int chunk_start_x = MAX(start_x, cx * chunk_size);
+			int chunk_end_x = MIN(end_x, (cx + 1) * chunk_size);
+
+			for (int z = chunk_start_z; z < chunk_end_z; z++) {
+				for (int x = chunk_start_x; x < chunk_end_x; x++) {
+					// First triangle.
+					_get_point(x, z, face.vertex[0]);
+					_get_point(x + 1, z, face.vertex[1]);
+					_get_point(x, z + 1, face.vertex[2]);
+					face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+					if (p_callback(p_userdata, &face)) {
+						return;
+					}
+
+					// Second triangle.
+					face.vertex[0] = face.vertex[1];
+					_get_point(x + 1, z + 1, face.vertex[1]);
+					face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+					if (p_callback(p_userdata, &face)) {
+						return;
+					}
+				}
 			}
 		}
 	}
@@ -2020,6 +2317,9 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
+	bounds_region_grid.clear();
+	bounds_region_grid_width = 0;
+	bounds_region_grid_depth = 0;
 
 	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
 	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
@@ -2041,11 +2341,27 @@ void GodotHeightMapShape3D::_build_accelerator() {
 
 	bounds_grid.resize(bound_grid_size);
 
-	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
+	bounds_region_grid_width = (bounds_grid_width + BOUNDS_REGION_SIZE - 1) / BOUNDS_REGION_SIZE;
+	bounds_region_grid_depth = (bounds_grid_depth + BOUNDS_REGION_SIZE - 1) / BOUNDS_REGION_SIZE;
+
+	uint32_t bound_region_grid_size = (uint32_t)(bounds_region_grid_width * bounds_region_grid_depth);
+	if (bound_region_grid_size < 2) {
+		// Chunks are enough.
+		bounds_region_grid_width = 0;
+		bounds_region_grid_depth = 0;
+	} else {
+		bounds_region_grid.resize(bound_region_grid_size);
+	}
+
+	_update_bounds(0, 0, bounds_grid_width, bounds_grid_depth);
+}
+
+void GodotHeightMapShape3D::_update_bounds(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	// Compute min and max height for the given chunks.
+	for (int cz = p_from_z; cz < p_to_z; ++cz) {
 		int z0 = cz * BOUNDS_CHUNK_SIZE;
 
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
+		for (int cx = p_from_x; cx < p_to_x; ++cx) {
 			int x0 = cx * BOUNDS_CHUNK_SIZE;
 
 			Range r;
@@ -2085,6 +2401,66 @@ void GodotHeightMapShape3D::_build_accelerator() {
 			bounds_grid[cx + cz * bounds_grid_width] = r;
 		}
 	}
+
+	if (bounds_region_grid.is_empty()) {
+		return;
+	}
+
+	// Then for the regions containing them, which already include the extra cell through their chunks.
+	int region_from_x = p_from_x / BOUNDS_REGION_SIZE;
+	int region_from_z = p_from_z / BOUNDS_REGION_SIZE;
+	int region_to_x = (p_to_x + BOUNDS_REGION_SIZE - 1) / BOUNDS_REGION_SIZE;
+	int region_to_z = (p_to_z + BOUNDS_REGION_SIZE - 1) / BOUNDS_REGION_SIZE;
+
+	for (int rz = region_from_z; rz < region_to_z; ++rz) {
+		int cz0 = rz * BOUNDS_REGION_SIZE;
+		int cz_max = MIN(cz0 + BOUNDS_REGION_SIZE, bounds_grid_depth);
+
+		for (int rx = region_from_x; rx < region_to_x; ++rx) {
+			int cx0 = rx * BOUNDS_REGION_SIZE;
+			int cx_max = MIN(cx0 + BOUNDS_REGION_SIZE, bounds_grid_width);
+
+			Range r = _get_bounds_chunk(cx0, cz0);
+			for (int cz = cz0; cz < cz_max; ++cz) {
+				for (int cx = cx0; cx < cx_max; ++cx) {
+					const Range &chunk = _get_bounds_chunk(cx, cz);
+					r.min = MIN(r.min, chunk.min);
+					r.max = MAX(r.max, chunk.max);
+				}
+			}
+
+			bounds_region_grid[rx + rz * bounds_region_grid_width] = r;
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_update_region(const Rect2i &p_region, const Vector<real_t> &p_heights, real_t p_min_height, real_t p_max_height) {
+	real_t *w = heights.ptrw();
+	const real_t *r = p_heights.ptr();
+	for (int z = 0; z < p_region.size.y; ++z) {
+		memcpy(&w[(p_region.position.y + z) * width + p_region.position.x], &r[z * p_region.size.x], p_region.size.x * sizeof(real_t));
+	}
+
+	if (!bounds_grid.is_empty()) {
+		// Chunks share their last line of points with the next ones.
+		int from_x = MAX(p_region.position.x - 1, 0) / BOUNDS_CHUNK_SIZE;
+		int from_z = MAX(p_region.position.y - 1, 0) / BOUNDS_CHUNK_SIZE;
+		int to_x = MIN((p_region.get_end().x - 1) / BOUNDS_CHUNK_SIZE + 1, bounds_grid_width);
+		int to_z = MIN((p_region.get_end().y - 1) / BOUNDS_CHUNK_SIZE + 1, bounds_grid_depth);
+		_update_bounds(from_x, from_z, to_x, to_z);
+	}
+
+	// The AABB only grows, so bodies aren't moved around the broadphase when terrain is dug into.
+	AABB aabb = get_aabb();
+	real_t aabb_min_height = aabb.position.y;
+	real_t aabb_max_height = aabb.position.y + aabb.size.y;
+	if (p_min_height < aabb_min_height || p_max_height > aabb_max_height) {
+		aabb_min_height = MIN(aabb_min_height, p_min_height);
+		aabb_max_height = MAX(aabb_max_height, p_max_height);
+		aabb.position.y = aabb_min_height;
+		aabb.size.y = aabb_max_height - aabb_min_height;
+		configure(aabb);
+	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
@@ -2161,9 +2537,9 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 		min_height = d["min_height"];
 		max_height = d["max_height"];
 	} else {
-		int heights_size = heights.size();
+		int heights_size = heights_buffer.size();
 		for (int i = 0; i < heights_size; ++i) {
-			real_t h = heights[i];
+			real_t h = heights_buffer[i];
 			if (h < min_height) {
 				min_height = h;
 			} else if (h > max_height) {
@@ -2174,6 +2550,18 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 
 	ERR_FAIL_COND(min_height > max_height);
 
+	if (d.has("region")) {
+		// Only a part of the heights is given, the rest of the shape is kept as is.
+		Rect2i region = d["region"];
+		ERR_FAIL_COND_MSG(width != this->width || depth != this->depth, "Heights can only be updated by region when the size of the heightmap doesn't change.");
+		ERR_FAIL_COND(region.position.x < 0 || region.position.y < 0 || region.size.x <= 0 || region.size.y <= 0);
+		ERR_FAIL_COND(region.get_end().x > width || region.get_end().y > depth);
+		ERR_FAIL_COND(heights_buffer.size() != (region.size.x * region.size.y));
+
+		_update_region(region, heights_buffer, min_height, max_height);
+		return;
+	}
+
 	ERR_FAIL_COND(heights_buffer.size() != (width * depth));
 
 	// If specified, min and max height will be used as precomputed values.
@@ -300,7 +300,7 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
+struct _Volume_BVH_Element;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -311,19 +311,38 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		int indices[3] = {};
 	};
 
+	// Faces are stored in the order of the BVH leaves.
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
+	Vector<int> face_order; // Index of each face in the data the shape was set up with.
+	uint32_t faces_hash = 0;
 
+	// Nodes are laid out depth-first, so the first child of an internal node always follows it.
 	struct BVH {
 		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		int index = 0; // Second child of internal nodes, first face of leaves.
+		int face_count = 0; // 0 for internal nodes.
 	};
 
 	Vector<BVH> bvh;
 
+	enum {
+		BVH_LEAF_FACES = 4,
+		BVH_SAH_BINS = 16,
+		BVH_MAX_DEPTH = 64,
+		BVH_THREADING_THRESHOLD = 65536,
+		BVH_DATA_VERSION = 1,
+	};
+
+	// Header of the serialized BVH, followed by the nodes and the face order.
+	struct BVHDataHeader {
+		uint32_t version = BVH_DATA_VERSION;
+		uint32_t real_size = sizeof(real_t);
+		uint32_t face_count = 0;
+		uint32_t node_count = 0;
+		uint32_t faces_hash = 0;
+	};
+
 	struct _CullParams {
 		AABB aabb;
 		QueryCallback callback = nullptr;
@@ -351,12 +370,36 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	void _cull_segment(_SegmentCullParams *p_params) const;
+	bool _cull(_CullParams *p_params) const;
+
+	static void _build_bvh(_Volume_BVH_Element *p_elements, int p_from, int p_to, int p_depth, LocalVector<BVH> &r_nodes);
+
+	struct BVHBuildTask {
+		int from = 0;
+		int to = 0;
+		int depth = 0;
+		LocalVector<BVH> nodes;
+	};
+
+	struct BVHBuildTopNode {
+		AABB aabb;
+		int left = -1;
+		int right = -1;
+		int task = -1;
+	};
+
+	_Volume_BVH_Element *_build_elements = nullptr;
+	LocalVector<BVHBuildTask> _build_tasks;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	int _split_bvh_top(int p_from, int p_to, int p_depth, int p_task_size, LocalVector<BVHBuildTopNode> &r_top);
+	void _emit_bvh_top(const LocalVector<BVHBuildTopNode> &p_top, int p_top_index, LocalVector<BVH> &r_nodes);
+	void _build_bvh_task(uint32_t p_index, void *p_userdata);
 
-	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
+	bool _load_bvh_data(const PackedByteArray &p_data, const Vector<Vector3> &p_faces);
+	PackedByteArray _save_bvh_data() const;
+
+	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision, const PackedByteArray &p_bvh_data = PackedByteArray());
 
 public:
 	Vector<Vector3> get_faces() const;
@@ -395,12 +438,22 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	int bounds_grid_width = 0;
 	int bounds_grid_depth = 0;
 
+	// Coarser level over the chunks, for long rays on big terrains.
+	LocalVector<Range> bounds_region_grid;
+	int bounds_region_grid_width = 0;
+	int bounds_region_grid_depth = 0;
+
 	static const int BOUNDS_CHUNK_SIZE = 16;
+	static const int BOUNDS_REGION_SIZE = 16; // In chunks.
 
 	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
 		return bounds_grid[(p_z * bounds_grid_width) + p_x];
 	}
 
+	_FORCE_INLINE_ const Range &_get_bounds_region(int p_x, int p_z) const {
+		return bounds_region_grid[(p_z * bounds_region_grid_width) + p_x];
+	}
+
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
 		return heights[(p_z * width) + p_x];
 	}
@@ -414,6 +467,8 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
 	void _build_accelerator();
+	void _update_bounds(int p_from_x, int p_from_z, int p_to_x, int p_to_z);
+	void _update_region(const Rect2i &p_region, const Vector<real_t> &p_heights, real_t p_min_height, real_t p_max_height);
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
@@ -589,6 +590,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	color_links();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -827,6 +829,57 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::color_links() {
+	// Greedy coloring: each link gets the first color neither of its nodes has yet.
+	// The order of the links in each color is kept.
+	uint32_t link_count = links.size();
+
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	for (uint32_t i = 0; i < nodes.size(); ++i) {
+		node_colors[i] = 0;
+	}
+
+	LocalVector<uint32_t> link_colors;
+	link_colors.resize(link_count);
+
+	link_color_offsets.resize(MAX_LINK_COLORS + 2);
+	for (uint32_t i = 0; i < link_color_offsets.size(); ++i) {
+		link_color_offsets[i] = 0;
+	}
+
+	for (uint32_t i = 0; i < link_count; ++i) {
+		uint32_t node_a = links[i].n[0]->index;
+		uint32_t node_b = links[i].n[1]->index;
+
+		uint64_t used = node_colors[node_a] | node_colors[node_b];
+		uint32_t color = MAX_LINK_COLORS;
+		if (used != UINT64_MAX) {
+			color = 0;
+			while (used & (uint64_t(1) << color)) {
+				color++;
+			}
+			node_colors[node_a] |= uint64_t(1) << color;
+			node_colors[node_b] |= uint64_t(1) << color;
+		}
+
+		link_colors[i] = color;
+		link_color_offsets[color + 1]++;
+	}
+
+	for (uint32_t i = 1; i < link_color_offsets.size(); ++i) {
+		link_color_offsets[i] += link_color_offsets[i - 1];
+	}
+
+	LocalVector<uint32_t> write_offsets = link_color_offsets;
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	for (uint32_t i = 0; i < link_count; ++i) {
+		sorted_links[write_offsets[link_colors[i]]++] = links[i];
+	}
+	links = sorted_links;
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -1066,7 +1119,7 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node_aabb.expand_to(node.x + node.v * p_delta);
 		node_aabb.grow_by(collision_margin);
 
-		node_tree.update(node.leaf, node_aabb);
+		node_tree.update_deferred(node.leaf, node_aabb);
 	}
 
 	// Face tree update.
@@ -1074,14 +1127,17 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		update_face_tree(p_delta);
 	}
 
-	// Optimize node tree.
-	node_tree.optimize_incremental(1);
-	face_tree.optimize_incremental(1);
+	// Refit and optimize trees, most nodes move every step.
+	node_tree.refit(1);
+	face_tree.refit(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_use_threads) {
 	const real_t inv_delta = 1.0 / p_delta;
 
+	// Only worth the task overhead for large bodies.
+	p_use_threads = p_use_threads && links.size() >= LINK_THREADING_THRESHOLD;
+
 	uint32_t i, ni;
 
 	for (i = 0, ni = links.size(); i < ni; ++i) {
@@ -1099,7 +1155,7 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	// Solve positions.
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
 		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+		solve_links(1.0, ti, p_use_threads);
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
 	for (i = 0, ni = nodes.size(); i < ni; ++i) {
@@ -1116,8 +1172,39 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	update_normals_and_centroids();
 }
 
-void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (uint32_t i = 0, ni = links.size(); i < ni; ++i) {
+void GodotSoftBody3D::solve_links(real_t kst, real_t ti, bool p_use_threads) {
+	uint32_t link_count = links.size();
+	if (!p_use_threads || link_color_offsets.is_empty() || link_color_offsets[link_color_offsets.size() - 1] != link_count) {
+		_solve_link_range(0, link_count, kst);
+		return;
+	}
+
+	for (uint32_t color = 0; color < MAX_LINK_COLORS; ++color) {
+		LinkRange range;
+		range.from = link_color_offsets[color];
+		range.to = link_color_offsets[color + 1];
+		range.kst = kst;
+
+		uint32_t chunk_count = (range.to - range.from + LINK_CHUNK_SIZE - 1) / LINK_CHUNK_SIZE;
+		if (chunk_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_links_chunk, &range, chunk_count, -1, true, SNAME("Physics3DSoftBodyLinks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_solve_link_range(range.from, range.to, kst);
+		}
+	}
+
+	// Links that didn't get a color.
+	_solve_link_range(link_color_offsets[MAX_LINK_COLORS], link_count, kst);
+}
+
+void GodotSoftBody3D::_solve_links_chunk(uint32_t p_chunk, LinkRange *p_range) {
+	uint32_t from = p_range->from + p_chunk * LINK_CHUNK_SIZE;
+	_solve_link_range(from, MIN(from + LINK_CHUNK_SIZE, p_range->to), p_range->kst);
+}
+
+void GodotSoftBody3D::_solve_link_range(uint32_t p_from, uint32_t p_to, real_t kst) {
+	for (uint32_t i = p_from; i < p_to; ++i) {
 		Link &link = links[i];
 		if (link.c0 > 0) {
 			Node &node_a = *link.n[0];
@@ -1212,7 +1299,7 @@ void GodotSoftBody3D::update_face_tree(real_t p_delta) {
 
 		face_aabb.grow_by(collision_margin);
 
-		face_tree.update(face.leaf, face_aabb);
+		face_tree.update_deferred(face.leaf, face_aabb);
 	}
 }
 
@@ -1244,6 +1331,7 @@ void GodotSoftBody3D::destroy() {
 
 	nodes.clear();
 	links.clear();
+	link_color_offsets.clear();
 	faces.clear();
 
 	bounds = AABB();
@@ -82,6 +82,22 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	enum {
+		MAX_LINK_COLORS = 64, // Links that don't fit in these are solved serially, after the others.
+		LINK_CHUNK_SIZE = 256, // Links per task when a color is solved in parallel.
+		LINK_THREADING_THRESHOLD = 8192, // Minimum link count to solve colors in parallel.
+	};
+
+	struct LinkRange {
+		uint32_t from = 0;
+		uint32_t to = 0;
+		real_t kst = 0.0;
+	};
+
+	// Links are sorted by color, so that all the links in a color share no node and can be solved in parallel.
+	// Color i covers links link_color_offsets[i] to link_color_offsets[i + 1].
+	LocalVector<uint32_t> link_color_offsets;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -202,7 +218,7 @@ public:
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
 	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	void solve_constraints(real_t p_delta, bool p_use_threads = false);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -234,10 +250,13 @@ private:
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void color_links();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
-	void solve_links(real_t kst, real_t ti);
+	void solve_links(real_t kst, real_t ti, bool p_use_threads);
+	void _solve_link_range(uint32_t p_from, uint32_t p_to, real_t kst);
+	void _solve_links_chunk(uint32_t p_chunk, LinkRange *p_range);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
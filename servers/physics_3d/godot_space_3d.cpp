@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
@@ -108,14 +109,18 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+
+	return _intersect_ray_results(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_results(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -124,22 +129,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_objects[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_subindices[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -212,29 +217,33 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 
 	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
 
+	return _intersect_shape_results(p_parameters, p_parameters.transform, shape, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_results, p_result_max);
+}
+
+int GodotPhysicsDirectSpaceState3D::_intersect_shape_results(const ShapeParameters &p_parameters, const Transform3D &p_transform, const GodotShape3D *p_shape, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, ShapeResult *r_results, int p_result_max) {
 	int cc = 0;
 
 	//Transform3D ai = p_xform.affine_inverse();
 
-	for (int i = 0; i < amount; i++) {
+	for (int i = 0; i < p_amount; i++) {
 		if (cc >= p_result_max) {
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
+		int shape_idx = p_subindices[i];
 
-		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
+		if (!GodotCollisionSolver3D::solve_static(p_shape, p_transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
 		}
 
@@ -255,6 +264,92 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+void GodotPhysicsDirectSpaceState3D::_intersect_rays_chunk(uint32_t p_chunk, RayBatch *p_batch) {
+	int from = p_chunk * QUERY_BATCH_CHUNK_SIZE;
+	int to = MIN(from + QUERY_BATCH_CHUNK_SIZE, p_batch->count);
+
+	GodotBroadPhase3D::CullScratch scratch;
+	LocalVector<GodotCollisionObject3D *> objects;
+	objects.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> subindices;
+	subindices.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+	for (int i = from; i < to; i++) {
+		int amount = space->broadphase->cull_segment_concurrent(p_batch->from[i], p_batch->to[i], objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, scratch, subindices.ptr());
+		p_batch->collided[i] = _intersect_ray_results(*p_batch->parameters, p_batch->from[i], p_batch->to[i], objects.ptr(), subindices.ptr(), amount, p_batch->results[i]);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_collided) {
+	ERR_FAIL_COND(space->locked);
+
+	if (p_count <= 0) {
+		return;
+	}
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.collided = r_collided;
+
+	// The broadphase isn't modified until the calling thread resumes, so the queries can run side by side.
+	int chunk_count = (p_count + QUERY_BATCH_CHUNK_SIZE - 1) / QUERY_BATCH_CHUNK_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_rays_chunk, &batch, chunk_count, -1, true, SNAME("Physics3DRayQueries"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_shapes_chunk(uint32_t p_chunk, ShapeBatch *p_batch) {
+	int from = p_chunk * QUERY_BATCH_CHUNK_SIZE;
+	int to = MIN(from + QUERY_BATCH_CHUNK_SIZE, p_batch->count);
+
+	GodotBroadPhase3D::CullScratch scratch;
+	LocalVector<GodotCollisionObject3D *> objects;
+	objects.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> subindices;
+	subindices.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+	AABB shape_aabb = p_batch->shape->get_aabb();
+
+	for (int i = from; i < to; i++) {
+		const Transform3D &transform = p_batch->transforms[i];
+		int amount = space->broadphase->cull_aabb_concurrent(transform.xform(shape_aabb), objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, scratch, subindices.ptr());
+		p_batch->result_counts[i] = _intersect_shape_results(*p_batch->parameters, transform, p_batch->shape, objects.ptr(), subindices.ptr(), amount, p_batch->results + i * p_batch->result_max, p_batch->result_max);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ERR_FAIL_COND(space->locked);
+
+	if (p_count <= 0) {
+		return;
+	}
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	if (!shape || p_result_max <= 0) {
+		for (int i = 0; i < p_count; i++) {
+			r_result_counts[i] = 0;
+		}
+		ERR_FAIL_COND(!shape);
+		return;
+	}
+
+	ShapeBatch batch;
+	batch.parameters = &p_parameters;
+	batch.shape = shape;
+	batch.transforms = p_transforms;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+
+	int chunk_count = (p_count + QUERY_BATCH_CHUNK_SIZE - 1) / QUERY_BATCH_CHUNK_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_shapes_chunk, &batch, chunk_count, -1, true, SNAME("Physics3DShapeQueries"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
 	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_COND_V(!shape, false);
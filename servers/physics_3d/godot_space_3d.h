@@ -46,6 +46,35 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	enum {
+		QUERY_BATCH_CHUNK_SIZE = 64 // Queries of a batch run by each task.
+	};
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		bool *collided = nullptr;
+	};
+
+	struct ShapeBatch {
+		const ShapeParameters *parameters = nullptr;
+		const GodotShape3D *shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		int count = 0;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+	};
+
+	bool _intersect_ray_results(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result);
+	int _intersect_shape_results(const ShapeParameters &p_parameters, const Transform3D &p_transform, const GodotShape3D *p_shape, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, ShapeResult *r_results, int p_result_max);
+
+	void _intersect_rays_chunk(uint32_t p_chunk, RayBatch *p_batch);
+	void _intersect_shapes_chunk(uint32_t p_chunk, ShapeBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -57,6 +86,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
 
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_collided) override;
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
+
 	GodotPhysicsDirectSpaceState3D();
 };
 
@@ -33,6 +33,7 @@
 #include "godot_joint_3d.h"
 
 #include "core/os/os.h"
+#include "core/os/profiling.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
 #define BODY_ISLAND_SIZE_RESERVE 512
@@ -157,6 +158,10 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_solve_soft_body(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -182,6 +187,8 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 }
 
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
+	PROFILE_ZONE("GodotStep3D::step");
+
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -343,8 +350,14 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_contraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_contraint, nullptr, total_contraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	if (deterministic) {
+		for (uint32_t constraint_index = 0; constraint_index < total_contraint_count; ++constraint_index) {
+			_setup_contraint(constraint_index);
+		}
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_contraint, nullptr, total_contraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -363,8 +376,14 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	if (deterministic) {
+		for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+			_solve_island(island_index);
+		}
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -391,10 +410,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->solve_constraints(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 	}
 
+	// Soft bodies only touch their own nodes here, so they can be solved side by side.
+	// A lone soft body is solved from this thread instead, spreading its links over the workers.
+	uint32_t soft_body_count = active_soft_bodies.size();
+	if (deterministic || soft_body_count == 1) {
+		for (uint32_t soft_body_index = 0; soft_body_index < soft_body_count; ++soft_body_index) {
+			active_soft_bodies[soft_body_index]->solve_constraints(p_delta, !deterministic);
+		}
+	} else if (soft_body_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body, nullptr, soft_body_count, -1, true, SNAME("Physics3DSoftBodySolve"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	active_soft_bodies.clear();
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
@@ -411,6 +444,8 @@ GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+
+	deterministic = GLOBAL_DEF("physics/3d/solver/deterministic", false);
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -42,9 +42,13 @@ class GodotStep3D {
 	int iterations = 0;
 	real_t delta = 0.0;
 
+	// Runs the constraint setup and solving on the physics thread, in island order, so thread scheduling can't affect the results.
+	bool deterministic = false;
+
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotSoftBody3D *> active_soft_bodies;
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
@@ -52,6 +56,7 @@ class GodotStep3D {
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _solve_soft_body(uint32_t p_soft_body_index, void *p_userdata = nullptr);
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
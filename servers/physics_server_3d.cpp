@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
 
 void PhysicsServer3DRenderingServerHandler::set_vertex(int p_vertex_id, const void *p_vector3) {
 	GDVIRTUAL_REQUIRED_CALL(_set_vertex, p_vertex_id, p_vector3);
@@ -456,6 +457,133 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(p_from.size() != p_to.size(), Dictionary());
+
+	int count = p_from.size();
+
+	LocalVector<RayResult> results;
+	results.resize(count);
+	LocalVector<bool> collided;
+	collided.resize(count);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptr(), collided.ptr());
+
+	PackedByteArray collided_array;
+	collided_array.resize(count);
+	PackedVector3Array positions;
+	positions.resize(count);
+	PackedVector3Array normals;
+	normals.resize(count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(count);
+	PackedInt32Array shapes;
+	shapes.resize(count);
+
+	uint8_t *collided_w = collided_array.ptrw();
+	Vector3 *positions_w = positions.ptrw();
+	Vector3 *normals_w = normals.ptrw();
+	int64_t *collider_ids_w = collider_ids.ptrw();
+	int32_t *shapes_w = shapes.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		collided_w[i] = collided[i];
+		if (collided[i]) {
+			positions_w[i] = results[i].position;
+			normals_w[i] = results[i].normal;
+			collider_ids_w[i] = results[i].collider_id;
+			shapes_w[i] = results[i].shape;
+		} else {
+			positions_w[i] = Vector3();
+			normals_w[i] = Vector3();
+			collider_ids_w[i] = 0;
+			shapes_w[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["collided"] = collided_array;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_shapes_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, int p_max_results) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(p_max_results <= 0, Dictionary());
+
+	const ShapeParameters &parameters = p_shape_query->get_parameters();
+	int count = p_origins.size();
+
+	LocalVector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms[i] = Transform3D(parameters.transform.basis, p_origins[i]);
+	}
+
+	LocalVector<ShapeResult> results;
+	results.resize(count * p_max_results);
+	LocalVector<int> result_counts;
+	result_counts.resize(count);
+
+	intersect_shapes(parameters, transforms.ptr(), count, results.ptr(), p_max_results, result_counts.ptr());
+
+	int total = 0;
+	for (int i = 0; i < count; i++) {
+		total += result_counts[i];
+	}
+
+	PackedInt32Array counts;
+	counts.resize(count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(total);
+	PackedInt32Array shapes;
+	shapes.resize(total);
+
+	int32_t *counts_w = counts.ptrw();
+	int64_t *collider_ids_w = collider_ids.ptrw();
+	int32_t *shapes_w = shapes.ptrw();
+
+	int out = 0;
+	for (int i = 0; i < count; i++) {
+		counts_w[i] = result_counts[i];
+		for (int j = 0; j < result_counts[i]; j++) {
+			const ShapeResult &result = results[i * p_max_results + j];
+			collider_ids_w[out] = result.collider_id;
+			shapes_w[out] = result.shape;
+			out++;
+		}
+	}
+
+	Dictionary d;
+	d["count"] = counts;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_collided) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_collided[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, r_results + i * p_result_max, p_result_max);
+	}
+}
+
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
@@ -463,6 +591,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_rays_batch", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays_batch);
+	ClassDB::bind_method(D_METHOD("intersect_shapes_batch", "parameters", "origins", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes_batch, DEFVAL(32));
 }
 
 ///////////////////////////////
@@ -1002,6 +1132,7 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_STATE_CHECKSUM);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
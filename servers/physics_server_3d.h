@@ -125,6 +125,8 @@ private:
 	Array _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 	Array _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	Dictionary _intersect_rays_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
+	Dictionary _intersect_shapes_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, int p_max_results = 32);
 
 protected:
 	static void _bind_methods();
@@ -202,6 +204,13 @@ public:
 
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
+	// Batched queries, which share all their parameters except where they are done. Servers can run the queries in parallel,
+	// while the default implementations run them one after the other.
+	// r_collided[i] tells whether r_results[i] is valid.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_collided);
+	// The results of query i start at r_results[i * p_result_max], and there are r_result_counts[i] of them.
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
+
 	PhysicsDirectSpaceState3D();
 };
 
@@ -798,7 +807,8 @@ public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_STATE_CHECKSUM
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
@@ -38,9 +38,114 @@ void PhysicsServer3DWrapMT::thread_exit() {
 
 void PhysicsServer3DWrapMT::thread_step(real_t p_delta) {
 	physics_server_3d->step(p_delta);
+	_publish_body_states();
 	step_sem.post();
 }
 
+void PhysicsServer3DWrapMT::thread_track_body_state(RID p_body) {
+	if (snapshot_body_indices.has(p_body)) {
+		return;
+	}
+	snapshot_body_indices.insert(p_body, snapshot_bodies.size());
+	snapshot_bodies.push_back(p_body);
+	snapshot_bodies_version++;
+}
+
+void PhysicsServer3DWrapMT::thread_untrack_body_state(RID p_body) {
+	HashMap<RID, uint32_t>::Iterator E = snapshot_body_indices.find(p_body);
+	if (!E) {
+		return;
+	}
+
+	// Move the last body in the freed slot.
+	uint32_t index = E->value;
+	uint32_t last = snapshot_bodies.size() - 1;
+	if (index != last) {
+		snapshot_bodies[index] = snapshot_bodies[last];
+		snapshot_body_indices[snapshot_bodies[index]] = index;
+	}
+	snapshot_bodies.resize(last);
+	snapshot_body_indices.remove(E);
+	snapshot_bodies_version++;
+}
+
+void PhysicsServer3DWrapMT::_publish_body_states() {
+	// The front buffer may be read by the main thread while stepping, so only write the other one.
+	BodyStateBuffer &buffer = body_state_buffers[1 - body_state_front];
+
+	if (buffer.version != snapshot_bodies_version) {
+		buffer.indices.clear();
+		for (uint32_t i = 0; i < snapshot_bodies.size(); i++) {
+			buffer.indices.insert(snapshot_bodies[i], i);
+		}
+		buffer.states.resize(snapshot_bodies.size());
+		buffer.version = snapshot_bodies_version;
+	}
+
+	for (uint32_t i = 0; i < snapshot_bodies.size(); i++) {
+		RID body = snapshot_bodies[i];
+		BodyStateSnapshot &state = buffer.states[i];
+		state.transform = physics_server_3d->body_get_state(body, BODY_STATE_TRANSFORM);
+		state.linear_velocity = physics_server_3d->body_get_state(body, BODY_STATE_LINEAR_VELOCITY);
+		state.angular_velocity = physics_server_3d->body_get_state(body, BODY_STATE_ANGULAR_VELOCITY);
+		state.sleeping = physics_server_3d->body_get_state(body, BODY_STATE_SLEEPING);
+		state.can_sleep = physics_server_3d->body_get_state(body, BODY_STATE_CAN_SLEEP);
+	}
+}
+
+bool PhysicsServer3DWrapMT::_get_body_state_snapshot(RID p_body, BodyState p_state, Variant &r_value) const {
+	// Only the main thread knows when the buffers are swapped.
+	if (!create_thread || Thread::get_caller_id() != main_thread) {
+		return false;
+	}
+
+	if (!snapshot_changed_bodies.is_empty() && snapshot_changed_bodies.has(p_body)) {
+		// The change is only in the states of the steps issued after it.
+		return false;
+	}
+
+	const BodyStateBuffer &buffer = body_state_buffers[body_state_front];
+	const uint32_t *index = buffer.indices.getptr(p_body);
+	if (!index) {
+		// Published from the next step on.
+		if (!snapshot_requested_bodies.has(p_body)) {
+			snapshot_requested_bodies.insert(p_body);
+			command_queue.push(const_cast<PhysicsServer3DWrapMT *>(this), &PhysicsServer3DWrapMT::thread_track_body_state, p_body);
+		}
+		return false;
+	}
+
+	const BodyStateSnapshot &state = buffer.states[*index];
+	switch (p_state) {
+		case BODY_STATE_TRANSFORM: {
+			r_value = state.transform;
+		} break;
+		case BODY_STATE_LINEAR_VELOCITY: {
+			r_value = state.linear_velocity;
+		} break;
+		case BODY_STATE_ANGULAR_VELOCITY: {
+			r_value = state.angular_velocity;
+		} break;
+		case BODY_STATE_SLEEPING: {
+			r_value = state.sleeping;
+		} break;
+		case BODY_STATE_CAN_SLEEP: {
+			r_value = state.can_sleep;
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void PhysicsServer3DWrapMT::_body_state_changed(RID p_body) {
+	if (create_thread && Thread::get_caller_id() == main_thread && snapshot_requested_bodies.has(p_body)) {
+		snapshot_changed_bodies[p_body] = steps_issued;
+	}
+}
+
 void PhysicsServer3DWrapMT::_thread_callback(void *_instance) {
 	PhysicsServer3DWrapMT *vsmt = reinterpret_cast<PhysicsServer3DWrapMT *>(_instance);
 
@@ -68,6 +173,7 @@ void PhysicsServer3DWrapMT::thread_loop() {
 
 void PhysicsServer3DWrapMT::step(real_t p_step) {
 	if (create_thread) {
+		steps_issued++;
 		command_queue.push(this, &PhysicsServer3DWrapMT::thread_step, p_step);
 	} else {
 		command_queue.flush_all(); //flush all pending from other threads
@@ -81,6 +187,22 @@ void PhysicsServer3DWrapMT::sync() {
 			first_frame = false;
 		} else {
 			step_sem.wait(); //must not wait if a step was not issued
+
+			// The step is done, read the states it published.
+			body_state_front = 1 - body_state_front;
+			steps_published++;
+
+			if (!snapshot_changed_bodies.is_empty()) {
+				LocalVector<RID> up_to_date;
+				for (const KeyValue<RID, uint64_t> &E : snapshot_changed_bodies) {
+					if (E.value < steps_published) {
+						up_to_date.push_back(E.key);
+					}
+				}
+				for (uint32_t i = 0; i < up_to_date.size(); i++) {
+					snapshot_changed_bodies.erase(up_to_date[i]);
+				}
+			}
 		}
 	}
 	physics_server_3d->sync();
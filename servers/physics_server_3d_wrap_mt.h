@@ -67,6 +67,44 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	Mutex alloc_mutex;
 	int pool_max_size = 0;
 
+	// Body states are published after each step, so the main thread can read them without waiting for the physics thread.
+	// The physics thread writes the back buffer while stepping, and the buffers are swapped in sync(), once the step is done.
+	struct BodyStateSnapshot {
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		bool sleeping = false;
+		bool can_sleep = true;
+	};
+
+	struct BodyStateBuffer {
+		HashMap<RID, uint32_t> indices;
+		LocalVector<BodyStateSnapshot> states;
+		uint64_t version = 0;
+	};
+
+	BodyStateBuffer body_state_buffers[2];
+	int body_state_front = 0;
+
+	// Physics thread only.
+	LocalVector<RID> snapshot_bodies;
+	HashMap<RID, uint32_t> snapshot_body_indices;
+	uint64_t snapshot_bodies_version = 0;
+
+	// Main thread only.
+	mutable HashSet<RID> snapshot_requested_bodies;
+	// Bodies changed since their last published state, with the number of steps issued before the change.
+	mutable HashMap<RID, uint64_t> snapshot_changed_bodies;
+	uint64_t steps_issued = 0;
+	uint64_t steps_published = 0;
+
+	void thread_track_body_state(RID p_body);
+	void thread_untrack_body_state(RID p_body);
+	void _publish_body_states();
+
+	bool _get_body_state_snapshot(RID p_body, BodyState p_state, Variant &r_value) const;
+	void _body_state_changed(RID p_body);
+
 public:
 #define ServerName PhysicsServer3D
 #define ServerNameWrapMT PhysicsServer3DWrapMT
@@ -171,10 +209,26 @@ public:
 	//FUNC2RID(body,BodyMode,bool);
 	FUNCRID(body)
 
-	FUNC2(body_set_space, RID, RID);
+	virtual void body_set_space(RID p_body, RID p_space) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_space, p_body, p_space);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_set_space(p_body, p_space);
+		}
+	}
 	FUNC1RC(RID, body_get_space, RID);
 
-	FUNC2(body_set_mode, RID, BodyMode);
+	virtual void body_set_mode(RID p_body, BodyMode p_mode) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_mode, p_body, p_mode);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_set_mode(p_body, p_mode);
+		}
+	}
 	FUNC1RC(BodyMode, body_get_mode, RID);
 
 	FUNC4(body_add_shape, RID, RID, const Transform3D &, bool);
@@ -210,12 +264,62 @@ public:
 
 	FUNC1(body_reset_mass_properties, RID);
 
-	FUNC3(body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, body_get_state, RID, BodyState);
+	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_value) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_state, p_body, p_state, p_value);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_set_state(p_body, p_state, p_value);
+		}
+	}
 
-	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
-	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
-	FUNC3(body_apply_impulse, RID, const Vector3 &, const Vector3 &);
+	// Reads the state published after the last step when possible, instead of waiting for the physics thread.
+	virtual Variant body_get_state(RID p_body, BodyState p_state) const override {
+		if (Thread::get_caller_id() != server_thread) {
+			Variant ret;
+			if (_get_body_state_snapshot(p_body, p_state, ret)) {
+				return ret;
+			}
+			command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::body_get_state, p_body, p_state, &ret);
+			SYNC_DEBUG
+			return ret;
+		} else {
+			command_queue.flush_if_pending();
+			return physics_server_3d->body_get_state(p_body, p_state);
+		}
+	}
+
+	// Impulses change the velocities right away.
+	virtual void body_apply_torque_impulse(RID p_body, const Vector3 &p_impulse) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_apply_torque_impulse, p_body, p_impulse);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_apply_torque_impulse(p_body, p_impulse);
+		}
+	}
+
+	virtual void body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_apply_central_impulse, p_body, p_impulse);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_apply_central_impulse(p_body, p_impulse);
+		}
+	}
+
+	virtual void body_apply_impulse(RID p_body, const Vector3 &p_impulse, const Vector3 &p_position) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_apply_impulse, p_body, p_impulse, p_position);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_apply_impulse(p_body, p_impulse, p_position);
+		}
+	}
 
 	FUNC2(body_apply_central_force, RID, const Vector3 &);
 	FUNC3(body_apply_force, RID, const Vector3 &, const Vector3 &);
@@ -231,7 +335,15 @@ public:
 	FUNC2(body_set_constant_torque, RID, const Vector3 &);
 	FUNC1RC(Vector3, body_get_constant_torque, RID);
 
-	FUNC2(body_set_axis_velocity, RID, const Vector3 &);
+	virtual void body_set_axis_velocity(RID p_body, const Vector3 &p_axis_velocity) override {
+		_body_state_changed(p_body);
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_axis_velocity, p_body, p_axis_velocity);
+		} else {
+			command_queue.flush_if_pending();
+			physics_server_3d->body_set_axis_velocity(p_body, p_axis_velocity);
+		}
+	}
 
 	FUNC3(body_set_axis_lock, RID, BodyAxis, bool);
 	FUNC2RC(bool, body_is_axis_locked, RID, BodyAxis);
@@ -374,7 +486,19 @@ public:
 
 	/* MISC */
 
-	FUNC1(free, RID);
+	virtual void free(RID p_rid) override {
+		if (Thread::get_caller_id() == main_thread) {
+			snapshot_requested_bodies.erase(p_rid);
+		}
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(this, &PhysicsServer3DWrapMT::thread_untrack_body_state, p_rid);
+			command_queue.push(physics_server_3d, &PhysicsServer3D::free, p_rid);
+		} else {
+			command_queue.flush_if_pending();
+			thread_untrack_body_state(p_rid);
+			physics_server_3d->free(p_rid);
+		}
+	}
 	FUNC1(set_active, bool);
 
 	virtual void init() override;
@@ -247,6 +247,19 @@ void register_server_types() {
 
 	GDREGISTER_VIRTUAL_CLASS(MovieWriter);
 
+	// Movie writer
+	GLOBAL_DEF("editor/movie_writer/mix_rate", 48000);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/mix_rate", PropertyInfo(Variant::INT, "editor/movie_writer/mix_rate", PROPERTY_HINT_RANGE, "8000,192000,1,suffix:Hz"));
+	GLOBAL_DEF("editor/movie_writer/speaker_mode", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/speaker_mode", PropertyInfo(Variant::INT, "editor/movie_writer/speaker_mode", PROPERTY_HINT_ENUM, "Stereo,3.1,5.1,7.1"));
+	GLOBAL_DEF("editor/movie_writer/mjpeg_quality", 0.75);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/mjpeg_quality", PropertyInfo(Variant::FLOAT, "editor/movie_writer/mjpeg_quality", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"));
+	// used by the editor
+	GLOBAL_DEF_BASIC("editor/movie_writer/movie_file", "");
+	GLOBAL_DEF_BASIC("editor/movie_writer/disable_vsync", false);
+	GLOBAL_DEF_BASIC("editor/movie_writer/fps", 60);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/movie_writer/fps", PropertyInfo(Variant::INT, "editor/movie_writer/fps", PROPERTY_HINT_RANGE, "1,300,1,suffix:FPS"));
+
 	ServersDebugger::initialize();
 
 	// Physics 2D
@@ -78,6 +78,7 @@ public:
 
 	virtual void mesh_instance_set_skeleton(RID p_mesh_instance, RID p_skeleton) override {}
 	virtual void mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int p_shape, float p_weight) override {}
+	virtual void mesh_instance_set_skinning_interval(RID p_mesh_instance, uint32_t p_interval) override {}
 	virtual void mesh_instance_check_for_update(RID p_mesh_instance) override {}
 	virtual void update_mesh_instances() override {}
 
@@ -104,8 +105,12 @@ public:
 	virtual Color multimesh_instance_get_color(RID p_multimesh, int p_index) const override { return Color(); }
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const override { return Color(); }
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) override {}
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) override {}
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const override { return Vector<float>(); }
 
+	virtual float *multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) override { return nullptr; }
+	virtual void multimesh_unmap_buffer(RID p_multimesh) override {}
+
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override {}
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const override { return 0; }
 
@@ -116,6 +121,7 @@ public:
 	virtual void skeleton_free(RID p_rid) override {}
 	virtual void skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) override {}
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) override {}
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) override {}
 	virtual int skeleton_get_bone_count(RID p_skeleton) const override { return 0; }
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) override {}
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const override { return Transform3D(); }
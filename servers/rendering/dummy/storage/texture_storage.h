@@ -31,6 +31,7 @@
 #ifndef TEXTURE_STORAGE_DUMMY_H
 #define TEXTURE_STORAGE_DUMMY_H
 
+#include "core/io/resource_loader.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/storage/texture_storage.h"
 
@@ -88,6 +89,9 @@ public:
 	virtual void texture_2d_initialize(RID p_texture, const Ref<Image> &p_image) override {
 		DummyTexture *t = texture_owner.get_or_null(p_texture);
 		ERR_FAIL_COND(!t);
+		if (ResourceLoader::is_stripping_payloads()) {
+			return; // Only kept so texture_2d_get() works, nothing asks for it then.
+		}
 		t->image = p_image->duplicate();
 	};
 	virtual void texture_2d_layered_initialize(RID p_texture, const Vector<Ref<Image>> &p_layers, RS::TextureLayeredType p_layered_type) override{};
@@ -120,6 +124,7 @@ public:
 	virtual void texture_set_detect_3d_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override{};
 	virtual void texture_set_detect_normal_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override{};
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override{};
+	virtual void texture_set_stream_request_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override{};
 
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override{};
 
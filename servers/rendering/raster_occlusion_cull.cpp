@@ -0,0 +1,308 @@
+/*************************************************************************/
+/*  raster_occlusion_cull.cpp                                            */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/object/worker_thread_pool.h"
+
+void RasterOcclusionCull::RasterHZBuffer::add_triangles(const Vector3 *p_vertices, const int *p_indices, int p_index_count, const Transform3D &p_xform, const Projection &p_cam_projection, real_t p_z_near) {
+	const Size2i &buffer_size = sizes[0];
+
+	for (int i = 0; i + 2 < p_index_count; i += 3) {
+		Vector3 view[3];
+		for (int j = 0; j < 3; j++) {
+			view[j] = p_xform.xform(p_vertices[p_indices[i + j]]);
+		}
+
+		// Clip against the near plane, which can turn the triangle into a quad.
+		Vector3 clipped[4];
+		int clipped_count = 0;
+		for (int j = 0; j < 3; j++) {
+			const Vector3 &a = view[j];
+			const Vector3 &b = view[(j + 1) % 3];
+			bool a_inside = a.z < -p_z_near;
+			bool b_inside = b.z < -p_z_near;
+			if (a_inside) {
+				clipped[clipped_count++] = a;
+			}
+			if (a_inside != b_inside) {
+				real_t t = (-p_z_near - a.z) / (b.z - a.z);
+				clipped[clipped_count++] = a.lerp(b, t);
+			}
+		}
+
+		if (clipped_count < 3) {
+			continue; // Behind the camera.
+		}
+
+		Vector3 projected[4];
+		for (int j = 0; j < clipped_count; j++) {
+			Plane p = p_cam_projection.xform4(Plane(clipped[j], 1.0));
+			projected[j] = Vector3((p.normal.x / p.d * 0.5f + 0.5f) * buffer_size.x, (p.normal.y / p.d * 0.5f + 0.5f) * buffer_size.y, -clipped[j].z);
+		}
+
+		for (int j = 2; j < clipped_count; j++) {
+			const Vector3 &a = projected[0];
+			const Vector3 &b = projected[j - 1];
+			const Vector3 &c = projected[j];
+
+			if (MAX(a.x, MAX(b.x, c.x)) < 0 || MIN(a.x, MIN(b.x, c.x)) > buffer_size.x || MAX(a.y, MAX(b.y, c.y)) < 0 || MIN(a.y, MIN(b.y, c.y)) > buffer_size.y) {
+				continue; // Off screen.
+			}
+
+			Triangle triangle;
+			triangle.vertices[0] = a;
+			triangle.vertices[1] = b;
+			triangle.vertices[2] = c;
+			triangles.push_back(triangle);
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(bool p_cam_orthogonal, real_t p_z_far) {
+	const Size2i &buffer_size = sizes[0];
+
+	float *depth = mips[0];
+	for (int i = 0; i < buffer_size.x * buffer_size.y; i++) {
+		depth[i] = FLT_MAX;
+	}
+
+	debug_tex_range = p_z_far;
+
+	if (triangles.is_empty()) {
+		return;
+	}
+
+	// Each thread fills a band of rows, so no two threads write to the same pixel.
+	RasterThreadData td;
+	td.band_count = CLAMP(WorkerThreadPool::get_singleton()->get_thread_count(), 1, buffer_size.y);
+	td.orthogonal = p_cam_orthogonal;
+	td.triangles = triangles.ptr();
+	td.triangle_count = triangles.size();
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_band, &td, td.band_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_band(uint32_t p_band, const RasterThreadData *p_data) {
+	const Size2i &buffer_size = sizes[0];
+	int from_y = p_band * buffer_size.y / p_data->band_count;
+	int to_y = (p_band + 1) * buffer_size.y / p_data->band_count;
+
+	float *depth = mips[0];
+
+	for (uint32_t i = 0; i < p_data->triangle_count; i++) {
+		const Vector3 &a = p_data->triangles[i].vertices[0];
+		const Vector3 &b = p_data->triangles[i].vertices[1];
+		const Vector3 &c = p_data->triangles[i].vertices[2];
+
+		float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+		if (area == 0.0f) {
+			continue;
+		}
+
+		int min_x = MAX(0, (int)Math::floor(MIN(a.x, MIN(b.x, c.x))));
+		int max_x = MIN(buffer_size.x - 1, (int)Math::ceil(MAX(a.x, MAX(b.x, c.x))));
+		int min_y = MAX(from_y, (int)Math::floor(MIN(a.y, MIN(b.y, c.y))));
+		int max_y = MIN(to_y - 1, (int)Math::ceil(MAX(a.y, MAX(b.y, c.y))));
+
+		if (min_x > max_x || min_y > max_y) {
+			continue;
+		}
+
+		// The inverse of the depth is linear in screen space with a perspective projection.
+		float za = p_data->orthogonal ? a.z : 1.0f / a.z;
+		float zb = p_data->orthogonal ? b.z : 1.0f / b.z;
+		float zc = p_data->orthogonal ? c.z : 1.0f / c.z;
+		float inv_area = 1.0f / area;
+
+		for (int y = min_y; y <= max_y; y++) {
+			float py = y + 0.5f;
+			float *row = &depth[y * buffer_size.x];
+
+			for (int x = min_x; x <= max_x; x++) {
+				float px = x + 0.5f;
+
+				// Barycentric coordinates, dividing by the signed area makes both windings work.
+				float wa = ((b.x - px) * (c.y - py) - (b.y - py) * (c.x - px)) * inv_area;
+				float wb = ((c.x - px) * (a.y - py) - (c.y - py) * (a.x - px)) * inv_area;
+				float wc = 1.0f - wa - wb;
+				if (wa < 0.0f || wb < 0.0f || wc < 0.0f) {
+					continue;
+				}
+
+				float z = wa * za + wb * zb + wc * zc;
+				if (!p_data->orthogonal) {
+					z = 1.0f / z;
+				}
+				row[x] = MIN(row[x], z);
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_COND(!occluder);
+	ERR_FAIL_COND_MSG(p_indices.size() % 3 != 0, "Occluder indices must describe triangles.");
+
+	const int *indices = p_indices.ptr();
+	for (int i = 0; i < p_indices.size(); i++) {
+		ERR_FAIL_INDEX_MSG(indices[i], p_vertices.size(), "Occluder index out of bounds.");
+	}
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_COND(!occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	if (!scenarios.has(p_scenario)) {
+		scenarios[p_scenario] = Scenario();
+	}
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	Scenario &scenario = scenarios[p_scenario];
+
+	// Occluder data is read when rasterizing, so nothing needs to be rebuilt here.
+	OccluderInstance &instance = scenario.instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios[p_scenario].instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	if (!buffers.has(p_buffer)) {
+		return;
+	}
+
+	RasterHZBuffer &buffer = buffers[p_buffer];
+
+	if (buffer.is_empty() || !scenarios.has(buffer.scenario_rid)) {
+		return;
+	}
+
+	const Scenario &scenario = scenarios[buffer.scenario_rid];
+	Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	real_t z_near = p_cam_projection.get_z_near();
+
+	buffer.triangles.clear();
+	for (const KeyValue<RID, OccluderInstance> &E : scenario.instances) {
+		if (!E.value.enabled) {
+			continue;
+		}
+		const Occluder *occluder = occluder_owner.get_or_null(E.value.occluder);
+		if (!occluder || occluder->indices.is_empty()) {
+			continue;
+		}
+		buffer.add_triangles(occluder->vertices.ptr(), occluder->indices.ptr(), occluder->indices.size(), cam_inv_transform * E.value.xform, p_cam_projection, z_near);
+	}
+
+	buffer.rasterize(p_cam_orthogonal, p_cam_projection.get_z_far());
+	buffer.update_mips();
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	if (!buffers.has(p_buffer)) {
+		return nullptr;
+	}
+	return &buffers[p_buffer];
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+RasterOcclusionCull::~RasterOcclusionCull() {
+	List<RID> occluders;
+	occluder_owner.get_owned_list(&occluders);
+	for (const RID &E : occluders) {
+		free_occluder(E);
+	}
+}
@@ -0,0 +1,112 @@
+/*************************************************************************/
+/*  raster_occlusion_cull.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef RASTER_OCCLUSION_CULL_H
+#define RASTER_OCCLUSION_CULL_H
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid_owner.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+
+// Fills the occlusion buffer by rasterizing the occluders on the CPU. Used when no
+// other implementation is available (such as the Embree-based one in the raycast module).
+class RasterOcclusionCull : public RendererSceneOcclusionCull {
+public:
+	class RasterHZBuffer : public HZBuffer {
+	public:
+		struct Triangle {
+			// X and Y in buffer pixels, Z is the view depth.
+			Vector3 vertices[3];
+		};
+
+	private:
+		struct RasterThreadData {
+			uint32_t band_count;
+			bool orthogonal;
+			const Triangle *triangles;
+			uint32_t triangle_count;
+		};
+
+		void _rasterize_band(uint32_t p_band, const RasterThreadData *p_data);
+
+	public:
+		RID scenario_rid;
+		LocalVector<Triangle> triangles;
+
+		void add_triangles(const Vector3 *p_vertices, const int *p_indices, int p_index_count, const Transform3D &p_xform, const Projection &p_cam_projection, real_t p_z_near);
+		void rasterize(bool p_cam_orthogonal, real_t p_z_far);
+	};
+
+private:
+	struct Occluder {
+		PackedVector3Array vertices;
+		PackedInt32Array indices;
+	};
+
+	struct OccluderInstance {
+		RID occluder;
+		Transform3D xform;
+		bool enabled = true;
+	};
+
+	struct Scenario {
+		HashMap<RID, OccluderInstance> instances;
+	};
+
+	RID_PtrOwner<Occluder> occluder_owner;
+	HashMap<RID, Scenario> scenarios;
+	HashMap<RID, RasterHZBuffer> buffers;
+
+public:
+	virtual bool is_occluder(RID p_rid) override;
+	virtual RID occluder_allocate() override;
+	virtual void occluder_initialize(RID p_occluder) override;
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) override;
+	virtual void free_occluder(RID p_occluder) override;
+
+	virtual void add_scenario(RID p_scenario) override;
+	virtual void remove_scenario(RID p_scenario) override;
+	virtual void scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) override;
+	virtual void scenario_remove_instance(RID p_scenario, RID p_instance) override;
+
+	virtual void add_buffer(RID p_buffer) override;
+	virtual void remove_buffer(RID p_buffer) override;
+	virtual HZBuffer *buffer_get_ptr(RID p_buffer) override;
+	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override;
+	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
+	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+
+	virtual RID buffer_get_debug_texture(RID p_buffer) override;
+
+	~RasterOcclusionCull();
+};
+
+#endif // RASTER_OCCLUSION_CULL_H
@@ -295,26 +295,7 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 
 	if (ci->sort_y) {
 		if (allow_y_sort) {
-			if (ci->ysort_children_count == -1) {
-				ci->ysort_children_count = 0;
-				_collect_ysort_children(ci, Transform2D(), p_material_owner, nullptr, ci->ysort_children_count, p_z);
-			}
-
-			child_item_count = ci->ysort_children_count + 1;
-			child_items = (Item **)alloca(child_item_count * sizeof(Item *));
-
-			ci->ysort_parent_abs_z_index = parent_z;
-			child_items[0] = ci;
-			int i = 1;
-			_collect_ysort_children(ci, Transform2D(), p_material_owner, child_items, i, p_z);
-			ci->ysort_xform = ci->xform.affine_inverse();
-
-			SortArray<Item *, ItemPtrSort> sorter;
-			sorter.sort(child_items, child_item_count);
-
-			for (i = 0; i < child_item_count; i++) {
-				_cull_canvas_item(child_items[i], xform * child_items[i]->ysort_xform, p_clip_rect, modulate, child_items[i]->ysort_parent_abs_z_index, z_list, z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, false);
-			}
+			_cull_canvas_item_y_sorted(ci, xform, p_clip_rect, modulate, p_z, parent_z, z_list, z_last_list, p_material_owner);
 		} else {
 			RendererCanvasRender::Item *canvas_group_from = nullptr;
 			bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
@@ -349,6 +330,33 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	}
 }
 
+// Not inlined into _cull_canvas_item(), so only the frames that Y-sort take stack space for the sorted items.
+void RendererCanvasCull::_cull_canvas_item_y_sorted(Item *ci, const Transform2D &p_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, int p_parent_z, RendererCanvasRender::Item **z_list, RendererCanvasRender::Item **z_last_list, Item *p_material_owner) {
+	if (ci->ysort_children_count == -1) {
+		ci->ysort_children_count = 0;
+		_collect_ysort_children(ci, Transform2D(), p_material_owner, nullptr, ci->ysort_children_count, p_z);
+	}
+
+	int child_item_count = ci->ysort_children_count + 1;
+	// Most Y-sorted parents have few children, big ones go to the heap instead of the stack.
+	InlineLocalVector<Item *, 64> ysort_items;
+	ysort_items.resize(child_item_count);
+	Item **child_items = ysort_items.ptr();
+
+	ci->ysort_parent_abs_z_index = p_parent_z;
+	child_items[0] = ci;
+	int i = 1;
+	_collect_ysort_children(ci, Transform2D(), p_material_owner, child_items, i, p_z);
+	ci->ysort_xform = ci->xform.affine_inverse();
+
+	SortArray<Item *, ItemPtrSort> sorter;
+	sorter.sort(child_items, child_item_count);
+
+	for (i = 0; i < child_item_count; i++) {
+		_cull_canvas_item(child_items[i], p_xform * child_items[i]->ysort_xform, p_clip_rect, p_modulate, child_items[i]->ysort_parent_abs_z_index, z_list, z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, false);
+	}
+}
+
 void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel) {
 	RENDER_TIMESTAMP("> Render Canvas");
 
@@ -510,9 +518,53 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	if (interpolation_data.enabled && canvas_item->interpolated) {
+		if (canvas_item->xform_curr == p_transform) {
+			return;
+		}
+		if (!canvas_item->on_interpolate_list) {
+			// Was at rest, start moving from where it was.
+			canvas_item->xform_prev = canvas_item->xform_curr;
+			canvas_item->on_interpolate_list = true;
+			interpolation_data.interpolate_list.push_back(p_item);
+		}
+		if (canvas_item->interpolation_tick != interpolation_data.tick) {
+			canvas_item->interpolation_tick = interpolation_data.tick;
+			interpolation_data.tick_list_curr.push_back(p_item);
+		}
+		canvas_item->xform_curr = p_transform;
+		return; // Drawn from update_interpolation_frame().
+	}
+
+	canvas_item->xform_curr = p_transform;
 	canvas_item->xform = p_transform;
 }
 
+void RendererCanvasCull::_canvas_item_snap_interpolation(Item *p_item) {
+	p_item->xform_prev = p_item->xform_curr;
+	p_item->xform = p_item->xform_curr;
+	p_item->on_interpolate_list = false;
+}
+
+void RendererCanvasCull::canvas_item_set_interpolated(RID p_item, bool p_interpolated) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_COND(!canvas_item);
+
+	if (canvas_item->interpolated == p_interpolated) {
+		return;
+	}
+
+	canvas_item->interpolated = p_interpolated;
+	_canvas_item_snap_interpolation(canvas_item);
+}
+
+void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_COND(!canvas_item);
+
+	_canvas_item_snap_interpolation(canvas_item);
+}
+
 void RendererCanvasCull::canvas_item_set_clip(RID p_item, bool p_clip) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_COND(!canvas_item);
@@ -1933,6 +1985,73 @@ void RendererCanvasCull::update_visibility_notifiers() {
 	}
 }
 
+void RendererCanvasCull::set_physics_interpolation_enabled(bool p_enabled) {
+	if (interpolation_data.enabled == p_enabled) {
+		return;
+	}
+
+	interpolation_data.enabled = p_enabled;
+
+	for (uint32_t i = 0; i < interpolation_data.interpolate_list.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(interpolation_data.interpolate_list[i]);
+		if (canvas_item) {
+			_canvas_item_snap_interpolation(canvas_item);
+		}
+	}
+
+	interpolation_data.interpolate_list.clear();
+	interpolation_data.tick_list_curr.clear();
+	interpolation_data.tick_list_prev.clear();
+}
+
+void RendererCanvasCull::tick() {
+	if (!interpolation_data.enabled) {
+		return;
+	}
+
+	// Items moved in the tick that just ended start the new one from where they ended it.
+	for (uint32_t i = 0; i < interpolation_data.tick_list_curr.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(interpolation_data.tick_list_curr[i]);
+		if (canvas_item) {
+			canvas_item->xform_prev = canvas_item->xform_curr;
+		}
+	}
+
+	// Items that weren't moved in it came to rest, show them there and stop interpolating them.
+	for (uint32_t i = 0; i < interpolation_data.tick_list_prev.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(interpolation_data.tick_list_prev[i]);
+		if (canvas_item && canvas_item->on_interpolate_list && canvas_item->interpolation_tick != interpolation_data.tick) {
+			_canvas_item_snap_interpolation(canvas_item);
+		}
+	}
+
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < interpolation_data.interpolate_list.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(interpolation_data.interpolate_list[i]);
+		if (canvas_item && canvas_item->on_interpolate_list) {
+			interpolation_data.interpolate_list[count++] = interpolation_data.interpolate_list[i];
+		}
+	}
+	interpolation_data.interpolate_list.resize(count);
+
+	SWAP(interpolation_data.tick_list_curr, interpolation_data.tick_list_prev);
+	interpolation_data.tick_list_curr.clear();
+	interpolation_data.tick++;
+}
+
+void RendererCanvasCull::update_interpolation_frame(double p_fraction) {
+	if (!interpolation_data.enabled) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < interpolation_data.interpolate_list.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(interpolation_data.interpolate_list[i]);
+		if (canvas_item && canvas_item->on_interpolate_list) {
+			canvas_item->xform = canvas_item->xform_prev.interpolate_with(canvas_item->xform_curr, p_fraction);
+		}
+	}
+}
+
 bool RendererCanvasCull::free(RID p_rid) {
 	if (canvas_owner.owns(p_rid)) {
 		Canvas *canvas = canvas_owner.get_or_null(p_rid);
@@ -55,6 +55,13 @@ public:
 		int ysort_index;
 		int ysort_parent_abs_z_index; // Absolute Z index of parent. Only populated and used when y-sorting.
 
+		// Physics interpolation: xform is drawn between the transforms set in the last two physics ticks.
+		Transform2D xform_prev;
+		Transform2D xform_curr;
+		uint64_t interpolation_tick = 0; // Last tick the transform was set in.
+		bool interpolated = false;
+		bool on_interpolate_list = false;
+
 		Vector<Item *> child_items;
 
 		struct VisibilityNotifierData {
@@ -173,6 +180,16 @@ public:
 	bool sdf_used = false;
 	bool snapping_2d_transforms_to_pixel = false;
 
+	struct InterpolationData {
+		bool enabled = false;
+		uint64_t tick = 1;
+		LocalVector<RID> interpolate_list; // Items drawn with an interpolated transform.
+		LocalVector<RID> tick_list_curr; // Items moved in the current tick.
+		LocalVector<RID> tick_list_prev; // Items moved in the previous tick.
+	} interpolation_data;
+
+	void _canvas_item_snap_interpolation(Item *p_item);
+
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
 
@@ -181,6 +198,7 @@ public:
 private:
 	void _render_canvas_item_tree(RID p_to_render_target, Canvas::ChildItem *p_child_items, int p_child_item_count, Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel);
 	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **z_list, RendererCanvasRender::Item **z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool allow_y_sort);
+	_NO_INLINE_ void _cull_canvas_item_y_sorted(Item *ci, const Transform2D &p_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, int p_parent_z, RendererCanvasRender::Item **z_list, RendererCanvasRender::Item **z_last_list, Item *p_material_owner);
 
 	RendererCanvasRender::Item **z_list;
 	RendererCanvasRender::Item **z_last_list;
@@ -207,6 +225,8 @@ public:
 	void canvas_item_set_light_mask(RID p_item, int p_mask);
 
 	void canvas_item_set_transform(RID p_item, const Transform2D &p_transform);
+	void canvas_item_set_interpolated(RID p_item, bool p_interpolated);
+	void canvas_item_reset_physics_interpolation(RID p_item);
 	void canvas_item_set_clip(RID p_item, bool p_clip);
 	void canvas_item_set_distance_field_mode(RID p_item, bool p_enable);
 	void canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect = Rect2());
@@ -312,6 +332,10 @@ public:
 
 	void update_visibility_notifiers();
 
+	void set_physics_interpolation_enabled(bool p_enabled);
+	void tick();
+	void update_interpolation_frame(double p_fraction);
+
 	bool free(RID p_rid);
 	RendererCanvasCull();
 	~RendererCanvasCull();
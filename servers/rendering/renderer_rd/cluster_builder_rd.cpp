@@ -29,6 +29,7 @@
 /*************************************************************************/
 
 #include "cluster_builder_rd.h"
+#include "core/config/project_settings.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/rendering_server_globals.h"
 
@@ -57,6 +58,15 @@ ClusterBuilderSharedDataRD::ClusterBuilderSharedDataRD() {
 		ms.sample_count = RD::TEXTURE_SAMPLES_4;
 		cluster_render.shader_pipelines[ClusterRender::PIPELINE_MSAA] = RD::get_singleton()->render_pipeline_create(cluster_render.shader, RD::get_singleton()->framebuffer_format_create_empty(), vertex_format, RD::RENDER_PRIMITIVE_TRIANGLES, RD::PipelineRasterizationState(), ms, RD::PipelineDepthStencilState(), RD::PipelineColorBlendState(), 0);
 	}
+	use_compute = GLOBAL_GET("rendering/limits/cluster_builder/use_compute");
+	if (use_compute) {
+		Vector<String> versions;
+		versions.push_back("");
+		cluster_bin.cluster_bin_shader.initialize(versions);
+		cluster_bin.shader_version = cluster_bin.cluster_bin_shader.version_create();
+		cluster_bin.shader = cluster_bin.cluster_bin_shader.version_get_shader(cluster_bin.shader_version, 0);
+		cluster_bin.shader_pipeline = RD::get_singleton()->compute_pipeline_create(cluster_bin.shader);
+	}
 	{
 		Vector<String> versions;
 		versions.push_back("");
@@ -211,6 +221,9 @@ ClusterBuilderSharedDataRD::~ClusterBuilderSharedDataRD() {
 	RD::get_singleton()->free(box_index_buffer);
 
 	cluster_render.cluster_render_shader.version_free(cluster_render.shader_version);
+	if (use_compute) {
+		cluster_bin.cluster_bin_shader.version_free(cluster_bin.shader_version);
+	}
 	cluster_store.cluster_store_shader.version_free(cluster_store.shader_version);
 	cluster_debug.cluster_debug_shader.version_free(cluster_debug.shader_version);
 }
@@ -234,10 +247,13 @@ void ClusterBuilderRD::_clear() {
 	render_element_max = 0;
 	render_element_count = 0;
 
-	RD::get_singleton()->free(framebuffer);
-	framebuffer = RID();
+	if (framebuffer.is_valid()) {
+		RD::get_singleton()->free(framebuffer);
+		framebuffer = RID();
+	}
 
 	cluster_render_uniform_set = RID();
+	cluster_bin_uniform_set = RID();
 	cluster_store_uniform_set = RID();
 }
 
@@ -274,11 +290,13 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 
 	element_buffer = RD::get_singleton()->storage_buffer_create(sizeof(RenderElementData) * render_element_max);
 
-	uint32_t div_value = 1 << divisor;
-	if (use_msaa) {
-		framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value, RD::TEXTURE_SAMPLES_4);
-	} else {
-		framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value);
+	if (!shared->use_compute) {
+		uint32_t div_value = 1 << divisor;
+		if (use_msaa) {
+			framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value, RD::TEXTURE_SAMPLES_4);
+		} else {
+			framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value);
+		}
 	}
 
 	{
@@ -305,7 +323,11 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 			uniforms.push_back(u);
 		}
 
-		cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		if (shared->use_compute) {
+			cluster_bin_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_bin.shader, 0);
+		} else {
+			cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		}
 	}
 
 	{
@@ -407,7 +429,7 @@ void ClusterBuilderRD::bake_cluster() {
 
 	if (render_element_count > 0) {
 		//clear render buffer
-		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_render_buffer_size, RD::BARRIER_MASK_RASTER);
+		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_render_buffer_size, shared->use_compute ? RD::BARRIER_MASK_COMPUTE : RD::BARRIER_MASK_RASTER);
 
 		{ //fill state uniform
 
@@ -429,10 +451,29 @@ void ClusterBuilderRD::bake_cluster() {
 
 		RD::get_singleton()->buffer_update(element_buffer, 0, sizeof(RenderElementData) * render_element_count, render_elements, RD::BARRIER_MASK_RASTER | RD::BARRIER_MASK_COMPUTE);
 
-		RENDER_TIMESTAMP("Render 3D Cluster Elements");
+		if (shared->use_compute) {
+			RENDER_TIMESTAMP("Bin 3D Cluster Elements");
 
-		//render elements
-		{
+			//test every element against every cluster tile, instead of rasterizing their proxies
+			RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, shared->cluster_bin.shader_pipeline);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, cluster_bin_uniform_set, 0);
+
+			ClusterBuilderSharedDataRD::ClusterBin::PushConstant push_constant;
+			push_constant.screen_size[0] = screen_size.x;
+			push_constant.screen_size[1] = screen_size.y;
+			push_constant.cluster_size = cluster_size;
+			push_constant.render_element_count = render_element_count;
+
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(ClusterBuilderSharedDataRD::ClusterBin::PushConstant));
+
+			RD::get_singleton()->compute_list_dispatch(compute_list, cluster_screen_size.x, cluster_screen_size.y, 1);
+
+			RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_COMPUTE);
+		} else {
+			RENDER_TIMESTAMP("Render 3D Cluster Elements");
+
+			//render elements
 			RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD);
 			ClusterBuilderSharedDataRD::ClusterRender::PushConstant push_constant = {};
 
@@ -35,6 +35,7 @@
 #include "core/os/os.h"
 
 #include "servers/rendering/renderer_rd/renderer_compositor_rd.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
 #include "thirdparty/misc/cubemap_coeffs.h"
 
 bool EffectsRD::get_prefer_raster_effects() {
@@ -149,7 +150,7 @@ void EffectsRD::taa_resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity
 	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
 	ERR_FAIL_NULL(uniform_set_cache);
 
-	RID shader = TAA_resolve.shader.version_get_shader(TAA_resolve.shader_version, 0);
+	RID shader = TAA_resolve.shader.version_get_shader(TAA_resolve.shader_version, TAA_RESOLVE_MODE_RESOLVE);
 	ERR_FAIL_COND(shader.is_null());
 
 	memset(&TAA_resolve.push_constant, 0, sizeof(TAAResolvePushConstant));
@@ -157,9 +158,11 @@ void EffectsRD::taa_resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity
 	TAA_resolve.push_constant.resolution_height = p_resolution.height;
 	TAA_resolve.push_constant.disocclusion_threshold = 0.025f;
 	TAA_resolve.push_constant.disocclusion_scale = 10.0f;
+	TAA_resolve.push_constant.source_resolution_width = p_resolution.width;
+	TAA_resolve.push_constant.source_resolution_height = p_resolution.height;
 
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
-	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, TAA_resolve.pipeline);
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, TAA_resolve.pipelines[TAA_RESOLVE_MODE_RESOLVE]);
 
 	RD::Uniform u_frame_source(RD::UNIFORM_TYPE_IMAGE, 0, { p_frame });
 	RD::Uniform u_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, { default_sampler, p_depth });
@@ -174,6 +177,41 @@ void EffectsRD::taa_resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity
 	RD::get_singleton()->compute_list_end();
 }
 
+void EffectsRD::taa_upscale(RID p_frame, RID p_dest, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_source_resolution, Size2 p_resolution, const Vector2 &p_jitter, bool p_reset_history) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+
+	RID shader = TAA_resolve.shader.version_get_shader(TAA_resolve.shader_version, TAA_RESOLVE_MODE_UPSCALE);
+	ERR_FAIL_COND(shader.is_null());
+
+	memset(&TAA_resolve.push_constant, 0, sizeof(TAAResolvePushConstant));
+	TAA_resolve.push_constant.resolution_width = p_resolution.width;
+	TAA_resolve.push_constant.resolution_height = p_resolution.height;
+	TAA_resolve.push_constant.disocclusion_threshold = 0.025f;
+	TAA_resolve.push_constant.disocclusion_scale = 10.0f;
+	TAA_resolve.push_constant.source_resolution_width = p_source_resolution.width;
+	TAA_resolve.push_constant.source_resolution_height = p_source_resolution.height;
+	// The jitter is a clip space offset, convert it to source pixels.
+	TAA_resolve.push_constant.jitter[0] = p_jitter.x * p_source_resolution.width * 0.5;
+	TAA_resolve.push_constant.jitter[1] = p_jitter.y * p_source_resolution.height * 0.5;
+	TAA_resolve.push_constant.reset_history = p_reset_history;
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, TAA_resolve.pipelines[TAA_RESOLVE_MODE_UPSCALE]);
+
+	RD::Uniform u_frame_source(RD::UNIFORM_TYPE_IMAGE, 0, { p_frame });
+	RD::Uniform u_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, { default_sampler, p_depth });
+	RD::Uniform u_velocity(RD::UNIFORM_TYPE_IMAGE, 2, { p_velocity });
+	RD::Uniform u_prev_velocity(RD::UNIFORM_TYPE_IMAGE, 3, { p_prev_velocity });
+	RD::Uniform u_history(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 4, { default_sampler, p_history });
+	RD::Uniform u_frame_dest(RD::UNIFORM_TYPE_IMAGE, 5, { p_dest });
+
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_frame_source, u_depth, u_velocity, u_prev_velocity, u_history, u_frame_dest), 0);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &TAA_resolve.push_constant, sizeof(TAAResolvePushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, p_resolution.width, p_resolution.height, 1);
+	RD::get_singleton()->compute_list_end();
+}
+
 void EffectsRD::sub_surface_scattering(RID p_diffuse, RID p_diffuse2, RID p_depth, const Projection &p_camera, const Size2i &p_screen_size, float p_scale, float p_depth_scale, RenderingServer::SubSurfaceScatteringQuality p_quality) {
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
@@ -307,70 +345,52 @@ void EffectsRD::roughness_limit(RID p_source_normal, RID p_roughness, const Size
 	RD::get_singleton()->compute_list_end();
 }
 
-void EffectsRD::sort_buffer(RID p_uniform_set, int p_size) {
-	Sort::PushConstant push_constant;
-	push_constant.total_elements = p_size;
-
-	bool done = true;
+uint32_t EffectsRD::sort_get_histogram_buffer_size(uint32_t p_size) {
+	uint32_t block_count = MAX(1u, (p_size + SORT_BLOCK_SIZE - 1) / SORT_BLOCK_SIZE);
+	return block_count * SORT_RADIX_SIZE * sizeof(uint32_t);
+}
 
-	int numThreadGroups = ((p_size - 1) >> 9) + 1;
+void EffectsRD::sort_buffers(const SortBuffer *p_buffers, uint32_t p_count) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
 
-	if (numThreadGroups > 1) {
-		done = false;
+	if (p_count == 0) {
+		return;
 	}
 
+	// Each step is dispatched for all the buffers before the barrier, so sorting many small buffers costs about as many barriers as sorting one.
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
-	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[SORT_MODE_BLOCK]);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, p_uniform_set, 1);
-	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
-	RD::get_singleton()->compute_list_dispatch(compute_list, numThreadGroups, 1, 1);
-
-	int presorted = 512;
+	for (uint32_t pass = 0; pass < SORT_PASSES; pass++) {
+		for (int mode = SORT_MODE_HISTOGRAM; mode < SORT_MODE_MAX; mode++) {
+			RID shader = sort.shader.version_get_shader(sort.shader_version, mode);
+			ERR_FAIL_COND(shader.is_null());
 
-	while (!done) {
-		RD::get_singleton()->compute_list_add_barrier(compute_list);
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[mode]);
 
-		done = true;
-		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[SORT_MODE_STEP]);
+			for (uint32_t i = 0; i < p_count; i++) {
+				const SortBuffer &sort_buffer = p_buffers[i];
 
-		numThreadGroups = 0;
+				// Ping-pong between both buffers, an even number of passes leaves the result in the original one.
+				RD::Uniform u_source(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, (pass & 1) ? sort_buffer.scratch_buffer : sort_buffer.buffer);
+				RD::Uniform u_dest(RD::UNIFORM_TYPE_STORAGE_BUFFER, 1, (pass & 1) ? sort_buffer.buffer : sort_buffer.scratch_buffer);
+				RD::Uniform u_histograms(RD::UNIFORM_TYPE_STORAGE_BUFFER, 2, sort_buffer.histogram_buffer);
 
-		if (p_size > presorted) {
-			if (p_size > presorted * 2) {
-				done = false;
-			}
+				Sort::PushConstant push_constant;
+				push_constant.total_elements = sort_buffer.size;
+				push_constant.block_count = MAX(1u, (sort_buffer.size + SORT_BLOCK_SIZE - 1) / SORT_BLOCK_SIZE);
+				push_constant.shift = pass * 8;
+				push_constant.pad = 0;
 
-			int pow2 = presorted;
-			while (pow2 < p_size) {
-				pow2 *= 2;
+				RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source, u_dest, u_histograms), 0);
+				RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
+				RD::get_singleton()->compute_list_dispatch(compute_list, mode == SORT_MODE_SCAN ? 1 : push_constant.block_count, 1, 1);
 			}
-			numThreadGroups = pow2 >> 9;
-		}
 
-		unsigned int nMergeSize = presorted * 2;
-
-		for (unsigned int nMergeSubSize = nMergeSize >> 1; nMergeSubSize > 256; nMergeSubSize = nMergeSubSize >> 1) {
-			push_constant.job_params[0] = nMergeSubSize;
-			if (nMergeSubSize == nMergeSize >> 1) {
-				push_constant.job_params[1] = (2 * nMergeSubSize - 1);
-				push_constant.job_params[2] = -1;
-			} else {
-				push_constant.job_params[1] = nMergeSubSize;
-				push_constant.job_params[2] = 1;
+			if (pass < SORT_PASSES - 1 || mode < SORT_MODE_MAX - 1) {
+				RD::get_singleton()->compute_list_add_barrier(compute_list);
 			}
-			push_constant.job_params[3] = 0;
-
-			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
-			RD::get_singleton()->compute_list_dispatch(compute_list, numThreadGroups, 1, 1);
-			RD::get_singleton()->compute_list_add_barrier(compute_list);
 		}
-
-		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[SORT_MODE_INNER]);
-		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
-		RD::get_singleton()->compute_list_dispatch(compute_list, numThreadGroups, 1, 1);
-
-		presorted *= 2;
 	}
 
 	RD::get_singleton()->compute_list_end();
@@ -464,9 +484,9 @@ EffectsRD::EffectsRD(bool p_prefer_raster_effects) {
 
 	{
 		Vector<String> sort_modes;
-		sort_modes.push_back("\n#define MODE_SORT_BLOCK\n");
-		sort_modes.push_back("\n#define MODE_SORT_STEP\n");
-		sort_modes.push_back("\n#define MODE_SORT_INNER\n");
+		sort_modes.push_back("\n#define MODE_SORT_HISTOGRAM\n");
+		sort_modes.push_back("\n#define MODE_SORT_SCAN\n");
+		sort_modes.push_back("\n#define MODE_SORT_SCATTER\n");
 
 		sort.shader.initialize(sort_modes);
 
@@ -480,9 +500,13 @@ EffectsRD::EffectsRD(bool p_prefer_raster_effects) {
 	{
 		Vector<String> taa_modes;
 		taa_modes.push_back("\n#define MODE_TAA_RESOLVE");
+		taa_modes.push_back("\n#define MODE_TAA_UPSCALE");
 		TAA_resolve.shader.initialize(taa_modes);
 		TAA_resolve.shader_version = TAA_resolve.shader.version_create();
-		TAA_resolve.pipeline = RD::get_singleton()->compute_pipeline_create(TAA_resolve.shader.version_get_shader(TAA_resolve.shader_version, 0));
+
+		for (int i = 0; i < TAA_RESOLVE_MODE_MAX; i++) {
+			TAA_resolve.pipelines[i] = RD::get_singleton()->compute_pipeline_create(TAA_resolve.shader.version_get_shader(TAA_resolve.shader_version, i));
+		}
 	}
 
 	RD::SamplerState sampler;
@@ -70,18 +70,31 @@ private:
 		RID pipeline;
 	} FSR_upscale;
 
+	enum TAAResolveMode {
+		TAA_RESOLVE_MODE_RESOLVE,
+		TAA_RESOLVE_MODE_UPSCALE,
+		TAA_RESOLVE_MODE_MAX
+	};
+
 	struct TAAResolvePushConstant {
 		float resolution_width;
 		float resolution_height;
 		float disocclusion_threshold;
 		float disocclusion_scale;
+
+		float source_resolution_width;
+		float source_resolution_height;
+		float jitter[2];
+
+		uint32_t reset_history;
+		uint32_t pad[3];
 	};
 
 	struct TAAResolve {
 		TAAResolvePushConstant push_constant;
 		TaaResolveShaderRD shader;
 		RID shader_version;
-		RID pipeline;
+		RID pipelines[TAA_RESOLVE_MODE_MAX];
 	} TAA_resolve;
 
 	enum LuminanceReduceMode {
@@ -165,17 +178,24 @@ private:
 	} sss;
 
 	enum SortMode {
-		SORT_MODE_BLOCK,
-		SORT_MODE_STEP,
-		SORT_MODE_INNER,
+		SORT_MODE_HISTOGRAM,
+		SORT_MODE_SCAN,
+		SORT_MODE_SCATTER,
 		SORT_MODE_MAX
 	};
 
+	enum {
+		SORT_RADIX_SIZE = 256,
+		SORT_BLOCK_SIZE = 1024, // Must match BLOCK_SIZE in sort.glsl.
+		SORT_PASSES = 4,
+	};
+
 	struct Sort {
 		struct PushConstant {
 			uint32_t total_elements;
-			uint32_t pad[3];
-			int32_t job_params[4];
+			uint32_t block_count;
+			uint32_t shift;
+			uint32_t pad;
 		};
 
 		SortShaderRD shader;
@@ -232,6 +252,7 @@ public:
 
 	void fsr_upscale(RID p_source_rd_texture, RID p_secondary_texture, RID p_destination_texture, const Size2i &p_internal_size, const Size2i &p_size, float p_fsr_upscale_sharpness);
 	void taa_resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_resolution, float p_z_near, float p_z_far);
+	void taa_upscale(RID p_frame, RID p_dest, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_source_resolution, Size2 p_resolution, const Vector2 &p_jitter, bool p_reset_history);
 
 	void luminance_reduction(RID p_source_texture, const Size2i p_source_size, const Vector<RID> p_reduce, RID p_prev_luminance, float p_min_luminance, float p_max_luminance, float p_adjust, bool p_set = false);
 	void luminance_reduction_raster(RID p_source_texture, const Size2i p_source_size, const Vector<RID> p_reduce, Vector<RID> p_fb, RID p_prev_luminance, float p_min_luminance, float p_max_luminance, float p_adjust, bool p_set = false);
@@ -240,7 +261,15 @@ public:
 
 	void sub_surface_scattering(RID p_diffuse, RID p_diffuse2, RID p_depth, const Projection &p_camera, const Size2i &p_screen_size, float p_scale, float p_depth_scale, RS::SubSurfaceScatteringQuality p_quality);
 
-	void sort_buffer(RID p_uniform_set, int p_size);
+	struct SortBuffer {
+		RID buffer; // vec2 pairs, sorted by x.
+		RID scratch_buffer; // Same size as buffer.
+		RID histogram_buffer; // At least sort_get_histogram_buffer_size() bytes.
+		uint32_t size = 0;
+	};
+
+	static uint32_t sort_get_histogram_buffer_size(uint32_t p_size);
+	void sort_buffers(const SortBuffer *p_buffers, uint32_t p_count);
 
 	EffectsRD(bool p_prefer_raster_effects);
 	~EffectsRD();
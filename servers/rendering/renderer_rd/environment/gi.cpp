@@ -31,6 +31,7 @@
 #include "gi.h"
 
 #include "core/config/project_settings.h"
+#include "core/os/os.h"
 #include "servers/rendering/renderer_rd/renderer_compositor_rd.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
@@ -380,6 +381,12 @@ void GI::SDFGI::create(RendererSceneEnvironmentRD *p_env, const Vector3 &p_world
 
 	gi = p_gi;
 	num_cascades = p_env->sdfgi_cascades;
+
+	// Every SDFGI needs its own names to find its timestamps, there is one per viewport using it.
+	static uint32_t timestamp_id = 0;
+	timestamp_id++;
+	update_timestamp_begin = "> SDFGI Scroll Regions " + itos(timestamp_id);
+	update_timestamp_end = "< SDFGI Scroll Regions " + itos(timestamp_id);
 	min_cell_size = p_env->sdfgi_min_cell_size;
 	uses_occlusion = p_env->sdfgi_use_occlusion;
 	y_scale_mode = p_env->sdfgi_y_scale;
@@ -1172,9 +1179,21 @@ void GI::SDFGI::update(RendererSceneEnvironmentRD *p_env, const Vector3 &p_world
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
+	// Within a budget, the cascades nearest to the camera scroll first. Further ones can wait for
+	// a later frame, as long as they don't fall more than MAX_DEFERRED_SCROLLS behind the camera.
+	uint32_t budget_cells = UINT32_MAX;
+	if (gi->sdfgi_update_budget_msec > 0.0) {
+		_update_measured_cost();
+		if (update_usec_per_cell > 0.0) {
+			budget_cells = uint32_t(MIN(double(UINT32_MAX), gi->sdfgi_update_budget_msec * 1000.0 / update_usec_per_cell));
+		}
+	}
+	update_cells = 0;
+
 	for (uint32_t i = 0; i < cascades.size(); i++) {
 		SDFGI::Cascade &cascade = cascades[i];
 		cascade.dirty_regions = Vector3i();
+		Vector3i prev_position = cascade.position;
 
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
@@ -1205,22 +1224,87 @@ void GI::SDFGI::update(RendererSceneEnvironmentRD *p_env, const Vector3 &p_world
 			}
 		}
 
+		uint32_t total_volume = cascade_size * cascade_size * cascade_size;
+		uint32_t dirty_volume = cascade.dirty_regions == SDFGI::Cascade::DIRTY_ALL ? total_volume : 0;
+
 		if (cascade.dirty_regions != Vector3i() && cascade.dirty_regions != SDFGI::Cascade::DIRTY_ALL) {
 			//see how much the total dirty volume represents from the total volume
-			uint32_t total_volume = cascade_size * cascade_size * cascade_size;
 			uint32_t safe_volume = 1;
 			for (int j = 0; j < 3; j++) {
 				safe_volume *= cascade_size - ABS(cascade.dirty_regions[j]);
 			}
-			uint32_t dirty_volume = total_volume - safe_volume;
+			dirty_volume = total_volume - safe_volume;
 			if (dirty_volume > (safe_volume / 2)) {
 				//more than half the volume is dirty, make all dirty so its only rendered once
 				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				dirty_volume = total_volume;
+			}
+		}
+
+		if (dirty_volume == 0) {
+			continue;
+		}
+
+		if (i > 0 && update_cells + dirty_volume > budget_cells) {
+			Vector3i behind = (cascade.position - prev_position).abs();
+			if (MAX(behind.x, MAX(behind.y, behind.z)) <= drag_margin * 2 * SDFGI::MAX_DEFERRED_SCROLLS) {
+				// Scroll on a later frame, from where the cascade is now.
+				cascade.position = prev_position;
+				cascade.dirty_regions = Vector3i();
+				continue;
 			}
 		}
+
+		update_cells += dirty_volume;
 	}
 }
 
+void GI::SDFGI::_update_measured_cost() {
+	// Timestamps are read back a few frames after being captured, so look for the scroll regions that were rendered back then.
+	uint32_t timestamp_count = RD::get_singleton()->get_captured_timestamps_count();
+	for (uint32_t i = 0; i < timestamp_count; i++) {
+		if (RD::get_singleton()->get_captured_timestamp_name(i) != update_timestamp_begin) {
+			continue;
+		}
+
+		for (uint32_t j = i + 1; j < timestamp_count; j++) {
+			if (RD::get_singleton()->get_captured_timestamp_name(j) != update_timestamp_end) {
+				continue;
+			}
+
+			uint64_t cpu_time = RD::get_singleton()->get_captured_timestamp_cpu_time(i);
+			for (uint32_t k = 0; k < SDFGI::UPDATE_WORK_HISTORY; k++) {
+				UpdateWork &work = update_work[k];
+				if (work.cells == 0 || work.cpu_time > cpu_time || cpu_time - work.cpu_time > 1000) {
+					continue;
+				}
+
+				double usec = double(RD::get_singleton()->get_captured_timestamp_gpu_time(j) - RD::get_singleton()->get_captured_timestamp_gpu_time(i)) / 1000.0;
+				double usec_per_cell = usec / work.cells;
+				// Smooth out the noise of single measurements.
+				update_usec_per_cell = update_usec_per_cell > 0.0 ? Math::lerp(update_usec_per_cell, usec_per_cell, 0.25) : usec_per_cell;
+				work.cells = 0;
+				break;
+			}
+			break;
+		}
+		break;
+	}
+}
+
+void GI::SDFGI::begin_region_timing() {
+	UpdateWork &work = update_work[update_work_index];
+	update_work_index = (update_work_index + 1) % SDFGI::UPDATE_WORK_HISTORY;
+	work.cpu_time = OS::get_singleton()->get_ticks_usec();
+	work.cells = update_cells;
+
+	RD::get_singleton()->capture_timestamp(update_timestamp_begin);
+}
+
+void GI::SDFGI::end_region_timing() {
+	RD::get_singleton()->capture_timestamp(update_timestamp_end);
+}
+
 void GI::SDFGI::update_light() {
 	RD::get_singleton()->draw_command_begin_label("SDFGI Update dynamic Light");
 
@@ -3227,6 +3311,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_update_budget_msec = MAX(0.0, double(GLOBAL_GET("rendering/global_illumination/sdfgi/update_budget_msec")));
 }
 
 GI::~GI() {
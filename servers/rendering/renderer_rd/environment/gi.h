@@ -500,7 +500,9 @@ public:
 			MAX_DYNAMIC_LIGHTS = 128,
 			MAX_STATIC_LIGHTS = 1024,
 			LIGHTPROBE_OCT_SIZE = 6,
-			SH_SIZE = 16
+			SH_SIZE = 16,
+			UPDATE_WORK_HISTORY = 8, // More than the frames it takes for GPU timestamps to be read back.
+			MAX_DEFERRED_SCROLLS = 2, // Drag margins a cascade can fall behind the camera before it must scroll.
 		};
 
 		struct Cascade {
@@ -551,6 +553,12 @@ public:
 			bool all_dynamic_lights_dirty = true;
 		};
 
+		// Scroll regions rendered in a frame, to compare with the GPU time they took once it is read back.
+		struct UpdateWork {
+			uint64_t cpu_time = 0; // When the timestamp before them was captured.
+			uint32_t cells = 0;
+		};
+
 		// access to our containers
 		GI *gi = nullptr;
 
@@ -614,6 +622,14 @@ public:
 		int32_t cascade_dynamic_light_count[SDFGI::MAX_CASCADES]; //used dynamically
 		RID integrate_sky_uniform_set;
 
+		// Used to keep the scroll regions within GI::sdfgi_update_budget_msec.
+		String update_timestamp_begin;
+		String update_timestamp_end;
+		UpdateWork update_work[UPDATE_WORK_HISTORY];
+		uint32_t update_work_index = 0;
+		uint32_t update_cells = 0; // Scrolled this frame.
+		double update_usec_per_cell = 0.0; // Estimated from the timestamps, 0 until measured.
+
 		void create(RendererSceneEnvironmentRD *p_env, const Vector3 &p_world_position, uint32_t p_requested_history_size, GI *p_gi);
 		void erase();
 		void update(RendererSceneEnvironmentRD *p_env, const Vector3 &p_world_position);
@@ -622,6 +638,9 @@ public:
 		void store_probes();
 		int get_pending_region_data(int p_region, Vector3i &r_local_offset, Vector3i &r_local_size, AABB &r_bounds) const;
 		void update_cascades();
+		void _update_measured_cost();
+		void begin_region_timing();
+		void end_region_timing();
 
 		void debug_draw(uint32_t p_view_count, const Projection *p_projections, const Transform3D &p_transform, int p_width, int p_height, RID p_render_target, RID p_texture, const Vector<RID> &p_texture_views);
 		void debug_probes(RID p_framebuffer, const uint32_t p_view_count, const Projection *p_camera_with_transforms, bool p_will_continue_color, bool p_will_continue_depth);
@@ -634,6 +653,7 @@ public:
 	RS::EnvironmentSDFGIRayCount sdfgi_ray_count = RS::ENV_SDFGI_RAY_COUNT_16;
 	RS::EnvironmentSDFGIFramesToConverge sdfgi_frames_to_converge = RS::ENV_SDFGI_CONVERGE_IN_30_FRAMES;
 	RS::EnvironmentSDFGIFramesToUpdateLight sdfgi_frames_to_update_light = RS::ENV_SDFGI_UPDATE_LIGHT_IN_4_FRAMES;
+	float sdfgi_update_budget_msec = 0.0; // 0 renders all scroll regions as soon as cascades move.
 
 	float sdfgi_solid_cell_ratio = 0.25;
 	Vector3 sdfgi_debug_probe_pos;
@@ -144,6 +144,23 @@ void SkyRD::SkyShaderData::set_code(const String &p_code) {
 		}
 	}
 
+	{
+		RD::PipelineDepthStencilState depth_stencil_state;
+		depth_stencil_state.enable_depth_test = true;
+		depth_stencil_state.depth_compare_operator = RD::COMPARE_OP_LESS_OR_EQUAL;
+
+		// Faces updated on different frames are blended with the previous radiance, which hides the seams between them.
+		RD::PipelineColorBlendState blend_state = RD::PipelineColorBlendState::create_blend();
+		blend_state.attachments.write[0].src_color_blend_factor = RD::BLEND_FACTOR_CONSTANT_ALPHA;
+		blend_state.attachments.write[0].dst_color_blend_factor = RD::BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA;
+		blend_state.attachments.write[0].src_alpha_blend_factor = RD::BLEND_FACTOR_CONSTANT_ALPHA;
+		blend_state.attachments.write[0].dst_alpha_blend_factor = RD::BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA;
+		blend_state.blend_constant = Color(0.0, 0.0, 0.0, 0.5);
+
+		RID shader_variant = scene_singleton->sky.sky_shader.shader.version_get_shader(version, SKY_VERSION_CUBEMAP);
+		cubemap_blend_pipeline.setup(shader_variant, RD::RENDER_PRIMITIVE_TRIANGLES, RD::PipelineRasterizationState(), RD::PipelineMultisampleState(), depth_stencil_state, blend_state, 0);
+	}
+
 	valid = true;
 }
 
@@ -815,6 +832,7 @@ SkyRD::SkyRD() {
 	roughness_layers = GLOBAL_GET("rendering/reflections/sky_reflections/roughness_layers");
 	sky_ggx_samples_quality = GLOBAL_GET("rendering/reflections/sky_reflections/ggx_samples");
 	sky_use_cubemap_array = GLOBAL_GET("rendering/reflections/sky_reflections/texture_array_reflections");
+	sky_time_sliced_update_frames = MAX(1, int(GLOBAL_GET("rendering/reflections/sky_reflections/time_sliced_update_frames")));
 }
 
 void SkyRD::init() {
@@ -1318,6 +1336,117 @@ void SkyRD::setup(RendererSceneEnvironmentRD *p_env, RID p_render_buffers, const
 	RD::get_singleton()->buffer_update(sky_scene_state.uniform_buffer, 0, sizeof(SkySceneState::UBO), &sky_scene_state.ubo);
 }
 
+void SkyRD::_render_sky_cubemap_face(Sky *p_sky, SkyMaterialData *p_material, PipelineCacheRD *p_pipeline, SkyTextureSetVersion p_texture_set, int p_mipmap, int p_face, double p_time, float p_multiplier, const Vector3 &p_position, float p_luminance_multiplier) {
+	static const Vector3 view_normals[6] = {
+		Vector3(+1, 0, 0),
+		Vector3(-1, 0, 0),
+		Vector3(0, +1, 0),
+		Vector3(0, -1, 0),
+		Vector3(0, 0, +1),
+		Vector3(0, 0, -1)
+	};
+	static const Vector3 view_up[6] = {
+		Vector3(0, -1, 0),
+		Vector3(0, -1, 0),
+		Vector3(0, 0, +1),
+		Vector3(0, 0, -1),
+		Vector3(0, -1, 0),
+		Vector3(0, -1, 0)
+	};
+
+	Projection cm;
+	cm.set_perspective(90, 1, 0.01, 10.0);
+	Projection correction;
+	correction.set_depth_correction(true);
+	cm = correction * cm;
+
+	Basis local_view = Basis::looking_at(view_normals[p_face], view_up[p_face]);
+	RID texture_uniform_set = p_sky->get_textures(p_texture_set, sky_shader.default_shader_rd);
+	RID framebuffer = p_sky->reflection.layers[0].mipmaps[p_mipmap].framebuffers[p_face];
+
+	RD::DrawListID cubemap_draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD);
+	_render_sky(cubemap_draw_list, p_time, framebuffer, p_pipeline, p_material->uniform_set, texture_uniform_set, 1, &cm, local_view, p_multiplier, p_position, p_luminance_multiplier);
+	RD::get_singleton()->draw_list_end();
+}
+
+void SkyRD::_update_time_sliced(Sky *p_sky, SkyMaterialData *p_material, SkyShaderData *p_shader_data, RS::SkyMode p_sky_mode, int p_max_processing_layer, double p_time, float p_multiplier, const Vector3 &p_position, float p_luminance_multiplier) {
+	// A full update is split in steps: rendering the faces of the cubemap, then filtering it, and spread over sky_time_sliced_update_frames frames.
+	// Changes made to the sky while an update is in progress are picked up by the next one.
+	if (p_sky->time_slice_step < 0 || p_sky->time_slice_mode != p_sky_mode) {
+		if (p_sky->reflection.dirty && p_sky->time_slice_mode == p_sky_mode) {
+			p_sky->time_slice_blend = true;
+			p_sky->time_slice_settled = false;
+		} else if (!p_sky->time_slice_settled || p_sky->time_slice_mode != p_sky_mode) {
+			// Once the sky stops changing, one more update without blending catches up with it.
+			p_sky->time_slice_blend = false;
+			p_sky->time_slice_settled = true;
+		} else {
+			return;
+		}
+		p_sky->reflection.dirty = false;
+		p_sky->time_slice_step = 0;
+		p_sky->time_slice_mode = p_sky_mode;
+	}
+
+	// The half and quarter resolution passes render to mipmaps of the radiance, so the faces are rendered all at once and those mipmaps are filtered again in the same frame.
+	bool borrows_mipmaps = p_shader_data->uses_half_res || p_shader_data->uses_quarter_res;
+	int face_steps = borrows_mipmaps ? 1 : 6;
+	int filter_steps = p_sky_mode == RS::SKY_MODE_REALTIME ? 1 : MAX(1, p_max_processing_layer - 1);
+	int step_count = face_steps + filter_steps;
+
+	int step_end = MIN(p_sky->time_slice_step + (step_count + sky_time_sliced_update_frames - 1) / sky_time_sliced_update_frames, step_count);
+	if (borrows_mipmaps && p_sky->time_slice_step < face_steps) {
+		int restore_steps = p_sky_mode == RS::SKY_MODE_REALTIME ? 1 : (sky_use_cubemap_array ? 0 : 2);
+		step_end = MAX(step_end, MIN(face_steps + restore_steps, step_count));
+	}
+
+	for (int step = p_sky->time_slice_step; step < step_end; step++) {
+		if (step < face_steps) {
+			RD::get_singleton()->draw_command_begin_label("Render Sky Cubemap (Time Sliced)");
+			int face_from = borrows_mipmaps ? 0 : step;
+			int face_to = borrows_mipmaps ? 6 : step + 1;
+			for (int i = face_from; i < face_to; i++) {
+				if (p_shader_data->uses_quarter_res) {
+					_render_sky_cubemap_face(p_sky, p_material, &p_shader_data->pipelines[SKY_VERSION_CUBEMAP_QUARTER_RES], SKY_TEXTURE_SET_CUBEMAP_QUARTER_RES, 2, i, p_time, p_multiplier, p_position, p_luminance_multiplier);
+				}
+			}
+			for (int i = face_from; i < face_to; i++) {
+				if (p_shader_data->uses_half_res) {
+					_render_sky_cubemap_face(p_sky, p_material, &p_shader_data->pipelines[SKY_VERSION_CUBEMAP_HALF_RES], SKY_TEXTURE_SET_CUBEMAP_HALF_RES, 1, i, p_time, p_multiplier, p_position, p_luminance_multiplier);
+				}
+			}
+			for (int i = face_from; i < face_to; i++) {
+				_render_sky_cubemap_face(p_sky, p_material, p_sky->time_slice_blend ? &p_shader_data->cubemap_blend_pipeline : &p_shader_data->pipelines[SKY_VERSION_CUBEMAP], SKY_TEXTURE_SET_CUBEMAP, 0, i, p_time, p_multiplier, p_position, p_luminance_multiplier);
+			}
+			RD::get_singleton()->draw_command_end_label();
+
+			if (step == face_steps - 1 && p_sky_mode != RS::SKY_MODE_REALTIME && sky_use_cubemap_array) {
+				p_sky->reflection.update_reflection_mipmaps(0, 1);
+			}
+		} else if (p_sky_mode == RS::SKY_MODE_REALTIME) {
+			p_sky->reflection.create_reflection_fast_filter(sky_use_cubemap_array);
+			if (sky_use_cubemap_array) {
+				p_sky->reflection.update_reflection_mipmaps(0, p_sky->reflection.layers.size());
+			}
+		} else {
+			int layer = step - face_steps + 1;
+			if (layer < p_max_processing_layer) {
+				p_sky->reflection.create_reflection_importance_sample(sky_use_cubemap_array, 10, layer, sky_ggx_samples_quality);
+				if (sky_use_cubemap_array) {
+					p_sky->reflection.update_reflection_mipmaps(layer, layer + 1);
+				}
+			}
+		}
+	}
+
+	if (step_end < step_count) {
+		p_sky->time_slice_step = step_end;
+		RenderingServerDefault::redraw_request();
+	} else {
+		p_sky->time_slice_step = -1;
+	}
+}
+
 void SkyRD::update(RendererSceneEnvironmentRD *p_env, const Projection &p_projection, const Transform3D &p_transform, double p_time, float p_luminance_multiplier) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	ERR_FAIL_COND(!p_env);
@@ -1373,46 +1502,18 @@ void SkyRD::update(RendererSceneEnvironmentRD *p_env, const Projection &p_projec
 
 	int max_processing_layer = sky_use_cubemap_array ? sky->reflection.layers.size() : sky->reflection.layers[0].mipmaps.size();
 
+	if (update_single_frame && sky_time_sliced_update_frames > 1 && sky->time_slice_ready) {
+		_update_time_sliced(sky, material, shader_data, sky_mode, max_processing_layer, p_time, multiplier, p_transform.origin, p_luminance_multiplier);
+		return;
+	}
+
 	// Update radiance cubemap
 	if (sky->reflection.dirty && (sky->processing_layer >= max_processing_layer || update_single_frame)) {
-		static const Vector3 view_normals[6] = {
-			Vector3(+1, 0, 0),
-			Vector3(-1, 0, 0),
-			Vector3(0, +1, 0),
-			Vector3(0, -1, 0),
-			Vector3(0, 0, +1),
-			Vector3(0, 0, -1)
-		};
-		static const Vector3 view_up[6] = {
-			Vector3(0, -1, 0),
-			Vector3(0, -1, 0),
-			Vector3(0, 0, +1),
-			Vector3(0, 0, -1),
-			Vector3(0, -1, 0),
-			Vector3(0, -1, 0)
-		};
-
-		Projection cm;
-		cm.set_perspective(90, 1, 0.01, 10.0);
-		Projection correction;
-		correction.set_depth_correction(true);
-		cm = correction * cm;
-
 		if (shader_data->uses_quarter_res) {
 			RD::get_singleton()->draw_command_begin_label("Render Sky to Quarter Res Cubemap");
 			PipelineCacheRD *pipeline = &shader_data->pipelines[SKY_VERSION_CUBEMAP_QUARTER_RES];
-
-			Vector<Color> clear_colors;
-			clear_colors.push_back(Color(0.0, 0.0, 0.0));
-			RD::DrawListID cubemap_draw_list;
-
 			for (int i = 0; i < 6; i++) {
-				Basis local_view = Basis::looking_at(view_normals[i], view_up[i]);
-				RID texture_uniform_set = sky->get_textures(SKY_TEXTURE_SET_CUBEMAP_QUARTER_RES, sky_shader.default_shader_rd);
-
-				cubemap_draw_list = RD::get_singleton()->draw_list_begin(sky->reflection.layers[0].mipmaps[2].framebuffers[i], RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD);
-				_render_sky(cubemap_draw_list, p_time, sky->reflection.layers[0].mipmaps[2].framebuffers[i], pipeline, material->uniform_set, texture_uniform_set, 1, &cm, local_view, multiplier, p_transform.origin, p_luminance_multiplier);
-				RD::get_singleton()->draw_list_end();
+				_render_sky_cubemap_face(sky, material, pipeline, SKY_TEXTURE_SET_CUBEMAP_QUARTER_RES, 2, i, p_time, multiplier, p_transform.origin, p_luminance_multiplier);
 			}
 			RD::get_singleton()->draw_command_end_label();
 		}
@@ -1420,33 +1521,17 @@ void SkyRD::update(RendererSceneEnvironmentRD *p_env, const Projection &p_projec
 		if (shader_data->uses_half_res) {
 			RD::get_singleton()->draw_command_begin_label("Render Sky to Half Res Cubemap");
 			PipelineCacheRD *pipeline = &shader_data->pipelines[SKY_VERSION_CUBEMAP_HALF_RES];
-
-			Vector<Color> clear_colors;
-			clear_colors.push_back(Color(0.0, 0.0, 0.0));
-			RD::DrawListID cubemap_draw_list;
-
 			for (int i = 0; i < 6; i++) {
-				Basis local_view = Basis::looking_at(view_normals[i], view_up[i]);
-				RID texture_uniform_set = sky->get_textures(SKY_TEXTURE_SET_CUBEMAP_HALF_RES, sky_shader.default_shader_rd);
-
-				cubemap_draw_list = RD::get_singleton()->draw_list_begin(sky->reflection.layers[0].mipmaps[1].framebuffers[i], RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD);
-				_render_sky(cubemap_draw_list, p_time, sky->reflection.layers[0].mipmaps[1].framebuffers[i], pipeline, material->uniform_set, texture_uniform_set, 1, &cm, local_view, multiplier, p_transform.origin, p_luminance_multiplier);
-				RD::get_singleton()->draw_list_end();
+				_render_sky_cubemap_face(sky, material, pipeline, SKY_TEXTURE_SET_CUBEMAP_HALF_RES, 1, i, p_time, multiplier, p_transform.origin, p_luminance_multiplier);
 			}
 			RD::get_singleton()->draw_command_end_label();
 		}
 
-		RD::DrawListID cubemap_draw_list;
 		PipelineCacheRD *pipeline = &shader_data->pipelines[SKY_VERSION_CUBEMAP];
 
 		RD::get_singleton()->draw_command_begin_label("Render Sky Cubemap");
 		for (int i = 0; i < 6; i++) {
-			Basis local_view = Basis::looking_at(view_normals[i], view_up[i]);
-			RID texture_uniform_set = sky->get_textures(SKY_TEXTURE_SET_CUBEMAP, sky_shader.default_shader_rd);
-
-			cubemap_draw_list = RD::get_singleton()->draw_list_begin(sky->reflection.layers[0].mipmaps[0].framebuffers[i], RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD);
-			_render_sky(cubemap_draw_list, p_time, sky->reflection.layers[0].mipmaps[0].framebuffers[i], pipeline, material->uniform_set, texture_uniform_set, 1, &cm, local_view, multiplier, p_transform.origin, p_luminance_multiplier);
-			RD::get_singleton()->draw_list_end();
+			_render_sky_cubemap_face(sky, material, pipeline, SKY_TEXTURE_SET_CUBEMAP, 0, i, p_time, multiplier, p_transform.origin, p_luminance_multiplier);
 		}
 		RD::get_singleton()->draw_command_end_label();
 
@@ -1473,6 +1558,9 @@ void SkyRD::update(RendererSceneEnvironmentRD *p_env, const Projection &p_projec
 		}
 
 		sky->reflection.dirty = false;
+		sky->time_slice_ready = true;
+		sky->time_slice_mode = sky_mode;
+		sky->time_slice_settled = true;
 
 	} else {
 		if (sky_mode == RS::SKY_MODE_INCREMENTAL && sky->processing_layer < max_processing_layer) {
@@ -1860,6 +1948,8 @@ void SkyRD::update_dirty_skys() {
 
 		sky->reflection.dirty = true;
 		sky->processing_layer = 0;
+		sky->time_slice_ready = false;
+		sky->time_slice_step = -1;
 
 		Sky *next = sky->dirty_list;
 		sky->dirty_list = nullptr;
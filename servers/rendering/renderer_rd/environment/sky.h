@@ -113,6 +113,7 @@ private:
 		RID version;
 
 		PipelineCacheRD pipelines[SKY_VERSION_MAX];
+		PipelineCacheRD cubemap_blend_pipeline; // SKY_VERSION_CUBEMAP blended over the previous radiance, used by time sliced updates.
 		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
 		Vector<ShaderCompiler::GeneratedCode::Texture> texture_uniforms;
 
@@ -266,6 +267,13 @@ public:
 		int processing_layer = 0;
 		Sky *dirty_list = nullptr;
 
+		// State of time sliced updates of real-time and high quality skies.
+		bool time_slice_ready = false; // The radiance was fully updated once, so later updates have something to blend with.
+		int time_slice_step = -1; // Next step of the update in progress, or -1 if none is.
+		RS::SkyMode time_slice_mode = RS::SKY_MODE_AUTOMATIC;
+		bool time_slice_blend = false; // The update in progress blends the new faces with the previous radiance.
+		bool time_slice_settled = true; // The last update didn't blend, so the radiance matches the sky exactly.
+
 		//State to track when radiance cubemap needs updating
 		SkyMaterialData *prev_material = nullptr;
 		Vector3 prev_position;
@@ -282,6 +290,7 @@ public:
 
 	uint32_t sky_ggx_samples_quality;
 	bool sky_use_cubemap_array;
+	int sky_time_sliced_update_frames = 1;
 	Sky *dirty_sky_list = nullptr;
 	mutable RID_Owner<Sky, true> sky_owner;
 	int roughness_layers;
@@ -297,6 +306,9 @@ public:
 	void set_texture_format(RD::DataFormat p_texture_format);
 	~SkyRD();
 
+	void _render_sky_cubemap_face(Sky *p_sky, SkyMaterialData *p_material, PipelineCacheRD *p_pipeline, SkyTextureSetVersion p_texture_set, int p_mipmap, int p_face, double p_time, float p_multiplier, const Vector3 &p_position, float p_luminance_multiplier);
+	void _update_time_sliced(Sky *p_sky, SkyMaterialData *p_material, SkyShaderData *p_shader_data, RS::SkyMode p_sky_mode, int p_max_processing_layer, double p_time, float p_multiplier, const Vector3 &p_position, float p_luminance_multiplier);
+
 	void setup(RendererSceneEnvironmentRD *p_env, RID p_render_buffers, const PagedArray<RID> &p_lights, const Projection &p_projection, const Transform3D &p_transform, const Size2i p_screen_size, RendererSceneRenderRD *p_scene_render);
 	void update(RendererSceneEnvironmentRD *p_env, const Projection &p_projection, const Transform3D &p_transform, double p_time, float p_luminance_multiplier = 1.0);
 	void draw(RendererSceneEnvironmentRD *p_env, bool p_can_continue_color, bool p_can_continue_depth, RID p_fb, uint32_t p_view_count, const Projection *p_projections, const Transform3D &p_transform, double p_time); // only called by clustered renderer
@@ -421,7 +421,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	uint32_t render_list_thread_threshold = 500;
 
 	void _update_instance_data_buffer(RenderListType p_render_list);
-	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
+	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true, bool p_use_shadow_sort_keys = false);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi = false, bool p_using_opaque_gi = false, bool p_append = false);
 
 	HashMap<Size2i, RID> sdfgi_framebuffer_size_cache;
@@ -471,6 +471,22 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			};
 		} sort;
 
+		// Material shadow passes draw with, which is the shared default material for most opaque surfaces.
+		uint32_t shadow_material_id = 0;
+		uint32_t shadow_shader_id = 0;
+		uint32_t shadow_priority = 0;
+
+		// Sort keys with the shadow material in place of the surface material, so surfaces casting the same shadow are sorted and instanced together in shadow passes.
+		_FORCE_INLINE_ void get_shadow_sort_keys(uint64_t &r_sort_key1, uint64_t &r_sort_key2) const {
+			decltype(sort) shadow_sort = sort;
+			shadow_sort.material_id_low = shadow_material_id & 0xFFFF;
+			shadow_sort.material_id_hi = shadow_material_id >> 16;
+			shadow_sort.shader_id = shadow_shader_id;
+			shadow_sort.priority = shadow_priority;
+			r_sort_key1 = shadow_sort.sort_key1;
+			r_sort_key2 = shadow_sort.sort_key2;
+		}
+
 		RS::PrimitiveType primitive = RS::PRIMITIVE_MAX;
 		uint32_t flags = 0;
 		uint32_t surface_index = 0;
@@ -575,6 +591,20 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			sorter.sort(elements.ptr() + p_from, p_size);
 		}
 
+		struct SortByShadowKey {
+			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
+				uint64_t a_key1, a_key2, b_key1, b_key2;
+				A->get_shadow_sort_keys(a_key1, a_key2);
+				B->get_shadow_sort_keys(b_key1, b_key2);
+				return (a_key2 == b_key2) ? (a_key1 < b_key1) : (a_key2 < b_key2);
+			}
+		};
+
+		void sort_by_shadow_key_range(uint32_t p_from, uint32_t p_size) {
+			SortArray<GeometryInstanceSurfaceDataCache *, SortByShadowKey> sorter;
+			sorter.sort(elements.ptr() + p_from, p_size);
+		}
+
 		struct SortByDepth {
 			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
 				return (A->owner->depth < B->owner->depth);
@@ -31,7 +31,9 @@
 #include "pipeline_cache_rd.h"
 #include "core/os/memory.h"
 
-RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+bool PipelineCacheRD::async_compilation = false;
+
+RID PipelineCacheRD::_create_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
 	RD::PipelineMultisampleState multisample_state_version = multisample_state;
 	multisample_state_version.sample_count = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
 
@@ -56,24 +58,91 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 		bool_index++;
 	}
 
-	RID pipeline = RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
-	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	return RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
+}
+
+RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+	bool compile_async = async_compilation && p_bool_specializations != 0;
+
+	RID pipeline;
+	if (!compile_async) {
+		pipeline = _create_pipeline(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+		ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	}
+
+	uint32_t version = version_count;
 	versions = static_cast<Version *>(memrealloc(versions, sizeof(Version) * (version_count + 1)));
-	versions[version_count].framebuffer_id = p_framebuffer_format_id;
-	versions[version_count].vertex_id = p_vertex_format_id;
-	versions[version_count].wireframe = wireframe;
-	versions[version_count].pipeline = pipeline;
-	versions[version_count].render_pass = p_render_pass;
-	versions[version_count].bool_specializations = p_bool_specializations;
+	versions[version].framebuffer_id = p_framebuffer_format_id;
+	versions[version].vertex_id = p_vertex_format_id;
+	versions[version].wireframe = p_wireframe || rasterization_state.wireframe;
+	versions[version].pipeline = pipeline;
+	versions[version].render_pass = p_render_pass;
+	versions[version].bool_specializations = p_bool_specializations;
+	versions[version].compile_task = WorkerThreadPool::INVALID_TASK_ID;
 	version_count++;
+
+	if (compile_async) {
+		versions[version].compile_task = WorkerThreadPool::get_singleton()->add_template_task(this, &PipelineCacheRD::_compile_version_task, version, false, "PipelineCacheRD::compile");
+		return _get_compiling_version(version);
+	}
+
 	return pipeline;
 }
 
+RID PipelineCacheRD::_get_compiling_version(uint32_t p_version) {
+	// Called with the lock held.
+	Version &version = versions[p_version];
+	if (WorkerThreadPool::get_singleton()->is_task_completed(version.compile_task)) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(version.compile_task);
+		version.compile_task = WorkerThreadPool::INVALID_TASK_ID;
+		if (version.pipeline.is_valid()) {
+			return version.pipeline;
+		}
+		// Compiling failed, fall back to the pipeline without specializations from now on.
+	}
+
+	RD::VertexFormatID vertex_id = version.vertex_id;
+	RD::FramebufferFormatID framebuffer_id = version.framebuffer_id;
+	bool wireframe = version.wireframe;
+	uint32_t render_pass = version.render_pass;
+
+	// The list may be reallocated past this point, so don't use the version anymore.
+	for (uint32_t i = 0; i < version_count; i++) {
+		if (versions[i].vertex_id == vertex_id && versions[i].framebuffer_id == framebuffer_id && versions[i].wireframe == wireframe && versions[i].render_pass == render_pass && versions[i].bool_specializations == 0) {
+			return versions[i].pipeline;
+		}
+	}
+	return _generate_version(vertex_id, framebuffer_id, wireframe, render_pass, 0);
+}
+
+void PipelineCacheRD::_compile_version_task(uint32_t p_version) {
+	spin_lock.lock();
+	RD::VertexFormatID vertex_id = versions[p_version].vertex_id;
+	RD::FramebufferFormatID framebuffer_id = versions[p_version].framebuffer_id;
+	bool wireframe = versions[p_version].wireframe;
+	uint32_t render_pass = versions[p_version].render_pass;
+	uint32_t bool_specializations = versions[p_version].bool_specializations;
+	spin_lock.unlock();
+
+	RID pipeline = _create_pipeline(vertex_id, framebuffer_id, wireframe, render_pass, bool_specializations);
+
+	spin_lock.lock();
+	versions[p_version].pipeline = pipeline;
+	spin_lock.unlock();
+}
+
 void PipelineCacheRD::_clear() {
 #ifndef _MSC_VER
 #warning Clear should probably recompile all the variants already compiled instead to avoid stalls? needs discussion
 #endif
 	if (versions) {
+		// Pending compilations write to the version list, so wait for them before freeing it.
+		for (uint32_t i = 0; i < version_count; i++) {
+			if (versions[i].compile_task != WorkerThreadPool::INVALID_TASK_ID) {
+				WorkerThreadPool::get_singleton()->wait_for_task_completion(versions[i].compile_task);
+				versions[i].compile_task = WorkerThreadPool::INVALID_TASK_ID;
+			}
+		}
 		for (uint32_t i = 0; i < version_count; i++) {
 			//shader may be gone, so this may not be valid
 			if (RD::get_singleton()->render_pipeline_is_valid(versions[i].pipeline)) {
@@ -100,8 +169,8 @@ void PipelineCacheRD::setup(RID p_shader, RD::RenderPrimitive p_primitive, const
 	base_specialization_constants = p_base_specialization_constants;
 }
 void PipelineCacheRD::update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants) {
-	base_specialization_constants = p_base_specialization_constants;
 	_clear();
+	base_specialization_constants = p_base_specialization_constants;
 }
 
 void PipelineCacheRD::update_shader(RID p_shader) {
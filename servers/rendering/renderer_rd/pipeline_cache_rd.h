@@ -31,10 +31,13 @@
 #ifndef PIPELINE_CACHE_RD_H
 #define PIPELINE_CACHE_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/spin_lock.h"
 #include "servers/rendering/rendering_device.h"
 
 class PipelineCacheRD {
+	static bool async_compilation;
+
 	SpinLock spin_lock;
 
 	RID shader;
@@ -55,12 +58,16 @@ class PipelineCacheRD {
 		bool wireframe;
 		uint32_t bool_specializations;
 		RID pipeline;
+		WorkerThreadPool::TaskID compile_task; // Valid while the pipeline is compiled in the background.
 	};
 
 	Version *versions = nullptr;
 	uint32_t version_count;
 
+	RID _create_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations);
 	RID _generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations = 0);
+	RID _get_compiling_version(uint32_t p_version);
+	void _compile_version_task(uint32_t p_version);
 
 	void _clear();
 
@@ -79,7 +86,11 @@ public:
 		RID result;
 		for (uint32_t i = 0; i < version_count; i++) {
 			if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == p_wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == p_bool_specializations) {
-				result = versions[i].pipeline;
+				if (unlikely(versions[i].compile_task != WorkerThreadPool::INVALID_TASK_ID)) {
+					result = _get_compiling_version(i);
+				} else {
+					result = versions[i].pipeline;
+				}
 				spin_lock.unlock();
 				return result;
 			}
@@ -93,6 +104,12 @@ public:
 		return input_mask;
 	}
 	void clear();
+
+	// When enabled, pipelines using specializations are compiled on the WorkerThreadPool,
+	// and the pipeline without specializations is used until they are ready.
+	static void set_async_compilation(bool p_enable) { async_compilation = p_enable; }
+	static bool is_async_compilation_enabled() { return async_compilation; }
+
 	PipelineCacheRD();
 	~PipelineCacheRD();
 };
@@ -348,13 +348,19 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size) {
+void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, TextureBinding &r_binding, PushConstant &push_constant, Size2 &r_texpixel_size) {
 	if (p_texture == RID()) {
 		p_texture = default_canvas_texture;
 	}
 
-	if (r_last_texture == p_texture) {
-		return; //nothing to do, its the same
+	if (r_binding.texture == p_texture && r_binding.filter == p_base_filter && r_binding.repeat == p_base_repeat) {
+		//already bound, only restore the push constant values it needs
+		push_constant.flags = (push_constant.flags & ~(FLAGS_DEFAULT_SPECULAR_MAP_USED | FLAGS_DEFAULT_NORMAL_MAP_USED)) | r_binding.flags;
+		push_constant.specular_shininess = r_binding.specular_shininess;
+		push_constant.color_texture_pixel_size[0] = r_binding.texpixel_size.x;
+		push_constant.color_texture_pixel_size[1] = r_binding.texpixel_size.y;
+		r_texpixel_size = r_binding.texpixel_size;
+		return;
 	}
 
 	RID uniform_set;
@@ -366,7 +372,7 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, uniform_set, size, specular_shininess, use_normal, use_specular);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
+		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_binding, push_constant, r_texpixel_size);
 		return;
 	}
 
@@ -395,10 +401,15 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	push_constant.color_texture_pixel_size[0] = r_texpixel_size.x;
 	push_constant.color_texture_pixel_size[1] = r_texpixel_size.y;
 
-	r_last_texture = p_texture;
+	r_binding.texture = p_texture;
+	r_binding.filter = p_base_filter;
+	r_binding.repeat = p_base_repeat;
+	r_binding.texpixel_size = r_texpixel_size;
+	r_binding.flags = push_constant.flags & (FLAGS_DEFAULT_SPECULAR_MAP_USED | FLAGS_DEFAULT_NORMAL_MAP_USED);
+	r_binding.specular_shininess = push_constant.specular_shininess;
 }
 
-void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants) {
+void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, TextureBinding &r_texture_binding) {
 	//create an empty push constant
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
@@ -471,7 +482,6 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 	bool reclip = false;
 
-	RID last_texture;
 	Size2 texpixel_size;
 
 	bool skipping = false;
@@ -501,7 +511,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, r_texture_binding, push_constant, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect;
@@ -590,7 +600,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, r_texture_binding, push_constant, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
@@ -666,7 +676,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(p_draw_list, polygon->texture, current_filter, current_repeat, r_texture_binding, push_constant, texpixel_size);
 
 				push_constant.modulation[0] = base_color.r;
 				push_constant.modulation[1] = base_color.g;
@@ -700,7 +710,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, RID(), current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(p_draw_list, RID(), current_filter, current_repeat, r_texture_binding, push_constant, texpixel_size);
 
 				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
 
@@ -839,7 +849,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					break;
 				}
 
-				_bind_canvas_texture(p_draw_list, texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(p_draw_list, texture, current_filter, current_repeat, r_texture_binding, push_constant, texpixel_size);
 
 				uint32_t surf_count = mesh_storage->mesh_get_surface_count(mesh);
 				static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
@@ -1090,6 +1100,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 	RID prev_material;
 
 	PipelineVariants *pipeline_variants = &shader.pipeline_variants;
+	TextureBinding texture_binding;
 
 	for (int i = 0; i < p_item_count; i++) {
 		Item *ci = items[i];
@@ -1131,9 +1142,12 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 			} else {
 				pipeline_variants = &shader.pipeline_variants;
 			}
+
+			// A different shader may not keep the texture set bound, bind it again on next use.
+			texture_binding = TextureBinding();
 		}
 
-		_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants);
+		_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, texture_binding);
 
 		prev_material = material;
 	}
@@ -98,6 +98,8 @@ void RendererCompositorRD::begin_frame(double frame_step) {
 	delta = frame_step;
 	time += frame_step;
 
+	uniform_set_cache->begin_frame();
+
 	double time_roll_over = GLOBAL_GET("rendering/limits/time/time_rollover_secs");
 	time = Math::fmod(time, time_roll_over);
 
@@ -285,8 +287,18 @@ RendererCompositorRD::RendererCompositorRD() {
 				}
 			}
 		}
+
+		if (!Engine::get_singleton()->is_editor_hint()) {
+			// Shader versions precompiled by the exporter.
+			String bundle_dir = String("res://").plus_file(ShaderRD::BUNDLE_DIR);
+			if (DirAccess::exists(bundle_dir)) {
+				ShaderRD::set_shader_cache_bundle_dir(bundle_dir);
+			}
+		}
 	}
 
+	PipelineCacheRD::set_async_compilation(GLOBAL_GET("rendering/shader_compiler/async_pipeline_compilation"));
+
 	singleton = this;
 
 	utilities = memnew(RendererRD::Utilities);
@@ -317,4 +329,5 @@ RendererCompositorRD::RendererCompositorRD() {
 RendererCompositorRD::~RendererCompositorRD() {
 	memdelete(uniform_set_cache);
 	ShaderRD::set_shader_cache_dir(String());
+	ShaderRD::set_shader_cache_bundle_dir(String());
 }
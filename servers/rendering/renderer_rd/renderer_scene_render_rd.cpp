@@ -671,12 +671,31 @@ void RendererSceneRenderRD::reflection_probe_release_atlas_index(RID p_instance)
 	}
 	ReflectionAtlas *atlas = reflection_atlas_owner.get_or_null(rpi->atlas);
 	ERR_FAIL_COND(!atlas);
-	ERR_FAIL_INDEX(rpi->atlas_index, atlas->reflections.size());
-	atlas->reflections.write[rpi->atlas_index].owner = RID();
+	if (rpi->atlas_index != -1) {
+		ERR_FAIL_INDEX(rpi->atlas_index, atlas->reflections.size());
+		atlas->reflections.write[rpi->atlas_index].owner = RID();
+	}
+	if (rpi->render_atlas_index != -1 && rpi->render_atlas_index != rpi->atlas_index) {
+		ERR_FAIL_INDEX(rpi->render_atlas_index, atlas->reflections.size());
+		atlas->reflections.write[rpi->render_atlas_index].owner = RID();
+	}
 	rpi->atlas_index = -1;
+	rpi->render_atlas_index = -1;
 	rpi->atlas = RID();
 }
 
+void RendererSceneRenderRD::_reflection_probe_swap_atlas_index(ReflectionProbeInstance *rpi, ReflectionAtlas *atlas) {
+	if (rpi->render_atlas_index == rpi->atlas_index) {
+		return;
+	}
+
+	// The new reflection is fully filtered, stop sampling the old one.
+	if (rpi->atlas_index != -1) {
+		atlas->reflections.write[rpi->atlas_index].owner = RID();
+	}
+	rpi->atlas_index = rpi->render_atlas_index;
+}
+
 bool RendererSceneRenderRD::reflection_probe_instance_needs_redraw(RID p_instance) {
 	ReflectionProbeInstance *rpi = reflection_probe_instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND_V(!rpi, false);
@@ -700,7 +719,7 @@ bool RendererSceneRenderRD::reflection_probe_instance_has_reflection(RID p_insta
 	ReflectionProbeInstance *rpi = reflection_probe_instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND_V(!rpi, false);
 
-	return rpi->atlas.is_valid();
+	return rpi->atlas.is_valid() && rpi->atlas_index != -1;
 }
 
 bool RendererSceneRenderRD::reflection_probe_instance_begin_render(RID p_instance, RID p_reflection_atlas) {
@@ -770,30 +789,36 @@ bool RendererSceneRenderRD::reflection_probe_instance_begin_render(RID p_instanc
 		atlas->depth_fb = RD::get_singleton()->framebuffer_create(fb);
 	}
 
-	if (rpi->atlas_index == -1) {
-		for (int i = 0; i < atlas->reflections.size(); i++) {
-			if (atlas->reflections[i].owner.is_null()) {
-				rpi->atlas_index = i;
-				break;
-			}
+	// Render to a spare slot when there is one, so the scene keeps sampling the previous reflection until the new one is filtered,
+	// instead of seeing the faces and roughness layers change over the frames the update is spread over.
+	rpi->render_atlas_index = -1;
+	for (int i = 0; i < atlas->reflections.size(); i++) {
+		if (atlas->reflections[i].owner.is_null()) {
+			rpi->render_atlas_index = i;
+			break;
 		}
-		//find the one used last
-		if (rpi->atlas_index == -1) {
-			//everything is in use, find the one least used via LRU
-			uint64_t pass_min = 0;
+	}
 
-			for (int i = 0; i < atlas->reflections.size(); i++) {
-				ReflectionProbeInstance *rpi2 = reflection_probe_instance_owner.get_or_null(atlas->reflections[i].owner);
-				if (rpi2->last_pass < pass_min) {
-					pass_min = rpi2->last_pass;
-					rpi->atlas_index = i;
-				}
+	if (rpi->render_atlas_index == -1) {
+		rpi->render_atlas_index = rpi->atlas_index;
+	}
+
+	//find the one used last
+	if (rpi->render_atlas_index == -1) {
+		//everything is in use, find the one least used via LRU
+		uint64_t pass_min = 0;
+
+		for (int i = 0; i < atlas->reflections.size(); i++) {
+			ReflectionProbeInstance *rpi2 = reflection_probe_instance_owner.get_or_null(atlas->reflections[i].owner);
+			if (rpi2->last_pass < pass_min) {
+				pass_min = rpi2->last_pass;
+				rpi->render_atlas_index = i;
 			}
 		}
 	}
 
-	if (rpi->atlas_index != -1) { // should we fail if this is still -1 ?
-		atlas->reflections.write[rpi->atlas_index].owner = p_instance;
+	if (rpi->render_atlas_index != -1) { // should we fail if this is still -1 ?
+		atlas->reflections.write[rpi->render_atlas_index].owner = p_instance;
 	}
 
 	rpi->atlas = p_reflection_atlas;
@@ -821,7 +846,7 @@ bool RendererSceneRenderRD::reflection_probe_instance_postprocess_step(RID p_ins
 	ERR_FAIL_COND_V(rpi->atlas.is_null(), false);
 
 	ReflectionAtlas *atlas = reflection_atlas_owner.get_or_null(rpi->atlas);
-	if (!atlas || rpi->atlas_index == -1) {
+	if (!atlas || rpi->render_atlas_index == -1) {
 		//does not belong to an atlas anymore, cancel (was removed from atlas or atlas changed while rendering)
 		rpi->rendering = false;
 		return false;
@@ -829,7 +854,8 @@ bool RendererSceneRenderRD::reflection_probe_instance_postprocess_step(RID p_ins
 
 	if (RSG::light_storage->reflection_probe_get_update_mode(rpi->probe) == RS::REFLECTION_PROBE_UPDATE_ALWAYS) {
 		// Using real time reflections, all roughness is done in one step
-		atlas->reflections.write[rpi->atlas_index].data.create_reflection_fast_filter(false);
+		atlas->reflections.write[rpi->render_atlas_index].data.create_reflection_fast_filter(false);
+		_reflection_probe_swap_atlas_index(rpi, atlas);
 		rpi->rendering = false;
 		rpi->processing_side = 0;
 		rpi->processing_layer = 1;
@@ -837,9 +863,10 @@ bool RendererSceneRenderRD::reflection_probe_instance_postprocess_step(RID p_ins
 	}
 
 	if (rpi->processing_layer > 1) {
-		atlas->reflections.write[rpi->atlas_index].data.create_reflection_importance_sample(false, 10, rpi->processing_layer, sky.sky_ggx_samples_quality);
+		atlas->reflections.write[rpi->render_atlas_index].data.create_reflection_importance_sample(false, 10, rpi->processing_layer, sky.sky_ggx_samples_quality);
 		rpi->processing_layer++;
-		if (rpi->processing_layer == atlas->reflections[rpi->atlas_index].data.layers[0].mipmaps.size()) {
+		if (rpi->processing_layer == atlas->reflections[rpi->render_atlas_index].data.layers[0].mipmaps.size()) {
+			_reflection_probe_swap_atlas_index(rpi, atlas);
 			rpi->rendering = false;
 			rpi->processing_side = 0;
 			rpi->processing_layer = 1;
@@ -848,7 +875,7 @@ bool RendererSceneRenderRD::reflection_probe_instance_postprocess_step(RID p_ins
 		return false;
 
 	} else {
-		atlas->reflections.write[rpi->atlas_index].data.create_reflection_importance_sample(false, rpi->processing_side, rpi->processing_layer, sky.sky_ggx_samples_quality);
+		atlas->reflections.write[rpi->render_atlas_index].data.create_reflection_importance_sample(false, rpi->processing_side, rpi->processing_layer, sky.sky_ggx_samples_quality);
 	}
 
 	rpi->processing_side++;
@@ -876,7 +903,7 @@ RID RendererSceneRenderRD::reflection_probe_instance_get_framebuffer(RID p_insta
 
 	ReflectionAtlas *atlas = reflection_atlas_owner.get_or_null(rpi->atlas);
 	ERR_FAIL_COND_V(!atlas, RID());
-	return atlas->reflections[rpi->atlas_index].fbs[p_index];
+	return atlas->reflections[rpi->render_atlas_index].fbs[p_index];
 }
 
 RID RendererSceneRenderRD::reflection_probe_instance_get_depth_framebuffer(RID p_instance, int p_index) {
@@ -902,11 +929,21 @@ void RendererSceneRenderRD::_update_shadow_atlas(ShadowAtlas *shadow_atlas) {
 		tf.width = shadow_atlas->size;
 		tf.height = shadow_atlas->size;
 		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		if (shadow_atlas_cache_static_casters) {
+			tf.usage_bits |= RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+		}
 
 		shadow_atlas->depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
 		fb_tex.push_back(shadow_atlas->depth);
 		shadow_atlas->fb = RD::get_singleton()->framebuffer_create(fb_tex);
+
+		if (shadow_atlas_cache_static_casters) {
+			tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT;
+			shadow_atlas->static_depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
+			fb_tex.write[0] = shadow_atlas->static_depth;
+			shadow_atlas->static_fb = RD::get_singleton()->framebuffer_create(fb_tex);
+		}
 	}
 }
 
@@ -925,6 +962,10 @@ void RendererSceneRenderRD::shadow_atlas_set_size(RID p_atlas, int p_size, bool
 		RD::get_singleton()->free(shadow_atlas->depth);
 		shadow_atlas->depth = RID();
 	}
+	if (shadow_atlas->static_depth.is_valid()) {
+		RD::get_singleton()->free(shadow_atlas->static_depth);
+		shadow_atlas->static_depth = RID();
+	}
 	for (int i = 0; i < 4; i++) {
 		//clear subdivisions
 		shadow_atlas->quadrants[i].shadows.clear();
@@ -1218,10 +1259,12 @@ bool RendererSceneRenderRD::shadow_atlas_update_light(RID p_atlas, RID p_light_i
 	if (found_shadow) {
 		if (old_quadrant != ShadowAtlas::SHADOW_INVALID) {
 			shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow].version = 0;
+			shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow].static_version = 0;
 			shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow].owner = RID();
 
 			if (old_key & ShadowAtlas::OMNI_LIGHT_FLAG) {
 				shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow + 1].version = 0;
+				shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow + 1].static_version = 0;
 				shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow + 1].owner = RID();
 			}
 		}
@@ -1235,6 +1278,7 @@ bool RendererSceneRenderRD::shadow_atlas_update_light(RID p_atlas, RID p_light_i
 		sh->owner = p_light_instance;
 		sh->alloc_tick = tick;
 		sh->version = p_light_version;
+		sh->static_version = 0;
 
 		if (is_omni) {
 			new_key |= ShadowAtlas::OMNI_LIGHT_FLAG;
@@ -1246,6 +1290,7 @@ bool RendererSceneRenderRD::shadow_atlas_update_light(RID p_atlas, RID p_light_i
 			extra_sh->owner = p_light_instance;
 			extra_sh->alloc_tick = tick;
 			extra_sh->version = p_light_version;
+			extra_sh->static_version = 0;
 		}
 
 		li->shadow_atlases.insert(p_atlas);
@@ -1259,6 +1304,43 @@ bool RendererSceneRenderRD::shadow_atlas_update_light(RID p_atlas, RID p_light_i
 	return should_redraw;
 }
 
+bool RendererSceneRenderRD::shadow_atlas_static_cache_is_valid(RID p_atlas, RID p_light_instance, uint64_t p_static_version) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_atlas);
+	ERR_FAIL_COND_V(!shadow_atlas, false);
+
+	const uint32_t *key = shadow_atlas->shadow_owners.getptr(p_light_instance);
+	if (!key || shadow_atlas->static_depth.is_null()) {
+		return false;
+	}
+
+	uint32_t quadrant = (*key >> ShadowAtlas::QUADRANT_SHIFT) & 0x3;
+	uint32_t shadow = *key & ShadowAtlas::SHADOW_INDEX_MASK;
+	ERR_FAIL_INDEX_V((int)shadow, shadow_atlas->quadrants[quadrant].shadows.size(), false);
+
+	return p_static_version != 0 && shadow_atlas->quadrants[quadrant].shadows[shadow].static_version == p_static_version;
+}
+
+void RendererSceneRenderRD::_shadow_atlas_copy_static_cache(ShadowAtlas *p_shadow_atlas, RID p_light_instance, int p_pass) {
+	ERR_FAIL_COND(p_shadow_atlas->static_depth.is_null());
+	ERR_FAIL_COND(!p_shadow_atlas->shadow_owners.has(p_light_instance));
+
+	uint32_t key = p_shadow_atlas->shadow_owners[p_light_instance];
+	uint32_t quadrant = (key >> ShadowAtlas::QUADRANT_SHIFT) & 0x3;
+	// The second paraboloid of omni lights is in the next shadow.
+	uint32_t shadow = (key & ShadowAtlas::SHADOW_INDEX_MASK) + p_pass;
+	ERR_FAIL_INDEX((int)shadow, p_shadow_atlas->quadrants[quadrant].shadows.size());
+
+	uint32_t subdivision = p_shadow_atlas->quadrants[quadrant].subdivision;
+	uint32_t quadrant_size = p_shadow_atlas->size >> 1;
+	uint32_t shadow_size = quadrant_size / subdivision;
+
+	Vector3 position;
+	position.x = (quadrant & 1) * quadrant_size + (shadow % subdivision) * shadow_size;
+	position.y = (quadrant >> 1) * quadrant_size + (shadow / subdivision) * shadow_size;
+
+	RD::get_singleton()->texture_copy(p_shadow_atlas->static_depth, p_shadow_atlas->depth, position, position, Vector3(shadow_size, shadow_size, 1), 0, 0, 0, 0);
+}
+
 void RendererSceneRenderRD::_shadow_atlas_invalidate_shadow(RendererSceneRenderRD::ShadowAtlas::Quadrant::Shadow *p_shadow, RID p_atlas, RendererSceneRenderRD::ShadowAtlas *p_shadow_atlas, uint32_t p_quadrant, uint32_t p_shadow_idx) {
 	if (p_shadow->owner.is_valid()) {
 		LightInstance *sli = light_instance_owner.get_or_null(p_shadow->owner);
@@ -1269,11 +1351,13 @@ void RendererSceneRenderRD::_shadow_atlas_invalidate_shadow(RendererSceneRenderR
 			uint32_t omni_shadow_idx = p_shadow_idx + (s == (uint32_t)p_shadow_idx ? 1 : -1);
 			RendererSceneRenderRD::ShadowAtlas::Quadrant::Shadow *omni_shadow = &p_shadow_atlas->quadrants[p_quadrant].shadows.write[omni_shadow_idx];
 			omni_shadow->version = 0;
+			omni_shadow->static_version = 0;
 			omni_shadow->owner = RID();
 		}
 
 		p_shadow_atlas->shadow_owners.erase(p_shadow->owner);
 		p_shadow->version = 0;
+		p_shadow->static_version = 0;
 		p_shadow->owner = RID();
 		sli->shadow_atlases.erase(p_atlas);
 	}
@@ -1908,10 +1992,34 @@ void RendererSceneRenderRD::_free_render_buffer_data(RenderBuffers *rb) {
 		RD::get_singleton()->free(rb->taa.prev_velocity);
 		rb->taa.prev_velocity = RID();
 	}
+	rb->taa.upscaled = false;
 
 	rb->rbgi.free();
 }
 
+void RendererSceneRenderRD::_free_unused_effect_buffers(RenderBuffers *rb) {
+	// These are only allocated when an effect is enabled, free them again when the environment stops using it.
+	uint64_t frames_unused = UNUSED_EFFECT_BUFFERS_FREE_FRAMES;
+
+	if (rb->ss_effects.linear_depth.is_valid() && rb->frames_rendered - rb->ss_effects.linear_depth_last_used > frames_unused) {
+		RD::get_singleton()->free(rb->ss_effects.linear_depth);
+		rb->ss_effects.linear_depth = RID();
+		rb->ss_effects.linear_depth_slices.clear();
+	}
+
+	if (ss_effects) {
+		if (rb->frames_rendered - rb->ss_effects.ssao_last_used > frames_unused) {
+			ss_effects->ssao_free(rb->ss_effects.ssao);
+		}
+		if (rb->frames_rendered - rb->ss_effects.ssil_last_used > frames_unused) {
+			ss_effects->ssil_free(rb->ss_effects.ssil);
+		}
+		if (rb->ssr.output.is_valid() && rb->frames_rendered - rb->ssr_last_used > frames_unused) {
+			ss_effects->ssr_free(rb->ssr);
+		}
+	}
+}
+
 void RendererSceneRenderRD::_process_sss(RID p_render_buffers, const Projection &p_camera) {
 	RenderBuffers *rb = render_buffers_owner.get_or_null(p_render_buffers);
 	ERR_FAIL_COND(!rb);
@@ -1950,6 +2058,7 @@ void RendererSceneRenderRD::_process_ssr(RID p_render_buffers, RID p_dest_frameb
 	ERR_FAIL_COND(!env->ssr_enabled);
 
 	Size2i half_size = Size2i(rb->internal_width / 2, rb->internal_height / 2);
+	rb->ssr_last_used = rb->frames_rendered;
 	if (rb->ssr.output.is_null()) {
 		ss_effects->ssr_allocate_buffers(rb->ssr, _render_buffers_get_color_format(), ssr_roughness_quality, half_size, rb->view_count);
 	}
@@ -1990,6 +2099,7 @@ void RendererSceneRenderRD::_process_ssao(RID p_render_buffers, RID p_environmen
 	settings.fadeout_to = ssao_fadeout_to;
 	settings.full_screen_size = Size2i(rb->internal_width, rb->internal_height);
 
+	rb->ss_effects.ssao_last_used = rb->frames_rendered;
 	ss_effects->ssao_allocate_buffers(rb->ss_effects.ssao, settings, rb->ss_effects.linear_depth);
 	ss_effects->generate_ssao(rb->ss_effects.ssao, p_normal_buffer, p_projection, settings);
 }
@@ -2026,6 +2136,7 @@ void RendererSceneRenderRD::_process_ssil(RID p_render_buffers, RID p_environmen
 	transform.set_origin(Vector3(0.0, 0.0, 0.0));
 	Projection last_frame_projection = rb->ss_effects.last_frame_projection * Projection(rb->ss_effects.last_frame_transform.affine_inverse()) * Projection(transform) * projection.inverse();
 
+	rb->ss_effects.ssil_last_used = rb->frames_rendered;
 	ss_effects->ssil_allocate_buffers(rb->ss_effects.ssil, settings, rb->ss_effects.linear_depth);
 	ss_effects->screen_space_indirect_lighting(rb->ss_effects.ssil, p_normal_buffer, p_projection, last_frame_projection, settings);
 	rb->ss_effects.last_frame_projection = projection;
@@ -2049,10 +2160,13 @@ void RendererSceneRenderRD::_copy_framebuffer_to_ssil(RID p_render_buffers) {
 	}
 }
 
-void RendererSceneRenderRD::_process_taa(RID p_render_buffers, RID p_velocity_buffer, float p_z_near, float p_z_far) {
+void RendererSceneRenderRD::_process_taa(RID p_render_buffers, RID p_velocity_buffer, float p_z_near, float p_z_far, const Vector2 &p_jitter) {
 	RenderBuffers *rb = render_buffers_owner.get_or_null(p_render_buffers);
 	ERR_FAIL_COND(!rb);
 
+	// Temporal upscaling keeps the history at output resolution, and resolves the internal texture into it.
+	bool upscale = rb->scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL && (rb->internal_width != rb->width || rb->internal_height != rb->height);
+
 	bool just_allocated = false;
 	if (rb->taa.history.is_null()) {
 		RD::TextureFormat tf;
@@ -2060,27 +2174,39 @@ void RendererSceneRenderRD::_process_taa(RID p_render_buffers, RID p_velocity_bu
 			tf.texture_type = RD::TEXTURE_TYPE_2D_ARRAY;
 		}
 		tf.format = _render_buffers_get_color_format();
-		tf.width = rb->internal_width;
-		tf.height = rb->internal_height;
+		tf.width = upscale ? rb->width : rb->internal_width;
+		tf.height = upscale ? rb->height : rb->internal_height;
 		tf.array_layers = rb->view_count; // create a layer for every view
 		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | (_render_buffers_can_be_storage() ? RD::TEXTURE_USAGE_STORAGE_BIT : 0);
 
 		rb->taa.history = RD::get_singleton()->texture_create(tf, RD::TextureView());
-		rb->taa.temp = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		if (!upscale) {
+			rb->taa.temp = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		}
 
+		tf.width = rb->internal_width;
+		tf.height = rb->internal_height;
 		tf.format = RD::DATA_FORMAT_R16G16_SFLOAT;
 		rb->taa.prev_velocity = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		just_allocated = true;
 	}
 
 	RD::get_singleton()->draw_command_begin_label("TAA");
-	if (!just_allocated) {
-		RendererCompositorRD::singleton->get_effects()->taa_resolve(rb->internal_texture, rb->taa.temp, rb->depth_texture, p_velocity_buffer, rb->taa.prev_velocity, rb->taa.history, Size2(rb->internal_width, rb->internal_height), p_z_near, p_z_far);
-		copy_effects->copy_to_rect(rb->taa.temp, rb->internal_texture, Rect2(0, 0, rb->internal_width, rb->internal_height));
+	if (upscale) {
+		// The upscale writes straight to the output texture, which replaces the FSR pass after tonemapping.
+		RendererCompositorRD::singleton->get_effects()->taa_upscale(rb->internal_texture, rb->texture, rb->depth_texture, p_velocity_buffer, rb->taa.prev_velocity, rb->taa.history, Size2(rb->internal_width, rb->internal_height), Size2(rb->width, rb->height), p_jitter, just_allocated);
+		copy_effects->copy_to_rect(rb->texture, rb->taa.history, Rect2(0, 0, rb->width, rb->height));
+	} else {
+		if (!just_allocated) {
+			RendererCompositorRD::singleton->get_effects()->taa_resolve(rb->internal_texture, rb->taa.temp, rb->depth_texture, p_velocity_buffer, rb->taa.prev_velocity, rb->taa.history, Size2(rb->internal_width, rb->internal_height), p_z_near, p_z_far);
+			copy_effects->copy_to_rect(rb->taa.temp, rb->internal_texture, Rect2(0, 0, rb->internal_width, rb->internal_height));
+		}
+
+		copy_effects->copy_to_rect(rb->internal_texture, rb->taa.history, Rect2(0, 0, rb->internal_width, rb->internal_height));
 	}
+	rb->taa.upscaled = upscale;
 
-	copy_effects->copy_to_rect(rb->internal_texture, rb->taa.history, Rect2(0, 0, rb->internal_width, rb->internal_height));
-	copy_effects->copy_to_rect(p_velocity_buffer, rb->taa.prev_velocity, Rect2(0, 0, rb->width, rb->height));
+	copy_effects->copy_to_rect(p_velocity_buffer, rb->taa.prev_velocity, Rect2(0, 0, rb->internal_width, rb->internal_height));
 	RD::get_singleton()->draw_command_end_label();
 }
 
@@ -2321,7 +2447,7 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		}
 
 		tonemap.use_debanding = rb->use_debanding;
-		tonemap.texture_size = Vector2i(rb->internal_width, rb->internal_height);
+		tonemap.texture_size = rb->taa.upscaled ? Vector2i(rb->width, rb->height) : Vector2i(rb->internal_width, rb->internal_height);
 
 		if (env) {
 			tonemap.tonemap_mode = env->tone_mapper;
@@ -2352,12 +2478,12 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		tonemap.luminance_multiplier = _render_buffers_get_luminance_multiplier();
 		tonemap.view_count = p_render_data->view_count;
 
-		tone_mapper->tonemapper(rb->internal_texture, texture_storage->render_target_get_rd_framebuffer(rb->render_target), tonemap);
+		tone_mapper->tonemapper(rb->taa.upscaled ? rb->texture : rb->internal_texture, texture_storage->render_target_get_rd_framebuffer(rb->render_target), tonemap);
 
 		RD::get_singleton()->draw_command_end_label();
 	}
 
-	if (can_use_effects && can_use_storage && (rb->internal_width != rb->width || rb->internal_height != rb->height)) {
+	if (can_use_effects && can_use_storage && !rb->taa.upscaled && (rb->internal_width != rb->width || rb->internal_height != rb->height)) {
 		RD::get_singleton()->draw_command_begin_label("FSR 1.0 Upscale");
 
 		RendererCompositorRD::singleton->get_effects()->fsr_upscale(rb->internal_texture, rb->upscale_texture, rb->texture, Size2i(rb->internal_width, rb->internal_height), Size2i(rb->width, rb->height), rb->fsr_sharpness);
@@ -2743,7 +2869,7 @@ bool RendererSceneRenderRD::_render_buffers_can_be_storage() {
 	return true;
 }
 
-void RendererSceneRenderRD::render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RenderingServer::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) {
+void RendererSceneRenderRD::render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, RS::ViewportScaling3DMode p_scaling_3d_mode, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RenderingServer::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) {
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
@@ -2767,6 +2893,7 @@ void RendererSceneRenderRD::render_buffers_configure(RID p_render_buffers, RID p
 	rb->internal_height = p_internal_height;
 	rb->width = p_width;
 	rb->height = p_height;
+	rb->scaling_3d_mode = p_scaling_3d_mode;
 	rb->fsr_sharpness = p_fsr_sharpness;
 	rb->render_target = p_render_target;
 	rb->msaa = p_msaa;
@@ -3792,6 +3919,7 @@ void RendererSceneRenderRD::_pre_opaque_render(RenderDataRD *p_render_data, bool
 
 	render_state.cube_shadows.clear();
 	render_state.shadows.clear();
+	render_state.static_shadows.clear();
 	render_state.directional_shadows.clear();
 
 	Plane camera_plane(-p_render_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->cam_transform.origin);
@@ -3806,6 +3934,9 @@ void RendererSceneRenderRD::_pre_opaque_render(RenderDataRD *p_render_data, bool
 				render_state.cube_shadows.push_back(i);
 			} else {
 				render_state.shadows.push_back(i);
+				if (render_state.render_shadows[i].update_static_cache) {
+					render_state.static_shadows.push_back(i);
+				}
 			}
 		}
 
@@ -3814,6 +3945,32 @@ void RendererSceneRenderRD::_pre_opaque_render(RenderDataRD *p_render_data, bool
 			_render_shadow_pass(render_state.render_shadows[render_state.cube_shadows[i]].light, p_render_data->shadow_atlas, render_state.render_shadows[render_state.cube_shadows[i]].pass, render_state.render_shadows[render_state.cube_shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->screen_mesh_lod_threshold, true, true, true, p_render_data->render_info);
 		}
 
+		if (render_state.static_shadows.size()) {
+			//redraw the static casters into the static cache first, the copies below need them
+			_render_shadow_begin();
+			for (uint32_t i = 0; i < render_state.static_shadows.size(); i++) {
+				const RenderShadowData &shadow_data = render_state.render_shadows[render_state.static_shadows[i]];
+				_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.static_instances, camera_plane, lod_distance_multiplier, p_render_data->screen_mesh_lod_threshold, i == 0, i == render_state.static_shadows.size() - 1, true, p_render_data->render_info, true);
+			}
+			_render_shadow_process();
+			_render_shadow_end();
+
+			ShadowAtlas *shadow_atlas = shadow_atlas_owner.get_or_null(p_render_data->shadow_atlas);
+			for (uint32_t i = 0; i < render_state.static_shadows.size(); i++) {
+				const RenderShadowData &shadow_data = render_state.render_shadows[render_state.static_shadows[i]];
+				uint32_t key = shadow_atlas->shadow_owners[shadow_data.light];
+				ShadowAtlas::Quadrant &quadrant = shadow_atlas->quadrants[(key >> ShadowAtlas::QUADRANT_SHIFT) & 0x3];
+				quadrant.shadows.write[(key & ShadowAtlas::SHADOW_INDEX_MASK) + shadow_data.pass].static_version = shadow_data.static_version;
+			}
+		}
+
+		for (uint32_t i = 0; i < render_state.shadows.size(); i++) {
+			const RenderShadowData &shadow_data = render_state.render_shadows[render_state.shadows[i]];
+			if (shadow_data.use_static_cache) {
+				_shadow_atlas_copy_static_cache(shadow_atlas_owner.get_or_null(p_render_data->shadow_atlas), shadow_data.light, shadow_data.pass);
+			}
+		}
+
 		if (render_state.directional_shadows.size()) {
 			//open the pass for directional shadows
 			_update_directional_shadow_atlas();
@@ -3843,9 +4000,10 @@ void RendererSceneRenderRD::_pre_opaque_render(RenderDataRD *p_render_data, bool
 		for (uint32_t i = 0; i < render_state.directional_shadows.size(); i++) {
 			_render_shadow_pass(render_state.render_shadows[render_state.directional_shadows[i]].light, p_render_data->shadow_atlas, render_state.render_shadows[render_state.directional_shadows[i]].pass, render_state.render_shadows[render_state.directional_shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->screen_mesh_lod_threshold, false, i == render_state.directional_shadows.size() - 1, false, p_render_data->render_info);
 		}
-		//render positional shadows
+		//render positional shadows, over the static cache when it's used
 		for (uint32_t i = 0; i < render_state.shadows.size(); i++) {
-			_render_shadow_pass(render_state.render_shadows[render_state.shadows[i]].light, p_render_data->shadow_atlas, render_state.render_shadows[render_state.shadows[i]].pass, render_state.render_shadows[render_state.shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->screen_mesh_lod_threshold, i == 0, i == render_state.shadows.size() - 1, true, p_render_data->render_info);
+			const RenderShadowData &shadow_data = render_state.render_shadows[render_state.shadows[i]];
+			_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, camera_plane, lod_distance_multiplier, p_render_data->screen_mesh_lod_threshold, i == 0, i == render_state.shadows.size() - 1, !shadow_data.use_static_cache, p_render_data->render_info);
 		}
 
 		_render_shadow_process();
@@ -3871,6 +4029,7 @@ void RendererSceneRenderRD::_pre_opaque_render(RenderDataRD *p_render_data, bool
 			ERR_FAIL_COND(!rb);
 
 			bool invalidate_uniform_set = false;
+			rb->ss_effects.linear_depth_last_used = rb->frames_rendered;
 			if (rb->ss_effects.linear_depth.is_null()) {
 				RD::TextureFormat tf;
 				tf.format = RD::DATA_FORMAT_R16_SFLOAT;
@@ -3955,6 +4114,9 @@ void RendererSceneRenderRD::render_scene(RID p_render_buffers, const CameraData
 	if (p_render_buffers.is_valid()) {
 		rb = render_buffers_owner.get_or_null(p_render_buffers);
 		ERR_FAIL_COND(!rb);
+
+		rb->frames_rendered++;
+		_free_unused_effect_buffers(rb);
 	}
 
 	//assign render data
@@ -4027,12 +4189,20 @@ void RendererSceneRenderRD::render_scene(RID p_render_buffers, const CameraData
 
 	//sdfgi first
 	if (rb != nullptr && rb->sdfgi != nullptr) {
+		// Measured to know how many regions fit in the update budget.
+		bool measure_regions = gi.sdfgi_update_budget_msec > 0.0 && render_state.render_sdfgi_region_count > 0;
+		if (measure_regions) {
+			rb->sdfgi->begin_region_timing();
+		}
 		for (int i = 0; i < render_state.render_sdfgi_region_count; i++) {
 			rb->sdfgi->render_region(p_render_buffers, render_state.render_sdfgi_regions[i].region, render_state.render_sdfgi_regions[i].instances, this);
 		}
 		if (render_state.sdfgi_update_data->update_static) {
 			rb->sdfgi->render_static_lights(p_render_buffers, render_state.sdfgi_update_data->static_cascade_count, p_sdfgi_update_data->static_cascade_indices, render_state.sdfgi_update_data->static_positional_lights, this);
 		}
+		if (measure_regions) {
+			rb->sdfgi->end_region_timing();
+		}
 	}
 
 	Color clear_color;
@@ -4142,7 +4312,7 @@ void RendererSceneRenderRD::_debug_draw_cluster(RID p_render_buffers) {
 	}
 }
 
-void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RendererScene::RenderInfo *p_render_info) {
+void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RendererScene::RenderInfo *p_render_info, bool p_static_cache) {
 	LightInstance *light_instance = light_instance_owner.get_or_null(p_light);
 	ERR_FAIL_COND(!light_instance);
 
@@ -4276,7 +4446,7 @@ void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas,
 
 				using_dual_paraboloid = true;
 				using_dual_paraboloid_flip = p_pass == 1;
-				render_fb = shadow_atlas->fb;
+				render_fb = p_static_cache ? shadow_atlas->static_fb : shadow_atlas->fb;
 				flip_y = true;
 			}
 
@@ -4284,7 +4454,7 @@ void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas,
 			light_projection = light_instance->shadow_transform[0].camera;
 			light_transform = light_instance->shadow_transform[0].transform;
 
-			render_fb = shadow_atlas->fb;
+			render_fb = p_static_cache ? shadow_atlas->static_fb : shadow_atlas->fb;
 
 			flip_y = true;
 		}
@@ -4623,6 +4793,7 @@ void RendererSceneRenderRD::init() {
 
 	directional_shadow.size = GLOBAL_GET("rendering/shadows/directional_shadow/size");
 	directional_shadow.use_16_bits = GLOBAL_GET("rendering/shadows/directional_shadow/16_bits");
+	shadow_atlas_cache_static_casters = GLOBAL_GET("rendering/shadows/positional_shadow/cache_static_casters");
 
 	/* SKY SHADER */
 
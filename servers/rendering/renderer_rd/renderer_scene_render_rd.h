@@ -146,7 +146,7 @@ protected:
 	void _process_ssil(RID p_render_buffers, RID p_environment, RID p_normal_buffer, const Projection &p_projection, const Transform3D &p_transform);
 
 	void _copy_framebuffer_to_ssil(RID p_render_buffers);
-	void _process_taa(RID p_render_buffers, RID p_velocity_buffer, float p_z_near, float p_z_far);
+	void _process_taa(RID p_render_buffers, RID p_velocity_buffer, float p_z_near, float p_z_far, const Vector2 &p_jitter);
 
 	bool _needs_post_prepass_render(RenderDataRD *p_render_data, bool p_use_gi);
 	void _post_prepass_render(RenderDataRD *p_render_data, bool p_use_gi);
@@ -226,7 +226,8 @@ private:
 
 	struct ReflectionProbeInstance {
 		RID probe;
-		int atlas_index = -1;
+		int atlas_index = -1; // Sampled by the scene.
+		int render_atlas_index = -1; // Rendered to, swapped with atlas_index once filtered when a spare slot was available.
 		RID atlas;
 
 		bool dirty = true;
@@ -245,6 +246,8 @@ private:
 
 	mutable RID_Owner<ReflectionProbeInstance> reflection_probe_instance_owner;
 
+	void _reflection_probe_swap_atlas_index(ReflectionProbeInstance *rpi, ReflectionAtlas *atlas);
+
 	/* DECAL INSTANCE */
 
 	struct DecalInstance {
@@ -289,6 +292,7 @@ private:
 				uint64_t version = 0;
 				uint64_t fog_version = 0; // used for fog
 				uint64_t alloc_tick = 0;
+				uint64_t static_version = 0; // version of the static casters in the static cache, 0 if not cached
 
 				Shadow() {}
 			};
@@ -307,6 +311,10 @@ private:
 		RID depth;
 		RID fb; //for copying
 
+		// Static casters only, copied to depth before drawing the dynamic ones.
+		RID static_depth;
+		RID static_fb;
+
 		HashMap<RID, uint32_t> shadow_owners;
 	};
 
@@ -317,6 +325,9 @@ private:
 	void _shadow_atlas_invalidate_shadow(RendererSceneRenderRD::ShadowAtlas::Quadrant::Shadow *p_shadow, RID p_atlas, RendererSceneRenderRD::ShadowAtlas *p_shadow_atlas, uint32_t p_quadrant, uint32_t p_shadow_idx);
 	bool _shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_in_quadrants, int p_quadrant_count, int p_current_subdiv, uint64_t p_tick, int &r_quadrant, int &r_shadow);
 	bool _shadow_atlas_find_omni_shadows(ShadowAtlas *shadow_atlas, int *p_in_quadrants, int p_quadrant_count, int p_current_subdiv, uint64_t p_tick, int &r_quadrant, int &r_shadow);
+	void _shadow_atlas_copy_static_cache(ShadowAtlas *p_shadow_atlas, RID p_light_instance, int p_pass);
+
+	bool shadow_atlas_cache_static_casters = false;
 
 	RS::ShadowQuality shadows_quality = RS::SHADOW_QUALITY_MAX; //So it always updates when first set
 	RS::ShadowQuality directional_shadow_quality = RS::SHADOW_QUALITY_MAX;
@@ -466,6 +477,7 @@ private:
 		int internal_height = 0;
 		int width = 0;
 		int height = 0;
+		RS::ViewportScaling3DMode scaling_3d_mode = RS::VIEWPORT_SCALING_3D_MODE_BILINEAR;
 		float fsr_sharpness = 0.2f;
 		RS::ViewportMSAA msaa = RS::VIEWPORT_MSAA_DISABLED;
 		RS::ViewportScreenSpaceAA screen_space_aa = RS::VIEWPORT_SCREEN_SPACE_AA_DISABLED;
@@ -477,6 +489,9 @@ private:
 
 		uint64_t auto_exposure_version = 1;
 
+		// Screen space effect buffers remember the last of these frames they were used in, and are freed once the effect has been off for a while.
+		uint64_t frames_rendered = 0;
+
 		RID sss_texture; //texture for sss. This needs to be a different resolution than blur[0]
 		RID internal_texture; //main texture for rendering to, must be filled after done rendering
 		RID texture; //upscaled version of main texture (This uses the same resource as internal_texture if there is no upscaling)
@@ -547,6 +562,7 @@ private:
 		struct SSEffects {
 			RID linear_depth;
 			Vector<RID> linear_depth_slices;
+			uint64_t linear_depth_last_used = 0;
 
 			RID downsample_uniform_set;
 
@@ -554,15 +570,19 @@ private:
 			Transform3D last_frame_transform;
 
 			RendererRD::SSEffects::SSAORenderBuffers ssao;
+			uint64_t ssao_last_used = 0;
 			RendererRD::SSEffects::SSILRenderBuffers ssil;
+			uint64_t ssil_last_used = 0;
 		} ss_effects;
 
 		RendererRD::SSEffects::SSRRenderBuffers ssr;
+		uint64_t ssr_last_used = 0;
 
 		struct TAA {
 			RID history;
 			RID temp;
 			RID prev_velocity; // Last frame velocity buffer
+			bool upscaled = false; // Whether texture holds the temporally upscaled frame, instead of internal_texture.
 		} taa;
 	};
 
@@ -571,9 +591,14 @@ private:
 	float screen_space_roughness_limiter_amount = 0.25;
 	float screen_space_roughness_limiter_limit = 0.18;
 
+	enum {
+		UNUSED_EFFECT_BUFFERS_FREE_FRAMES = 60,
+	};
+
 	mutable RID_Owner<RenderBuffers> render_buffers_owner;
 
 	void _free_render_buffer_data(RenderBuffers *rb);
+	void _free_unused_effect_buffers(RenderBuffers *rb);
 	void _allocate_blur_textures(RenderBuffers *rb);
 	void _allocate_depth_backbuffer_textures(RenderBuffers *rb);
 	void _allocate_luminance_textures(RenderBuffers *rb);
@@ -731,6 +756,7 @@ private:
 
 		LocalVector<int> cube_shadows;
 		LocalVector<int> shadows;
+		LocalVector<int> static_shadows;
 		LocalVector<int> directional_shadows;
 
 		bool depth_prepass_used; // this does not seem used anywhere...
@@ -750,7 +776,7 @@ private:
 
 	uint32_t max_cluster_elements = 512;
 
-	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RendererScene::RenderInfo *p_render_info = nullptr);
+	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RendererScene::RenderInfo *p_render_info = nullptr, bool p_static_cache = false);
 
 	/* Volumetric Fog */
 
@@ -771,6 +797,7 @@ public:
 	virtual void shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits = true) override;
 	virtual void shadow_atlas_set_quadrant_subdivision(RID p_atlas, int p_quadrant, int p_subdivision) override;
 	virtual bool shadow_atlas_update_light(RID p_atlas, RID p_light_instance, float p_coverage, uint64_t p_light_version) override;
+	virtual bool shadow_atlas_static_cache_is_valid(RID p_atlas, RID p_light_instance, uint64_t p_static_version) override;
 	_FORCE_INLINE_ bool shadow_atlas_owns_light_instance(RID p_atlas, RID p_light_intance) {
 		ShadowAtlas *atlas = shadow_atlas_owner.get_or_null(p_atlas);
 		ERR_FAIL_COND_V(!atlas, false);
@@ -916,6 +943,9 @@ public:
 	virtual void light_instance_set_aabb(RID p_light_instance, const AABB &p_aabb) override;
 	virtual void light_instance_set_shadow_transform(RID p_light_instance, const Projection &p_projection, const Transform3D &p_transform, float p_far, float p_split, int p_pass, float p_shadow_texel_size, float p_bias_scale = 1.0, float p_range_begin = 0, const Vector2 &p_uv_scale = Vector2()) override;
 	virtual void light_instance_mark_visible(RID p_light_instance) override;
+	virtual bool light_instances_can_cache_static_shadows() const override {
+		return shadow_atlas_cache_static_casters;
+	}
 
 	_FORCE_INLINE_ RID light_instance_get_base_light(RID p_light_instance) {
 		LightInstance *li = light_instance_owner.get_or_null(p_light_instance);
@@ -1166,7 +1196,7 @@ public:
 	virtual RD::DataFormat _render_buffers_get_color_format();
 	virtual bool _render_buffers_can_be_storage();
 	virtual RID render_buffers_create() override;
-	virtual void render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RS::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) override;
+	virtual void render_buffers_configure(RID p_render_buffers, RID p_render_target, int p_internal_width, int p_internal_height, int p_width, int p_height, RS::ViewportScaling3DMode p_scaling_3d_mode, float p_fsr_sharpness, float p_fsr_mipmap_bias, RS::ViewportMSAA p_msaa, RS::ViewportScreenSpaceAA p_screen_space_aa, bool p_use_taa, bool p_use_debanding, uint32_t p_view_count) override;
 	virtual void gi_set_use_half_resolution(bool p_enable) override;
 
 	RID render_buffers_get_depth_texture(RID p_render_buffers);
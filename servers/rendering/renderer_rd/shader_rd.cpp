@@ -380,9 +380,16 @@ static const uint32_t cache_file_version = 2;
 
 bool ShaderRD::_load_from_cache(Version *p_version) {
 	String sha1 = _version_get_sha1(p_version);
-	String path = shader_cache_dir.plus_file(name).plus_file(base_sha256).plus_file(sha1) + ".cache";
+	String file = name.plus_file(base_sha256).plus_file(sha1) + ".cache";
 
-	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	Ref<FileAccess> f;
+	if (shader_cache_dir_valid) {
+		f = FileAccess::open(shader_cache_dir.plus_file(file), FileAccess::READ);
+	}
+	if (f.is_null() && !shader_cache_bundle_dir.is_empty()) {
+		// Precompiled at export time.
+		f = FileAccess::open(shader_cache_bundle_dir.plus_file(file), FileAccess::READ);
+	}
 	if (f.is_null()) {
 		return false;
 	}
@@ -438,6 +445,10 @@ bool ShaderRD::_load_from_cache(Version *p_version) {
 	memdelete_arr(p_version->variant_data); //clear stages
 	p_version->variant_data = nullptr;
 	p_version->valid = true;
+
+	if (shader_cache_dir_valid) {
+		_log_version(sha1);
+	}
 	return true;
 }
 
@@ -456,6 +467,30 @@ void ShaderRD::_save_to_cache(Version *p_version) {
 		f->store_32(p_version->variant_data[i].size()); //stage count
 		f->store_buffer(p_version->variant_data[i].ptr(), p_version->variant_data[i].size());
 	}
+
+	_log_version(sha1);
+}
+
+void ShaderRD::_log_version(const String &p_sha1) {
+#ifdef DEBUG_ENABLED
+	// Keep track of the versions the project uses, so the exporter can bundle them.
+	String key = name.plus_file(base_sha256).plus_file(p_sha1);
+
+	MutexLock lock(variant_log_mutex);
+	if (variant_log.has(key)) {
+		return;
+	}
+	variant_log.insert(key);
+
+	String path = shader_cache_dir.plus_file(VARIANT_LOG_FILE);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ_WRITE);
+	if (f.is_null()) {
+		f = FileAccess::open(path, FileAccess::WRITE);
+		ERR_FAIL_COND(f.is_null());
+	}
+	f->seek_end();
+	f->store_line(key);
+#endif
 }
 
 void ShaderRD::_compile_version(Version *p_version) {
@@ -468,7 +503,7 @@ void ShaderRD::_compile_version(Version *p_version) {
 	typedef Vector<uint8_t> ShaderStageData;
 	p_version->variant_data = memnew_arr(ShaderStageData, variant_defines.size());
 
-	if (shader_cache_dir_valid) {
+	if (shader_cache_dir_valid || !shader_cache_bundle_dir.is_empty()) {
 		if (_load_from_cache(p_version)) {
 			return;
 		}
@@ -638,7 +673,7 @@ void ShaderRD::initialize(const Vector<String> &p_variant_defines, const String
 		variants_enabled.push_back(true);
 	}
 
-	if (!shader_cache_dir.is_empty()) {
+	if (!shader_cache_dir.is_empty() || !shader_cache_bundle_dir.is_empty()) {
 		StringBuilder hash_build;
 
 		hash_build.append("[base_hash]");
@@ -651,7 +686,9 @@ void ShaderRD::initialize(const Vector<String> &p_variant_defines, const String
 		}
 
 		base_sha256 = hash_build.as_string().sha256_text();
+	}
 
+	if (!shader_cache_dir.is_empty()) {
 		Ref<DirAccess> d = DirAccess::open(shader_cache_dir);
 		ERR_FAIL_COND(d.is_null());
 		if (d->change_dir(name) != OK) {
@@ -678,6 +715,10 @@ void ShaderRD::set_shader_cache_dir(const String &p_dir) {
 	shader_cache_dir = p_dir;
 }
 
+void ShaderRD::set_shader_cache_bundle_dir(const String &p_dir) {
+	shader_cache_bundle_dir = p_dir;
+}
+
 void ShaderRD::set_shader_cache_save_compressed(bool p_enable) {
 	shader_cache_save_compressed = p_enable;
 }
@@ -691,6 +732,9 @@ void ShaderRD::set_shader_cache_save_debug(bool p_enable) {
 }
 
 String ShaderRD::shader_cache_dir;
+String ShaderRD::shader_cache_bundle_dir;
+Mutex ShaderRD::variant_log_mutex;
+HashSet<String> ShaderRD::variant_log;
 bool ShaderRD::shader_cache_save_compressed = true;
 bool ShaderRD::shader_cache_save_compressed_zstd = true;
 bool ShaderRD::shader_cache_save_debug = true;
@@ -34,6 +34,7 @@
 #include "core/os/mutex.h"
 #include "core/string/string_builder.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/rid_owner.h"
@@ -99,12 +100,16 @@ class ShaderRD {
 	String base_sha256;
 
 	static String shader_cache_dir;
+	static String shader_cache_bundle_dir;
 	static bool shader_cache_cleanup_on_start;
 	static bool shader_cache_save_compressed;
 	static bool shader_cache_save_compressed_zstd;
 	static bool shader_cache_save_debug;
 	bool shader_cache_dir_valid = false;
 
+	static Mutex variant_log_mutex;
+	static HashSet<String> variant_log;
+
 	enum StageType {
 		STAGE_TYPE_VERTEX,
 		STAGE_TYPE_FRAGMENT,
@@ -121,6 +126,7 @@ class ShaderRD {
 	String _version_get_sha1(Version *p_version) const;
 	bool _load_from_cache(Version *p_version);
 	void _save_to_cache(Version *p_version);
+	void _log_version(const String &p_sha1);
 
 protected:
 	ShaderRD();
@@ -157,7 +163,12 @@ public:
 	void set_variant_enabled(int p_variant, bool p_enabled);
 	bool is_variant_enabled(int p_variant) const;
 
+	// File in the shader cache folder listing the versions used, and the folder the exporter bundles them to (relative to res://).
+	static constexpr const char *VARIANT_LOG_FILE = "variants.log";
+	static constexpr const char *BUNDLE_DIR = ".godot/shader_cache_bundle";
+
 	static void set_shader_cache_dir(const String &p_dir);
+	static void set_shader_cache_bundle_dir(const String &p_dir);
 	static void set_shader_cache_save_compressed(bool p_enable);
 	static void set_shader_cache_save_compressed_zstd(bool p_enable);
 	static void set_shader_cache_save_debug(bool p_enable);
@@ -0,0 +1,151 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Compute alternative to cluster_render.glsl: one group per cluster tile tests the bounding sphere of every element against the tile frustum,
+// and writes the same usage and depth bits the raster pass would, so cluster_store.glsl can pack them unchanged.
+
+#define BIN_THREADS 64
+
+layout(local_size_x = BIN_THREADS, local_size_y = 1, local_size_z = 1) in;
+
+layout(push_constant, std430) uniform Params {
+	uvec2 screen_size;
+	uint cluster_size;
+	uint render_element_count;
+}
+params;
+
+layout(set = 0, binding = 1, std140) uniform State {
+	mat4 projection;
+
+	float inv_z_far;
+	uint screen_to_clusters_shift; // shift to obtain coordinates in block indices
+	uint cluster_screen_width; //
+	uint cluster_data_size; // how much data for a single cluster takes
+
+	uint cluster_depth_offset;
+	uint pad0;
+	uint pad1;
+	uint pad2;
+}
+state;
+
+struct RenderElement {
+	uint type; //0-4
+	bool touches_near;
+	bool touches_far;
+	uint original_index;
+	mat3x4 transform_inv;
+	vec3 scale;
+	uint pad;
+};
+
+layout(set = 0, binding = 2, std430) buffer restrict readonly RenderElements {
+	RenderElement data[];
+}
+render_elements;
+
+layout(set = 0, binding = 3, std430) buffer restrict ClusterRender {
+	uint data[];
+}
+cluster_render;
+
+#define ELEMENT_TYPE_OMNI_LIGHT 0
+#define ELEMENT_TYPE_SPOT_LIGHT 1
+
+// Left, right, top and bottom planes of the tile, in view space, facing inwards.
+shared vec4 tile_planes[4];
+
+vec4 get_projection_row(uint p_row) {
+	return vec4(state.projection[0][p_row], state.projection[1][p_row], state.projection[2][p_row], state.projection[3][p_row]);
+}
+
+vec4 normalize_plane(vec4 p_plane) {
+	return p_plane / length(p_plane.xyz);
+}
+
+void main() {
+	uvec2 cluster = gl_WorkGroupID.xy;
+	uint cluster_offset = (cluster.x + state.cluster_screen_width * cluster.y) * state.cluster_data_size;
+
+	if (gl_LocalInvocationIndex == 0) {
+		// Planes of the clip space slab the tile covers, transformed back to view space (works for both perspective and orthogonal projections).
+		vec2 from_ndc = vec2(cluster * params.cluster_size) / vec2(params.screen_size) * 2.0 - 1.0;
+		vec2 to_ndc = vec2((cluster + 1) * params.cluster_size) / vec2(params.screen_size) * 2.0 - 1.0;
+
+		vec4 row_x = get_projection_row(0);
+		vec4 row_y = get_projection_row(1);
+		vec4 row_w = get_projection_row(3);
+
+		tile_planes[0] = normalize_plane(row_x - from_ndc.x * row_w);
+		tile_planes[1] = normalize_plane(to_ndc.x * row_w - row_x);
+		tile_planes[2] = normalize_plane(row_y - from_ndc.y * row_w);
+		tile_planes[3] = normalize_plane(to_ndc.y * row_w - row_y);
+	}
+
+	memoryBarrierShared();
+	barrier();
+
+	// Every thread handles whole words of 32 elements, so no two threads write to the same usage word.
+	uint word_count = (params.render_element_count + 31) / 32;
+
+	for (uint word = gl_LocalInvocationIndex; word < word_count; word += BIN_THREADS) {
+		uint usage_bits = 0u;
+		uint to_element = min(word * 32 + 32, params.render_element_count);
+
+		for (uint i = word * 32; i < to_element; i++) {
+			mat3x4 xform = render_elements.data[i].transform_inv;
+			vec3 scale = render_elements.data[i].scale;
+
+			// Bounding sphere of the proxy in its own space.
+			vec3 center = vec3(0.0);
+			float radius;
+			if (render_elements.data[i].type == ELEMENT_TYPE_SPOT_LIGHT) {
+				float height = scale.z;
+				float base = scale.x;
+				if (base >= height) {
+					center.z = -height;
+					radius = base;
+				} else {
+					radius = (height * height + base * base) / (2.0 * height);
+					center.z = -radius;
+				}
+			} else if (render_elements.data[i].type == ELEMENT_TYPE_OMNI_LIGHT) {
+				radius = scale.x;
+			} else {
+				radius = length(scale);
+			}
+
+			center = vec4(center, 1.0) * xform;
+			radius *= max(length(vec3(xform[0].x, xform[1].x, xform[2].x)), max(length(vec3(xform[0].y, xform[1].y, xform[2].y)), length(vec3(xform[0].z, xform[1].z, xform[2].z))));
+
+			bool inside = true;
+			for (uint j = 0; j < 4; j++) {
+				if (dot(tile_planes[j].xyz, center) + tile_planes[j].w < -radius) {
+					inside = false;
+					break;
+				}
+			}
+
+			float min_depth = (-center.z - radius) * state.inv_z_far;
+			float max_depth = (-center.z + radius) * state.inv_z_far;
+
+			if (!inside || max_depth < 0.0 || min_depth > 1.0) {
+				continue;
+			}
+
+			usage_bits |= 1 << (i & 0x1F);
+
+			uint from_z = clamp(uint(floor(max(min_depth, 0.0) * 32.0)), 0, 31);
+			uint to_z = clamp(uint(floor(min(max_depth, 1.0) * 32.0)), 0, 31);
+			uint z_bits = (0xFFFFFFFFu >> (31 - to_z)) & ~((1 << from_z) - 1);
+
+			cluster_render.data[cluster_offset + state.cluster_depth_offset + i] = z_bits;
+		}
+
+		cluster_render.data[cluster_offset + word] = usage_bits;
+	}
+}
@@ -4,199 +4,158 @@
 
 #VERSION_DEFINES
 
-// Original version here:
-// https://github.com/GPUOpen-LibrariesAndSDKs/GPUParticles11/blob/master/gpuparticles11/src/Shaders
-
-//
-// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-// THE SOFTWARE.
-//
-
-#define SORT_SIZE 512
-#define NUM_THREADS (SORT_SIZE / 2)
-#define INVERSION (16 * 2 + 8 * 3)
-#define ITERATIONS 1
-
-layout(local_size_x = NUM_THREADS, local_size_y = 1, local_size_z = 1) in;
-
-#ifndef MODE_SORT_STEP
-
-shared vec2 g_LDS[SORT_SIZE];
+// Stable radix sort of (key, value) pairs by key, least significant digit first, eight bits per pass.
+// Every pass counts the digits of each block (MODE_SORT_HISTOGRAM), turns the counts into the offset each block writes each digit to (MODE_SORT_SCAN)
+// and moves the pairs there (MODE_SORT_SCATTER).
 
-#endif
+#define RADIX_SIZE 256
+#define BLOCK_THREADS 256
+#define BLOCK_ITEMS 4
+#define BLOCK_SIZE (BLOCK_THREADS * BLOCK_ITEMS)
+
+layout(local_size_x = BLOCK_THREADS, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0, std430) restrict readonly buffer SourceBuffer {
+	vec2 data[];
+}
+source_buffer;
 
-layout(set = 1, binding = 0, std430) restrict buffer SortBuffer {
+layout(set = 0, binding = 1, std430) restrict writeonly buffer DestBuffer {
 	vec2 data[];
 }
-sort_buffer;
+dest_buffer;
+
+// Digit major, so the offsets of all the blocks for a digit are next to each other.
+layout(set = 0, binding = 2, std430) restrict buffer Histograms {
+	uint data[];
+}
+histograms;
 
 layout(push_constant, std430) uniform Params {
 	uint total_elements;
-	uint pad[3];
-	ivec4 job_params;
+	uint block_count;
+	uint shift;
+	uint pad;
 }
 params;
 
-void main() {
-#ifdef MODE_SORT_BLOCK
+shared uint local_counts[RADIX_SIZE];
 
-	uvec3 Gid = gl_WorkGroupID;
-	uvec3 DTid = gl_GlobalInvocationID;
-	uvec3 GTid = gl_LocalInvocationID;
-	uint GI = gl_LocalInvocationIndex;
+#ifdef MODE_SORT_SCATTER
+shared uint local_digits[BLOCK_THREADS];
+#endif
 
-	int GlobalBaseIndex = int((Gid.x * SORT_SIZE) + GTid.x);
-	int LocalBaseIndex = int(GI);
-	int numElementsInThreadGroup = int(min(SORT_SIZE, params.total_elements - (Gid.x * SORT_SIZE)));
+uint get_digit(float p_key) {
+	// Flip all the bits of negative floats and the sign bit of positive ones, so they are ordered as unsigned integers.
+	uint bits = floatBitsToUint(p_key);
+	bits ^= (bits & 0x80000000u) != 0u ? 0xFFFFFFFFu : 0x80000000u;
+	return (bits >> params.shift) & uint(RADIX_SIZE - 1);
+}
 
-	// Load shared data
+void main() {
+#ifdef MODE_SORT_HISTOGRAM
 
-	int i;
-	for (i = 0; i < 2 * ITERATIONS; ++i) {
-		if (GI + i * NUM_THREADS < numElementsInThreadGroup)
-			g_LDS[LocalBaseIndex + i * NUM_THREADS] = sort_buffer.data[GlobalBaseIndex + i * NUM_THREADS];
-	}
+	uint block = gl_WorkGroupID.x;
+	uint thread = gl_LocalInvocationIndex;
+
+	local_counts[thread] = 0u;
 
-	groupMemoryBarrier();
+	memoryBarrierShared();
 	barrier();
 
-	// Bitonic sort
-	for (int nMergeSize = 2; nMergeSize <= SORT_SIZE; nMergeSize = nMergeSize * 2) {
-		for (int nMergeSubSize = nMergeSize >> 1; nMergeSubSize > 0; nMergeSubSize = nMergeSubSize >> 1) {
-			for (i = 0; i < ITERATIONS; ++i) {
-				int tmp_index = int(GI + NUM_THREADS * i);
-				int index_low = tmp_index & (nMergeSubSize - 1);
-				int index_high = 2 * (tmp_index - index_low);
-				int index = index_high + index_low;
-
-				int nSwapElem = nMergeSubSize == nMergeSize >> 1 ? index_high + (2 * nMergeSubSize - 1) - index_low : index_high + nMergeSubSize + index_low;
-				if (nSwapElem < numElementsInThreadGroup) {
-					vec2 a = g_LDS[index];
-					vec2 b = g_LDS[nSwapElem];
-
-					if (a.x > b.x) {
-						g_LDS[index] = b;
-						g_LDS[nSwapElem] = a;
-					}
-				}
-				groupMemoryBarrier();
-				barrier();
-			}
+	for (uint i = 0; i < BLOCK_ITEMS; i++) {
+		uint index = block * BLOCK_SIZE + i * BLOCK_THREADS + thread;
+		if (index < params.total_elements) {
+			atomicAdd(local_counts[get_digit(source_buffer.data[index].x)], 1u);
 		}
 	}
 
-	// Store shared data
-	for (i = 0; i < 2 * ITERATIONS; ++i) {
-		if (GI + i * NUM_THREADS < numElementsInThreadGroup) {
-			sort_buffer.data[GlobalBaseIndex + i * NUM_THREADS] = g_LDS[LocalBaseIndex + i * NUM_THREADS];
-		}
-	}
+	memoryBarrierShared();
+	barrier();
+
+	histograms.data[thread * params.block_count + block] = local_counts[thread];
 
 #endif
 
-#ifdef MODE_SORT_STEP
+#ifdef MODE_SORT_SCAN
 
-	uvec3 Gid = gl_WorkGroupID;
-	uvec3 GTid = gl_LocalInvocationID;
+	// Dispatched as a single group, one thread per digit.
+	uint digit = gl_LocalInvocationIndex;
 
-	ivec4 tgp;
+	uint total = 0;
+	for (uint i = 0; i < params.block_count; i++) {
+		total += histograms.data[digit * params.block_count + i];
+	}
 
-	tgp.x = int(Gid.x) * 256;
-	tgp.y = 0;
-	tgp.z = int(params.total_elements);
-	tgp.w = min(512, max(0, tgp.z - int(Gid.x) * 512));
+	local_counts[digit] = total;
 
-	uint localID = int(tgp.x) + GTid.x; // calculate threadID within this sortable-array
+	memoryBarrierShared();
+	barrier();
 
-	uint index_low = localID & (params.job_params.x - 1);
-	uint index_high = 2 * (localID - index_low);
+	for (uint step = 1; step < RADIX_SIZE; step <<= 1) {
+		uint prev = digit >= step ? local_counts[digit - step] : 0u;
 
-	uint index = tgp.y + index_high + index_low;
-	uint nSwapElem = tgp.y + index_high + params.job_params.y + params.job_params.z * index_low;
+		barrier();
 
-	if (nSwapElem < tgp.y + tgp.z) {
-		vec2 a = sort_buffer.data[index];
-		vec2 b = sort_buffer.data[nSwapElem];
+		local_counts[digit] += prev;
 
-		if (a.x > b.x) {
-			sort_buffer.data[index] = b;
-			sort_buffer.data[nSwapElem] = a;
-		}
+		memoryBarrierShared();
+		barrier();
 	}
 
-#endif
-
-#ifdef MODE_SORT_INNER
+	uint offset = local_counts[digit] - total;
+	for (uint i = 0; i < params.block_count; i++) {
+		uint count = histograms.data[digit * params.block_count + i];
+		histograms.data[digit * params.block_count + i] = offset;
+		offset += count;
+	}
 
-	uvec3 Gid = gl_WorkGroupID;
-	uvec3 DTid = gl_GlobalInvocationID;
-	uvec3 GTid = gl_LocalInvocationID;
-	uint GI = gl_LocalInvocationIndex;
+#endif
 
-	ivec4 tgp;
+#ifdef MODE_SORT_SCATTER
 
-	tgp.x = int(Gid.x * 256);
-	tgp.y = 0;
-	tgp.z = int(params.total_elements.x);
-	tgp.w = int(min(512, max(0, params.total_elements - Gid.x * 512)));
+	uint block = gl_WorkGroupID.x;
+	uint thread = gl_LocalInvocationIndex;
 
-	int GlobalBaseIndex = int(tgp.y + tgp.x * 2 + GTid.x);
-	int LocalBaseIndex = int(GI);
-	int i;
+	local_counts[thread] = histograms.data[thread * params.block_count + block];
 
-	// Load shared data
-	for (i = 0; i < 2; ++i) {
-		if (GI + i * NUM_THREADS < tgp.w)
-			g_LDS[LocalBaseIndex + i * NUM_THREADS] = sort_buffer.data[GlobalBaseIndex + i * NUM_THREADS];
-	}
-
-	groupMemoryBarrier();
+	memoryBarrierShared();
 	barrier();
 
-	// sort threadgroup shared memory
-	for (int nMergeSubSize = SORT_SIZE >> 1; nMergeSubSize > 0; nMergeSubSize = nMergeSubSize >> 1) {
-		int tmp_index = int(GI);
-		int index_low = tmp_index & (nMergeSubSize - 1);
-		int index_high = 2 * (tmp_index - index_low);
-		int index = index_high + index_low;
+	// The block is moved one row of threads at a time, with each pair going after the ones with the same digit in lower threads, so equal keys keep their order.
+	for (uint i = 0; i < BLOCK_ITEMS; i++) {
+		uint index = block * BLOCK_SIZE + i * BLOCK_THREADS + thread;
 
-		int nSwapElem = index_high + nMergeSubSize + index_low;
+		vec2 pair = vec2(0.0);
+		uint digit = RADIX_SIZE; // Past the end, matches no digit.
+		if (index < params.total_elements) {
+			pair = source_buffer.data[index];
+			digit = get_digit(pair.x);
+		}
 
-		if (nSwapElem < tgp.w) {
-			vec2 a = g_LDS[index];
-			vec2 b = g_LDS[nSwapElem];
+		local_digits[thread] = digit;
 
-			if (a.x > b.x) {
-				g_LDS[index] = b;
-				g_LDS[nSwapElem] = a;
+		memoryBarrierShared();
+		barrier();
+
+		if (digit < RADIX_SIZE) {
+			uint rank = 0;
+			for (uint j = 0; j < thread; j++) {
+				if (local_digits[j] == digit) {
+					rank++;
+				}
 			}
+			dest_buffer.data[local_counts[digit] + rank] = pair;
 		}
-		groupMemoryBarrier();
+
 		barrier();
-	}
 
-	// Store shared data
-	for (i = 0; i < 2; ++i) {
-		if (GI + i * NUM_THREADS < tgp.w) {
-			sort_buffer.data[GlobalBaseIndex + i * NUM_THREADS] = g_LDS[LocalBaseIndex + i * NUM_THREADS];
+		if (digit < RADIX_SIZE) {
+			atomicAdd(local_counts[digit], 1u);
 		}
+
+		memoryBarrierShared();
+		barrier();
 	}
 
 #endif
@@ -31,8 +31,12 @@
 
 // Based on Spartan Engine's TAA implementation (without TAA upscale).
 // <https://github.com/PanosK92/SpartanEngine/blob/a8338d0609b85dc32f3732a5c27fb4463816a3b9/Data/shaders/temporal_antialiasing.hlsl>
+// MODE_TAA_UPSCALE resolves a reduced resolution source into a history at output resolution, weighting every new sample by how close its jittered position is to the output pixel.
 
+#ifndef MODE_TAA_UPSCALE
+// Output pixels of the upscale don't map to a tile of the source the size of the group, so it reads the source directly instead.
 #define USE_SUBGROUPS
+#endif
 
 #define GROUP_SIZE 8
 #define FLT_MIN 0.00000001
@@ -40,9 +44,7 @@
 #define RPC_9 0.11111111111
 #define RPC_16 0.0625
 
-#ifdef USE_SUBGROUPS
 layout(local_size_x = GROUP_SIZE, local_size_y = GROUP_SIZE, local_size_z = 1) in;
-#endif
 
 layout(rgba16f, set = 0, binding = 0) uniform restrict readonly image2D color_buffer;
 layout(set = 0, binding = 1) uniform sampler2D depth_buffer;
@@ -55,6 +57,14 @@ layout(push_constant, std430) uniform Params {
 	vec2 resolution;
 	float disocclusion_threshold; // 0.1 / max(params.resolution.x, params.resolution.y
 	float disocclusion_scale;
+
+	vec2 source_resolution; // Same as resolution, unless upscaling.
+	vec2 jitter; // Offset of the source samples, in source pixels.
+
+	bool reset_history;
+	uint pad0;
+	uint pad1;
+	uint pad2;
 }
 params;
 
@@ -140,12 +150,16 @@ void populate_group_shared_memory(uvec2 group_id, uint group_index) {
 	barrier();
 }
 #else
+ivec2 clamp_to_source(uvec2 screen_pos) {
+	return clamp(ivec2(screen_pos), ivec2(0, 0), ivec2(params.source_resolution) - ivec2(1, 1));
+}
+
 vec3 load_color(uvec2 screen_pos) {
-	return imageLoad(color_buffer, ivec2(screen_pos)).rgb;
+	return imageLoad(color_buffer, clamp_to_source(screen_pos)).rgb;
 }
 
 float load_depth(uvec2 screen_pos) {
-	return get_depth(ivec2(screen_pos));
+	return get_depth(clamp_to_source(screen_pos));
 }
 #endif
 
@@ -178,7 +192,7 @@ void get_closest_pixel_velocity_3x3(in uvec2 group_pos, uvec2 group_top_left, ou
 	depth_test_min(group_pos + kOffsets3x3[8], min_depth, min_pos);
 
 	// Velocity out
-	velocity = imageLoad(velocity_buffer, ivec2(group_top_left + min_pos)).xy;
+	velocity = imageLoad(velocity_buffer, clamp(ivec2(group_top_left + min_pos), ivec2(0, 0), ivec2(params.source_resolution) - ivec2(1, 1))).xy;
 }
 
 /*------------------------------------------------------------------------------
@@ -306,14 +320,14 @@ float luminance(vec3 color) {
 }
 
 float get_factor_disocclusion(vec2 uv_reprojected, vec2 velocity) {
-	vec2 velocity_previous = imageLoad(last_velocity_buffer, ivec2(uv_reprojected * params.resolution)).xy;
-	vec2 velocity_texels = velocity * params.resolution;
-	vec2 prev_velocity_texels = velocity_previous * params.resolution;
+	vec2 velocity_previous = imageLoad(last_velocity_buffer, ivec2(uv_reprojected * params.source_resolution)).xy;
+	vec2 velocity_texels = velocity * params.source_resolution;
+	vec2 prev_velocity_texels = velocity_previous * params.source_resolution;
 	float disocclusion = length(prev_velocity_texels - velocity_texels) - params.disocclusion_threshold;
 	return clamp(disocclusion * params.disocclusion_scale, 0.0, 1.0);
 }
 
-vec3 temporal_antialiasing(uvec2 pos_group_top_left, uvec2 pos_group, uvec2 pos_screen, vec2 uv, sampler2D tex_history) {
+vec3 temporal_antialiasing(uvec2 pos_group_top_left, uvec2 pos_group, uvec2 pos_screen, vec2 uv, sampler2D tex_history, float sample_weight) {
 	// Get the velocity of the current pixel
 	vec2 velocity = imageLoad(velocity_buffer, ivec2(pos_screen)).xy;
 
@@ -332,7 +346,7 @@ vec3 temporal_antialiasing(uvec2 pos_group_top_left, uvec2 pos_group, uvec2 pos_
 	color_history = clip_history_3x3(pos_group, color_history, velocity_closest);
 
 	// Compute blend factor
-	float blend_factor = RPC_16; // We want to be able to accumulate as many jitter samples as we generated, that is, 16.
+	float blend_factor = RPC_16 * sample_weight; // We want to be able to accumulate as many jitter samples as we generated, that is, 16.
 	{
 		// If re-projected UV is out of screen, converge to current color immediatel
 		float factor_screen = any(lessThan(uv_reprojected, vec2(0.0))) || any(greaterThan(uv_reprojected, vec2(1.0))) ? 1.0 : 0.0;
@@ -359,8 +373,8 @@ vec3 temporal_antialiasing(uvec2 pos_group_top_left, uvec2 pos_group, uvec2 pos_
 		diff = diff * diff;
 		blend_factor = mix(0.0, blend_factor, diff);
 
-		// Lerp/blend
-		color_resolved = mix(color_history, color_input, blend_factor);
+		// Lerp/blend (there is nothing to blend with right after the history is created)
+		color_resolved = params.reset_history ? color_input : mix(color_history, color_input, blend_factor);
 
 		// Inverse tonemap
 		color_resolved = reinhard_inverse(color_resolved);
@@ -379,6 +393,20 @@ void main() {
 		return;
 	}
 
+	const vec2 uv = (gl_GlobalInvocationID.xy + 0.5f) / params.resolution;
+
+#ifdef MODE_TAA_UPSCALE
+	// Use the source pixel whose jittered sample is closest to this output pixel, and trust it less the further away the sample is (in output pixels).
+	const vec2 source_pos = uv * params.source_resolution + params.jitter;
+	const uvec2 pos_source = uvec2(clamp(ivec2(source_pos), ivec2(0, 0), ivec2(params.source_resolution) - ivec2(1, 1)));
+	const vec2 sample_offset = (source_pos - vec2(pos_source) - 0.5) * params.resolution / params.source_resolution;
+	const float sample_weight = exp(-2.0 * dot(sample_offset, sample_offset));
+
+	const uvec2 pos_group = pos_source;
+	const uvec2 pos_group_top_left = uvec2(0, 0);
+	const uvec2 pos_screen = pos_source;
+#else
+	const float sample_weight = 1.0;
 #ifdef USE_SUBGROUPS
 	const uvec2 pos_group = gl_LocalInvocationID.xy;
 	const uvec2 pos_group_top_left = gl_WorkGroupID.xy * kGroupSize - kBorderSize;
@@ -387,8 +415,8 @@ void main() {
 	const uvec2 pos_group_top_left = uvec2(0, 0);
 #endif
 	const uvec2 pos_screen = gl_GlobalInvocationID.xy;
-	const vec2 uv = (gl_GlobalInvocationID.xy + 0.5f) / params.resolution;
+#endif
 
-	vec3 result = temporal_antialiasing(pos_group_top_left, pos_group, pos_screen, uv, history_buffer);
+	vec3 result = temporal_antialiasing(pos_group_top_left, pos_group, pos_screen, uv, history_buffer, sample_weight);
 	imageStore(output_buffer, ivec2(gl_GlobalInvocationID.xy), vec4(result, 1.0));
 }
@@ -1213,6 +1213,7 @@ void MaterialData::update_textures(const HashMap<StringName, Variant> &p_paramet
 
 				if (tex) {
 					rd_texture = (srgb && tex->rd_texture_srgb.is_valid()) ? tex->rd_texture_srgb : tex->rd_texture;
+					tex->request_stream();
 #ifdef TOOLS_ENABLED
 					if (tex->detect_3d_callback && p_use_linear_color) {
 						tex->detect_3d_callback(tex->detect_3d_callback_ud);
@@ -29,6 +29,7 @@
 /*************************************************************************/
 
 #include "mesh_storage.h"
+#include "servers/rendering/rendering_server_globals.h"
 
 using namespace RendererRD;
 
@@ -367,6 +368,12 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 	s->aabb = p_surface.aabb;
 	s->bone_aabbs = p_surface.bone_aabbs; //only really useful for returning them.
 
+	if (p_surface.meshlet_data.size()) {
+		ERR_FAIL_COND(p_surface.meshlet_data.size() % RS::SurfaceData::MESHLET_DATA_STRIDE != 0);
+		s->meshlet_buffer = RD::get_singleton()->storage_buffer_create(p_surface.meshlet_data.size(), p_surface.meshlet_data);
+		s->meshlet_count = p_surface.meshlet_data.size() / RS::SurfaceData::MESHLET_DATA_STRIDE;
+	}
+
 	if (mesh->blend_shape_count > 0) {
 		s->blend_shape_buffer = RD::get_singleton()->storage_buffer_create(p_surface.blend_shape_data.size(), p_surface.blend_shape_data);
 	}
@@ -548,6 +555,10 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 
 	sd.bone_aabbs = s.bone_aabbs;
 
+	if (s.meshlet_buffer.is_valid()) {
+		sd.meshlet_data = RD::get_singleton()->buffer_get_data(s.meshlet_buffer);
+	}
+
 	if (s.blend_shape_buffer.is_valid()) {
 		sd.blend_shape_data = RD::get_singleton()->buffer_get_data(s.blend_shape_buffer);
 	}
@@ -724,6 +735,9 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 			memdelete_arr(s.lods);
 		}
 
+		if (s.meshlet_buffer.is_valid()) {
+			RD::get_singleton()->free(s.meshlet_buffer);
+		}
 		if (s.blend_shape_buffer.is_valid()) {
 			RD::get_singleton()->free(s.blend_shape_buffer);
 		}
@@ -782,6 +796,9 @@ RID MeshStorage::mesh_instance_create(RID p_base) {
 
 void MeshStorage::mesh_instance_free(RID p_rid) {
 	MeshInstance *mi = mesh_instance_owner.get_or_null(p_rid);
+	if (mi->shared_skin.is_valid()) {
+		_mesh_instance_release_shared_skin(mi);
+	}
 	_mesh_instance_clear(mi);
 	mi->mesh->instances.erase(mi->I);
 	mi->I = nullptr;
@@ -797,6 +814,65 @@ void MeshStorage::mesh_instance_set_skeleton(RID p_mesh_instance, RID p_skeleton
 	mi->skeleton = p_skeleton;
 	mi->skeleton_version = 0;
 	mi->dirty = true;
+
+	_mesh_instance_update_shared_skin(mi);
+}
+
+void MeshStorage::_mesh_instance_update_shared_skin(MeshInstance *mi) {
+	Mesh *mesh = mi->mesh;
+	bool was_shared = mi->shared_skin.is_valid();
+	if (was_shared) {
+		_mesh_instance_release_shared_skin(mi);
+	}
+
+	// Without blend shapes, the skinned vertices only depend on the mesh and the skeleton.
+	if (mi->skeleton.is_valid() && mesh->has_bone_weights && mesh->blend_shape_count == 0) {
+		Pair<Mesh *, RID> key(mesh, mi->skeleton);
+		RID *shared = shared_skins.getptr(key);
+		if (shared) {
+			mi->shared_skin = *shared;
+		} else {
+			mi->shared_skin = mesh_instance_owner.make_rid();
+			MeshInstance *smi = mesh_instance_owner.get_or_null(mi->shared_skin);
+			smi->mesh = mesh;
+			smi->skeleton = mi->skeleton;
+			for (uint32_t i = 0; i < mesh->surface_count; i++) {
+				_mesh_instance_add_surface(smi, mesh, i);
+			}
+			smi->I = mesh->instances.push_back(smi);
+			smi->dirty = true;
+			shared_skins.insert(key, mi->shared_skin);
+		}
+		mesh_instance_owner.get_or_null(mi->shared_skin)->shared_skin_users++;
+
+		if (!was_shared) {
+			// Keep empty surfaces, so they still match the ones of the mesh.
+			_mesh_instance_clear(mi);
+			mi->surfaces.resize(mesh->surface_count);
+		}
+	} else if (was_shared) {
+		mi->surfaces.clear();
+		for (uint32_t i = 0; i < mesh->surface_count; i++) {
+			_mesh_instance_add_surface(mi, mesh, i);
+		}
+	}
+}
+
+void MeshStorage::_mesh_instance_release_shared_skin(MeshInstance *mi) {
+	RID shared = mi->shared_skin;
+	MeshInstance *smi = mesh_instance_owner.get_or_null(shared);
+	mi->shared_skin = RID();
+
+	smi->shared_skin_users--;
+	if (smi->shared_skin_users > 0) {
+		return;
+	}
+
+	shared_skins.erase(Pair<Mesh *, RID>(smi->mesh, smi->skeleton));
+	_mesh_instance_clear(smi);
+	smi->mesh->instances.erase(smi->I);
+	smi->I = nullptr;
+	mesh_instance_owner.free(shared);
 }
 
 void MeshStorage::mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int p_shape, float p_weight) {
@@ -808,6 +884,23 @@ void MeshStorage::mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int
 	//will be eventually updated
 }
 
+void MeshStorage::mesh_instance_set_skinning_interval(RID p_mesh_instance, uint32_t p_interval) {
+	MeshInstance *mi = mesh_instance_owner.get_or_null(p_mesh_instance);
+	ERR_FAIL_COND(!mi);
+	if (mi->shared_skin.is_valid()) {
+		mi = mesh_instance_owner.get_or_null(mi->shared_skin);
+	}
+
+	// Instances sharing a skin can be at different distances, the closest one decides.
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	if (mi->skinning_interval_frame != frame) {
+		mi->skinning_interval = p_interval;
+		mi->skinning_interval_frame = frame;
+	} else {
+		mi->skinning_interval = MIN(mi->skinning_interval, p_interval);
+	}
+}
+
 void MeshStorage::_mesh_instance_clear(MeshInstance *mi) {
 	for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
 		if (mi->surfaces[i].versions) {
@@ -831,6 +924,12 @@ void MeshStorage::_mesh_instance_clear(MeshInstance *mi) {
 }
 
 void MeshStorage::_mesh_instance_add_surface(MeshInstance *mi, Mesh *mesh, uint32_t p_surface) {
+	if (mi->shared_skin.is_valid()) {
+		// The hidden instance of the shared skin gets the surface instead.
+		mi->surfaces.push_back(MeshInstance::Surface());
+		return;
+	}
+
 	if (mesh->blend_shape_count > 0 && mi->blend_weights_buffer.is_null()) {
 		mi->blend_weights.resize(mesh->blend_shape_count);
 		for (uint32_t i = 0; i < mi->blend_weights.size(); i++) {
@@ -873,6 +972,10 @@ void MeshStorage::_mesh_instance_add_surface(MeshInstance *mi, Mesh *mesh, uint3
 
 void MeshStorage::mesh_instance_check_for_update(RID p_mesh_instance) {
 	MeshInstance *mi = mesh_instance_owner.get_or_null(p_mesh_instance);
+	if (mi->shared_skin.is_valid()) {
+		// Skinned once for all the instances sharing it.
+		mi = mesh_instance_owner.get_or_null(mi->shared_skin);
+	}
 
 	bool needs_update = mi->dirty;
 
@@ -888,7 +991,8 @@ void MeshStorage::mesh_instance_check_for_update(RID p_mesh_instance) {
 	if (!needs_update && mi->skeleton.is_valid()) {
 		Skeleton *sk = skeleton_owner.get_or_null(mi->skeleton);
 		if (sk && sk->version != mi->skeleton_version) {
-			needs_update = true;
+			// Staggered, so not all the distant instances are skinned in the same frame.
+			needs_update = mi->skinning_interval <= 1 || (RSG::rasterizer->get_frame_number() + hash_one_uint64((uint64_t)mi)) % mi->skinning_interval == 0;
 		}
 	}
 
@@ -1200,6 +1304,8 @@ void MeshStorage::multimesh_allocate_data(RID p_multimesh, int p_instances, RS::
 	multimesh->custom_data_offset_cache = multimesh->color_offset_cache + (p_use_colors ? 4 : 0);
 	multimesh->stride_cache = multimesh->custom_data_offset_cache + (p_use_custom_data ? 4 : 0);
 	multimesh->buffer_set = false;
+	multimesh->map_offset = -1;
+	multimesh->map_count = 0;
 
 	//print_line("allocate, elements: " + itos(p_instances) + " 2D: " + itos(p_transform_format == RS::MULTIMESH_TRANSFORM_2D) + " colors " + itos(multimesh->uses_colors) + " data " + itos(multimesh->uses_custom_data) + " stride " + itos(multimesh->stride_cache) + " total size " + itos(multimesh->stride_cache * multimesh->instances));
 	multimesh->data_cache = Vector<float>();
@@ -1608,6 +1714,58 @@ void MeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_b
 	}
 }
 
+void MeshStorage::_multimesh_set_range(MultiMesh *multimesh, int p_offset, int p_count, const float *p_data) {
+	if (p_count == 0) {
+		return;
+	}
+
+	_multimesh_make_local(multimesh);
+
+	memcpy(multimesh->data_cache.ptrw() + p_offset * multimesh->stride_cache, p_data, (size_t)p_count * multimesh->stride_cache * sizeof(float));
+
+	// Only the regions the range touches are uploaded, through the staging ring, on the next update.
+	int last_region = (p_offset + p_count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+	for (int i = p_offset / MULTIMESH_DIRTY_REGION_SIZE; i <= last_region; i++) {
+		_multimesh_mark_dirty(multimesh, i * MULTIMESH_DIRTY_REGION_SIZE, true);
+	}
+}
+
+void MeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND(p_offset < 0 || p_count < 0 || p_offset + p_count > multimesh->instances);
+	ERR_FAIL_COND(p_buffer.size() != (p_count * (int)multimesh->stride_cache));
+
+	_multimesh_set_range(multimesh, p_offset, p_count, p_buffer.ptr());
+}
+
+float *MeshStorage::multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND_V(!multimesh, nullptr);
+	ERR_FAIL_COND_V(p_offset < 0 || p_count <= 0 || p_offset + p_count > multimesh->instances, nullptr);
+	ERR_FAIL_COND_V_MSG(multimesh->map_offset >= 0, nullptr, "A range of this MultiMesh buffer is already mapped.");
+
+	_multimesh_make_local(multimesh);
+
+	// The buffer is kept between mappings, so mapping the same range every frame doesn't allocate.
+	multimesh->map_buffer.resize(p_count * multimesh->stride_cache);
+	memcpy(multimesh->map_buffer.ptr(), multimesh->data_cache.ptr() + p_offset * multimesh->stride_cache, multimesh->map_buffer.size() * sizeof(float));
+	multimesh->map_offset = p_offset;
+	multimesh->map_count = p_count;
+
+	return multimesh->map_buffer.ptr();
+}
+
+void MeshStorage::multimesh_unmap_buffer(RID p_multimesh) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND_MSG(multimesh->map_offset < 0, "No range of this MultiMesh buffer is mapped.");
+
+	_multimesh_set_range(multimesh, multimesh->map_offset, multimesh->map_count, multimesh->map_buffer.ptr());
+	multimesh->map_offset = -1;
+	multimesh->map_count = 0;
+}
+
 Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_COND_V(!multimesh, Vector<float>());
@@ -1683,13 +1841,19 @@ void MeshStorage::_update_dirty_multimeshes() {
 					//if there too many dirty regions, or represent the majority of regions, just copy all, else transfer cost piles up too much
 					RD::get_singleton()->buffer_update(multimesh->buffer, 0, MIN(visible_region_count * region_size, multimesh->instances * (uint32_t)multimesh->stride_cache * (uint32_t)sizeof(float)), data);
 				} else {
-					//not that many regions? update them all
+					//not that many regions? update them all, batched so they don't each need a copy command and barrier
 					for (uint32_t i = 0; i < visible_region_count; i++) {
 						if (multimesh->data_cache_dirty_regions[i]) {
 							uint32_t offset = i * region_size;
 							uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
 							uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * i;
-							RD::get_singleton()->buffer_update(multimesh->buffer, offset, MIN(region_size, size - offset), &data[region_start_index]);
+							uint32_t update_size = MIN(region_size, size - offset);
+							uint8_t *upload = RD::get_singleton()->buffer_get_upload_pointer(multimesh->buffer, offset, update_size);
+							if (upload) {
+								memcpy(upload, &data[region_start_index], update_size);
+							} else {
+								RD::get_singleton()->buffer_update(multimesh->buffer, offset, update_size, &data[region_start_index]);
+							}
 						}
 					}
 				}
@@ -1715,6 +1879,8 @@ void MeshStorage::_update_dirty_multimeshes() {
 		multimesh->dirty = false;
 	}
 
+	RD::get_singleton()->buffer_flush_uploads();
+
 	multimesh_dirty_list = nullptr;
 }
 
@@ -1800,20 +1966,27 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 12;
-
-	dataptr[0] = p_transform.basis.rows[0][0];
-	dataptr[1] = p_transform.basis.rows[0][1];
-	dataptr[2] = p_transform.basis.rows[0][2];
-	dataptr[3] = p_transform.origin.x;
-	dataptr[4] = p_transform.basis.rows[1][0];
-	dataptr[5] = p_transform.basis.rows[1][1];
-	dataptr[6] = p_transform.basis.rows[1][2];
-	dataptr[7] = p_transform.origin.y;
-	dataptr[8] = p_transform.basis.rows[2][0];
-	dataptr[9] = p_transform.basis.rows[2][1];
-	dataptr[10] = p_transform.basis.rows[2][2];
-	dataptr[11] = p_transform.origin.z;
+	float data[12] = {
+		(float)p_transform.basis.rows[0][0],
+		(float)p_transform.basis.rows[0][1],
+		(float)p_transform.basis.rows[0][2],
+		(float)p_transform.origin.x,
+		(float)p_transform.basis.rows[1][0],
+		(float)p_transform.basis.rows[1][1],
+		(float)p_transform.basis.rows[1][2],
+		(float)p_transform.origin.y,
+		(float)p_transform.basis.rows[2][0],
+		(float)p_transform.basis.rows[2][1],
+		(float)p_transform.basis.rows[2][2],
+		(float)p_transform.origin.z
+	};
+
+	// Setting the same pose again must not make the instances using the skeleton skin again.
+	if (memcmp(skeleton->data.ptr() + p_bone * 12, data, sizeof(data)) == 0) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptrw() + p_bone * 12, data, sizeof(data));
 
 	_skeleton_make_dirty(skeleton);
 }
@@ -1852,16 +2025,22 @@ void MeshStorage::skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, con
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(!skeleton->use_2d);
 
-	float *dataptr = skeleton->data.ptrw() + p_bone * 8;
+	float data[8] = {
+		(float)p_transform.columns[0][0],
+		(float)p_transform.columns[1][0],
+		0,
+		(float)p_transform.columns[2][0],
+		(float)p_transform.columns[0][1],
+		(float)p_transform.columns[1][1],
+		0,
+		(float)p_transform.columns[2][1]
+	};
+
+	if (memcmp(skeleton->data.ptr() + p_bone * 8, data, sizeof(data)) == 0) {
+		return;
+	}
 
-	dataptr[0] = p_transform.columns[0][0];
-	dataptr[1] = p_transform.columns[1][0];
-	dataptr[2] = 0;
-	dataptr[3] = p_transform.columns[2][0];
-	dataptr[4] = p_transform.columns[0][1];
-	dataptr[5] = p_transform.columns[1][1];
-	dataptr[6] = 0;
-	dataptr[7] = p_transform.columns[2][1];
+	memcpy(skeleton->data.ptrw() + p_bone * 8, data, sizeof(data));
 
 	_skeleton_make_dirty(skeleton);
 }
@@ -1894,6 +2073,22 @@ void MeshStorage::skeleton_set_base_transform_2d(RID p_skeleton, const Transform
 	skeleton->base_transform_2d = p_base_transform;
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_COND(!skeleton);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * (skeleton->use_2d ? 8 : 12));
+
+	if (skeleton->data.ptr() == p_buffer.ptr() || memcmp(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float)) == 0) {
+		return; // Same pose, the skinned instances are still valid.
+	}
+
+	// Same layout as skeleton_bone_set_transform() and skeleton_bone_set_transform_2d(), the buffer is shared instead of copied.
+	skeleton->data = p_buffer;
+
+	_skeleton_make_dirty(skeleton);
+}
+
 void MeshStorage::_update_dirty_skeletons() {
 	while (skeleton_dirty_list) {
 		Skeleton *skeleton = skeleton_dirty_list;
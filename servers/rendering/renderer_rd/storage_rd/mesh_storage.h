@@ -31,7 +31,9 @@
 #ifndef MESH_STORAGE_RD_H
 #define MESH_STORAGE_RD_H
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
 #include "servers/rendering/renderer_rd/shaders/skeleton.glsl.gen.h"
@@ -107,6 +109,10 @@ struct Mesh {
 
 		Vector<AABB> bone_aabbs;
 
+		// See RS::SurfaceData::meshlet_data, kept on the GPU for culling.
+		RID meshlet_buffer;
+		uint32_t meshlet_count = 0;
+
 		RID blend_shape_buffer;
 
 		RID material;
@@ -164,6 +170,15 @@ struct MeshInstance {
 	RID blend_weights_buffer;
 	List<MeshInstance *>::Element *I = nullptr; //used to erase itself
 	uint64_t skeleton_version = 0;
+
+	// Instances without blend shapes sharing a mesh and a skeleton use the skinned vertices of a hidden instance.
+	RID shared_skin;
+	uint32_t shared_skin_users = 0; // Only used by the hidden instance.
+
+	// Changes of the skeleton are only followed every this many frames.
+	uint32_t skinning_interval = 1;
+	uint64_t skinning_interval_frame = 0;
+
 	bool dirty = false;
 	bool weights_dirty = false;
 	SelfList<MeshInstance> weight_update_list;
@@ -192,6 +207,11 @@ struct MultiMesh {
 	bool *data_cache_dirty_regions = nullptr;
 	uint32_t data_cache_used_dirty_regions = 0;
 
+	// Range handed out by multimesh_map_buffer_range(), copied to the data cache when unmapped.
+	LocalVector<float> map_buffer;
+	int map_offset = -1; // -1 when not mapped.
+	int map_count = 0;
+
 	RID buffer; //storage buffer
 	RID uniform_set_3d;
 	RID uniform_set_2d;
@@ -276,9 +296,13 @@ private:
 
 	void _mesh_instance_clear(MeshInstance *mi);
 	void _mesh_instance_add_surface(MeshInstance *mi, Mesh *mesh, uint32_t p_surface);
+	void _mesh_instance_update_shared_skin(MeshInstance *mi);
+	void _mesh_instance_release_shared_skin(MeshInstance *mi);
 
 	mutable RID_Owner<MeshInstance> mesh_instance_owner;
 
+	HashMap<Pair<Mesh *, RID>, RID, PairHash<Mesh *, RID>> shared_skins;
+
 	SelfList<MeshInstance>::List dirty_mesh_instance_weights;
 	SelfList<MeshInstance>::List dirty_mesh_instance_arrays;
 
@@ -292,6 +316,7 @@ private:
 	_FORCE_INLINE_ void _multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_re_create_aabb(MultiMesh *multimesh, const float *p_data, int p_instances);
+	void _multimesh_set_range(MultiMesh *multimesh, int p_offset, int p_count, const float *p_data);
 
 	/* Skeleton */
 
@@ -465,6 +490,9 @@ public:
 	_FORCE_INLINE_ void mesh_instance_surface_get_vertex_arrays_and_format(RID p_mesh_instance, uint32_t p_surface_index, uint32_t p_input_mask, RID &r_vertex_array_rd, RD::VertexFormatID &r_vertex_format) {
 		MeshInstance *mi = mesh_instance_owner.get_or_null(p_mesh_instance);
 		ERR_FAIL_COND(!mi);
+		if (mi->shared_skin.is_valid()) {
+			mi = mesh_instance_owner.get_or_null(mi->shared_skin);
+		}
 		Mesh *mesh = mi->mesh;
 		ERR_FAIL_UNSIGNED_INDEX(p_surface_index, mesh->surface_count);
 
@@ -551,6 +579,7 @@ public:
 	virtual void mesh_instance_free(RID p_rid) override;
 	virtual void mesh_instance_set_skeleton(RID p_mesh_instance, RID p_skeleton) override;
 	virtual void mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int p_shape, float p_weight) override;
+	virtual void mesh_instance_set_skinning_interval(RID p_mesh_instance, uint32_t p_interval) override;
 	virtual void mesh_instance_check_for_update(RID p_mesh_instance) override;
 	virtual void update_mesh_instances() override;
 
@@ -580,8 +609,12 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const override;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) override;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) override;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const override;
 
+	virtual float *multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) override;
+	virtual void multimesh_unmap_buffer(RID p_multimesh) override;
+
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const override;
 
@@ -665,6 +698,7 @@ public:
 
 	virtual void skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) override;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) override;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) override;
 	void skeleton_set_world_transform(RID p_skeleton, bool p_enable, const Transform3D &p_world_transform);
 	virtual int skeleton_get_bone_count(RID p_skeleton) const override;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) override;
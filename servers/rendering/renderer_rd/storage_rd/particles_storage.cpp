@@ -29,6 +29,7 @@
 /*************************************************************************/
 
 #include "particles_storage.h"
+#include "core/config/project_settings.h"
 #include "servers/rendering/renderer_rd/renderer_compositor_rd.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "texture_storage.h"
@@ -44,6 +45,8 @@ ParticlesStorage *ParticlesStorage::get_singleton() {
 ParticlesStorage::ParticlesStorage() {
 	singleton = this;
 
+	sort_update_interval = MAX(1, int(GLOBAL_GET("rendering/particles/view_depth_sort/update_interval")));
+
 	MaterialStorage *material_storage = MaterialStorage::get_singleton();
 
 	/* Particles */
@@ -287,7 +290,12 @@ void ParticlesStorage::_particles_free_data(Particles *particles) {
 		RD::get_singleton()->free(particles->particles_sort_buffer);
 		particles->particles_sort_buffer = RID();
 		particles->particles_sort_uniform_set = RID();
+		RD::get_singleton()->free(particles->particles_sort_scratch_buffer);
+		particles->particles_sort_scratch_buffer = RID();
+		RD::get_singleton()->free(particles->particles_sort_histogram_buffer);
+		particles->particles_sort_histogram_buffer = RID();
 	}
+	particles->particles_sort_valid = false;
 
 	if (particles->emission_buffer != nullptr) {
 		particles->emission_buffer = nullptr;
@@ -1037,7 +1045,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 	if (sub_emitter && sub_emitter->emission_storage_buffer.is_valid()) {
 		//	print_line("updating subemitter buffer");
 		int32_t zero[4] = { 0, sub_emitter->amount, 0, 0 };
-		RD::get_singleton()->buffer_update(sub_emitter->emission_storage_buffer, 0, sizeof(uint32_t) * 4, zero);
+		RD::get_singleton()->buffer_update(sub_emitter->emission_storage_buffer, 0, sizeof(uint32_t) * 4, zero, RD::BARRIER_MASK_COMPUTE);
 		push_constant.can_emit = true;
 
 		if (sub_emitter->emitting) {
@@ -1055,7 +1063,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 	}
 
 	if (p_particles->emission_buffer && p_particles->emission_buffer->particle_count) {
-		RD::get_singleton()->buffer_update(p_particles->emission_storage_buffer, 0, sizeof(uint32_t) * 4 + sizeof(ParticleEmissionBuffer::Data) * p_particles->emission_buffer->particle_count, p_particles->emission_buffer);
+		RD::get_singleton()->buffer_update(p_particles->emission_storage_buffer, 0, sizeof(uint32_t) * 4 + sizeof(ParticleEmissionBuffer::Data) * p_particles->emission_buffer->particle_count, p_particles->emission_buffer, RD::BARRIER_MASK_COMPUTE);
 		p_particles->emission_buffer->particle_count = 0;
 	}
 
@@ -1071,7 +1079,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 		p_particles->trail_params[0] = p_particles->frame_history[0];
 	}
 
-	RD::get_singleton()->buffer_update(p_particles->frame_params_buffer, 0, sizeof(ParticlesFrameParams) * p_particles->trail_params.size(), p_particles->trail_params.ptr());
+	RD::get_singleton()->buffer_update(p_particles->frame_params_buffer, 0, sizeof(ParticlesFrameParams) * p_particles->trail_params.size(), p_particles->trail_params.ptr(), RD::BARRIER_MASK_COMPUTE);
 
 	ParticlesMaterialData *m = static_cast<ParticlesMaterialData *>(material_storage->material_get_data(p_particles->process_material, SHADER_TYPE_PARTICLES));
 	if (!m) {
@@ -1108,7 +1116,8 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, process_amount, 1, 1);
 	}
 
-	RD::get_singleton()->compute_list_end();
+	// The particle buffer is only read by the copy pass and by transfers, so raster work doesn't have to wait here.
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_COMPUTE | RD::BARRIER_MASK_TRANSFER);
 }
 
 void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis) {
@@ -1119,110 +1128,186 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		return;
 	}
 
-	if (particles->particle_buffer.is_null()) {
-		return; //particles have not processed yet
+	particles->view_axis = p_axis;
+	particles->view_up_axis = p_up_axis;
+
+	// The copies and sorts of all particles are done together in update_particles_view_axis(), so they share dispatches and barriers.
+	if (!particles->view_axis_update_pending) {
+		particles->view_axis_update_pending = true;
+		view_axis_update_list.push_back(p_particles);
 	}
+}
 
-	bool do_sort = particles->draw_order == RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH;
+void ParticlesStorage::update_particles_view_axis() {
+	if (view_axis_update_list.is_empty()) {
+		return;
+	}
+
+	uint64_t frame = RSG::rasterizer->get_frame_number();
 
-	//copy to sort buffer
-	if (do_sort && particles->particles_sort_buffer == RID()) {
-		uint32_t size = particles->amount;
-		if (size & 1) {
-			size++; //make multiple of 16
+	view_axis_updates.clear();
+
+	for (uint32_t i = 0; i < view_axis_update_list.size(); i++) {
+		Particles *particles = particles_owner.get_or_null(view_axis_update_list[i]);
+		if (!particles) {
+			continue; // Freed since it was culled.
 		}
-		size *= sizeof(float) * 2;
-		particles->particles_sort_buffer = RD::get_singleton()->storage_buffer_create(size);
 
-		{
-			Vector<RD::Uniform> uniforms;
+		particles->view_axis_update_pending = false;
 
-			{
-				RD::Uniform u;
-				u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
-				u.binding = 0;
-				u.append_id(particles->particles_sort_buffer);
-				uniforms.push_back(u);
+		if (particles->particle_buffer.is_null()) {
+			continue; //particles have not processed yet
+		}
+
+		ViewAxisUpdate update;
+		update.particles = particles;
+		update.do_sort = particles->draw_order == RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH;
+
+		//copy to sort buffer
+		if (update.do_sort && particles->particles_sort_buffer == RID()) {
+			uint32_t size = particles->amount;
+			if (size & 1) {
+				size++; //make multiple of 16
 			}
+			size *= sizeof(float) * 2;
+			particles->particles_sort_buffer = RD::get_singleton()->storage_buffer_create(size);
+			particles->particles_sort_scratch_buffer = RD::get_singleton()->storage_buffer_create(size);
+			particles->particles_sort_histogram_buffer = RD::get_singleton()->storage_buffer_create(EffectsRD::sort_get_histogram_buffer_size(particles->amount));
+			particles->particles_sort_valid = false;
 
-			particles->particles_sort_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, particles_shader.copy_shader.version_get_shader(particles_shader.copy_shader_version, ParticlesShader::COPY_MODE_FILL_SORT_BUFFER), 1);
+			{
+				Vector<RD::Uniform> uniforms;
+
+				{
+					RD::Uniform u;
+					u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+					u.binding = 0;
+					u.append_id(particles->particles_sort_buffer);
+					uniforms.push_back(u);
+				}
+
+				particles->particles_sort_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, particles_shader.copy_shader.version_get_shader(particles_shader.copy_shader_version, ParticlesShader::COPY_MODE_FILL_SORT_BUFFER), 1);
+			}
 		}
-	}
 
-	ParticlesShader::CopyPushConstant copy_push_constant;
+		// Sorting less often than every frame reuses the last order in between, and the emitters are spread over the frames of the interval.
+		update.sort_now = update.do_sort && (!particles->particles_sort_valid || sort_update_interval <= 1 || (frame + view_axis_update_list[i].get_id()) % sort_update_interval == 0);
 
-	if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
-		int fixed_fps = 60.0;
-		if (particles->fixed_fps > 0) {
-			fixed_fps = particles->fixed_fps;
+		ParticlesShader::CopyPushConstant &copy_push_constant = update.copy_push_constant;
+
+		if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
+			int fixed_fps = 60.0;
+			if (particles->fixed_fps > 0) {
+				fixed_fps = particles->fixed_fps;
+			}
+
+			copy_push_constant.trail_size = particles->trail_bind_poses.size();
+			copy_push_constant.trail_total = particles->frame_history.size();
+			copy_push_constant.frame_delta = 1.0 / fixed_fps;
+		} else {
+			copy_push_constant.trail_size = 1;
+			copy_push_constant.trail_total = 1;
+			copy_push_constant.frame_delta = 0.0;
 		}
 
-		copy_push_constant.trail_size = particles->trail_bind_poses.size();
-		copy_push_constant.trail_total = particles->frame_history.size();
-		copy_push_constant.frame_delta = 1.0 / fixed_fps;
-	} else {
-		copy_push_constant.trail_size = 1;
-		copy_push_constant.trail_total = 1;
-		copy_push_constant.frame_delta = 0.0;
-	}
+		copy_push_constant.order_by_lifetime = (particles->draw_order == RS::PARTICLES_DRAW_ORDER_LIFETIME || particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME);
+		copy_push_constant.lifetime_split = MIN(particles->amount * particles->phase, particles->amount - 1);
+		copy_push_constant.lifetime_reverse = particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME;
+
+		copy_push_constant.frame_remainder = particles->interpolate ? particles->frame_remainder : 0.0;
+		copy_push_constant.total_particles = particles->amount;
+		copy_push_constant.copy_mode_2d = false;
+
+		Vector3 axis = -particles->view_axis; // cameras look to z negative
+
+		if (particles->use_local_coords) {
+			axis = particles->emission_transform.basis.xform_inv(axis).normalized();
+		}
 
-	copy_push_constant.order_by_lifetime = (particles->draw_order == RS::PARTICLES_DRAW_ORDER_LIFETIME || particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME);
-	copy_push_constant.lifetime_split = MIN(particles->amount * particles->phase, particles->amount - 1);
-	copy_push_constant.lifetime_reverse = particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME;
+		copy_push_constant.sort_direction[0] = axis.x;
+		copy_push_constant.sort_direction[1] = axis.y;
+		copy_push_constant.sort_direction[2] = axis.z;
 
-	copy_push_constant.frame_remainder = particles->interpolate ? particles->frame_remainder : 0.0;
-	copy_push_constant.total_particles = particles->amount;
-	copy_push_constant.copy_mode_2d = false;
+		copy_push_constant.align_up[0] = particles->view_up_axis.x;
+		copy_push_constant.align_up[1] = particles->view_up_axis.y;
+		copy_push_constant.align_up[2] = particles->view_up_axis.z;
 
-	Vector3 axis = -p_axis; // cameras look to z negative
+		copy_push_constant.align_mode = particles->transform_align;
 
-	if (particles->use_local_coords) {
-		axis = particles->emission_transform.basis.xform_inv(axis).normalized();
+		view_axis_updates.push_back(update);
 	}
 
-	copy_push_constant.sort_direction[0] = axis.x;
-	copy_push_constant.sort_direction[1] = axis.y;
-	copy_push_constant.sort_direction[2] = axis.z;
+	view_axis_update_list.clear();
 
-	copy_push_constant.align_up[0] = p_up_axis.x;
-	copy_push_constant.align_up[1] = p_up_axis.y;
-	copy_push_constant.align_up[2] = p_up_axis.z;
+	if (view_axis_updates.is_empty()) {
+		return;
+	}
 
-	copy_push_constant.align_mode = particles->transform_align;
+	LocalVector<EffectsRD::SortBuffer> sort_buffers;
 
-	if (do_sort) {
+	{
 		RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
-		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_SORT_BUFFER + particles->userdata_count * ParticlesShader::COPY_MODE_MAX]);
-		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
-		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
-		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
-		RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
+		for (uint32_t i = 0; i < view_axis_updates.size(); i++) {
+			const ViewAxisUpdate &update = view_axis_updates[i];
+			if (!update.sort_now) {
+				continue;
+			}
 
-		RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
+			Particles *particles = update.particles;
+
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_SORT_BUFFER + particles->userdata_count * ParticlesShader::COPY_MODE_MAX]);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &update.copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
+
+			RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
+
+			EffectsRD::SortBuffer sort_buffer;
+			sort_buffer.buffer = particles->particles_sort_buffer;
+			sort_buffer.scratch_buffer = particles->particles_sort_scratch_buffer;
+			sort_buffer.histogram_buffer = particles->particles_sort_histogram_buffer;
+			sort_buffer.size = particles->amount;
+			sort_buffers.push_back(sort_buffer);
+
+			particles->particles_sort_valid = true;
+		}
 
 		RD::get_singleton()->compute_list_end();
-		RendererCompositorRD::singleton->get_effects()->sort_buffer(particles->particles_sort_uniform_set, particles->amount);
 	}
 
-	copy_push_constant.total_particles *= copy_push_constant.total_particles;
+	if (sort_buffers.size()) {
+		RendererCompositorRD::singleton->get_effects()->sort_buffers(sort_buffers.ptr(), sort_buffers.size());
+	}
 
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
-	uint32_t copy_pipeline = do_sort ? ParticlesShader::COPY_MODE_FILL_INSTANCES_WITH_SORT_BUFFER : ParticlesShader::COPY_MODE_FILL_INSTANCES;
-	copy_pipeline += particles->userdata_count * ParticlesShader::COPY_MODE_MAX;
-	copy_push_constant.copy_mode_2d = particles->mode == RS::PARTICLES_MODE_2D ? 1 : 0;
-	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[copy_pipeline]);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
-	if (do_sort) {
-		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
-	}
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
 
-	RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
+	for (uint32_t i = 0; i < view_axis_updates.size(); i++) {
+		ViewAxisUpdate &update = view_axis_updates[i];
+		Particles *particles = update.particles;
+		ParticlesShader::CopyPushConstant &copy_push_constant = update.copy_push_constant;
 
-	RD::get_singleton()->compute_list_dispatch_threads(compute_list, copy_push_constant.total_particles, 1, 1);
+		copy_push_constant.total_particles *= copy_push_constant.total_particles;
+
+		uint32_t copy_pipeline = update.do_sort ? ParticlesShader::COPY_MODE_FILL_INSTANCES_WITH_SORT_BUFFER : ParticlesShader::COPY_MODE_FILL_INSTANCES;
+		copy_pipeline += particles->userdata_count * ParticlesShader::COPY_MODE_MAX;
+		copy_push_constant.copy_mode_2d = particles->mode == RS::PARTICLES_MODE_2D ? 1 : 0;
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[copy_pipeline]);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
+		if (update.do_sort) {
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
+		}
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
+
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
+
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, copy_push_constant.total_particles, 1, 1);
+	}
 
 	RD::get_singleton()->compute_list_end();
+
+	view_axis_updates.clear();
 }
 
 void ParticlesStorage::_particles_update_buffers(Particles *particles) {
@@ -1385,7 +1470,7 @@ void ParticlesStorage::update_particles() {
 					RendererRD::MaterialStorage::store_transform(particles->trail_bind_poses[i], &particles_shader.pose_update_buffer[i * 16]);
 				}
 
-				RD::get_singleton()->buffer_update(particles->trail_bind_pose_buffer, 0, particles->trail_bind_poses.size() * 16 * sizeof(float), particles_shader.pose_update_buffer.ptr());
+				RD::get_singleton()->buffer_update(particles->trail_bind_pose_buffer, 0, particles->trail_bind_poses.size() * 16 * sizeof(float), particles_shader.pose_update_buffer.ptr(), RD::BARRIER_MASK_COMPUTE);
 			}
 		}
 
@@ -192,6 +192,13 @@ struct Particles {
 
 	RID particles_sort_buffer;
 	RID particles_sort_uniform_set;
+	RID particles_sort_scratch_buffer;
+	RID particles_sort_histogram_buffer;
+	bool particles_sort_valid = false; // The sort buffer holds an order, even if an old one.
+
+	Vector3 view_axis;
+	Vector3 view_up_axis;
+	bool view_axis_update_pending = false;
 
 	bool dirty = false;
 	Particles *update_list = nullptr;
@@ -336,6 +343,18 @@ private:
 
 	Particles *particle_update_list = nullptr;
 
+	struct ViewAxisUpdate {
+		Particles *particles = nullptr;
+		ParticlesShader::CopyPushConstant copy_push_constant;
+		bool do_sort = false;
+		bool sort_now = false;
+	};
+
+	// Filled by particles_set_view_axis() while culling and processed together by update_particles_view_axis().
+	LocalVector<RID> view_axis_update_list;
+	LocalVector<ViewAxisUpdate> view_axis_updates;
+	uint32_t sort_update_interval = 1;
+
 	mutable RID_Owner<Particles, true> particles_owner;
 
 	/* Particle Shader */
@@ -525,6 +544,7 @@ public:
 	virtual void particles_set_canvas_sdf_collision(RID p_particles, bool p_enable, const Transform2D &p_xform, const Rect2 &p_to_screen, RID p_texture) override;
 
 	virtual void update_particles() override;
+	virtual void update_particles_view_axis() override;
 
 	/* Particles Collision */
 
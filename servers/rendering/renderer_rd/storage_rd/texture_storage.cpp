@@ -533,6 +533,7 @@ bool TextureStorage::canvas_texture_get_uniform_set(RID p_texture, RS::CanvasIte
 			t->canvas_texture->diffuse = p_texture;
 		}
 
+		t->request_stream();
 		ct = t->canvas_texture;
 	} else {
 		ct = get_canvas_texture(p_texture);
@@ -1288,6 +1289,14 @@ void TextureStorage::texture_set_detect_roughness_callback(RID p_texture, RS::Te
 	tex->detect_roughness_callback = p_callback;
 }
 
+void TextureStorage::texture_set_stream_request_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) {
+	Texture *tex = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_COND(!tex);
+
+	tex->stream_request_callback_ud = p_userdata;
+	tex->stream_request_callback = p_callback;
+}
+
 void TextureStorage::texture_debug_usage(List<RS::TextureInfo> *r_info) {
 }
 
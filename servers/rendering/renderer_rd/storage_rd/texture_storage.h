@@ -137,9 +137,20 @@ public:
 	RS::TextureDetectRoughnessCallback detect_roughness_callback = nullptr;
 	void *detect_roughness_callback_ud = nullptr;
 
+	RS::TextureDetectCallback stream_request_callback = nullptr;
+	void *stream_request_callback_ud = nullptr;
+
 	CanvasTexture *canvas_texture = nullptr;
 
 	void cleanup();
+
+	_FORCE_INLINE_ void request_stream() {
+		if (stream_request_callback) {
+			RS::TextureDetectCallback callback = stream_request_callback;
+			stream_request_callback = nullptr; // Only request once.
+			callback(stream_request_callback_ud);
+		}
+	}
 };
 
 struct DecalAtlas {
@@ -386,6 +397,7 @@ public:
 	virtual void texture_set_detect_3d_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 	virtual void texture_set_detect_normal_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override;
+	virtual void texture_set_stream_request_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override;
 
@@ -307,6 +307,7 @@ void Utilities::update_memory_info() {
 	texture_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TEXTURES);
 	buffer_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_BUFFERS);
 	total_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TOTAL);
+	budget_mem_cache = RenderingDevice::get_singleton()->get_memory_budget();
 }
 
 uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
@@ -316,6 +317,8 @@ uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_BUDGET) {
+		return budget_mem_cache;
 	}
 	return 0;
 }
@@ -59,6 +59,7 @@ private:
 	uint64_t texture_mem_cache = 0;
 	uint64_t buffer_mem_cache = 0;
 	uint64_t total_mem_cache = 0;
+	uint64_t budget_mem_cache = 0;
 
 public:
 	static Utilities *get_singleton() { return singleton; }
@@ -30,6 +30,8 @@
 
 #include "uniform_set_cache_rd.h"
 
+#include "core/config/project_settings.h"
+
 UniformSetCacheRD *UniformSetCacheRD::singleton = nullptr;
 
 void UniformSetCacheRD::_invalidate(Cache *p_cache) {
@@ -45,6 +47,8 @@ void UniformSetCacheRD::_invalidate(Cache *p_cache) {
 		p_cache->next->prev = p_cache->prev;
 	}
 
+	_lru_unlink(p_cache);
+
 	cache_allocator.free(p_cache);
 	cache_instances_used--;
 }
@@ -52,9 +56,21 @@ void UniformSetCacheRD::_uniform_set_invalidation_callback(void *p_userdata) {
 	singleton->_invalidate(reinterpret_cast<Cache *>(p_userdata));
 }
 
+void UniformSetCacheRD::begin_frame() {
+	frame++;
+
+	// Sets handed out in the previous frame may still be recorded in command lists that are not submitted yet, so they are kept
+	// even above the limit. Freeing a set invalidates (and unlinks) its cache entry, and the device releases it once the GPU is done with it.
+	while (cache_instances_used > max_cache_instances && lru_last && lru_last->last_used_frame + 1 < frame) {
+		RD::get_singleton()->free(lru_last->cache);
+	}
+}
+
 UniformSetCacheRD::UniformSetCacheRD() {
 	ERR_FAIL_COND(singleton != nullptr);
 	singleton = this;
+
+	max_cache_instances = MAX(1, int(GLOBAL_GET("rendering/limits/uniform_set_cache/max_cached_sets")));
 }
 
 UniformSetCacheRD::~UniformSetCacheRD() {
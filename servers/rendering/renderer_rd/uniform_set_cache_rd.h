@@ -46,6 +46,11 @@ class UniformSetCacheRD : public Object {
 		uint32_t set = 0;
 		RID cache;
 		LocalVector<RD::Uniform> uniforms;
+
+		// Least recently used list, used to free the sets that are not needed anymore once there are too many.
+		Cache *lru_prev = nullptr;
+		Cache *lru_next = nullptr;
+		uint64_t last_used_frame = 0;
 	};
 
 	PagedAllocator<Cache> cache_allocator;
@@ -120,6 +125,45 @@ class UniformSetCacheRD : public Object {
 	static UniformSetCacheRD *singleton;
 
 	uint32_t cache_instances_used = 0;
+	uint32_t max_cache_instances = 0;
+
+	Cache *lru_first = nullptr; // Most recently used.
+	Cache *lru_last = nullptr;
+	uint64_t frame = 0;
+
+	_FORCE_INLINE_ void _lru_unlink(Cache *p_cache) {
+		if (p_cache->lru_prev) {
+			p_cache->lru_prev->lru_next = p_cache->lru_next;
+		} else {
+			lru_first = p_cache->lru_next;
+		}
+		if (p_cache->lru_next) {
+			p_cache->lru_next->lru_prev = p_cache->lru_prev;
+		} else {
+			lru_last = p_cache->lru_prev;
+		}
+		p_cache->lru_prev = nullptr;
+		p_cache->lru_next = nullptr;
+	}
+
+	_FORCE_INLINE_ void _lru_push_front(Cache *p_cache) {
+		p_cache->lru_next = lru_first;
+		if (lru_first) {
+			lru_first->lru_prev = p_cache;
+		} else {
+			lru_last = p_cache;
+		}
+		lru_first = p_cache;
+	}
+
+	_FORCE_INLINE_ void _touch(Cache *p_cache) {
+		if (p_cache->last_used_frame == frame) {
+			return; // Already moved to the front this frame.
+		}
+		p_cache->last_used_frame = frame;
+		_lru_unlink(p_cache);
+		_lru_push_front(p_cache);
+	}
 
 	void _invalidate(Cache *p_cache);
 	static void _uniform_set_invalidation_callback(void *p_userdata);
@@ -144,6 +188,9 @@ class UniformSetCacheRD : public Object {
 		}
 		hash_table[p_table_idx] = c;
 
+		c->last_used_frame = frame;
+		_lru_push_front(c);
+
 		RD::get_singleton()->uniform_set_set_invalidation_callback(rid, _uniform_set_invalidation_callback, c);
 
 		cache_instances_used++;
@@ -160,10 +207,11 @@ public:
 
 		uint32_t table_idx = h % HASH_TABLE_SIZE;
 		{
-			const Cache *c = hash_table[table_idx];
+			Cache *c = hash_table[table_idx];
 
 			while (c) {
 				if (c->hash == h && c->set == p_set && c->shader == p_shader && _compare_args(0, c->uniforms, args...)) {
+					_touch(c);
 					return c->cache;
 				}
 				c = c->next;
@@ -190,7 +238,7 @@ public:
 
 		uint32_t table_idx = h % HASH_TABLE_SIZE;
 		{
-			const Cache *c = hash_table[table_idx];
+			Cache *c = hash_table[table_idx];
 
 			while (c) {
 				if (c->hash == h && c->set == p_set && c->shader == p_shader) {
@@ -203,6 +251,7 @@ public:
 					}
 
 					if (all_ok) {
+						_touch(c);
 						return c->cache;
 					}
 				}
@@ -214,6 +263,9 @@ public:
 		return _allocate_from_uniforms(p_shader, p_set, h, table_idx, p_uniforms);
 	}
 
+	// Frees the least recently used sets beyond the limit, as long as they were not used in the previous frame.
+	void begin_frame();
+
 	static UniformSetCacheRD *get_singleton() { return singleton; }
 
 	UniformSetCacheRD();
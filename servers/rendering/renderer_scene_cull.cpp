@@ -32,6 +32,8 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
+#include "core/os/profiling.h"
+#include "raster_occlusion_cull.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
 
@@ -144,6 +146,9 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 
 		if (geom->can_cast_shadows) {
 			light->shadow_dirty = true;
+			if (_instance_casts_static_shadows(A)) {
+				light->static_shadow_dirty = true;
+			}
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -251,6 +256,9 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 
 		if (geom->can_cast_shadows) {
 			light->shadow_dirty = true;
+			if (_instance_casts_static_shadows(A)) {
+				light->static_shadow_dirty = true;
+			}
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -476,6 +484,7 @@ void RendererSceneCull::_instance_update_mesh_instance(Instance *p_instance) {
 
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
 		geom->geometry_instance->set_mesh_instance(p_instance->mesh_instance);
+		_instance_static_shadows_changed(p_instance);
 
 		if (p_instance->scenario && p_instance->array_index >= 0) {
 			InstanceData &idata = p_instance->scenario->instance_data[p_instance->array_index];
@@ -492,6 +501,24 @@ void RendererSceneCull::_instance_update_mesh_instance(Instance *p_instance) {
 	}
 }
 
+bool RendererSceneCull::_instance_casts_static_shadows(const Instance *p_instance) {
+	// Only geometry using baked light is expected to stay in place. Skinned, blended and animated geometry can change every frame.
+	return p_instance->baked_light && !p_instance->mesh_instance.is_valid() && !static_cast<InstanceGeometryData *>(p_instance->base_data)->material_is_animated;
+}
+
+void RendererSceneCull::_instance_static_shadows_changed(Instance *p_instance) {
+	InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
+	if (!geom->can_cast_shadows) {
+		return;
+	}
+
+	for (const Instance *E : geom->lights) {
+		InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
+		light->shadow_dirty = true;
+		light->static_shadow_dirty = true;
+	}
+}
+
 void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND(!instance);
@@ -856,7 +883,9 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND(!instance);
 
-	if (instance->transform == p_transform) {
+	bool interpolate = interpolation_data.enabled && instance->interpolated;
+
+	if ((interpolate ? instance->transform_curr : instance->transform) == p_transform) {
 		return; //must be checked to avoid worst evil
 	}
 
@@ -873,10 +902,55 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	}
 
 #endif
+	if (interpolate) {
+		if (!instance->on_interpolate_list) {
+			// Was at rest, start moving from where it was.
+			instance->transform_prev = instance->transform_curr;
+			instance->on_interpolate_list = true;
+			interpolation_data.interpolate_list.push_back(p_instance);
+		}
+		if (instance->interpolation_tick != interpolation_data.tick) {
+			instance->interpolation_tick = interpolation_data.tick;
+			interpolation_data.tick_list_curr.push_back(p_instance);
+		}
+		instance->transform_curr = p_transform;
+		return; // Drawn from update_interpolation_frame().
+	}
+
+	instance->transform_curr = p_transform;
 	instance->transform = p_transform;
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::_instance_snap_interpolation(Instance *p_instance) {
+	p_instance->transform_prev = p_instance->transform_curr;
+	p_instance->on_interpolate_list = false;
+
+	if (p_instance->transform != p_instance->transform_curr) {
+		p_instance->transform = p_instance->transform_curr;
+		_instance_queue_update(p_instance, true);
+	}
+}
+
+void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	if (instance->interpolated == p_interpolated) {
+		return;
+	}
+
+	instance->interpolated = p_interpolated;
+	_instance_snap_interpolation(instance);
+}
+
+void RendererSceneCull::instance_reset_physics_interpolation(RID p_instance) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	_instance_snap_interpolation(instance);
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND(!instance);
@@ -1116,6 +1190,10 @@ void RendererSceneCull::instance_geometry_set_flag(RID p_instance, RS::InstanceF
 
 	switch (p_flags) {
 		case RS::INSTANCE_FLAG_USE_BAKED_LIGHT: {
+			if (((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) && instance->base_data && bool(instance->baked_light) != p_enabled) {
+				// Changes whether it's drawn into the static shadow cache.
+				_instance_static_shadows_changed(instance);
+			}
 			instance->baked_light = p_enabled;
 
 			if (instance->scenario && instance->array_index >= 0) {
@@ -1492,6 +1570,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		scene_render->light_instance_set_transform(light->instance, p_instance->transform);
 		scene_render->light_instance_set_aabb(light->instance, p_instance->transform.xform(p_instance->aabb));
 		light->shadow_dirty = true;
+		light->static_shadow_dirty = true;
 
 		RS::LightBakeMode bake_mode = RSG::light_storage->light_get_bake_mode(p_instance->base);
 		if (RSG::light_storage->light_get_type(p_instance->base) != RS::LIGHT_DIRECTIONAL && bake_mode != light->bake_mode) {
@@ -1574,9 +1653,13 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		//make sure lights are updated if it casts shadow
 
 		if (geom->can_cast_shadows) {
+			bool casts_static_shadows = _instance_casts_static_shadows(p_instance);
 			for (const Instance *E : geom->lights) {
 				InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
 				light->shadow_dirty = true;
+				if (casts_static_shadows) {
+					light->static_shadow_dirty = true;
+				}
 			}
 		}
 
@@ -1763,11 +1846,76 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		pair.bvh2 = &p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES];
 	}
 
-	pair.pair();
+	if (pair_queue_enabled) {
+		if (p_instance->pair_queue_index == -1) {
+			p_instance->pair_queue_index = pair_queue.size();
+			pair_queue.push_back(PairQueueItem());
+		}
+		PairQueueItem &item = pair_queue[p_instance->pair_queue_index];
+		item.instance = p_instance;
+		item.bvh = pair.bvh;
+		item.bvh2 = pair.bvh2;
+		item.pair_mask = pair.pair_mask;
+	} else {
+		pair.pair();
+	}
 
 	p_instance->prev_transformed_aabb = p_instance->transformed_aabb;
 }
 
+void RendererSceneCull::_pair_queue_query(uint32_t p_index, PairQueueItem *p_items) {
+	PairQueueItem &item = p_items[p_index];
+
+	PairQuery query;
+	query.instance = item.instance;
+	query.found = &item.found;
+	query.pair_mask = item.pair_mask;
+
+	if (item.bvh) {
+		item.bvh->aabb_query(item.instance->transformed_aabb, query);
+	}
+	if (item.bvh2) {
+		item.bvh2->aabb_query(item.instance->transformed_aabb, query);
+	}
+}
+
+void RendererSceneCull::_flush_pair_queue() {
+	if (pair_queue.is_empty()) {
+		return;
+	}
+
+	//querying the indexers is most of the cost, and can be done for all the instances at once since they are no longer moving
+	if (pair_queue.size() > pair_thread_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_pair_queue_query, pair_queue.ptr(), pair_queue.size(), -1, true, SNAME("PairInstances"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < pair_queue.size(); i++) {
+			_pair_queue_query(i, pair_queue.ptr());
+		}
+	}
+
+	//pairing changes the pair lists of both instances, so it stays serial, in the order the instances were updated
+	for (uint32_t i = 0; i < pair_queue.size(); i++) {
+		PairQueueItem &item = pair_queue[i];
+		item.instance->pair_queue_index = -1;
+
+		if (!item.instance->indexer_id.is_valid()) {
+			continue; //removed from the indexers after it was queued
+		}
+
+		pair_pass++;
+
+		PairInstances pair;
+		pair.instance = item.instance;
+		pair.pair_allocator = &pair_allocator;
+		pair.pair_pass = pair_pass;
+		pair.pair_mask = item.pair_mask;
+		pair.pair_found(item.found);
+	}
+
+	pair_queue.clear();
+}
+
 void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 	if (!p_instance->indexer_id.is_valid()) {
 		return; //nothing to do
@@ -2218,7 +2366,16 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 	bool animated_material_found = false;
 
-	switch (RSG::light_storage->light_get_type(p_instance->base)) {
+	RS::LightType light_type = RSG::light_storage->light_get_type(p_instance->base);
+
+	// Static casters can be kept in the renderer's cache of the shadow, so only the dynamic ones are drawn over them while it's valid.
+	bool use_static_cache = light_type != RS::LIGHT_DIRECTIONAL && scene_render->light_instances_can_cache_static_shadows();
+	if (light_type == RS::LIGHT_OMNI && RSG::light_storage->light_omni_get_shadow_mode(p_instance->base) == RS::LIGHT_OMNI_SHADOW_CUBE && scene_render->light_instances_can_render_shadow_cube()) {
+		use_static_cache = false; // Cube shadows are redrawn from scratch.
+	}
+	bool update_static_cache = use_static_cache && !scene_render->shadow_atlas_static_cache_is_valid(p_shadow_atlas, light->instance, light->static_version);
+
+	switch (light_type) {
 		case RS::LIGHT_DIRECTIONAL: {
 		} break;
 		case RS::LIGHT_OMNI: {
@@ -2278,7 +2435,13 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 							}
 						}
 
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						if (use_static_cache && _instance_casts_static_shadows(instance)) {
+							if (update_static_cache) {
+								shadow_data.static_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+							}
+						} else {
+							shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						}
 					}
 
 					RSG::mesh_storage->update_mesh_instances();
@@ -2286,6 +2449,9 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					scene_render->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, i, 0);
 					shadow_data.light = light->instance;
 					shadow_data.pass = i;
+					shadow_data.use_static_cache = use_static_cache;
+					shadow_data.update_static_cache = update_static_cache;
+					shadow_data.static_version = light->static_version;
 				}
 			} else { //shadow cube
 
@@ -2418,7 +2584,13 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 					}
 				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				if (use_static_cache && _instance_casts_static_shadows(instance)) {
+					if (update_static_cache) {
+						shadow_data.static_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+					}
+				} else {
+					shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				}
 			}
 
 			RSG::mesh_storage->update_mesh_instances();
@@ -2426,6 +2598,9 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			scene_render->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
 			shadow_data.light = light->instance;
 			shadow_data.pass = 0;
+			shadow_data.use_static_cache = use_static_cache;
+			shadow_data.update_static_cache = update_static_cache;
+			shadow_data.static_version = light->static_version;
 
 		} break;
 	}
@@ -2435,6 +2610,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 void RendererSceneCull::render_camera(RID p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, bool p_use_taa, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info) {
 #ifndef _3D_DISABLED
+	PROFILE_ZONE("RendererSceneCull::render_camera");
 
 	Camera *camera = camera_owner.get_or_null(p_camera);
 	ERR_FAIL_COND(!camera);
@@ -2486,32 +2662,15 @@ void RendererSceneCull::render_camera(RID p_render_buffers, RID p_camera, RID p_
 
 		camera_data.set_camera(transform, projection, is_orthogonal, vaspect, jitter);
 	} else {
-		// Setup our camera for our XR interface.
-		// We can support multiple views here each with their own camera
-		Transform3D transforms[RendererSceneRender::MAX_RENDER_VIEWS];
-		Projection projections[RendererSceneRender::MAX_RENDER_VIEWS];
-
-		uint32_t view_count = p_xr_interface->get_view_count();
-		ERR_FAIL_COND_MSG(view_count > RendererSceneRender::MAX_RENDER_VIEWS, "Requested view count is not supported");
-
 		float aspect = p_viewport_size.width / (float)p_viewport_size.height;
-
-		Transform3D world_origin = XRServer::get_singleton()->get_world_origin();
-
-		// We ignore our camera position, it will have been positioned with a slightly old tracking position.
-		// Instead we take our origin point and have our XR interface add fresh tracking data! Whoohoo!
-		for (uint32_t v = 0; v < view_count; v++) {
-			transforms[v] = p_xr_interface->get_transform_for_view(v, world_origin);
-			projections[v] = p_xr_interface->get_projection_for_view(v, aspect, camera->znear, camera->zfar);
+		if (!_setup_xr_camera_data(camera, p_xr_interface.ptr(), aspect, jitter, camera_data)) {
+			return;
 		}
 
-		if (view_count == 1) {
-			camera_data.set_camera(transforms[0], projections[0], false, camera->vaspect, jitter);
-		} else if (view_count == 2) {
-			camera_data.set_multiview_camera(view_count, transforms, projections, false, camera->vaspect);
-		} else {
-			// this won't be called (see fail check above) but keeping this comment to indicate we may support more then 2 views in the future...
-		}
+		xr_late_latch.interface = p_xr_interface.ptr();
+		xr_late_latch.camera = camera;
+		xr_late_latch.aspect = aspect;
+		xr_late_latch.jitter = jitter;
 	}
 
 	RID environment = _render_get_environment(p_camera, p_scenario);
@@ -2521,9 +2680,40 @@ void RendererSceneCull::render_camera(RID p_render_buffers, RID p_camera, RID p_
 	RendererSceneOcclusionCull::get_singleton()->buffer_update(p_viewport, camera_data.main_transform, camera_data.main_projection, camera_data.is_orthogonal);
 
 	_render_scene(&camera_data, p_render_buffers, environment, camera->effects, camera->visible_layers, p_scenario, p_viewport, p_shadow_atlas, RID(), -1, p_screen_mesh_lod_threshold, true, r_render_info);
+
+	xr_late_latch = XRLateLatch();
 #endif
 }
 
+bool RendererSceneCull::_setup_xr_camera_data(Camera *p_camera, XRInterface *p_xr_interface, float p_aspect, const Vector2 &p_jitter, RendererSceneRender::CameraData &r_camera_data) {
+	// Setup our camera for our XR interface.
+	// We can support multiple views here each with their own camera
+	Transform3D transforms[RendererSceneRender::MAX_RENDER_VIEWS];
+	Projection projections[RendererSceneRender::MAX_RENDER_VIEWS];
+
+	uint32_t view_count = p_xr_interface->get_view_count();
+	ERR_FAIL_COND_V_MSG(view_count > RendererSceneRender::MAX_RENDER_VIEWS, false, "Requested view count is not supported");
+
+	Transform3D world_origin = XRServer::get_singleton()->get_world_origin();
+
+	// We ignore our camera position, it will have been positioned with a slightly old tracking position.
+	// Instead we take our origin point and have our XR interface add fresh tracking data! Whoohoo!
+	for (uint32_t v = 0; v < view_count; v++) {
+		transforms[v] = p_xr_interface->get_transform_for_view(v, world_origin);
+		projections[v] = p_xr_interface->get_projection_for_view(v, p_aspect, p_camera->znear, p_camera->zfar);
+	}
+
+	if (view_count == 1) {
+		r_camera_data.set_camera(transforms[0], projections[0], false, p_camera->vaspect, p_jitter);
+	} else if (view_count == 2) {
+		r_camera_data.set_multiview_camera(view_count, transforms, projections, false, p_camera->vaspect);
+	} else {
+		// this won't be called (see fail check above) but keeping this comment to indicate we may support more then 2 views in the future...
+	}
+
+	return true;
+}
+
 void RendererSceneCull::_visibility_cull_threaded(uint32_t p_thread, VisibilityCullData *cull_data) {
 	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
 	uint32_t bin_from = p_thread * cull_data->cull_count / total_threads;
@@ -2670,6 +2860,18 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 					if (cull_data.render_reflection_probe != idata.instance) {
 						//avoid entering The Matrix
 
+						{
+							// Closest distance from any camera this frame, used to prioritize probe updates.
+							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
+							const AABB &aabb = idata.instance->transformed_aabb;
+							float distance = cull_data.cam_transform.origin.clamp(aabb.position, aabb.position + aabb.size).distance_to(cull_data.cam_transform.origin);
+							uint64_t frame = RSG::rasterizer->get_frame_number();
+							if (reflection_probe->last_visible_frame != frame || distance < reflection_probe->camera_distance) {
+								reflection_probe->camera_distance = distance;
+							}
+							reflection_probe->last_visible_frame = frame;
+						}
+
 						if ((idata.flags & InstanceData::FLAG_REFLECTION_PROBE_DIRTY) || scene_render->reflection_probe_instance_needs_redraw(RID::from_uint64(idata.instance_data_rid))) {
 							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
 							cull_data.cull->lock.lock();
@@ -2728,8 +2930,8 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 						} else {
 							cull_data.cull->lock.lock();
 							RSG::particles_storage->particles_request_process(idata.base_rid);
-							cull_data.cull->lock.unlock();
 							RSG::particles_storage->particles_set_view_axis(idata.base_rid, -cull_data.cam_transform.basis.get_column(2).normalized(), cull_data.cam_transform.basis.get_column(1).normalized());
+							cull_data.cull->lock.unlock();
 							//particles visible? request redraw
 							RenderingServerDefault::redraw_request();
 						}
@@ -2879,7 +3081,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 		}
 
 		if (mesh_visible && cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_USES_MESH_INSTANCE) {
-			cull_result.mesh_instances.push_back(cull_data.scenario->instance_data[i].instance->mesh_instance);
+			cull_result.mesh_instances.push_back(cull_data.scenario->instance_data[i].instance);
 		}
 	}
 }
@@ -3037,6 +3239,9 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 			_scene_cull(cull_data, scene_cull_result, cull_from, cull_to);
 		}
 
+		// Sort and copy the particles seen by this camera all at once.
+		RSG::particles_storage->update_particles_view_axis();
+
 #ifdef DEBUG_CULL_TIME
 		static float time_avg = 0;
 		static uint32_t time_count = 0;
@@ -3046,8 +3251,15 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 #endif
 
 		if (scene_cull_result.mesh_instances.size()) {
+			float distant_distance_squared = distant_skinning_distance * distant_skinning_distance;
 			for (uint64_t i = 0; i < scene_cull_result.mesh_instances.size(); i++) {
-				RSG::mesh_storage->mesh_instance_check_for_update(scene_cull_result.mesh_instances[i]);
+				Instance *instance = scene_cull_result.mesh_instances[i];
+				if (distant_skinning_update_interval > 1) {
+					// Also used by the shadow passes below, so distant instances don't get skinned for their shadows either.
+					bool distant = instance->transformed_aabb.get_center().distance_squared_to(p_camera_data->main_transform.origin) > distant_distance_squared;
+					RSG::mesh_storage->mesh_instance_set_skinning_interval(instance->mesh_instance, distant ? distant_skinning_update_interval : 1);
+				}
+				RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 			}
 			RSG::mesh_storage->update_mesh_instances();
 		}
@@ -3156,10 +3368,18 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				}
 			}
 
-			if (light->shadow_dirty) {
+			// Small lights only pick up their changes every few frames, staggered so they don't all redraw in the same one.
+			// Keeping the old version means a shadow that lost its place in the atlas is still redrawn right away.
+			bool defer_update = light->shadow_dirty && distant_light_shadow_update_interval > 1 && coverage < distant_light_shadow_coverage && (RSG::rasterizer->get_frame_number() + light->instance.get_id()) % distant_light_shadow_update_interval != 0;
+
+			if (light->shadow_dirty && !defer_update) {
 				light->last_version++;
 				light->shadow_dirty = false;
 			}
+			if (light->static_shadow_dirty) {
+				light->static_version++;
+				light->static_shadow_dirty = false;
+			}
 
 			bool redraw = scene_render->shadow_atlas_update_light(p_shadow_atlas, light->instance, coverage, light->last_version);
 
@@ -3169,7 +3389,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				light->shadow_dirty = _light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, scenario, p_screen_mesh_lod_threshold);
 				RENDER_TIMESTAMP("< Render Light3D " + itos(i));
 			} else {
-				light->shadow_dirty = redraw;
+				light->shadow_dirty = light->shadow_dirty || redraw;
 			}
 		}
 	}
@@ -3222,6 +3442,15 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 	}
 	/* PROCESS GEOMETRY AND DRAW SCENE */
 
+	// Give the XR interface a chance to predict the head pose again now that culling and shadows are done, so the scene is
+	// rendered with the most recent tracking data. Culling used the earlier poses, the difference is a few milliseconds of movement.
+	RendererSceneRender::CameraData late_camera_data;
+	if (xr_late_latch.interface && p_reflection_probe.is_null() && xr_late_latch.interface->late_latch_views()) {
+		if (_setup_xr_camera_data(xr_late_latch.camera, xr_late_latch.interface, xr_late_latch.aspect, xr_late_latch.jitter, late_camera_data)) {
+			p_camera_data = &late_camera_data;
+		}
+	}
+
 	RID occluders_tex;
 	const RendererSceneRender::CameraData *prev_camera_data = p_camera_data;
 	if (p_viewport.is_valid()) {
@@ -3238,6 +3467,9 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 	for (uint32_t i = 0; i < max_shadows_used; i++) {
 		render_shadow_data[i].instances.clear();
+		render_shadow_data[i].static_instances.clear();
+		render_shadow_data[i].use_static_cache = false;
+		render_shadow_data[i].update_static_cache = false;
 	}
 	max_shadows_used = 0;
 
@@ -3395,6 +3627,11 @@ void RendererSceneCull::render_probes() {
 				busy = true; //do not render another one of this kind
 			} break;
 			case RS::REFLECTION_PROBE_UPDATE_ALWAYS: {
+				if (reflection_probe_faces_per_frame > 0) {
+					reflection_probe_update_queue.push_back(ref_probe->self());
+					break;
+				}
+
 				int step = 0;
 				bool done = false;
 				while (!done) {
@@ -3409,6 +3646,38 @@ void RendererSceneCull::render_probes() {
 		ref_probe = next;
 	}
 
+	if (reflection_probe_update_queue.size()) {
+		// Spend the budget on the closest probes seen last frame first, probes that waited longer get closer.
+		uint64_t frame = RSG::rasterizer->get_frame_number();
+		for (uint32_t i = 0; i < reflection_probe_update_queue.size(); i++) {
+			InstanceReflectionProbeData *reflection_probe = reflection_probe_update_queue[i];
+			float priority = reflection_probe->camera_distance / float(1 + frame - reflection_probe->last_update_frame);
+			if (frame - reflection_probe->last_visible_frame > 1) {
+				priority += 1e20; // Only finish the ones that aren't visible anymore when there is budget left.
+			}
+			reflection_probe->update_priority = priority;
+		}
+		reflection_probe_update_queue.sort_custom<ReflectionProbeUpdateSort>();
+
+		uint32_t faces_left = reflection_probe_faces_per_frame;
+		for (uint32_t i = 0; i < reflection_probe_update_queue.size() && faces_left > 0; i++) {
+			InstanceReflectionProbeData *reflection_probe = reflection_probe_update_queue[i];
+			while (faces_left > 0) {
+				// The filtering step counts as a face.
+				bool done = _render_reflection_probe_step(reflection_probe->owner, reflection_probe->render_step);
+				faces_left--;
+				if (done) {
+					reflection_probe_render_list.remove(&reflection_probe->update_list);
+					reflection_probe->last_update_frame = frame;
+					break;
+				}
+				reflection_probe->render_step++;
+			}
+		}
+
+		reflection_probe_update_queue.clear();
+	}
+
 	/* VOXEL GIS */
 
 	SelfList<InstanceVoxelGIData> *voxel_gi = voxel_gi_update_list.first();
@@ -3839,11 +4108,16 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 				for (const Instance *E : geom->lights) {
 					InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
 					light->shadow_dirty = true;
+					light->static_shadow_dirty = true;
 				}
 
 				geom->can_cast_shadows = can_cast_shadows;
 			}
 
+			if (is_animated != geom->material_is_animated) {
+				// Animated materials are kept out of the static shadow cache.
+				_instance_static_shadows_changed(p_instance);
+			}
 			geom->material_is_animated = is_animated;
 			p_instance->instance_shader_parameters = isparams;
 
@@ -3889,9 +4163,15 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 void RendererSceneCull::update_dirty_instances() {
 	RSG::utilities->update_dirty_resources();
 
+	pair_queue_enabled = true;
 	while (_instance_update_list.first()) {
-		_update_dirty_instance(_instance_update_list.first()->self());
+		while (_instance_update_list.first()) {
+			_update_dirty_instance(_instance_update_list.first()->self());
+		}
+		//pairing may queue more updates (e.g. lightmap captures), so loop until nothing is left
+		_flush_pair_queue();
 	}
+	pair_queue_enabled = false;
 }
 
 void RendererSceneCull::update() {
@@ -3910,6 +4190,76 @@ void RendererSceneCull::update() {
 	render_particle_colliders();
 }
 
+void RendererSceneCull::set_physics_interpolation_enabled(bool p_enabled) {
+	if (interpolation_data.enabled == p_enabled) {
+		return;
+	}
+
+	interpolation_data.enabled = p_enabled;
+
+	for (uint32_t i = 0; i < interpolation_data.interpolate_list.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(interpolation_data.interpolate_list[i]);
+		if (instance) {
+			_instance_snap_interpolation(instance);
+		}
+	}
+
+	interpolation_data.interpolate_list.clear();
+	interpolation_data.tick_list_curr.clear();
+	interpolation_data.tick_list_prev.clear();
+}
+
+void RendererSceneCull::tick() {
+	if (!interpolation_data.enabled) {
+		return;
+	}
+
+	// Instances moved in the tick that just ended start the new one from where they ended it.
+	for (uint32_t i = 0; i < interpolation_data.tick_list_curr.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(interpolation_data.tick_list_curr[i]);
+		if (instance) {
+			instance->transform_prev = instance->transform_curr;
+		}
+	}
+
+	// Instances that weren't moved in it came to rest, show them there and stop interpolating them.
+	for (uint32_t i = 0; i < interpolation_data.tick_list_prev.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(interpolation_data.tick_list_prev[i]);
+		if (instance && instance->on_interpolate_list && instance->interpolation_tick != interpolation_data.tick) {
+			_instance_snap_interpolation(instance);
+		}
+	}
+
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < interpolation_data.interpolate_list.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(interpolation_data.interpolate_list[i]);
+		if (instance && instance->on_interpolate_list) {
+			interpolation_data.interpolate_list[count++] = interpolation_data.interpolate_list[i];
+		}
+	}
+	interpolation_data.interpolate_list.resize(count);
+
+	SWAP(interpolation_data.tick_list_curr, interpolation_data.tick_list_prev);
+	interpolation_data.tick_list_curr.clear();
+	interpolation_data.tick++;
+}
+
+void RendererSceneCull::update_interpolation_frame(double p_fraction) {
+	if (!interpolation_data.enabled) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < interpolation_data.interpolate_list.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(interpolation_data.interpolate_list[i]);
+		if (!instance || !instance->on_interpolate_list) {
+			continue;
+		}
+
+		instance->transform = instance->transform_prev.interpolate_with(instance->transform_curr, p_fraction);
+		_instance_queue_update(instance, true);
+	}
+}
+
 bool RendererSceneCull::free(RID p_rid) {
 	if (p_rid.is_null()) {
 		return true;
@@ -4026,6 +4376,7 @@ RendererSceneCull::RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		render_shadow_data[i].static_instances.set_page_pool(&geometry_instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4040,6 +4391,13 @@ RendererSceneCull::RendererSceneCull() {
 	indexer_update_iterations = GLOBAL_GET("rendering/limits/spatial_indexer/update_iterations_per_frame");
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
+	pair_thread_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_pair_minimum_instances");
+
+	distant_light_shadow_update_interval = MAX(1, int(GLOBAL_GET("rendering/shadows/positional_shadow/distant_light_update_interval")));
+	distant_light_shadow_coverage = GLOBAL_GET("rendering/shadows/positional_shadow/distant_light_coverage");
+	reflection_probe_faces_per_frame = MAX(0, int(GLOBAL_GET("rendering/reflections/reflection_probes/update_always_faces_per_frame")));
+	distant_skinning_update_interval = MAX(1, int(GLOBAL_GET("rendering/skinning/distant_update_interval")));
+	distant_skinning_distance = GLOBAL_GET("rendering/skinning/distant_distance");
 
 	taa_jitter_array.resize(TAA_JITTER_COUNT);
 	for (int i = 0; i < TAA_JITTER_COUNT; i++) {
@@ -4047,7 +4405,7 @@ RendererSceneCull::RendererSceneCull() {
 		taa_jitter_array[i].y = get_halton_value(i, 3);
 	}
 
-	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
+	default_occlusion_culling = memnew(RasterOcclusionCull);
 }
 
 RendererSceneCull::~RendererSceneCull() {
@@ -4056,6 +4414,7 @@ RendererSceneCull::~RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		render_shadow_data[i].static_instances.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
@@ -4067,7 +4426,7 @@ RendererSceneCull::~RendererSceneCull() {
 	}
 	scene_cull_result_threads.clear();
 
-	if (dummy_occlusion_culling) {
-		memdelete(dummy_occlusion_culling);
+	if (default_occlusion_culling) {
+		memdelete(default_occlusion_culling);
 	}
 }
@@ -115,7 +115,7 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *default_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
@@ -349,6 +349,8 @@ public:
 	static void _instance_unpair(Instance *p_A, Instance *p_B);
 
 	void _instance_update_mesh_instance(Instance *p_instance);
+	static bool _instance_casts_static_shadows(const Instance *p_instance);
+	void _instance_static_shadows_changed(Instance *p_instance);
 
 	virtual RID scenario_allocate();
 	virtual void scenario_initialize(RID p_rid);
@@ -391,6 +393,13 @@ public:
 
 		Transform3D transform;
 
+		// Physics interpolation: transform is drawn between the transforms set in the last two physics ticks.
+		Transform3D transform_prev;
+		Transform3D transform_curr;
+		uint64_t interpolation_tick = 0; // Last tick the transform was set in.
+		bool interpolated = false;
+		bool on_interpolate_list = false;
+
 		float lod_bias;
 
 		bool ignore_occlusion_culling;
@@ -469,6 +478,7 @@ public:
 
 		SelfList<InstancePair>::List pairs;
 		uint64_t pair_check;
+		int32_t pair_queue_index = -1;
 
 		DependencyTracker dependency_tracker;
 
@@ -606,12 +616,24 @@ public:
 
 		int render_step;
 
+		// Used to schedule UPDATE_ALWAYS probes when their faces are rendered over several frames.
+		float camera_distance = 0.0;
+		uint64_t last_visible_frame = 0;
+		uint64_t last_update_frame = 0;
+		float update_priority = 0.0;
+
 		InstanceReflectionProbeData() :
 				update_list(this) {
 			render_step = -1;
 		}
 	};
 
+	struct ReflectionProbeUpdateSort {
+		_FORCE_INLINE_ bool operator()(const InstanceReflectionProbeData *p_a, const InstanceReflectionProbeData *p_b) const {
+			return p_a->update_priority < p_b->update_priority;
+		}
+	};
+
 	struct InstanceDecalData : public InstanceBaseData {
 		Instance *owner = nullptr;
 		RID instance;
@@ -623,6 +645,8 @@ public:
 	};
 
 	SelfList<InstanceReflectionProbeData>::List reflection_probe_render_list;
+	LocalVector<InstanceReflectionProbeData *> reflection_probe_update_queue;
+	uint32_t reflection_probe_faces_per_frame = 0;
 
 	struct InstanceParticlesCollisionData : public InstanceBaseData {
 		RID instance;
@@ -651,6 +675,8 @@ public:
 		List<Instance *>::Element *D; // directional light in scenario
 
 		bool shadow_dirty;
+		bool static_shadow_dirty = true;
+		uint64_t static_version = 0;
 		bool uses_projector = false;
 		bool uses_softshadow = false;
 
@@ -731,16 +757,20 @@ public:
 		uint32_t pair_mask;
 		uint64_t pair_pass;
 
+		_FORCE_INLINE_ void _add_found(Instance *p_instance) {
+			p_instance->pair_check = pair_pass;
+			InstancePair *pair = pair_allocator->alloc();
+			pair->a = instance;
+			pair->b = p_instance;
+			pairs_found.add(&pair->list_a);
+		}
+
 		_FORCE_INLINE_ bool operator()(void *p_data) {
 			Instance *p_instance = (Instance *)p_data;
 
 			if (instance != p_instance && instance->transformed_aabb.intersects(p_instance->transformed_aabb) && (pair_mask & (1 << p_instance->base_type))) {
 				//test is more coarse in indexer
-				p_instance->pair_check = pair_pass;
-				InstancePair *pair = pair_allocator->alloc();
-				pair->a = instance;
-				pair->b = p_instance;
-				pairs_found.add(&pair->list_a);
+				_add_found(p_instance);
 			}
 			return false;
 		}
@@ -752,6 +782,18 @@ public:
 			if (bvh2) {
 				bvh2->aabb_query(instance->transformed_aabb, *this);
 			}
+			_update_pairs();
+		}
+
+		// Same as pair(), but with the instances found by PairQuery beforehand.
+		void pair_found(const LocalVector<Instance *> &p_found) {
+			for (uint32_t i = 0; i < p_found.size(); i++) {
+				_add_found(p_found[i]);
+			}
+			_update_pairs();
+		}
+
+		void _update_pairs() {
 			while (instance->pairs.first()) {
 				InstancePair *pair = instance->pairs.first()->self();
 				Instance *other_instance = instance == pair->a ? pair->b : pair->a;
@@ -779,6 +821,37 @@ public:
 		}
 	};
 
+	// Only reads the indexers, so the instances updated by update_dirty_instances() can look for their pairs on several threads.
+	struct PairQuery {
+		Instance *instance = nullptr;
+		LocalVector<Instance *> *found = nullptr;
+		uint32_t pair_mask;
+
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			Instance *p_instance = (Instance *)p_data;
+
+			if (instance != p_instance && instance->transformed_aabb.intersects(p_instance->transformed_aabb) && (pair_mask & (1 << p_instance->base_type))) {
+				found->push_back(p_instance);
+			}
+			return false;
+		}
+	};
+
+	struct PairQueueItem {
+		Instance *instance = nullptr;
+		DynamicBVH *bvh = nullptr;
+		DynamicBVH *bvh2 = nullptr;
+		uint32_t pair_mask = 0;
+		LocalVector<Instance *> found;
+	};
+
+	// While update_dirty_instances() runs, moved instances are queued here and paired all at once by _flush_pair_queue().
+	LocalVector<PairQueueItem> pair_queue;
+	bool pair_queue_enabled = false;
+
+	void _pair_queue_query(uint32_t p_index, PairQueueItem *p_items);
+	void _flush_pair_queue();
+
 	HashSet<Instance *> heightfield_particle_colliders_update_list;
 
 	PagedArrayPool<Instance *> instance_cull_page_pool;
@@ -796,7 +869,7 @@ public:
 		PagedArray<RID> reflections;
 		PagedArray<RID> decals;
 		PagedArray<RID> voxel_gi_instances;
-		PagedArray<RID> mesh_instances;
+		PagedArray<Instance *> mesh_instances;
 		PagedArray<RID> fog_volumes;
 
 		struct DirectionalShadow {
@@ -890,7 +963,7 @@ public:
 			reflections.set_page_pool(p_rid_pool);
 			decals.set_page_pool(p_rid_pool);
 			voxel_gi_instances.set_page_pool(p_rid_pool);
-			mesh_instances.set_page_pool(p_rid_pool);
+			mesh_instances.set_page_pool(p_instance_pool);
 			fog_volumes.set_page_pool(p_rid_pool);
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
@@ -918,9 +991,25 @@ public:
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
 	uint32_t thread_cull_threshold = 200;
+	uint32_t pair_thread_threshold = 64;
+
+	uint32_t distant_light_shadow_update_interval = 1;
+	float distant_light_shadow_coverage = 0.1;
+	uint32_t distant_skinning_update_interval = 1;
+	float distant_skinning_distance = 50.0;
 
 	RID_Owner<Instance, true> instance_owner;
 
+	struct InterpolationData {
+		bool enabled = false;
+		uint64_t tick = 1;
+		LocalVector<RID> interpolate_list; // Instances drawn with an interpolated transform.
+		LocalVector<RID> tick_list_curr; // Instances moved in the current tick.
+		LocalVector<RID> tick_list_prev; // Instances moved in the previous tick.
+	} interpolation_data;
+
+	void _instance_snap_interpolation(Instance *p_instance);
+
 	uint32_t geometry_instance_pair_mask = 0; // used in traditional forward, unnecessary on clustered
 
 	const int TAA_JITTER_COUNT = 16;
@@ -933,6 +1022,8 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario);
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1053,6 +1144,15 @@ public:
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
 
+	struct XRLateLatch {
+		XRInterface *interface = nullptr;
+		Camera *camera = nullptr;
+		float aspect = 1.0;
+		Vector2 jitter;
+	} xr_late_latch;
+
+	bool _setup_xr_camera_data(Camera *p_camera, XRInterface *p_xr_interface, float p_aspect, const Vector2 &p_jitter, RendererSceneRender::CameraData &r_camera_data);
+
 	bool _render_reflection_probe_step(Instance *p_instance, int p_step);
 	void _render_scene(const RendererSceneRender::CameraData *p_camera_data, RID p_render_buffers, RID p_environment, RID p_force_camera_effects, uint32_t p_visible_layers, RID p_scenario, RID p_viewport, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, bool p_using_shadows = true, RenderInfo *r_render_info = nullptr);
 	void render_empty_scene(RID p_render_buffers, RID p_scenario, RID p_shadow_atlas);
@@ -1158,7 +1258,7 @@ public:
 	/* Render Buffers */
 
 	PASS0R(RID, render_buffers_create)
-	PASS13(render_buffers_configure, RID, RID, int, int, int, int, float, float, RS::ViewportMSAA, RS::ViewportScreenSpaceAA, bool, bool, uint32_t)
+	PASS14(render_buffers_configure, RID, RID, int, int, int, int, RS::ViewportScaling3DMode, float, float, RS::ViewportMSAA, RS::ViewportScreenSpaceAA, bool, bool, uint32_t)
 	PASS1(gi_set_use_half_resolution, bool)
 
 	/* Shadow Atlas */
@@ -1173,6 +1273,10 @@ public:
 
 	virtual void update();
 
+	virtual void set_physics_interpolation_enabled(bool p_enabled);
+	virtual void tick();
+	virtual void update_interpolation_frame(double p_fraction);
+
 	bool free(RID p_rid);
 
 	void set_scene_render(RendererSceneRender *p_scene_render);
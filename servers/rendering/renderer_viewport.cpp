@@ -72,6 +72,11 @@ static Transform2D _canvas_get_transform(RendererViewport::Viewport *p_viewport,
 	return xf;
 }
 
+bool RendererViewport::_viewport_uses_taa(const Viewport *p_viewport) const {
+	// Temporal upscaling accumulates the jittered frames in the TAA history, so it needs TAA even if it wasn't enabled.
+	return p_viewport->use_taa || p_viewport->scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL;
+}
+
 void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 	if (p_viewport->render_buffers.is_valid()) {
 		if (p_viewport->size.width == 0 || p_viewport->size.height == 0) {
@@ -82,9 +87,9 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 			RS::ViewportScaling3DMode scaling_3d_mode = p_viewport->scaling_3d_mode;
 			bool scaling_enabled = true;
 
-			if ((scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_FSR) && (scaling_3d_scale > 1.0)) {
-				// FSR is not designed for downsampling.
-				// Fall back to bilinear scaling.
+			if ((scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_FSR || scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL) && (scaling_3d_scale > 1.0)) {
+				// FSR and temporal upscaling are not designed for downsampling.
+				// Fall back to bilinear scaling (temporal antialiasing stays enabled, see _viewport_uses_taa()).
 				scaling_3d_mode = RS::VIEWPORT_SCALING_3D_MODE_BILINEAR;
 			}
 
@@ -95,6 +100,12 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 				scaling_3d_mode = RS::VIEWPORT_SCALING_3D_MODE_BILINEAR;
 			}
 
+			if ((scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL) && !p_viewport->fsr_enabled) {
+				// Temporal upscaling needs the same storage textures as FSR.
+				WARN_PRINT_ONCE("Temporal 3D resolution scaling is not available. Falling back to bilinear 3D resolution scaling.");
+				scaling_3d_mode = RS::VIEWPORT_SCALING_3D_MODE_BILINEAR;
+			}
+
 			if (scaling_3d_scale == 1.0) {
 				scaling_enabled = false;
 			}
@@ -115,6 +126,7 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 						render_height = height;
 						break;
 					case RS::VIEWPORT_SCALING_3D_MODE_FSR:
+					case RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL:
 						width = p_viewport->size.width;
 						height = p_viewport->size.height;
 						render_width = MAX(width * scaling_3d_scale, 1.0); // width / (width * scaling)
@@ -138,7 +150,7 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 
 			p_viewport->internal_size = Size2(render_width, render_height);
 
-			RSG::scene->render_buffers_configure(p_viewport->render_buffers, p_viewport->render_target, render_width, render_height, width, height, p_viewport->fsr_sharpness, p_viewport->fsr_mipmap_bias, p_viewport->msaa, p_viewport->screen_space_aa, p_viewport->use_taa, p_viewport->use_debanding, p_viewport->get_view_count());
+			RSG::scene->render_buffers_configure(p_viewport->render_buffers, p_viewport->render_target, render_width, render_height, width, height, scaling_3d_mode, p_viewport->fsr_sharpness, p_viewport->fsr_mipmap_bias, p_viewport->msaa, p_viewport->screen_space_aa, _viewport_uses_taa(p_viewport), p_viewport->use_debanding, p_viewport->get_view_count());
 		}
 	}
 }
@@ -167,16 +179,20 @@ void RendererViewport::_draw_3d(Viewport *p_viewport) {
 	}
 
 	float screen_mesh_lod_threshold = p_viewport->mesh_lod_threshold / float(p_viewport->size.width);
-	RSG::scene->render_camera(p_viewport->render_buffers, p_viewport->camera, p_viewport->scenario, p_viewport->self, p_viewport->internal_size, p_viewport->use_taa, screen_mesh_lod_threshold, p_viewport->shadow_atlas, xr_interface, &p_viewport->render_info);
+	RSG::scene->render_camera(p_viewport->render_buffers, p_viewport->camera, p_viewport->scenario, p_viewport->self, p_viewport->internal_size, _viewport_uses_taa(p_viewport), screen_mesh_lod_threshold, p_viewport->shadow_atlas, xr_interface, &p_viewport->render_info);
 
 	RENDER_TIMESTAMP("< Render 3D Scene");
 }
 
 void RendererViewport::_draw_viewport(Viewport *p_viewport) {
+	bool was_capturing_timestamps = RSG::utilities->capturing_timestamps;
 	if (p_viewport->measure_render_time) {
 		String rt_id = "vp_begin_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
+
+		// Capture the timestamps of the render passes too, so they can be broken down per viewport.
+		RSG::utilities->capturing_timestamps = true;
 	}
 
 	if (OS::get_singleton()->get_current_rendering_driver_name() == "opengl3") {
@@ -523,6 +539,8 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		String rt_id = "vp_end_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
+
+		RSG::utilities->capturing_timestamps = was_capturing_timestamps;
 	}
 }
 
@@ -1159,6 +1177,13 @@ float RendererViewport::viewport_get_measured_render_time_gpu(RID p_viewport) co
 	return double((viewport->time_gpu_end - viewport->time_gpu_begin) / 1000) / 1000.0;
 }
 
+Array RendererViewport::viewport_get_measured_render_passes(RID p_viewport) const {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_COND_V(!viewport, Array());
+
+	return viewport->measured_passes;
+}
+
 void RendererViewport::viewport_set_snap_2d_transforms_to_pixel(RID p_viewport, bool p_enabled) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_COND(!viewport);
@@ -1252,9 +1277,69 @@ bool RendererViewport::free(RID p_rid) {
 	return false;
 }
 
+void RendererViewport::_update_measured_passes(Viewport *p_viewport) {
+	// Timestamps mark the start of a pass, which lasts until the next one. Passes between
+	// "> Name" and "< Name" timestamps are nested in a "Name" pass spanning all of them.
+	const LocalVector<Viewport::PassTimestamp> &timestamps = p_viewport->pass_timestamps;
+
+	p_viewport->measured_passes.clear();
+
+	if (timestamps.size() < 2) {
+		return;
+	}
+
+	int depth = 0;
+	for (uint32_t i = 0; i < timestamps.size() - 1; i++) {
+		const String &name = timestamps[i].name;
+		if (name.begins_with("<")) {
+			depth = MAX(depth - 1, 0);
+			continue;
+		}
+
+		uint32_t end = i + 1;
+		Dictionary pass;
+		if (name.begins_with(">")) {
+			int nesting = 1;
+			while (end < timestamps.size() - 1) {
+				if (timestamps[end].name.begins_with(">")) {
+					nesting++;
+				} else if (timestamps[end].name.begins_with("<")) {
+					nesting--;
+					if (nesting == 0) {
+						break;
+					}
+				}
+				end++;
+			}
+			pass["name"] = name.substr(1).strip_edges();
+		} else {
+			pass["name"] = name;
+		}
+
+		pass["depth"] = depth;
+		pass["cpu_msec"] = double(timestamps[end].cpu_time - timestamps[i].cpu_time) / 1000.0;
+		pass["gpu_msec"] = double((timestamps[end].gpu_time - timestamps[i].gpu_time) / 1000) / 1000.0;
+		p_viewport->measured_passes.push_back(pass);
+
+		if (name.begins_with(">")) {
+			depth++;
+		}
+	}
+}
+
 void RendererViewport::handle_timestamp(String p_timestamp, uint64_t p_cpu_time, uint64_t p_gpu_time) {
 	RID *vp = timestamp_vp_map.getptr(p_timestamp);
 	if (!vp) {
+		if (timestamp_viewport.is_valid()) {
+			Viewport *viewport = viewport_owner.get_or_null(timestamp_viewport);
+			if (viewport) {
+				Viewport::PassTimestamp timestamp;
+				timestamp.name = p_timestamp;
+				timestamp.cpu_time = p_cpu_time;
+				timestamp.gpu_time = p_gpu_time;
+				viewport->pass_timestamps.push_back(timestamp);
+			}
+		}
 		return;
 	}
 
@@ -1263,14 +1348,28 @@ void RendererViewport::handle_timestamp(String p_timestamp, uint64_t p_cpu_time,
 		return;
 	}
 
+	Viewport::PassTimestamp timestamp;
+	timestamp.name = p_timestamp;
+	timestamp.cpu_time = p_cpu_time;
+	timestamp.gpu_time = p_gpu_time;
+
 	if (p_timestamp.begins_with("vp_begin")) {
 		viewport->time_cpu_begin = p_cpu_time;
 		viewport->time_gpu_begin = p_gpu_time;
+
+		timestamp_viewport = *vp;
+		viewport->pass_timestamps.clear();
+		viewport->pass_timestamps.push_back(timestamp);
 	}
 
 	if (p_timestamp.begins_with("vp_end")) {
 		viewport->time_cpu_end = p_cpu_time;
 		viewport->time_gpu_end = p_gpu_time;
+
+		timestamp_viewport = RID();
+		viewport->pass_timestamps.push_back(timestamp);
+		_update_measured_passes(viewport);
+		viewport->pass_timestamps.clear();
 	}
 }
 
@@ -95,6 +95,14 @@ public:
 		uint64_t time_gpu_begin;
 		uint64_t time_gpu_end;
 
+		struct PassTimestamp {
+			String name;
+			uint64_t cpu_time = 0;
+			uint64_t gpu_time = 0;
+		};
+		LocalVector<PassTimestamp> pass_timestamps; // Captured between the begin and end timestamps of this viewport.
+		Array measured_passes;
+
 		RID shadow_atlas;
 		int shadow_atlas_size = 2048;
 		bool shadow_atlas_16_bits = true;
@@ -180,6 +188,9 @@ public:
 	};
 
 	HashMap<String, RID> timestamp_vp_map;
+	RID timestamp_viewport; // Viewport whose timestamps are being handled.
+
+	void _update_measured_passes(Viewport *p_viewport);
 
 	uint64_t draw_viewports_pass = 0;
 
@@ -204,6 +215,7 @@ public:
 	int total_draw_calls_used = 0;
 
 private:
+	bool _viewport_uses_taa(const Viewport *p_viewport) const;
 	void _configure_3d_render_buffers(Viewport *p_viewport);
 	void _draw_3d(Viewport *p_viewport);
 	void _draw_viewport(Viewport *p_viewport);
@@ -274,6 +286,7 @@ public:
 	void viewport_set_measure_render_time(RID p_viewport, bool p_enable);
 	float viewport_get_measured_render_time_cpu(RID p_viewport) const;
 	float viewport_get_measured_render_time_gpu(RID p_viewport) const;
+	Array viewport_get_measured_render_passes(RID p_viewport) const;
 
 	void viewport_set_snap_2d_transforms_to_pixel(RID p_viewport, bool p_enabled);
 	void viewport_set_snap_2d_vertices_to_pixel(RID p_viewport, bool p_enabled);
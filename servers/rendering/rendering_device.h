@@ -799,6 +799,11 @@ public:
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, uint32_t p_post_barrier = BARRIER_MASK_ALL) = 0;
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier = BARRIER_MASK_ALL) = 0;
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer) = 0; //this causes stall, only use to retrieve large buffers for saving
+	// Returns staging memory to write p_size bytes to, which are copied to the buffer along with all other pending uploads (merging them when possible, with a single barrier)
+	// when buffer_flush_uploads() is called, or before the next draw or compute list, barrier, buffer update or end of frame. The memory must be written to before any of those.
+	// Returns null if the upload doesn't fit in the staging buffer, use buffer_update() for it instead.
+	virtual uint8_t *buffer_get_upload_pointer(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier = BARRIER_MASK_ALL) = 0;
+	virtual void buffer_flush_uploads() = 0;
 
 	/******************************************/
 	/**** PIPELINE SPECIALIZATION CONSTANT ****/
@@ -1134,6 +1139,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size) = 0;
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0) = 0;
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0) = 0;
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) = 0;
 	virtual void draw_list_disable_scissor(DrawListID p_list) = 0;
@@ -1234,6 +1240,8 @@ public:
 	virtual void swap_buffers() = 0;
 
 	virtual uint32_t get_frame_delay() const = 0;
+	// Time the CPU was blocked waiting for the swapchain before drawing the last frame to the screen.
+	virtual uint64_t get_present_wait_usec() const = 0;
 
 	virtual void submit() = 0;
 	virtual void sync() = 0;
@@ -1245,6 +1253,7 @@ public:
 	};
 
 	virtual uint64_t get_memory_usage(MemoryType p_type) const = 0;
+	virtual uint64_t get_memory_budget() const = 0;
 
 	virtual RenderingDevice *create_local_device() = 0;
 
@@ -1260,6 +1269,8 @@ public:
 	virtual String get_device_api_version() const = 0;
 	virtual String get_device_pipeline_cache_uuid() const = 0;
 
+	virtual Error pipeline_cache_save() = 0;
+
 	virtual uint64_t get_driver_resource(DriverResource p_resource, RID p_rid = RID(), uint64_t p_index = 0) = 0;
 
 	static RenderingDevice *get_singleton();
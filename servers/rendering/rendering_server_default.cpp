@@ -30,8 +30,11 @@
 
 #include "rendering_server_default.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/templates/sort_array.h"
 #include "renderer_canvas_cull.h"
@@ -68,10 +71,11 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 	frame_drawn_callbacks.push_back(p_callable);
 }
 
-void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step, double p_interpolation_fraction) {
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
 
+	MemoryTagScope memory_tag(Memory::TAG_RENDERING);
 	changes = 0;
 
 	RSG::rasterizer->begin_frame(frame_step);
@@ -80,6 +84,10 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	uint64_t time_usec = OS::get_singleton()->get_ticks_usec();
 
+	// Place physics interpolated instances between their last two physics transforms.
+	RSG::scene->update_interpolation_frame(p_interpolation_fraction);
+	RSG::canvas->update_interpolation_frame(p_interpolation_fraction);
+
 	RSG::scene->update(); //update scenes stuff before updating instances
 
 	frame_setup_time = double(OS::get_singleton()->get_ticks_usec() - time_usec) / 1000.0;
@@ -130,9 +138,7 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 			String name = RSG::utilities->get_captured_timestamp_name(i);
 
-			if (name.begins_with("vp_")) {
-				RSG::viewport->handle_timestamp(name, time_cpu, time_gpu);
-			}
+			RSG::viewport->handle_timestamp(name, time_cpu, time_gpu);
 
 			if (RSG::utilities->capturing_timestamps) {
 				new_profile.write[i].gpu_msec = double((time_gpu - base_gpu) / 1000) / 1000.0;
@@ -192,12 +198,40 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	}
 
 	RSG::utilities->update_memory_info();
+	_update_video_memory_pressure();
+}
+
+void RenderingServerDefault::_update_video_memory_pressure() {
+	uint64_t budget = RSG::utilities->get_rendering_info(RS::RENDERING_INFO_VIDEO_MEM_BUDGET);
+	if (budget == 0) {
+		return; // Not reported by this renderer.
+	}
+
+	// Leave pressure a bit below the threshold, so usage right at it doesn't toggle it every frame.
+	uint64_t used = RSG::utilities->get_rendering_info(RS::RENDERING_INFO_VIDEO_MEM_USED);
+	float threshold = video_memory_pressure ? video_memory_pressure_threshold - 0.05 : video_memory_pressure_threshold;
+	bool pressure = used > uint64_t(budget * double(threshold));
+	if (pressure == video_memory_pressure) {
+		return;
+	}
+
+	video_memory_pressure = pressure;
+	if (pressure) {
+		// Resources kept around only in case they are loaded again may hold on to textures, let them go on the main thread.
+		MessageQueue::get_singleton()->push_callable(callable_mp_static(&ResourceCache::clear_retained));
+	}
+	RS::get_singleton()->emit_signal(SNAME("video_memory_pressure_changed"), pressure);
 }
 
 double RenderingServerDefault::get_frame_setup_time_cpu() const {
 	return frame_setup_time;
 }
 
+uint64_t RenderingServerDefault::get_frame_present_wait_usec() const {
+	RenderingDevice *rd = RenderingDevice::get_singleton();
+	return rd ? rd->get_present_wait_usec() : 0;
+}
+
 bool RenderingServerDefault::has_changed() const {
 	return changes > 0;
 }
@@ -243,12 +277,13 @@ void RenderingServerDefault::finish() {
 /* STATUS INFORMATION */
 
 uint64_t RenderingServerDefault::get_rendering_info(RenderingInfo p_info) {
+	// Renderers may add counts the viewports don't track, such as 2D draw calls.
 	if (p_info == RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME) {
-		return RSG::viewport->get_total_objects_drawn();
+		return RSG::viewport->get_total_objects_drawn() + RSG::utilities->get_rendering_info(p_info);
 	} else if (p_info == RENDERING_INFO_TOTAL_PRIMITIVES_IN_FRAME) {
-		return RSG::viewport->get_total_vertices_drawn();
+		return RSG::viewport->get_total_vertices_drawn() + RSG::utilities->get_rendering_info(p_info);
 	} else if (p_info == RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME) {
-		return RSG::viewport->get_total_draw_calls_used();
+		return RSG::viewport->get_total_draw_calls_used() + RSG::utilities->get_rendering_info(p_info);
 	}
 	return RSG::utilities->get_rendering_info(p_info);
 }
@@ -332,8 +367,8 @@ void RenderingServerDefault::_thread_exit() {
 	exit.set();
 }
 
-void RenderingServerDefault::_thread_draw(bool p_swap_buffers, double frame_step) {
-	_draw(p_swap_buffers, frame_step);
+void RenderingServerDefault::_thread_draw(bool p_swap_buffers, double frame_step, double p_interpolation_fraction) {
+	_draw(p_swap_buffers, frame_step, p_interpolation_fraction);
 }
 
 void RenderingServerDefault::_thread_flush() {
@@ -346,6 +381,8 @@ void RenderingServerDefault::_thread_callback(void *_instance) {
 }
 
 void RenderingServerDefault::_thread_loop() {
+	// Everything the rendering thread allocates belongs to rendering.
+	MemoryTagScope memory_tag(Memory::TAG_RENDERING);
 	server_thread = Thread::get_caller_id();
 
 	DisplayServer::get_singleton()->make_rendering_thread();
@@ -374,15 +411,48 @@ void RenderingServerDefault::sync() {
 }
 
 void RenderingServerDefault::draw(bool p_swap_buffers, double frame_step) {
+	double interpolation_fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
 	if (create_thread) {
-		command_queue.push(this, &RenderingServerDefault::_thread_draw, p_swap_buffers, frame_step);
+		command_queue.push(this, &RenderingServerDefault::_thread_draw, p_swap_buffers, frame_step, interpolation_fraction);
+		// Setters of the next frame can't replace the commands this draw still has to run with.
+		command_queue.end_coalescing();
+	} else {
+		_draw(p_swap_buffers, frame_step, interpolation_fraction);
+	}
+}
+
+void RenderingServerDefault::_set_physics_interpolation_enabled(bool p_enabled) {
+	RSG::scene->set_physics_interpolation_enabled(p_enabled);
+	RSG::canvas->set_physics_interpolation_enabled(p_enabled);
+}
+
+void RenderingServerDefault::set_physics_interpolation_enabled(bool p_enabled) {
+	if (Thread::get_caller_id() != server_thread) {
+		command_queue.push(this, &RenderingServerDefault::_set_physics_interpolation_enabled, p_enabled);
+	} else {
+		command_queue.flush_if_pending();
+		_set_physics_interpolation_enabled(p_enabled);
+	}
+}
+
+void RenderingServerDefault::_tick() {
+	RSG::scene->tick();
+	RSG::canvas->tick();
+}
+
+void RenderingServerDefault::tick() {
+	if (Thread::get_caller_id() != server_thread) {
+		command_queue.push(this, &RenderingServerDefault::_tick);
+		// Transforms set from now on belong to the new tick, they can't replace the ones queued for the previous one.
+		command_queue.end_coalescing();
 	} else {
-		_draw(p_swap_buffers, frame_step);
+		command_queue.flush_if_pending();
+		_tick();
 	}
 }
 
 RenderingServerDefault::RenderingServerDefault(bool p_create_thread) :
-		command_queue(p_create_thread) {
+		command_queue(p_create_thread, true) {
 	RenderingServer::init();
 
 	create_thread = p_create_thread;
@@ -394,6 +464,7 @@ RenderingServerDefault::RenderingServerDefault(bool p_create_thread) :
 	}
 
 	RSG::threaded = p_create_thread;
+	video_memory_pressure_threshold = GLOBAL_GET("rendering/limits/video_memory/pressure_threshold");
 	RSG::canvas = memnew(RendererCanvasCull);
 	RSG::viewport = memnew(RendererViewport);
 	RendererSceneCull *sr = memnew(RendererSceneCull);
@@ -66,6 +66,10 @@ class RenderingServerDefault : public RenderingServer {
 
 	double frame_setup_time = 0;
 
+	float video_memory_pressure_threshold = 0.9;
+	bool video_memory_pressure = false;
+	void _update_video_memory_pressure();
+
 	//for printing
 	bool print_gpu_profile = false;
 	HashMap<String, float> print_gpu_profile_task_time;
@@ -83,14 +87,16 @@ class RenderingServerDefault : public RenderingServer {
 	SafeFlag draw_thread_up;
 	bool create_thread;
 
-	void _thread_draw(bool p_swap_buffers, double frame_step);
+	void _thread_draw(bool p_swap_buffers, double frame_step, double p_interpolation_fraction);
 	void _thread_flush();
 
 	void _thread_exit();
 
 	Mutex alloc_mutex;
 
-	void _draw(bool p_swap_buffers, double frame_step);
+	void _draw(bool p_swap_buffers, double frame_step, double p_interpolation_fraction);
+	void _set_physics_interpolation_enabled(bool p_enabled);
+	void _tick();
 	void _init();
 	void _finish();
 
@@ -206,6 +212,7 @@ public:
 	FUNC3(texture_set_detect_3d_callback, RID, TextureDetectCallback, void *)
 	FUNC3(texture_set_detect_normal_callback, RID, TextureDetectCallback, void *)
 	FUNC3(texture_set_detect_roughness_callback, RID, TextureDetectRoughnessCallback, void *)
+	FUNC3(texture_set_stream_request_callback, RID, TextureDetectCallback, void *)
 
 	FUNC2(texture_set_path, RID, const String &)
 	FUNC1RC(String, texture_get_path, RID)
@@ -332,8 +339,13 @@ public:
 	FUNC2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	FUNC2(multimesh_set_buffer, RID, const Vector<float> &)
+	FUNC4(multimesh_set_buffer_range, RID, int, int, const Vector<float> &)
 	FUNC1RC(Vector<float>, multimesh_get_buffer, RID)
 
+	// Mapping waits for the rendering thread, but the mapped range is a copy the rendering thread doesn't touch until unmapped.
+	FUNC3R(float *, multimesh_map_buffer_range, RID, int, int)
+	FUNC1(multimesh_unmap_buffer, RID)
+
 	FUNC2(multimesh_set_visible_instances, RID, int)
 	FUNC1RC(int, multimesh_get_visible_instances, RID)
 
@@ -347,6 +359,7 @@ public:
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
 	FUNC2(skeleton_set_base_transform_2d, RID, const Transform2D &)
+	FUNC2(skeleton_set_buffer, RID, const Vector<float> &)
 
 	/* Light API */
 #undef ServerName
@@ -634,6 +647,7 @@ public:
 	FUNC2(viewport_set_measure_render_time, RID, bool)
 	FUNC1RC(double, viewport_get_measured_render_time_cpu, RID)
 	FUNC1RC(double, viewport_get_measured_render_time_gpu, RID)
+	FUNC1RC(Array, viewport_get_measured_render_passes, RID)
 	FUNC1RC(RID, viewport_find_from_screen_attachment, DisplayServer::WindowID)
 
 	FUNC2(call_set_vsync_mode, DisplayServer::VSyncMode, DisplayServer::WindowID)
@@ -744,11 +758,13 @@ public:
 	FUNC2(instance_set_base, RID, RID)
 	FUNC2(instance_set_scenario, RID, RID)
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
-	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2COALESCED(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instance_set_interpolated, RID, bool)
+	FUNC1(instance_reset_physics_interpolation, RID)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
-	FUNC2(instance_set_visible, RID, bool)
+	FUNC2COALESCED(instance_set_visible, RID, bool)
 
 	FUNC2(instance_set_custom_aabb, RID, AABB)
 
@@ -809,17 +825,19 @@ public:
 	FUNC2(canvas_item_set_default_texture_filter, RID, CanvasItemTextureFilter)
 	FUNC2(canvas_item_set_default_texture_repeat, RID, CanvasItemTextureRepeat)
 
-	FUNC2(canvas_item_set_visible, RID, bool)
+	FUNC2COALESCED(canvas_item_set_visible, RID, bool)
 	FUNC2(canvas_item_set_light_mask, RID, int)
 
 	FUNC2(canvas_item_set_update_when_visible, RID, bool)
 
-	FUNC2(canvas_item_set_transform, RID, const Transform2D &)
+	FUNC2COALESCED(canvas_item_set_transform, RID, const Transform2D &)
+	FUNC2(canvas_item_set_interpolated, RID, bool)
+	FUNC1(canvas_item_reset_physics_interpolation, RID)
 	FUNC2(canvas_item_set_clip, RID, bool)
 	FUNC2(canvas_item_set_distance_field_mode, RID, bool)
 	FUNC3(canvas_item_set_custom_rect, RID, bool, const Rect2 &)
-	FUNC2(canvas_item_set_modulate, RID, const Color &)
-	FUNC2(canvas_item_set_self_modulate, RID, const Color &)
+	FUNC2COALESCED(canvas_item_set_modulate, RID, const Color &)
+	FUNC2COALESCED(canvas_item_set_self_modulate, RID, const Color &)
 
 	FUNC2(canvas_item_set_draw_behind_parent, RID, bool)
 
@@ -941,6 +959,8 @@ public:
 
 	virtual void draw(bool p_swap_buffers, double frame_step) override;
 	virtual void sync() override;
+	virtual void set_physics_interpolation_enabled(bool p_enabled) override;
+	virtual void tick() override;
 	virtual bool has_changed() const override;
 	virtual void init() override;
 	virtual void finish() override;
@@ -962,6 +982,7 @@ public:
 	/* TESTING */
 
 	virtual double get_frame_setup_time_cpu() const override;
+	virtual uint64_t get_frame_present_wait_usec() const override;
 
 	virtual void set_boot_image(const Ref<Image> &p_image, const Color &p_color, bool p_scale, bool p_use_filter = true) override;
 	virtual void set_default_clear_color(const Color &p_color) override;
@@ -82,6 +82,8 @@ public:
 	virtual void mesh_instance_free(RID p_rid) = 0;
 	virtual void mesh_instance_set_skeleton(RID p_mesh_instance, RID p_skeleton) = 0;
 	virtual void mesh_instance_set_blend_shape_weight(RID p_mesh_instance, int p_shape, float p_weight) = 0;
+	// Only follow skeleton changes every p_interval frames, used for distant instances.
+	virtual void mesh_instance_set_skinning_interval(RID p_mesh_instance, uint32_t p_interval) = 0;
 	virtual void mesh_instance_check_for_update(RID p_mesh_instance) = 0;
 	virtual void update_mesh_instances() = 0;
 
@@ -109,8 +111,12 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) = 0;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) = 0;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const = 0;
 
+	virtual float *multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) = 0;
+	virtual void multimesh_unmap_buffer(RID p_multimesh) = 0;
+
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const = 0;
 
@@ -129,6 +135,7 @@ public:
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) = 0;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) = 0;
 
 	virtual void skeleton_update_dependency(RID p_base, DependencyTracker *p_instance) = 0;
 };
@@ -97,6 +97,7 @@ public:
 	virtual void particles_set_canvas_sdf_collision(RID p_particles, bool p_enable, const Transform2D &p_xform, const Rect2 &p_to_screen, RID p_texture) = 0;
 
 	virtual void update_particles() = 0;
+	virtual void update_particles_view_axis() = 0;
 
 	/* PARTICLES COLLISION */
 
@@ -1567,6 +1567,10 @@ static RS::SurfaceData _dict_to_surf(const Dictionary &p_dictionary) {
 		}
 	}
 
+	if (p_dictionary.has("meshlet_data")) {
+		sd.meshlet_data = p_dictionary["meshlet_data"];
+	}
+
 	if (p_dictionary.has("blend_shape_data")) {
 		sd.blend_shape_data = p_dictionary["blend_shape_data"];
 	}
@@ -1626,6 +1630,10 @@ Dictionary RenderingServer::_mesh_get_surface(RID p_mesh, int p_idx) {
 		d["bone_aabbs"] = aabbs;
 	}
 
+	if (sd.meshlet_data.size()) {
+		d["meshlet_data"] = sd.meshlet_data;
+	}
+
 	if (sd.blend_shape_data.size()) {
 		d["blend_shape_data"] = sd.blend_shape_data;
 	}
@@ -1854,6 +1862,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("multimesh_set_visible_instances", "multimesh", "visible"), &RenderingServer::multimesh_set_visible_instances);
 	ClassDB::bind_method(D_METHOD("multimesh_get_visible_instances", "multimesh"), &RenderingServer::multimesh_get_visible_instances);
 	ClassDB::bind_method(D_METHOD("multimesh_set_buffer", "multimesh", "buffer"), &RenderingServer::multimesh_set_buffer);
+	ClassDB::bind_method(D_METHOD("multimesh_set_buffer_range", "multimesh", "offset", "count", "buffer"), &RenderingServer::multimesh_set_buffer_range);
 	ClassDB::bind_method(D_METHOD("multimesh_get_buffer", "multimesh"), &RenderingServer::multimesh_get_buffer);
 
 	BIND_ENUM_CONSTANT(MULTIMESH_TRANSFORM_2D);
@@ -1869,6 +1878,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("skeleton_bone_set_transform_2d", "skeleton", "bone", "transform"), &RenderingServer::skeleton_bone_set_transform_2d);
 	ClassDB::bind_method(D_METHOD("skeleton_bone_get_transform_2d", "skeleton", "bone"), &RenderingServer::skeleton_bone_get_transform_2d);
 	ClassDB::bind_method(D_METHOD("skeleton_set_base_transform_2d", "skeleton", "base_transform"), &RenderingServer::skeleton_set_base_transform_2d);
+	ClassDB::bind_method(D_METHOD("skeleton_set_buffer", "skeleton", "buffer"), &RenderingServer::skeleton_set_buffer);
 
 	/* Light API */
 
@@ -2226,12 +2236,14 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("viewport_get_measured_render_time_cpu", "viewport"), &RenderingServer::viewport_get_measured_render_time_cpu);
 
 	ClassDB::bind_method(D_METHOD("viewport_get_measured_render_time_gpu", "viewport"), &RenderingServer::viewport_get_measured_render_time_gpu);
+	ClassDB::bind_method(D_METHOD("viewport_get_measured_render_passes", "viewport"), &RenderingServer::viewport_get_measured_render_passes);
 
 	ClassDB::bind_method(D_METHOD("viewport_set_vrs_mode", "viewport", "mode"), &RenderingServer::viewport_set_vrs_mode);
 	ClassDB::bind_method(D_METHOD("viewport_set_vrs_texture", "viewport", "texture"), &RenderingServer::viewport_set_vrs_texture);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_SCALING_3D_MODE_BILINEAR);
 	BIND_ENUM_CONSTANT(VIEWPORT_SCALING_3D_MODE_FSR);
+	BIND_ENUM_CONSTANT(VIEWPORT_SCALING_3D_MODE_TEMPORAL);
 	BIND_ENUM_CONSTANT(VIEWPORT_SCALING_3D_MODE_MAX);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_DISABLED);
@@ -2472,6 +2484,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_scenario", "instance", "scenario"), &RenderingServer::instance_set_scenario);
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &RenderingServer::instance_set_interpolated);
+	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &RenderingServer::instance_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -2572,6 +2586,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("canvas_item_set_visible", "item", "visible"), &RenderingServer::canvas_item_set_visible);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_light_mask", "item", "mask"), &RenderingServer::canvas_item_set_light_mask);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_transform", "item", "transform"), &RenderingServer::canvas_item_set_transform);
+	ClassDB::bind_method(D_METHOD("canvas_item_set_interpolated", "item", "interpolated"), &RenderingServer::canvas_item_set_interpolated);
+	ClassDB::bind_method(D_METHOD("canvas_item_reset_physics_interpolation", "item"), &RenderingServer::canvas_item_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_clip", "item", "clip"), &RenderingServer::canvas_item_set_clip);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_distance_field_mode", "item", "enabled"), &RenderingServer::canvas_item_set_distance_field_mode);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_custom_rect", "item", "use_custom_rect", "rect"), &RenderingServer::canvas_item_set_custom_rect, DEFVAL(Rect2()));
@@ -2769,12 +2785,14 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDERING_INFO_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_BUFFER_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_VIDEO_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_VIDEO_MEM_BUDGET);
 
 	BIND_ENUM_CONSTANT(FEATURE_SHADERS);
 	BIND_ENUM_CONSTANT(FEATURE_MULTITHREADED);
 
 	ADD_SIGNAL(MethodInfo("frame_pre_draw"));
 	ADD_SIGNAL(MethodInfo("frame_post_draw"));
+	ADD_SIGNAL(MethodInfo("video_memory_pressure_changed", PropertyInfo(Variant::BOOL, "under_pressure")));
 
 	ClassDB::bind_method(D_METHOD("force_sync"), &RenderingServer::sync);
 	ClassDB::bind_method(D_METHOD("force_draw", "swap_buffers", "frame_step"), &RenderingServer::draw, DEFVAL(true), DEFVAL(0.0));
@@ -2844,6 +2862,15 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/textures/lossless_compression/webp_compression_level", 2);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/lossless_compression/webp_compression_level", PropertyInfo(Variant::INT, "rendering/textures/lossless_compression/webp_compression_level", PROPERTY_HINT_RANGE, "0,9,1"));
 
+	GLOBAL_DEF("rendering/textures/streaming/initial_size", 128);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/initial_size", PropertyInfo(Variant::INT, "rendering/textures/streaming/initial_size", PROPERTY_HINT_RANGE, "0,4096,1"));
+	GLOBAL_DEF("rendering/textures/streaming/memory_budget_mb", 512);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/memory_budget_mb", PropertyInfo(Variant::INT, "rendering/textures/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "0,16384,1,or_greater"));
+
+	GLOBAL_DEF("rendering/limits/video_memory/pressure_threshold", 0.9);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/video_memory/pressure_threshold", PropertyInfo(Variant::FLOAT, "rendering/limits/video_memory/pressure_threshold", PROPERTY_HINT_RANGE, "0.5,1,0.01"));
+	GLOBAL_DEF("rendering/limits/uniform_set_cache/max_cached_sets", 16384);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/uniform_set_cache/max_cached_sets", PropertyInfo(Variant::INT, "rendering/limits/uniform_set_cache/max_cached_sets", PROPERTY_HINT_RANGE, "256,262144,1"));
 	GLOBAL_DEF("rendering/limits/time/time_rollover_secs", 3600);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/time/time_rollover_secs", PropertyInfo(Variant::FLOAT, "rendering/limits/time/time_rollover_secs", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"));
 
@@ -2858,6 +2885,16 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/shadows/positional_shadow/soft_shadow_filter_quality", 2);
 	GLOBAL_DEF("rendering/shadows/positional_shadow/soft_shadow_filter_quality.mobile", 0);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/shadows/positional_shadow/soft_shadow_filter_quality", PropertyInfo(Variant::INT, "rendering/shadows/positional_shadow/soft_shadow_filter_quality", PROPERTY_HINT_ENUM, "Hard (Fastest),Soft Very Low (Faster),Soft Low (Fast),Soft Medium (Average),Soft High (Slow),Soft Ultra (Slowest)"));
+	GLOBAL_DEF_RST("rendering/shadows/positional_shadow/cache_static_casters", false);
+	GLOBAL_DEF_RST("rendering/shadows/positional_shadow/distant_light_update_interval", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/shadows/positional_shadow/distant_light_update_interval", PropertyInfo(Variant::INT, "rendering/shadows/positional_shadow/distant_light_update_interval", PROPERTY_HINT_RANGE, "1,16,1"));
+	GLOBAL_DEF_RST("rendering/shadows/positional_shadow/distant_light_coverage", 0.1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/shadows/positional_shadow/distant_light_coverage", PropertyInfo(Variant::FLOAT, "rendering/shadows/positional_shadow/distant_light_coverage", PROPERTY_HINT_RANGE, "0,1,0.01"));
+
+	GLOBAL_DEF_RST("rendering/skinning/distant_update_interval", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/skinning/distant_update_interval", PropertyInfo(Variant::INT, "rendering/skinning/distant_update_interval", PROPERTY_HINT_RANGE, "1,16,1"));
+	GLOBAL_DEF_RST("rendering/skinning/distant_distance", 50.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/skinning/distant_distance", PropertyInfo(Variant::FLOAT, "rendering/skinning/distant_distance", PROPERTY_HINT_RANGE, "0,4096,0.1,or_greater"));
 
 	GLOBAL_DEF("rendering/2d/shadow_atlas/size", 2048);
 
@@ -2873,8 +2910,11 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/vulkan/staging_buffer/max_size_mb", 128);
 	GLOBAL_DEF("rendering/vulkan/staging_buffer/texture_upload_region_size_px", 64);
 	GLOBAL_DEF("rendering/vulkan/descriptor_pools/max_descriptors_per_pool", 64);
+	GLOBAL_DEF("rendering/vulkan/pipeline_cache/enabled", true);
 
+	GLOBAL_DEF("rendering/shader_compiler/async_pipeline_compilation", false);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true);
+	GLOBAL_DEF("rendering/shader_compiler/shader_cache/export_bundle", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/compress", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/use_zstd_compression", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug", false);
@@ -2886,9 +2926,13 @@ void RenderingServer::init() {
 	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/ggx_samples", 32);
 	GLOBAL_DEF("rendering/reflections/sky_reflections/ggx_samples.mobile", 16);
 	GLOBAL_DEF("rendering/reflections/sky_reflections/fast_filter_high_quality", false);
+	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/time_sliced_update_frames", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/reflections/sky_reflections/time_sliced_update_frames", PropertyInfo(Variant::INT, "rendering/reflections/sky_reflections/time_sliced_update_frames", PROPERTY_HINT_RANGE, "1,16,1"));
 	GLOBAL_DEF("rendering/reflections/reflection_atlas/reflection_size", 256);
 	GLOBAL_DEF("rendering/reflections/reflection_atlas/reflection_size.mobile", 128);
 	GLOBAL_DEF("rendering/reflections/reflection_atlas/reflection_count", 64);
+	GLOBAL_DEF_RST("rendering/reflections/reflection_probes/update_always_faces_per_frame", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/reflections/reflection_probes/update_always_faces_per_frame", PropertyInfo(Variant::INT, "rendering/reflections/reflection_probes/update_always_faces_per_frame", PROPERTY_HINT_RANGE, "0,384,1"));
 
 	GLOBAL_DEF("rendering/global_illumination/gi/use_half_resolution", false);
 
@@ -2950,7 +2994,7 @@ void RenderingServer::init() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/scaling_3d/mode",
 			PropertyInfo(Variant::INT,
 					"rendering/scaling_3d/mode",
-					PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast)"));
+					PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),Temporal (Average)"));
 
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/scaling_3d/scale",
 			PropertyInfo(Variant::FLOAT,
@@ -2995,12 +3039,17 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/lightmapping/probe_capture/update_speed", 15);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/lightmapping/probe_capture/update_speed", PropertyInfo(Variant::FLOAT, "rendering/lightmapping/probe_capture/update_speed", PROPERTY_HINT_RANGE, "0.001,256,0.001"));
 
+	GLOBAL_DEF_RST("rendering/particles/view_depth_sort/update_interval", 1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/particles/view_depth_sort/update_interval", PropertyInfo(Variant::INT, "rendering/particles/view_depth_sort/update_interval", PROPERTY_HINT_RANGE, "1,16,1"));
+
 	GLOBAL_DEF("rendering/global_illumination/sdfgi/probe_ray_count", 1);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/probe_ray_count", PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/probe_ray_count", PROPERTY_HINT_ENUM, "8 (Fastest),16,32,64,96,128 (Slowest)"));
 	GLOBAL_DEF("rendering/global_illumination/sdfgi/frames_to_converge", 5);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/frames_to_converge", PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_converge", PROPERTY_HINT_ENUM, "5 (Less Latency but Lower Quality),10,15,20,25,30 (More Latency but Higher Quality)"));
 	GLOBAL_DEF("rendering/global_illumination/sdfgi/frames_to_update_lights", 2);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/frames_to_update_lights", PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Slower),2,4,8,16 (Faster)"));
+	GLOBAL_DEF("rendering/global_illumination/sdfgi/update_budget_msec", 0.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/global_illumination/sdfgi/update_budget_msec", PropertyInfo(Variant::FLOAT, "rendering/global_illumination/sdfgi/update_budget_msec", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"));
 
 	GLOBAL_DEF("rendering/environment/volumetric_fog/volume_size", 64);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/environment/volumetric_fog/volume_size", PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_size", PROPERTY_HINT_RANGE, "16,512,1"));
@@ -3013,17 +3062,22 @@ void RenderingServer::init() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/spatial_indexer/update_iterations_per_frame", PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/update_iterations_per_frame", PROPERTY_HINT_RANGE, "0,1024,1"));
 	GLOBAL_DEF("rendering/limits/spatial_indexer/threaded_cull_minimum_instances", 1000);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"));
+	GLOBAL_DEF("rendering/limits/spatial_indexer/threaded_pair_minimum_instances", 64);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/spatial_indexer/threaded_pair_minimum_instances", PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_pair_minimum_instances", PROPERTY_HINT_RANGE, "1,65536,1"));
 	GLOBAL_DEF("rendering/limits/forward_renderer/threaded_render_minimum_instances", 500);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/forward_renderer/threaded_render_minimum_instances", PropertyInfo(Variant::INT, "rendering/limits/forward_renderer/threaded_render_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"));
 
 	GLOBAL_DEF("rendering/limits/cluster_builder/max_clustered_elements", 512);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/cluster_builder/max_clustered_elements", PropertyInfo(Variant::FLOAT, "rendering/limits/cluster_builder/max_clustered_elements", PROPERTY_HINT_RANGE, "32,8192,1"));
+	GLOBAL_DEF_RST("rendering/limits/cluster_builder/use_compute", false);
 
 	// OpenGL limits
 	GLOBAL_DEF_RST("rendering/limits/opengl/max_renderable_elements", 65536);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/opengl/max_renderable_elements", PropertyInfo(Variant::INT, "rendering/limits/opengl/max_renderable_elements", PROPERTY_HINT_RANGE, "1024,65536,1"));
 	GLOBAL_DEF_RST("rendering/limits/opengl/max_renderable_lights", 32);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/opengl/max_renderable_lights", PropertyInfo(Variant::INT, "rendering/limits/opengl/max_renderable_lights", PROPERTY_HINT_RANGE, "2,256,1"));
+	GLOBAL_DEF_RST("rendering/limits/opengl/texture_upload_budget_kb", 4096);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/opengl/texture_upload_budget_kb", PropertyInfo(Variant::INT, "rendering/limits/opengl/texture_upload_budget_kb", PROPERTY_HINT_RANGE, "0,65536,1"));
 	GLOBAL_DEF_RST("rendering/limits/opengl/max_lights_per_object", 8);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/opengl/max_lights_per_object", PropertyInfo(Variant::INT, "rendering/limits/opengl/max_lights_per_object", PROPERTY_HINT_RANGE, "2,1024,1"));
 
@@ -139,6 +139,9 @@ public:
 	typedef void (*TextureDetectRoughnessCallback)(void *, const String &, TextureDetectRoughnessChannel);
 	virtual void texture_set_detect_roughness_callback(RID p_texture, TextureDetectRoughnessCallback p_callback, void *p_userdata) = 0;
 
+	// Called once, the first time a material using the texture is drawn, so the full mipmap chain can be streamed in.
+	virtual void texture_set_stream_request_callback(RID p_texture, TextureDetectCallback p_callback, void *p_userdata) = 0;
+
 	struct TextureInfo {
 		RID texture;
 		uint32_t width;
@@ -303,6 +306,12 @@ public:
 		Vector<LOD> lods;
 		Vector<AABB> bone_aabbs;
 
+		// Clusters of triangles, each being a range of index_data, with bounds for culling.
+		// Stored as 32-bit values: index offset, index count, bounding sphere center (xyz) and radius,
+		// normal cone axis (xyz) and cutoff (the cosine of the cone half angle, or 1 for no cone).
+		static constexpr uint32_t MESHLET_DATA_STRIDE = 10 * 4;
+		Vector<uint8_t> meshlet_data;
+
 		Vector<uint8_t> blend_shape_data;
 
 		RID material;
@@ -384,8 +393,14 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) = 0;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_offset, int p_count, const Vector<float> &p_buffer) = 0;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const = 0;
 
+	// Returns the data of p_count instances starting at p_offset, in the same layout as multimesh_set_buffer(), to be modified in place.
+	// The changes are applied by multimesh_unmap_buffer(), only one range can be mapped at a time.
+	virtual float *multimesh_map_buffer_range(RID p_multimesh, int p_offset, int p_count) = 0;
+	virtual void multimesh_unmap_buffer(RID p_multimesh) = 0;
+
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
 	virtual int multimesh_get_visible_instances(RID p_multimesh) const = 0;
 
@@ -399,6 +414,7 @@ public:
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) = 0;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) = 0;
 
 	/* Light API */
 
@@ -783,6 +799,7 @@ public:
 	enum ViewportScaling3DMode {
 		VIEWPORT_SCALING_3D_MODE_BILINEAR,
 		VIEWPORT_SCALING_3D_MODE_FSR,
+		VIEWPORT_SCALING_3D_MODE_TEMPORAL,
 		VIEWPORT_SCALING_3D_MODE_MAX
 	};
 
@@ -942,6 +959,7 @@ public:
 	virtual void viewport_set_measure_render_time(RID p_viewport, bool p_enable) = 0;
 	virtual double viewport_get_measured_render_time_cpu(RID p_viewport) const = 0;
 	virtual double viewport_get_measured_render_time_gpu(RID p_viewport) const = 0;
+	virtual Array viewport_get_measured_render_passes(RID p_viewport) const = 0;
 
 	virtual RID viewport_find_from_screen_attachment(DisplayServer::WindowID p_id = DisplayServer::MAIN_WINDOW_ID) const = 0;
 
@@ -1189,6 +1207,8 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario) = 0;
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1296,6 +1316,8 @@ public:
 	virtual void canvas_item_set_update_when_visible(RID p_item, bool p_update) = 0;
 
 	virtual void canvas_item_set_transform(RID p_item, const Transform2D &p_transform) = 0;
+	virtual void canvas_item_set_interpolated(RID p_item, bool p_interpolated) = 0;
+	virtual void canvas_item_reset_physics_interpolation(RID p_item) = 0;
 	virtual void canvas_item_set_clip(RID p_item, bool p_clip) = 0;
 	virtual void canvas_item_set_distance_field_mode(RID p_item, bool p_enable) = 0;
 	virtual void canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect = Rect2()) = 0;
@@ -1484,6 +1506,8 @@ public:
 
 	virtual void draw(bool p_swap_buffers = true, double frame_step = 0.0) = 0;
 	virtual void sync() = 0;
+	virtual void set_physics_interpolation_enabled(bool p_enabled) = 0;
+	virtual void tick() = 0; // Called at the start of every physics tick.
 	virtual bool has_changed() const = 0;
 	virtual void init();
 	virtual void finish() = 0;
@@ -1497,6 +1521,7 @@ public:
 		RENDERING_INFO_TEXTURE_MEM_USED,
 		RENDERING_INFO_BUFFER_MEM_USED,
 		RENDERING_INFO_VIDEO_MEM_USED,
+		RENDERING_INFO_VIDEO_MEM_BUDGET,
 		RENDERING_INFO_MAX
 	};
 
@@ -1517,6 +1542,8 @@ public:
 	virtual uint64_t get_frame_profile_frame() = 0;
 
 	virtual double get_frame_setup_time_cpu() const = 0;
+	// Time the last frame waited for the display before being presented, 0 when the renderer can't measure it.
+	virtual uint64_t get_frame_present_wait_usec() const = 0;
 
 	virtual void gi_set_use_half_resolution(bool p_enable) = 0;
 
@@ -253,6 +253,19 @@
 		}                                                                 \
 	}
 
+// Like FUNC2, but a call that is still queued for the same first argument is
+// overwritten instead of queuing another one, so only the last value is applied.
+#define FUNC2COALESCED(m_type, m_arg1, m_arg2)                                      \
+	virtual void m_type(m_arg1 p1, m_arg2 p2) override {                            \
+		WRITE_ACTION                                                                \
+		if (Thread::get_caller_id() != server_thread) {                             \
+			command_queue.push_coalesced(server_name, &ServerName::m_type, p1, p2); \
+		} else {                                                                    \
+			command_queue.flush_if_pending();                                       \
+			server_name->m_type(p1, p2);                                            \
+		}                                                                           \
+	}
+
 #define FUNC2C(m_type, m_arg1, m_arg2)                                    \
 	virtual void m_type(m_arg1 p1, m_arg2 p2) const override {            \
 		if (Thread::get_caller_id() != server_thread) {                   \
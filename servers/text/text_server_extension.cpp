@@ -233,6 +233,7 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(shaped_text_add_string, "shaped", "text", "fonts", "size", "opentype_features", "language", "meta");
 	GDVIRTUAL_BIND(shaped_text_add_object, "shaped", "key", "size", "inline_align", "length");
 	GDVIRTUAL_BIND(shaped_text_resize_object, "shaped", "key", "size", "inline_align");
+	GDVIRTUAL_BIND(shaped_text_replace_string, "shaped", "start", "length", "text");
 
 	GDVIRTUAL_BIND(shaped_get_span_count, "shaped");
 	GDVIRTUAL_BIND(shaped_get_span_meta, "shaped", "index");
@@ -1156,6 +1157,14 @@ bool TextServerExtension::shaped_text_resize_object(const RID &p_shaped, const V
 	return false;
 }
 
+bool TextServerExtension::shaped_text_replace_string(const RID &p_shaped, int64_t p_start, int64_t p_length, const String &p_text) {
+	bool ret;
+	if (GDVIRTUAL_CALL(shaped_text_replace_string, p_shaped, p_start, p_length, p_text, ret)) {
+		return ret;
+	}
+	return false;
+}
+
 int64_t TextServerExtension::shaped_get_span_count(const RID &p_shaped) const {
 	int64_t ret;
 	if (GDVIRTUAL_CALL(shaped_get_span_count, p_shaped, ret)) {
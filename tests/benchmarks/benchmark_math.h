@@ -0,0 +1,120 @@
+/*************************************************************************/
+/*  benchmark_math.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_MATH_H
+#define BENCHMARK_MATH_H
+
+#include "core/math/aabb.h"
+#include "core/math/dynamic_bvh.h"
+#include "core/math/random_number_generator.h"
+#include "core/math/transform_3d.h"
+
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkMath {
+
+BENCHMARK_CASE("[Transform3D] Multiply") {
+	Transform3D a = Transform3D(Basis(Vector3(0.2, 0.7, 0.1).normalized(), 0.5), Vector3(1, 2, 3));
+	Transform3D b = Transform3D(Basis(Vector3(0.9, 0.1, 0.3).normalized(), 1.2), Vector3(-3, 0, 1));
+	while (state.keep_running()) {
+		a = a * b;
+		benchmark_do_not_optimize(a);
+	}
+}
+
+BENCHMARK_CASE("[Transform3D] Affine inverse") {
+	Transform3D xform = Transform3D(Basis(Vector3(0.2, 0.7, 0.1).normalized(), 0.5).scaled(Vector3(1, 2, 3)), Vector3(1, 2, 3));
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(xform.affine_inverse());
+	}
+}
+
+BENCHMARK_CASE("[Basis] Get quaternion") {
+	Basis basis = Basis(Vector3(0.2, 0.7, 0.1).normalized(), 0.5);
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(basis.get_quaternion());
+	}
+}
+
+BENCHMARK_CASE("[AABB] Transform") {
+	Transform3D xform = Transform3D(Basis(Vector3(0.2, 0.7, 0.1).normalized(), 0.5), Vector3(1, 2, 3));
+	AABB aabb = AABB(Vector3(-1, -2, -3), Vector3(2, 4, 6));
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(xform.xform(aabb));
+	}
+}
+
+struct CountQuery {
+	int count = 0;
+	bool operator()(void *p_data) {
+		count++;
+		return false; // Keep going.
+	}
+};
+
+static AABB random_aabb(RandomNumberGenerator &p_rng) {
+	return AABB(Vector3(p_rng.randf_range(-100, 100), p_rng.randf_range(-100, 100), p_rng.randf_range(-100, 100)), Vector3(1, 1, 1));
+}
+
+BENCHMARK_CASE("[DynamicBVH] AABB query in 10000 leaves") {
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	DynamicBVH bvh;
+	for (int i = 0; i < 10000; i++) {
+		bvh.insert(random_aabb(rng), nullptr);
+	}
+	const AABB query = AABB(Vector3(-15, -15, -15), Vector3(30, 30, 30));
+	while (state.keep_running()) {
+		CountQuery result;
+		bvh.aabb_query(query, result);
+		benchmark_do_not_optimize(result.count);
+	}
+}
+
+BENCHMARK_CASE("[DynamicBVH] Update leaf in 10000 leaves") {
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	DynamicBVH bvh;
+	LocalVector<DynamicBVH::ID> ids;
+	LocalVector<AABB> moved;
+	for (int i = 0; i < 10000; i++) {
+		ids.push_back(bvh.insert(random_aabb(rng), nullptr));
+		moved.push_back(random_aabb(rng));
+	}
+	uint32_t i = 0;
+	while (state.keep_running()) {
+		uint32_t index = i++ % ids.size();
+		bvh.update(ids[index], moved[index]);
+	}
+}
+
+} // namespace BenchmarkMath
+
+#endif // BENCHMARK_MATH_H
@@ -0,0 +1,193 @@
+/*************************************************************************/
+/*  benchmark_templates.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_TEMPLATES_H
+#define BENCHMARK_TEMPLATES_H
+
+#include "core/math/random_number_generator.h"
+#include "core/string/string_name.h"
+#include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkTemplates {
+
+static const int ELEMENT_COUNT = 1024;
+
+static LocalVector<int> random_keys(int p_count) {
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	LocalVector<int> keys;
+	for (int i = 0; i < p_count; i++) {
+		keys.push_back(rng.randi());
+	}
+	return keys;
+}
+
+BENCHMARK_CASE("[HashMap] Insert and clear 1024 integer keys") {
+	LocalVector<int> keys = random_keys(ELEMENT_COUNT);
+	HashMap<int, int> map;
+	while (state.keep_running()) {
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			map.insert(keys[i], i);
+		}
+		map.clear();
+	}
+}
+
+BENCHMARK_CASE("[HashMap] Lookup integer key") {
+	LocalVector<int> keys = random_keys(ELEMENT_COUNT);
+	HashMap<int, int> map;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		map.insert(keys[i], i);
+	}
+	uint32_t i = 0;
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(map.getptr(keys[i++ & (ELEMENT_COUNT - 1)]));
+	}
+}
+
+BENCHMARK_CASE("[HashMap] Lookup missing String key") {
+	HashMap<String, int> map;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		map.insert(itos(i), i);
+	}
+	const String missing = "missing_key";
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(map.getptr(missing));
+	}
+}
+
+BENCHMARK_CASE("[HashMap] Iterate 1024 elements") {
+	HashMap<int, int> map;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		map.insert(i, i);
+	}
+	while (state.keep_running()) {
+		int sum = 0;
+		for (const KeyValue<int, int> &E : map) {
+			sum += E.value;
+		}
+		benchmark_do_not_optimize(sum);
+	}
+}
+
+BENCHMARK_CASE("[HashSet] Insert and clear 1024 integer keys") {
+	LocalVector<int> keys = random_keys(ELEMENT_COUNT);
+	HashSet<int> set;
+	while (state.keep_running()) {
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			set.insert(keys[i]);
+		}
+		set.clear();
+	}
+}
+
+BENCHMARK_CASE("[Vector] Push back 1024 elements") {
+	while (state.keep_running()) {
+		Vector<int> vector;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			vector.push_back(i);
+		}
+		benchmark_do_not_optimize(vector.ptr());
+	}
+}
+
+BENCHMARK_CASE("[Vector] Copy on write of 1024 elements") {
+	Vector<int> source;
+	source.resize(ELEMENT_COUNT);
+	while (state.keep_running()) {
+		Vector<int> copy = source;
+		copy.write[0] = 1;
+		benchmark_do_not_optimize(copy.ptr());
+	}
+}
+
+BENCHMARK_CASE("[LocalVector] Push back 1024 elements") {
+	while (state.keep_running()) {
+		LocalVector<int> vector;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			vector.push_back(i);
+		}
+		benchmark_do_not_optimize(vector.ptr());
+	}
+}
+
+BENCHMARK_CASE("[StringName] Construct from existing String") {
+	const String name = "benchmark_string_name";
+	StringName keep_alive = name;
+	while (state.keep_running()) {
+		StringName string_name = name;
+		benchmark_do_not_optimize(string_name);
+	}
+}
+
+BENCHMARK_CASE("[StringName] Construct from static C string") {
+	StringName keep_alive = StaticCString::create("benchmark_static_name");
+	while (state.keep_running()) {
+		StringName string_name = StaticCString::create("benchmark_static_name");
+		benchmark_do_not_optimize(string_name);
+	}
+}
+
+BENCHMARK_CASE("[StringName] Compare") {
+	StringName a = "benchmark_a";
+	StringName b = "benchmark_b";
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(a == b);
+	}
+}
+
+struct CommandReceiver {
+	uint64_t total = 0;
+	void add(uint64_t p_value) {
+		total += p_value;
+	}
+};
+
+BENCHMARK_CASE("[CommandQueueMT] Push and flush 256 commands") {
+	CommandReceiver receiver;
+	CommandQueueMT queue(false);
+	while (state.keep_running()) {
+		for (int i = 0; i < 256; i++) {
+			queue.push(&receiver, &CommandReceiver::add, uint64_t(i));
+		}
+		queue.flush_all();
+	}
+	benchmark_do_not_optimize(receiver.total);
+}
+
+} // namespace BenchmarkTemplates
+
+#endif // BENCHMARK_TEMPLATES_H
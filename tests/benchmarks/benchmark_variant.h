@@ -0,0 +1,115 @@
+/*************************************************************************/
+/*  benchmark_variant.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BENCHMARK_VARIANT_H
+#define BENCHMARK_VARIANT_H
+
+#include "core/variant/array.h"
+#include "core/variant/dictionary.h"
+#include "core/variant/variant.h"
+
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkVariant {
+
+BENCHMARK_CASE("[Variant] Evaluate integer addition") {
+	Variant a = 1;
+	Variant b = 2;
+	while (state.keep_running()) {
+		Variant result;
+		bool valid;
+		Variant::evaluate(Variant::OP_ADD, a, b, result, valid);
+		benchmark_do_not_optimize(result);
+	}
+}
+
+BENCHMARK_CASE("[Variant] Evaluate Vector3 multiplication by float") {
+	Variant a = Vector3(1, 2, 3);
+	Variant b = 2.5;
+	while (state.keep_running()) {
+		Variant result;
+		bool valid;
+		Variant::evaluate(Variant::OP_MULTIPLY, a, b, result, valid);
+		benchmark_do_not_optimize(result);
+	}
+}
+
+BENCHMARK_CASE("[Variant] Construct from String") {
+	const String string = "benchmark";
+	while (state.keep_running()) {
+		Variant variant = string;
+		benchmark_do_not_optimize(variant);
+	}
+}
+
+BENCHMARK_CASE("[Variant] Call builtin method") {
+	Variant variant = String("benchmark");
+	const StringName method = "length";
+	while (state.keep_running()) {
+		Variant result;
+		Callable::CallError ce;
+		variant.callp(method, nullptr, 0, result, ce);
+		benchmark_do_not_optimize(result);
+	}
+}
+
+BENCHMARK_CASE("[Variant] Get named member") {
+	Variant variant = Vector3(1, 2, 3);
+	const StringName member = "y";
+	while (state.keep_running()) {
+		bool valid;
+		benchmark_do_not_optimize(variant.get_named(member, valid));
+	}
+}
+
+BENCHMARK_CASE("[Array] Append 1024 integers") {
+	while (state.keep_running()) {
+		Array array;
+		for (int i = 0; i < 1024; i++) {
+			array.push_back(i);
+		}
+		benchmark_do_not_optimize(array.size());
+	}
+}
+
+BENCHMARK_CASE("[Dictionary] Lookup String key") {
+	Dictionary dictionary;
+	for (int i = 0; i < 1024; i++) {
+		dictionary[itos(i)] = i;
+	}
+	const Variant key = "512";
+	while (state.keep_running()) {
+		benchmark_do_not_optimize(dictionary.getptr(key));
+	}
+}
+
+} // namespace BenchmarkVariant
+
+#endif // BENCHMARK_VARIANT_H
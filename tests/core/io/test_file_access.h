@@ -32,6 +32,9 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/io/marshalls.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -78,6 +81,157 @@ TEST_CASE("[FileAccess] CSV read") {
 	CHECK(row5[1] == "tab separated");
 	CHECK(row5[2] == "lines, good?");
 }
+
+TEST_CASE("[FileAccess] Memory mapping") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("translations.csv"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	uint64_t mapped_length = 0;
+	const uint8_t *mapped = f->map_contents(mapped_length);
+	if (!mapped) {
+		// Not supported on this platform.
+		return;
+	}
+	REQUIRE(mapped_length == f->get_length());
+
+	// The mapping doesn't change regular reads.
+	Vector<uint8_t> contents;
+	contents.resize(f->get_length());
+	CHECK(f->get_buffer(contents.ptrw(), contents.size()) == (uint64_t)contents.size());
+	CHECK(memcmp(contents.ptr(), mapped, contents.size()) == 0);
+	CHECK(f->map_contents(mapped_length) == mapped);
+}
+
+static void _async_read_done(void *p_userdata, uint64_t p_bytes_read) {
+	((SafeNumeric<uint64_t> *)p_userdata)->add(p_bytes_read);
+}
+
+TEST_CASE("[FileAccess] Reads at a position") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("translations.csv"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	Vector<uint8_t> contents;
+	contents.resize(f->get_length());
+	f->get_buffer(contents.ptrw(), contents.size());
+	f->seek(5);
+
+	uint8_t buffer[16];
+	CHECK(f->get_buffer_at(10, buffer, 16) == 16);
+	CHECK(memcmp(buffer, contents.ptr() + 10, 16) == 0);
+	CHECK(f->get_buffer_at(contents.size() - 4, buffer, 16) == 4);
+	CHECK_MESSAGE(f->get_position() == 5, "The position shouldn't change.");
+
+	// Read the file in chunks, all at once.
+	Vector<uint8_t> chunks;
+	chunks.resize(contents.size());
+	SafeNumeric<uint64_t> total_read;
+	const int chunk_size = 32;
+	Vector<int64_t> ids;
+	for (int i = 0; i < contents.size(); i += chunk_size) {
+		ids.push_back(f->read_async(i, MIN(chunk_size, contents.size() - i), chunks.ptrw() + i, _async_read_done, &total_read));
+	}
+	for (int i = 0; i < ids.size(); i++) {
+		f->wait_for_async_read(ids[i]);
+	}
+	CHECK(total_read.get() == (uint64_t)contents.size());
+	CHECK(chunks == contents);
+	CHECK(f->get_position() == 5);
+}
+
+TEST_CASE("[FileAccess] Compressed blocks") {
+	const String path = OS::get_singleton()->get_cache_path().plus_file("compressed_blocks.bin");
+	Vector<uint8_t> contents;
+	contents.resize(10000);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = (i * 7) % 251;
+	}
+
+	{
+		// Written after some other data, as in a pack.
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_32(1234);
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("TEST", Compression::MODE_ZSTD, 1024);
+		REQUIRE(fac->open_for_writing(f) == OK);
+		fac->store_buffer(contents.ptr(), contents.size());
+		fac.unref();
+		f->store_32(5678);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_32() == 1234);
+	char magic[5] = {};
+	f->get_buffer((uint8_t *)magic, 4);
+	CHECK(String(magic) == "TEST");
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	REQUIRE(fac->open_after_magic(f) == OK);
+	CHECK(fac->get_length() == (uint64_t)contents.size());
+
+	Vector<uint8_t> read;
+	read.resize(contents.size());
+	CHECK(fac->get_buffer(read.ptrw(), read.size()) == (uint64_t)contents.size());
+	CHECK(read == contents);
+	CHECK(!fac->eof_reached());
+	CHECK(fac->get_8() == 0);
+	CHECK(fac->eof_reached());
+
+	// Reads that start and end in the middle of blocks.
+	fac->seek(1000);
+	uint8_t buffer[3000];
+	CHECK(fac->get_buffer(buffer, 3000) == 3000);
+	CHECK(memcmp(buffer, contents.ptr() + 1000, 3000) == 0);
+	CHECK(fac->get_position() == 4000);
+	CHECK(fac->get_8() == contents[4000]);
+
+	fac->seek(9990);
+	CHECK(fac->get_buffer(buffer, 100) == 10);
+	CHECK(memcmp(buffer, contents.ptr() + 9990, 10) == 0);
+	CHECK(fac->eof_reached());
+
+	fac->seek(0);
+	CHECK(fac->get_8() == contents[0]);
+}
+
+TEST_CASE("[FileAccess] Compressed blocks read ahead") {
+	// Large enough to be compressed and decompressed several blocks at a time.
+	const String path = OS::get_singleton()->get_cache_path().plus_file("compressed_blocks_large.bin");
+	Vector<uint8_t> contents;
+	contents.resize(300000);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = (i / 3 + i * i) % 253;
+	}
+
+	{
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("TEST", Compression::MODE_ZSTD, 4096);
+		REQUIRE(fac->_open(path, FileAccess::WRITE) == OK);
+		fac->store_buffer(contents.ptr(), contents.size());
+	}
+
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	fac->configure("TEST", Compression::MODE_ZSTD, 4096);
+	REQUIRE(fac->_open(path, FileAccess::READ) == OK);
+
+	// Small reads go through the read-ahead buffer.
+	bool matches = true;
+	for (int i = 0; i < contents.size(); i += 4) {
+		matches = matches && fac->get_32() == decode_uint32(contents.ptr() + i);
+	}
+	CHECK(matches);
+	CHECK(!fac->eof_reached());
+
+	Vector<uint8_t> read;
+	read.resize(contents.size() - 5000);
+	fac->seek(5000);
+	CHECK(fac->get_buffer(read.ptrw(), read.size()) == (uint64_t)read.size());
+	CHECK(memcmp(read.ptr(), contents.ptr() + 5000, read.size()) == 0);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
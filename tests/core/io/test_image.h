@@ -155,6 +155,44 @@ TEST_CASE("[Image] Saving and loading") {
 			"The TGA image should load successfully.");
 }
 
+TEST_CASE("[Image] Loading multiple files") {
+	PackedStringArray paths;
+	paths.push_back(TestUtils::get_data_path("images/icon.png"));
+	paths.push_back(TestUtils::get_data_path("images/icon.jpg"));
+	paths.push_back(TestUtils::get_data_path("images/does_not_exist.png"));
+	paths.push_back(TestUtils::get_data_path("images/icon.png"));
+
+	ERR_PRINT_OFF;
+	TypedArray<Image> images = Image::load_from_files(paths);
+	ERR_PRINT_ON;
+
+	REQUIRE(images.size() == 4);
+
+	Ref<Image> image_png = images[0];
+	Ref<Image> image_jpg = images[1];
+	Ref<Image> image_missing = images[2];
+	Ref<Image> image_png_again = images[3];
+
+	CHECK_MESSAGE(
+			image_png.is_valid(),
+			"The PNG image should load successfully.");
+	CHECK_MESSAGE(
+			image_jpg.is_valid(),
+			"The JPG image should load successfully.");
+	CHECK_MESSAGE(
+			image_missing.is_null(),
+			"A file that doesn't exist should give a null image, without affecting the others.");
+	REQUIRE(image_png_again.is_valid());
+	CHECK_MESSAGE(
+			image_png->get_data() == image_png_again->get_data(),
+			"The same file should give the same data wherever it is in the batch.");
+
+	Ref<Image> image_single = Image::load_from_file(paths[0]);
+	CHECK_MESSAGE(
+			image_single->get_data() == image_png->get_data(),
+			"Loading in a batch should give the same data as loading a single file.");
+}
+
 TEST_CASE("[Image] Basic getters") {
 	Ref<Image> image = memnew(Image(8, 4, false, Image::FORMAT_LA8));
 	CHECK(image->get_width() == 8);
@@ -203,6 +241,76 @@ TEST_CASE("[Image] Resizing") {
 			"get_size() should return the correct size after resize_to_po2().");
 }
 
+TEST_CASE("[Image] Resizing and generating mipmaps of large images") {
+	// Large enough to be processed in bands of rows on several threads.
+	const int size = 1024;
+	Ref<Image> image = memnew(Image(size, size, false, Image::FORMAT_RGBA8));
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			image->set_pixel(x, y, Color(float(y) / (size - 1), 0.5, 1.0 - float(y) / (size - 1), 1.0));
+		}
+	}
+
+	for (int i = 0; i < 5; i++) {
+		Ref<Image> image_resized = memnew(Image());
+		image_resized->copy_internals_from(image);
+		image_resized->resize(size / 2 + 3, size / 2 - 5, static_cast<Image::Interpolation>(i));
+
+		bool rows_uniform = true;
+		bool rows_ordered = true;
+		float previous = -1.0;
+		for (int y = 0; y < image_resized->get_height(); y++) {
+			const Color first = image_resized->get_pixel(0, y);
+			for (int x = 1; x < image_resized->get_width(); x++) {
+				// Allow for rounding differences between columns.
+				rows_uniform = rows_uniform && Math::abs(image_resized->get_pixel(x, y).r - first.r) < 1.5 / 255;
+			}
+			rows_ordered = rows_ordered && first.r >= previous - 1.5 / 255;
+			previous = first.r;
+		}
+		CHECK_MESSAGE(rows_uniform, "Every row should only depend on the source rows.");
+		CHECK_MESSAGE(rows_ordered, "Rows should be written in the right place.");
+	}
+
+	Ref<Image> image_solid = memnew(Image(size, size, false, Image::FORMAT_RGBA8));
+	image_solid->fill(Color(0.2, 0.4, 0.6, 1.0));
+	CHECK(image_solid->generate_mipmaps() == OK);
+	const uint8_t *pixels = image_solid->get_data().ptr();
+	for (int mip = 1; mip <= image_solid->get_mipmap_count(); mip++) {
+		int ofs;
+		int mip_size;
+		image_solid->get_mipmap_offset_and_size(mip, ofs, mip_size);
+		bool solid = true;
+		for (int j = 0; j < mip_size; j++) {
+			solid = solid && pixels[ofs + j] == pixels[j % 4];
+		}
+		CHECK_MESSAGE(solid, vformat("Mipmap %d should keep the color of the image.", mip));
+	}
+}
+
+static void _mark_compression_task(void *p_userdata, uint32_t p_index) {
+	static_cast<uint8_t *>(p_userdata)[p_index]++;
+}
+
+TEST_CASE("[Image] Running compression tasks") {
+	const uint32_t count = 1000;
+	Vector<uint8_t> marks;
+	marks.resize(count);
+
+	for (int max_threads : { 0, 1, 2 }) {
+		Image::set_compress_max_threads(max_threads);
+		marks.fill(0);
+		Image::run_compression_tasks(_mark_compression_task, marks.ptrw(), count);
+
+		bool all_once = true;
+		for (uint32_t i = 0; i < count; i++) {
+			all_once = all_once && marks[i] == 1;
+		}
+		CHECK_MESSAGE(all_once, vformat("Every task should run exactly once with a limit of %d threads.", max_threads));
+	}
+	Image::set_compress_max_threads(0);
+}
+
 TEST_CASE("[Image] Modifying pixels of an image") {
 	Ref<Image> image = memnew(Image(3, 3, false, Image::FORMAT_RGBA8));
 	image->set_pixel(0, 0, Color(1, 1, 1, 1));
@@ -32,6 +32,7 @@
 #define TEST_JSON_H
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -146,6 +147,106 @@ TEST_CASE("[JSON] Parsing objects (dictionaries)") {
 			dictionary["empty_object"].hash() == Dictionary().hash(),
 			"The parsed JSON should contain the expected values.");
 }
+
+TEST_CASE("[JSON] Parsing numbers") {
+	JSON json;
+
+	json.parse("[0, -12, 0.5, 1e3, 2.5E-3, 123456789012345678901234567890, 0.1, 1.7976931348623157e308]");
+	const Array array = json.get_data();
+	CHECK(json.get_error_line() == 0);
+	CHECK(double(array[0]) == 0.0);
+	CHECK(double(array[1]) == -12.0);
+	CHECK(double(array[2]) == 0.5);
+	CHECK(double(array[3]) == 1000.0);
+	CHECK(double(array[4]) == 0.0025);
+	CHECK(double(array[5]) == doctest::Approx(1.2345678901234568e29));
+	CHECK_MESSAGE(double(array[6]) == 0.1, "Numbers should be rounded correctly.");
+	CHECK(double(array[7]) == doctest::Approx(1.7976931348623157e308));
+}
+
+TEST_CASE("[JSON] Reading events") {
+	JSONReader reader;
+	reader.open_string(R"({"name": "Godot", "list": [1, true, null, {}], "skipped": {"a": [1, 2]}, "escaped": "\u00e9\ud83d\ude00"})");
+
+	JSONReader::Event event;
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.type == JSONReader::EVENT_OBJECT_BEGIN);
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.type == JSONReader::EVENT_KEY);
+	CHECK(event.value == "name");
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.type == JSONReader::EVENT_VALUE);
+	CHECK(event.value == "Godot");
+
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.value == "list");
+	Variant list;
+	CHECK(reader.read_value(list) == OK);
+	JSON json;
+	json.parse("[1, true, null, {}]");
+	CHECK(list == json.get_data());
+
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.value == "skipped");
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.type == JSONReader::EVENT_OBJECT_BEGIN);
+	CHECK(reader.get_depth() == 2);
+	CHECK(reader.skip() == OK);
+	CHECK(reader.get_depth() == 1);
+
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.value == "escaped");
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.value == String::utf8("\xc3\xa9\xf0\x9f\x98\x80"));
+
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.type == JSONReader::EVENT_OBJECT_END);
+	CHECK(reader.read_next(event) == OK);
+	CHECK(event.type == JSONReader::EVENT_EOF);
+
+	reader.open_string("[1,\n 2 3]");
+	CHECK(reader.read_next(event) == OK);
+	CHECK(reader.read_next(event) == OK);
+	CHECK(reader.read_next(event) == OK);
+	CHECK(reader.read_next(event) == ERR_PARSE_ERROR);
+	CHECK(reader.get_error_line() == 2);
+}
+
+TEST_CASE("[JSON] Reading events from a file") {
+	const String path = OS::get_singleton()->get_cache_path().plus_file("large.json");
+	{
+		// Large enough to be read in several chunks.
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("[");
+		for (int i = 0; i < 20000; i++) {
+			f->store_string(vformat("%s{\"id\": %d, \"label\": \"item %d\"}", i > 0 ? "," : "", i, i));
+		}
+		f->store_string("]");
+	}
+
+	JSONReader reader;
+	reader.open_file(FileAccess::open(path, FileAccess::READ));
+
+	JSONReader::Event event;
+	int ids = 0;
+	int64_t id_sum = 0;
+	bool labels_match = true;
+	while (reader.read_next(event) == OK && event.type != JSONReader::EVENT_EOF) {
+		if (event.type == JSONReader::EVENT_KEY && event.value == "id") {
+			REQUIRE(reader.read_next(event) == OK);
+			id_sum += int64_t(event.value);
+			ids++;
+		} else if (event.type == JSONReader::EVENT_KEY && event.value == "label") {
+			REQUIRE(reader.read_next(event) == OK);
+			labels_match = labels_match && event.value == vformat("item %d", ids - 1);
+		}
+	}
+	CHECK(reader.get_error_message().is_empty());
+	CHECK(ids == 20000);
+	CHECK(id_sum == int64_t(20000) * 19999 / 2);
+	CHECK(labels_match);
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -324,6 +324,80 @@ TEST_CASE("[Marshalls] FLOAT double precision Variant decoding") {
 	CHECK(r_len == 12);
 	CHECK(variant == Variant(0.33333333333333333));
 }
+
+TEST_CASE("[Marshalls] Encoding into a reusable buffer") {
+	Dictionary d;
+	d["name"] = "player";
+	d["position"] = Vector3(1, 2, 3);
+	d["scores"] = PackedInt32Array({ 1, 2, 3, 4, 5 });
+	Array a;
+	a.push_back(d);
+	a.push_back(String("a string longer than the buffer we start with"));
+
+	int expected_len;
+	REQUIRE(encode_variant(a, nullptr, expected_len) == OK);
+	Vector<uint8_t> expected;
+	expected.resize(expected_len);
+	REQUIRE(encode_variant(a, expected.ptrw(), expected_len) == OK);
+
+	Vector<uint8_t> buffer;
+	buffer.resize(16);
+	int len;
+	CHECK(encode_variant_to_buffer(a, buffer, len) == OK);
+	CHECK_MESSAGE(buffer.size() >= len, "The buffer should grow to fit the data.");
+	CHECK(len == expected_len);
+	CHECK(memcmp(buffer.ptr(), expected.ptr(), len) == 0);
+
+	// Encoding something smaller reuses the buffer as is.
+	const int buffer_size = buffer.size();
+	CHECK(encode_variant_to_buffer(Variant(42), buffer, len) == OK);
+	CHECK(len == 8);
+	CHECK(buffer.size() == buffer_size);
+	Variant decoded;
+	CHECK(decode_variant(decoded, buffer.ptr(), len) == OK);
+	CHECK(decoded == Variant(42));
+
+	Vector<uint8_t> small;
+	CHECK(encode_variant_to_buffer(a, small, len, false, 16) == ERR_OUT_OF_MEMORY);
+	CHECK(small.size() == 0);
+}
+
+TEST_CASE("[Marshalls] Packed array views") {
+	PackedFloat32Array floats({ 0.5f, 1.5f, 2.5f });
+	int len;
+	REQUIRE(encode_variant(floats, nullptr, len) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	REQUIRE(encode_variant(floats, buffer.ptrw(), len) == OK);
+
+	PackedArrayView view;
+	int r_len;
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == len);
+	CHECK(view.type == Variant::PACKED_FLOAT32_ARRAY);
+	CHECK(view.count == 3);
+	CHECK(view.element_size == 4);
+	CHECK(view.data == buffer.ptr() + 8);
+	CHECK(decode_float(view.data + 4) == 1.5f);
+
+	PackedByteArray bytes({ 1, 2, 3, 4, 5 });
+	REQUIRE(encode_variant(bytes, nullptr, len) == OK);
+	buffer.resize(len);
+	REQUIRE(encode_variant(bytes, buffer.ptrw(), len) == OK);
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK_MESSAGE(r_len == len, "The padding should be included.");
+	CHECK(view.count == 5);
+	CHECK(view.data[4] == 5);
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(decode_packed_array_view(view, buffer.ptr(), 10, &r_len) == ERR_INVALID_DATA, "Truncated data should be rejected.");
+	ERR_PRINT_ON;
+
+	REQUIRE(encode_variant(Variant("text"), nullptr, len) == OK);
+	buffer.resize(len);
+	REQUIRE(encode_variant(Variant("text"), buffer.ptrw(), len) == OK);
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size()) == ERR_INVALID_DATA);
+}
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
@@ -109,6 +109,91 @@ TEST_CASE("[Resource] Saving and loading") {
 			loaded_child_resource_text->get_name() == "I'm a child resource",
 			"The loaded child resource name should be equal to the expected value.");
 }
+
+TEST_CASE("[Resource] Retained by the cache") {
+	ResourceCache::set_retain_budget(100);
+
+	Ref<Resource> resource_a = memnew(Resource);
+	resource_a->set_path("res://retained_a.res");
+	Ref<Resource> resource_b = memnew(Resource);
+	resource_b->set_path("res://retained_b.res");
+	ResourceCache::retain(resource_a, 40);
+	ResourceCache::retain(resource_b, 40);
+	resource_a.unref();
+	resource_b.unref();
+
+	CHECK_MESSAGE(
+			ResourceCache::has("res://retained_a.res"),
+			"Retained resources should stay loaded after their last reference is gone.");
+	CHECK(ResourceCache::get_retained_count() == 2);
+	CHECK(ResourceCache::get_retained_cost() == 80);
+
+	// Using <a> again makes <b> the first to go.
+	ResourceCache::touch_retained("res://retained_a.res");
+	Ref<Resource> resource_c = memnew(Resource);
+	resource_c->set_path("res://retained_c.res");
+	ResourceCache::retain(resource_c, 40);
+
+	CHECK_MESSAGE(
+			!ResourceCache::has("res://retained_b.res"),
+			"The least recently used resource should be freed once the budget is exceeded.");
+	CHECK(ResourceCache::has("res://retained_a.res"));
+	CHECK(ResourceCache::get_retained_cost() == 80);
+
+	ResourceCache::set_retain_budget(0);
+	CHECK(ResourceCache::get_retained_count() == 0);
+	CHECK_MESSAGE(
+			!ResourceCache::has("res://retained_a.res"),
+			"Resources should be freed when the budget is removed.");
+	CHECK_MESSAGE(
+			ResourceCache::has("res://retained_c.res"),
+			"Resources still referenced elsewhere should stay loaded.");
+}
+
+TEST_CASE("[Resource] Deduplicating sub-resources") {
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_name("Shared child");
+	child_resource->set_meta("data", PackedInt32Array({ 1, 2, 3, 4 }));
+	Ref<Resource> other_child_resource = memnew(Resource);
+	other_child_resource->set_name("Other child");
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_meta("child", child_resource);
+	const String save_path_a = OS::get_singleton()->get_cache_path().plus_file("dedup_a.tres");
+	const String save_path_b = OS::get_singleton()->get_cache_path().plus_file("dedup_b.res");
+	ResourceSaver::save(save_path_a, resource);
+	ResourceSaver::save(save_path_b, resource);
+	resource->set_meta("child", other_child_resource);
+	const String save_path_c = OS::get_singleton()->get_cache_path().plus_file("dedup_c.tres");
+	ResourceSaver::save(save_path_c, resource);
+
+	uint64_t shared_count_before = 0;
+	uint64_t bytes_saved_before = 0;
+	ResourceLoader::get_deduplication_stats(shared_count_before, bytes_saved_before);
+
+	ResourceLoader::set_deduplicate_sub_resources(true);
+	Ref<Resource> loaded_a = ResourceLoader::load(save_path_a, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	Ref<Resource> loaded_b = ResourceLoader::load(save_path_b, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	Ref<Resource> loaded_c = ResourceLoader::load(save_path_c, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	ResourceLoader::set_deduplicate_sub_resources(false);
+
+	const Ref<Resource> child_a = loaded_a->get_meta("child");
+	const Ref<Resource> child_b = loaded_b->get_meta("child");
+	const Ref<Resource> child_c = loaded_c->get_meta("child");
+	CHECK_MESSAGE(
+			child_a == child_b,
+			"Identical sub-resources from different files should be shared, whatever the format.");
+	CHECK_MESSAGE(
+			child_a != child_c,
+			"Different sub-resources should not be shared.");
+	CHECK(child_c->get_name() == "Other child");
+
+	uint64_t shared_count = 0;
+	uint64_t bytes_saved = 0;
+	ResourceLoader::get_deduplication_stats(shared_count, bytes_saved);
+	CHECK(shared_count == shared_count_before + 1);
+	CHECK(bytes_saved > bytes_saved_before);
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -213,6 +213,43 @@ TEST_CASE("[AStar3D] Add/Remove") {
 	// It's been great work, cheers. \(^ ^)/
 }
 
+TEST_CASE("[AStar3D] Batched paths") {
+	// A grid of points, with a few disabled ones in the middle.
+	const int N = 16;
+	AStar3D a;
+	for (int y = 0; y < N; y++) {
+		for (int x = 0; x < N; x++) {
+			a.add_point(y * N + x, Vector3(x, y, 0));
+			if (x > 0) {
+				a.connect_points(y * N + x, y * N + x - 1);
+			}
+			if (y > 0) {
+				a.connect_points(y * N + x, (y - 1) * N + x);
+			}
+		}
+	}
+	for (int y = 2; y < N - 2; y++) {
+		a.set_point_disabled(y * N + N / 2);
+	}
+
+	Vector<int64_t> from_ids;
+	Vector<int64_t> to_ids;
+	for (int i = 0; i < 64; i++) {
+		from_ids.push_back((i * 7) % (N * N));
+		to_ids.push_back((i * 13 + 5) % (N * N));
+	}
+	Array paths = a.get_id_paths(from_ids, to_ids);
+	REQUIRE(paths.size() == 64);
+	for (int i = 0; i < 64; i++) {
+		Vector<int64_t> path = paths[i];
+		CHECK(path == a.get_id_path(from_ids[i], to_ids[i]));
+	}
+
+	ERR_PRINT_OFF;
+	CHECK(a.get_id_paths(from_ids, Vector<int64_t>()).is_empty());
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Stress][AStar3D] Find paths") {
 	// Random stress tests with Floyd-Warshall.
 	const int N = 30;
@@ -0,0 +1,146 @@
+/*************************************************************************/
+/*  test_astar_grid_2d.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_ASTAR_GRID_2D_H
+#define TEST_ASTAR_GRID_2D_H
+
+#include "core/math/a_star_grid_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAStarGrid2D {
+
+static real_t path_cost(const TypedArray<Vector2i> &p_path) {
+	real_t cost = 0;
+	for (int i = 1; i < p_path.size(); i++) {
+		cost += Vector2(Vector2i(p_path[i]) - Vector2i(p_path[i - 1])).length();
+	}
+	return cost;
+}
+
+// A maze-like grid with a wall splitting it in two, with a single gap.
+static void setup_grid(AStarGrid2D &r_grid, int p_cluster_size, bool p_jumping) {
+	r_grid.set_size(Vector2i(32, 24));
+	r_grid.set_hierarchy_cluster_size(p_cluster_size);
+	r_grid.set_jumping_enabled(p_jumping);
+	r_grid.update();
+	for (int y = 0; y < 24; y++) {
+		if (y != 20) {
+			r_grid.set_point_solid(Vector2i(16, y));
+		}
+	}
+	for (int x = 4; x < 14; x++) {
+		r_grid.set_point_solid(Vector2i(x, 8));
+	}
+	for (int y = 3; y < 18; y++) {
+		r_grid.set_point_solid(Vector2i(24, y));
+	}
+}
+
+TEST_CASE("[AStarGrid2D] Simple path") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_size(Vector2i(8, 8));
+	grid->set_cell_size(Vector2(16, 16));
+	CHECK(grid->is_dirty());
+	grid->update();
+	CHECK_FALSE(grid->is_dirty());
+
+	TypedArray<Vector2i> path = grid->get_id_path(Vector2i(0, 0), Vector2i(3, 4));
+	REQUIRE(path.size() == 5);
+	CHECK(Vector2i(path[0]) == Vector2i(0, 0));
+	CHECK(Vector2i(path[4]) == Vector2i(3, 4));
+
+	Vector<Vector2> point_path = grid->get_point_path(Vector2i(0, 0), Vector2i(3, 4));
+	REQUIRE(point_path.size() == 5);
+	CHECK(point_path[4] == Vector2(48, 64));
+
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	path = grid->get_id_path(Vector2i(0, 0), Vector2i(3, 4));
+	CHECK(path.size() == 8);
+
+	CHECK(grid->get_id_path(Vector2i(2, 2), Vector2i(2, 2)).size() == 1);
+
+	grid->set_point_solid(Vector2i(3, 4));
+	CHECK(grid->is_point_solid(Vector2i(3, 4)));
+	CHECK(grid->get_id_path(Vector2i(0, 0), Vector2i(3, 4)).is_empty());
+}
+
+TEST_CASE("[AStarGrid2D] Jumping finds shortest paths") {
+	AStarGrid2D grid;
+	setup_grid(grid, 0, false);
+	AStarGrid2D jumping;
+	setup_grid(jumping, 0, true);
+
+	const Vector2i from[] = { Vector2i(0, 0), Vector2i(10, 2), Vector2i(31, 0), Vector2i(5, 12) };
+	const Vector2i to[] = { Vector2i(31, 23), Vector2i(10, 12), Vector2i(0, 23), Vector2i(30, 10) };
+	for (int mode = 0; mode < AStarGrid2D::DIAGONAL_MODE_MAX; mode++) {
+		grid.set_diagonal_mode(AStarGrid2D::DiagonalMode(mode));
+		jumping.set_diagonal_mode(AStarGrid2D::DiagonalMode(mode));
+		for (int i = 0; i < 4; i++) {
+			TypedArray<Vector2i> expected = grid.get_id_path(from[i], to[i]);
+			TypedArray<Vector2i> path = jumping.get_id_path(from[i], to[i]);
+			REQUIRE(path.size() > 0);
+			// Jump points are filled in, so the path is still made of adjacent cells.
+			for (int j = 1; j < path.size(); j++) {
+				Vector2i step = Vector2i(path[j]) - Vector2i(path[j - 1]);
+				CHECK(MAX(ABS(step.x), ABS(step.y)) == 1);
+			}
+			CHECK(path_cost(path) == doctest::Approx(path_cost(expected)));
+		}
+	}
+}
+
+TEST_CASE("[AStarGrid2D] Hierarchical paths") {
+	AStarGrid2D grid;
+	setup_grid(grid, 0, false);
+	AStarGrid2D hierarchical;
+	setup_grid(hierarchical, 4, true);
+
+	TypedArray<Vector2i> expected = grid.get_id_path(Vector2i(0, 0), Vector2i(31, 0));
+	TypedArray<Vector2i> path = hierarchical.get_id_path(Vector2i(0, 0), Vector2i(31, 0));
+	REQUIRE(path.size() > 0);
+	CHECK(Vector2i(path[0]) == Vector2i(0, 0));
+	CHECK(Vector2i(path[path.size() - 1]) == Vector2i(31, 0));
+	CHECK(path_cost(path) >= path_cost(expected) - CMP_EPSILON);
+
+	// Closing the gap disconnects both halves, only the clusters around it get rebuilt.
+	grid.set_point_solid(Vector2i(16, 20));
+	hierarchical.set_point_solid(Vector2i(16, 20));
+	CHECK(grid.get_id_path(Vector2i(0, 0), Vector2i(31, 0)).is_empty());
+	CHECK(hierarchical.get_id_path(Vector2i(0, 0), Vector2i(31, 0)).is_empty());
+	CHECK(hierarchical.get_id_path(Vector2i(0, 0), Vector2i(15, 23)).size() > 0);
+
+	hierarchical.set_point_solid(Vector2i(16, 20), false);
+	CHECK(hierarchical.get_id_path(Vector2i(0, 0), Vector2i(31, 0)).size() > 0);
+}
+} // namespace TestAStarGrid2D
+
+#endif // TEST_ASTAR_GRID_2D_H
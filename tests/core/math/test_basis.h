@@ -33,6 +33,7 @@
 
 #include "core/math/basis.h"
 #include "core/math/random_number_generator.h"
+#include "core/math/transform_3d.h"
 
 #include "tests/test_macros.h"
 
@@ -281,6 +282,43 @@ TEST_CASE("[Stress][Basis] Euler conversions") {
 		}
 	}
 }
+
+TEST_CASE("[Basis] Batched xform") {
+	const Basis basis = Basis::from_euler(Vector3(0.3, -1.2, 2.1)).scaled(Vector3(1.5, 0.5, 2.0));
+	const Transform3D transform(basis, Vector3(3, -4, 5));
+
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	// Not a multiple of the batch width, so the remainder path is tested too.
+	const int count = 19;
+	Vector3 input[count];
+	Vector3 output[count];
+	for (int i = 0; i < count; i++) {
+		input[i] = Vector3(rng.randf_range(-10, 10), rng.randf_range(-10, 10), rng.randf_range(-10, 10));
+	}
+
+	basis.xform_array(input, output, count);
+	for (int i = 0; i < count; i++) {
+		CHECK(output[i].is_equal_approx(basis.xform(input[i])));
+	}
+
+	transform.xform_array(input, output, count);
+	for (int i = 0; i < count; i++) {
+		CHECK(output[i].is_equal_approx(transform.xform(input[i])));
+	}
+
+	// In place.
+	Vector3 expected = transform.xform(input[5]);
+	transform.xform_array(input, input, count);
+	CHECK(input[5].is_equal_approx(expected));
+
+	Transform3D transforms[3] = { Transform3D(), transform, Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3)) };
+	Transform3D multiplied[3];
+	transform.xform_array(transforms, multiplied, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(multiplied[i].is_equal_approx(transform * transforms[i]));
+	}
+}
 } // namespace TestBasis
 
 #endif // TEST_BASIS_H
@@ -0,0 +1,122 @@
+/*************************************************************************/
+/*  test_dynamic_bvh.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_DYNAMIC_BVH_H
+#define TEST_DYNAMIC_BVH_H
+
+#include "core/math/dynamic_bvh.h"
+#include "core/math/random_number_generator.h"
+
+#include "tests/test_macros.h"
+
+namespace TestDynamicBVH {
+
+struct CountQuery {
+	int count = 0;
+	bool operator()(void *p_data) {
+		count++;
+		return false; // Keep going.
+	}
+};
+
+static AABB random_aabb(RandomNumberGenerator &p_rng) {
+	return AABB(Vector3(p_rng.randf_range(-100, 100), p_rng.randf_range(-100, 100), p_rng.randf_range(-100, 100)), Vector3(1, 1, 1));
+}
+
+static void check_queries(DynamicBVH &p_bvh, const LocalVector<AABB> &p_aabbs, RandomNumberGenerator &p_rng) {
+	for (int i = 0; i < 20; i++) {
+		AABB query = AABB(Vector3(p_rng.randf_range(-100, 100), p_rng.randf_range(-100, 100), p_rng.randf_range(-100, 100)), Vector3(30, 30, 30));
+		int expected = 0;
+		for (uint32_t j = 0; j < p_aabbs.size(); j++) {
+			if (p_aabbs[j].intersects_inclusive(query)) {
+				expected++;
+			}
+		}
+		CountQuery result;
+		p_bvh.aabb_query(query, result);
+		CHECK(result.count == expected);
+	}
+}
+
+TEST_CASE("[DynamicBVH] Deferred updates and refit") {
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+
+	DynamicBVH bvh;
+	LocalVector<AABB> aabbs;
+	LocalVector<DynamicBVH::ID> ids;
+	// Enough leaves for the parallel refit to kick in.
+	const int count = 2000;
+	for (int i = 0; i < count; i++) {
+		aabbs.push_back(random_aabb(rng));
+		ids.push_back(bvh.insert(aabbs[i], &aabbs[i]));
+	}
+	check_queries(bvh, aabbs, rng);
+
+	SUBCASE("Moving a few leaves") {
+		for (int i = 0; i < 10; i++) {
+			aabbs[i] = random_aabb(rng);
+			CHECK(bvh.update_deferred(ids[i], aabbs[i]));
+		}
+		bvh.refit();
+		check_queries(bvh, aabbs, rng);
+	}
+
+	SUBCASE("Moving all leaves") {
+		for (int i = 0; i < count; i++) {
+			aabbs[i] = random_aabb(rng);
+			bvh.update_deferred(ids[i], aabbs[i]);
+		}
+		bvh.refit(10);
+		check_queries(bvh, aabbs, rng);
+	}
+
+	SUBCASE("Removing leaves with pending updates") {
+		for (int i = 0; i < 100; i++) {
+			aabbs[i] = random_aabb(rng);
+			bvh.update_deferred(ids[i], aabbs[i]);
+		}
+		for (int i = 0; i < 50; i++) {
+			bvh.remove(ids[i]);
+			// Removed leaves must not be counted by the queries anymore.
+			aabbs[i] = AABB(Vector3(1e6, 1e6, 1e6), Vector3());
+		}
+		bvh.refit();
+		check_queries(bvh, aabbs, rng);
+		CHECK(bvh.get_leaf_count() == count - 50);
+	}
+
+	CHECK_FALSE_MESSAGE(bvh.update_deferred(ids[count - 1], aabbs[count - 1]), "Updating to the same bounds should be a no-op.");
+	bvh.clear();
+}
+
+} // namespace TestDynamicBVH
+
+#endif // TEST_DYNAMIC_BVH_H
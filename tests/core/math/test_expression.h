@@ -321,6 +321,66 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Expression] Repeated execution") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("foo");
+	CHECK_MESSAGE(
+			expression.parse("foo * (2 + 3) + Vector2(1, 2).y", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	// The operand types change between executions.
+	Array values;
+	values.push_back(4);
+	CHECK_MESSAGE(
+			int(expression.execute(values)) == 22,
+			"The expression should return the expected value.");
+	values[0] = 0.5;
+	CHECK_MESSAGE(
+			Math::is_equal_approx(double(expression.execute(values)), 4.5),
+			"The expression should return the expected value.");
+	values[0] = Vector2(1, 2);
+	ERR_PRINT_OFF;
+	expression.execute(values);
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"The expression should fail to add a Vector2 and a float.");
+	ERR_PRINT_ON;
+	values[0] = 4;
+	CHECK_MESSAGE(
+			int(expression.execute(values)) == 22,
+			"The expression should return the expected value.");
+	CHECK_FALSE(expression.has_execute_failed());
+
+	// Calls and containers get fresh values on each execution.
+	CHECK_MESSAGE(
+			expression.parse("[foo, foo * 2, str(foo).length()]", parameter_names) == OK,
+			"The expression should parse successfully.");
+	Array first = expression.execute(values);
+	values[0] = 100;
+	Array second = expression.execute(values);
+	REQUIRE(first.size() == 3);
+	REQUIRE(second.size() == 3);
+	CHECK(int(first[0]) == 4);
+	CHECK(int(first[1]) == 8);
+	CHECK(int(first[2]) == 1);
+	CHECK(int(second[0]) == 100);
+	CHECK(int(second[1]) == 200);
+	CHECK(int(second[2]) == 3);
+
+	// Invalid constant operations are still reported when executing.
+	CHECK_MESSAGE(
+			expression.parse("1 / 0") == OK,
+			"The expression should parse successfully.");
+	ERR_PRINT_OFF;
+	expression.execute();
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Integer division by zero should fail.");
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
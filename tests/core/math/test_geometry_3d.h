@@ -31,7 +31,9 @@
 #ifndef TEST_GEOMETRY_3D_H
 #define TEST_GEOMETRY_3D_H
 
+#include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
+#include "core/math/quick_hull.h"
 #include "tests/test_macros.h"
 
 namespace TestGeometry3D {
@@ -432,6 +434,50 @@ TEST_CASE("[Geometry3D] Triangle and Sphere Intersect") {
 		CHECK(output == current_case.want);
 	}
 }
+
+TEST_CASE("[Geometry3D] Convex hull batches") {
+	Vector<Vector<Vector3>> point_sets;
+	for (int i = 0; i < 8; i++) {
+		// A cube with some points inside it.
+		Vector<Vector3> points;
+		const Vector3 offset(i * 10, 0, 0);
+		for (int j = 0; j < 8; j++) {
+			points.push_back(offset + Vector3(j & 1, (j >> 1) & 1, (j >> 2) & 1));
+		}
+		for (int j = 0; j <= i; j++) {
+			points.push_back(offset + Vector3(0.5, 0.1 * (j + 1), 0.5));
+		}
+		point_sets.push_back(points);
+	}
+
+	Vector<Geometry3D::MeshData> meshes;
+	CHECK(ConvexHullComputer::convex_hull_batch(point_sets, meshes) == OK);
+	REQUIRE(meshes.size() == point_sets.size());
+	for (int i = 0; i < meshes.size(); i++) {
+		Geometry3D::MeshData single;
+		ConvexHullComputer::convex_hull(point_sets[i], single);
+		CHECK(meshes[i].vertices.size() == 8);
+		CHECK(meshes[i].faces.size() == single.faces.size());
+		CHECK(meshes[i].edges.size() == single.edges.size());
+	}
+
+	CHECK(QuickHull::build_batch(point_sets, meshes) == OK);
+	REQUIRE(meshes.size() == point_sets.size());
+	for (int i = 0; i < meshes.size(); i++) {
+		Geometry3D::MeshData single;
+		QuickHull::build(point_sets[i], single);
+		CHECK(meshes[i].faces.size() == single.faces.size());
+		CHECK(meshes[i].edges.size() == single.edges.size());
+	}
+
+	// A failed set is reported, but doesn't prevent building the others.
+	point_sets.write[3].clear();
+	ERR_PRINT_OFF;
+	CHECK(ConvexHullComputer::convex_hull_batch(point_sets, meshes) != OK);
+	ERR_PRINT_ON;
+	CHECK(meshes[3].vertices.is_empty());
+	CHECK(meshes[4].vertices.size() == 8);
+}
 } // namespace TestGeometry3D
 
 #endif // TEST_GEOMETRY_3D_H
@@ -0,0 +1,129 @@
+/*************************************************************************/
+/*  test_packed_array_math.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PACKED_ARRAY_MATH_H
+#define TEST_PACKED_ARRAY_MATH_H
+
+#include "core/math/packed_array_math.h"
+#include "core/variant/variant.h"
+#include "tests/test_macros.h"
+
+namespace TestPackedArrayMath {
+
+// Odd sizes, so the elements after the last whole SIMD vector are covered too.
+static PackedFloat32Array make_float32_array(int p_size, float p_offset) {
+	PackedFloat32Array array;
+	array.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		array.write[i] = (i % 17) + p_offset;
+	}
+	return array;
+}
+
+TEST_CASE("[PackedArrayMath] Element-wise operations") {
+	const int size = 1003;
+	PackedFloat32Array a = make_float32_array(size, 1.0);
+	const PackedFloat32Array b = make_float32_array(size, 0.5);
+
+	PackedArrayMath::add(a.ptrw(), b.ptr(), size);
+	CHECK(a[0] == doctest::Approx(1.5));
+	CHECK(a[size - 1] == doctest::Approx((size - 1) % 17 * 2 + 1.5));
+
+	PackedArrayMath::multiply_scalar(a.ptrw(), 2.0, size);
+	CHECK(a[1] == doctest::Approx(7.0));
+
+	PackedArrayMath::lerp(a.ptrw(), b.ptr(), 0.5, size);
+	CHECK(a[1] == doctest::Approx((7.0 + 1.5) * 0.5));
+
+	PackedArrayMath::clamp(a.ptrw(), 2.0, 3.0, size);
+	CHECK(a[0] == doctest::Approx(2.0));
+	CHECK(a[size - 1] == doctest::Approx(3.0));
+
+	PackedFloat64Array c;
+	c.push_back(1.0);
+	c.push_back(-2.0);
+	c.push_back(3.0);
+	PackedArrayMath::add_scalar(c.ptrw(), 1.0, c.size());
+	CHECK(c[1] == doctest::Approx(-1.0));
+}
+
+TEST_CASE("[PackedArrayMath] Reductions") {
+	// Spans several chunks.
+	const int size = PackedArrayMath::CHUNK_SIZE * 2 + 5;
+	const PackedFloat32Array a = make_float32_array(size, -8.0);
+	const PackedFloat32Array b = make_float32_array(size, 0.0);
+
+	double sum = 0.0;
+	double dot = 0.0;
+	for (int i = 0; i < size; i++) {
+		sum += a[i];
+		dot += a[i] * b[i];
+	}
+
+	CHECK(PackedArrayMath::sum(a.ptr(), size) == doctest::Approx(sum));
+	CHECK(PackedArrayMath::dot(a.ptr(), b.ptr(), size) == doctest::Approx(dot));
+	CHECK(PackedArrayMath::min(a.ptr(), size) == doctest::Approx(-8.0));
+	CHECK(PackedArrayMath::max(a.ptr(), size) == doctest::Approx(8.0));
+	CHECK(PackedArrayMath::min(a.ptr(), 0) == 0.0);
+	CHECK(PackedArrayMath::sum(a.ptr(), 0) == 0.0);
+}
+
+TEST_CASE("[PackedArrayMath] Vectors") {
+	PackedVector3Array vectors;
+	vectors.push_back(Vector3(1, 0, 0));
+	vectors.push_back(Vector3(0, 2, 0));
+	vectors.push_back(Vector3(0, 0, 3));
+
+	const Transform3D xform = Transform3D(Basis(Vector3(0, 1, 0), Math_PI / 2), Vector3(1, 2, 3));
+	PackedVector3Array expected = vectors;
+	for (int i = 0; i < expected.size(); i++) {
+		expected.write[i] = xform.xform(expected[i]);
+	}
+
+	PackedArrayMath::transform_vector3(vectors.ptrw(), xform, vectors.size());
+	for (int i = 0; i < vectors.size(); i++) {
+		CHECK(vectors[i].is_equal_approx(expected[i]));
+	}
+
+	CHECK(PackedArrayMath::sum_vector3(expected.ptr(), expected.size()).is_equal_approx(expected[0] + expected[1] + expected[2]));
+
+	PackedVector2Array a;
+	a.push_back(Vector2(1, 2));
+	a.push_back(Vector2(3, 4));
+	PackedFloat32Array dots;
+	dots.resize(a.size());
+	PackedArrayMath::dot_vector2(a.ptr(), a.ptr(), dots.ptrw(), a.size());
+	CHECK(dots[0] == doctest::Approx(5.0));
+	CHECK(dots[1] == doctest::Approx(25.0));
+}
+
+} // namespace TestPackedArrayMath
+
+#endif // TEST_PACKED_ARRAY_MATH_H
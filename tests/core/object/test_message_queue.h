@@ -0,0 +1,153 @@
+/*************************************************************************/
+/*  test_message_queue.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows).
+class _TestMessageQueueObject : public Object {
+	GDCLASS(_TestMessageQueueObject, Object);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what < NOTIFICATION_BASE) {
+			return;
+		}
+		received.push_back(p_what);
+		if (p_what == NOTIFICATION_BASE) {
+			// Pushed while flushing, must still run in this flush.
+			MessageQueue::get_singleton()->push_notification(this, NOTIFICATION_BASE + 1);
+		}
+	}
+
+public:
+	enum {
+		NOTIFICATION_BASE = 20000,
+	};
+
+	Vector<int> received;
+};
+
+namespace TestMessageQueue {
+
+TEST_CASE("[MessageQueue] Messages run in push order") {
+	_TestMessageQueueObject object;
+	MessageQueue *mq = MessageQueue::get_singleton();
+
+	mq->push_notification(&object, _TestMessageQueueObject::NOTIFICATION_BASE + 2);
+	mq->push_notification(&object, _TestMessageQueueObject::NOTIFICATION_BASE);
+	mq->push_notification(&object, _TestMessageQueueObject::NOTIFICATION_BASE + 3);
+	mq->flush();
+
+	REQUIRE(object.received.size() == 4);
+	CHECK(object.received[0] == _TestMessageQueueObject::NOTIFICATION_BASE + 2);
+	CHECK(object.received[1] == _TestMessageQueueObject::NOTIFICATION_BASE);
+	CHECK(object.received[2] == _TestMessageQueueObject::NOTIFICATION_BASE + 3);
+	CHECK_MESSAGE(object.received[3] == _TestMessageQueueObject::NOTIFICATION_BASE + 1,
+			"Messages pushed during a flush should run at the end of the same flush.");
+}
+
+struct ThreadPushData {
+	_TestMessageQueueObject *object = nullptr;
+	int thread_index = 0;
+};
+
+static const int MESSAGES_PER_THREAD = 200;
+
+static void _push_from_thread(void *p_userdata) {
+	ThreadPushData *data = (ThreadPushData *)p_userdata;
+	for (int i = 0; i < MESSAGES_PER_THREAD; i++) {
+		MessageQueue::get_singleton()->push_notification(data->object, _TestMessageQueueObject::NOTIFICATION_BASE + 2 + data->thread_index * MESSAGES_PER_THREAD + i);
+	}
+}
+
+TEST_CASE("[MessageQueue] Messages pushed from several threads") {
+	const int thread_count = 4;
+	_TestMessageQueueObject object;
+	ThreadPushData data[thread_count];
+	Thread threads[thread_count];
+
+	for (int i = 0; i < thread_count; i++) {
+		data[i].object = &object;
+		data[i].thread_index = i;
+		threads[i].start(&_push_from_thread, &data[i]);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	MessageQueue::get_singleton()->flush();
+
+	REQUIRE(object.received.size() == thread_count * MESSAGES_PER_THREAD);
+
+	int last_received[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		last_received[i] = -1;
+	}
+	bool in_order = true;
+	for (int i = 0; i < object.received.size(); i++) {
+		int value = object.received[i] - _TestMessageQueueObject::NOTIFICATION_BASE - 2;
+		int thread_index = value / MESSAGES_PER_THREAD;
+		if (value <= last_received[thread_index]) {
+			in_order = false;
+		}
+		last_received[thread_index] = value;
+	}
+	CHECK_MESSAGE(in_order, "Messages from the same thread should keep their order.");
+}
+
+TEST_CASE("[MessageQueue] Messages pushed from threads reusing the buffers of exited ones") {
+	_TestMessageQueueObject object;
+	ThreadPushData data;
+	data.object = &object;
+
+	for (int round = 0; round < 3; round++) {
+		Thread thread;
+		thread.start(&_push_from_thread, &data);
+		thread.wait_to_finish();
+
+		MessageQueue::get_singleton()->flush();
+
+		REQUIRE(object.received.size() == MESSAGES_PER_THREAD);
+		CHECK(object.received[0] == _TestMessageQueueObject::NOTIFICATION_BASE + 2);
+		CHECK(object.received[MESSAGES_PER_THREAD - 1] == _TestMessageQueueObject::NOTIFICATION_BASE + 1 + MESSAGES_PER_THREAD);
+		object.received.clear();
+	}
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
@@ -275,6 +275,74 @@ TEST_CASE("[Object] Absent name getter") {
 			actual_value == Variant(),
 			"The returned value should equal nil variant.");
 }
+
+TEST_CASE("[Object] Calling bound methods") {
+	Object object;
+	Callable::CallError ce;
+
+	// Exact argument types go through the ptrcall fast path.
+	Variant arg = false;
+	const Variant *args[1] = { &arg };
+	object.callp("set_message_translation", args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	Variant ret = object.callp("can_translate_messages", nullptr, 0, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret.get_type() == Variant::BOOL);
+	CHECK(!bool(ret));
+
+	// Convertible argument types fall back to the generic path.
+	arg = 1;
+	object.callp("set_message_translation", args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(object.can_translate_messages());
+
+	// Variant arguments and return values.
+	Variant name = StringName("key");
+	Variant value = Vector2(1, 2);
+	const Variant *meta_args[2] = { &name, &value };
+	object.callp("set_meta", meta_args, 2, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	ret = object.callp("get_meta", meta_args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(Vector2(1, 2)));
+
+	// Calls through a Callable take the same path.
+	const Variant *has_args[1] = { &name };
+	Callable(&object, "has_meta").call(has_args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(true));
+
+	ret = object.callp("absent_method", nullptr, 0, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+}
+
+TEST_CASE("[Object] Emitting signals with binds") {
+	Object object;
+	Object target;
+	Object oneshot_target;
+
+	Vector<Variant> binds;
+	binds.push_back(StringName("emitted"));
+	binds.push_back(1);
+	object.connect("script_changed", Callable(&target, "set_meta"), binds);
+
+	Vector<Variant> oneshot_binds;
+	oneshot_binds.push_back(StringName("oneshot"));
+	oneshot_binds.push_back(2);
+	object.connect("script_changed", Callable(&oneshot_target, "set_meta"), oneshot_binds, Object::CONNECT_ONESHOT);
+
+	CHECK(object.emit_signal("script_changed") == OK);
+	CHECK(int(target.get_meta("emitted")) == 1);
+	CHECK(int(oneshot_target.get_meta("oneshot")) == 2);
+	CHECK(object.is_connected("script_changed", Callable(&target, "set_meta")));
+	CHECK_MESSAGE(
+			!object.is_connected("script_changed", Callable(&oneshot_target, "set_meta")),
+			"One shot connections should be disconnected after the first emission.");
+
+	target.set_meta("emitted", 0);
+	CHECK(object.emit_signal("script_changed") == OK);
+	CHECK(int(target.get_meta("emitted")) == 1);
+}
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -31,6 +31,7 @@
 #ifndef TEST_STRING_H
 #define TEST_STRING_H
 
+#include "core/string/string_builder.h"
 #include "core/string/ustring.h"
 
 #include "tests/test_macros.h"
@@ -1569,6 +1570,44 @@ TEST_CASE("[Stress][String] Empty via `is_empty()`") {
 		}
 	}
 }
+
+TEST_CASE("[StringBuilder] Appending") {
+	StringBuilder builder;
+	CHECK(builder.as_string().is_empty());
+
+	builder.append("Hello");
+	builder += String(", ");
+	builder += U'w';
+	builder.append(U"orld!", 5);
+	builder.append(String());
+	CHECK(builder.num_strings_appended() == 4);
+	CHECK(builder.get_string_length() == 13);
+	CHECK(builder.as_string() == "Hello, world!");
+
+	builder.clear();
+	CHECK(builder.get_string_length() == 0);
+
+	// Grows past the initial capacity several times.
+	String expected;
+	for (int i = 0; i < 1000; i++) {
+		builder.append(itos(i));
+		expected += itos(i);
+	}
+	CHECK(builder.as_string() == expected);
+}
+
+TEST_CASE("[String] Replace all matches") {
+	const String s = "Godot, godot, GODOT";
+	CHECK(s.replace("Godot", "Engine") == "Engine, godot, GODOT");
+	CHECK(s.replace(String("o"), String("0")) == "G0d0t, g0d0t, GODOT");
+	CHECK(s.replacen("godot", "x") == "x, x, x");
+	CHECK(s.replace("missing", "x") == s);
+
+	Dictionary values;
+	values["a"] = 1;
+	values["b"] = "two";
+	CHECK(String("{a} {b} {a}").format(values) == "1 two 1");
+}
 } // namespace TestString
 
 #endif // TEST_STRING_H
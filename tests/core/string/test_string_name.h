@@ -0,0 +1,103 @@
+/*************************************************************************/
+/*  test_string_name.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/safe_refcount.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	StringName a = "test_string_name_interning";
+	StringName b = String("test_string_name_interning");
+	StringName c = StringName::search("test_string_name_interning");
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a == "test_string_name_interning");
+	CHECK(StringName::search("test_string_name_never_created") == StringName());
+}
+
+TEST_CASE("[StringName] Table statistics") {
+	StringName::TableStatistics before = StringName::get_table_statistics();
+	StringName name = String("test_string_name_statistics");
+	StringName again = String("test_string_name_statistics");
+	StringName::TableStatistics after = StringName::get_table_statistics();
+
+	CHECK(after.lookups >= before.lookups + 2);
+	CHECK(after.misses >= before.misses + 1);
+	CHECK(after.entries >= 1);
+	CHECK(after.used_buckets <= after.table_size);
+	CHECK(after.longest_chain >= 1);
+}
+
+struct ThreadNameData {
+	StringName names[64];
+	SafeNumeric<uint32_t> mismatches;
+};
+
+static void _intern_names(void *p_userdata) {
+	ThreadNameData *data = (ThreadNameData *)p_userdata;
+	for (int round = 0; round < 50; round++) {
+		for (int i = 0; i < 64; i++) {
+			StringName name = "test_string_name_thread_" + itos(i);
+			if (name != data->names[i]) {
+				data->mismatches.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[StringName] Interning from several threads") {
+	ThreadNameData data;
+	for (int i = 0; i < 64; i++) {
+		data.names[i] = "test_string_name_thread_" + itos(i);
+	}
+
+	Thread threads[4];
+	for (int i = 0; i < 4; i++) {
+		threads[i].start(&_intern_names, &data);
+	}
+	for (int i = 0; i < 4; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK(data.mismatches.get() == 0);
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
@@ -383,6 +383,42 @@ TEST_CASE("[CommandQueue] Test Queue Lapping") {
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
 
+class CoalesceTarget {
+public:
+	int set_count = 0;
+	int values[2] = {};
+
+	void set_value(int p_index, int p_value) {
+		set_count++;
+		values[p_index] = p_value;
+	}
+};
+
+TEST_CASE("[CommandQueue] Test coalesced commands") {
+	CommandQueueMT command_queue(false);
+	CoalesceTarget target;
+
+	command_queue.push_coalesced(&target, &CoalesceTarget::set_value, 0, 1);
+	command_queue.push_coalesced(&target, &CoalesceTarget::set_value, 1, 2);
+	command_queue.push_coalesced(&target, &CoalesceTarget::set_value, 0, 3);
+	command_queue.push_coalesced(&target, &CoalesceTarget::set_value, 0, 4);
+	command_queue.flush_all();
+
+	CHECK_MESSAGE(target.set_count == 2,
+			"Pending commands with the same first argument should be merged.");
+	CHECK(target.values[0] == 4);
+	CHECK(target.values[1] == 2);
+
+	command_queue.push_coalesced(&target, &CoalesceTarget::set_value, 0, 5);
+	command_queue.flush_all();
+	command_queue.push_coalesced(&target, &CoalesceTarget::set_value, 0, 6);
+	command_queue.flush_all();
+
+	CHECK_MESSAGE(target.set_count == 4,
+			"Commands should not be merged across a flush.");
+	CHECK(target.values[0] == 6);
+}
+
 TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	const char *COMMAND_QUEUE_SETTING = "memory/limits/command_queue/multithreading_queue_size_kb";
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING, 1);
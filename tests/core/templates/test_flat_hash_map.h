@@ -0,0 +1,194 @@
+/*************************************************************************/
+/*  test_flat_hash_map.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/templates/flat_hash_map.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/oa_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert element") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[FlatHashMap] Overwrite element") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[FlatHashMap] Erase") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.insert(43, 85);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.erase(43));
+	CHECK(!map.erase(43));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[FlatHashMap] Many elements") {
+	FlatHashMap<int, int> map;
+	const int elem_max = 12343;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(i, i * 3);
+	}
+	CHECK(map.size() == elem_max);
+
+	// Leave tombstones behind, then reuse them.
+	for (int i = 0; i < elem_max; i += 2) {
+		CHECK(map.erase(i));
+	}
+	for (int i = elem_max; i < elem_max * 2; i += 2) {
+		map.insert(i, i * 3);
+	}
+
+	bool all_found = true;
+	for (int i = 0; i < elem_max * 2; i++) {
+		bool expected = i < elem_max ? (i % 2 == 1) : (i % 2 == 0);
+		const int *value = map.getptr(i);
+		if (expected != (value != nullptr) || (value && *value != i * 3)) {
+			all_found = false;
+		}
+	}
+	CHECK(all_found);
+
+	int count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.value == E.key * 3);
+		count++;
+	}
+	CHECK(count == (int)map.size());
+}
+
+TEST_CASE("[FlatHashMap] Non trivial keys and copy") {
+	FlatHashMap<String, String> map;
+	for (int i = 0; i < 100; i++) {
+		map[itos(i)] = "value " + itos(i);
+	}
+	map.erase("50");
+
+	FlatHashMap<String, String> copy = map;
+	map.clear();
+
+	CHECK(map.is_empty());
+	CHECK(copy.size() == 99);
+	CHECK(copy["10"] == "value 10");
+	CHECK(!copy.has("50"));
+}
+
+TEST_CASE("[FlatHashMap] Reserve") {
+	FlatHashMap<int, int> map;
+	map.reserve(1000);
+	uint32_t capacity = map.get_capacity();
+	CHECK(capacity >= 1000);
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	CHECK_MESSAGE(map.get_capacity() == capacity, "Reserved maps should not rehash.");
+}
+
+template <class M>
+static void _map_set(M &p_map, uint32_t p_key, uint32_t p_value) {
+	p_map.insert(p_key, p_value);
+}
+static void _map_set(OAHashMap<uint32_t, uint32_t> &p_map, uint32_t p_key, uint32_t p_value) {
+	p_map.set(p_key, p_value);
+}
+
+template <class M>
+static void _map_erase(M &p_map, uint32_t p_key) {
+	p_map.erase(p_key);
+}
+static void _map_erase(OAHashMap<uint32_t, uint32_t> &p_map, uint32_t p_key) {
+	p_map.remove(p_key);
+}
+
+template <class M>
+static uint64_t _benchmark_map(M &p_map, const LocalVector<uint32_t> &p_keys) {
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t i = 0; i < p_keys.size(); i++) {
+		_map_set(p_map, p_keys[i], i);
+	}
+	uint32_t found = 0;
+	for (int round = 0; round < 4; round++) {
+		for (uint32_t i = 0; i < p_keys.size(); i++) {
+			// Half of the lookups miss.
+			if (p_map.has(p_keys[i] + (i & 1))) {
+				found++;
+			}
+		}
+	}
+	for (uint32_t i = 0; i < p_keys.size(); i += 2) {
+		_map_erase(p_map, p_keys[i]);
+	}
+	uint64_t end = OS::get_singleton()->get_ticks_usec();
+	CHECK(found > 0);
+	return end - begin;
+}
+
+TEST_CASE("[Stress][FlatHashMap] Benchmark against HashMap and OAHashMap") {
+	LocalVector<uint32_t> keys;
+	for (uint32_t i = 0; i < 200000; i++) {
+		// Even keys, so lookups of key + 1 miss.
+		keys.push_back(hash_murmur3_one_32(i) & ~1u);
+	}
+
+	HashMap<uint32_t, uint32_t> hash_map;
+	OAHashMap<uint32_t, uint32_t> oa_hash_map;
+	FlatHashMap<uint32_t, uint32_t> flat_hash_map;
+
+	print_line(vformat("HashMap: %d usec", _benchmark_map(hash_map, keys)));
+	print_line(vformat("OAHashMap: %d usec", _benchmark_map(oa_hash_map, keys)));
+	print_line(vformat("FlatHashMap: %d usec", _benchmark_map(flat_hash_map, keys)));
+}
+
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
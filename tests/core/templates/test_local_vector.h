@@ -235,6 +235,82 @@ TEST_CASE("[LocalVector] Size / Resize / Reserve.") {
 	CHECK(vector.size() == 4);
 	CHECK(vector.get_capacity() >= 4);
 }
+
+TEST_CASE("[LocalVector] Frame allocator.") {
+	uint32_t allocations = FrameAllocator::get_thread_allocation_count();
+	{
+		FrameLocalVector<int> vector;
+		TightFrameLocalVector<String> strings;
+		for (int i = 0; i < 10000; i++) {
+			vector.push_back(i);
+		}
+		strings.push_back("A");
+		strings.push_back("B");
+
+		CHECK(FrameAllocator::get_thread_allocation_count() == allocations + 2);
+		CHECK(vector.size() == 10000);
+		for (int i = 0; i < 10000; i++) {
+			CHECK(vector[i] == i);
+		}
+		CHECK(strings[0] == "A");
+		CHECK(strings[1] == "B");
+
+		// Growing past the arena limits falls back to the heap, contents must be kept.
+		vector.resize(1000000);
+		CHECK(vector[9999] == 9999);
+	}
+	CHECK(FrameAllocator::get_thread_allocation_count() == allocations);
+}
+
+TEST_CASE("[LocalVector] Inline storage.") {
+	InlineLocalVector<String, 4> vector;
+	CHECK(vector.get_capacity() == 4);
+
+	for (int i = 0; i < 4; i++) {
+		vector.push_back(itos(i));
+	}
+	CHECK_MESSAGE(vector.is_inline(), "Vectors up to the inline capacity should not allocate.");
+
+	vector.push_back("4");
+	CHECK(!vector.is_inline());
+	CHECK(vector.size() == 5);
+	for (int i = 0; i < 5; i++) {
+		CHECK(vector[i] == itos(i));
+	}
+
+	InlineLocalVector<String, 4> copy = vector;
+	copy.remove_at(0);
+	CHECK(copy.size() == 4);
+	CHECK(copy[0] == "1");
+	CHECK(vector[0] == "0");
+
+	vector.reset();
+	CHECK(vector.is_empty());
+	CHECK(vector.is_inline());
+	CHECK(vector.get_capacity() == 4);
+}
+
+TEST_CASE("[LocalVector] InlineLocalVector moved by its container") {
+	// LocalVector moves its elements with memrealloc() when growing.
+	LocalVector<InlineLocalVector<int, 2>> vectors;
+	for (int i = 0; i < 64; i++) {
+		InlineLocalVector<int, 2> vector;
+		vector.push_back(i);
+		if (i % 2) {
+			vector.push_back(i + 1);
+			vector.push_back(i + 2);
+		}
+		vectors.push_back(vector);
+	}
+
+	for (int i = 0; i < 64; i++) {
+		CHECK(vectors[i].is_inline() == !(i % 2));
+		CHECK(vectors[i][0] == i);
+		if (i % 2) {
+			CHECK(vectors[i][2] == i + 2);
+		}
+	}
+}
 } // namespace TestLocalVector
 
 #endif // TEST_LOCAL_VECTOR_H
@@ -94,6 +94,33 @@ TEST_CASE("[LRU] Resize and clear") {
 	CHECK(!lru.has(3));
 	CHECK(!lru.has(4));
 }
+
+TEST_CASE("[LRU] Erase and evict") {
+	LRUCache<int, int> lru;
+
+	lru.set_capacity(3);
+	lru.insert(1, 10);
+	lru.insert(2, 20);
+	lru.insert(3, 30);
+
+	CHECK(lru.erase(2));
+	CHECK(!lru.erase(2));
+	CHECK(!lru.has(2));
+	CHECK(lru.get_size() == 2);
+
+	lru.get(1); // <3> is now the least recently used.
+
+	int key = 0;
+	int data = 0;
+	CHECK(lru.evict_least_recent(&key, &data));
+	CHECK(key == 3);
+	CHECK(data == 30);
+	CHECK(lru.evict_least_recent(&key, &data));
+	CHECK(key == 1);
+	CHECK(data == 10);
+	CHECK(!lru.evict_least_recent(&key, &data));
+	CHECK(lru.get_size() == 0);
+}
 } // namespace TestLRU
 
 #endif // TEST_LRU_H
@@ -0,0 +1,131 @@
+/*************************************************************************/
+/*  test_rid.h                                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_RID_H
+#define TEST_RID_H
+
+#include "core/os/thread.h"
+#include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRID {
+
+TEST_CASE("[RID_Owner] Allocation, lookup and free") {
+	RID_Owner<int> owner;
+
+	RID a = owner.make_rid(1);
+	RID b = owner.make_rid(2);
+	CHECK(owner.get_rid_count() == 2);
+	CHECK(owner.owns(a));
+	REQUIRE(owner.get_or_null(a) != nullptr);
+	CHECK(*owner.get_or_null(a) == 1);
+	CHECK(*owner.get_or_null(b) == 2);
+
+	owner.free(a);
+	CHECK(owner.get_rid_count() == 1);
+	CHECK_FALSE(owner.owns(a));
+	CHECK(owner.get_or_null(a) == nullptr);
+
+	RID c = owner.make_rid(3);
+	CHECK_MESSAGE(owner.get_or_null(a) == nullptr, "A reused slot must not validate the freed RID.");
+	CHECK(*owner.get_or_null(c) == 3);
+
+	owner.free(b);
+	owner.free(c);
+}
+
+struct LookupData {
+	RID_Owner<uint64_t, true> *owner = nullptr;
+	LocalVector<RID> *rids = nullptr;
+	SafeFlag *done = nullptr;
+	SafeNumeric<uint32_t> mismatches;
+};
+
+static void _lookup_thread(void *p_userdata) {
+	LookupData *data = (LookupData *)p_userdata;
+	// The first RIDs are never freed while the lookups run.
+	while (!data->done->is_set()) {
+		for (uint32_t i = 0; i < data->rids->size(); i++) {
+			uint64_t *value = data->owner->get_or_null((*data->rids)[i]);
+			if (!value || *value != i) {
+				data->mismatches.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[RID_Owner] Lock-free lookups while allocating") {
+	// Small chunks, so the chunk tables are regrown while other threads read them.
+	RID_Owner<uint64_t, true> owner(64);
+	LocalVector<RID> stable_rids;
+	for (uint64_t i = 0; i < 32; i++) {
+		stable_rids.push_back(owner.make_rid(i));
+	}
+
+	SafeFlag done;
+	LookupData data;
+	data.owner = &owner;
+	data.rids = &stable_rids;
+	data.done = &done;
+
+	Thread threads[2];
+	for (int i = 0; i < 2; i++) {
+		threads[i].start(&_lookup_thread, &data);
+	}
+
+	LocalVector<RID> temp_rids;
+	for (int round = 0; round < 20; round++) {
+		for (uint64_t i = 0; i < 500; i++) {
+			temp_rids.push_back(owner.make_rid(i));
+		}
+		for (uint32_t i = 0; i < temp_rids.size(); i++) {
+			owner.free(temp_rids[i]);
+		}
+		temp_rids.clear();
+	}
+
+	done.set();
+	for (int i = 0; i < 2; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK(data.mismatches.get() == 0);
+	CHECK(owner.get_rid_count() == stable_rids.size());
+
+	for (uint32_t i = 0; i < stable_rids.size(); i++) {
+		owner.free(stable_rids[i]);
+	}
+}
+
+} // namespace TestRID
+
+#endif // TEST_RID_H
@@ -0,0 +1,98 @@
+/*************************************************************************/
+/*  test_work_stealing_queue.h                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_WORK_STEALING_QUEUE_H
+#define TEST_WORK_STEALING_QUEUE_H
+
+#include "core/templates/work_stealing_queue.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingQueue {
+
+TEST_CASE("[WorkStealingQueue] Owner pops in LIFO order") {
+	WorkStealingQueue<int *, 8> queue;
+	int values[3] = { 0, 1, 2 };
+
+	CHECK(queue.is_empty());
+	for (int i = 0; i < 3; i++) {
+		CHECK(queue.push(&values[i]));
+	}
+	CHECK(!queue.is_empty());
+
+	int *value = nullptr;
+	CHECK(queue.pop(value));
+	CHECK(value == &values[2]);
+	CHECK(queue.pop(value));
+	CHECK(value == &values[1]);
+	CHECK(queue.pop(value));
+	CHECK(value == &values[0]);
+	CHECK(!queue.pop(value));
+	CHECK(queue.is_empty());
+}
+
+TEST_CASE("[WorkStealingQueue] Thieves steal in FIFO order") {
+	WorkStealingQueue<int *, 8> queue;
+	int values[3] = { 0, 1, 2 };
+
+	for (int i = 0; i < 3; i++) {
+		queue.push(&values[i]);
+	}
+
+	int *value = nullptr;
+	CHECK(queue.steal(value) == WorkStealingQueue<int *, 8>::STEAL_OK);
+	CHECK(value == &values[0]);
+	CHECK(queue.pop(value));
+	CHECK(value == &values[2]);
+	CHECK(queue.steal(value) == WorkStealingQueue<int *, 8>::STEAL_OK);
+	CHECK(value == &values[1]);
+	CHECK(queue.steal(value) == WorkStealingQueue<int *, 8>::STEAL_EMPTY);
+}
+
+TEST_CASE("[WorkStealingQueue] Push fails when full") {
+	WorkStealingQueue<int *, 4> queue;
+	int values[5] = { 0, 1, 2, 3, 4 };
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(queue.push(&values[i]));
+	}
+	CHECK(!queue.push(&values[4]));
+
+	int *value = nullptr;
+	CHECK(queue.steal(value) == WorkStealingQueue<int *, 4>::STEAL_OK);
+	// Wrapping around the ring buffer.
+	CHECK(queue.push(&values[4]));
+	CHECK(queue.pop(value));
+	CHECK(value == &values[4]);
+}
+
+} // namespace TestWorkStealingQueue
+
+#endif // TEST_WORK_STEALING_QUEUE_H
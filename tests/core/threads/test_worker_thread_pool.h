@@ -153,6 +153,128 @@ TEST_CASE("[WorkerThreadPool] Process 256 elements on native task group low prio
 	CHECK(callable_group_counter.get() == count - 1);
 }
 
+static SafeNumeric<uint32_t> nested_counter;
+static SafeNumeric<uint32_t> nested_outside_pool;
+
+static void static_nested_leaf_test(void *p_arg) {
+	nested_counter.increment();
+}
+
+static void static_nested_group_test(void *p_arg, uint32_t p_index) {
+	// Posting from inside a pool thread goes to that thread's local queue.
+	if (WorkerThreadPool::get_singleton()->get_thread_index() < 0) {
+		nested_outside_pool.increment();
+	}
+	const int count = 16;
+	WorkerThreadPool::TaskID tasks[count];
+	for (int i = 0; i < count; i++) {
+		tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_leaf_test, nullptr, true);
+	}
+	for (int i = 0; i < count; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Post tasks from inside a running group task") {
+	const int count = 64;
+	nested_counter.set(0);
+	nested_outside_pool.set(0);
+	CHECK(WorkerThreadPool::get_singleton()->get_thread_index() == -1);
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_test, nullptr, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	CHECK(nested_counter.get() == count * 16);
+	CHECK(nested_outside_pool.get() == 0);
+}
+
+static SafeNumeric<uint32_t> dependency_stage;
+static SafeNumeric<uint32_t> dependency_errors;
+
+static void static_dependency_first_test(void *p_arg) {
+	OS::get_singleton()->delay_usec(1000);
+	dependency_stage.set(1);
+}
+
+static void static_dependency_group_test(void *p_arg, uint32_t p_index) {
+	if (dependency_stage.get() != 1) {
+		dependency_errors.increment();
+	}
+	((SafeNumeric<uint32_t> *)p_arg)->increment();
+}
+
+static void static_dependency_last_test(void *p_arg) {
+	if (((SafeNumeric<uint32_t> *)p_arg)->get() != 64) {
+		dependency_errors.increment();
+	}
+	dependency_stage.set(2);
+}
+
+TEST_CASE("[WorkerThreadPool] Task and group dependencies") {
+	dependency_stage.set(0);
+	dependency_errors.set(0);
+	SafeNumeric<uint32_t> group_counter;
+
+	WorkerThreadPool::TaskID first = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_first_test, nullptr, true);
+
+	Vector<WorkerThreadPool::TaskID> group_dependencies;
+	group_dependencies.push_back(first);
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_dependency_group_test, &group_counter, 64, -1, true, String(), group_dependencies);
+
+	Vector<WorkerThreadPool::TaskID> last_dependencies;
+	last_dependencies.push_back(group);
+	last_dependencies.push_back(first);
+	WorkerThreadPool::TaskID last = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_last_test, &group_counter, true, String(), last_dependencies);
+
+	// Only the last stage is waited for, the rest run as continuations.
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(last);
+	CHECK(dependency_stage.get() == 2);
+	CHECK(dependency_errors.get() == 0);
+
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(first);
+
+	// Depending on tasks which were already waited for is valid, they are considered completed.
+	WorkerThreadPool::TaskID after_completed = WorkerThreadPool::get_singleton()->add_native_task(static_test, &group_counter, true, String(), last_dependencies);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(after_completed);
+	CHECK(group_counter.get() == 65);
+}
+
+TEST_CASE("[WorkerThreadPool] Profiling events") {
+	LocalVector<WorkerThreadPool::ProfilingEvent> events;
+	WorkerThreadPool::get_singleton()->set_profiling_enabled(true);
+	CHECK(WorkerThreadPool::get_singleton()->is_profiling_enabled());
+
+	const int count = 8;
+	SafeNumeric<uint32_t> counter;
+	WorkerThreadPool::TaskID tasks[count];
+	for (int i = 0; i < count; i++) {
+		tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_test, &counter, true, "ProfiledTask");
+	}
+	for (int i = 0; i < count; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+
+	// Events are recorded after tasks are flagged as completed, so wait until all of them are in.
+	uint64_t timeout = OS::get_singleton()->get_ticks_msec() + 5000;
+	while (events.size() < count && OS::get_singleton()->get_ticks_msec() < timeout) {
+		WorkerThreadPool::get_singleton()->flush_profiling_events(events);
+	}
+
+	CHECK(events.size() == count);
+	for (uint32_t i = 0; i < events.size(); i++) {
+		CHECK(events[i].description == "ProfiledTask");
+		CHECK(events[i].end_usec >= events[i].begin_usec);
+		CHECK(events[i].thread_index >= 0);
+		CHECK(events[i].thread_index < WorkerThreadPool::get_singleton()->get_thread_count());
+	}
+
+	WorkerThreadPool::get_singleton()->set_profiling_enabled(false);
+	CHECK(!WorkerThreadPool::get_singleton()->is_profiling_enabled());
+	events.clear();
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(WorkerThreadPool::get_singleton()->add_native_task(static_test, &counter, true));
+	WorkerThreadPool::get_singleton()->flush_profiling_events(events);
+	CHECK(events.size() == 0);
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -169,6 +169,52 @@ TEST_CASE("[Array] sort()") {
 	}
 }
 
+TEST_CASE("[Array] sort() and bsearch() on typed arrays") {
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Variant());
+	ints.push_back(30);
+	ints.push_back(-4);
+	ints.push_back(12);
+	ints.push_back(12);
+	ints.sort();
+	CHECK(int(ints[0]) == -4);
+	CHECK(int(ints[1]) == 12);
+	CHECK(int(ints[2]) == 12);
+	CHECK(int(ints[3]) == 30);
+	CHECK(ints.bsearch(12) == 1);
+	CHECK(ints.bsearch(12, false) == 3);
+	CHECK(ints.bsearch(100) == 4);
+
+	Array floats;
+	floats.set_typed(Variant::FLOAT, StringName(), Variant());
+	floats.push_back(2.5);
+	floats.push_back(-1.0);
+	floats.push_back(0.5);
+	floats.sort();
+	CHECK(double(floats[0]) == -1.0);
+	CHECK(double(floats[1]) == 0.5);
+	CHECK(double(floats[2]) == 2.5);
+	CHECK(floats.bsearch(1.0) == 2);
+
+	Array strings;
+	strings.set_typed(Variant::STRING, StringName(), Variant());
+	strings.push_back("pear");
+	strings.push_back("apple");
+	strings.push_back("fig");
+	strings.sort();
+	CHECK(String(strings[0]) == "apple");
+	CHECK(String(strings[1]) == "fig");
+	CHECK(String(strings[2]) == "pear");
+	CHECK(strings.bsearch("banana") == 1);
+
+	// Resizing pads typed arrays with nulls.
+	strings.resize(5);
+	strings.sort();
+	CHECK(strings.size() == 5);
+	CHECK(strings.has("apple"));
+	CHECK(strings.has("pear"));
+}
+
 TEST_CASE("[Array] push_front(), pop_front(), pop_back()") {
 	Array arr;
 	arr.push_front(1);
@@ -31,6 +31,7 @@
 #ifndef TEST_VARIANT_H
 #define TEST_VARIANT_H
 
+#include "core/os/os.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -737,6 +738,43 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser reads across the read-ahead buffer") {
+	// Long enough to need several refills of the stream's read-ahead buffer.
+	Array a;
+	for (int i = 0; i < 2000; i++) {
+		a.push_back(vformat("item_%d", i));
+	}
+	String a_str;
+	VariantWriter::write_to_string(a, a_str);
+	REQUIRE(a_str.length() > 16384);
+
+	String errs;
+	int line = 1;
+	Variant a_parsed;
+
+	VariantParser::StreamString ss;
+	ss.s = a_str;
+	CHECK(VariantParser::parse(&ss, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back from a string.");
+
+	const String path = OS::get_singleton()->get_cache_path().plus_file("variant_parser_stream.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(a_str);
+	}
+
+	VariantParser::StreamFile sf;
+	sf.f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(sf.f.is_valid());
+	a_parsed = Variant();
+	CHECK(VariantParser::parse(&sf, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back from a file.");
+
+	CHECK(sf.get_char() == 0);
+	CHECK(sf.is_eof());
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
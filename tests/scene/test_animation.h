@@ -136,6 +136,38 @@ TEST_CASE("[Animation] Create 3D position track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Compressed 3D position track") {
+	Ref<Animation> animation = memnew(Animation);
+	Ref<Animation> compressed_animation = memnew(Animation);
+	for (int i = 0; i < 2; i++) {
+		Ref<Animation> anim = i == 0 ? animation : compressed_animation;
+		anim->set_length(10.0);
+		const int track_index = anim->add_track(Animation::TYPE_POSITION_3D);
+		anim->track_set_path(track_index, NodePath("Enemy:position"));
+		for (int j = 0; j <= 100; j++) {
+			double time = j * 0.1;
+			anim->position_track_insert_key(track_index, time, Vector3(time, Math::sin(time), -time));
+		}
+	}
+	// Small pages, to go through the page lookup.
+	compressed_animation->compress(1024);
+
+	CHECK(compressed_animation->track_is_compressed(0));
+
+	for (int i = 0; i < 200; i++) {
+		double time = i * 0.05 + 0.01;
+		Vector3 expected;
+		CHECK(animation->position_track_interpolate(0, time, &expected) == OK);
+
+		// Sampled twice to also go through the decoded key cache.
+		for (int j = 0; j < 2; j++) {
+			Vector3 position;
+			CHECK(compressed_animation->position_track_interpolate(0, time, &position) == OK);
+			CHECK(position.distance_to(expected) < 0.01);
+		}
+	}
+}
+
 TEST_CASE("[Animation] Create 3D rotation track") {
 	Ref<Animation> animation = memnew(Animation);
 	const int track_index = animation->add_track(Animation::TYPE_ROTATION_3D);
@@ -0,0 +1,73 @@
+/*************************************************************************/
+/*  test_container.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_CONTAINER_H
+#define TEST_CONTAINER_H
+
+#include "scene/gui/box_container.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestContainer {
+
+TEST_CASE("[SceneTree][Container] Nested containers are sorted once per change") {
+	VBoxContainer *outer = memnew(VBoxContainer);
+	VBoxContainer *inner = memnew(VBoxContainer);
+	Control *child = memnew(Control);
+	inner->add_child(child);
+	outer->add_child(inner);
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+	MessageQueue::get_singleton()->flush();
+
+	SIGNAL_WATCH(outer, "sort_children");
+	SIGNAL_WATCH(inner, "sort_children");
+
+	child->set_custom_minimum_size(Size2(0, 100));
+	MessageQueue::get_singleton()->flush();
+
+	// The outer container resizes the inner one, which must then only be sorted once.
+	Array two_sorts;
+	two_sorts.push_back(Array());
+	two_sorts.push_back(Array());
+	SIGNAL_CHECK("sort_children", two_sorts);
+
+	CHECK(outer->get_size().y == doctest::Approx(100));
+	CHECK(inner->get_size().y == doctest::Approx(100));
+	CHECK(child->get_size().y == doctest::Approx(100));
+
+	SIGNAL_UNWATCH(outer, "sort_children");
+	SIGNAL_UNWATCH(inner, "sort_children");
+	memdelete(outer);
+}
+
+} // namespace TestContainer
+
+#endif // TEST_CONTAINER_H
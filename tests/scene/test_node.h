@@ -0,0 +1,182 @@
+/*************************************************************************/
+/*  test_node.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_H
+#define TEST_NODE_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
+#include "scene/main/node.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode {
+
+class TestProcessNode : public Node {
+	GDCLASS(TestProcessNode, Node);
+
+public:
+	int process_count = 0;
+	bool processed_on_main_thread = false;
+	bool stop_processing = false;
+
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			process_count++;
+			processed_on_main_thread = Thread::get_caller_id() == Thread::get_main_id();
+			if (stop_processing) {
+				// Deferred to the main thread when processed in a sub-thread group.
+				set_process(false);
+			}
+		}
+	}
+
+	TestProcessNode() {
+		set_process(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node] Process thread groups") {
+	Node *group_a = memnew(Node);
+	Node *group_b = memnew(Node);
+	group_a->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	group_b->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+
+	TestProcessNode *main_node = memnew(TestProcessNode);
+	TestProcessNode *node_a = memnew(TestProcessNode);
+	TestProcessNode *node_b = memnew(TestProcessNode);
+	TestProcessNode *node_b_main = memnew(TestProcessNode);
+	node_b_main->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+	node_b->stop_processing = true;
+
+	group_a->add_child(node_a);
+	group_b->add_child(node_b);
+	group_b->add_child(node_b_main);
+
+	Window *root = SceneTree::get_singleton()->get_root();
+	root->add_child(main_node);
+	root->add_child(group_a);
+	root->add_child(group_b);
+
+	SceneTree::get_singleton()->process(0.0);
+
+	CHECK(main_node->process_count == 1);
+	CHECK(main_node->processed_on_main_thread);
+	CHECK(node_b_main->process_count == 1);
+	CHECK(node_b_main->processed_on_main_thread);
+	CHECK(node_a->process_count == 1);
+	CHECK(node_b->process_count == 1);
+	if (WorkerThreadPool::get_singleton()->get_thread_count() > 0) {
+		CHECK_FALSE(node_a->processed_on_main_thread);
+		CHECK_FALSE(node_b->processed_on_main_thread);
+	}
+
+	// Deferred calls made from the groups are flushed by the end of the frame.
+	CHECK_FALSE(node_b->is_processing());
+
+	SUBCASE("Changing the group of a subtree") {
+		group_a->set_process_thread_group(Node::PROCESS_THREAD_GROUP_INHERIT);
+		SceneTree::get_singleton()->process(0.0);
+		CHECK(node_a->process_count == 2);
+		CHECK(node_a->processed_on_main_thread);
+	}
+
+	memdelete(main_node);
+	memdelete(group_a);
+	memdelete(group_b);
+}
+
+TEST_CASE("[Node] Repeated get_node() lookups follow tree changes") {
+	Node *root = memnew(Node);
+	Node *a = memnew(Node);
+	Node *b = memnew(Node);
+	a->set_name("A");
+	b->set_name("B");
+	root->add_child(a);
+	a->add_child(b);
+
+	const NodePath path("A/B");
+	CHECK(root->get_node_or_null(path) == b);
+	CHECK(root->get_node_or_null(path) == b);
+	CHECK(b->get_node_or_null(NodePath("../..")) == root);
+
+	b->set_name("C");
+	CHECK(root->get_node_or_null(path) == nullptr);
+	CHECK(root->get_node_or_null(NodePath("A/C")) == b);
+
+	Node *replacement = memnew(Node);
+	replacement->set_name("B");
+	a->add_child(replacement);
+	CHECK(root->get_node_or_null(path) == replacement);
+
+	a->remove_child(replacement);
+	CHECK(root->get_node_or_null(path) == nullptr);
+	memdelete(replacement);
+
+	a->set_owner(root);
+	b->set_owner(root);
+	b->set_unique_name_in_owner(true);
+	CHECK(a->get_node_or_null(NodePath("%C/..")) == a);
+	b->set_unique_name_in_owner(false);
+	CHECK(a->get_node_or_null(NodePath("%C/..")) == nullptr);
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node] Calling methods on groups of mixed classes") {
+	Window *root = SceneTree::get_singleton()->get_root();
+	Vector<Node *> nodes;
+	for (int i = 0; i < 4; i++) {
+		Node *node = i % 2 ? memnew(Node) : memnew(TestProcessNode);
+		node->add_to_group("test_group");
+		root->add_child(node);
+		nodes.push_back(node);
+	}
+
+	SceneTree::get_singleton()->call_group("test_group", "set_process_priority", 3);
+	for (int i = 0; i < nodes.size(); i++) {
+		CHECK(nodes[i]->get_process_priority() == 3);
+	}
+
+	// Arguments that need a conversion go through the generic call.
+	SceneTree::get_singleton()->call_group("test_group", "set_process_priority", 2.0);
+	for (int i = 0; i < nodes.size(); i++) {
+		CHECK(nodes[i]->get_process_priority() == 2);
+	}
+
+	for (int i = 0; i < nodes.size(); i++) {
+		memdelete(nodes[i]);
+	}
+}
+
+} // namespace TestNode
+
+#endif // TEST_NODE_H
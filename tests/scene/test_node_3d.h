@@ -0,0 +1,156 @@
+/*************************************************************************/
+/*  test_node_3d.h                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+public:
+	int transform_changes = 0;
+
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changes++;
+		}
+	}
+
+	void set_global_transform_silently(const Transform3D &p_transform) {
+		// Same as physics bodies do when syncing their state.
+		set_ignore_transform_notification(true);
+		set_global_transform(p_transform);
+		set_ignore_transform_notification(false);
+	}
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform changes propagate once per flush") {
+	Node3D *parent = memnew(Node3D);
+	TransformNotifiedNode3D *child = memnew(TransformNotifiedNode3D);
+	TransformNotifiedNode3D *grandchild = memnew(TransformNotifiedNode3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	child->transform_changes = 0;
+	grandchild->transform_changes = 0;
+
+	// Moving the parent and then its descendants in the same frame.
+	parent->set_position(Vector3(1, 0, 0));
+	child->set_position(Vector3(0, 2, 0));
+	grandchild->set_position(Vector3(0, 0, 3));
+	CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(1, 2, 3)));
+
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(child->transform_changes == 1);
+	CHECK(grandchild->transform_changes == 1);
+
+	// Descendants must still be notified after a flush, even if their global transform was never read.
+	parent->set_position(Vector3(2, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	parent->set_position(Vector3(3, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(child->transform_changes == 3);
+	CHECK(grandchild->transform_changes == 3);
+	CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(3, 2, 3)));
+
+	SUBCASE("Reading a global transform between changes") {
+		parent->set_position(Vector3(4, 0, 0));
+		CHECK(child->get_global_transform().origin.is_equal_approx(Vector3(4, 2, 0)));
+		parent->set_position(Vector3(5, 0, 0));
+		CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(5, 2, 3)));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(grandchild->transform_changes == 4);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node3D] Transform changes after ignoring transform notifications") {
+	Node3D *parent = memnew(Node3D);
+	TransformNotifiedNode3D *child = memnew(TransformNotifiedNode3D);
+	TransformNotifiedNode3D *grandchild = memnew(TransformNotifiedNode3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	child->transform_changes = 0;
+	grandchild->transform_changes = 0;
+
+	child->set_global_transform_silently(Transform3D(Basis(), Vector3(0, 2, 0)));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(child->transform_changes == 0);
+	CHECK(grandchild->transform_changes == 1);
+
+	// Moving the parent in the same frame as the ignored change must still notify the child.
+	child->set_global_transform_silently(Transform3D(Basis(), Vector3(0, 3, 0)));
+	parent->set_position(Vector3(1, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(child->transform_changes == 1);
+	CHECK(grandchild->transform_changes == 2);
+	CHECK(child->get_global_transform().origin.is_equal_approx(Vector3(1, 3, 0)));
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node3D] Transform changes after re-entering the tree") {
+	Node3D *parent = memnew(Node3D);
+	TransformNotifiedNode3D *child = memnew(TransformNotifiedNode3D);
+	parent->add_child(child);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	child->transform_changes = 0;
+
+	// Leaving the tree drops the child from the queue it was added to by the first move.
+	parent->set_position(Vector3(1, 0, 0));
+	parent->remove_child(child);
+	parent->add_child(child);
+	parent->set_position(Vector3(2, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(child->transform_changes == 1);
+	CHECK(child->get_global_transform().origin.is_equal_approx(Vector3(2, 0, 0)));
+
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
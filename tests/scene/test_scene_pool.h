@@ -0,0 +1,89 @@
+/*************************************************************************/
+/*  test_scene_pool.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SCENE_POOL_H
+#define TEST_SCENE_POOL_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/resources/scene_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+TEST_CASE("[SceneTree][ScenePool] Reusing and resetting instances") {
+	Node2D *root = memnew(Node2D);
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(1, 2));
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> scene;
+	scene.instantiate();
+	REQUIRE(scene->pack(root) == OK);
+	memdelete(root);
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(scene);
+
+	Node2D *instance = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(instance);
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node_or_null(NodePath("Child")));
+	REQUIRE(instance_child);
+	CHECK(pool->get_idle_count() == 0);
+
+	instance->set_position(Vector2(5, 5));
+	instance_child->set_position(Vector2(7, 7));
+	instance_child->set_visible(false);
+	pool->release(instance);
+	CHECK_MESSAGE(pool->get_idle_count() == 1, "Released instance should be kept.");
+
+	CHECK_MESSAGE(pool->acquire() == instance, "Released instance should be reused.");
+	CHECK_MESSAGE(instance->get_position() == Vector2(), "Properties should be reset to their default value.");
+	CHECK_MESSAGE(instance_child->get_position() == Vector2(1, 2), "Properties should be reset to their packed value.");
+	CHECK(instance_child->is_visible());
+
+	pool->prewarm(3);
+	CHECK(pool->get_idle_count() == 3);
+	pool->set_max_idle_count(1);
+	CHECK(pool->get_idle_count() == 1);
+
+	pool->release(instance);
+	CHECK_MESSAGE(pool->get_idle_count() == 1, "Instances past the maximum idle count should be freed.");
+
+	pool->clear();
+	CHECK(pool->get_idle_count() == 0);
+}
+
+} // namespace TestScenePool
+
+#endif // TEST_SCENE_POOL_H
@@ -0,0 +1,128 @@
+/*************************************************************************/
+/*  test_raster_occlusion_cull.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_RASTER_OCCLUSION_CULL_H
+#define TEST_RASTER_OCCLUSION_CULL_H
+
+#include "servers/rendering/raster_occlusion_cull.h"
+#include "tests/test_macros.h"
+
+namespace TestRasterOcclusionCull {
+
+static void add_quad(RasterOcclusionCull::RasterHZBuffer &r_buffer, real_t p_half_size, real_t p_z, const Projection &p_projection) {
+	const Vector3 vertices[4] = {
+		Vector3(-p_half_size, -p_half_size, p_z),
+		Vector3(p_half_size, -p_half_size, p_z),
+		Vector3(p_half_size, p_half_size, p_z),
+		Vector3(-p_half_size, p_half_size, p_z),
+	};
+	const int indices[6] = { 0, 1, 2, 0, 2, 3 };
+	r_buffer.add_triangles(vertices, indices, 6, Transform3D(), p_projection, p_projection.get_z_near());
+}
+
+static bool is_box_occluded(const RasterOcclusionCull::RasterHZBuffer &p_buffer, const Vector3 &p_min, const Vector3 &p_max, const Projection &p_projection) {
+	const real_t bounds[6] = { p_min.x, p_min.y, p_min.z, p_max.x, p_max.y, p_max.z };
+	return p_buffer.is_occluded(bounds, Vector3(), Transform3D(), p_projection, p_projection.get_z_near());
+}
+
+TEST_CASE("[RasterOcclusionCull] Perspective occluder") {
+	Projection projection;
+	projection.set_perspective(90, 1, 0.1, 100);
+
+	RasterOcclusionCull::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 64));
+	add_quad(buffer, 2, -5, projection);
+	buffer.rasterize(false, projection.get_z_far());
+	buffer.update_mips();
+
+	CHECK_MESSAGE(
+			is_box_occluded(buffer, Vector3(-0.5, -0.5, -20), Vector3(0.5, 0.5, -19), projection),
+			"Box behind the occluder should be occluded.");
+	CHECK_MESSAGE(
+			!is_box_occluded(buffer, Vector3(-0.5, -0.5, -3), Vector3(0.5, 0.5, -2), projection),
+			"Box in front of the occluder should not be occluded.");
+	CHECK_MESSAGE(
+			!is_box_occluded(buffer, Vector3(10, -0.5, -20), Vector3(11, 0.5, -19), projection),
+			"Box next to the occluder should not be occluded.");
+}
+
+TEST_CASE("[RasterOcclusionCull] Near plane clipping") {
+	Projection projection;
+	projection.set_perspective(90, 1, 0.1, 100);
+
+	RasterOcclusionCull::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 64));
+
+	add_quad(buffer, 2, 5, projection);
+	CHECK_MESSAGE(buffer.triangles.is_empty(), "Triangles behind the camera should be discarded.");
+
+	// A wall crossing the near plane, covering the right half of the view.
+	const Vector3 vertices[4] = {
+		Vector3(0.5, -50, 10),
+		Vector3(0.5, -50, -50),
+		Vector3(0.5, 50, -50),
+		Vector3(0.5, 50, 10),
+	};
+	const int indices[6] = { 0, 1, 2, 0, 2, 3 };
+	buffer.add_triangles(vertices, indices, 6, Transform3D(), projection, projection.get_z_near());
+	CHECK_MESSAGE(!buffer.triangles.is_empty(), "Triangles crossing the near plane should be clipped, not discarded.");
+
+	buffer.rasterize(false, projection.get_z_far());
+	buffer.update_mips();
+
+	CHECK_MESSAGE(
+			is_box_occluded(buffer, Vector3(5, -0.5, -20), Vector3(6, 0.5, -19), projection),
+			"Box behind the wall should be occluded.");
+	CHECK_MESSAGE(
+			!is_box_occluded(buffer, Vector3(-6, -0.5, -20), Vector3(-5, 0.5, -19), projection),
+			"Box on the other side of the wall should not be occluded.");
+}
+
+TEST_CASE("[RasterOcclusionCull] Orthogonal occluder") {
+	Projection projection;
+	projection.set_orthogonal(10, 1, 0.1, 100);
+
+	RasterOcclusionCull::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 64));
+	add_quad(buffer, 2, -5, projection);
+	buffer.rasterize(true, projection.get_z_far());
+	buffer.update_mips();
+
+	CHECK_MESSAGE(
+			is_box_occluded(buffer, Vector3(-0.5, -0.5, -20), Vector3(0.5, 0.5, -19), projection),
+			"Box behind the occluder should be occluded.");
+	CHECK_MESSAGE(
+			!is_box_occluded(buffer, Vector3(3, -0.5, -20), Vector3(4, 0.5, -19), projection),
+			"Box next to the occluder should not be occluded.");
+}
+
+} // namespace TestRasterOcclusionCull
+
+#endif // TEST_RASTER_OCCLUSION_CULL_H
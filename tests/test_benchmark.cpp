@@ -0,0 +1,244 @@
+/*************************************************************************/
+/*  test_benchmark.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_benchmark.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/templates/sort_array.h"
+#include "core/version.h"
+
+LocalVector<BenchmarkCase> *benchmark_cases = nullptr;
+
+int register_benchmark(const char *p_name, BenchmarkFunc p_function) {
+	if (!benchmark_cases) {
+		benchmark_cases = new LocalVector<BenchmarkCase>;
+	}
+	BenchmarkCase benchmark_case;
+	benchmark_case.name = p_name;
+	benchmark_case.function = p_function;
+	benchmark_cases->push_back(benchmark_case);
+	return 0;
+}
+
+struct BenchmarkStats {
+	uint64_t iterations = 0;
+	// Nanoseconds per iteration.
+	double min = 0.0;
+	double max = 0.0;
+	double mean = 0.0;
+	double median = 0.0;
+	double stddev = 0.0;
+	LocalVector<double> samples;
+};
+
+static const uint64_t MAX_ITERATIONS = uint64_t(1) << 40;
+
+static bool _run_benchmark_once(const BenchmarkCase &p_case, uint64_t p_iterations, uint64_t &r_usec) {
+	BenchmarkState state(p_iterations);
+	p_case.function(state);
+	if (!state.is_finished()) {
+		ERR_PRINT(vformat("Benchmark \"%s\" returned before running all the iterations.", p_case.name));
+		return false;
+	}
+	r_usec = state.get_elapsed_usec();
+	return true;
+}
+
+static bool _run_benchmark(const BenchmarkCase &p_case, int p_warmup, int p_repetitions, uint64_t p_min_usec, BenchmarkStats &r_stats) {
+	// Grow the iteration count until a repetition takes long enough for the timer resolution not to matter.
+	uint64_t iterations = 1;
+	uint64_t usec = 0;
+	while (true) {
+		if (!_run_benchmark_once(p_case, iterations, usec)) {
+			return false;
+		}
+		if (usec >= p_min_usec || iterations >= MAX_ITERATIONS) {
+			break;
+		}
+		// Aim a bit past the minimum time, but don't grow more than tenfold at once in case the first runs were noisy.
+		uint64_t next = usec > 0 ? uint64_t(double(iterations) * 1.4 * double(p_min_usec) / double(usec)) : iterations * 10;
+		iterations = CLAMP(next, iterations + 1, iterations * 10);
+	}
+
+	for (int i = 0; i < p_warmup; i++) {
+		if (!_run_benchmark_once(p_case, iterations, usec)) {
+			return false;
+		}
+	}
+
+	r_stats.iterations = iterations;
+	r_stats.samples.clear();
+	for (int i = 0; i < p_repetitions; i++) {
+		if (!_run_benchmark_once(p_case, iterations, usec)) {
+			return false;
+		}
+		r_stats.samples.push_back(double(usec) * 1000.0 / double(iterations));
+	}
+
+	LocalVector<double> sorted = r_stats.samples;
+	SortArray<double> sorter;
+	sorter.sort(sorted.ptr(), sorted.size());
+
+	r_stats.min = sorted[0];
+	r_stats.max = sorted[sorted.size() - 1];
+	r_stats.median = (sorted.size() & 1) ? sorted[sorted.size() / 2] : (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) * 0.5;
+
+	double sum = 0.0;
+	for (uint32_t i = 0; i < sorted.size(); i++) {
+		sum += sorted[i];
+	}
+	r_stats.mean = sum / sorted.size();
+
+	double variance = 0.0;
+	for (uint32_t i = 0; i < sorted.size(); i++) {
+		variance += (sorted[i] - r_stats.mean) * (sorted[i] - r_stats.mean);
+	}
+	r_stats.stddev = sorted.size() > 1 ? Math::sqrt(variance / (sorted.size() - 1)) : 0.0;
+
+	return true;
+}
+
+static String _format_time(double p_nsec) {
+	if (p_nsec < 1000.0) {
+		return String::num(p_nsec, 2) + " ns";
+	} else if (p_nsec < 1000000.0) {
+		return String::num(p_nsec / 1000.0, 2) + " us";
+	}
+	return String::num(p_nsec / 1000000.0, 2) + " ms";
+}
+
+static void _print_usage() {
+	print_line("Usage: godot --test --benchmark [options]");
+	print_line("  --benchmark-filter <text>       Only run the benchmarks whose name contains <text>, e.g. \"[HashMap]\".");
+	print_line("  --benchmark-list                List the benchmarks instead of running them.");
+	print_line("  --benchmark-warmup <count>      Repetitions to run and discard before measuring (default: 2).");
+	print_line("  --benchmark-repetitions <count> Measured repetitions (default: 10).");
+	print_line("  --benchmark-min-time <msec>     Minimum duration of a repetition, the iteration count is calibrated to reach it (default: 20).");
+	print_line("  --benchmark-json <path>         Also write the results to <path> in JSON format.");
+}
+
+int run_benchmarks(const List<String> &p_args) {
+	String filter;
+	String json_path;
+	int warmup = 2;
+	int repetitions = 10;
+	int min_msec = 20;
+	bool list = false;
+
+	for (const List<String>::Element *E = p_args.front(); E; E = E->next()) {
+		const String &arg = E->get();
+		const bool has_value = E->next() != nullptr;
+		if (arg == "--help" || arg == "-h") {
+			_print_usage();
+			return 0;
+		} else if (arg == "--benchmark-list") {
+			list = true;
+		} else if (arg == "--benchmark-filter" && has_value) {
+			filter = E->next()->get();
+			E = E->next();
+		} else if (arg == "--benchmark-warmup" && has_value) {
+			warmup = MAX(0, E->next()->get().to_int());
+			E = E->next();
+		} else if (arg == "--benchmark-repetitions" && has_value) {
+			repetitions = MAX(1, E->next()->get().to_int());
+			E = E->next();
+		} else if (arg == "--benchmark-min-time" && has_value) {
+			min_msec = MAX(1, E->next()->get().to_int());
+			E = E->next();
+		} else if (arg == "--benchmark-json" && has_value) {
+			json_path = E->next()->get();
+			E = E->next();
+		}
+	}
+
+	if (!benchmark_cases) {
+		print_line("No benchmarks registered.");
+		return 0;
+	}
+
+	Array results;
+	int failed = 0;
+
+	for (uint32_t i = 0; i < benchmark_cases->size(); i++) {
+		const BenchmarkCase &benchmark_case = (*benchmark_cases)[i];
+		const String name = String::utf8(benchmark_case.name);
+		if (!filter.is_empty() && name.find(filter) == -1) {
+			continue;
+		}
+
+		if (list) {
+			print_line(name);
+			continue;
+		}
+
+		BenchmarkStats stats;
+		if (!_run_benchmark(benchmark_case, warmup, repetitions, uint64_t(min_msec) * 1000, stats)) {
+			failed++;
+			continue;
+		}
+
+		print_line(name.rpad(60) + " " + _format_time(stats.median).lpad(12) + vformat(" (mean %s, stddev %.1f%%, min %s) x %d", _format_time(stats.mean), stats.mean > 0.0 ? stats.stddev / stats.mean * 100.0 : 0.0, _format_time(stats.min), int64_t(stats.iterations)));
+
+		Dictionary result;
+		result["name"] = name;
+		result["iterations"] = stats.iterations;
+		result["repetitions"] = repetitions;
+		result["median_ns"] = stats.median;
+		result["mean_ns"] = stats.mean;
+		result["stddev_ns"] = stats.stddev;
+		result["min_ns"] = stats.min;
+		result["max_ns"] = stats.max;
+		Array samples;
+		for (uint32_t j = 0; j < stats.samples.size(); j++) {
+			samples.push_back(stats.samples[j]);
+		}
+		result["samples_ns"] = samples;
+		results.push_back(result);
+	}
+
+	if (!json_path.is_empty()) {
+		Dictionary report;
+		report["version"] = VERSION_FULL_BUILD;
+		report["hash"] = VERSION_HASH;
+		report["warmup"] = warmup;
+		report["min_time_ms"] = min_msec;
+		report["benchmarks"] = results;
+
+		Error err;
+		Ref<FileAccess> f = FileAccess::open(json_path, FileAccess::WRITE, &err);
+		ERR_FAIL_COND_V_MSG(err != OK, 1, "Cannot write benchmark results to '" + json_path + "'.");
+		Ref<JSON> json;
+		json.instantiate();
+		f->store_string(json->stringify(report, "\t", false, true));
+	}
+
+	return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+/*************************************************************************/
+/*  test_benchmark.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_BENCHMARK_H
+#define TEST_BENCHMARK_H
+
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "tests/test_macros.h"
+
+// Microbenchmarks, run with `godot --test --benchmark`. See `--test --benchmark --help` for options.
+//
+// A benchmark runs the code to measure inside `while (state.keep_running())`, anything before the
+// loop is setup and isn't timed. The runner calibrates the iteration count so a repetition takes at
+// least the minimum time, runs the warmup repetitions, then reports statistics of the time per
+// iteration over the measured ones.
+//
+// BENCHMARK_CASE("[HashMap] Lookup") {
+//     HashMap<int, int> map;
+//     ... // Fill the map.
+//     int i = 0;
+//     while (state.keep_running()) {
+//         benchmark_do_not_optimize(map.getptr(i++ & 1023));
+//     }
+// }
+
+class BenchmarkState {
+	uint64_t iterations = 0;
+	uint64_t remaining = 0;
+	uint64_t start_usec = 0;
+	uint64_t end_usec = 0;
+	bool started = false;
+	bool finished = false;
+
+public:
+	_FORCE_INLINE_ bool keep_running() {
+		if (unlikely(!started)) {
+			started = true;
+			start_usec = OS::get_singleton()->get_ticks_usec();
+		}
+		if (unlikely(remaining == 0)) {
+			end_usec = OS::get_singleton()->get_ticks_usec();
+			finished = true;
+			return false;
+		}
+		remaining--;
+		return true;
+	}
+
+	uint64_t get_iterations() const { return iterations; }
+	bool is_finished() const { return finished; }
+	uint64_t get_elapsed_usec() const { return end_usec - start_usec; }
+
+	BenchmarkState(uint64_t p_iterations) {
+		iterations = p_iterations;
+		remaining = p_iterations;
+	}
+};
+
+// Keeps the compiler from optimizing away the computation of a value that is otherwise unused.
+template <class T>
+_FORCE_INLINE_ void benchmark_do_not_optimize(const T &p_value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile(""
+				 :
+				 : "r,m"(p_value)
+				 : "memory");
+#else
+	const volatile char *ptr = reinterpret_cast<const volatile char *>(&p_value);
+	(void)*ptr;
+#endif
+}
+
+typedef void (*BenchmarkFunc)(BenchmarkState &state);
+
+struct BenchmarkCase {
+	const char *name = nullptr;
+	BenchmarkFunc function = nullptr;
+};
+
+extern LocalVector<BenchmarkCase> *benchmark_cases;
+int register_benchmark(const char *p_name, BenchmarkFunc p_function);
+
+// Runs the registered benchmarks according to the command line, returns the exit code.
+int run_benchmarks(const List<String> &p_args);
+
+#define BENCHMARK_CASE_IMPL(m_func, m_name)                                                     \
+	static void m_func(BenchmarkState &state);                                                  \
+	DOCTEST_GLOBAL_NO_WARNINGS(DOCTEST_CAT(m_func, _REG), register_benchmark(m_name, &m_func))  \
+	static void m_func(BenchmarkState &state)
+
+#define BENCHMARK_CASE(m_name) BENCHMARK_CASE_IMPL(DOCTEST_ANONYMOUS(BENCHMARK_FUNC_), m_name)
+
+#endif // TEST_BENCHMARK_H
@@ -40,11 +40,14 @@
 #include "tests/core/io/test_xml_parser.h"
 #include "tests/core/math/test_aabb.h"
 #include "tests/core/math/test_astar.h"
+#include "tests/core/math/test_astar_grid_2d.h"
 #include "tests/core/math/test_basis.h"
 #include "tests/core/math/test_color.h"
+#include "tests/core/math/test_dynamic_bvh.h"
 #include "tests/core/math/test_expression.h"
 #include "tests/core/math/test_geometry_2d.h"
 #include "tests/core/math/test_geometry_3d.h"
+#include "tests/core/math/test_packed_array_math.h"
 #include "tests/core/math/test_plane.h"
 #include "tests/core/math/test_random_number_generator.h"
 #include "tests/core/math/test_rect2.h"
@@ -54,19 +57,24 @@
 #include "tests/core/math/test_vector3.h"
 #include "tests/core/math/test_vector3i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
 #include "tests/core/string/test_node_path.h"
 #include "tests/core/string/test_string.h"
+#include "tests/core/string/test_string_name.h"
 #include "tests/core/string/test_translation.h"
 #include "tests/core/templates/test_command_queue.h"
+#include "tests/core/templates/test_flat_hash_map.h"
 #include "tests/core/templates/test_hash_map.h"
 #include "tests/core/templates/test_hash_set.h"
 #include "tests/core/templates/test_list.h"
 #include "tests/core/templates/test_local_vector.h"
 #include "tests/core/templates/test_lru.h"
 #include "tests/core/templates/test_paged_array.h"
+#include "tests/core/templates/test_rid.h"
 #include "tests/core/templates/test_vector.h"
+#include "tests/core/templates/test_work_stealing_queue.h"
 #include "tests/core/test_crypto.h"
 #include "tests/core/test_hashing_context.h"
 #include "tests/core/test_time.h"
@@ -76,16 +84,26 @@
 #include "tests/core/variant/test_variant.h"
 #include "tests/scene/test_animation.h"
 #include "tests/scene/test_code_edit.h"
+#include "tests/scene/test_container.h"
 #include "tests/scene/test_curve.h"
 #include "tests/scene/test_gradient.h"
+#include "tests/scene/test_node.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
+#include "tests/scene/test_scene_pool.h"
 #include "tests/scene/test_text_edit.h"
 #include "tests/scene/test_theme.h"
+#include "tests/servers/test_raster_occlusion_cull.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
 
+#include "tests/benchmarks/benchmark_math.h"
+#include "tests/benchmarks/benchmark_templates.h"
+#include "tests/benchmarks/benchmark_variant.h"
+
 #include "modules/modules_tests.gen.h"
 
+#include "tests/test_benchmark.h"
 #include "tests/test_macros.h"
 
 #include "scene/resources/default_theme/default_theme.h"
@@ -106,6 +124,11 @@ int test_main(int argc, char *argv[]) {
 	}
 	OS::get_singleton()->set_cmdline("", args);
 
+	// Run microbenchmarks instead of the unit tests.
+	if (args.find("--benchmark")) {
+		return run_benchmarks(args);
+	}
+
 	// Run custom test tools.
 	if (test_commands) {
 		for (const KeyValue<String, TestFunc> &E : (*test_commands)) {